@@ -0,0 +1,30 @@
+# check_firmware.py
+# PlatformIO pre-build script for every env
+# Runs `make check-firmware` in ../adjective_model_larger256_4 before anything
+# is compiled, so a build fails on model sources or components in src/ that
+# are older copies than the ones there (`make firmware` refreshes them)
+
+import os
+import subprocess
+
+Import("env")
+
+MODEL_DIR = os.path.join(env.subst("$PROJECT_DIR"), "..", "adjective_model_larger256_4")
+
+
+def check_firmware():
+    try:
+        result = subprocess.run(["make", "-s", "-C", MODEL_DIR, "check-firmware"],
+                                stdout=subprocess.PIPE, stderr=subprocess.STDOUT, universal_newlines=True)
+    except OSError as e:
+        print("error: cannot run make to check the firmware copies: %s" % e)
+        env.Exit(1)
+    if result.returncode != 0:
+        print(result.stdout, end="")
+        print("error: src/ has stale model copies, run `make firmware` in %s" % os.path.normpath(MODEL_DIR))
+        env.Exit(1)
+
+
+# Only for builds: cleaning and custom targets such as uploadblob skip the check
+if not env.GetOption("clean") and not set(COMMAND_LINE_TARGETS) & {"uploadblob"}:
+    check_firmware()
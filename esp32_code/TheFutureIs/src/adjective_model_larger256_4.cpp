@@ -3,7 +3,21 @@
 // Pure C++ implementation for embedded systems
 
 #include "adjective_model_larger256_4.h"
+#if EMBEDDED_ML_WEIGHT_BLOB
+// Weights bound at run time by LoadWeights (adjective_model_larger256_4_export blob)
+#include "weight_blob.h"
+#elif EMBEDDED_ML_LOWRANK_WEIGHTS
+// Layers 1-3 factorized by truncated SVD (adjective_model_larger256_4_export lowrank)
+#include "adjective_model_larger256_4_lowrank_weights.cpp"
+#elif EMBEDDED_ML_PRUNED_WEIGHTS
+// Hidden units that never fire for a reachable input removed (adjective_model_larger256_4_export pruned)
+#include "adjective_model_larger256_4_pruned_weights.cpp"
+#elif EMBEDDED_ML_TILED_WEIGHTS
+// Layers 1-4 stored row-interleaved (adjective_model_larger256_4_export tiled)
+#include "adjective_model_larger256_4_tiled_weights.cpp"
+#else
 #include "adjective_model_larger256_4_weights.cpp"
+#endif
 #include "fully_connected.h"
 
 
@@ -15,51 +29,331 @@
 
 
 
+#include "profiler.h"
 #include "softmax.h"
+#include <algorithm>
 #include <cstddef>
 
 namespace embedded_ml {
 
-void adjective_model_larger256_4Model::Inference(const float* input, float* output) {
+// Output rows computed per pass over the input in layers 1-4
+static constexpr size_t kRowBlock = 4;
+
+#if EMBEDDED_ML_PRUNED_WEIGHTS && (EMBEDDED_ML_WEIGHT_BLOB || EMBEDDED_ML_TILED_WEIGHTS)
+#error "pruned weights are compiled in and row-major"
+#endif
+
+#if EMBEDDED_ML_LOWRANK_WEIGHTS && (EMBEDDED_ML_WEIGHT_BLOB || EMBEDDED_ML_TILED_WEIGHTS || EMBEDDED_ML_PRUNED_WEIGHTS)
+#error "low-rank weights are compiled in and row-major"
+#endif
+
+#if EMBEDDED_ML_FC_BACKEND == EMBEDDED_ML_FC_BACKEND_ESP_DSP && EMBEDDED_ML_TILED_WEIGHTS
+#error "the ESP-DSP backend reads row-major weights"
+#endif
+
+#if !EMBEDDED_ML_PRUNED_WEIGHTS
+// Width of each intermediate buffer (smaller with the pruned weights)
+static constexpr size_t kBuffer11Size = 256;
+static constexpr size_t kBuffer12Size = 256;
+static constexpr size_t kBuffer13Size = 256;
+static constexpr size_t kBuffer14Size = 256;
+#endif
+
+#if EMBEDDED_ML_WEIGHT_BLOB
+// Same names as the generated weight arrays, pointing into the blob once loaded
+static const float* weight_0_arith_constant = nullptr;
+static const float* weight_1_arith_constant1 = nullptr;
+static const float* weight_2_arith_constant2 = nullptr;
+static const float* weight_3_arith_constant3 = nullptr;
+static const float* weight_4_arith_constant4 = nullptr;
+static const float* weight_5_arith_constant5 = nullptr;
+static const float* weight_6_arith_constant6 = nullptr;
+static const float* weight_7_arith_constant7 = nullptr;
+static const float* weight_8_sequential_1_dense_1_MatMul = nullptr;
+static const float* weight_9_sequential_1_dense_1_Relu_sequential_1_dense_1_BiasAdd = nullptr;
+
+#if EMBEDDED_ML_TILED_WEIGHTS
+// Layers 1-4 must come from a blob exported with `blob-tiled`
+static constexpr WeightLayout kHiddenLayout = WeightLayout::TILED;
+static constexpr uint8_t kHiddenTileRows = kRowBlock;
+#else
+static constexpr WeightLayout kHiddenLayout = WeightLayout::ROW_MAJOR;
+static constexpr uint8_t kHiddenTileRows = 0;
+#endif
+
+struct BlobBinding {
+    WeightTensorSpec spec;
+    const float** target;
+};
+
+static const BlobBinding kBlobBindings[] = {
+    { { "weight_0_arith_constant", WeightDType::FLOAT32, WeightLayout::ROW_MAJOR, 0, 1, { 256 } }, &weight_0_arith_constant },
+    { { "weight_1_arith_constant1", WeightDType::FLOAT32, WeightLayout::ROW_MAJOR, 0, 1, { 256 } }, &weight_1_arith_constant1 },
+    { { "weight_2_arith_constant2", WeightDType::FLOAT32, WeightLayout::ROW_MAJOR, 0, 1, { 256 } }, &weight_2_arith_constant2 },
+    { { "weight_3_arith_constant3", WeightDType::FLOAT32, WeightLayout::ROW_MAJOR, 0, 1, { 28 } }, &weight_3_arith_constant3 },
+    { { "weight_4_arith_constant4", WeightDType::FLOAT32, kHiddenLayout, kHiddenTileRows, 2, { 28, 256 } }, &weight_4_arith_constant4 },
+    { { "weight_5_arith_constant5", WeightDType::FLOAT32, kHiddenLayout, kHiddenTileRows, 2, { 256, 256 } }, &weight_5_arith_constant5 },
+    { { "weight_6_arith_constant6", WeightDType::FLOAT32, kHiddenLayout, kHiddenTileRows, 2, { 256, 256 } }, &weight_6_arith_constant6 },
+    { { "weight_7_arith_constant7", WeightDType::FLOAT32, kHiddenLayout, kHiddenTileRows, 2, { 256, 256 } }, &weight_7_arith_constant7 },
+    { { "weight_8_sequential_1_dense_1_MatMul", WeightDType::FLOAT32, WeightLayout::COLUMN_MAJOR, 0, 2, { 29, 256 } }, &weight_8_sequential_1_dense_1_MatMul },
+    { { "weight_9_sequential_1_dense_1_Relu_sequential_1_dense_1_BiasAdd", WeightDType::FLOAT32, WeightLayout::ROW_MAJOR, 0, 1, { 256 } }, &weight_9_sequential_1_dense_1_Relu_sequential_1_dense_1_BiasAdd },
+};
+
+bool adjective_model_larger256_4Model::LoadWeights(const void* blob, size_t size) {
+    const WeightBlobHeader* header = ValidateWeightBlob(blob, size);
+    if (!header) return false;
+
+    const float* found[sizeof(kBlobBindings) / sizeof(kBlobBindings[0])];
+    for (size_t i = 0; i < sizeof(kBlobBindings) / sizeof(kBlobBindings[0]); ++i) {
+        found[i] = static_cast<const float*>(FindWeightTensor(header, kBlobBindings[i].spec));
+        if (!found[i]) return false;
+    }
+    // Bind only once every tensor checked out, so a bad blob leaves earlier weights in place
+    for (size_t i = 0; i < sizeof(kBlobBindings) / sizeof(kBlobBindings[0]); ++i) {
+        *kBlobBindings[i].target = found[i];
+    }
+    return true;
+}
+#elif EMBEDDED_ML_TILED_WEIGHTS
+static_assert(kRowBlock == kTiledRowBlock, "tiled weights were exported for a different row block");
+#endif
+
+// Layers 1-4: register-blocked, reading row-major or tiled weights; row-major
+// layers go through the EMBEDDED_ML_FC_BACKEND kernel
+// Shapes and activation are template arguments so each layer gets its own fully specialized kernel
+// kPortable: the portable row-major kernel whatever the backend (the backend check's reference)
+template<size_t In, size_t Out, ActivationType Act, bool kPortable = false>
+static inline void FullyConnectedHidden(const float* input, const float* weights, const float* bias, float* output) {
+    static_assert(Out <= adjective_model_larger256_4Model::kArenaSlotSize, "layer output must fit an arena slot");
+#if EMBEDDED_ML_TILED_WEIGHTS
+    FullyConnectedTiled<float, In, Out, Act, kRowBlock>(input, weights, bias, output);
+#else
+    if (kPortable) {
+        FullyConnected<float, In, Out, Act, kRowBlock>(input, weights, bias, output);
+    } else {
+        FullyConnectedRowMajor<In, Out, Act, kRowBlock>(input, weights, bias, output);
+    }
+#endif
+}
+
+#if EMBEDDED_ML_LOWRANK_WEIGHTS
+static_assert(kLowRank <= adjective_model_larger256_4Model::kArenaSlotSize, "rank must fit the rank buffer");
+
+// Layers 1-3 factorized as up * down: project onto kLowRank values, then expand
+// with the layer's bias and activation
+template<size_t In, size_t Out, ActivationType Act, bool kPortable = false>
+static inline void FullyConnectedLowRank(const float* input, const float* down, const float* up, const float* bias, float* rank_buffer, float* output) {
+    FullyConnectedHidden<In, kLowRank, ActivationType::NONE, kPortable>(input, down, lowrank_zero_bias, rank_buffer);
+    FullyConnectedHidden<kLowRank, Out, Act, kPortable>(rank_buffer, up, bias, output);
+}
+#endif
+
+// Layers 1-4 on a batch, one pass over the weights, on the same backend as
+// FullyConnectedHidden so batched outputs match the single-item ones
+static inline void FullyConnectedHiddenBatch(const float* inputs, const float* weights, const float* bias, float* outputs, size_t input_size, size_t output_size, size_t batch, ActivationType activation) {
+#if EMBEDDED_ML_TILED_WEIGHTS
+    FullyConnectedBatch<float, kRowBlock, true>(inputs, weights, bias, outputs, input_size, output_size, batch, activation);
+#elif EMBEDDED_ML_FC_BACKEND == EMBEDDED_ML_FC_BACKEND_ESP_DSP
+    FullyConnectedBatchEspDsp(inputs, weights, bias, outputs, input_size, output_size, batch, activation);
+#else
+    FullyConnectedBatch<float, kRowBlock, false>(inputs, weights, bias, outputs, input_size, output_size, batch, activation);
+#endif
+}
+
+void adjective_model_larger256_4Model::Inference(Context& ctx, const float* input, float* output) {
+
+    InferenceLogits(ctx, input, ctx.arena[0]);
+
+    // Layer 5: SOFTMAX
+
+    EMBEDDED_ML_PROFILED("softmax_dense", Softmax<float, kOutputSize>(ctx.arena[0], output));
+
+}
+
+void adjective_model_larger256_4Model::InferenceOneHot(Context& ctx, size_t index, float scalar, float* output) {
+
+    InferenceOneHotLogits(ctx, index, scalar, ctx.arena[0]);
+
+    // Layer 5: SOFTMAX
+
+    EMBEDDED_ML_PROFILED("softmax", Softmax<float, kOutputSize>(ctx.arena[0], output));
+
+}
+
+void adjective_model_larger256_4Model::InferenceLogits(Context& ctx, const float* input, float* logits) {
+
+    // Layer 0: FULLY_CONNECTED (column-major weights, writes buffer_11 to arena slot 0)
+
+    EMBEDDED_ML_PROFILED("fc0_dense", FullyConnectedColumnMajor<float, kInputSize, kBuffer11Size, ActivationType::RELU>(input, weight_8_sequential_1_dense_1_MatMul, weight_9_sequential_1_dense_1_Relu_sequential_1_dense_1_BiasAdd, ctx.arena[0]));
+
+    InferenceHidden(ctx, logits);
+
+}
+
+void adjective_model_larger256_4Model::InferenceOneHotLogits(Context& ctx, size_t index, float scalar, float* logits) {
+
+    // Layer 0: FULLY_CONNECTED (one-hot + scalar input, writes buffer_11 to arena slot 0)
+
+    EMBEDDED_ML_PROFILED("fc0", FullyConnectedOneHotPlusScalar<float, kInputSize, kBuffer11Size, ActivationType::RELU>(index, scalar, weight_8_sequential_1_dense_1_MatMul, weight_9_sequential_1_dense_1_Relu_sequential_1_dense_1_BiasAdd, ctx.arena[0]));
+
+    InferenceHidden(ctx, logits);
+
+}
+
+void adjective_model_larger256_4Model::InferenceOneHotLogitsPortable(Context& ctx, size_t index, float scalar, float* logits) {
+
+    // Layer 0: FULLY_CONNECTED (one-hot + scalar input, writes buffer_11 to arena slot 0)
+
+    FullyConnectedOneHotPlusScalar<float, kInputSize, kBuffer11Size, ActivationType::RELU>(index, scalar, weight_8_sequential_1_dense_1_MatMul, weight_9_sequential_1_dense_1_Relu_sequential_1_dense_1_BiasAdd, ctx.arena[0]);
+
+    InferenceHidden<true>(ctx, logits);
+
+}
+
+template<bool kPortable>
+void adjective_model_larger256_4Model::InferenceHidden(Context& ctx, float* buffer_15) {
+
+    // Intermediate buffers (ping-pong between the two arena slots)
 
-    // Layer 0: FULLY_CONNECTED
+    const float* buffer_11 = ctx.arena[0];
 
-    FullyConnected(input, weight_8_sequential_1_dense_1_MatMul, weight_9_sequential_1_dense_1_Relu_sequential_1_dense_1_BiasAdd, buffer_11, 29, 256, ActivationType::RELU);
+    float* buffer_12 = ctx.arena[1];
+
+    float* buffer_13 = ctx.arena[0];
+
+    float* buffer_14 = ctx.arena[1];
 
     // Layer 1: FULLY_CONNECTED
 
-    FullyConnected(buffer_11, weight_7_arith_constant7, weight_2_arith_constant2, buffer_12, 256, 256, ActivationType::RELU);
+#if EMBEDDED_ML_LOWRANK_WEIGHTS
+    EMBEDDED_ML_PROFILED(kPortable ? "fc1_portable" : "fc1", FullyConnectedLowRank<kBuffer11Size, kBuffer12Size, ActivationType::RELU, kPortable>(buffer_11, weight_7_arith_constant7_down, weight_7_arith_constant7_up, weight_2_arith_constant2, ctx.rank_buffer, buffer_12));
+#else
+    EMBEDDED_ML_PROFILED(kPortable ? "fc1_portable" : "fc1", FullyConnectedHidden<kBuffer11Size, kBuffer12Size, ActivationType::RELU, kPortable>(buffer_11, weight_7_arith_constant7, weight_2_arith_constant2, buffer_12));
+#endif
 
     // Layer 2: FULLY_CONNECTED
 
-    FullyConnected(buffer_12, weight_6_arith_constant6, weight_1_arith_constant1, buffer_13, 256, 256, ActivationType::RELU);
+#if EMBEDDED_ML_LOWRANK_WEIGHTS
+    EMBEDDED_ML_PROFILED(kPortable ? "fc2_portable" : "fc2", FullyConnectedLowRank<kBuffer12Size, kBuffer13Size, ActivationType::RELU, kPortable>(buffer_12, weight_6_arith_constant6_down, weight_6_arith_constant6_up, weight_1_arith_constant1, ctx.rank_buffer, buffer_13));
+#else
+    EMBEDDED_ML_PROFILED(kPortable ? "fc2_portable" : "fc2", FullyConnectedHidden<kBuffer12Size, kBuffer13Size, ActivationType::RELU, kPortable>(buffer_12, weight_6_arith_constant6, weight_1_arith_constant1, buffer_13));
+#endif
 
     // Layer 3: FULLY_CONNECTED
 
-    FullyConnected(buffer_13, weight_5_arith_constant5, weight_0_arith_constant, buffer_14, 256, 256, ActivationType::RELU);
+#if EMBEDDED_ML_LOWRANK_WEIGHTS
+    EMBEDDED_ML_PROFILED(kPortable ? "fc3_portable" : "fc3", FullyConnectedLowRank<kBuffer13Size, kBuffer14Size, ActivationType::RELU, kPortable>(buffer_13, weight_5_arith_constant5_down, weight_5_arith_constant5_up, weight_0_arith_constant, ctx.rank_buffer, buffer_14));
+#else
+    EMBEDDED_ML_PROFILED(kPortable ? "fc3_portable" : "fc3", FullyConnectedHidden<kBuffer13Size, kBuffer14Size, ActivationType::RELU, kPortable>(buffer_13, weight_5_arith_constant5, weight_0_arith_constant, buffer_14));
+#endif
 
     // Layer 4: FULLY_CONNECTED
 
-    FullyConnected(buffer_14, weight_4_arith_constant4, weight_3_arith_constant3, buffer_15, 256, 28, ActivationType::NONE);
+    EMBEDDED_ML_PROFILED(kPortable ? "fc4_portable" : "fc4", FullyConnectedHidden<kBuffer14Size, kOutputSize, ActivationType::NONE, kPortable>(buffer_14, weight_4_arith_constant4, weight_3_arith_constant3, buffer_15));
 
-    // Layer 5: SOFTMAX
+}
+
+void adjective_model_larger256_4Model::InferenceBatch(BatchContext& ctx, const float* inputs, float* outputs, size_t batch) {
+
+    for (size_t start = 0; start < batch; start += kMaxBatch) {
+        const size_t n = std::min(kMaxBatch, batch - start);
+
+        // Layer 0: FULLY_CONNECTED (column-major weights, writes buffer_11 rows packed into arena slot 0)
+
+        for (size_t b = 0; b < n; ++b) {
+            FullyConnectedColumnMajor<float, kInputSize, kBuffer11Size, ActivationType::RELU>(inputs + (start + b) * kInputSize, weight_8_sequential_1_dense_1_MatMul, weight_9_sequential_1_dense_1_Relu_sequential_1_dense_1_BiasAdd, ctx.arena[0][0] + b * kBuffer11Size);
+        }
+
+        InferenceHiddenBatch(ctx, ctx.arena[0][0], n);
+
+        // Layer 5: SOFTMAX
 
-    Softmax(buffer_15, output, 28);
+        for (size_t b = 0; b < n; ++b) {
+            Softmax<float, kOutputSize>(ctx.arena[0][0] + b * kOutputSize, outputs + (start + b) * kOutputSize);
+        }
+    }
 
 }
 
+void adjective_model_larger256_4Model::InferenceBatchOneHot(BatchContext& ctx, const size_t* indices, const float* scalars, float* outputs, size_t batch) {
+
+    for (size_t start = 0; start < batch; start += kMaxBatch) {
+        const size_t n = std::min(kMaxBatch, batch - start);
+
+        InferenceBatchOneHotLogits(ctx, indices + start, scalars + start, ctx.arena[0][0], n);
+
+        // Layer 5: SOFTMAX
+
+        for (size_t b = 0; b < n; ++b) {
+            Softmax<float, kOutputSize>(ctx.arena[0][0] + b * kOutputSize, outputs + (start + b) * kOutputSize);
+        }
+    }
+
+}
+
+void adjective_model_larger256_4Model::InferenceBatchOneHotLogits(BatchContext& ctx, const size_t* indices, const float* scalars, float* logits, size_t batch) {
+
+    for (size_t start = 0; start < batch; start += kMaxBatch) {
+        const size_t n = std::min(kMaxBatch, batch - start);
+
+        // Layer 0: FULLY_CONNECTED (one-hot + scalar input, writes buffer_11 rows packed into arena slot 0)
+
+        for (size_t b = 0; b < n; ++b) {
+            FullyConnectedOneHotPlusScalar<float, kInputSize, kBuffer11Size, ActivationType::RELU>(indices[start + b], scalars[start + b], weight_8_sequential_1_dense_1_MatMul, weight_9_sequential_1_dense_1_Relu_sequential_1_dense_1_BiasAdd, ctx.arena[0][0] + b * kBuffer11Size);
+        }
 
-// Intermediate buffer definitions
+        InferenceHiddenBatch(ctx, logits + start * kOutputSize, n);
+    }
 
-float adjective_model_larger256_4Model::buffer_11[256];
+}
+
+void adjective_model_larger256_4Model::InferenceHiddenBatch(BatchContext& ctx, float* buffer_15, size_t batch) {
+
+    // Intermediate buffers (ping-pong between the two arena slots, rows packed at their layer width)
+
+    const float* buffer_11 = ctx.arena[0][0];
+
+    float* buffer_12 = ctx.arena[1][0];
+
+    float* buffer_13 = ctx.arena[0][0];
+
+    float* buffer_14 = ctx.arena[1][0];
+
+    // Layers 1-3: FULLY_CONNECTED
+
+#if EMBEDDED_ML_LOWRANK_WEIGHTS
+    // Down projections into the rank buffer (rows packed at kLowRank), then expand
+
+    float* rank_buffer = ctx.rank_buffer[0];
+
+    FullyConnectedHiddenBatch(buffer_11, weight_7_arith_constant7_down, lowrank_zero_bias, rank_buffer, kBuffer11Size, kLowRank, batch, ActivationType::NONE);
+    FullyConnectedHiddenBatch(rank_buffer, weight_7_arith_constant7_up, weight_2_arith_constant2, buffer_12, kLowRank, kBuffer12Size, batch, ActivationType::RELU);
+
+    FullyConnectedHiddenBatch(buffer_12, weight_6_arith_constant6_down, lowrank_zero_bias, rank_buffer, kBuffer12Size, kLowRank, batch, ActivationType::NONE);
+    FullyConnectedHiddenBatch(rank_buffer, weight_6_arith_constant6_up, weight_1_arith_constant1, buffer_13, kLowRank, kBuffer13Size, batch, ActivationType::RELU);
+
+    FullyConnectedHiddenBatch(buffer_13, weight_5_arith_constant5_down, lowrank_zero_bias, rank_buffer, kBuffer13Size, kLowRank, batch, ActivationType::NONE);
+    FullyConnectedHiddenBatch(rank_buffer, weight_5_arith_constant5_up, weight_0_arith_constant, buffer_14, kLowRank, kBuffer14Size, batch, ActivationType::RELU);
+#else
+    FullyConnectedHiddenBatch(buffer_11, weight_7_arith_constant7, weight_2_arith_constant2, buffer_12, kBuffer11Size, kBuffer12Size, batch, ActivationType::RELU);
+
+    FullyConnectedHiddenBatch(buffer_12, weight_6_arith_constant6, weight_1_arith_constant1, buffer_13, kBuffer12Size, kBuffer13Size, batch, ActivationType::RELU);
+
+    FullyConnectedHiddenBatch(buffer_13, weight_5_arith_constant5, weight_0_arith_constant, buffer_14, kBuffer13Size, kBuffer14Size, batch, ActivationType::RELU);
+#endif
+
+    // Layer 4: FULLY_CONNECTED (logits packed at stride 28)
+
+    FullyConnectedHiddenBatch(buffer_14, weight_4_arith_constant4, weight_3_arith_constant3, buffer_15, kBuffer14Size, kOutputSize, batch, ActivationType::NONE);
+
+}
 
-float adjective_model_larger256_4Model::buffer_12[256];
 
-float adjective_model_larger256_4Model::buffer_13[256];
+// Default contexts for the static wrappers
 
-float adjective_model_larger256_4Model::buffer_14[256];
+adjective_model_larger256_4Model::Context adjective_model_larger256_4Model::default_context;
 
-float adjective_model_larger256_4Model::buffer_15[28];
+adjective_model_larger256_4Model::BatchContext adjective_model_larger256_4Model::default_batch_context;
 
 
 } // namespace embedded_ml
@@ -14,27 +14,127 @@ public:
     static constexpr size_t kInputSize = 29;
     static constexpr size_t kOutputSize = 28;
 
+    // Widest intermediate layer output
+    static constexpr size_t kArenaSlotSize = 256;
+
+    // Activation scratch for one inference at a time
+    // Give each thread or task its own Context to run inference concurrently
+    struct Context {
+        // Each layer only reads the previous layer's output, so intermediate
+        // buffers alternate between two slots sized to the widest layer:
+        //   slot 0: buffer_11, buffer_13, buffer_15
+        //   slot 1: buffer_12, buffer_14
+        float arena[2][kArenaSlotSize];
+#if EMBEDDED_ML_LOWRANK_WEIGHTS
+        // Output of a factorized layer's down projection (rank <= kArenaSlotSize)
+        float rank_buffer[kArenaSlotSize];
+#endif
+    };
+
+    // Largest batch processed per pass by the batched entry points (larger batches are chunked)
+    static constexpr size_t kMaxBatch = 16;
+
+    // Activation scratch for batched inference: the same two slots, one row per batch item
+    struct BatchContext {
+        float arena[2][kMaxBatch][kArenaSlotSize];
+#if EMBEDDED_ML_LOWRANK_WEIGHTS
+        float rank_buffer[kMaxBatch][kArenaSlotSize];
+#endif
+    };
 
-private:
-    // Intermediate buffers for layer outputs
-
-    static float buffer_11[256];
-
-    static float buffer_12[256];
-
-    static float buffer_13[256];
 
-    static float buffer_14[256];
+private:
+    // Context behind the static wrappers below
+    static Context default_context;
+    static BatchContext default_batch_context;
 
-    static float buffer_15[28];
+    // Layers 1-4, shared by all input paths (reads buffer_11 from arena slot 0)
+    // buffer_15: logits output, may be arena slot 0 but not slot 1
+    // kPortable: use the portable kernels whatever EMBEDDED_ML_FC_BACKEND selects
+    template<bool kPortable = false>
+    static void InferenceHidden(Context& ctx, float* buffer_15);
 
+    // Batched layers 1-4 for batch <= kMaxBatch (reads buffer_11 rows packed into arena slot 0)
+    // buffer_15: logits output packed at stride kOutputSize, may be arena slot 0 but not slot 1
+    static void InferenceHiddenBatch(BatchContext& ctx, float* buffer_15, size_t batch);
 
 
 public:
     // Run inference on input data
+    // ctx: activation scratch, must not be shared with a concurrent call
     // input: array of size kInputSize
     // output: array of size kOutputSize (will be filled with results)
-    static void Inference(const float* input, float* output);
+    static void Inference(Context& ctx, const float* input, float* output);
+
+    // Run inference on a one-hot input plus trailing scalar, without building the dense input
+    // Equivalent to Inference() on input = [one_hot(index) (kInputSize - 1 entries), scalar]
+    // index: hot entry, must be < kInputSize - 1
+    // output: array of size kOutputSize (will be filled with results)
+    static void InferenceOneHot(Context& ctx, size_t index, float scalar, float* output);
+
+    // Inference() / InferenceOneHot() stopping before the final softmax
+    // logits: array of size kOutputSize (pre-softmax layer 4 output, buffer_15)
+    static void InferenceLogits(Context& ctx, const float* input, float* logits);
+    static void InferenceOneHotLogits(Context& ctx, size_t index, float scalar, float* logits);
+
+    // InferenceOneHotLogits() with layers 1-4 on the portable kernels, the
+    // reference for checking the EMBEDDED_ML_FC_BACKEND kernels on the device
+    static void InferenceOneHotLogitsPortable(Context& ctx, size_t index, float scalar, float* logits);
+
+    // Run inference on a batch of inputs, one pass over the weights per kMaxBatch items
+    // Each output matches Inference() on the same input bit for bit, on every
+    // EMBEDDED_ML_FC_BACKEND (`make bench` fails otherwise)
+    // inputs: batch arrays of size kInputSize, stored back to back
+    // outputs: batch arrays of size kOutputSize, stored back to back
+    static void InferenceBatch(BatchContext& ctx, const float* inputs, float* outputs, size_t batch);
+
+    // Batched InferenceOneHot(): item b uses indices[b] and scalars[b]
+    static void InferenceBatchOneHot(BatchContext& ctx, const size_t* indices, const float* scalars, float* outputs, size_t batch);
+
+    // InferenceBatchOneHot() stopping before the final softmax
+    // logits: batch arrays of size kOutputSize, stored back to back
+    static void InferenceBatchOneHotLogits(BatchContext& ctx, const size_t* indices, const float* scalars, float* logits, size_t batch);
+
+#if EMBEDDED_ML_WEIGHT_BLOB
+    // Bind the network weights to a blob written by `adjective_model_larger256_4_export blob`
+    // blob: mapped blob of size bytes, read in place, must stay mapped while the model is used
+    // Returns false (keeping the previous binding) if the blob is invalid or any tensor
+    // is missing or has an unexpected dtype, layout or shape; call before any inference
+    static bool LoadWeights(const void* blob, size_t size);
+#endif
+
+    // Static wrappers over a shared default context (not reentrant)
+    static void Inference(const float* input, float* output) {
+        Inference(default_context, input, output);
+    }
+
+    static void InferenceOneHot(size_t index, float scalar, float* output) {
+        InferenceOneHot(default_context, index, scalar, output);
+    }
+
+    static void InferenceLogits(const float* input, float* logits) {
+        InferenceLogits(default_context, input, logits);
+    }
+
+    static void InferenceOneHotLogits(size_t index, float scalar, float* logits) {
+        InferenceOneHotLogits(default_context, index, scalar, logits);
+    }
+
+    static void InferenceOneHotLogitsPortable(size_t index, float scalar, float* logits) {
+        InferenceOneHotLogitsPortable(default_context, index, scalar, logits);
+    }
+
+    static void InferenceBatch(const float* inputs, float* outputs, size_t batch) {
+        InferenceBatch(default_batch_context, inputs, outputs, batch);
+    }
+
+    static void InferenceBatchOneHot(const size_t* indices, const float* scalars, float* outputs, size_t batch) {
+        InferenceBatchOneHot(default_batch_context, indices, scalars, outputs, batch);
+    }
+
+    static void InferenceBatchOneHotLogits(const size_t* indices, const float* scalars, float* logits, size_t batch) {
+        InferenceBatchOneHotLogits(default_batch_context, indices, scalars, logits, batch);
+    }
 };
 
 } // namespace embedded_ml
@@ -0,0 +1,100 @@
+// adjective_model_larger256_4_int8.cpp
+// Auto-generated int8 inference model implementation
+// Pure C++ implementation for embedded systems
+
+#include "adjective_model_larger256_4_int8.h"
+#include "adjective_model_larger256_4_int8_weights.cpp"
+#include "fully_connected.h"
+#include "profiler.h"
+#include "softmax.h"
+#include <cstddef>
+
+namespace embedded_ml {
+
+void adjective_model_larger256_4Int8Model::Inference(Context& ctx, const float* input, float* output) {
+
+    InferenceLogits(ctx, input, ctx.arena[0]);
+
+    // Layer 5: SOFTMAX
+
+    EMBEDDED_ML_PROFILED("int8_softmax_dense", Softmax<float, kOutputSize>(ctx.arena[0], output));
+
+}
+
+void adjective_model_larger256_4Int8Model::InferenceOneHot(Context& ctx, size_t index, float scalar, float* output) {
+
+    InferenceOneHotLogits(ctx, index, scalar, ctx.arena[0]);
+
+    // Layer 5: SOFTMAX
+
+    EMBEDDED_ML_PROFILED("int8_softmax", Softmax<float, kOutputSize>(ctx.arena[0], output));
+
+}
+
+void adjective_model_larger256_4Int8Model::InferenceLogits(Context& ctx, const float* input, float* logits) {
+
+    // Layer 0: FULLY_CONNECTED (float, column-major weights, writes buffer_11 to arena slot 0)
+
+    EMBEDDED_ML_PROFILED("int8_fc0_dense", FullyConnectedColumnMajor<float, kInputSize, 256, ActivationType::RELU>(input, weight_8_sequential_1_dense_1_MatMul, weight_9_sequential_1_dense_1_Relu_sequential_1_dense_1_BiasAdd, ctx.arena[0]));
+
+    InferenceHidden(ctx, logits);
+
+}
+
+void adjective_model_larger256_4Int8Model::InferenceOneHotLogits(Context& ctx, size_t index, float scalar, float* logits) {
+
+    // Layer 0: FULLY_CONNECTED (float, one-hot + scalar input, writes buffer_11 to arena slot 0)
+
+    EMBEDDED_ML_PROFILED("int8_fc0", FullyConnectedOneHotPlusScalar<float, kInputSize, 256, ActivationType::RELU>(index, scalar, weight_8_sequential_1_dense_1_MatMul, weight_9_sequential_1_dense_1_Relu_sequential_1_dense_1_BiasAdd, ctx.arena[0]));
+
+    InferenceHidden(ctx, logits);
+
+}
+
+void adjective_model_larger256_4Int8Model::InferenceHidden(Context& ctx, float* buffer_15) {
+
+    // Intermediate buffers (ping-pong between the two arena slots)
+
+    const float* buffer_11 = ctx.arena[0];
+
+    float* buffer_12 = ctx.arena[1];
+
+    float* buffer_13 = ctx.arena[0];
+
+    float* buffer_14 = ctx.arena[1];
+
+    float input_scale;
+
+    // Layer 1: FULLY_CONNECTED (int8)
+
+    EMBEDDED_ML_PROFILED("int8_fc1",
+        input_scale = QuantizeInt8(buffer_11, ctx.quantized, 256);
+        FullyConnectedInt8<float, 256, 256, ActivationType::RELU>(ctx.quantized, input_scale, weight_7_arith_constant7, weight_7_arith_constant7_scale, weight_2_arith_constant2, buffer_12));
+
+    // Layer 2: FULLY_CONNECTED (int8)
+
+    EMBEDDED_ML_PROFILED("int8_fc2",
+        input_scale = QuantizeInt8(buffer_12, ctx.quantized, 256);
+        FullyConnectedInt8<float, 256, 256, ActivationType::RELU>(ctx.quantized, input_scale, weight_6_arith_constant6, weight_6_arith_constant6_scale, weight_1_arith_constant1, buffer_13));
+
+    // Layer 3: FULLY_CONNECTED (int8)
+
+    EMBEDDED_ML_PROFILED("int8_fc3",
+        input_scale = QuantizeInt8(buffer_13, ctx.quantized, 256);
+        FullyConnectedInt8<float, 256, 256, ActivationType::RELU>(ctx.quantized, input_scale, weight_5_arith_constant5, weight_5_arith_constant5_scale, weight_0_arith_constant, buffer_14));
+
+    // Layer 4: FULLY_CONNECTED (int8)
+
+    EMBEDDED_ML_PROFILED("int8_fc4",
+        input_scale = QuantizeInt8(buffer_14, ctx.quantized, 256);
+        FullyConnectedInt8<float, 256, kOutputSize, ActivationType::NONE>(ctx.quantized, input_scale, weight_4_arith_constant4, weight_4_arith_constant4_scale, weight_3_arith_constant3, buffer_15));
+
+}
+
+
+// Default context for the static wrappers
+
+adjective_model_larger256_4Int8Model::Context adjective_model_larger256_4Int8Model::default_context;
+
+
+} // namespace embedded_ml
@@ -0,0 +1,342 @@
+// adjective_model_larger256_4_lexicon.cpp
+// Auto-generated word list as a minimized trie
+// 1000 words, 1266 nodes, 2218 edges of 19 bits, plus 4 bytes of read padding
+
+#include "adjective_model_larger256_4_lexicon.h"
+
+namespace embedded_ml {
+
+const uint8_t adjective_model_larger256_4Lexicon::packed[5272] = {
+  0x81, 0x0d, 0x10, 0xbc, 0xc0, 0xe0, 0x06, 0x08, 0x40, 0x50, 0x40, 0x02, 0xc3, 0x14, 0x1c, 0xb4,
+  0x00, 0x21, 0x06, 0x89, 0x32, 0x50, 0xa0, 0xc1, 0x62, 0x0d, 0x18, 0x6c, 0xd0, 0x88, 0x03, 0x87,
+  0x1d, 0x3c, 0xf2, 0x00, 0xe2, 0x07, 0x11, 0x43, 0x90, 0x1c, 0xc2, 0xa4, 0x11, 0x28, 0x98, 0x50,
+  0xf1, 0x04, 0x4b, 0x28, 0x5c, 0x4a, 0x01, 0x07, 0x00, 0x99, 0x55, 0xd0, 0xc2, 0x82, 0x80, 0x16,
+  0x06, 0xbc, 0x40, 0x10, 0x86, 0x42, 0x32, 0x18, 0x96, 0xe1, 0xe0, 0x0c, 0x09, 0x6a, 0x58, 0x54,
+  0x03, 0xc3, 0x1a, 0x1a, 0xda, 0xe0, 0x00, 0x07, 0x88, 0x39, 0x44, 0xd0, 0x41, 0x92, 0x0e, 0x93,
+  0x78, 0xa0, 0xdc, 0x43, 0x85, 0x1f, 0x2c, 0x01, 0x71, 0x19, 0x08, 0xad, 0x41, 0x04, 0x0e, 0xa2,
+  0xe0, 0x10, 0x89, 0x8b, 0x60, 0x70, 0xc4, 0x23, 0x24, 0x24, 0x29, 0x51, 0x71, 0x89, 0x6c, 0x4d,
+  0x04, 0x6e, 0xa2, 0xf0, 0x13, 0x88, 0xa1, 0x48, 0x28, 0x05, 0xa3, 0x29, 0x1e, 0x52, 0x21, 0xc9,
+  0x8a, 0x8a, 0x56, 0x64, 0xbd, 0x22, 0x00, 0x16, 0x85, 0xb3, 0x48, 0xd0, 0xc5, 0xc3, 0x2e, 0x24,
+  0x78, 0x51, 0xc9, 0x8b, 0x8b, 0x5e, 0x64, 0xf7, 0x42, 0xc0, 0x17, 0x83, 0xbe, 0x30, 0xf8, 0x05,
+  0xe3, 0x2f, 0x1a, 0x80, 0xe1, 0x18, 0x0c, 0x49, 0x61, 0x50, 0x0c, 0xa3, 0x72, 0x18, 0x16, 0xc4,
+  0xc0, 0x26, 0x46, 0x80, 0x31, 0x0a, 0x8d, 0x91, 0x90, 0x0c, 0x86, 0x66, 0x3c, 0x3e, 0x43, 0x62,
+  0x1a, 0xd5, 0xd4, 0x28, 0xa8, 0x06, 0x62, 0x35, 0x12, 0xac, 0xc1, 0x68, 0x0d, 0x07, 0x6c, 0x3c,
+  0x62, 0x43, 0x82, 0x1b, 0xd5, 0xde, 0x08, 0xfc, 0xc6, 0x63, 0x38, 0xb2, 0xc6, 0x41, 0x38, 0x8e,
+  0x06, 0x72, 0x38, 0x93, 0x23, 0x20, 0x1d, 0x8f, 0xe9, 0xa8, 0x52, 0x47, 0xb2, 0x3a, 0x02, 0xd6,
+  0x91, 0xc0, 0x8e, 0x87, 0x77, 0x54, 0xce, 0x23, 0xeb, 0x1e, 0x81, 0xf7, 0x28, 0xc8, 0xc7, 0x83,
+  0x3e, 0x2a, 0xf9, 0x91, 0xd5, 0x8f, 0x40, 0x7f, 0x3c, 0xfc, 0xa3, 0x0a, 0x20, 0x02, 0x01, 0x69,
+  0x0c, 0x88, 0x83, 0x40, 0x20, 0x05, 0x22, 0x3d, 0x90, 0x00, 0x82, 0x14, 0x16, 0x84, 0xf1, 0x20,
+  0x8f, 0x08, 0x91, 0x50, 0xc8, 0xe4, 0x42, 0x2a, 0x18, 0x92, 0xdd, 0x90, 0x2a, 0x87, 0x04, 0x3c,
+  0xa4, 0x90, 0x22, 0x88, 0x19, 0x49, 0xd0, 0xc8, 0x83, 0x47, 0xaa, 0x44, 0x12, 0x58, 0x92, 0x81,
+  0x95, 0x14, 0xb4, 0x04, 0xb1, 0x25, 0x89, 0x2e, 0x69, 0x78, 0xc9, 0xe3, 0x4b, 0x20, 0x62, 0x12,
+  0x29, 0x13, 0x8a, 0x99, 0x54, 0xd3, 0x24, 0xc0, 0x26, 0x85, 0x36, 0x41, 0xbc, 0xc9, 0x03, 0x4e,
+  0x24, 0x71, 0x52, 0x95, 0x13, 0xc6, 0x9c, 0x38, 0xe8, 0x84, 0x5a, 0x27, 0x01, 0x3b, 0x29, 0xdc,
+  0x49, 0x22, 0x4f, 0x9e, 0x7b, 0x12, 0xe8, 0x93, 0x82, 0x9f, 0x20, 0x06, 0x25, 0x51, 0x28, 0x8f,
+  0x46, 0x91, 0x52, 0x4a, 0x20, 0x53, 0x0a, 0x9a, 0x92, 0xd8, 0x94, 0x07, 0xa7, 0x54, 0x3f, 0x25,
+  0x00, 0x2a, 0x05, 0x52, 0x49, 0x9c, 0xca, 0x53, 0x55, 0x10, 0xad, 0x92, 0x70, 0x15, 0xc6, 0xab,
+  0x3c, 0x60, 0x45, 0x12, 0x2b, 0x13, 0x59, 0xa9, 0xd4, 0x4a, 0xd6, 0x56, 0x06, 0xb7, 0x52, 0xd0,
+  0x95, 0xc8, 0xae, 0x48, 0x78, 0x85, 0xd2, 0x2b, 0x55, 0x5f, 0x09, 0xfc, 0x4a, 0x41, 0x58, 0x1a,
+  0xc3, 0xf2, 0x20, 0x16, 0x49, 0xb1, 0x54, 0x8c, 0xc5, 0x7a, 0x2c, 0x12, 0x64, 0x99, 0x26, 0x8b,
+  0x41, 0x59, 0x12, 0xcd, 0xc2, 0x74, 0x96, 0x00, 0xb4, 0x14, 0xa2, 0x25, 0x21, 0x2d, 0x8c, 0x69,
+  0x79, 0x50, 0x8b, 0xb4, 0x5a, 0xa4, 0xd6, 0x92, 0xc4, 0x96, 0x40, 0xb6, 0x24, 0xb4, 0x85, 0xc1,
+  0x2d, 0xd0, 0x6e, 0x09, 0x78, 0x8b, 0xe0, 0x5b, 0x12, 0xe1, 0xe2, 0x10, 0x97, 0xc7, 0xb8, 0x40,
+  0xcb, 0x25, 0x70, 0x2e, 0x83, 0x74, 0x39, 0xac, 0x4b, 0xa2, 0x5d, 0x1e, 0xee, 0x42, 0x85, 0x97,
+  0xc7, 0xbc, 0x40, 0xe9, 0xa5, 0x5a, 0x2f, 0x82, 0x7b, 0x19, 0xe0, 0x0b, 0x61, 0x5f, 0x0e, 0xfd,
+  0xd2, 0xf0, 0x97, 0xc7, 0xbf, 0x48, 0x02, 0x86, 0x2a, 0x30, 0x03, 0x82, 0x41, 0x14, 0x0c, 0xc4,
+  0x60, 0x26, 0x07, 0x43, 0x49, 0x98, 0xea, 0xc2, 0x04, 0x18, 0x06, 0xd1, 0x30, 0x0f, 0x87, 0x91,
+  0x40, 0x0c, 0x35, 0x62, 0x08, 0x12, 0x73, 0x98, 0x18, 0x09, 0xc5, 0x4c, 0x2c, 0x86, 0x7a, 0x31,
+  0x89, 0x8d, 0xa9, 0x76, 0x4c, 0xc0, 0x63, 0x0a, 0x20, 0x63, 0x14, 0x99, 0x6a, 0xb3, 0x90, 0x00,
+  0x60, 0x31, 0x32, 0x0c, 0x92, 0x71, 0xa8, 0x8c, 0x84, 0x65, 0x26, 0x31, 0x43, 0x9d, 0x99, 0x00,
+  0xcd, 0x0c, 0x6e, 0xe6, 0x80, 0x33, 0x8c, 0x9c, 0x71, 0xe8, 0x8c, 0x84, 0x67, 0x26, 0x3d, 0x43,
+  0xf1, 0x99, 0x2b, 0xd0, 0x9c, 0x00, 0x80, 0x11, 0x34, 0x0e, 0xa1, 0x81, 0x0c, 0x8d, 0x96, 0x68,
+  0x02, 0x45, 0x53, 0x40, 0x9a, 0x84, 0xd2, 0x3c, 0x6e, 0xa6, 0xda, 0x34, 0x04, 0xa7, 0x41, 0x3c,
+  0x0d, 0x03, 0x6a, 0x1a, 0x51, 0xf3, 0x90, 0x1a, 0x09, 0xb6, 0x50, 0xa6, 0xa6, 0x4a, 0x35, 0x81,
+  0xaa, 0x29, 0x68, 0x4d, 0x62, 0x6b, 0x1e, 0x60, 0x53, 0x1d, 0x1b, 0x41, 0xd9, 0x0c, 0xcc, 0x86,
+  0xe0, 0x2a, 0x8f, 0xb3, 0x91, 0xa0, 0xcd, 0x44, 0x6d, 0xa8, 0x6b, 0x73, 0x60, 0x1b, 0x6d, 0xdb,
+  0x30, 0xdc, 0xa6, 0xf1, 0x36, 0x0e, 0xb8, 0x81, 0xcc, 0x8d, 0x84, 0x6e, 0x28, 0x7a, 0x53, 0xe1,
+  0x1b, 0x6b, 0xdf, 0x04, 0xfe, 0x86, 0x01, 0x38, 0x8e, 0x99, 0x91, 0x06, 0x4e, 0xc0, 0x70, 0x0a,
+  0x8c, 0x93, 0x70, 0x9c, 0x47, 0xe5, 0x48, 0x2c, 0x87, 0x72, 0x39, 0x55, 0xcc, 0x71, 0x64, 0x8e,
+  0x64, 0x73, 0xac, 0x9c, 0x13, 0xe8, 0x9c, 0x02, 0xe8, 0x24, 0x44, 0xe7, 0x41, 0x3a, 0x55, 0xd4,
+  0x09, 0xa8, 0x8e, 0xa0, 0x75, 0x10, 0xae, 0xc3, 0x78, 0x9d, 0x46, 0xec, 0x38, 0x6a, 0x47, 0x6a,
+  0x3b, 0xd5, 0xdb, 0x61, 0xe0, 0x8e, 0x24, 0x77, 0x26, 0xbd, 0x43, 0xfd, 0x9d, 0x01, 0xf0, 0x38,
+  0x83, 0xc7, 0xd0, 0x33, 0x09, 0xe1, 0x81, 0x0c, 0x8f, 0x84, 0x78, 0x26, 0xc6, 0x53, 0x41, 0x1e,
+  0x6d, 0xf2, 0x04, 0x96, 0x67, 0xf0, 0x3c, 0x05, 0xe9, 0x31, 0x4c, 0xcf, 0x21, 0x7b, 0x14, 0xda,
+  0xc3, 0xd8, 0x9e, 0x86, 0xf7, 0x38, 0xc2, 0x07, 0x22, 0x3e, 0x12, 0xf2, 0x99, 0x9c, 0x0f, 0x75,
+  0x7d, 0x24, 0xbf, 0x33, 0x65, 0x9f, 0x46, 0xfb, 0x3c, 0xdd, 0xa7, 0xf8, 0x3e, 0x4c, 0xf8, 0x49,
+  0xc6, 0x8f, 0x53, 0x7e, 0xaa, 0xf3, 0x33, 0xa5, 0x1f, 0x63, 0xfd, 0x04, 0xed, 0x27, 0x71, 0x3f,
+  0x0f, 0xfc, 0x81, 0xe6, 0xcf, 0x40, 0x7f, 0x88, 0xfb, 0xf3, 0xe4, 0x1f, 0x64, 0xff, 0x40, 0xfd,
+  0xe7, 0xf9, 0x3f, 0x01, 0x00, 0x8a, 0x04, 0x50, 0x55, 0x80, 0x9a, 0x03, 0x14, 0x20, 0xa0, 0x41,
+  0x01, 0x49, 0x0c, 0x68, 0x72, 0x40, 0x56, 0x04, 0x3a, 0x24, 0x10, 0x63, 0x81, 0x1c, 0x0c, 0x24,
+  0x79, 0x20, 0x5a, 0x04, 0x59, 0x7e, 0x07, 0x33, 0x32, 0x5a, 0x09, 0x0a, 0x4c, 0x50, 0x61, 0x83,
+  0x12, 0x1d, 0xf4, 0xf8, 0xa0, 0xea, 0x08, 0x0d, 0x4e, 0x88, 0x81, 0x42, 0x0e, 0xa8, 0x79, 0xa4,
+  0x90, 0x44, 0x85, 0x2a, 0x32, 0x84, 0x9d, 0xa1, 0x00, 0x0d, 0x15, 0x74, 0x28, 0xe9, 0x43, 0xce,
+  0xfe, 0x71, 0x0e, 0x51, 0xb0, 0x88, 0x98, 0xfc, 0x53, 0x30, 0xa2, 0xc4, 0x11, 0x3d, 0x91, 0x28,
+  0xa8, 0x44, 0x8c, 0x25, 0x72, 0xfc, 0xce, 0x03, 0x6a, 0x24, 0x4c, 0x34, 0x71, 0x22, 0xca, 0x13,
+  0x55, 0xa1, 0x28, 0x10, 0x45, 0x05, 0x2b, 0x4a, 0x64, 0xd1, 0x83, 0x8b, 0xaa, 0x5e, 0x94, 0x00,
+  0x23, 0x6a, 0x18, 0x1d, 0xc4, 0x88, 0x31, 0x46, 0x92, 0x32, 0xaa, 0x9a, 0x11, 0xe3, 0x8c, 0x1c,
+  0x68, 0x04, 0x4d, 0x23, 0xa1, 0x1a, 0x65, 0xd7, 0x08, 0xca, 0x46, 0x01, 0x37, 0x1a, 0xbc, 0x11,
+  0x01, 0x8e, 0x0c, 0x71, 0x74, 0x98, 0x23, 0x07, 0x1d, 0x4d, 0xea, 0x88, 0x62, 0x47, 0xd6, 0x3c,
+  0xaa, 0xee, 0x51, 0x96, 0x8f, 0x84, 0x7d, 0xe4, 0xf4, 0xa3, 0xc1, 0x1f, 0x39, 0x01, 0xc9, 0x10,
+  0x48, 0x07, 0x41, 0x6a, 0x0c, 0xd2, 0xa4, 0x90, 0x28, 0x87, 0x64, 0x45, 0x24, 0x83, 0x22, 0x1d,
+  0x82, 0xc7, 0xb1, 0x48, 0x90, 0x46, 0x92, 0x38, 0xd2, 0xa4, 0x67, 0x2a, 0x50, 0x63, 0x79, 0xa4,
+  0x7b, 0x24, 0x0d, 0x26, 0xa9, 0x51, 0x49, 0x8e, 0x4b, 0x82, 0x74, 0x8b, 0x04, 0x93, 0x26, 0x99,
+  0x84, 0xe5, 0x24, 0x69, 0x27, 0x0d, 0x3c, 0x49, 0xd1, 0x3e, 0xcc, 0x4f, 0x72, 0x80, 0x92, 0x34,
+  0x94, 0x1c, 0xa2, 0xf4, 0x20, 0x25, 0x49, 0x29, 0x55, 0x54, 0xc9, 0xba, 0x4a, 0x54, 0x57, 0x92,
+  0xc0, 0xd2, 0x24, 0x96, 0xa8, 0xb2, 0x54, 0x9d, 0xa5, 0x06, 0x2d, 0x61, 0x6b, 0x69, 0x60, 0x4b,
+  0xd2, 0x5b, 0x9a, 0xe2, 0x52, 0x32, 0x97, 0x98, 0x33, 0x44, 0x09, 0x9e, 0xaa, 0x2e, 0x1d, 0x77,
+  0x89, 0xc1, 0x4b, 0x92, 0x5e, 0x9a, 0xfe, 0x52, 0x00, 0x98, 0x18, 0xc1, 0x24, 0x11, 0xa6, 0xe9,
+  0x30, 0x15, 0x88, 0xa9, 0x5a, 0x4c, 0x05, 0x63, 0x4a, 0x1c, 0xd3, 0x15, 0x99, 0x12, 0xc9, 0xf4,
+  0x50, 0xa6, 0x6a, 0x34, 0x65, 0xa5, 0x49, 0x30, 0x4d, 0x12, 0x6a, 0xa2, 0xaa, 0x91, 0xd4, 0x9a,
+  0x02, 0xd7, 0x94, 0xcc, 0x26, 0x01, 0x26, 0x11, 0xb6, 0xe9, 0xc0, 0x4d, 0x8d, 0x6e, 0x72, 0x78,
+  0x13, 0xe4, 0x9b, 0x24, 0xe2, 0x34, 0x21, 0x27, 0x4a, 0x39, 0x59, 0xcc, 0xe9, 0x0e, 0x00, 0x81,
+  0x73, 0x12, 0xac, 0xd3, 0x80, 0x9d, 0x08, 0xef, 0x64, 0xa8, 0x9f, 0x03, 0x3c, 0x39, 0xe2, 0x69,
+  0x32, 0x4f, 0x16, 0x7b, 0xba, 0xe2, 0x53, 0x30, 0x9f, 0x02, 0xfa, 0x24, 0xd8, 0x27, 0xc3, 0xef,
+  0x1c, 0xf8, 0xe9, 0xe1, 0x4f, 0x90, 0x7f, 0x9a, 0x70, 0x13, 0x15, 0xa0, 0x02, 0x01, 0x25, 0x98,
+  0x98, 0x86, 0x40, 0x3d, 0x06, 0x6a, 0x32, 0x43, 0x94, 0x02, 0xaa, 0x10, 0x54, 0x16, 0x9e, 0x0e,
+  0x50, 0x94, 0x30, 0x28, 0x06, 0x37, 0x35, 0x0e, 0x4a, 0x02, 0x4f, 0x93, 0x84, 0xa2, 0x2a, 0x94,
+  0x40, 0x5a, 0x06, 0x0b, 0x45, 0x02, 0x80, 0x03, 0x43, 0x25, 0x1c, 0x8a, 0xf1, 0x50, 0x8e, 0x89,
+  0x92, 0x50, 0x14, 0xa5, 0xa2, 0x2a, 0x18, 0x65, 0xcd, 0xa8, 0x40, 0x47, 0x15, 0x3e, 0x0a, 0x11,
+  0x52, 0x4f, 0x91, 0x92, 0x8e, 0x54, 0x80, 0xa4, 0x92, 0x25, 0xe5, 0x34, 0xa9, 0xe7, 0x49, 0x05,
+  0x02, 0x8a, 0x01, 0x35, 0x52, 0x94, 0x2a, 0xa4, 0x54, 0x42, 0xa5, 0x98, 0x2b, 0x55, 0x65, 0xa9,
+  0x40, 0x4b, 0x15, 0x5c, 0x4a, 0xfa, 0x52, 0x02, 0x98, 0x62, 0xc4, 0x94, 0x53, 0xa6, 0x92, 0x66,
+  0xd4, 0x98, 0x29, 0x27, 0x4d, 0x49, 0x6b, 0x4a, 0x6a, 0x53, 0x41, 0x9c, 0x92, 0xe6, 0xd4, 0x50,
+  0xa7, 0x90, 0x3b, 0xf5, 0xe4, 0x29, 0x66, 0x4f, 0x39, 0x7c, 0x4a, 0x0a, 0x54, 0x82, 0xa0, 0x1a,
+  0xd6, 0x12, 0x43, 0xa8, 0xa4, 0x12, 0x23, 0x75, 0x9b, 0xc0, 0x50, 0x15, 0x88, 0x2a, 0x51, 0x54,
+  0x8c, 0xa3, 0x9a, 0x26, 0x55, 0x62, 0xa9, 0x9e, 0x4e, 0x35, 0x80, 0x2a, 0x82, 0x54, 0x31, 0xa6,
+  0xca, 0x71, 0x55, 0x92, 0x91, 0x99, 0x74, 0x15, 0x25, 0xac, 0xb4, 0x64, 0x55, 0x30, 0x2b, 0x06,
+  0x5a, 0x35, 0xd2, 0xca, 0xa1, 0x56, 0x8f, 0xb5, 0x92, 0xb0, 0x95, 0xb5, 0x60, 0x02, 0x6f, 0x55,
+  0x80, 0xab, 0x44, 0x5c, 0x3d, 0xe4, 0x2a, 0x0f, 0x00, 0xd7, 0x92, 0x0a, 0xce, 0x55, 0xb1, 0xae,
+  0x0e, 0x76, 0xe5, 0xba, 0xab, 0x2a, 0x5e, 0x1d, 0xf5, 0xca, 0xb0, 0x57, 0x09, 0xbe, 0x72, 0xcc,
+  0x10, 0xb4, 0xaf, 0x02, 0x7e, 0xe5, 0xf8, 0xab, 0x29, 0x60, 0x1d, 0x02, 0xeb, 0x21, 0x58, 0xd0,
+  0xc1, 0x22, 0x10, 0x96, 0x61, 0xaf, 0x98, 0x85, 0xf5, 0x34, 0x2c, 0x22, 0x37, 0x05, 0x0f, 0xab,
+  0x8a, 0x58, 0x55, 0x61, 0x79, 0x24, 0x16, 0x65, 0xb1, 0xaa, 0x8c, 0xe5, 0x04, 0xaa, 0x69, 0x63,
+  0x15, 0x1e, 0xeb, 0x01, 0x59, 0xd5, 0xc8, 0x92, 0x4a, 0x56, 0x75, 0xb2, 0x9e, 0x94, 0x95, 0xac,
+  0x2c, 0xea, 0xef, 0x1c, 0x2c, 0xab, 0x71, 0x59, 0x50, 0xcc, 0x82, 0xf6, 0x4c, 0x32, 0xb3, 0xa4,
+  0x9a, 0xf5, 0xe4, 0xac, 0x69, 0xcf, 0x04, 0x3b, 0x2b, 0x09, 0x4f, 0x54, 0xcf, 0x0a, 0x7c, 0x56,
+  0x01, 0xb4, 0x98, 0xa1, 0x25, 0xfd, 0x9d, 0x80, 0x68, 0x3d, 0x47, 0x0b, 0xfa, 0x3b, 0x4c, 0xd2,
+  0x62, 0xfe, 0xce, 0xd3, 0xb4, 0x9c, 0xa7, 0x15, 0x44, 0x2d, 0x41, 0x6a, 0xe5, 0x01, 0xc0, 0x0d,
+  0x00, 0x42, 0xd5, 0x2a, 0x60, 0x8b, 0xf5, 0x77, 0xaa, 0xab, 0x95, 0x64, 0x2d, 0x6a, 0x6b, 0x25,
+  0x5c, 0x4b, 0x0a, 0x5b, 0xc1, 0xcf, 0x2a, 0xc6, 0xd6, 0x0a, 0x00, 0xa4, 0xb2, 0x85, 0xa0, 0x2d,
+  0xe6, 0xef, 0x30, 0x6a, 0x4b, 0x2a, 0x4d, 0x05, 0xdb, 0x4a, 0xf6, 0x4b, 0x61, 0x9a, 0xaa, 0xb7,
+  0xd5, 0xc4, 0x2d, 0x82, 0x6e, 0x35, 0x77, 0x2b, 0xc0, 0x5b, 0x88, 0xde, 0x4a, 0xfa, 0xd6, 0x14,
+  0xb8, 0x8a, 0xc1, 0x15, 0x30, 0xa6, 0xa4, 0x70, 0x3d, 0x87, 0x2b, 0x40, 0x5c, 0x08, 0xe3, 0xa2,
+  0x22, 0x57, 0x41, 0x9f, 0xaa, 0xc9, 0x55, 0xd4, 0xa7, 0xa7, 0x72, 0x35, 0x96, 0xab, 0xca, 0x5c,
+  0xc5, 0xe6, 0x32, 0x88, 0x4c, 0xd2, 0xb9, 0x8a, 0xcf, 0x55, 0xc4, 0x96, 0x64, 0x74, 0x15, 0xa4,
+  0xab, 0xba, 0x50, 0x8f, 0xe9, 0x92, 0xc2, 0x93, 0xf3, 0xae, 0xac, 0xa7, 0x95, 0xa4, 0xae, 0x86,
+  0x5d, 0x39, 0xe1, 0xe9, 0x59, 0x5d, 0x45, 0xeb, 0x0a, 0x56, 0x57, 0xd5, 0x58, 0x0a, 0xd7, 0xf5,
+  0xc4, 0x2e, 0x6a, 0x76, 0x05, 0xb4, 0x0b, 0xb1, 0x5d, 0x0f, 0xee, 0xaa, 0x76, 0x57, 0x00, 0x5b,
+  0xc8, 0x00, 0xe0, 0xf4, 0xae, 0xc5, 0x77, 0x49, 0x7f, 0x87, 0x04, 0x00, 0x53, 0xf0, 0xaa, 0x86,
+  0x57, 0x11, 0x6a, 0x02, 0xe2, 0x45, 0x02, 0x80, 0x02, 0x1f, 0x31, 0x4e, 0xab, 0x31, 0x43, 0xd3,
+  0xf1, 0x0a, 0x84, 0xd7, 0x92, 0xbc, 0x04, 0xe5, 0x45, 0x40, 0xae, 0x12, 0x00, 0x3c, 0xcc, 0x4b,
+  0x5a, 0x30, 0x09, 0xf4, 0x9a, 0x03, 0x00, 0x35, 0xbd, 0x1a, 0xea, 0x45, 0x59, 0xaf, 0x6a, 0x7b,
+  0x3d, 0xa5, 0xa6, 0xea, 0x5e, 0xcf, 0xf7, 0x4a, 0xc0, 0x17, 0x1d, 0x00, 0xa6, 0xf1, 0x45, 0x07,
+  0x00, 0x89, 0x7c, 0x51, 0xe7, 0x2b, 0x09, 0x57, 0x4c, 0xfa, 0x0a, 0xd6, 0xd7, 0xd3, 0xbe, 0x82,
+  0xf7, 0x35, 0xc0, 0xaf, 0x46, 0x7e, 0x69, 0xb9, 0x29, 0x80, 0x5f, 0x53, 0xe6, 0x72, 0xb8, 0xca,
+  0x44, 0xbf, 0xa8, 0xfc, 0x35, 0xed, 0xaf, 0xa4, 0x7f, 0x15, 0xff, 0x8b, 0x0c, 0x00, 0x42, 0x00,
+  0x6b, 0x72, 0x53, 0x30, 0xc0, 0x9c, 0x02, 0x96, 0xe0, 0x9f, 0x06, 0x81, 0x39, 0x0a, 0xcc, 0xf2,
+  0x3b, 0xda, 0x82, 0x29, 0x1a, 0xd8, 0xe1, 0xc0, 0x18, 0x76, 0xe2, 0x98, 0xa1, 0x09, 0x7e, 0x51,
+  0x11, 0x2c, 0x00, 0x35, 0x8b, 0x82, 0x79, 0xba, 0x4a, 0x82, 0xb9, 0xa8, 0xf0, 0x24, 0x4c, 0xb0,
+  0xe7, 0x34, 0x65, 0x2f, 0x2b, 0x31, 0x32, 0x4e, 0x05, 0xa3, 0x26, 0x18, 0x75, 0xc1, 0x9e, 0xac,
+  0x15, 0x64, 0xb0, 0x36, 0x00, 0x08, 0x51, 0x8b, 0x30, 0x49, 0x8f, 0x06, 0xa3, 0x3e, 0x58, 0x10,
+  0xc2, 0x08, 0xb4, 0x54, 0x90, 0xb0, 0xc4, 0x84, 0x35, 0xba, 0x85, 0x42, 0x61, 0xd6, 0x82, 0x09,
+  0x54, 0x18, 0xf2, 0xc2, 0xa6, 0x19, 0x16, 0xd8, 0xb0, 0x22, 0x87, 0x4d, 0xf3, 0xab, 0xd8, 0x61,
+  0x01, 0x0f, 0x2b, 0x7c, 0x58, 0x22, 0x7c, 0x28, 0x20, 0x56, 0x0d, 0xb1, 0x86, 0x88, 0x39, 0x46,
+  0xec, 0x61, 0x4c, 0x12, 0x13, 0x9b, 0xf8, 0x0a, 0x95, 0xc5, 0x0a, 0x2d, 0x26, 0x75, 0xb1, 0x11,
+  0x00, 0x14, 0x60, 0x8c, 0x11, 0x63, 0x8d, 0x19, 0x93, 0x0c, 0xd6, 0x84, 0xc6, 0xac, 0x35, 0x96,
+  0xb4, 0xb1, 0x27, 0x77, 0x21, 0x6f, 0x4c, 0x5a, 0x52, 0x05, 0xee, 0x72, 0xe2, 0xd8, 0x30, 0xc7,
+  0x92, 0x3b, 0xd6, 0xe8, 0x31, 0x89, 0x8f, 0x4d, 0x7f, 0x2c, 0x10, 0x64, 0xcd, 0x7e, 0x69, 0x0c,
+  0x99, 0x93, 0xc8, 0x02, 0x46, 0x96, 0xb0, 0xad, 0xca, 0x91, 0x5d, 0x91, 0xcc, 0x91, 0x64, 0xd3,
+  0x99, 0x61, 0x28, 0xd9, 0x64, 0xc9, 0xb0, 0xdc, 0x74, 0x65, 0xb2, 0x62, 0x93, 0x91, 0x00, 0xe0,
+  0xf9, 0x64, 0x05, 0x02, 0x49, 0x4c, 0x58, 0x43, 0xca, 0xa0, 0x53, 0x66, 0xa4, 0x32, 0x69, 0x61,
+  0x34, 0xcb, 0x86, 0x5a, 0x65, 0x89, 0xe4, 0x92, 0xf4, 0xcb, 0xc4, 0xca, 0xac, 0x57, 0x86, 0xc8,
+  0x32, 0xea, 0x96, 0x95, 0x01, 0x80, 0xd9, 0x49, 0x49, 0x2e, 0x73, 0x2a, 0x12, 0x74, 0xbe, 0x12,
+  0x13, 0xb6, 0xee, 0x32, 0x04, 0x37, 0x51, 0xbd, 0xcc, 0xf9, 0x65, 0x05, 0xa8, 0xd1, 0x82, 0x19,
+  0x29, 0xcc, 0x4c, 0x00, 0x20, 0x03, 0x00, 0xea, 0x98, 0x05, 0xc8, 0xac, 0x60, 0x66, 0x49, 0x34,
+  0x83, 0xab, 0x59, 0x61, 0xcd, 0x12, 0x6e, 0xc6, 0xf8, 0x8b, 0x87, 0x9c, 0xd1, 0x00, 0xa0, 0x3a,
+  0x67, 0xd2, 0xf7, 0x29, 0xd2, 0x59, 0xa0, 0xce, 0x12, 0x76, 0x56, 0xcd, 0xb3, 0x00, 0x62, 0x15,
+  0xf6, 0xac, 0xda, 0x2c, 0xd3, 0xdf, 0x61, 0xf4, 0x99, 0xd4, 0xcf, 0x02, 0x81, 0x56, 0x10, 0xb4,
+  0xe4, 0xa0, 0x3d, 0x08, 0x0d, 0x52, 0x68, 0x14, 0x44, 0xab, 0x2a, 0x5a, 0x70, 0xd1, 0x9a, 0xf0,
+  0x54, 0x74, 0xae, 0xe6, 0xc8, 0x04, 0xf9, 0x67, 0xd8, 0x68, 0x4e, 0x47, 0x0b, 0x7a, 0x18, 0xf3,
+  0xd1, 0xa8, 0xcb, 0x55, 0x85, 0x34, 0xea, 0xc8, 0x38, 0xfb, 0x85, 0x5a, 0x4e, 0xd9, 0xe1, 0x42,
+  0x46, 0x5a, 0x35, 0xa0, 0x88, 0x23, 0x53, 0x1c, 0x2e, 0xa4, 0xa4, 0x0d, 0x27, 0x8d, 0x69, 0x3f,
+  0x55, 0x4a, 0x63, 0x56, 0x5a, 0xd2, 0xd2, 0xa4, 0xfe, 0x55, 0x95, 0x21, 0x6b, 0xbf, 0x50, 0x31,
+  0xad, 0xa8, 0x69, 0x88, 0x08, 0xaa, 0x2e, 0x54, 0x73, 0x86, 0x02, 0xe1, 0x55, 0xd8, 0xb4, 0x24,
+  0xa7, 0x15, 0x3c, 0x6d, 0xda, 0x33, 0x54, 0x6e, 0xd2, 0x82, 0xda, 0x41, 0xd4, 0x16, 0x33, 0xd4,
+  0xe0, 0x26, 0x09, 0x37, 0x4d, 0x48, 0xcd, 0xd2, 0x63, 0x97, 0x52, 0xc3, 0x16, 0x4c, 0xe1, 0xd4,
+  0xb0, 0xa9, 0x76, 0x50, 0x35, 0xa7, 0x22, 0x05, 0x22, 0xe8, 0xc1, 0x3f, 0x92, 0x55, 0xbb, 0x72,
+  0x53, 0x41, 0x9f, 0x0c, 0xad, 0x96, 0x80, 0x9a, 0xa9, 0xab, 0x55, 0x99, 0x6b, 0x19, 0x46, 0xcc,
+  0x57, 0x1b, 0xc4, 0x5a, 0x69, 0xd6, 0x0e, 0xb6, 0xc6, 0x58, 0xa7, 0x46, 0xae, 0x4d, 0x76, 0x8d,
+  0xc2, 0x6b, 0xd7, 0x5f, 0x73, 0x42, 0x4d, 0x1e, 0x00, 0x06, 0xc0, 0x76, 0x08, 0xb6, 0x44, 0x78,
+  0x39, 0x86, 0x8d, 0x52, 0x6c, 0x59, 0x6e, 0x0a, 0x18, 0x5b, 0xe9, 0xd8, 0x1c, 0xc8, 0x36, 0x25,
+  0xa7, 0x42, 0xb2, 0x1d, 0x94, 0x8d, 0x41, 0x20, 0x0e, 0x28, 0x9a, 0x26, 0x59, 0x61, 0xd9, 0xa8,
+  0xcc, 0x36, 0x6d, 0xb6, 0xa0, 0xd4, 0x34, 0x9d, 0x4d, 0x52, 0x4b, 0x57, 0x6e, 0x92, 0x3e, 0x1b,
+  0xb1, 0x60, 0x0e, 0xd0, 0x96, 0x07, 0x80, 0x69, 0xb4, 0x21, 0x91, 0xeb, 0x38, 0x32, 0x03, 0x69,
+  0x73, 0x50, 0x1b, 0xe4, 0x89, 0x26, 0x44, 0x65, 0xad, 0xb6, 0x40, 0xcf, 0x0c, 0xae, 0xad, 0x88,
+  0x6d, 0x05, 0x6d, 0x6b, 0x01, 0x00, 0x55, 0x91, 0x28, 0xdb, 0x76, 0xe5, 0xb6, 0x82, 0xb7, 0x19,
+  0x61, 0x8c, 0xa9, 0x48, 0xd3, 0x19, 0x3a, 0xfe, 0xda, 0xe0, 0xdb, 0x98, 0x52, 0xd5, 0xbc, 0x31,
+  0xa7, 0xfd, 0x30, 0xa7, 0xa5, 0x68, 0x2c, 0x45, 0x70, 0x93, 0x62, 0x12, 0x73, 0x9a, 0x0a, 0xe2,
+  0x26, 0x25, 0xb7, 0x6a, 0xb9, 0x05, 0xcd, 0xad, 0x78, 0x6e, 0x05, 0x74, 0x4b, 0xa6, 0x5b, 0x51,
+  0xdd, 0x9e, 0xeb, 0x06, 0x65, 0xb7, 0x42, 0xbb, 0x25, 0xdc, 0x4d, 0xfa, 0x6e, 0x05, 0xeb, 0x4a,
+  0xc2, 0x9b, 0x73, 0xde, 0x8c, 0x22, 0x93, 0xa4, 0x37, 0xe2, 0x42, 0x15, 0xeb, 0xed, 0x68, 0x6f,
+  0xc5, 0x7b, 0x43, 0xe2, 0x5b, 0x22, 0xdf, 0xa0, 0x98, 0x34, 0xd1, 0x37, 0xaa, 0x7f, 0x21, 0xf7,
+  0xad, 0x40, 0x20, 0x49, 0x7e, 0xa3, 0xce, 0x50, 0xc9, 0xdf, 0xce, 0x00, 0x30, 0x05, 0x38, 0x22,
+  0x81, 0x14, 0x02, 0x2e, 0x39, 0x61, 0x05, 0x81, 0x63, 0xce, 0x50, 0x41, 0x9f, 0x92, 0x50, 0x93,
+  0xc8, 0x25, 0x68, 0xc1, 0x04, 0x07, 0x2e, 0x09, 0x35, 0x83, 0x5a, 0x42, 0x01, 0x00, 0xb5, 0xe0,
+  0xaa, 0x07, 0x97, 0x44, 0xb8, 0x60, 0xc2, 0x25, 0x5b, 0x2a, 0xa8, 0x70, 0xc3, 0x85, 0x7b, 0x34,
+  0xdc, 0xd4, 0xe1, 0x9c, 0x0f, 0x27, 0xc0, 0x24, 0xc2, 0x65, 0x25, 0x22, 0xee, 0x11, 0x3e, 0x54,
+  0x89, 0x93, 0x52, 0x5c, 0xe0, 0xb3, 0x0a, 0x50, 0x93, 0x9c, 0xb0, 0x02, 0xd4, 0x24, 0x73, 0x29,
+  0x59, 0x71, 0xd4, 0x4e, 0x42, 0x76, 0x12, 0x35, 0x78, 0x92, 0x16, 0x97, 0x4c, 0x2e, 0xe6, 0xc5,
+  0x51, 0xf7, 0x67, 0x88, 0x71, 0xce, 0xe4, 0x62, 0xf6, 0x4b, 0x30, 0xe3, 0x98, 0x98, 0x14, 0xd0,
+  0xb8, 0xa1, 0xab, 0x51, 0x39, 0x6e, 0xd8, 0x71, 0x4c, 0x8f, 0x4b, 0xfa, 0x15, 0xf5, 0xe3, 0x9c,
+  0xed, 0xe5, 0x04, 0x39, 0x2a, 0x72, 0x4d, 0x43, 0xae, 0x28, 0x72, 0xd3, 0x91, 0x33, 0x90, 0x1c,
+  0xa3, 0xe4, 0x1a, 0x26, 0x07, 0xf1, 0x2c, 0xca, 0xc9, 0x55, 0xa0, 0xc6, 0x8a, 0x72, 0xc4, 0x7e,
+  0x19, 0x3e, 0x11, 0x13, 0xb9, 0x4a, 0x00, 0x00, 0x5d, 0x39, 0xe9, 0x13, 0x25, 0xf4, 0x89, 0xc9,
+  0x72, 0x98, 0x96, 0xd3, 0xba, 0x5c, 0xf2, 0xe5, 0x92, 0x13, 0x06, 0xbd, 0xac, 0x69, 0xcc, 0x05,
+  0xaa, 0x2b, 0x01, 0x35, 0x74, 0x99, 0x2b, 0x01, 0x40, 0x72, 0xc2, 0xd0, 0x00, 0x90, 0xa4, 0xb9,
+  0x20, 0x14, 0x11, 0x66, 0x88, 0x75, 0x5a, 0x32, 0x00, 0x98, 0xd6, 0xdc, 0xd3, 0xe6, 0x0a, 0x37,
+  0xb7, 0xf0, 0xaf, 0x67, 0xce, 0x15, 0x77, 0x2e, 0x18, 0x5e, 0x01, 0x9e, 0x7b, 0xf6, 0x5c, 0xe2,
+  0xd1, 0x1e, 0x3e, 0x57, 0x05, 0xba, 0x42, 0xd0, 0x25, 0x87, 0x2e, 0x48, 0x74, 0xd0, 0xa2, 0x73,
+  0xf6, 0x4c, 0xd0, 0xe8, 0x10, 0x47, 0xf7, 0x5c, 0x36, 0x6a, 0x72, 0x95, 0x91, 0xae, 0x0a, 0x4f,
+  0x52, 0x6e, 0x0a, 0x26, 0x1d, 0xb5, 0xd4, 0x1c, 0x50, 0x33, 0xe5, 0x26, 0xa7, 0xd2, 0x09, 0x12,
+  0x2c, 0xc9, 0x74, 0xd4, 0xa6, 0x43, 0xfa, 0x97, 0x74, 0x64, 0x02, 0xd5, 0x55, 0x06, 0x00, 0x67,
+  0xb3, 0x25, 0x9e, 0xae, 0x11, 0x75, 0x94, 0x19, 0xaa, 0x4a, 0xdd, 0x71, 0xea, 0x88, 0x37, 0x16,
+  0xc8, 0xb8, 0x04, 0xd5, 0x55, 0xaf, 0x6e, 0x38, 0x43, 0x01, 0xac, 0x2b, 0x40, 0x4d, 0x62, 0xc2,
+  0x9e, 0x59, 0x27, 0x99, 0x21, 0x6a, 0x7f, 0x39, 0xb6, 0x0e, 0x3a, 0x4b, 0xcf, 0xae, 0x93, 0x7a,
+  0x5d, 0x10, 0xec, 0xa8, 0x33, 0xe3, 0xe4, 0xa6, 0x64, 0xd8, 0x51, 0xc5, 0x8e, 0x88, 0x49, 0xc3,
+  0xb1, 0x93, 0x92, 0x5d, 0xb1, 0xec, 0x82, 0xbc, 0x74, 0x64, 0x3a, 0xa6, 0x7d, 0x05, 0xcd, 0x8e,
+  0x79, 0x76, 0x46, 0xb4, 0x5b, 0x16, 0x0c, 0x94, 0xe3, 0x8a, 0x69, 0x97, 0x54, 0xbb, 0xc6, 0xda,
+  0x51, 0x31, 0xae, 0xc9, 0x76, 0xc2, 0xb6, 0x2b, 0x2e, 0x5b, 0x32, 0xd0, 0xa0, 0xd7, 0x96, 0xbc,
+  0xac, 0x43, 0xc7, 0x3d, 0xdd, 0x8e, 0x78, 0x59, 0xd2, 0xcb, 0x0a, 0xbe, 0x1d, 0x15, 0xee, 0xa0,
+  0xdc, 0x74, 0x50, 0x35, 0x29, 0xd4, 0x0c, 0xe2, 0x6e, 0x4a, 0x4e, 0x0c, 0xb9, 0xa3, 0xce, 0x5d,
+  0xc3, 0xee, 0x26, 0x77, 0x47, 0xfd, 0x1d, 0x46, 0xde, 0x49, 0x9f, 0x6d, 0xa0, 0x77, 0xcb, 0x91,
+  0x79, 0xee, 0x1d, 0x89, 0xef, 0x18, 0x7d, 0x37, 0xf9, 0xbb, 0x3c, 0x00, 0x10, 0x00, 0xef, 0x30,
+  0x32, 0x0b, 0x6e, 0x72, 0x70, 0xd3, 0x84, 0xf0, 0xa8, 0x85, 0x57, 0x02, 0x00, 0x04, 0x1f, 0x41,
+  0x0e, 0x8f, 0xca, 0x47, 0x83, 0xc4, 0x43, 0x28, 0x1e, 0x75, 0x86, 0x02, 0x8c, 0x57, 0x6c, 0x3c,
+  0x81, 0xe3, 0x19, 0x45, 0xc6, 0xf8, 0x78, 0xc1, 0xc8, 0x23, 0x4a, 0x1e, 0x31, 0x8c, 0x16, 0xdc,
+  0xc4, 0xa0, 0x3c, 0x6a, 0xe5, 0x51, 0x2d, 0x8f, 0x5a, 0x60, 0xd4, 0xcb, 0xab, 0x66, 0xde, 0x44,
+  0xf3, 0xa8, 0x9b, 0xc7, 0x74, 0x95, 0x24, 0xe7, 0x11, 0xe7, 0xcb, 0xe1, 0x79, 0x54, 0xcb, 0x7b,
+  0x7e, 0x1e, 0x15, 0xf4, 0xa4, 0xa1, 0xf7, 0x14, 0x3d, 0x66, 0x72, 0x25, 0x47, 0x8f, 0x4a, 0x7a,
+  0x5a, 0xd3, 0x73, 0x9e, 0x1e, 0x74, 0x86, 0x92, 0xa8, 0x17, 0xdc, 0x36, 0x69, 0xea, 0x69, 0x7f,
+  0xc7, 0xe9, 0x2a, 0x0c, 0xd5, 0x93, 0xb2, 0x9e, 0xb4, 0xf5, 0xa4, 0x50, 0xd3, 0x80, 0xa7, 0x29,
+  0x3c, 0x41, 0x23, 0x48, 0x0a, 0x54, 0x52, 0xe6, 0x12, 0x23, 0x57, 0xf2, 0xf5, 0x84, 0xcb, 0x65,
+  0x85, 0xbd, 0xa4, 0xec, 0x05, 0xf5, 0x89, 0x3a, 0x7b, 0xd2, 0xda, 0x0b, 0x7c, 0x56, 0x72, 0xc2,
+  0x92, 0x3d, 0xe3, 0x54, 0x38, 0xe4, 0xed, 0x09, 0xa5, 0x65, 0x88, 0x7b, 0xd5, 0x7e, 0x69, 0xfe,
+  0x4e, 0xb0, 0x67, 0x0a, 0xb9, 0xf7, 0x9c, 0xb0, 0x3b, 0x00, 0x24, 0x9d, 0x4b, 0x7a, 0x6d, 0x4f,
+  0xdd, 0x0b, 0x86, 0x9d, 0x15, 0x59, 0x9c, 0xbf, 0x93, 0xdc, 0xbd, 0x03, 0xef, 0x51, 0x6b, 0xe9,
+  0xd9, 0x7b, 0x53, 0xdf, 0x7b, 0xfc, 0x1e, 0x14, 0xf8, 0x92, 0xc1, 0x57, 0x14, 0xbe, 0xe9, 0xd8,
+  0x25, 0x87, 0x2f, 0x60, 0x3f, 0x49, 0xe7, 0xca, 0xb2, 0x56, 0xd0, 0xaf, 0xa4, 0xc4, 0x27, 0x2d,
+  0xbe, 0x11, 0x00, 0x44, 0x8d, 0x8f, 0x6a, 0x36, 0xc1, 0xe3, 0x63, 0x76, 0x8b, 0x34, 0xf9, 0x08,
+  0xd7, 0xe6, 0xfc, 0x9d, 0x00, 0x72, 0x15, 0xa1, 0x26, 0x89, 0x5e, 0xcf, 0xdf, 0x93, 0x2a, 0x5f,
+  0xd0, 0x98, 0xa6, 0x23, 0x33, 0x8d, 0xa0, 0xa9, 0x31, 0x39, 0x5c, 0x85, 0x8a, 0x5c, 0x52, 0xe6,
+  0x93, 0x7a, 0x4b, 0xd5, 0xf9, 0xa4, 0xc6, 0x32, 0xac, 0x25, 0xa7, 0xb7, 0x04, 0x7d, 0x45, 0xfa,
+  0x7c, 0xc5, 0x66, 0x91, 0x46, 0x5f, 0x51, 0xfa, 0x9a, 0xcb, 0xd5, 0xb4, 0xb8, 0xe1, 0xf4, 0x15,
+  0x91, 0x8e, 0x4a, 0x7d, 0x6c, 0x00, 0x70, 0x56, 0x5f, 0xd0, 0xfa, 0xa4, 0xb1, 0x12, 0xbc, 0x3e,
+  0x07, 0xb2, 0x44, 0x8d, 0x6f, 0x0c, 0x00, 0xc5, 0x85, 0x4a, 0x62, 0x5f, 0x01, 0x5b, 0x92, 0xd9,
+  0x47, 0xd5, 0xbe, 0x64, 0x82, 0x59, 0x47, 0xe6, 0xb8, 0x7d, 0xc5, 0xee, 0x7b, 0x7a, 0x5f, 0xf1,
+  0xfb, 0x9e, 0xe0, 0x27, 0x9d, 0x21, 0x66, 0xf8, 0x49, 0x9b, 0x65, 0x0d, 0x00, 0x45, 0xff, 0x9a,
+  0xf0, 0x11, 0x35, 0xbd, 0x90, 0xbf, 0x83, 0xe4, 0x26, 0xa6, 0xf8, 0x35, 0xaf, 0x2d, 0xe8, 0x5c,
+  0xce, 0xe0, 0x21, 0xf8, 0x17, 0x75, 0xfc, 0x84, 0x04, 0x32, 0x74, 0x35, 0xed, 0x0c, 0x21, 0x7b,
+  0x86, 0x2a, 0x2d, 0x4c, 0x6e, 0x4a, 0x96, 0x5f, 0xb1, 0xbe, 0x9c, 0x23, 0xe7, 0x08, 0x1e, 0xe8,
+  0xf9, 0x05, 0xd1, 0x4f, 0x20, 0x2d, 0xc3, 0x5a, 0x32, 0xa6, 0x9f, 0xd3, 0xf3, 0x8a, 0x9b, 0xc7,
+  0x50, 0x3f, 0xea, 0x8d, 0x05, 0xd6, 0xaf, 0xc8, 0x7e, 0x05, 0xff, 0xa2, 0x22, 0x17, 0xb3, 0xfd,
+  0xa4, 0xb9, 0x34, 0x75, 0xbf, 0x26, 0x72, 0x09, 0xdf, 0x2f, 0x58, 0x0d, 0xcc, 0x93, 0x83, 0xfa,
+  0xd8, 0xa0, 0xe3, 0x0e, 0xf0, 0x47, 0x1d, 0x99, 0x81, 0xfc, 0x1d, 0x46, 0xa6, 0x31, 0x7f, 0x8e,
+  0xfa, 0x93, 0x8c, 0x0c, 0xd5, 0xfe, 0x9e, 0x67, 0x23, 0xc5, 0xbf, 0xc4, 0xf0, 0x55, 0xf5, 0xcf,
+  0x0c, 0x00, 0x84, 0xfd, 0x63, 0x72, 0x53, 0x91, 0xff, 0x8a, 0xcf, 0x16, 0xec, 0xbf, 0xe1, 0xef,
+  0x3c, 0x33, 0x2e, 0xe8, 0x7f, 0x81, 0xff, 0xab, 0xda, 0xd7, 0x08, 0x00, 0xd8, 0x00, 0xf0, 0x5c,
+  0xb6, 0x64, 0xd4, 0x21, 0xb8, 0x69, 0x0a, 0x80, 0x8e, 0x01, 0x94, 0x8e, 0x4c, 0x90, 0xf8, 0x12,
+  0x5c, 0x16, 0x2d, 0xc0, 0xe5, 0xc8, 0x10, 0x0d, 0xd0, 0xa9, 0x5e, 0xcb, 0x19, 0x2a, 0x22, 0x20,
+  0x15, 0x9e, 0x8a, 0x09, 0x28, 0xe9, 0x97, 0x69, 0x6b, 0x39, 0x90, 0x45, 0xc2, 0x47, 0x53, 0x05,
+  0xac, 0x5a, 0xdc, 0x93, 0xb9, 0xaa, 0x0b, 0x58, 0x65, 0xc0, 0x67, 0x03, 0x16, 0xa0, 0x26, 0x0f,
+  0x00, 0x89, 0x90, 0xcb, 0x03, 0xc0, 0xd3, 0x01, 0x87, 0xf0, 0x54, 0x7c, 0xc0, 0x20, 0x04, 0x52,
+  0x23, 0x90, 0x39, 0x7f, 0x8c, 0x19, 0x82, 0xea, 0x1d, 0x72, 0x02, 0x09, 0xfd, 0x92, 0x1d, 0x99,
+  0x04, 0x05, 0x3a, 0x7b, 0x86, 0x30, 0x32, 0xd3, 0xd6, 0x2a, 0x96, 0x54, 0xc0, 0x7e, 0x06, 0xde,
+  0xe2, 0xac, 0xc0, 0x80, 0x3e, 0x0d, 0x2c, 0x90, 0x31, 0x32, 0xce, 0x0b, 0x94, 0xba, 0x8f, 0x13,
+  0x03, 0x87, 0xf6, 0x93, 0x1d, 0x99, 0x41, 0x06, 0x1e, 0x36, 0x50, 0x5a, 0x4b, 0x13, 0x0e, 0xc4,
+  0xfe, 0x4e, 0xa0, 0xa4, 0x9c, 0xf6, 0x53, 0xb4, 0x9f, 0xc0, 0x7b, 0x15, 0x3c, 0x30, 0xf9, 0x5e,
+  0x4e, 0x28, 0x62, 0x7e, 0xe0, 0x94, 0x03, 0x99, 0xd7, 0x55, 0x00, 0xc1, 0x04, 0x73, 0x3d, 0x43,
+  0x30, 0x31, 0x82, 0xd2, 0x12, 0x64, 0x9a, 0xe0, 0xc0, 0xd5, 0x92, 0xcf, 0x56, 0xec, 0x19, 0x62,
+  0x82, 0x31, 0x2d, 0x90, 0x79, 0x82, 0x41, 0x33, 0x7a, 0xa2, 0x60, 0xd0, 0x5b, 0x92, 0x29, 0x48,
+  0xbd, 0x2c, 0x86, 0x0a, 0x4e, 0x5d, 0xad, 0x10, 0x50, 0xc9, 0xdd, 0x93, 0xaa, 0xd7, 0x74, 0x05,
+  0x27, 0xae, 0x46, 0xfd, 0x1d, 0x12, 0x00, 0x40, 0x59, 0x30, 0x31, 0x61, 0x79, 0x00, 0x38, 0x70,
+  0x93, 0xf4, 0xb2, 0xd0, 0x33, 0x54, 0x80, 0x1a, 0xa6, 0xf8, 0x0d, 0x66, 0x88, 0xca, 0x4d, 0xc9,
+  0x16, 0x44, 0x2a, 0x52, 0x20, 0xbc, 0x92, 0x50, 0x63, 0x9c, 0x21, 0xe4, 0xc8, 0x20, 0x5e, 0x10,
+  0xca, 0x82, 0x05, 0x3e, 0x4a, 0x7e, 0x56, 0x02, 0x06, 0x1d, 0x31, 0x38, 0xb5, 0x9f, 0x02, 0xd4,
+  0x24, 0xd4, 0xee, 0x29, 0x83, 0x01, 0x6f, 0x61, 0x8a, 0x5f, 0x50, 0xa6, 0x4a, 0x00, 0x90, 0x98,
+  0xc1, 0x2a, 0x0d, 0x06, 0x19, 0x8b, 0x5a, 0x83, 0x09, 0x69, 0x91, 0x5e, 0xd6, 0x0a, 0x00, 0xa8,
+  0xc8, 0x55, 0x44, 0xb7, 0xa5, 0x7a, 0x31, 0x6f, 0x50, 0x7b, 0x7e, 0x4e, 0x47, 0x42, 0x52, 0xa0,
+  0x34, 0xb9, 0x8a, 0xf5, 0x47, 0x25, 0x90, 0xe6, 0x82, 0x31, 0x47, 0xa6, 0x98, 0x5c, 0x41, 0x1c,
+  0x2c, 0xf0, 0x51, 0x32, 0xb9, 0xc8, 0x39, 0x58, 0x02, 0x80, 0x24, 0xd4, 0x24, 0xf5, 0x8e, 0x30,
+  0x43, 0x6e, 0x00, 0xb0, 0x26, 0x57, 0x51, 0x07, 0x13, 0x13, 0xe6, 0x06, 0x80, 0x29, 0xe1, 0x65,
+  0xa3, 0xce, 0x20, 0x32, 0x4c, 0xf1, 0x73, 0xb8, 0x8a, 0x74, 0x07, 0x9f, 0x43, 0x77, 0xe4, 0x41,
+  0x29, 0x0d, 0x32, 0x7b, 0x50, 0x6a, 0x71, 0xce, 0x0b, 0x74, 0xfa, 0xe0, 0xb0, 0x5f, 0x92, 0x40,
+  0xe8, 0x0c, 0x9f, 0xe6, 0x75, 0x15, 0x83, 0xf0, 0x41, 0x68, 0x93, 0x1e, 0xa4, 0x72, 0x13, 0x51,
+  0x08, 0x99, 0x97, 0x25, 0xfd, 0x8b, 0x2a, 0x26, 0x31, 0x87, 0x90, 0xee, 0x5f, 0x54, 0xff, 0x7a,
+  0x1a, 0x61, 0xd9, 0xdb, 0x48, 0x00, 0xe0, 0xf4, 0x3c, 0xc6, 0x0c, 0x4d, 0x09, 0x2f, 0xc9, 0x3f,
+  0xcc, 0x23, 0x94, 0x2a, 0xa1, 0x0c, 0x00, 0xa8, 0xc8, 0x25, 0x49, 0xae, 0x3c, 0x00, 0x48, 0x97,
+  0x70, 0x0c, 0x4f, 0xc2, 0x66, 0x19, 0x72, 0x53, 0x82, 0x8f, 0xaa, 0x0d, 0x48, 0xbd, 0x31, 0xea,
+  0xb2, 0x31, 0x38, 0x2b, 0x0f, 0x00, 0xc2, 0x02, 0x0a, 0x84, 0x57, 0x72, 0x06, 0x9d, 0x7c, 0x14,
+  0x84, 0x1a, 0x27, 0x3c, 0x15, 0xc3, 0xaf, 0xba, 0x50, 0x4e, 0xe4, 0x62, 0x30, 0x61, 0xb3, 0x09,
+  0x9f, 0xef, 0x57, 0xe4, 0xa3, 0xaa, 0x13, 0x26, 0x75, 0x89, 0x98, 0x5e, 0x4f, 0xa4, 0x93, 0xf2,
+  0x11, 0xb5, 0x5b, 0x9e, 0x05, 0x94, 0x7c, 0xc2, 0xe4, 0x02, 0x16, 0xf5, 0xae, 0x80, 0x2d, 0x89,
+  0x68, 0x7a, 0x42, 0xe1, 0xb3, 0x02, 0x93, 0x33, 0xf8, 0x34, 0x26, 0x6d, 0xf0, 0x04, 0xf4, 0x69,
+  0x08, 0x4f, 0xc1, 0x28, 0x7c, 0x34, 0x60, 0x75, 0xd9, 0x9e, 0x16, 0x37, 0xc5, 0x38, 0x29, 0xb6,
+  0x38, 0x7a, 0x06, 0xea, 0x2d, 0x0e, 0x29, 0xb4, 0xa6, 0x57, 0x71, 0x0a, 0xa7, 0xeb, 0x76, 0x45,
+  0x3a, 0x86, 0xea, 0x39, 0x2f, 0x4b, 0x7a, 0x82, 0x8e, 0xcb, 0x92, 0x52, 0xa1, 0x75, 0xfe, 0xa4,
+  0xae, 0x32, 0xad, 0x42, 0x26, 0xd4, 0xd0, 0xad, 0xd0, 0x39, 0x32, 0x4e, 0x2c, 0x2c, 0x40, 0xcd,
+  0xf3, 0xf7, 0x9c, 0x97, 0x95, 0x40, 0xaf, 0x3c, 0x00, 0x14, 0xf4, 0xc9, 0xf9, 0x3b, 0x4f, 0x6c,
+  0xa1, 0x0a, 0x4d, 0xb5, 0x5b, 0x02, 0xf6, 0xe3, 0x98, 0x21, 0x69, 0xf0, 0x48, 0xb5, 0xf0, 0xf8,
+  0x3b, 0x92, 0x19, 0xaa, 0xd6, 0x57, 0x02, 0xbd, 0xa8, 0x23, 0xc3, 0xe4, 0xc2, 0x81, 0xab, 0x39,
+  0x47, 0x06, 0xfa, 0x44, 0xd3, 0x2e, 0x44, 0xa6, 0x17, 0xf5, 0xfd, 0x92, 0xf6, 0xe3, 0x44, 0x29,
+  0xa7, 0x17, 0x26, 0x45, 0xab, 0xba, 0x6c, 0xc2, 0x65, 0xb3, 0x72, 0x53, 0xd1, 0x8c, 0xa0, 0xcf,
+  0x56, 0xd5, 0xa5, 0x66, 0x72, 0x51, 0xbf, 0x10, 0x09, 0x86, 0xcf, 0x30, 0x2c, 0x8a, 0x61, 0x61,
+  0x0c, 0x1b, 0x64, 0x78, 0xfd, 0xb5, 0x69, 0xf0, 0x2c, 0xd2, 0x0b, 0x9a, 0x5e, 0x45, 0x6f, 0x0b,
+  0x62, 0xcb, 0x75, 0x64, 0x86, 0xa3, 0x95, 0x98, 0xb0, 0x27, 0xf8, 0x3d, 0xcb, 0x50, 0x60, 0x86,
+  0x89, 0x09, 0x9b, 0x9c, 0xe1, 0xf5, 0xd7, 0x9e, 0xa2, 0x55, 0xa8, 0x2f, 0xe9, 0x0c, 0x31, 0xd0,
+  0x30, 0x0f, 0x00, 0xc8, 0x34, 0x24, 0xac, 0x61, 0x11, 0x08, 0xa5, 0x6c, 0xe8, 0x1e, 0x99, 0x62,
+  0x1b, 0x26, 0xb0, 0x8f, 0x89, 0x86, 0x4e, 0x02, 0x29, 0xb4, 0x98, 0x34, 0xb9, 0xc8, 0x6e, 0x88,
+  0x26, 0x3d, 0x24, 0x1f, 0x21, 0xe6, 0x8f, 0x5a, 0x30, 0xc7, 0x03, 0xa3, 0x1e, 0xde, 0xf4, 0xda,
+  0x46, 0x00, 0x30, 0x35, 0xa6, 0x33, 0x00, 0x4c, 0xe1, 0x30, 0xe9, 0x79, 0xc5, 0xf0, 0xa1, 0xc6,
+  0x21, 0x55, 0x0e, 0x0d, 0x22, 0x93, 0x07, 0x80, 0xa0, 0xe7, 0x25, 0x8d, 0x25, 0xc8, 0x65, 0xd2,
+  0x7e, 0xa9, 0xf8, 0x8a, 0x75, 0x64, 0x84, 0xdc, 0x14, 0xc0, 0xc0, 0x6a, 0xf8, 0x50, 0xed, 0x27,
+  0x60, 0x3f, 0x65, 0x00, 0x78, 0x03, 0x40, 0xe0, 0xb3, 0x92, 0xbb, 0x17, 0xf8, 0xac, 0x22, 0xd4,
+  0x14, 0x8d, 0x89, 0x3a, 0x87, 0x53, 0x3a, 0x94, 0xb2, 0x96, 0xf5, 0x77, 0xaa, 0xc9, 0x35, 0x45,
+  0x96, 0x64, 0x1d, 0x56, 0xe9, 0x10, 0x99, 0x5c, 0xc2, 0x6b, 0x83, 0x1a, 0xd3, 0xd4, 0xd5, 0x86,
+  0xc6, 0xf4, 0xb4, 0xc3, 0xea, 0xef, 0x30, 0xb8, 0x69, 0xca, 0x4d, 0x45, 0x78, 0x2a, 0x40, 0x4d,
+  0x12, 0x9e, 0x02, 0xfa, 0x94, 0x9c, 0x30, 0x27, 0xff, 0x04, 0xc2, 0xab, 0xa8, 0x77, 0x4b, 0xe4,
+  0x72, 0x1a, 0x53, 0xd5, 0xbe, 0xa4, 0x77, 0x38, 0x1c, 0x99, 0x66, 0xd3, 0x49, 0xf1, 0x70, 0x4a,
+  0x4e, 0x46, 0x3d, 0x4c, 0xf2, 0x11, 0xc2, 0x7e, 0xdc, 0x00, 0x20, 0xc5, 0x2f, 0xaa, 0xab, 0xc9,
+  0x01, 0xe0, 0x3a, 0x43, 0xc1, 0xef, 0x2b, 0xe6, 0x5e, 0x21, 0xb9, 0x92, 0x7c, 0xe4, 0xf0, 0xbc,
+  0xa9, 0xab, 0x25, 0x47, 0x46, 0xf8, 0x85, 0xd2, 0x3d, 0xcc, 0x1a, 0x93, 0xd4, 0x98, 0x88, 0xef,
+  0x97, 0x9c, 0x2f, 0x2a, 0xb2, 0x48, 0xe1, 0xa9, 0xc0, 0x87, 0xc9, 0x09, 0x7b, 0xc2, 0x53, 0x01,
+  0x6a, 0x92, 0x13, 0x56, 0x0c, 0xaf, 0xc2, 0x42, 0x31, 0xc5, 0xcf, 0x20, 0x32, 0xc9, 0x09, 0x13,
+  0x22, 0x17, 0x13, 0x0d, 0xa5, 0x7e, 0xc8, 0x44, 0x41, 0x61, 0xf8, 0x11, 0xaf, 0x2d, 0xc1, 0x65,
+  0x0c, 0xf1, 0xcb, 0x03, 0x00, 0x63, 0x86, 0xa6, 0xdc, 0x54, 0xbd, 0x2c, 0x06, 0x20, 0xe6, 0x01,
+  0x60, 0x5a, 0x7d, 0x42, 0x41, 0x9c, 0xc2, 0xd3, 0x94, 0x9b, 0xa4, 0x83, 0x28, 0x45, 0x96, 0xa6,
+  0xd0, 0x38, 0xe7, 0x4f, 0xea, 0x48, 0x89, 0x09, 0x63, 0x8a, 0x1f, 0x13, 0x10, 0xa9, 0x7c, 0x34,
+  0x6d, 0xad, 0x64, 0xbf, 0x24, 0x7d, 0x65, 0xd8, 0x33, 0x01, 0x5f, 0x49, 0x26, 0x17, 0xd2, 0x7e,
+  0x12, 0xbb, 0xf7, 0xac, 0xaf, 0x29, 0x73, 0x25, 0x31, 0x50, 0x7a, 0x5d, 0x89, 0x67, 0xa3, 0x22,
+  0x97, 0x63, 0x64, 0xa8, 0x85, 0xf8, 0xac, 0x33, 0xaa, 0x21, 0x1e, 0xfb, 0x45, 0x8a, 0x5c, 0xd3,
+  0x0b, 0x4c, 0x86, 0x1f, 0xf4, 0x10, 0xa5, 0x88, 0x28, 0x90, 0x16, 0xe6, 0xef, 0x04, 0x13, 0xf1,
+  0x88, 0x2d, 0x53, 0xe4, 0xa2, 0x2a, 0xa2, 0xf1, 0xfc, 0x9c, 0xd7, 0x95, 0x48, 0xae, 0xea, 0x42,
+  0x05, 0x17, 0xb1, 0x39, 0x5f, 0x49, 0x46, 0x9c, 0x36, 0xa2, 0xd1, 0x11, 0xab, 0xef, 0x97, 0xfc,
+  0xac, 0x44, 0x72, 0x55, 0x93, 0x4b, 0x3a, 0x7f, 0x50, 0x4c, 0x4a, 0x56, 0x5f, 0x21, 0xf7, 0x12,
+  0x8f, 0xf8, 0x9c, 0xb0, 0xf6, 0xef, 0x14, 0x72, 0xef, 0x61, 0x73, 0x79, 0x00, 0x18, 0x42, 0x62,
+  0x32, 0x12, 0x99, 0xf5, 0xf7, 0x9c, 0xc4, 0x21, 0x26, 0x19, 0x91, 0x6b, 0xc9, 0x4d, 0x43, 0x23,
+  0x23, 0x5e, 0x60, 0x73, 0xfe, 0x8a, 0x94, 0xf8, 0xb4, 0xc4, 0x42, 0x72, 0x19, 0x45, 0x66, 0xf0,
+  0x3b, 0x54, 0xe4, 0x0a, 0xd8, 0x8f, 0xb3, 0x5b, 0x82, 0x97, 0x48, 0x9d, 0xaf, 0xe3, 0xb3, 0x25,
+  0xa5, 0xa5, 0x78, 0x89, 0x4d, 0x71, 0xca, 0xea, 0x9d, 0x14, 0x13, 0x9f, 0xc6, 0xe2, 0xbc, 0x36,
+  0xa6, 0x26, 0x5e, 0x37, 0x31, 0xf9, 0x88, 0x89, 0x09, 0x63, 0xa2, 0xa1, 0x94, 0x13, 0xc9, 0x04,
+  0x72, 0x64, 0x1b, 0xc6, 0x0c, 0x5d, 0x3b, 0x91, 0xe9, 0x89, 0x45, 0xf4, 0x42, 0xc2, 0x53, 0xf2,
+  0x13, 0xe7, 0x00, 0x10, 0x44, 0x2f, 0x28, 0x72, 0x55, 0x43, 0x31, 0x81, 0x5e, 0xcf, 0xdf, 0x4b,
+  0x8a, 0x62, 0xf1, 0x77, 0x48, 0x00, 0x60, 0x14, 0x99, 0x40, 0x78, 0x25, 0xd1, 0xab, 0x90, 0x7b,
+  0xc9, 0x47, 0x14, 0xce, 0x50, 0x20, 0xbc, 0x8a, 0x50, 0x53, 0xf5, 0x95, 0x67, 0x7d, 0x55, 0xb1,
+  0xe5, 0x49, 0x8a, 0xd2, 0x52, 0xa4, 0x16, 0x8c, 0xd3, 0xc6, 0x9e, 0xe1, 0x13, 0x35, 0xbe, 0x22,
+  0x06, 0x2e, 0x7f, 0x27, 0x18, 0x3e, 0x01, 0x7d, 0x7a, 0xfe, 0x5e, 0x55, 0x9f, 0x48, 0x00, 0xe0,
+  0x34, 0x45, 0x22, 0x72, 0x49, 0x09, 0x84, 0x31, 0x43, 0x6e, 0x00, 0x78, 0xa2, 0x62, 0x51, 0x58,
+  0x82, 0xa8, 0x98, 0x4c, 0xc5, 0xa0, 0x2a, 0x3a, 0x3c, 0xcf, 0xfa, 0x3b, 0x43, 0xfc, 0x1a, 0x01,
+  0x40, 0x11, 0x6a, 0x9e, 0x30, 0x46, 0x9c, 0x21, 0x12, 0x00, 0xd0, 0x01, 0xe0, 0x8a, 0x2d, 0xc4,
+  0xdf, 0xb1, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00
+};
+
+} // namespace embedded_ml
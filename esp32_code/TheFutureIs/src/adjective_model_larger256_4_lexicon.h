@@ -0,0 +1,65 @@
+// adjective_model_larger256_4_lexicon.h
+// Auto-generated word list as a minimized trie
+// Pure C++ implementation for embedded systems
+
+#ifndef ADJECTIVE_MODEL_LARGER256_4_LEXICON_H
+#define ADJECTIVE_MODEL_LARGER256_4_LEXICON_H
+
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+
+namespace embedded_ml {
+
+// 1000 words, walked one letter at a time so a caller can stop as soon as
+// no word starts with its prefix. A walk state is the prefix's node
+// (first edge + 1, 0 without edges) shifted left by one, plus 1 if the
+// prefix is itself a word; kMissing once the prefix left the list.
+// Edges are 19-bit slots of packed: letter code (1 = 'a' .. 26 = 'z') in
+// bits 0-4, terminal bit 5, last edge of its node bit 6, target node above.
+class adjective_model_larger256_4Lexicon {
+public:
+    static constexpr size_t kNumWords = 1000;
+    static constexpr uint32_t kRoot = 2;     // the empty prefix
+    static constexpr uint32_t kMissing = 0;  // no word starts with the prefix
+
+    // State after appending letter c ('a'-'z') to the prefix walked to state
+    static uint32_t Step(uint32_t state, char c) {
+        if (state < kRoot) return kMissing;
+        const uint32_t code = static_cast<uint32_t>(c - 'a' + 1);
+        for (size_t e = (state >> 1) - 1;; ++e) {
+            const uint32_t edge = Edge(e);
+            const uint32_t letter = edge & 0x1f;
+            if (letter == code) return ((edge >> kTargetShift) << 1) | ((edge >> 5) & 1);
+            if (letter > code || (edge & 0x40)) return kMissing;  // letters are sorted
+        }
+    }
+
+    // Whether the prefix walked to state is a word of the list
+    static bool IsWord(uint32_t state) {
+        return (state & 1) != 0;
+    }
+
+    // Whether the NUL-terminated lowercase word is in the list
+    static bool Contains(const char* word) {
+        uint32_t state = kRoot;
+        for (; *word && state != kMissing; ++word) state = Step(state, *word);
+        return IsWord(state);
+    }
+
+private:
+    static constexpr size_t kEdgeBits = 19;
+    static constexpr size_t kTargetShift = 7;
+    static const uint8_t packed[5272];
+
+    static uint32_t Edge(size_t index) {
+        const size_t bit = index * kEdgeBits;
+        uint32_t slot;
+        memcpy(&slot, packed + bit / 8, sizeof(slot));  // little-endian
+        return (slot >> (bit % 8)) & ((1u << kEdgeBits) - 1);
+    }
+};
+
+} // namespace embedded_ml
+
+#endif // ADJECTIVE_MODEL_LARGER256_4_LEXICON_H
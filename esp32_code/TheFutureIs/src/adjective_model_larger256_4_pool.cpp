@@ -0,0 +1,5250 @@
+// adjective_model_larger256_4_pool.cpp
+// Auto-generated pool of pre-sampled words
+// 14895 words, 45 bits each, plus 8 bytes of read padding
+
+#include "adjective_model_larger256_4_pool.h"
+
+namespace embedded_ml {
+
+const uint8_t adjective_model_larger256_4Pool::packed[83793] = {
+  0x41, 0x14, 0x47, 0x00, 0x00, 0x20, 0x08, 0x54, 0x00, 0x00, 0x00, 0x04, 0x81, 0xca, 0x28, 0x04,
+  0x80, 0x20, 0x50, 0x71, 0x07, 0x00, 0x10, 0x04, 0x2a, 0x2e, 0x05, 0x06, 0x82, 0x40, 0xc5, 0xa5,
+  0x01, 0x40, 0x10, 0xa8, 0xc8, 0x42, 0x00, 0x08, 0x02, 0x15, 0x49, 0x65, 0x01, 0x41, 0xa0, 0x32,
+  0x33, 0x00, 0x20, 0x08, 0x94, 0x58, 0x06, 0x00, 0x04, 0x81, 0x92, 0x3b, 0x00, 0x80, 0x20, 0x50,
+  0x72, 0x0c, 0x00, 0x10, 0x04, 0x4a, 0xb2, 0x10, 0x00, 0x82, 0x40, 0x8f, 0xa4, 0x01, 0x40, 0x10,
+  0x8f, 0x15, 0x07, 0x00, 0x08, 0xe2, 0xb1, 0x57, 0x19, 0x00, 0x41, 0x3c, 0x47, 0x00, 0x00, 0x20,
+  0x88, 0xe7, 0x28, 0x00, 0x00, 0x04, 0xf1, 0x64, 0x01, 0x00, 0x80, 0x20, 0x9e, 0x2c, 0x04, 0x00,
+  0x10, 0xc4, 0x93, 0xc5, 0x54, 0x06, 0x82, 0x78, 0xb2, 0xb8, 0x03, 0x40, 0x10, 0x4f, 0x26, 0x17,
+  0x18, 0x08, 0xe2, 0xc9, 0xe4, 0x0e, 0x00, 0x41, 0x3c, 0xf9, 0x5a, 0x21, 0x20, 0x88, 0x27, 0x9f,
+  0x3b, 0x00, 0x04, 0xf1, 0xe4, 0x93, 0xaf, 0xce, 0x20, 0x1e, 0x4d, 0x0c, 0x00, 0x10, 0xc4, 0xa3,
+  0x69, 0x52, 0x00, 0x82, 0x78, 0x55, 0x16, 0x02, 0x40, 0x10, 0xcf, 0x16, 0x77, 0x00, 0x08, 0xe2,
+  0x5d, 0x00, 0x00, 0x00, 0x41, 0xc8, 0xe0, 0xd2, 0x00, 0x20, 0x08, 0x29, 0x58, 0x21, 0x00, 0x04,
+  0x21, 0x07, 0x4a, 0x81, 0x95, 0x20, 0x24, 0x01, 0x00, 0x00, 0x10, 0x84, 0x2c, 0x2c, 0x0d, 0x00,
+  0x82, 0x90, 0xc5, 0x15, 0x02, 0x40, 0x10, 0xb2, 0xc8, 0x34, 0x00, 0x08, 0x42, 0xa6, 0x01, 0x00,
+  0x00, 0x41, 0xc8, 0x44, 0x00, 0x00, 0x20, 0x08, 0x99, 0xdc, 0x01, 0x00, 0x04, 0x21, 0x5b, 0xa0,
+  0x85, 0x80, 0x20, 0xa4, 0xa3, 0x81, 0xa6, 0x11, 0x84, 0x7c, 0xac, 0x10, 0x00, 0x82, 0x90, 0x4f,
+  0x12, 0x00, 0x40, 0x10, 0x92, 0x8e, 0xe4, 0x00, 0x08, 0x62, 0x8e, 0xe4, 0x0a, 0x01, 0x41, 0xcc,
+  0x51, 0x1d, 0x2d, 0x24, 0x88, 0x59, 0x08, 0x2b, 0x04, 0x04, 0x31, 0x8b, 0x0b, 0xee, 0x80, 0x20,
+  0x66, 0x71, 0x85, 0x00, 0x10, 0xc4, 0x2c, 0xb2, 0x10, 0x00, 0x82, 0x98, 0x08, 0x00, 0x00, 0x40,
+  0x10, 0x13, 0x85, 0x95, 0xdc, 0x09, 0x62, 0xa2, 0xe0, 0x00, 0x00, 0x41, 0x4c, 0x14, 0x28, 0x00,
+  0x20, 0x88, 0x89, 0x0a, 0x00, 0x00, 0x04, 0x31, 0x51, 0x21, 0x00, 0x80, 0x20, 0x26, 0x2a, 0x0e,
+  0x00, 0x10, 0xc4, 0x44, 0xc5, 0x1d, 0x00, 0x82, 0x98, 0xa8, 0xc8, 0xe4, 0x40, 0x10, 0x13, 0xa5,
+  0x01, 0x00, 0x08, 0x62, 0xa2, 0x34, 0x02, 0x03, 0x41, 0x4c, 0x94, 0x08, 0x00, 0x20, 0x88, 0x89,
+  0x52, 0x2b, 0x04, 0x04, 0x31, 0x51, 0x72, 0x00, 0x80, 0x20, 0x26, 0x4a, 0xee, 0x00, 0x10, 0xc4,
+  0x44, 0x2c, 0x39, 0x0a, 0x82, 0x98, 0x88, 0x16, 0x02, 0x40, 0x10, 0x13, 0xd1, 0x34, 0x00, 0x08,
+  0x62, 0x22, 0xca, 0x92, 0x3b, 0x41, 0xcc, 0xc4, 0xca, 0x9c, 0x20, 0x88, 0x99, 0x1c, 0x01, 0x00,
+  0x04, 0x31, 0x93, 0x3b, 0x0c, 0x80, 0x20, 0xe6, 0x13, 0x0c, 0x00, 0x10, 0xc4, 0x7c, 0x2c, 0x39,
+  0x0a, 0x82, 0x98, 0xaf, 0x25, 0x77, 0x40, 0x10, 0xf3, 0xc9, 0xc0, 0x0a, 0x09, 0x62, 0xc2, 0x02,
+  0x00, 0x00, 0x41, 0x4c, 0x58, 0x08, 0x00, 0x20, 0x88, 0x09, 0x8b, 0x03, 0x00, 0x04, 0x31, 0x61,
+  0x71, 0x07, 0x80, 0x20, 0x26, 0x2c, 0x8e, 0x02, 0x10, 0xc4, 0x84, 0x45, 0x16, 0x77, 0x82, 0x98,
+  0xb0, 0xc8, 0xe4, 0x4e, 0x10, 0x13, 0x96, 0x99, 0xdc, 0x09, 0x62, 0x42, 0x04, 0x00, 0x00, 0x41,
+  0x4c, 0x88, 0x0a, 0x00, 0x20, 0x88, 0x09, 0x51, 0x21, 0x00, 0x04, 0x31, 0x21, 0x4a, 0x03, 0x80,
+  0x20, 0x26, 0x44, 0x0c, 0x00, 0x10, 0xc4, 0x84, 0x29, 0xd0, 0x42, 0x82, 0x98, 0x30, 0x0d, 0x00,
+  0x40, 0x10, 0x13, 0xa6, 0x11, 0x18, 0x08, 0x62, 0xc2, 0x44, 0x00, 0x00, 0x41, 0x4c, 0x98, 0x4c,
+  0x9d, 0x20, 0x88, 0x09, 0x93, 0x3b, 0x00, 0x04, 0x31, 0x61, 0x72, 0x34, 0x8d, 0x20, 0x26, 0x4c,
+  0xb3, 0x38, 0x1a, 0xc4, 0x84, 0x69, 0xa2, 0x42, 0x82, 0x98, 0x30, 0xcd, 0xe4, 0x4e, 0x10, 0x13,
+  0xa6, 0x19, 0xeb, 0x0c, 0x62, 0xc2, 0x34, 0x29, 0x00, 0x41, 0x4c, 0x98, 0x26, 0x2d, 0x20, 0x88,
+  0x09, 0xd3, 0xa4, 0x69, 0x04, 0x31, 0x61, 0xa2, 0xc9, 0x9d, 0x20, 0x26, 0x64, 0x85, 0x00, 0x10,
+  0xc4, 0x84, 0xcf, 0x1d, 0x00, 0x82, 0x98, 0xf0, 0xc9, 0x42, 0x40, 0x10, 0x13, 0x3e, 0x99, 0x01,
+  0x08, 0x62, 0xc2, 0x47, 0x0b, 0x01, 0x41, 0x4c, 0xf8, 0x68, 0x72, 0x20, 0x88, 0x09, 0x1f, 0xad,
+  0x13, 0x04, 0x31, 0xe1, 0xab, 0x13, 0x80, 0x20, 0x26, 0xa4, 0x85, 0x00, 0x10, 0xc4, 0x84, 0x34,
+  0x0d, 0x00, 0x82, 0x98, 0x90, 0x26, 0x57, 0x48, 0x10, 0x13, 0xd2, 0xe4, 0x0e, 0x08, 0x62, 0x42,
+  0xca, 0x0a, 0x01, 0x41, 0x4c, 0x98, 0x01, 0x00, 0x20, 0x88, 0x39, 0x83, 0x3b, 0x00, 0x04, 0x31,
+  0x67, 0x71, 0x07, 0x80, 0x20, 0xe6, 0x44, 0xc9, 0x1d, 0x10, 0xc4, 0x9c, 0x4f, 0x06, 0x09, 0x82,
+  0x98, 0xf3, 0x55, 0x56, 0x48, 0x10, 0x73, 0xbe, 0xfa, 0xea, 0x0c, 0x62, 0xce, 0x99, 0x02, 0x03,
+  0x41, 0xcc, 0x39, 0x93, 0xa3, 0x20, 0x88, 0x39, 0xe7, 0x93, 0x85, 0x04, 0x31, 0xe7, 0xa4, 0x69,
+  0x80, 0x20, 0xe6, 0xa4, 0x05, 0x00, 0x10, 0xc4, 0x9c, 0xb4, 0x90, 0x42, 0x82, 0x98, 0x93, 0xb2,
+  0x42, 0x40, 0x10, 0x93, 0x02, 0x00, 0x00, 0x08, 0x62, 0xd2, 0xe0, 0x02, 0x03, 0x41, 0x4c, 0x1a,
+  0xdc, 0x01, 0x20, 0x88, 0x49, 0x03, 0x05, 0x00, 0x04, 0x31, 0x69, 0xa0, 0xc9, 0x9d, 0x20, 0x26,
+  0x1d, 0xc9, 0x1d, 0x10, 0xc4, 0xa4, 0x83, 0x02, 0x00, 0x82, 0x98, 0xb4, 0x00, 0x00, 0x40, 0x10,
+  0x93, 0x96, 0xc0, 0x00, 0x08, 0x62, 0xd2, 0x42, 0x00, 0x00, 0x41, 0x4c, 0x5a, 0x48, 0x21, 0x20,
+  0x88, 0x49, 0x0b, 0x49, 0x03, 0x04, 0x31, 0x69, 0x21, 0xc9, 0x9d, 0x20, 0x26, 0x2d, 0xa6, 0xce,
+  0x19, 0xc4, 0xa4, 0x85, 0x15, 0x02, 0x82, 0x98, 0xb4, 0x38, 0x00, 0x40, 0x10, 0x93, 0x16, 0x17,
+  0xdc, 0x09, 0x62, 0xd2, 0xe2, 0x0a, 0x01, 0x41, 0x4c, 0x5a, 0xdc, 0x01, 0x20, 0x88, 0x49, 0x8b,
+  0x4b, 0xab, 0x04, 0x31, 0x69, 0x71, 0xc9, 0x9d, 0x20, 0x26, 0x2d, 0x8e, 0x02, 0x10, 0xc4, 0xa4,
+  0xc5, 0xd1, 0x42, 0x82, 0x98, 0xb4, 0x38, 0x9a, 0x46, 0x10, 0x93, 0x16, 0x09, 0x00, 0x08, 0x62,
+  0xd2, 0x22, 0x83, 0x3b, 0x41, 0x4c, 0x5a, 0x64, 0x21, 0x20, 0x88, 0x49, 0x8b, 0x2c, 0xee, 0x04,
+  0x31, 0x69, 0x91, 0xaf, 0x95, 0x20, 0x26, 0x2d, 0xf2, 0xd5, 0x19, 0xc4, 0xa4, 0x65, 0x16, 0x02,
+  0x82, 0x98, 0xb4, 0x4c, 0x04, 0x40, 0x10, 0x93, 0x96, 0x99, 0x08, 0x08, 0x62, 0xd2, 0x32, 0xdf,
+  0x33, 0x41, 0x4c, 0x5a, 0x66, 0xac, 0x33, 0x88, 0x49, 0xcb, 0xa4, 0x00, 0x04, 0x31, 0x69, 0x99,
+  0xb4, 0x90, 0x20, 0x26, 0x35, 0x75, 0x02, 0x10, 0xc4, 0xa4, 0x08, 0x00, 0x00, 0x82, 0x98, 0x14,
+  0x15, 0x02, 0x40, 0x10, 0x93, 0x22, 0x53, 0x19, 0x08, 0x62, 0x52, 0x94, 0x06, 0x00, 0x41, 0x4c,
+  0x8a, 0x92, 0x0b, 0x2c, 0x88, 0x49, 0x51, 0x72, 0x07, 0x04, 0x31, 0x29, 0x62, 0x85, 0x80, 0x20,
+  0x26, 0x45, 0x14, 0x00, 0x10, 0xc4, 0xa4, 0x88, 0x16, 0x02, 0x82, 0x98, 0x14, 0x65, 0x00, 0x40,
+  0x10, 0x93, 0xa6, 0x01, 0x00, 0x08, 0x62, 0xd2, 0x34, 0x02, 0x03, 0x41, 0x4c, 0x9a, 0x46, 0x21,
+  0x20, 0x88, 0x49, 0x13, 0x01, 0x00, 0x04, 0x31, 0x69, 0x32, 0x95, 0x81, 0x20, 0x26, 0x4d, 0xac,
+  0x10, 0x10, 0xc4, 0xa4, 0xc9, 0x01, 0x00, 0x82, 0x98, 0x34, 0xb9, 0xc0, 0x40, 0x10, 0x93, 0x26,
+  0x17, 0xdc, 0x09, 0x62, 0xd2, 0xe4, 0x0a, 0x01, 0x41, 0x4c, 0x9a, 0xdc, 0x01, 0x20, 0x88, 0x49,
+  0x93, 0x7b, 0x75, 0x06, 0x31, 0x69, 0x72, 0x14, 0x80, 0x20, 0x26, 0x4d, 0x8e, 0x16, 0x10, 0xc4,
+  0xa4, 0xc9, 0xd1, 0x42, 0x82, 0x98, 0x34, 0x39, 0x9a, 0x46, 0x10, 0x93, 0xa6, 0x57, 0x19, 0x08,
+  0x62, 0xd2, 0xf4, 0xea, 0x04, 0x41, 0x4c, 0x9a, 0x66, 0x01, 0x20, 0x88, 0x49, 0xd3, 0x44, 0x05,
+  0x04, 0x31, 0x69, 0x9a, 0x69, 0x80, 0x20, 0x26, 0x4d, 0x33, 0xb9, 0x13, 0xc4, 0xa4, 0x69, 0x26,
+  0x47, 0x83, 0x98, 0x34, 0xcd, 0x58, 0x67, 0x10, 0x93, 0xa6, 0x49, 0x01, 0x08, 0x62, 0xd2, 0x34,
+  0x69, 0x1a, 0x41, 0x4c, 0x9a, 0x68, 0x21, 0x20, 0x88, 0x49, 0x59, 0x21, 0x00, 0x04, 0x31, 0x29,
+  0x4b, 0x03, 0x80, 0x20, 0x26, 0x7d, 0x8e, 0x02, 0x10, 0xc4, 0xa4, 0x6f, 0xa6, 0x01, 0x82, 0x98,
+  0xf4, 0xd1, 0x34, 0x40, 0x10, 0x93, 0xbe, 0xca, 0x00, 0x08, 0x62, 0xd2, 0x57, 0x27, 0x00, 0x41,
+  0x4c, 0xfa, 0x6c, 0x01, 0x20, 0x88, 0x49, 0x65, 0x01, 0x00, 0x04, 0x31, 0xe9, 0x4c, 0x03, 0x80,
+  0x20, 0x26, 0xa5, 0x05, 0x00, 0x10, 0xc4, 0xa4, 0xb4, 0x10, 0x00, 0x82, 0x98, 0x94, 0x16, 0x77,
+  0x40, 0x10, 0x93, 0xd2, 0x34, 0x00, 0x08, 0x62, 0x52, 0x9a, 0x46, 0x60, 0x41, 0x4c, 0x4a, 0x93,
+  0x3b, 0x20, 0x88, 0x49, 0x69, 0x72, 0x14, 0x04, 0x31, 0x29, 0x4d, 0xaf, 0xce, 0x20, 0x26, 0xa5,
+  0xac, 0x10, 0x10, 0xc4, 0xa4, 0x54, 0xbe, 0x3a, 0x83, 0x98, 0xb4, 0x3a, 0x0a, 0x40, 0x10, 0x93,
+  0x56, 0x59, 0x08, 0x08, 0x62, 0xd2, 0x2a, 0xd3, 0x00, 0x41, 0x4c, 0x5a, 0xa5, 0x3b, 0x20, 0x88,
+  0x49, 0xab, 0x7c, 0x75, 0x06, 0x31, 0x69, 0x06, 0x00, 0x80, 0x20, 0x66, 0x25, 0x00, 0x00, 0x10,
+  0xc4, 0xac, 0x07, 0x15, 0x02, 0x82, 0x98, 0x35, 0x39, 0x0a, 0x40, 0x10, 0xb3, 0x3e, 0x77, 0x00,
+  0x08, 0x62, 0x56, 0x19, 0xdc, 0x01, 0x41, 0xcc, 0x2a, 0x03, 0x05, 0x20, 0x88, 0x59, 0x65, 0x01,
+  0x00, 0x04, 0x31, 0xab, 0x2c, 0x04, 0x80, 0x20, 0x66, 0x95, 0xc9, 0x1d, 0x10, 0xc4, 0xac, 0x33,
+  0x05, 0x06, 0x82, 0x98, 0x19, 0x00, 0x00, 0x40, 0x10, 0x35, 0xc8, 0x40, 0x01, 0x08, 0xa2, 0x16,
+  0x02, 0x00, 0x00, 0x41, 0x54, 0x47, 0x00, 0x00, 0x20, 0x88, 0xea, 0x4e, 0x21, 0x00, 0x04, 0x51,
+  0xdd, 0xa9, 0xac, 0x90, 0x20, 0xaa, 0x3b, 0x75, 0x4e, 0x10, 0x44, 0x75, 0xc9, 0x05, 0x06, 0x82,
+  0xa8, 0x2e, 0xb9, 0x03, 0x40, 0x10, 0xd5, 0x2d, 0x00, 0x00, 0x08, 0xa2, 0x3a, 0x5a, 0x08, 0x00,
+  0x41, 0x54, 0x47, 0x53, 0x60, 0x25, 0x88, 0xea, 0x68, 0x1a, 0x00, 0x04, 0x51, 0x1d, 0x4d, 0x23,
+  0xb0, 0x20, 0xaa, 0xa3, 0x69, 0x50, 0x10, 0x44, 0x75, 0x34, 0x15, 0x02, 0x82, 0xa8, 0x8e, 0x26,
+  0x07, 0x40, 0x10, 0xd5, 0xd1, 0xe4, 0x0e, 0x08, 0xa2, 0x3a, 0x9a, 0x1c, 0x2d, 0x41, 0x54, 0x47,
+  0xd3, 0xab, 0x2c, 0x88, 0xea, 0x28, 0x2b, 0x00, 0x04, 0x51, 0x1d, 0x65, 0x85, 0x80, 0x20, 0xaa,
+  0x4c, 0x23, 0x38, 0x10, 0x44, 0x9d, 0x00, 0x00, 0x00, 0x82, 0xa8, 0x13, 0x15, 0x02, 0x40, 0x10,
+  0x75, 0xce, 0x01, 0x00, 0x08, 0xa2, 0x4e, 0x0a, 0x00, 0x00, 0x41, 0xd4, 0x49, 0x0b, 0x01, 0x20,
+  0x88, 0x3a, 0x69, 0x7a, 0x95, 0x05, 0x51, 0x69, 0x71, 0x07, 0x80, 0x20, 0x72, 0x18, 0x85, 0x00,
+  0x10, 0x44, 0x0e, 0x2c, 0x30, 0x00, 0x82, 0xc8, 0xc1, 0x1d, 0x00, 0x40, 0x10, 0x39, 0xc8, 0xf2,
+  0xea, 0x0c, 0x22, 0x07, 0x59, 0x26, 0x00, 0x41, 0xe4, 0x20, 0xd3, 0x00, 0x20, 0x88, 0x3c, 0x02,
+  0x05, 0x00, 0x04, 0x91, 0x47, 0x71, 0x85, 0x80, 0x20, 0xf2, 0x40, 0x85, 0x00, 0x10, 0x44, 0x36,
+  0xa6, 0x4e, 0x00, 0x82, 0xc8, 0xa6, 0xb2, 0x02, 0x40, 0x10, 0x99, 0x25, 0x17, 0x18, 0x08, 0x22,
+  0x33, 0x96, 0xdc, 0x01, 0x41, 0x64, 0xf6, 0x5a, 0x21, 0x20, 0x88, 0x2c, 0x0b, 0x01, 0x00, 0x04,
+  0x91, 0x67, 0x70, 0x00, 0x80, 0x20, 0xf2, 0x0c, 0xee, 0x00, 0x10, 0x44, 0x9e, 0xc1, 0x51, 0x00,
+  0x82, 0xc8, 0xb3, 0x00, 0x00, 0x40, 0x10, 0x79, 0x16, 0x53, 0x19, 0x08, 0x22, 0xcf, 0x22, 0x03,
+  0x03, 0x41, 0xe4, 0x59, 0x64, 0x01, 0x20, 0x88, 0x3c, 0x11, 0x00, 0x00, 0x04, 0x91, 0x27, 0x2a,
+  0x04, 0x80, 0x20, 0xf2, 0x7c, 0x2d, 0x30, 0x10, 0x44, 0x9e, 0xaf, 0x25, 0x77, 0x82, 0xc8, 0xf3,
+  0xb9, 0x03, 0x40, 0x10, 0x79, 0x3e, 0xf9, 0xea, 0x0c, 0x22, 0xcf, 0x27, 0x33, 0x00, 0x41, 0xe4,
+  0x39, 0x11, 0x05, 0x20, 0x88, 0x3c, 0x67, 0x1a, 0x00, 0x04, 0x91, 0xe7, 0x9c, 0xc9, 0x9d, 0x20,
+  0xf2, 0x9c, 0x34, 0x39, 0x10, 0x44, 0x9e, 0x93, 0x26, 0x47, 0x83, 0xc8, 0x93, 0x02, 0x00, 0x40,
+  0x10, 0x79, 0xd2, 0x42, 0x00, 0x08, 0x22, 0x4f, 0x9a, 0x06, 0x00, 0x41, 0xe4, 0x49, 0xd3, 0x08,
+  0x2c, 0x88, 0x3c, 0x69, 0x2a, 0x04, 0x04, 0x91, 0x27, 0x4d, 0xee, 0x80, 0x20, 0xf2, 0xa4, 0xc9,
+  0x51, 0x10, 0x44, 0x9e, 0x54, 0x16, 0x02, 0xc2, 0x08, 0xa3, 0xb8, 0x03, 0x40, 0x18, 0x61, 0x15,
+  0x59, 0x26, 0x08, 0x23, 0xb0, 0x27, 0x5f, 0x9d, 0x61, 0x84, 0x56, 0x08, 0x00, 0x20, 0x8c, 0xd0,
+  0x12, 0x01, 0x00, 0x84, 0x11, 0x1c, 0x01, 0x00, 0x80, 0x30, 0x82, 0x2b, 0xaf, 0x32, 0x10, 0x46,
+  0x70, 0xb4, 0x10, 0x00, 0xc2, 0x08, 0x8e, 0xa6, 0x01, 0x40, 0x18, 0x01, 0xa2, 0xe4, 0x0e, 0x08,
+  0x23, 0xc8, 0xe4, 0x00, 0x00, 0x61, 0x04, 0x99, 0xdc, 0x01, 0x20, 0x8c, 0x20, 0x93, 0xa3, 0x69,
+  0x84, 0x11, 0xa4, 0x4b, 0x8e, 0x82, 0x30, 0xc2, 0x44, 0x69, 0x00, 0x10, 0x46, 0xa0, 0xa8, 0x10,
+  0x00, 0xc2, 0x08, 0xb6, 0xb8, 0x03, 0x40, 0x18, 0x21, 0x03, 0x00, 0x00, 0x08, 0x63, 0x04, 0x56,
+  0x08, 0x00, 0x61, 0x8c, 0xc0, 0x92, 0x3b, 0x20, 0x8c, 0x11, 0xdc, 0x29, 0x00, 0x84, 0x31, 0x82,
+  0x4b, 0xaf, 0xce, 0x30, 0x46, 0x70, 0xb4, 0x00, 0x10, 0xc6, 0x08, 0x8e, 0x16, 0x02, 0xc2, 0x18,
+  0x81, 0x16, 0x02, 0x40, 0x18, 0xa3, 0x00, 0x00, 0x00, 0x08, 0x63, 0x14, 0x02, 0x00, 0x00, 0x61,
+  0x8c, 0xe2, 0x08, 0x00, 0x20, 0x8c, 0x51, 0xdc, 0x01, 0x00, 0x84, 0x31, 0x8a, 0x3b, 0x85, 0x80,
+  0x30, 0x46, 0x71, 0xc9, 0xd1, 0x12, 0xc6, 0x28, 0x2e, 0xbd, 0x3a, 0xc3, 0x18, 0xc5, 0xd1, 0x42,
+  0x40, 0x18, 0xa3, 0xc8, 0xc0, 0x00, 0x08, 0x63, 0x14, 0x59, 0x00, 0x00, 0x61, 0x8c, 0x22, 0x0b,
+  0x01, 0x20, 0x8c, 0x51, 0x64, 0x72, 0x07, 0x84, 0x31, 0x8a, 0x4c, 0xaf, 0xce, 0x30, 0x46, 0x91,
+  0xaf, 0x32, 0x10, 0xc6, 0x28, 0x93, 0x02, 0x00, 0xc2, 0x18, 0x65, 0xd2, 0xb4, 0x4a, 0x18, 0x03,
+  0xd1, 0xe4, 0x0a, 0x09, 0x63, 0x24, 0x02, 0x00, 0x00, 0x61, 0x8c, 0xe4, 0x00, 0x00, 0x20, 0x8c,
+  0x91, 0x5c, 0x60, 0x00, 0x84, 0x31, 0x92, 0x24, 0x00, 0x80, 0x30, 0x46, 0x9a, 0x85, 0x00, 0x10,
+  0xc6, 0x58, 0xc5, 0x01, 0x00, 0xc2, 0x18, 0x6f, 0x00, 0x00, 0x40, 0x18, 0xe3, 0x31, 0x00, 0x00,
+  0x08, 0x63, 0x3c, 0x96, 0x0a, 0x01, 0x61, 0x8c, 0xd7, 0xd2, 0xab, 0x33, 0x8c, 0xf1, 0x64, 0x70,
+  0x14, 0x84, 0x31, 0x9e, 0x0c, 0xb4, 0x90, 0x30, 0xc6, 0x93, 0x85, 0x00, 0x10, 0xc6, 0x78, 0xb7,
+  0x10, 0x00, 0xc2, 0x18, 0x55, 0x06, 0x59, 0x48, 0x18, 0xa3, 0xca, 0x02, 0x00, 0x08, 0x63, 0x54,
+  0x59, 0x08, 0x00, 0x61, 0x14, 0x00, 0x00, 0x00, 0x20, 0x8c, 0x12, 0x04, 0x2b, 0x04, 0x84, 0x51,
+  0xc2, 0x40, 0x14, 0x80, 0x30, 0x4a, 0x20, 0x00, 0x00, 0x10, 0x46, 0x09, 0xac, 0x10, 0x00, 0xc2,
+  0x28, 0x81, 0x65, 0x00, 0x40, 0x18, 0x25, 0xb4, 0x57, 0x19, 0x08, 0xa3, 0x04, 0x37, 0x00, 0x00,
+  0x61, 0x94, 0xe0, 0x08, 0x00, 0x20, 0x8c, 0x12, 0x1c, 0x49, 0xee, 0x84, 0x51, 0x82, 0x3b, 0x00,
+  0x80, 0x30, 0x4a, 0x70, 0xc9, 0x1d, 0x10, 0x46, 0x09, 0x8e, 0x16, 0x02, 0xc2, 0x28, 0x41, 0x16,
+  0x02, 0x40, 0x18, 0x25, 0xc8, 0x64, 0x0b, 0x09, 0xa3, 0x04, 0xf9, 0x2a, 0x03, 0x61, 0x94, 0x40,
+  0x53, 0x60, 0x20, 0x8c, 0x12, 0xa8, 0x7c, 0x75, 0x86, 0x51, 0x44, 0x60, 0x00, 0x80, 0x30, 0x8a,
+  0x60, 0x85, 0x00, 0x10, 0x46, 0x19, 0x41, 0xbe, 0x3a, 0xc3, 0x28, 0x23, 0x0d, 0x00, 0x40, 0x18,
+  0x65, 0x24, 0x02, 0x00, 0x08, 0xa3, 0x8c, 0xe4, 0x0e, 0x00, 0x61, 0x14, 0x02, 0x00, 0x00, 0x20,
+  0x8c, 0x42, 0xca, 0x4c, 0xee, 0x84, 0x51, 0x0a, 0x00, 0x00, 0x80, 0x30, 0x4a, 0x61, 0x65, 0x02,
+  0x10, 0x46, 0x29, 0xee, 0x00, 0x00, 0xc2, 0x28, 0x45, 0x06, 0x59, 0x48, 0x18, 0xa5, 0xcc, 0x42,
+  0x00, 0x08, 0xa3, 0x18, 0x53, 0xe7, 0x04, 0x61, 0x14, 0x53, 0x59, 0x21, 0x20, 0x8c, 0xc2, 0x08,
+  0x00, 0x00, 0x84, 0x51, 0x18, 0x29, 0x04, 0x80, 0x30, 0x0a, 0x2b, 0x04, 0x00, 0x10, 0x46, 0x61,
+  0xc5, 0x01, 0x00, 0xc2, 0x28, 0xac, 0xb8, 0xe2, 0x4e, 0x18, 0x85, 0x15, 0xf9, 0xea, 0x0c, 0xa3,
+  0xb0, 0x32, 0x29, 0x00, 0x61, 0x14, 0x96, 0x1c, 0x05, 0x20, 0x8c, 0xc2, 0xd2, 0xab, 0x73, 0x86,
+  0x51, 0x18, 0x2b, 0x04, 0x80, 0x30, 0x0a, 0x63, 0x29, 0x38, 0x1a, 0x46, 0x61, 0xaf, 0x15, 0x02,
+  0xc2, 0x28, 0xec, 0xb5, 0xe4, 0x68, 0x18, 0xa5, 0x01, 0x00, 0x00, 0x08, 0xa3, 0x38, 0x00, 0x00,
+  0x00, 0x61, 0x14, 0x47, 0x00, 0x00, 0x20, 0x8c, 0xe2, 0x08, 0x03, 0x00, 0x84, 0x51, 0x5c, 0x71,
+  0x07, 0x80, 0x30, 0x8a, 0x3b, 0x85, 0x00, 0x10, 0x46, 0x71, 0xa7, 0x4c, 0x00, 0xc2, 0x28, 0x2e,
+  0x11, 0x00, 0x40, 0x18, 0xc5, 0x25, 0x77, 0x00, 0x08, 0xa3, 0xb8, 0x34, 0x0b, 0x01, 0x61, 0x14,
+  0xf7, 0x6e, 0x06, 0x20, 0x8c, 0xe2, 0x62, 0x9d, 0x13, 0x84, 0x51, 0x1c, 0x05, 0x00, 0x80, 0x30,
+  0x8a, 0xa3, 0xc1, 0x51, 0x10, 0x46, 0x71, 0xb4, 0x00, 0x00, 0xc2, 0x28, 0x8e, 0x16, 0x02, 0x40,
+  0x18, 0xc5, 0xd1, 0x32, 0x01, 0x08, 0xa3, 0x38, 0x9a, 0x06, 0x00, 0x61, 0x14, 0x47, 0xd3, 0x08,
+  0x2c, 0x8c, 0xe2, 0x68, 0x72, 0x07, 0x84, 0x51, 0x1c, 0x4d, 0x8e, 0x82, 0x30, 0x8a, 0xa3, 0xe9,
+  0xd5, 0x19, 0x46, 0x71, 0x94, 0x01, 0x00, 0xc2, 0x28, 0x8e, 0xb2, 0x42, 0x40, 0x18, 0xc5, 0xd1,
+  0x0c, 0x00, 0x08, 0xa3, 0xc0, 0x34, 0x82, 0x03, 0x61, 0x14, 0x98, 0xdc, 0x01, 0x20, 0x8c, 0x02,
+  0x93, 0xa3, 0x85, 0x84, 0x51, 0x60, 0x9a, 0xc9, 0x9d, 0x30, 0x0a, 0x7c, 0x0d, 0x00, 0x10, 0x46,
+  0x81, 0xaf, 0x15, 0x02, 0xc2, 0x28, 0xf0, 0xb9, 0x42, 0x40, 0x18, 0x05, 0xbe, 0xfa, 0xea, 0x0c,
+  0xa3, 0xc0, 0x57, 0xe7, 0x9c, 0x61, 0x14, 0x19, 0x06, 0x00, 0x20, 0x8c, 0x22, 0xc3, 0x08, 0x0c,
+  0x84, 0x51, 0x64, 0x70, 0x81, 0x81, 0x30, 0x8a, 0x0c, 0xb2, 0x10, 0x10, 0x46, 0x91, 0x41, 0xae,
+  0x42, 0xc2, 0x28, 0x32, 0x50, 0x00, 0x40, 0x18, 0x45, 0x0a, 0x56, 0x08, 0x08, 0xa3, 0xc8, 0x02,
+  0x00, 0x00, 0x61, 0x14, 0x59, 0x08, 0x00, 0x20, 0x8c, 0x22, 0x0b, 0x49, 0x0e, 0x84, 0x51, 0x64,
+  0x71, 0x00, 0x80, 0x30, 0x8a, 0x2c, 0xee, 0x00, 0x10, 0x46, 0x91, 0xc5, 0x51, 0x00, 0xc2, 0x28,
+  0xb2, 0x38, 0x5a, 0x48, 0x18, 0x45, 0x16, 0x19, 0x18, 0x08, 0xa3, 0xc8, 0x22, 0x93, 0x3b, 0x61,
+  0x14, 0x59, 0xe4, 0xab, 0x33, 0x8c, 0x22, 0xcb, 0x44, 0x85, 0x84, 0x51, 0x64, 0x1a, 0x00, 0x80,
+  0x30, 0x8a, 0x4c, 0x23, 0x30, 0x10, 0x46, 0x91, 0x89, 0x00, 0x00, 0xc2, 0x28, 0x32, 0xb1, 0x42,
+  0x40, 0x18, 0x45, 0x26, 0x17, 0x18, 0x08, 0xa3, 0xc8, 0xe4, 0x0e, 0x00, 0x61, 0x14, 0xf9, 0x64,
+  0x60, 0x20, 0x8c, 0x22, 0x9f, 0x7c, 0x75, 0x86, 0x51, 0xe4, 0x93, 0x19, 0x80, 0x30, 0x8a, 0xa4,
+  0x85, 0x00, 0x10, 0x46, 0x99, 0xc8, 0xd4, 0x09, 0xc2, 0x28, 0x13, 0x51, 0x00, 0x40, 0x18, 0x65,
+  0x26, 0x77, 0x00, 0x08, 0xa3, 0xcc, 0xd7, 0xca, 0x04, 0x61, 0x94, 0xf9, 0x64, 0x01, 0x20, 0x8c,
+  0x32, 0xdf, 0x2d, 0x04, 0x84, 0x51, 0x26, 0x2d, 0x04, 0x80, 0x30, 0xca, 0xa4, 0x69, 0x00, 0x10,
+  0x46, 0x99, 0x34, 0xbd, 0x3a, 0xc3, 0x28, 0xb4, 0x10, 0x00, 0x40, 0x18, 0x85, 0xa2, 0x42, 0x00,
+  0x08, 0xa3, 0xd0, 0x34, 0x02, 0x03, 0x61, 0x14, 0x9a, 0xdc, 0x01, 0x20, 0x0c, 0x54, 0x08, 0x00,
+  0x00, 0x84, 0x81, 0x0a, 0x4b, 0x04, 0x80, 0x30, 0x50, 0x71, 0xc9, 0x1d, 0x10, 0x06, 0x2a, 0x33,
+  0xb9, 0x03, 0xc2, 0x40, 0xcf, 0x01, 0x00, 0x40, 0x18, 0x6f, 0x14, 0x77, 0x00, 0x08, 0xe3, 0xb1,
+  0xe2, 0x00, 0x00, 0x61, 0xbc, 0x06, 0x00, 0x00, 0x20, 0x8c, 0xd7, 0x8a, 0xa3, 0x00, 0x84, 0xf1,
+  0x5a, 0x72, 0x34, 0x8d, 0x30, 0x5e, 0x4b, 0x93, 0xa6, 0x11, 0xc6, 0x73, 0xc9, 0x01, 0x00, 0xc2,
+  0x78, 0x8e, 0xa6, 0x57, 0x67, 0x18, 0x4f, 0x16, 0x19, 0x18, 0x08, 0xe3, 0xc9, 0x34, 0x00, 0x00,
+  0x61, 0x3c, 0x99, 0xdc, 0x01, 0x20, 0x8c, 0x47, 0x0b, 0x01, 0x00, 0x84, 0xf1, 0x68, 0x12, 0x0c,
+  0x80, 0x30, 0x1e, 0xad, 0xb2, 0x10, 0x10, 0xc6, 0xb3, 0x05, 0x00, 0x00, 0xc2, 0x88, 0xd5, 0x25,
+  0x77, 0x40, 0x18, 0xb1, 0x3a, 0x5a, 0x1c, 0x0d, 0x23, 0x56, 0x49, 0x00, 0x00, 0x61, 0xc4, 0x2a,
+  0x0b, 0x01, 0x20, 0x8c, 0x58, 0x65, 0x1a, 0x00, 0x84, 0x11, 0x2b, 0x2e, 0x04, 0x80, 0x30, 0x64,
+  0x68, 0xaf, 0x32, 0x10, 0x86, 0x64, 0xc5, 0xd1, 0x34, 0xc2, 0x90, 0xb4, 0x4c, 0x0a, 0x40, 0x18,
+  0x13, 0x15, 0x77, 0x00, 0x08, 0x63, 0xd2, 0xe4, 0x0e, 0x00, 0x61, 0xd0, 0xe0, 0x68, 0x72, 0x27,
+  0x0c, 0x1a, 0x64, 0x70, 0xb4, 0x84, 0x41, 0x83, 0x4c, 0xee, 0x80, 0x30, 0x68, 0x21, 0x00, 0x00,
+  0x10, 0x06, 0x2d, 0x8e, 0x00, 0x00, 0xc2, 0xa0, 0x45, 0xa6, 0x01, 0x40, 0x18, 0x14, 0x15, 0x00,
+  0x00, 0x08, 0x83, 0xa2, 0x22, 0x0b, 0x01, 0x61, 0x50, 0x94, 0x46, 0x21, 0x20, 0x0c, 0x8a, 0x12,
+  0x01, 0x00, 0x84, 0x41, 0x51, 0x62, 0x85, 0x80, 0x30, 0x28, 0x4a, 0x8e, 0xa6, 0x11, 0x06, 0x45,
+  0xcf, 0x1d, 0x00, 0xc2, 0xa0, 0x88, 0xa6, 0x01, 0x40, 0x18, 0x34, 0x8d, 0xe4, 0x0e, 0x08, 0x83,
+  0xbe, 0x58, 0xe7, 0x9c, 0x81, 0x04, 0xc1, 0xd2, 0xab, 0x33, 0x90, 0x30, 0x82, 0x3b, 0x00, 0x04,
+  0x12, 0x46, 0x70, 0x34, 0x8d, 0x40, 0xc2, 0x28, 0x00, 0x00, 0x10, 0x48, 0x18, 0xc5, 0x1d, 0x00,
+  0x02, 0x09, 0x03, 0x25, 0x77, 0x40, 0x20, 0x61, 0xd0, 0x42, 0x00, 0x08, 0x24, 0x8c, 0x2a, 0x5f,
+  0x9d, 0x81, 0x04, 0x02, 0x00, 0x00, 0x20, 0x90, 0x40, 0x8a, 0x3b, 0x00, 0x04, 0x12, 0x48, 0x22,
+  0x00, 0x80, 0x40, 0x02, 0x49, 0xb3, 0x10, 0x10, 0x48, 0x30, 0x55, 0x16, 0x02, 0x02, 0x09, 0x07,
+  0x00, 0x00, 0x40, 0x20, 0xe1, 0x14, 0x00, 0x00, 0x08, 0x24, 0x9c, 0x42, 0x00, 0x00, 0x81, 0x84,
+  0x53, 0xdc, 0x01, 0x20, 0x90, 0x70, 0x8a, 0xa3, 0x69, 0x04, 0x12, 0x0e, 0x2a, 0x04, 0x80, 0x40,
+  0xc2, 0x49, 0x03, 0x00, 0x10, 0x48, 0x38, 0xc9, 0x16, 0x02, 0x02, 0x09, 0xe7, 0xcd, 0xe4, 0x4e,
+  0x20, 0xe1, 0x54, 0x56, 0x08, 0x08, 0x24, 0x9c, 0x2a, 0x93, 0x3b, 0x81, 0x84, 0x34, 0x82, 0x4b,
+  0x23, 0x90, 0x90, 0xec, 0x93, 0x05, 0x04, 0x12, 0x56, 0x21, 0x00, 0x80, 0x40, 0xc2, 0x2a, 0x8e,
+  0x02, 0x10, 0x48, 0x60, 0xa4, 0x10, 0x00, 0x02, 0x09, 0x8c, 0xb0, 0x02, 0x40, 0x20, 0x81, 0x15,
+  0x00, 0x00, 0x08, 0x24, 0xb0, 0x42, 0x00, 0x00, 0x81, 0x04, 0x56, 0xdc, 0x01, 0x20, 0x90, 0xc0,
+  0x8a, 0xa3, 0x69, 0x04, 0x12, 0x58, 0x72, 0x14, 0x80, 0x40, 0x02, 0x4b, 0x33, 0x0d, 0x10, 0x48,
+  0x60, 0x0c, 0x00, 0x00, 0x02, 0x09, 0x8c, 0x05, 0x56, 0x48, 0x20, 0x81, 0xb1, 0x42, 0x00, 0x08,
+  0x24, 0xb0, 0xe7, 0x0e, 0x00, 0x81, 0x84, 0x16, 0x58, 0x1a, 0x20, 0x90, 0xd0, 0x82, 0x3b, 0x00,
+  0x04, 0x12, 0x5a, 0x70, 0x14, 0x80, 0x40, 0x42, 0x0b, 0x32, 0x0d, 0x10, 0x48, 0x68, 0x81, 0x4a,
+  0x02, 0x02, 0x09, 0xad, 0x10, 0x00, 0x40, 0x20, 0xa1, 0x15, 0x53, 0x19, 0x08, 0x24, 0xb4, 0x34,
+  0x00, 0x00, 0x81, 0x84, 0x96, 0x26, 0x05, 0x20, 0x90, 0xd0, 0x9e, 0x2c, 0x04, 0x04, 0x12, 0x1a,
+  0xa4, 0x85, 0x80, 0x40, 0x82, 0x1b, 0x69, 0x00, 0x10, 0x48, 0x70, 0x23, 0x39, 0x0a, 0x02, 0x09,
+  0x8e, 0x00, 0x00, 0x40, 0x20, 0xc1, 0x11, 0x96, 0x1c, 0x08, 0x24, 0xb8, 0x83, 0x0a, 0x01, 0x81,
+  0x04, 0x97, 0xc6, 0x2a, 0x24, 0x90, 0xe0, 0x12, 0x01, 0x00, 0x04, 0x12, 0x5c, 0x72, 0x07, 0x80,
+  0x40, 0x82, 0x4b, 0x2e, 0x05, 0x16, 0x48, 0x70, 0xc9, 0xd1, 0x42, 0x02, 0x09, 0xee, 0xc9, 0xe4,
+  0x4e, 0x20, 0xc1, 0x51, 0x00, 0x00, 0x08, 0x24, 0x38, 0x5a, 0x00, 0x00, 0x81, 0x04, 0x47, 0x0b,
+  0x01, 0x20, 0x90, 0xe0, 0x68, 0x0a, 0x0c, 0x04, 0x12, 0x1c, 0x4d, 0x03, 0x80, 0x40, 0x82, 0xa3,
+  0xc9, 0x01, 0x10, 0x48, 0x70, 0x34, 0xb9, 0x03, 0x02, 0x09, 0x8e, 0xa6, 0x57, 0x67, 0x20, 0xc1,
+  0x51, 0x06, 0x00, 0x08, 0x24, 0x38, 0xca, 0x0a, 0x01, 0x81, 0x04, 0x58, 0xdc, 0x01, 0x20, 0x90,
+  0x00, 0x8b, 0x2c, 0x04, 0x04, 0x12, 0x24, 0x00, 0x00, 0x80, 0x40, 0x82, 0x0c, 0x23, 0x30, 0x10,
+  0x48, 0x90, 0x81, 0x15, 0x02, 0x02, 0x09, 0x32, 0xb8, 0x03, 0x40, 0x20, 0x41, 0x06, 0x47, 0x01,
+  0x08, 0x24, 0xc8, 0x20, 0x5f, 0x9d, 0x81, 0x04, 0x19, 0x66, 0x72, 0x27, 0x90, 0x20, 0xc3, 0xa4,
+  0x05, 0x04, 0x12, 0x64, 0xa0, 0x00, 0x80, 0x40, 0x82, 0x0c, 0x34, 0x39, 0x10, 0x48, 0x90, 0x81,
+  0x26, 0x77, 0x02, 0x09, 0x52, 0xb0, 0x42, 0x40, 0x20, 0x41, 0x16, 0x00, 0x00, 0x08, 0x24, 0xc8,
+  0x42, 0x00, 0x00, 0x81, 0x04, 0x59, 0x4c, 0x9d, 0x33, 0x90, 0x20, 0x8b, 0x03, 0x00, 0x04, 0x12,
+  0x64, 0x71, 0xc1, 0x9d, 0x40, 0x82, 0x2c, 0xae, 0x10, 0x10, 0x48, 0x90, 0xc5, 0x1d, 0x00, 0x02,
+  0x09, 0xb2, 0x38, 0x5a, 0x40, 0x20, 0x41, 0x16, 0x47, 0xd3, 0x08, 0x24, 0xc8, 0x22, 0x03, 0x03,
+  0x81, 0x04, 0x59, 0x64, 0x01, 0x20, 0x90, 0x20, 0x8b, 0x2c, 0x04, 0x04, 0x12, 0x64, 0x91, 0x65,
+  0x82, 0x40, 0x82, 0x2c, 0x32, 0x0d, 0x10, 0x48, 0x90, 0x65, 0x26, 0x47, 0x03, 0x09, 0xb2, 0x4c,
+  0x9a, 0x46, 0x20, 0x41, 0xa6, 0x01, 0x00, 0x08, 0x24, 0xc8, 0x34, 0x02, 0x03, 0x81, 0x04, 0x99,
+  0x46, 0x70, 0x34, 0x90, 0x20, 0x13, 0x01, 0x00, 0x04, 0x12, 0x64, 0x32, 0x95, 0x81, 0x40, 0x82,
+  0x4c, 0xac, 0x10, 0x10, 0x48, 0x90, 0xc9, 0x01, 0x00, 0x02, 0x09, 0x32, 0xb9, 0xe0, 0x68, 0x20,
+  0x41, 0x26, 0x17, 0x24, 0x08, 0x24, 0xc8, 0xe4, 0x0e, 0x00, 0x81, 0x04, 0x99, 0x1c, 0x2d, 0x24,
+  0x90, 0x20, 0x93, 0xa3, 0x69, 0x04, 0x12, 0x64, 0x7a, 0x75, 0x82, 0x40, 0x82, 0x4c, 0xb3, 0x10,
+  0x10, 0x48, 0x90, 0x69, 0xa2, 0x42, 0x02, 0x09, 0x32, 0xcd, 0x54, 0x48, 0x20, 0x41, 0xa6, 0x49,
+  0x01, 0x08, 0x24, 0x48, 0x47, 0x00, 0x00, 0x81, 0x04, 0xe9, 0x0e, 0x00, 0x20, 0x90, 0x20, 0x1d,
+  0xa5, 0x85, 0x04, 0x12, 0xe4, 0x6b, 0xc5, 0x9d, 0x40, 0x82, 0x7c, 0x2e, 0x30, 0x10, 0x48, 0x90,
+  0x4f, 0x06, 0x06, 0x02, 0x09, 0xf2, 0xc9, 0x0c, 0x40, 0x20, 0x41, 0xbe, 0xca, 0x0a, 0x08, 0x24,
+  0xc8, 0x57, 0x59, 0x21, 0x81, 0x04, 0x49, 0x0b, 0x01, 0x20, 0x90, 0x20, 0x69, 0x1a, 0x00, 0x04,
+  0x12, 0x24, 0x4d, 0xa6, 0xce, 0x40, 0x82, 0xa4, 0xc9, 0x1d, 0x10, 0x48, 0x98, 0x81, 0x15, 0x02,
+  0x02, 0x09, 0x33, 0x38, 0x0a, 0x40, 0x20, 0x61, 0x06, 0x47, 0x0b, 0x09, 0x24, 0xcc, 0x02, 0x00,
+  0x00, 0x81, 0x84, 0x59, 0x08, 0x00, 0x20, 0x90, 0x30, 0x51, 0x21, 0x00, 0x04, 0x12, 0x26, 0x32,
+  0x95, 0x81, 0x40, 0xc2, 0x44, 0xe9, 0xd5, 0x19, 0x48, 0x98, 0x89, 0x00, 0x00, 0x02, 0x09, 0x33,
+  0x39, 0x5a, 0x48, 0x20, 0x61, 0xa6, 0x99, 0xdc, 0x09, 0x24, 0xcc, 0x55, 0xe6, 0x04, 0x81, 0x84,
+  0xf9, 0x68, 0x21, 0x20, 0x90, 0x30, 0x1f, 0x4d, 0xee, 0x04, 0x12, 0xe6, 0xbb, 0x19, 0x80, 0x40,
+  0xc2, 0x9c, 0x69, 0x00, 0x10, 0x48, 0x98, 0x33, 0x0d, 0x5a, 0x02, 0x09, 0x73, 0x26, 0x77, 0x40,
+  0x20, 0x61, 0x4e, 0x0a, 0x00, 0x08, 0x24, 0xcc, 0x49, 0x0b, 0x01, 0x81, 0x84, 0x39, 0x69, 0x1a,
+  0x20, 0x90, 0x30, 0x67, 0x06, 0x00, 0x04, 0x12, 0x26, 0x05, 0x00, 0x80, 0x40, 0xc2, 0xa4, 0x81,
+  0x01, 0x10, 0x48, 0x98, 0xb4, 0x10, 0x00, 0x02, 0x09, 0x93, 0x16, 0x52, 0x40, 0x20, 0x61, 0xd2,
+  0x14, 0xdc, 0x09, 0x24, 0x4c, 0x9a, 0x06, 0x00, 0x81, 0x84, 0x49, 0x93, 0x03, 0x20, 0x90, 0x30,
+  0x69, 0x72, 0x07, 0x04, 0x12, 0x26, 0x4d, 0x2e, 0x8d, 0x40, 0xc2, 0xa4, 0xac, 0x10, 0x10, 0x48,
+  0xa0, 0x00, 0x00, 0x00, 0x02, 0x09, 0xb4, 0x00, 0x00, 0x40, 0x20, 0x81, 0x16, 0x02, 0x00, 0x08,
+  0x24, 0xd0, 0xe2, 0x00, 0x00, 0x81, 0x04, 0x5a, 0xdc, 0x01, 0x20, 0x90, 0x40, 0x8b, 0xa3, 0x00,
+  0x04, 0x12, 0x68, 0x71, 0xb4, 0x80, 0x40, 0x02, 0x2d, 0xb2, 0x10, 0x10, 0x48, 0xa0, 0x45, 0x26,
+  0x47, 0x03, 0x09, 0xb4, 0xc8, 0x57, 0x67, 0x20, 0x81, 0x96, 0x49, 0x0b, 0x09, 0x24, 0x50, 0x04,
+  0x00, 0x00, 0x81, 0x04, 0x8a, 0x0a, 0x00, 0x20, 0x90, 0x40, 0x51, 0x21, 0x00, 0x04, 0x12, 0x28,
+  0x2a, 0x73, 0x82, 0x40, 0x02, 0x45, 0x69, 0x00, 0x10, 0x48, 0xa0, 0x28, 0xb9, 0x03, 0x02, 0x09,
+  0x14, 0xb1, 0x34, 0x40, 0x20, 0x81, 0xa6, 0x01, 0x00, 0x08, 0x24, 0xd0, 0x34, 0x92, 0xa3, 0x81,
+  0x04, 0x9a, 0x08, 0x00, 0x20, 0x90, 0x40, 0x93, 0x03, 0x00, 0x04, 0x12, 0x68, 0x72, 0x85, 0x80,
+  0x40, 0x02, 0x4d, 0x8e, 0x02, 0x10, 0x48, 0xa0, 0xc9, 0xd1, 0x02, 0x02, 0x09, 0x34, 0xbd, 0xca,
+  0x40, 0x20, 0x81, 0xa6, 0x99, 0x02, 0x0b, 0x24, 0xd0, 0x34, 0x29, 0x00, 0x81, 0x04, 0x9a, 0x26,
+  0x4d, 0x23, 0x90, 0x40, 0x1f, 0x4d, 0x8e, 0x06, 0x12, 0x28, 0x05, 0x00, 0x80, 0x40, 0x02, 0xa5,
+  0xc9, 0x1d, 0x10, 0x48, 0xa0, 0x34, 0xbd, 0x3a, 0x03, 0x09, 0x94, 0x32, 0x00, 0x40, 0x20, 0x81,
+  0x52, 0xf9, 0xea, 0x0c, 0x24, 0x54, 0x02, 0x00, 0x00, 0x81, 0x84, 0x9a, 0x06, 0x00, 0x20, 0x90,
+  0x50, 0x1d, 0x4d, 0x85, 0x04, 0x12, 0xaa, 0x2c, 0x00, 0x80, 0x40, 0x42, 0x95, 0x85, 0x00, 0x10,
+  0x48, 0xb0, 0x05, 0x00, 0x00, 0x02, 0x09, 0xb6, 0x10, 0x00, 0x40, 0x20, 0xc1, 0x16, 0x07, 0x00,
+  0x08, 0x24, 0xd8, 0xe2, 0x02, 0x03, 0x81, 0x04, 0x5b, 0x5c, 0x70, 0x27, 0x90, 0x60, 0x8b, 0x3b,
+  0x00, 0x04, 0x12, 0x6c, 0x91, 0xc9, 0x9d, 0x40, 0x82, 0x2d, 0x93, 0x16, 0x12, 0x48, 0xc8, 0x00,
+  0x00, 0x00, 0x02, 0x09, 0x3a, 0x4d, 0x0a, 0x40, 0x20, 0x41, 0xb3, 0xe4, 0x0e, 0x08, 0xa4, 0x00,
+  0x00, 0x00, 0x00, 0x81, 0x94, 0x20, 0x58, 0x71, 0x27, 0x90, 0x12, 0x46, 0x06, 0x00, 0x04, 0x52,
+  0x02, 0x4b, 0x8e, 0x82, 0x40, 0x4a, 0x90, 0x85, 0x00, 0x10, 0x48, 0x21, 0x69, 0x52, 0x00, 0x02,
+  0x29, 0x8c, 0x00, 0x00, 0x40, 0x20, 0x85, 0x25, 0x56, 0x08, 0x08, 0xa4, 0xb8, 0xc0, 0x0a, 0x01,
+  0x81, 0x14, 0x47, 0x00, 0x00, 0x20, 0x90, 0xe2, 0x4e, 0x01, 0x00, 0x04, 0x52, 0xdc, 0x29, 0x04,
+  0x80, 0x40, 0x8a, 0x4b, 0x36, 0xb9, 0x13, 0x48, 0x71, 0x14, 0x00, 0x00, 0x02, 0x29, 0x8e, 0x16,
+  0x02, 0x40, 0x20, 0xc5, 0xd1, 0x34, 0x00, 0x08, 0xa4, 0x38, 0x9a, 0x01, 0x00, 0x81, 0x14, 0x98,
+  0x26, 0x2a, 0x20, 0x90, 0x22, 0x83, 0x2b, 0x04, 0x04, 0x52, 0xa4, 0x60, 0x85, 0x80, 0x40, 0x8a,
+  0x2c, 0x00, 0x00, 0x10, 0x48, 0x91, 0x65, 0xd2, 0x34, 0x02, 0x29, 0x32, 0x4d, 0x5a, 0x48, 0x20,
+  0x45, 0xbe, 0x56, 0x08, 0x08, 0xa4, 0xc8, 0x27, 0x0b, 0x01, 0x81, 0x94, 0x19, 0x1c, 0x00, 0x20,
+  0x90, 0x32, 0x8b, 0x3b, 0x00, 0x04, 0x52, 0xe6, 0xa4, 0xc9, 0xd1, 0x40, 0x52, 0x0b, 0x34, 0xb9,
+  0x13, 0x48, 0x9a, 0xb3, 0x10, 0x00, 0x02, 0x49, 0x93, 0x26, 0x77, 0x40, 0x20, 0x2d, 0x08, 0x56,
+  0x1c, 0x0d, 0xa4, 0x85, 0x91, 0xdc, 0x01, 0x81, 0xb4, 0xc0, 0x92, 0x3b, 0x20, 0x90, 0x16, 0x58,
+  0x72, 0x14, 0x04, 0xd2, 0x82, 0x23, 0x00, 0x80, 0x40, 0x5a, 0x70, 0x24, 0xb9, 0x13, 0x48, 0x0b,
+  0xae, 0x98, 0x3a, 0x03, 0x69, 0xc1, 0x1d, 0x00, 0x40, 0x20, 0x2d, 0xb8, 0x53, 0x08, 0x08, 0xa4,
+  0x05, 0x37, 0x51, 0x21, 0x81, 0xb4, 0x20, 0x49, 0x72, 0x27, 0x90, 0x16, 0x64, 0x21, 0x00, 0x04,
+  0xd2, 0x02, 0x4d, 0x0e, 0x80, 0x40, 0x9a, 0x08, 0xee, 0x00, 0x10, 0x48, 0x13, 0xc9, 0x15, 0x02,
+  0x02, 0x69, 0x22, 0xb9, 0x03, 0x40, 0x20, 0x4d, 0xa4, 0xe7, 0xd2, 0x08, 0xa4, 0x09, 0x96, 0x06,
+  0x00, 0x81, 0x34, 0xc1, 0x92, 0x3b, 0x20, 0x90, 0x26, 0x58, 0x06, 0x00, 0x04, 0xd2, 0xc4, 0x6b,
+  0x85, 0x80, 0x40, 0x9a, 0xa8, 0xb2, 0x10, 0x10, 0x48, 0x2b, 0x00, 0x00, 0x00, 0x02, 0x69, 0xc5,
+  0x11, 0x00, 0x40, 0x20, 0xad, 0xb8, 0x03, 0x00, 0x08, 0xa4, 0x15, 0x97, 0x1c, 0x05, 0x81, 0xb4,
+  0xe2, 0x68, 0x0a, 0x2c, 0x90, 0x56, 0x64, 0xa0, 0x00, 0x04, 0xd2, 0x8a, 0x2c, 0x04, 0x80, 0x40,
+  0x5a, 0x91, 0xc9, 0x1d, 0x10, 0x48, 0x4b, 0x61, 0xa2, 0x42, 0x02, 0x69, 0x29, 0xd0, 0xe4, 0x68,
+  0x20, 0x2d, 0x09, 0x56, 0x08, 0x08, 0xa4, 0xa5, 0x11, 0x18, 0x00, 0x81, 0xb4, 0x34, 0x82, 0x2c,
+  0x24, 0x90, 0x96, 0x06, 0xa2, 0x69, 0x04, 0xd2, 0xd2, 0x48, 0xee, 0x80, 0x40, 0x5a, 0x1a, 0xe9,
+  0xd5, 0x12, 0x48, 0x4b, 0x83, 0x02, 0x00, 0x02, 0x69, 0x89, 0x00, 0x00, 0x40, 0x20, 0x2d, 0x15,
+  0x77, 0x00, 0x08, 0xa4, 0xa5, 0x53, 0x08, 0x00, 0x81, 0xb4, 0xc4, 0x0a, 0x01, 0x20, 0x90, 0x96,
+  0x5c, 0x60, 0x00, 0x04, 0xd2, 0x92, 0x1b, 0x00, 0x80, 0x40, 0x5a, 0x72, 0x04, 0x00, 0x10, 0x48,
+  0x4b, 0xae, 0x10, 0x00, 0x02, 0x69, 0xc9, 0x1d, 0x00, 0x40, 0x20, 0x2d, 0xb9, 0xe4, 0x00, 0x08,
+  0xa4, 0x25, 0x97, 0xdc, 0x01, 0x81, 0xb4, 0xe4, 0x92, 0xa3, 0x20, 0x90, 0x96, 0x5c, 0x7a, 0x75,
+  0x06, 0xd2, 0x92, 0xa3, 0x85, 0x80, 0x40, 0x5a, 0x72, 0x34, 0x39, 0x10, 0x48, 0x4b, 0x8e, 0x26,
+  0x77, 0x02, 0x69, 0xe9, 0xd5, 0x57, 0x67, 0x20, 0x2d, 0xbd, 0x3a, 0x01, 0x08, 0xa4, 0x25, 0x59,
+  0x08, 0x00, 0x81, 0xb4, 0x24, 0xd3, 0xab, 0x33, 0x90, 0x96, 0x66, 0x21, 0x00, 0x04, 0xd2, 0xd2,
+  0x4c, 0x03, 0x80, 0x40, 0x5a, 0x9a, 0xc9, 0x51, 0x10, 0x48, 0x4b, 0x33, 0xbd, 0x3a, 0x03, 0x69,
+  0x69, 0xd2, 0x42, 0x40, 0x20, 0x2d, 0xd1, 0x34, 0x02, 0x0b, 0xa4, 0x25, 0xca, 0x0a, 0x01, 0x81,
+  0xb4, 0x96, 0x5c, 0x72, 0x27, 0x90, 0xf6, 0x1c, 0xcd, 0x00, 0x04, 0xd2, 0x9e, 0x24, 0x00, 0x80,
+  0x40, 0xda, 0x93, 0x85, 0x00, 0x10, 0x48, 0x7b, 0x32, 0x39, 0x0a, 0x02, 0x69, 0x6f, 0x0e, 0x00,
+  0x40, 0x20, 0x0d, 0x16, 0x02, 0x00, 0x08, 0xa4, 0xc1, 0xe2, 0x02, 0x03, 0x81, 0x34, 0x58, 0xdc,
+  0x01, 0x20, 0x90, 0x06, 0x8b, 0xa3, 0x85, 0x04, 0xd2, 0x60, 0x91, 0xaf, 0xce, 0x40, 0x1a, 0x2c,
+  0x33, 0x39, 0x1a, 0x48, 0x83, 0x08, 0x00, 0x00, 0x02, 0x69, 0x10, 0x15, 0x00, 0x40, 0x20, 0x0d,
+  0xa2, 0x22, 0x33, 0x08, 0xa4, 0x41, 0x64, 0x2a, 0x03, 0x81, 0x34, 0x98, 0x08, 0x00, 0x20, 0x90,
+  0x06, 0x93, 0xa9, 0x13, 0x04, 0xd2, 0x60, 0x72, 0xc5, 0x9d, 0x40, 0x1a, 0x4c, 0xee, 0x00, 0x10,
+  0x48, 0x83, 0xc9, 0x51, 0x00, 0x02, 0x69, 0x30, 0xd1, 0x42, 0x40, 0x20, 0x0d, 0xbe, 0x96, 0xdc,
+  0x09, 0xa4, 0xc1, 0xd7, 0x92, 0xa3, 0x81, 0x34, 0xf8, 0x64, 0x72, 0x34, 0x90, 0x06, 0x5f, 0x95,
+  0x85, 0x04, 0xd2, 0x20, 0x2d, 0x04, 0x80, 0x40, 0x1a, 0xa4, 0xa9, 0x10, 0x10, 0x48, 0x83, 0x34,
+  0xb9, 0x03, 0x02, 0x69, 0x30, 0x03, 0x00, 0x40, 0x20, 0xad, 0xca, 0xc0, 0x00, 0x08, 0xe4, 0x05,
+  0x47, 0x00, 0x00, 0x81, 0x3c, 0x52, 0x26, 0x05, 0x20, 0x90, 0x47, 0xd2, 0x4c, 0xee, 0x04, 0xf2,
+  0x18, 0x4d, 0xee, 0x80, 0x40, 0x5e, 0x0b, 0xae, 0x10, 0x10, 0xc8, 0x6b, 0x89, 0x26, 0x77, 0x02,
+  0x79, 0x8e, 0xa6, 0x01, 0x40, 0x20, 0xcf, 0xd1, 0x34, 0x0a, 0x09, 0xe4, 0xbd, 0x5b, 0x08, 0x00,
+  0x81, 0x3c, 0x19, 0x1c, 0x00, 0x20, 0x90, 0x27, 0x83, 0x0b, 0xee, 0x04, 0xf2, 0x64, 0x71, 0x34,
+  0x8d, 0x40, 0x9e, 0x2c, 0x93, 0x16, 0x10, 0xc8, 0x93, 0xc9, 0x1d, 0x00, 0x02, 0x79, 0x32, 0xcd,
+  0xe4, 0x4e, 0x20, 0x4f, 0x3e, 0x0a, 0x00, 0x08, 0xe4, 0xd1, 0x40, 0x69, 0x1a, 0x81, 0x3c, 0x9a,
+  0xdc, 0x01, 0x20, 0x90, 0x47, 0xd3, 0x2c, 0x04, 0x04, 0xf2, 0x68, 0x9a, 0xa9, 0x90, 0x40, 0x5e,
+  0x25, 0x00, 0x00, 0x10, 0xc8, 0xab, 0xac, 0x10, 0x00, 0x02, 0x79, 0xd5, 0x25, 0x77, 0x40, 0x20,
+  0xaf, 0xca, 0x40, 0xd3, 0x08, 0xe4, 0x55, 0x59, 0x08, 0x00, 0x81, 0xbc, 0x2a, 0x4d, 0x9d, 0x33,
+  0x90, 0x77, 0x0b, 0x00, 0x00, 0x04, 0xf2, 0xae, 0x23, 0x00, 0x80, 0x40, 0x64, 0x70, 0x69, 0x04,
+  0x16, 0x88, 0x2c, 0x04, 0x00, 0x00, 0x02, 0x91, 0xc5, 0x1d, 0x00, 0x40, 0x20, 0xb2, 0xb8, 0xe4,
+  0x28, 0x08, 0x44, 0xa6, 0x91, 0x06, 0x00, 0x81, 0xc8, 0x74, 0xd2, 0xab, 0x33, 0x10, 0x99, 0x5c,
+  0x0a, 0x0c, 0x04, 0x22, 0xd3, 0x4c, 0x04, 0x80, 0x40, 0xe4, 0x63, 0x69, 0x00, 0x10, 0x88, 0x7c,
+  0x72, 0x26, 0x47, 0x03, 0x91, 0x34, 0xb9, 0x03, 0x40, 0x20, 0xb5, 0x38, 0x0a, 0x00, 0x08, 0xa4,
+  0xb2, 0xe2, 0x0e, 0x00, 0x81, 0xd4, 0x16, 0x28, 0x00, 0x20, 0x90, 0xea, 0x08, 0x00, 0x00, 0x04,
+  0x52, 0x1d, 0x49, 0x23, 0xb0, 0x40, 0xaa, 0xa3, 0x85, 0x00, 0x10, 0x48, 0x75, 0x34, 0xb9, 0x03,
+  0x02, 0xa9, 0x33, 0x38, 0x0a, 0x40, 0x20, 0x75, 0xd2, 0xe4, 0x68, 0x09, 0xc4, 0x16, 0x00, 0x00,
+  0x00, 0x81, 0xd8, 0xc2, 0xd2, 0xab, 0x33, 0x10, 0x5b, 0xdc, 0x00, 0x00, 0x04, 0x62, 0x8b, 0x3b,
+  0x00, 0x80, 0x40, 0x6c, 0x71, 0x29, 0x30, 0x10, 0x88, 0x2d, 0x8e, 0x26, 0x77, 0x02, 0xb1, 0x45,
+  0x06, 0x59, 0x48, 0x20, 0xb6, 0xc8, 0x42, 0x00, 0x08, 0xc4, 0x16, 0xe9, 0x92, 0x3b, 0x81, 0xd8,
+  0x32, 0x93, 0x3b, 0x20, 0x10, 0x9b, 0x46, 0x72, 0x07, 0x04, 0x92, 0x03, 0x2b, 0xee, 0x80, 0x40,
+  0x72, 0x68, 0xaf, 0x32, 0x10, 0x48, 0x0e, 0x8e, 0x02, 0x00, 0x02, 0xc9, 0x03, 0x15, 0x02, 0x40,
+  0x20, 0x79, 0xa0, 0xe4, 0x28, 0x08, 0x24, 0x0f, 0x94, 0x01, 0x00, 0x81, 0x64, 0x53, 0x65, 0x21,
+  0x20, 0x90, 0xcc, 0x8a, 0x3b, 0x00, 0x04, 0x92, 0x27, 0x2a, 0x04, 0x80, 0x40, 0xf2, 0x9c, 0xb4,
+  0x10, 0x10, 0x48, 0x9e, 0xb4, 0x10, 0x00, 0x02, 0xc9, 0x93, 0xa6, 0x01, 0x40, 0x20, 0x79, 0xd2,
+  0xe4, 0x02, 0x0b, 0x24, 0x4f, 0x9a, 0x01, 0x00, 0xa1, 0x84, 0x83, 0x0a, 0x01, 0x20, 0x94, 0xc0,
+  0x5e, 0x9d, 0x00, 0x84, 0x12, 0x5a, 0x72, 0x07, 0x80, 0x50, 0x02, 0x64, 0xc9, 0x1d, 0x10, 0x4a,
+  0x90, 0xc9, 0x1d, 0x00, 0x42, 0x09, 0x33, 0x39, 0x0a, 0x40, 0x28, 0x2c, 0xb4, 0xe4, 0x28, 0x08,
+  0x85, 0x91, 0x42, 0x00, 0x00, 0xa1, 0xb8, 0xc0, 0x02, 0x05, 0x20, 0x14, 0x47, 0x64, 0x01, 0x00,
+  0x84, 0xe2, 0x0a, 0x00, 0x00, 0x80, 0x50, 0xdc, 0x93, 0xc1, 0x1d, 0x10, 0x8a, 0x2c, 0x93, 0x26,
+  0x77, 0x42, 0x91, 0xac, 0x38, 0x00, 0x40, 0x28, 0xb6, 0x10, 0x00, 0x00, 0x08, 0xc6, 0x14, 0x00,
+  0x00, 0x00, 0xc1, 0x98, 0x12, 0x18, 0x00, 0x20, 0x18, 0x53, 0x82, 0xa3, 0x00, 0x04, 0x63, 0x0a,
+  0x01, 0x00, 0x80, 0x60, 0x4c, 0x61, 0xb6, 0x10, 0x10, 0x8c, 0x29, 0x2c, 0x03, 0x00, 0x82, 0x31,
+  0xc5, 0x01, 0x00, 0x40, 0x30, 0xa6, 0xb8, 0xe0, 0x0e, 0x08, 0xc6, 0x14, 0x37, 0x02, 0x03, 0xc1,
+  0x98, 0xe2, 0x08, 0x00, 0x20, 0x18, 0x53, 0x5c, 0x21, 0x00, 0x04, 0x63, 0x8a, 0x3b, 0x00, 0x80,
+  0x60, 0x4c, 0x71, 0xa7, 0x10, 0x10, 0x8c, 0x29, 0x2e, 0x0d, 0x00, 0x82, 0x31, 0xc5, 0x25, 0x57,
+  0x40, 0x30, 0xa6, 0xb8, 0xe4, 0x0e, 0x08, 0xc6, 0x14, 0x97, 0x1c, 0x05, 0xc1, 0x98, 0xe2, 0xd2,
+  0xab, 0x33, 0x18, 0x53, 0xdc, 0xab, 0x13, 0x04, 0x63, 0x8a, 0xa3, 0x00, 0x80, 0x60, 0x4c, 0x71,
+  0xb4, 0x10, 0x10, 0x8c, 0x29, 0x8e, 0x26, 0x77, 0x82, 0x31, 0xe5, 0xc9, 0x42, 0x40, 0x30, 0xa6,
+  0xc8, 0x20, 0x0b, 0x09, 0xc6, 0x14, 0x59, 0x08, 0x00, 0xc1, 0x98, 0x22, 0x0f, 0x00, 0x20, 0x18,
+  0x53, 0x64, 0x72, 0x07, 0x04, 0x63, 0x8a, 0x4c, 0xaf, 0xce, 0x60, 0x4c, 0x91, 0xee, 0x00, 0x10,
+  0x8c, 0x29, 0x32, 0x03, 0x00, 0x82, 0x31, 0x65, 0xa6, 0x01, 0x40, 0x30, 0xa6, 0x4c, 0x5a, 0x08,
+  0x08, 0xc6, 0x94, 0x49, 0xd3, 0x00, 0xc1, 0x98, 0x34, 0xd2, 0x00, 0x20, 0x18, 0x93, 0x46, 0x72,
+  0x07, 0x04, 0x63, 0xd2, 0x2c, 0x04, 0x80, 0x60, 0x0c, 0x23, 0xac, 0x00, 0x10, 0x8c, 0x61, 0xc5,
+  0x05, 0x06, 0x82, 0x31, 0xac, 0xb8, 0x03, 0x40, 0x30, 0x86, 0xb1, 0x42, 0x00, 0x08, 0xc6, 0x30,
+  0x96, 0x06, 0x00, 0xc1, 0x18, 0x5a, 0x1c, 0x4d, 0x23, 0x18, 0x43, 0x8b, 0x7c, 0x75, 0x06, 0x63,
+  0x28, 0x32, 0x95, 0x81, 0x60, 0x0c, 0x4d, 0x03, 0x00, 0x10, 0x8c, 0xa1, 0xc9, 0x15, 0x00, 0x82,
+  0x31, 0x34, 0x39, 0x0a, 0x40, 0x30, 0x86, 0xa6, 0x49, 0x01, 0x08, 0xc6, 0x54, 0x02, 0x00, 0x00,
+  0xc1, 0x98, 0x9a, 0x26, 0x05, 0x20, 0x18, 0x53, 0x59, 0x01, 0x00, 0x04, 0x63, 0xaa, 0xa3, 0x00,
+  0x80, 0x60, 0x4c, 0x95, 0x85, 0x00, 0x10, 0x8c, 0xa9, 0xb2, 0xcc, 0x09, 0x82, 0x31, 0x75, 0xa6,
+  0x01, 0x40, 0x30, 0x6c, 0x54, 0x19, 0xdc, 0x09, 0x86, 0x25, 0x97, 0xdc, 0x01, 0xe1, 0x84, 0x11,
+  0x28, 0x00, 0x20, 0x9c, 0xc0, 0x8a, 0xa3, 0x69, 0x84, 0x13, 0x18, 0x4b, 0x81, 0x81, 0x70, 0x82,
+  0x23, 0x00, 0x00, 0x10, 0x4e, 0x70, 0x84, 0x15, 0x02, 0xc2, 0x09, 0x8e, 0x16, 0x02, 0x40, 0x38,
+  0x01, 0x26, 0x77, 0x00, 0x08, 0x27, 0xc8, 0x40, 0x0b, 0x01, 0xe1, 0x04, 0x19, 0x68, 0x1a, 0x20,
+  0x9c, 0x20, 0x0b, 0x01, 0x00, 0x84, 0x13, 0x64, 0x1a, 0x81, 0x81, 0x70, 0x82, 0x7c, 0xad, 0x00,
+  0x10, 0x4e, 0x98, 0x81, 0x26, 0x77, 0xc2, 0x09, 0x13, 0x26, 0x77, 0x40, 0x38, 0x61, 0xd2, 0x34,
+  0x00, 0x08, 0x27, 0xd0, 0x34, 0x00, 0x00, 0xe1, 0x04, 0x9a, 0x68, 0x21, 0x20, 0x9c, 0x60, 0x8b,
+  0x3b, 0x00, 0x84, 0x53, 0xc2, 0x48, 0x03, 0x80, 0x70, 0x4a, 0xa0, 0x00, 0x00, 0x10, 0x4e, 0x09,
+  0x94, 0x15, 0x02, 0xc2, 0x29, 0x03, 0x15, 0x02, 0x40, 0x38, 0xa5, 0xcc, 0xe4, 0x28, 0x08, 0xa7,
+  0x18, 0x53, 0xe7, 0x04, 0xe1, 0x94, 0x34, 0x68, 0x72, 0x27, 0x9c, 0xc2, 0x0a, 0x01, 0x00, 0x84,
+  0x53, 0x58, 0x21, 0xc9, 0x9d, 0x70, 0x0a, 0x7b, 0xb2, 0x10, 0x10, 0x4e, 0x61, 0x8f, 0x26, 0x47,
+  0xc3, 0x29, 0x8e, 0x00, 0x00, 0x40, 0x38, 0xc5, 0x91, 0x42, 0x00, 0x08, 0xa7, 0xb8, 0x34, 0x00,
+  0x00, 0xe1, 0x14, 0xb7, 0x00, 0x00, 0x20, 0x9c, 0xe2, 0x28, 0x00, 0x00, 0x84, 0x53, 0x1c, 0x2d,
+  0x04, 0x80, 0x70, 0x8a, 0xa3, 0x69, 0x00, 0x10, 0x4e, 0x71, 0x94, 0x01, 0x00, 0xc2, 0x29, 0x30,
+  0x0d, 0x00, 0x40, 0x38, 0x05, 0x3e, 0x77, 0x00, 0x08, 0xa7, 0xc8, 0x02, 0x00, 0x00, 0xe1, 0x14,
+  0x59, 0x08, 0x00, 0x20, 0x9c, 0x22, 0x13, 0x01, 0x00, 0x84, 0x53, 0x64, 0x72, 0x00, 0x80, 0x70,
+  0x8a, 0x4c, 0x13, 0x01, 0x10, 0x4e, 0x91, 0x69, 0xa2, 0x42, 0xc2, 0x29, 0x32, 0x4d, 0x5a, 0x40,
+  0x38, 0x45, 0xb2, 0x34, 0x00, 0x08, 0xa7, 0x48, 0x77, 0x00, 0x00, 0xe1, 0x94, 0x89, 0x0a, 0x01,
+  0x20, 0x9c, 0x32, 0x69, 0x21, 0x00, 0x84, 0x53, 0x26, 0x4d, 0x8e, 0x82, 0x70, 0xd2, 0x29, 0x04,
+  0x00, 0x10, 0x4e, 0x72, 0x04, 0x00, 0x00, 0xc2, 0x49, 0x6e, 0x01, 0x00, 0x40, 0x38, 0xc9, 0x51,
+  0x00, 0x00, 0x08, 0x27, 0x39, 0x5a, 0x08, 0x00, 0xe1, 0x24, 0x47, 0xd3, 0x00, 0x20, 0x9c, 0xe4,
+  0x68, 0x72, 0x14, 0x84, 0x93, 0x5c, 0x06, 0x00, 0x80, 0x70, 0x92, 0x4c, 0x93, 0x16, 0x12, 0x4e,
+  0x9a, 0x81, 0x26, 0x77, 0xc2, 0x49, 0xb4, 0xb8, 0x03, 0x40, 0x38, 0x89, 0x26, 0xf9, 0xea, 0x0c,
+  0x87, 0x85, 0x11, 0xdc, 0x01, 0xe1, 0xb0, 0x30, 0x10, 0x4d, 0x23, 0x1c, 0x16, 0x1c, 0x01, 0x00,
+  0x84, 0xc3, 0x06, 0x2a, 0x04, 0x80, 0x70, 0xd8, 0x48, 0xee, 0x00, 0x10, 0x0e, 0x23, 0x00, 0x00,
+  0x00, 0xc2, 0x61, 0xa4, 0x38, 0x0a, 0x40, 0x38, 0x8c, 0x14, 0xf9, 0xea, 0x0c, 0x87, 0xa5, 0x91,
+  0x1c, 0x00, 0xe1, 0xb0, 0x44, 0x00, 0x00, 0x20, 0x1c, 0x96, 0x1c, 0x01, 0x00, 0x84, 0xc3, 0x92,
+  0x3b, 0x00, 0x80, 0x70, 0x58, 0x9a, 0x19, 0x00, 0x10, 0x0e, 0x4b, 0xf6, 0x55, 0x06, 0xc2, 0x61,
+  0xac, 0xb8, 0x03, 0x40, 0x38, 0x8c, 0x15, 0x47, 0x0b, 0x09, 0x87, 0xb1, 0x22, 0x93, 0x3b, 0xe1,
+  0x30, 0xc6, 0x0a, 0x01, 0x20, 0x1c, 0xc6, 0x5e, 0x9d, 0x73, 0x86, 0xc3, 0xd8, 0xbb, 0x85, 0x80,
+  0x70, 0x18, 0xa3, 0x69, 0x50, 0x10, 0x0e, 0x63, 0x94, 0x15, 0x02, 0xc2, 0x61, 0x2d, 0xcd, 0x34,
+  0x40, 0x38, 0xec, 0x8d, 0x34, 0x00, 0x08, 0x87, 0x3d, 0x59, 0x08, 0x00, 0xe1, 0xb0, 0xb9, 0x8a,
+  0x3b, 0x20, 0x1c, 0x36, 0x69, 0x21, 0x00, 0x84, 0xc3, 0x6a, 0x90, 0x85, 0x80, 0x70, 0x5e, 0x60,
+  0xc9, 0xd1, 0x12, 0xce, 0x23, 0x00, 0x00, 0x00, 0xc2, 0x79, 0x64, 0xd2, 0xb4, 0x4a, 0x38, 0xaf,
+  0x09, 0x56, 0x08, 0x08, 0xe7, 0xb5, 0xe2, 0x0e, 0x00, 0xe1, 0x3c, 0x47, 0x58, 0x21, 0x20, 0x9c,
+  0xe7, 0x68, 0x01, 0x00, 0x84, 0xf3, 0x9e, 0x2c, 0x13, 0x80, 0x70, 0x9e, 0x0c, 0x14, 0x00, 0x10,
+  0xce, 0x93, 0xc5, 0x05, 0x06, 0xc2, 0x79, 0x92, 0xa5, 0x01, 0x40, 0x38, 0x6f, 0xa2, 0x42, 0x00,
+  0x08, 0xe7, 0x4d, 0x5a, 0x00, 0x00, 0xe1, 0x3c, 0x8a, 0x0a, 0x01, 0x20, 0x9c, 0x47, 0xd3, 0x00,
+  0x00, 0x84, 0xf3, 0x68, 0x1a, 0x81, 0x81, 0x70, 0x1e, 0x4d, 0x0e, 0x00, 0x10, 0xce, 0xa3, 0xc9,
+  0xd1, 0x34, 0xc2, 0x79, 0xb4, 0xba, 0x03, 0x40, 0x38, 0xaf, 0x32, 0x00, 0x00, 0x08, 0xe7, 0x55,
+  0x77, 0x00, 0x00, 0xe1, 0xbc, 0x2a, 0x93, 0xa3, 0x20, 0x9c, 0x67, 0x0b, 0x01, 0x00, 0x84, 0xf3,
+  0xae, 0x3b, 0x00, 0x80, 0x70, 0x64, 0x71, 0x05, 0x00, 0x10, 0x8e, 0x2c, 0x2e, 0x0d, 0x00, 0xc2,
+  0x91, 0x45, 0x26, 0x47, 0x41, 0x38, 0x32, 0x11, 0x00, 0x00, 0x08, 0x47, 0x26, 0x96, 0xdc, 0x01,
+  0xe1, 0xc8, 0xc4, 0x32, 0x00, 0x20, 0x1c, 0x99, 0xdc, 0x01, 0x00, 0x84, 0x23, 0xd3, 0x2c, 0x92,
+  0x80, 0x70, 0x64, 0x9a, 0x69, 0x00, 0x10, 0x8e, 0x6c, 0xc1, 0x05, 0x06, 0xc2, 0x91, 0xed, 0xb5,
+  0xe4, 0x68, 0x38, 0xf2, 0xc9, 0x42, 0x00, 0x08, 0x47, 0x3e, 0x59, 0x64, 0x21, 0xe1, 0x48, 0x1a,
+  0x26, 0x2d, 0x24, 0x1c, 0x49, 0x8b, 0x0c, 0x0c, 0x84, 0x34, 0x8a, 0xa3, 0xc9, 0x81, 0x90, 0xc6,
+  0xbb, 0x41, 0x16, 0x10, 0xd2, 0x29, 0x2e, 0xb8, 0x03, 0x42, 0x62, 0xe4, 0x06, 0x59, 0x40, 0x48,
+  0x2c, 0x11, 0x00, 0x00, 0x08, 0x89, 0xb5, 0xc0, 0x0a, 0x01, 0x21, 0xb9, 0x22, 0x83, 0x2b, 0x24,
+  0x24, 0x97, 0x46, 0x0a, 0xac, 0x84, 0xe4, 0x1e, 0x4b, 0x23, 0xb0, 0x90, 0xdc, 0xa4, 0x85, 0x00,
+  0x10, 0x92, 0x0c, 0x82, 0x25, 0x47, 0x43, 0x92, 0xc1, 0xd1, 0xb4, 0x4a, 0x48, 0x92, 0x16, 0x00,
+  0x00, 0x08, 0x89, 0xa2, 0x42, 0x00, 0x00, 0x21, 0xd9, 0xe2, 0x68, 0x21, 0x20, 0x24, 0x5b, 0x64,
+  0x21, 0x00, 0x84, 0x95, 0x1c, 0x01, 0x00, 0x80, 0xb0, 0x92, 0xa3, 0xc9, 0x1d, 0x10, 0x56, 0x9a,
+  0xb4, 0x10, 0x00, 0xc2, 0x4a, 0x93, 0x66, 0x00, 0x40, 0x60, 0x61, 0x54, 0x59, 0x08, 0x08, 0x2c,
+  0x9c, 0x44, 0x00, 0x00, 0x81, 0x85, 0x93, 0x6c, 0x01, 0x20, 0xb0, 0xd0, 0x00, 0x00, 0x00, 0x04,
+  0x16, 0xda, 0x93, 0x85, 0x80, 0xc0, 0x82, 0x23, 0x00, 0x00, 0x10, 0x58, 0x70, 0x34, 0x39, 0x00,
+  0x02, 0x0b, 0xb2, 0x90, 0x02, 0x40, 0x60, 0x41, 0x16, 0x57, 0x08, 0x08, 0x2c, 0xc8, 0x22, 0x5f,
+  0x9d, 0x81, 0x05, 0x09, 0x03, 0x03, 0x20, 0xb0, 0x30, 0x0b, 0x01, 0x00, 0x04, 0x16, 0x26, 0x2d,
+  0x04, 0x80, 0xc0, 0xc2, 0xa4, 0x29, 0xb8, 0x13, 0x58, 0x98, 0x34, 0xb9, 0x03, 0x02, 0x0b, 0xb4,
+  0x10, 0x00, 0x40, 0x60, 0x81, 0x16, 0x47, 0x0b, 0x09, 0x2c, 0xd0, 0x22, 0x4d, 0x9d, 0x81, 0x05,
+  0x8a, 0x4c, 0x9d, 0x20, 0xb0, 0x40, 0x93, 0x60, 0x85, 0x04, 0x16, 0x68, 0x72, 0x00, 0x80, 0xc0,
+  0x02, 0x4d, 0xaf, 0x4e, 0x10, 0x58, 0xa0, 0x19, 0x00, 0x00, 0x02, 0x0b, 0xb6, 0xc8, 0x34, 0x40,
+  0x60, 0x01, 0xa7, 0x11, 0x18, 0x08, 0x2c, 0xe0, 0x57, 0x27, 0x00, 0x81, 0x15, 0x56, 0x08, 0x00,
+  0x20, 0xb0, 0xc2, 0x32, 0x00, 0x00, 0x04, 0x56, 0x1c, 0x01, 0x00, 0x80, 0xc0, 0x8a, 0x4b, 0xee,
+  0x00, 0x10, 0x58, 0x71, 0xb4, 0x10, 0x00, 0x02, 0x2b, 0xf2, 0xd5, 0x09, 0x40, 0x60, 0x89, 0xb1,
+  0xf4, 0xea, 0x0c, 0x2c, 0x39, 0x02, 0x00, 0x00, 0x81, 0x25, 0xb7, 0x00, 0x00, 0x20, 0xb0, 0xe4,
+  0x68, 0x21, 0x00, 0x04, 0x96, 0x1c, 0x4d, 0x03, 0x80, 0xc0, 0x12, 0x2d, 0xee, 0x00, 0x10, 0x58,
+  0xa2, 0x69, 0x04, 0x06, 0x02, 0x7b, 0xa3, 0x00, 0x00, 0x40, 0x60, 0x8f, 0x24, 0x17, 0x18, 0x08,
+  0xec, 0xb5, 0xe0, 0x0e, 0x00, 0x81, 0xbd, 0x16, 0x68, 0x72, 0x27, 0xb0, 0xd7, 0xd2, 0x44, 0x05,
+  0x04, 0xf6, 0x64, 0x60, 0x00, 0x80, 0xc0, 0x1e, 0x0d, 0x8e, 0xa6, 0x11, 0xd8, 0xab, 0x32, 0xc8,
+  0x02, 0x02, 0x7b, 0x55, 0x16, 0x00, 0x40, 0x60, 0xef, 0x06, 0x0a, 0x00, 0x08, 0xac, 0x3a, 0x02,
+  0x00, 0x00, 0x81, 0x55, 0x47, 0x0b, 0x01, 0x20, 0xb0, 0xea, 0x68, 0x1a, 0x00, 0x04, 0x56, 0x69,
+  0x21, 0x00, 0x80, 0xd0, 0x82, 0x23, 0x00, 0x00, 0x10, 0x5a, 0x80, 0xcf, 0x1d, 0x00, 0x42, 0x0b,
+  0x32, 0x0c, 0x00, 0x40, 0x68, 0x61, 0x06, 0x77, 0x00, 0x08, 0x2d, 0x4c, 0x9a, 0x06, 0x00, 0xa1,
+  0x89, 0xe0, 0x0e, 0x00, 0x20, 0x34, 0x21, 0x02, 0x2b, 0x04, 0x84, 0x26, 0x52, 0x70, 0x34, 0x8d,
+  0xd0, 0x44, 0x22, 0x00, 0x00, 0x10, 0x9a, 0x48, 0x8e, 0x00, 0x00, 0x42, 0x13, 0xc9, 0xd1, 0x42,
+  0x40, 0x68, 0x82, 0x15, 0x53, 0x19, 0x08, 0x4d, 0xb0, 0xe2, 0x28, 0x00, 0xa1, 0x09, 0x56, 0xe4,
+  0xab, 0x33, 0x34, 0xc1, 0x12, 0x01, 0x00, 0x84, 0x26, 0xde, 0x48, 0xee, 0x80, 0xd0, 0xc4, 0x6b,
+  0x85, 0x00, 0x10, 0x9a, 0x78, 0xb2, 0x10, 0x00, 0x42, 0x13, 0xb2, 0x98, 0x3a, 0x67, 0x68, 0x42,
+  0x26, 0x77, 0x00, 0x08, 0x4d, 0x5c, 0x96, 0xdc, 0x01, 0xa1, 0xa5, 0x20, 0x0b, 0x01, 0x20, 0xb4,
+  0x54, 0xd8, 0x01, 0x00, 0x84, 0x96, 0x4e, 0x72, 0x34, 0x8d, 0xd0, 0x12, 0x7b, 0xb4, 0x10, 0x10,
+  0x5a, 0x6a, 0x00, 0x00, 0x00, 0x42, 0x4b, 0x2d, 0x30, 0x00, 0x40, 0x68, 0xa9, 0x09, 0x56, 0x26,
+  0x08, 0x2d, 0xb5, 0xe2, 0x0e, 0x00, 0xa1, 0xa5, 0xf6, 0x64, 0x21, 0x20, 0xb4, 0xd4, 0xaa, 0x7c,
+  0x75, 0x86, 0x96, 0x1c, 0x00, 0x00, 0x80, 0xd0, 0x92, 0x23, 0x00, 0x00, 0x10, 0x5a, 0x72, 0xc9,
+  0x1d, 0x00, 0x42, 0x4b, 0xee, 0x55, 0x06, 0x40, 0x68, 0xc9, 0xd1, 0x02, 0x00, 0x08, 0x2d, 0x39,
+  0x5a, 0x08, 0x00, 0xa1, 0x25, 0x47, 0xd3, 0x00, 0x20, 0xb4, 0xe4, 0x68, 0x72, 0x07, 0x84, 0x96,
+  0x1c, 0x65, 0x85, 0x80, 0xd0, 0x92, 0xcb, 0x00, 0x00, 0x10, 0x5a, 0x92, 0x81, 0xa6, 0x01, 0x42,
+  0x4b, 0x32, 0xb9, 0x03, 0x40, 0x68, 0x69, 0x16, 0x00, 0x00, 0x08, 0x2d, 0xcd, 0x22, 0xdd, 0x01,
+  0xa1, 0xa5, 0x89, 0x0a, 0x01, 0x20, 0xb4, 0x34, 0x51, 0x1a, 0x00, 0x84, 0x96, 0xe6, 0x73, 0x07,
+  0x80, 0xd0, 0xd2, 0xa4, 0xc9, 0x01, 0x10, 0x5a, 0xa2, 0x85, 0x00, 0x00, 0x42, 0x4b, 0xb4, 0xb8,
+  0x03, 0x40, 0x68, 0x89, 0x96, 0x99, 0xdc, 0x09, 0x2d, 0x51, 0x54, 0x08, 0x00, 0xa1, 0x25, 0x9a,
+  0xdc, 0x01, 0x20, 0xb4, 0x44, 0xd3, 0xa4, 0x85, 0x84, 0xe6, 0xc8, 0xa3, 0x00, 0x80, 0xd0, 0x1c,
+  0x91, 0x19, 0x00, 0x10, 0x9a, 0x2b, 0x8e, 0x00, 0x00, 0x42, 0x73, 0x45, 0x16, 0x02, 0x40, 0x68,
+  0x6e, 0x01, 0x00, 0x00, 0x08, 0xed, 0x05, 0xc2, 0x00, 0x00, 0xa1, 0xbd, 0xb0, 0x00, 0x00, 0x20,
+  0xb4, 0x17, 0x5a, 0x21, 0x00, 0x84, 0xf6, 0x82, 0xa3, 0x85, 0x80, 0xd0, 0x5e, 0xa0, 0xc9, 0x1d,
+  0x10, 0xda, 0x23, 0x00, 0x00, 0x00, 0x42, 0x7b, 0xa4, 0x00, 0x00, 0x40, 0x68, 0x8f, 0x14, 0x02,
+  0x00, 0x08, 0xed, 0x25, 0x59, 0x08, 0x00, 0xa1, 0xbd, 0x05, 0x00, 0x00, 0x20, 0xb4, 0xb7, 0x0a,
+  0x00, 0x00, 0x84, 0xf6, 0x56, 0x21, 0x00, 0x80, 0xd0, 0xde, 0x2a, 0xee, 0x00, 0x10, 0xda, 0x63,
+  0xc5, 0x01, 0x00, 0x42, 0x7b, 0x2c, 0x11, 0x00, 0x40, 0x68, 0x8f, 0x25, 0x77, 0x00, 0x08, 0xed,
+  0xb5, 0xc0, 0x0a, 0x01, 0xa1, 0xbd, 0x16, 0xdc, 0x01, 0x20, 0xb4, 0xd7, 0x04, 0x2b, 0x04, 0x84,
+  0xf6, 0x5a, 0x01, 0x00, 0x80, 0xd0, 0x5e, 0x2b, 0x04, 0x00, 0x10, 0xda, 0x6b, 0xc5, 0xd1, 0x42,
+  0x42, 0x7b, 0x2d, 0x0d, 0x00, 0x40, 0x68, 0xaf, 0x25, 0x77, 0x00, 0x08, 0xed, 0xb5, 0xe4, 0x28,
+  0x00, 0xa1, 0xbd, 0x96, 0x68, 0x72, 0x27, 0xb4, 0xd7, 0x20, 0x2a, 0x04, 0x84, 0xf6, 0x1c, 0x01,
+  0x00, 0x80, 0xd0, 0x9e, 0x4b, 0x03, 0x00, 0x10, 0xda, 0x73, 0x34, 0xb8, 0x03, 0x42, 0x7b, 0x8f,
+  0x00, 0x00, 0x40, 0x68, 0xef, 0xb1, 0x0c, 0x00, 0x08, 0xed, 0x3d, 0xf9, 0x2a, 0x03, 0xa1, 0x3d,
+  0x19, 0x58, 0x21, 0x20, 0xb4, 0x27, 0x83, 0x3b, 0x00, 0x84, 0xf6, 0x64, 0x70, 0x14, 0x80, 0xd0,
+  0x9e, 0x0c, 0xb2, 0x10, 0x10, 0xda, 0x93, 0x41, 0x26, 0x77, 0x42, 0x7b, 0x32, 0x50, 0x00, 0x40,
+  0x68, 0x4f, 0x16, 0x00, 0x00, 0x08, 0xed, 0xc9, 0xe2, 0x00, 0x00, 0xa1, 0x3d, 0x59, 0xdc, 0x01,
+  0x20, 0xb4, 0x27, 0x13, 0x01, 0x00, 0x84, 0xf6, 0x64, 0x72, 0x65, 0x82, 0xd0, 0x9e, 0x64, 0x65,
+  0x02, 0x10, 0xda, 0x93, 0xaf, 0x15, 0x02, 0x42, 0x7b, 0xf2, 0x39, 0x0a, 0x40, 0x68, 0x4f, 0x3e,
+  0x99, 0x02, 0x0b, 0xed, 0xc9, 0x57, 0x19, 0x00, 0xa1, 0x3d, 0x59, 0x59, 0x99, 0x20, 0xb4, 0x47,
+  0x8b, 0xa9, 0x13, 0x84, 0xf6, 0x68, 0x71, 0x07, 0x80, 0xd0, 0x1e, 0x2d, 0x32, 0xb9, 0x13, 0xda,
+  0xa3, 0x65, 0x16, 0x00, 0x42, 0x7b, 0xb4, 0xcc, 0xe4, 0x4e, 0x68, 0x8f, 0x22, 0x56, 0x08, 0x08,
+  0xed, 0xd1, 0x64, 0xea, 0x04, 0xa1, 0xbd, 0xca, 0x92, 0x3b, 0x20, 0xb4, 0x57, 0x65, 0x72, 0x07,
+  0x84, 0xf6, 0xaa, 0x74, 0x07, 0x80, 0xd0, 0x9e, 0x2d, 0x04, 0x00, 0x10, 0xda, 0xb3, 0xc5, 0x1d,
+  0x00, 0x42, 0x7b, 0xb7, 0x00, 0x00, 0x40, 0x68, 0xef, 0x16, 0x02, 0x00, 0x08, 0xed, 0xdd, 0x34,
+  0x00, 0x00, 0xa1, 0xbd, 0xeb, 0x0e, 0x00, 0x20, 0x34, 0x18, 0x04, 0x2b, 0x04, 0x84, 0x06, 0x03,
+  0x4b, 0xaf, 0xce, 0xd0, 0x60, 0x68, 0x81, 0xa6, 0x11, 0x1a, 0x0c, 0x2d, 0xbd, 0x3a, 0x43, 0x83,
+  0xc1, 0x1d, 0x00, 0x40, 0x68, 0x30, 0xb8, 0xf4, 0xea, 0x0c, 0x0d, 0x06, 0x47, 0x65, 0x21, 0xa1,
+  0xc1, 0x20, 0x8b, 0x3b, 0x20, 0x34, 0x18, 0x24, 0x05, 0x00, 0x84, 0x06, 0xc3, 0x2c, 0x04, 0x80,
+  0xd0, 0x60, 0x01, 0x00, 0x00, 0x10, 0x1a, 0x2c, 0x81, 0x15, 0x02, 0x42, 0x83, 0x25, 0xc8, 0x34,
+  0x40, 0x68, 0xb0, 0x10, 0x00, 0x00, 0x08, 0x0d, 0x16, 0x03, 0x00, 0x00, 0xa1, 0xc1, 0xc2, 0x0a,
+  0x01, 0x20, 0x34, 0x58, 0x58, 0x99, 0x73, 0x86, 0x06, 0x0b, 0x4b, 0x8e, 0x82, 0xd0, 0x60, 0x61,
+  0x19, 0x00, 0x10, 0x1a, 0x2c, 0x0e, 0x00, 0x00, 0x42, 0x83, 0xc5, 0x05, 0x47, 0x41, 0x68, 0xb0,
+  0xb8, 0x20, 0x0b, 0x08, 0x0d, 0x16, 0x17, 0x68, 0x21, 0xa1, 0xc1, 0xe2, 0x08, 0x00, 0x20, 0x34,
+  0x58, 0x1c, 0x49, 0x03, 0x84, 0x06, 0x8b, 0x23, 0xc9, 0x9d, 0xd0, 0x60, 0x71, 0x05, 0x00, 0x10,
+  0x1a, 0x2c, 0xae, 0x10, 0x00, 0x42, 0x83, 0xc5, 0x1d, 0x00, 0x40, 0x68, 0xb0, 0xb8, 0x53, 0x08,
+  0x08, 0x0d, 0x16, 0x77, 0xca, 0x04, 0xa1, 0xc1, 0xe2, 0x52, 0x60, 0x20, 0x34, 0x58, 0x5c, 0x1a,
+  0x00, 0x84, 0x06, 0x8b, 0x4b, 0xee, 0x80, 0xd0, 0x60, 0x71, 0xe9, 0xd5, 0x19, 0x1a, 0x2c, 0x6e,
+  0x52, 0x00, 0x42, 0x83, 0xc5, 0x51, 0x00, 0x40, 0x68, 0xb0, 0x38, 0x5a, 0x00, 0x08, 0x0d, 0x16,
+  0x47, 0x0b, 0x01, 0xa1, 0xc1, 0xe2, 0x68, 0x1a, 0x20, 0x34, 0x58, 0x1c, 0x4d, 0xee, 0x84, 0x06,
+  0x8b, 0x0c, 0xac, 0x90, 0xd0, 0x60, 0x91, 0x41, 0x16, 0x12, 0x1a, 0x2c, 0x92, 0x00, 0x00, 0x42,
+  0x83, 0x45, 0x92, 0xe4, 0x4e, 0x68, 0xb0, 0xc8, 0x42, 0x00, 0x08, 0x0d, 0x16, 0x99, 0x02, 0x03,
+  0xa1, 0xc1, 0x22, 0xd3, 0x00, 0x20, 0x34, 0x58, 0x64, 0x72, 0x07, 0x84, 0x06, 0x8b, 0x4c, 0xaf,
+  0xce, 0xd0, 0x60, 0x91, 0x69, 0x16, 0x12, 0x1a, 0x2c, 0x72, 0x25, 0x77, 0x42, 0x83, 0x45, 0xd6,
+  0x09, 0x40, 0x68, 0xb0, 0xcc, 0x02, 0x00, 0x08, 0x0d, 0x96, 0x59, 0x08, 0x00, 0xa1, 0xc1, 0x32,
+  0xd3, 0x00, 0x20, 0x34, 0x58, 0x66, 0x72, 0x07, 0x84, 0x06, 0xcb, 0xa4, 0x85, 0x80, 0xd0, 0x60,
+  0xb1, 0x85, 0x00, 0x10, 0x1a, 0x44, 0x04, 0x00, 0x00, 0x42, 0x83, 0xa8, 0xc8, 0x42, 0x40, 0x68,
+  0x10, 0xbd, 0x56, 0x08, 0x08, 0x0d, 0xa6, 0xe0, 0x68, 0x21, 0xa1, 0xc1, 0x34, 0x00, 0x00, 0x20,
+  0x34, 0x98, 0x46, 0x90, 0x85, 0x84, 0x06, 0xd3, 0x28, 0x00, 0x80, 0xd0, 0x60, 0x1a, 0x69, 0x00,
+  0x10, 0x1a, 0x4c, 0x23, 0xb9, 0x03, 0x42, 0x83, 0x69, 0xa4, 0x57, 0x67, 0x68, 0x30, 0x8d, 0x57,
+  0x27, 0x08, 0x0d, 0xa6, 0x41, 0x0b, 0x00, 0xa1, 0xc1, 0x34, 0x68, 0x0a, 0x2c, 0x34, 0x98, 0x08,
+  0x00, 0x00, 0x84, 0x06, 0x13, 0x61, 0x85, 0x80, 0xd0, 0x60, 0x3a, 0x05, 0x00, 0x10, 0x1a, 0x4c,
+  0x2c, 0x0d, 0x00, 0x42, 0x83, 0x89, 0x65, 0x00, 0x40, 0x68, 0x30, 0x39, 0x00, 0x00, 0x08, 0x0d,
+  0x26, 0x47, 0x00, 0x00, 0xa1, 0xc1, 0xe4, 0x0a, 0x01, 0x20, 0x34, 0x98, 0xdc, 0x01, 0x00, 0x84,
+  0x06, 0x93, 0x4b, 0x03, 0x80, 0xd0, 0x60, 0x7a, 0xb2, 0x10, 0x10, 0x1a, 0x4c, 0x4f, 0xbe, 0x3a,
+  0x43, 0x83, 0x49, 0x26, 0x77, 0x40, 0x68, 0x30, 0xc9, 0xe4, 0x28, 0x08, 0x0d, 0xa6, 0x59, 0x00,
+  0x00, 0xa1, 0xc1, 0x34, 0x8b, 0x2c, 0x24, 0x34, 0x98, 0x68, 0x99, 0x00, 0x84, 0x06, 0x13, 0x4d,
+  0x03, 0x80, 0xd0, 0x20, 0x2b, 0x00, 0x00, 0x10, 0x1a, 0x64, 0xc5, 0xd1, 0x34, 0x42, 0x83, 0xac,
+  0xc8, 0x02, 0x40, 0x68, 0x90, 0x15, 0x59, 0x08, 0x08, 0x0d, 0xb2, 0xe7, 0x00, 0x00, 0xa1, 0xc1,
+  0x17, 0x1c, 0x2d, 0x24, 0x34, 0xf8, 0x58, 0x72, 0x07, 0x84, 0x06, 0x5f, 0x0b, 0xac, 0x90, 0xd0,
+  0xe0, 0x6b, 0xc9, 0x1d, 0x10, 0x1a, 0x7c, 0xed, 0xb9, 0x03, 0x42, 0x83, 0xcf, 0x15, 0x02, 0x40,
+  0x68, 0xf0, 0xb9, 0x03, 0x00, 0x08, 0x0d, 0x3e, 0x97, 0x1c, 0x05, 0xa1, 0xc1, 0xe7, 0x68, 0x72,
+  0x27, 0x34, 0xf8, 0x64, 0x01, 0x00, 0x84, 0x06, 0x9f, 0x4c, 0xee, 0x80, 0xd0, 0xe0, 0x93, 0xe9,
+  0xd5, 0x19, 0x1a, 0x7c, 0xd2, 0x1d, 0x00, 0x42, 0x83, 0x4f, 0xbe, 0x0c, 0x40, 0x68, 0xf0, 0x5d,
+  0x00, 0x00, 0x08, 0x0d, 0xbe, 0x9b, 0x06, 0x00, 0xa1, 0xc1, 0x77, 0xd3, 0xab, 0x33, 0x34, 0x28,
+  0x01, 0x00, 0x00, 0x84, 0x06, 0x65, 0x60, 0x85, 0x80, 0xd0, 0xa0, 0x0c, 0xee, 0x00, 0x10, 0x1a,
+  0x94, 0x81, 0x66, 0x00, 0x42, 0x83, 0xb2, 0x00, 0x00, 0x40, 0x68, 0x50, 0x16, 0x02, 0x00, 0x08,
+  0x0d, 0xca, 0xe2, 0x02, 0x03, 0xa1, 0x41, 0x59, 0x5c, 0x21, 0x20, 0x34, 0x28, 0x8b, 0x3b, 0x00,
+  0x84, 0x06, 0x65, 0x71, 0x69, 0x80, 0xd0, 0xa0, 0x2c, 0xb0, 0x4e, 0x10, 0x1a, 0x94, 0x45, 0x16,
+  0x02, 0x42, 0x83, 0x32, 0x8d, 0xc0, 0x40, 0x68, 0x50, 0xa6, 0x41, 0x01, 0x08, 0x0d, 0xca, 0x44,
+  0x00, 0x00, 0xa1, 0x41, 0x99, 0x4c, 0x65, 0x20, 0x34, 0x28, 0x93, 0x03, 0x00, 0x84, 0x06, 0x65,
+  0x72, 0x07, 0x80, 0xd0, 0xa0, 0x4c, 0x93, 0x02, 0x10, 0x1a, 0x94, 0x69, 0xd2, 0x34, 0x42, 0x83,
+  0xd2, 0xd1, 0xe4, 0x4e, 0x68, 0x50, 0xbe, 0x56, 0x08, 0x08, 0x0d, 0xca, 0x27, 0x5f, 0x9d, 0xa1,
+  0x41, 0xf9, 0x68, 0x99, 0x20, 0x34, 0x28, 0x5f, 0x65, 0x00, 0x84, 0x06, 0xe5, 0xab, 0xb2, 0x90,
+  0xd0, 0xa0, 0x84, 0x81, 0x01, 0x10, 0x1a, 0x94, 0x10, 0x15, 0x02, 0x42, 0x83, 0x92, 0xa6, 0xc0,
+  0x40, 0x68, 0x70, 0x52, 0x56, 0x08, 0x08, 0x0d, 0xd2, 0x02, 0x00, 0x00, 0xa1, 0x41, 0x5a, 0x08,
+  0x00, 0x20, 0x34, 0x48, 0x8b, 0x3b, 0x00, 0x84, 0x06, 0x69, 0x91, 0xaf, 0xce, 0xd0, 0x20, 0x2d,
+  0x33, 0xb9, 0x13, 0x1a, 0xa4, 0x08, 0x00, 0x00, 0x42, 0x83, 0x14, 0x15, 0x00, 0x40, 0x68, 0x90,
+  0xa2, 0x42, 0x00, 0x08, 0x0d, 0x52, 0x64, 0xea, 0x04, 0xa1, 0x41, 0x9a, 0x5c, 0x21, 0x20, 0x34,
+  0x48, 0xd3, 0xab, 0x0c, 0x84, 0x06, 0x69, 0x9a, 0xc9, 0xd1, 0xd0, 0x20, 0x4d, 0x33, 0xd6, 0x19,
+  0x1a, 0xa4, 0x69, 0xce, 0x42, 0x42, 0x83, 0x19, 0x00, 0x00, 0x40, 0x70, 0x61, 0x3c, 0x59, 0x08,
+  0x08, 0x2e, 0x8c, 0x0c, 0x00, 0x00, 0xc1, 0x85, 0x53, 0x64, 0x21, 0x20, 0xb8, 0x70, 0x8a, 0x7c,
+  0x75, 0x06, 0x17, 0x92, 0x2b, 0x04, 0x80, 0xe0, 0x02, 0x2b, 0x04, 0x00, 0x10, 0x5c, 0x60, 0xc5,
+  0x1d, 0x00, 0x82, 0x0b, 0x2c, 0xb9, 0x03, 0x40, 0x70, 0x81, 0xb1, 0x42, 0x00, 0x08, 0x2e, 0xb4,
+  0x60, 0x0b, 0x01, 0xc1, 0x85, 0x56, 0x08, 0x00, 0x20, 0xb8, 0xd0, 0xde, 0x2c, 0x04, 0x04, 0x17,
+  0x1c, 0x00, 0x00, 0x80, 0xe0, 0x82, 0x23, 0x00, 0x00, 0x10, 0x5c, 0x70, 0x34, 0xbd, 0x3a, 0x83,
+  0x0b, 0x8e, 0x3e, 0x77, 0x40, 0x70, 0x41, 0x02, 0x00, 0x00, 0x08, 0x2e, 0xc8, 0xe0, 0x0a, 0x01,
+  0xc1, 0x05, 0x19, 0x1c, 0x2d, 0x24, 0xb8, 0x20, 0x8b, 0x3b, 0x00, 0x04, 0x17, 0x64, 0x71, 0x34,
+  0x8d, 0xe0, 0x82, 0x4c, 0xee, 0x00, 0x10, 0x5c, 0x90, 0xc9, 0xd1, 0x02, 0x82, 0x0b, 0xf2, 0xc9,
+  0x34, 0x40, 0x70, 0x61, 0x02, 0x00, 0x00, 0x08, 0x2e, 0xcc, 0x40, 0x00, 0x00, 0xc1, 0x85, 0x89,
+  0x0a, 0x01, 0x20, 0xb8, 0x30, 0x51, 0x72, 0x07, 0x04, 0x17, 0x26, 0x62, 0x05, 0x80, 0xe0, 0xc2,
+  0x4c, 0xee, 0x00, 0x10, 0x5c, 0x98, 0x33, 0x0d, 0x00, 0x82, 0x0b, 0x73, 0x52, 0x00, 0x40, 0x70,
+  0x61, 0x4e, 0x9a, 0x1c, 0x08, 0x2e, 0x4c, 0x5a, 0x26, 0x00, 0xc1, 0x85, 0x49, 0x59, 0x21, 0x20,
+  0xb8, 0x40, 0x01, 0x00, 0x00, 0x04, 0x17, 0x68, 0x21, 0x00, 0x80, 0xe0, 0x02, 0x2d, 0xee, 0x00,
+  0x10, 0x5c, 0xa0, 0xa8, 0x10, 0x00, 0x82, 0x0b, 0x14, 0xd1, 0xe4, 0x40, 0x70, 0x81, 0x26, 0x77,
+  0x00, 0x08, 0x2e, 0xd0, 0xe4, 0x28, 0x00, 0xc1, 0x05, 0x9a, 0x66, 0xac, 0x33, 0xb8, 0x40, 0x25,
+  0x01, 0x00, 0x04, 0x17, 0xea, 0x7c, 0xd5, 0x9d, 0xe0, 0x82, 0x2d, 0x00, 0x00, 0x10, 0x5c, 0xb0,
+  0xc5, 0xd1, 0x42, 0x82, 0x0b, 0x36, 0x03, 0x00, 0x40, 0x70, 0x23, 0x10, 0x00, 0x00, 0x08, 0x6e,
+  0x04, 0x56, 0x08, 0x00, 0xc1, 0x8d, 0xd0, 0x8a, 0x2c, 0x24, 0xb8, 0x11, 0x1c, 0x01, 0x00, 0x04,
+  0x37, 0x82, 0x3b, 0x00, 0x80, 0xe0, 0x46, 0x70, 0x34, 0xb9, 0x13, 0xdc, 0x28, 0x00, 0x00, 0x00,
+  0x82, 0x1b, 0x85, 0x00, 0x00, 0x40, 0x70, 0xa3, 0x10, 0x56, 0x08, 0x08, 0x6e, 0x14, 0x92, 0x01,
+  0x00, 0xc1, 0x8d, 0xc2, 0xd2, 0x00, 0x20, 0xb8, 0x51, 0xdc, 0x08, 0x0c, 0x04, 0x37, 0x8a, 0x23,
+  0x00, 0x80, 0xe0, 0x46, 0x71, 0x85, 0x00, 0x10, 0xdc, 0x28, 0xee, 0x00, 0x00, 0x82, 0x1b, 0xc5,
+  0x1d, 0x06, 0x40, 0x70, 0xa3, 0x38, 0x0a, 0x00, 0x08, 0x6e, 0x14, 0x47, 0x93, 0x3b, 0xc1, 0x8d,
+  0x22, 0x03, 0x05, 0x20, 0xb8, 0x51, 0x24, 0x01, 0x00, 0x04, 0x37, 0x8a, 0x2c, 0x00, 0x80, 0xe0,
+  0x46, 0x91, 0x69, 0x00, 0x10, 0xdc, 0x28, 0x33, 0xb9, 0x03, 0x82, 0x1b, 0x29, 0xb0, 0x0c, 0x40,
+  0x70, 0x23, 0xb9, 0x03, 0x00, 0x08, 0x6e, 0x24, 0x47, 0x93, 0x3b, 0xc1, 0x8d, 0xf4, 0x64, 0x21,
+  0x20, 0xb8, 0x91, 0x66, 0x0a, 0x0c, 0x04, 0x37, 0xd2, 0x4c, 0x03, 0x80, 0xe0, 0x46, 0x9a, 0xc9,
+  0x1d, 0x10, 0xdc, 0x48, 0x34, 0x03, 0x00, 0x82, 0x1b, 0x8c, 0x01, 0x00, 0x40, 0x70, 0x83, 0xb1,
+  0x34, 0x00, 0x08, 0x6e, 0x3c, 0x56, 0x08, 0x00, 0xc1, 0x8d, 0xc7, 0xd2, 0x00, 0x20, 0xb8, 0xf1,
+  0x58, 0x7a, 0x75, 0x06, 0x37, 0x5e, 0x7b, 0x95, 0x81, 0xe0, 0xc6, 0x73, 0x04, 0x00, 0x10, 0xdc,
+  0x78, 0x32, 0xb8, 0x03, 0x82, 0x1b, 0x4f, 0x16, 0x02, 0x40, 0x70, 0xe3, 0x4d, 0x0a, 0x00, 0x08,
+  0x6e, 0x3c, 0x5a, 0x08, 0x00, 0xc1, 0x8d, 0x57, 0x65, 0x72, 0x27, 0xb8, 0x21, 0x9f, 0x0c, 0x0c,
+  0x04, 0x37, 0xaa, 0x2c, 0x04, 0x80, 0xe0, 0x46, 0x95, 0x69, 0x00, 0x10, 0x1c, 0x01, 0x00, 0x00,
+  0x00, 0x82, 0x23, 0xa1, 0x05, 0x56, 0x48, 0x70, 0x24, 0x38, 0x02, 0x00, 0x08, 0x8e, 0x14, 0x00,
+  0x00, 0x00, 0xc1, 0x91, 0x42, 0x00, 0x00, 0x20, 0x38, 0x52, 0x0c, 0x00, 0x00, 0x04, 0x47, 0x8a,
+  0x0c, 0x0c, 0x80, 0xe0, 0x48, 0x91, 0xc9, 0xd1, 0x12, 0x1c, 0x49, 0x04, 0x00, 0x00, 0x82, 0x23,
+  0xc9, 0x05, 0x59, 0x48, 0x70, 0x24, 0x4d, 0x56, 0x08, 0x08, 0x8e, 0x24, 0x5b, 0x08, 0x00, 0xc1,
+  0x91, 0x64, 0xd3, 0x00, 0x20, 0x38, 0xf2, 0x5a, 0x7a, 0x75, 0x06, 0x47, 0x9e, 0x2c, 0x04, 0x80,
+  0xe0, 0xc8, 0x93, 0xaf, 0x15, 0x12, 0x1c, 0xa9, 0x32, 0x30, 0x00, 0x82, 0x33, 0x05, 0x00, 0x00,
+  0x40, 0x70, 0xa6, 0x10, 0x00, 0x00, 0x08, 0xce, 0x14, 0x77, 0x00, 0x00, 0xc1, 0x99, 0xe2, 0xd2,
+  0xab, 0x33, 0x38, 0x53, 0x1c, 0x2d, 0x04, 0x04, 0x67, 0x8a, 0x2c, 0x04, 0x80, 0xe0, 0x4c, 0x91,
+  0xb2, 0x10, 0x10, 0x9c, 0x29, 0x33, 0x0d, 0x00, 0x82, 0x33, 0x69, 0x20, 0x0a, 0x40, 0x70, 0x26,
+  0xb9, 0x03, 0x00, 0x08, 0xce, 0xb0, 0x44, 0x00, 0x00, 0xc1, 0x19, 0x5a, 0x1d, 0x00, 0x20, 0x38,
+  0x53, 0x67, 0x72, 0x07, 0x04, 0x77, 0x02, 0x2b, 0x04, 0x80, 0xe0, 0x4e, 0x70, 0xb4, 0x10, 0x10,
+  0xdc, 0x09, 0x32, 0xb9, 0x03, 0x82, 0x3b, 0x81, 0x16, 0x00, 0x40, 0x70, 0x27, 0x50, 0x56, 0x08,
+  0x08, 0xee, 0x14, 0x00, 0x00, 0x00, 0xc1, 0x9d, 0xe2, 0x08, 0x00, 0x20, 0xb8, 0x53, 0x5c, 0x99,
+  0x73, 0x06, 0x77, 0x8a, 0x3b, 0x00, 0x80, 0xe0, 0x4e, 0x71, 0xa7, 0x10, 0x10, 0xdc, 0x29, 0x2e,
+  0x0d, 0x00, 0x82, 0x3b, 0xc5, 0xa5, 0x02, 0x40, 0x70, 0xa7, 0xb8, 0xc4, 0x00, 0x08, 0xee, 0x14,
+  0x47, 0x93, 0x03, 0xc1, 0x9d, 0x22, 0x09, 0x00, 0x20, 0xb8, 0x53, 0x64, 0x21, 0x00, 0x04, 0x77,
+  0x8a, 0x74, 0x00, 0x80, 0xe0, 0x4e, 0x99, 0x85, 0x00, 0x10, 0xdc, 0x39, 0x28, 0x0d, 0x00, 0x82,
+  0x3b, 0xa8, 0x00, 0x00, 0x40, 0x70, 0x07, 0x15, 0x53, 0x27, 0x08, 0xee, 0xa0, 0xe2, 0x00, 0x00,
+  0xc1, 0x1d, 0x54, 0x5c, 0x21, 0x20, 0xb8, 0x83, 0x8a, 0xa3, 0x85, 0x04, 0x77, 0x50, 0x71, 0x34,
+  0x8d, 0xe0, 0x0e, 0x4a, 0xee, 0x00, 0x10, 0xdc, 0x41, 0x4f, 0xa6, 0xc0, 0x82, 0x3b, 0x88, 0x16,
+  0x02, 0x40, 0x70, 0x07, 0xd1, 0x34, 0x00, 0x08, 0xee, 0xa0, 0x0c, 0x00, 0x00, 0xc1, 0x9d, 0xc4,
+  0x0a, 0x01, 0x20, 0xb8, 0x93, 0x5c, 0x21, 0x00, 0x04, 0x77, 0x92, 0x3b, 0x85, 0x80, 0xe0, 0x4e,
+  0x92, 0xaf, 0x4e, 0x10, 0xdc, 0x49, 0xb3, 0x10, 0x00, 0x82, 0x3b, 0x69, 0x52, 0x00, 0x40, 0x70,
+  0xe7, 0xc9, 0x40, 0xd3, 0x08, 0xee, 0xc8, 0xe4, 0x0e, 0x00, 0xc1, 0x9d, 0x9a, 0xdc, 0x01, 0x20,
+  0xb8, 0x53, 0x27, 0x4d, 0x03, 0x04, 0x87, 0x02, 0x2b, 0x04, 0x80, 0xe0, 0x50, 0x99, 0x29, 0x30,
+  0x10, 0x5c, 0x0a, 0x8e, 0x02, 0x00, 0x82, 0x4b, 0xa7, 0x38, 0x00, 0x40, 0x70, 0xa9, 0x15, 0x02,
+  0x00, 0x08, 0x2e, 0x39, 0x02, 0x00, 0x00, 0xc1, 0x25, 0x47, 0x58, 0x21, 0x20, 0xb8, 0x34, 0x0b,
+  0x01, 0x00, 0x04, 0x97, 0x26, 0x62, 0x85, 0x80, 0xe0, 0xd2, 0xa4, 0x69, 0x00, 0x10, 0x5c, 0xa2,
+  0xc9, 0x51, 0x00, 0x82, 0x63, 0x69, 0x16, 0x02, 0x40, 0x70, 0x8f, 0x00, 0x00, 0x00, 0x08, 0xee,
+  0xad, 0xe2, 0x28, 0x00, 0xc1, 0xbd, 0x96, 0x9e, 0xa3, 0x20, 0xb8, 0xd7, 0x60, 0x72, 0x00, 0x04,
+  0xf7, 0x1a, 0xa4, 0x65, 0xce, 0xe0, 0x9e, 0x23, 0x00, 0x00, 0x10, 0xdc, 0x7b, 0xac, 0x10, 0x00,
+  0x82, 0x7b, 0x32, 0xc8, 0xe2, 0x4e, 0x70, 0x4f, 0x06, 0x4a, 0xd3, 0x08, 0xee, 0xc9, 0x42, 0x00,
+  0x00, 0xc1, 0x3d, 0x59, 0x1c, 0x00, 0x20, 0xb8, 0x27, 0x93, 0xa9, 0x73, 0x06, 0xf7, 0x64, 0x72,
+  0x07, 0x80, 0xe0, 0x9e, 0x4c, 0xb3, 0x10, 0x10, 0xdc, 0x93, 0xcf, 0x01, 0x00, 0x82, 0x7b, 0x95,
+  0x15, 0x00, 0x40, 0x70, 0xaf, 0xca, 0x42, 0x00, 0x08, 0xee, 0xd9, 0x42, 0x00, 0x00, 0xc1, 0xbd,
+  0x5b, 0x00, 0x00, 0x20, 0xb8, 0x77, 0x8b, 0x3b, 0x00, 0x04, 0x37, 0x21, 0x2a, 0x04, 0x80, 0xe0,
+  0x26, 0x0d, 0x2c, 0x30, 0x10, 0xdc, 0xa4, 0x85, 0x00, 0x00, 0x82, 0x9b, 0xb4, 0xb8, 0x03, 0x40,
+  0x70, 0x93, 0x16, 0x47, 0x01, 0x08, 0x6e, 0xd2, 0xe2, 0x68, 0x1a, 0xc1, 0x4d, 0x8a, 0x0a, 0x01,
+  0x20, 0xb8, 0x49, 0x93, 0x3b, 0x00, 0x04, 0x37, 0x69, 0x72, 0xb4, 0x90, 0xe0, 0x26, 0x4d, 0x93,
+  0x16, 0x12, 0x1c, 0x0d, 0x23, 0x39, 0x0a, 0x82, 0xa3, 0x61, 0xa4, 0x57, 0x67, 0x70, 0x34, 0x0c,
+  0x9a, 0x02, 0x0b, 0x8e, 0x06, 0x02, 0x00, 0x00, 0xc1, 0xd1, 0xc0, 0x00, 0x00, 0x20, 0x38, 0x1a,
+  0x58, 0x21, 0x00, 0x04, 0x47, 0x03, 0x4b, 0xaf, 0xce, 0xe0, 0x68, 0x70, 0xc1, 0x1d, 0x10, 0x1c,
+  0x0d, 0x8e, 0x00, 0x00, 0x82, 0xa3, 0xc1, 0x91, 0xe4, 0x40, 0x70, 0x34, 0xb8, 0x03, 0x00, 0x08,
+  0x8e, 0x06, 0x97, 0x02, 0x03, 0xc1, 0xd1, 0xe0, 0xd2, 0x00, 0x20, 0x38, 0x1a, 0x5c, 0x72, 0x07,
+  0x04, 0x47, 0x83, 0x4b, 0x8e, 0x82, 0xe0, 0x68, 0x90, 0x81, 0x01, 0x10, 0x1c, 0x0d, 0x32, 0xb8,
+  0x03, 0x82, 0xa3, 0x41, 0x16, 0x00, 0x40, 0x70, 0x34, 0xcc, 0x42, 0x00, 0x08, 0x8e, 0x06, 0x5a,
+  0x08, 0x00, 0xc1, 0xd1, 0x40, 0x93, 0x3b, 0x20, 0x38, 0x1a, 0x68, 0x72, 0xb4, 0x04, 0x47, 0x03,
+  0x65, 0x85, 0x80, 0xe0, 0xe8, 0x28, 0x04, 0x00, 0x10, 0x1c, 0x1d, 0x65, 0x16, 0x02, 0x82, 0xa3,
+  0x25, 0x1c, 0x00, 0x40, 0x70, 0xb4, 0x10, 0x00, 0x00, 0x08, 0x8e, 0x16, 0x96, 0x04, 0x03, 0xc1,
+  0xd1, 0xc2, 0x92, 0xa3, 0x20, 0x38, 0x5a, 0x5c, 0x01, 0x00, 0x04, 0x47, 0x8b, 0x2b, 0xb2, 0x90,
+  0xe0, 0x68, 0x71, 0x69, 0x04, 0x16, 0x1c, 0x2d, 0x2e, 0x39, 0x0a, 0x82, 0xa3, 0x45, 0x06, 0x06,
+  0x40, 0x70, 0xb4, 0xcc, 0x0c, 0x00, 0x08, 0x8e, 0x22, 0x00, 0x00, 0x00, 0xc1, 0x51, 0x14, 0x04,
+  0x03, 0x20, 0x38, 0x8a, 0x02, 0x01, 0x00, 0x04, 0x47, 0x51, 0x20, 0xc9, 0x9d, 0xe0, 0x28, 0x0a,
+  0x0c, 0x00, 0x10, 0x1c, 0x45, 0xc1, 0x01, 0x00, 0x82, 0xa3, 0x28, 0xd0, 0xe4, 0x4e, 0x70, 0x14,
+  0x11, 0x00, 0x00, 0x08, 0x8e, 0xa2, 0x02, 0x00, 0x00, 0xc1, 0x51, 0x54, 0x08, 0x00, 0x20, 0x38,
+  0x8a, 0x0a, 0x49, 0xee, 0x04, 0x47, 0x51, 0x71, 0x00, 0x80, 0xe0, 0x28, 0x2a, 0xee, 0x00, 0x10,
+  0x1c, 0x45, 0xc5, 0xa5, 0x55, 0x82, 0xa3, 0xa8, 0x38, 0x0a, 0x40, 0x70, 0x14, 0x15, 0x47, 0xd3,
+  0x08, 0x8e, 0xa2, 0x22, 0x83, 0x2d, 0xc1, 0x51, 0x54, 0x64, 0x21, 0x20, 0x38, 0x8a, 0x8a, 0x4c,
+  0xee, 0x04, 0x47, 0x51, 0x91, 0x95, 0x81, 0xe0, 0x28, 0x2a, 0x33, 0x0d, 0x10, 0x1c, 0x45, 0x65,
+  0x26, 0x77, 0x82, 0xa3, 0xa8, 0xcc, 0x09, 0x40, 0x70, 0x14, 0x19, 0x00, 0x00, 0x08, 0x8e, 0x22,
+  0x53, 0x03, 0x03, 0xc1, 0x51, 0x64, 0xea, 0x04, 0x20, 0x38, 0x8a, 0x92, 0x48, 0x0e, 0x04, 0x47,
+  0x51, 0x1a, 0x00, 0x80, 0xe0, 0x28, 0x4a, 0x23, 0x30, 0x10, 0x1c, 0x45, 0x69, 0x14, 0x02, 0x82,
+  0xa3, 0x28, 0x11, 0x00, 0x40, 0x70, 0x14, 0x25, 0x06, 0x00, 0x08, 0x8e, 0xa2, 0xc4, 0x0a, 0x01,
+  0xc1, 0x51, 0x94, 0x1c, 0x00, 0x20, 0x38, 0x8a, 0x92, 0x0b, 0x0c, 0x04, 0x47, 0x51, 0x72, 0x07,
+  0x80, 0xe0, 0x28, 0x4a, 0x8e, 0x02, 0x10, 0x1c, 0x45, 0xc9, 0xd1, 0x42, 0x82, 0xa3, 0x28, 0x39,
+  0x9a, 0x46, 0x70, 0x14, 0xa5, 0x57, 0x19, 0x08, 0x8e, 0xa2, 0x34, 0x53, 0x60, 0xc1, 0x51, 0x94,
+  0x66, 0x72, 0x34, 0x38, 0x8a, 0xd2, 0xa4, 0x85, 0x04, 0x47, 0x51, 0xa2, 0x00, 0x80, 0xe0, 0x28,
+  0x4a, 0xb6, 0x00, 0x10, 0x1c, 0x45, 0x2c, 0xb9, 0x03, 0x82, 0xa3, 0x48, 0x26, 0x77, 0x40, 0x70,
+  0x14, 0xd1, 0x02, 0x00, 0x08, 0x8e, 0x22, 0x5a, 0x08, 0x00, 0xc1, 0x51, 0x44, 0xd3, 0x00, 0x20,
+  0x38, 0x8a, 0x68, 0x72, 0x07, 0x04, 0x47, 0x11, 0x4d, 0x8e, 0x96, 0xe0, 0x28, 0xa2, 0xe9, 0xd5,
+  0x19, 0x1c, 0x45, 0x94, 0x15, 0x00, 0x82, 0xa3, 0x88, 0xca, 0xe4, 0x68, 0x70, 0x34, 0x05, 0x02,
+  0x00, 0x08, 0x8e, 0xa6, 0xe0, 0x68, 0x1a, 0xc1, 0xd1, 0x14, 0x64, 0x21, 0x20, 0x38, 0x9a, 0x46,
+  0x70, 0x07, 0x04, 0x47, 0xd3, 0x08, 0xb2, 0x90, 0xe0, 0x68, 0x1a, 0xa8, 0x10, 0x10, 0x1c, 0x4d,
+  0x03, 0xd1, 0x02, 0x82, 0xa3, 0x69, 0x20, 0x5a, 0x48, 0x70, 0x34, 0x8d, 0x14, 0x18, 0x08, 0x8e,
+  0xa6, 0x91, 0xdc, 0x01, 0xc1, 0xd1, 0x34, 0x68, 0x1a, 0x20, 0x38, 0x9a, 0x06, 0x4d, 0xee, 0x04,
+  0x47, 0x13, 0x01, 0x00, 0x80, 0xe0, 0x68, 0x22, 0xac, 0x10, 0x10, 0x1c, 0x4d, 0x84, 0x95, 0x09,
+  0x82, 0xa3, 0xa9, 0x00, 0x00, 0x40, 0x70, 0x34, 0x15, 0x19, 0x18, 0x08, 0x8e, 0x26, 0x16, 0x1c,
+  0x00, 0xc1, 0xd1, 0xc4, 0x0a, 0x01, 0x20, 0x38, 0x9a, 0x58, 0x1a, 0x00, 0x04, 0x47, 0x13, 0x4b,
+  0xee, 0x80, 0xe0, 0x68, 0x72, 0x04, 0x00, 0x10, 0x1c, 0x4d, 0xee, 0x00, 0x00, 0x82, 0xa3, 0xc9,
+  0xa5, 0x01, 0x40, 0x70, 0x34, 0xb9, 0xe4, 0x68, 0x09, 0x8e, 0x26, 0x37, 0x93, 0x3b, 0xc1, 0xd1,
+  0xe4, 0x26, 0x2d, 0x24, 0x38, 0x9a, 0x1c, 0x05, 0x00, 0x04, 0x47, 0x93, 0xa3, 0x85, 0x80, 0xe0,
+  0x68, 0x72, 0x34, 0x39, 0x10, 0x1c, 0x4d, 0x8e, 0x26, 0x77, 0x82, 0xa3, 0xe9, 0xc9, 0x57, 0x67,
+  0x70, 0x34, 0xc9, 0xc0, 0x00, 0x08, 0x8e, 0x26, 0x49, 0x00, 0x00, 0xc1, 0xd1, 0x24, 0x4d, 0x9d,
+  0x33, 0x38, 0x9a, 0x66, 0x1a, 0x00, 0x04, 0x47, 0xd3, 0xa4, 0x85, 0x80, 0xe0, 0x68, 0x9a, 0x34,
+  0xb9, 0x13, 0x1c, 0x4d, 0x33, 0x03, 0x00, 0x82, 0xa3, 0x89, 0xa6, 0xc0, 0x40, 0x70, 0x34, 0xd1,
+  0xe4, 0x0e, 0x08, 0x8e, 0x3e, 0x59, 0x08, 0x00, 0xc1, 0xd1, 0x27, 0x8b, 0x3b, 0x20, 0x38, 0x2a,
+  0x03, 0x05, 0x00, 0x04, 0x47, 0x65, 0x01, 0x00, 0x80, 0xe0, 0xa8, 0x2c, 0x04, 0x00, 0x10, 0x1c,
+  0x95, 0xc5, 0x1d, 0x00, 0x82, 0xa3, 0xb2, 0xc8, 0x42, 0x40, 0x70, 0x54, 0xb2, 0x42, 0x00, 0x08,
+  0x8e, 0xca, 0xd7, 0x0a, 0x01, 0xc1, 0x51, 0xf9, 0x5c, 0x60, 0x20, 0x38, 0x4a, 0x0b, 0x01, 0x00,
+  0x04, 0x47, 0x69, 0x71, 0x07, 0x80, 0xe0, 0x28, 0x2d, 0xb2, 0x00, 0x10, 0x1c, 0xa5, 0x45, 0x16,
+  0x77, 0x82, 0xa3, 0x14, 0x25, 0x77, 0x40, 0x70, 0x94, 0x26, 0x02, 0x00, 0x08, 0x8e, 0xd2, 0xe4,
+  0x0a, 0x01, 0xc1, 0x51, 0x9a, 0xdc, 0x01, 0x20, 0x38, 0x4a, 0x69, 0x1a, 0x00, 0x04, 0x47, 0x69,
+  0x2d, 0x04, 0x80, 0xe0, 0x68, 0x25, 0x00, 0x00, 0x10, 0x1c, 0xad, 0x27, 0x0d, 0x00, 0x82, 0xa3,
+  0x35, 0x4d, 0x0a, 0x40, 0x70, 0xb4, 0xb2, 0x42, 0x00, 0x08, 0x8e, 0x56, 0x47, 0x01, 0x00, 0xc1,
+  0xd1, 0x2a, 0x03, 0x03, 0x20, 0x38, 0x5a, 0x65, 0x90, 0x05, 0x04, 0x47, 0xab, 0x0c, 0xb4, 0x90,
+  0xe0, 0x68, 0x95, 0x23, 0x30, 0x10, 0x1c, 0xad, 0xb2, 0x00, 0x00, 0x82, 0xa3, 0x55, 0x16, 0x02,
+  0x40, 0x70, 0xb4, 0xce, 0xe4, 0x00, 0x08, 0x8e, 0xd6, 0x49, 0x01, 0x00, 0xc1, 0xd1, 0x3a, 0x69,
+  0x01, 0x20, 0x38, 0x1b, 0x5c, 0x72, 0x14, 0x04, 0x67, 0x0b, 0x00, 0x00, 0x80, 0xe0, 0x6c, 0x21,
+  0x00, 0x00, 0x10, 0x9c, 0x2d, 0xa6, 0xce, 0x39, 0x83, 0xb3, 0x85, 0x15, 0x02, 0x40, 0x70, 0xb6,
+  0xb0, 0x14, 0x18, 0x08, 0xce, 0x16, 0x96, 0x06, 0x00, 0xc1, 0xd9, 0xe2, 0x08, 0x00, 0x20, 0x38,
+  0x5b, 0xdc, 0x01, 0x00, 0x04, 0x67, 0x8b, 0x3b, 0x85, 0x80, 0xe0, 0x6c, 0x71, 0x69, 0x00, 0x10,
+  0x9c, 0x2d, 0x2e, 0xad, 0x42, 0x82, 0xb3, 0xc5, 0x25, 0x57, 0x40, 0x70, 0xb6, 0x38, 0x0a, 0x00,
+  0x08, 0xce, 0x16, 0x47, 0xd3, 0x00, 0xc1, 0xd9, 0xe2, 0x68, 0x72, 0x27, 0x38, 0x5b, 0x64, 0x70,
+  0x07, 0x04, 0x67, 0x8b, 0x24, 0x00, 0x80, 0xe0, 0x6c, 0x91, 0x05, 0x00, 0x10, 0x9c, 0x2d, 0xb2,
+  0x10, 0x00, 0x82, 0xb3, 0x45, 0x16, 0x52, 0x48, 0x70, 0xb6, 0xc8, 0x34, 0x00, 0x08, 0xce, 0x16,
+  0x99, 0xdc, 0x01, 0xc1, 0xd9, 0x22, 0x93, 0xa3, 0x20, 0x38, 0x5b, 0xe4, 0x6b, 0x85, 0x04, 0x67,
+  0x8b, 0x7c, 0x75, 0xce, 0xe0, 0x6c, 0x99, 0x85, 0x00, 0x10, 0x9c, 0x2d, 0x33, 0x0d, 0x00, 0x82,
+  0xb3, 0x65, 0x52, 0x00, 0x40, 0x70, 0xb6, 0x4c, 0x9a, 0xdc, 0x09, 0xce, 0x26, 0x56, 0x64, 0x06,
+  0xc1, 0xd9, 0x34, 0x0b, 0x01, 0x20, 0x38, 0x9b, 0x26, 0x4d, 0x81, 0x05, 0x67, 0xd3, 0xa4, 0x19,
+  0x80, 0xe0, 0x6c, 0xb2, 0x69, 0x00, 0x10, 0x9c, 0x7d, 0x55, 0xbe, 0x3a, 0x03, 0x2c, 0x00, 0x00,
+  0x00, 0x40, 0x80, 0x85, 0xbd, 0x3a, 0xe7, 0x0c, 0xb0, 0x38, 0x02, 0x00, 0x00, 0x01, 0x16, 0x97,
+  0x01, 0x00, 0x20, 0xc0, 0x22, 0x05, 0x2b, 0x04, 0x04, 0x98, 0xd8, 0x6b, 0x85, 0x80, 0x00, 0x53,
+  0x03, 0x00, 0x00, 0x10, 0x60, 0x6a, 0xe9, 0x94, 0x09, 0x02, 0x7c, 0xac, 0xb8, 0x03, 0x40, 0x80,
+  0xb0, 0x38, 0x00, 0x00, 0x08, 0x10, 0x16, 0x77, 0x0a, 0x00, 0x01, 0xc2, 0xe2, 0x4e, 0x21, 0x20,
+  0x40, 0x58, 0x5c, 0x1a, 0x00, 0x04, 0x08, 0x8b, 0xa3, 0x00, 0x80, 0x00, 0x61, 0x91, 0x85, 0x00,
+  0x10, 0x20, 0x4c, 0x84, 0xa5, 0xc0, 0x02, 0x84, 0xc9, 0x11, 0x00, 0x40, 0x80, 0x30, 0xb9, 0x53,
+  0x08, 0x08, 0x10, 0x26, 0x47, 0x0b, 0x01, 0x01, 0x42, 0xc6, 0x0a, 0x01, 0x20, 0x40, 0xf8, 0x5a,
+  0x01, 0x00, 0x04, 0x08, 0x65, 0x62, 0x85, 0x80, 0x00, 0xa1, 0x74, 0x07, 0x00, 0x10, 0x20, 0x9c,
+  0x19, 0x00, 0x00, 0x02, 0x84, 0xb4, 0x4c, 0x5a, 0x48, 0x80, 0x90, 0xa2, 0x42, 0x00, 0x08, 0x90,
+  0x16, 0x47, 0x0b, 0x01, 0x01, 0xd2, 0x34, 0x82, 0x3b, 0x20, 0x40, 0x9a, 0x5e, 0x2b, 0x04, 0x04,
+  0x58, 0x93, 0x3b, 0x00, 0x80, 0x00, 0xab, 0xa3, 0x00, 0x00, 0x10, 0x60, 0x75, 0x94, 0x15, 0x02,
+  0x42, 0xac, 0xa7, 0x00, 0x00, 0x40, 0x88, 0x35, 0x05, 0x56, 0x08, 0x08, 0xb1, 0xb2, 0x42, 0x00,
+  0x00, 0x21, 0x56, 0x47, 0x00, 0x00, 0x20, 0xc4, 0xea, 0x0e, 0x2a, 0x04, 0x84, 0x58, 0x5d, 0x1a,
+  0x00, 0x80, 0x10, 0xab, 0x7b, 0x14, 0x00, 0x10, 0x62, 0x75, 0xb4, 0x10, 0x00, 0x42, 0xac, 0x8e,
+  0xb2, 0x42, 0x40, 0x88, 0x75, 0x06, 0x06, 0x00, 0x08, 0xb1, 0x4e, 0x0a, 0x00, 0x00, 0x41, 0x06,
+  0x21, 0x83, 0x3b, 0x20, 0xc8, 0x30, 0x02, 0x2b, 0x04, 0x04, 0x19, 0x46, 0x70, 0x14, 0x80, 0x20,
+  0xc3, 0x28, 0x00, 0x00, 0x10, 0x64, 0x18, 0x85, 0x00, 0x00, 0x82, 0x0c, 0xa3, 0xb8, 0x03, 0x40,
+  0x90, 0x61, 0x20, 0x00, 0x00, 0x08, 0x32, 0x0c, 0x54, 0x08, 0x00, 0x41, 0x86, 0x91, 0x1c, 0x05,
+  0x20, 0xc8, 0x30, 0x28, 0x2b, 0x04, 0x04, 0x19, 0x46, 0x06, 0x00, 0x80, 0x20, 0xc3, 0x29, 0x00,
+  0x00, 0x10, 0x64, 0x38, 0x85, 0x00, 0x00, 0x82, 0x0c, 0xa7, 0xb8, 0x03, 0x40, 0x90, 0xe1, 0xa0,
+  0x02, 0x00, 0x08, 0x32, 0x1c, 0x54, 0x08, 0x00, 0x41, 0x86, 0x83, 0xd2, 0x00, 0x20, 0xc8, 0x70,
+  0x10, 0x05, 0x00, 0x04, 0x19, 0x8e, 0x23, 0x00, 0x80, 0x20, 0xc3, 0x02, 0x00, 0x00, 0x10, 0x64,
+  0x58, 0xb3, 0x00, 0x00, 0x82, 0x0c, 0x8c, 0x00, 0x00, 0x40, 0x90, 0x81, 0x15, 0x02, 0x00, 0x08,
+  0x32, 0xb0, 0x22, 0x03, 0x03, 0x41, 0x06, 0x96, 0xdc, 0x01, 0x20, 0xc8, 0xd0, 0x00, 0x00, 0x00,
+  0x04, 0x19, 0x5a, 0x60, 0x85, 0x80, 0x20, 0x43, 0x0b, 0x2c, 0x03, 0x10, 0x64, 0x68, 0xc1, 0x01,
+  0x00, 0x82, 0x0c, 0x2d, 0xd0, 0x42, 0x40, 0x90, 0xa1, 0x15, 0x00, 0x00, 0x08, 0x32, 0xb4, 0x42,
+  0x00, 0x00, 0x41, 0x86, 0x96, 0x06, 0x00, 0x20, 0xc8, 0xd0, 0xd2, 0xab, 0x0c, 0x04, 0x19, 0xda,
+  0x93, 0xc9, 0x9d, 0x20, 0x83, 0x23, 0x00, 0x00, 0x10, 0x64, 0x70, 0x24, 0xb9, 0x03, 0x82, 0x0c,
+  0xee, 0x14, 0x02, 0x40, 0x90, 0xc1, 0xa5, 0x99, 0x1c, 0x0d, 0x32, 0x38, 0x5a, 0x08, 0x00, 0x41,
+  0x06, 0x47, 0xd3, 0x08, 0x2c, 0xc8, 0xe0, 0x68, 0x32, 0x75, 0x06, 0x19, 0x1c, 0x4d, 0xee, 0x80,
+  0x20, 0x83, 0xa3, 0xaf, 0x32, 0x10, 0x64, 0x70, 0x34, 0x03, 0x00, 0x82, 0x0c, 0xb0, 0xc8, 0xe4,
+  0x4e, 0x90, 0x01, 0x16, 0xe9, 0x0e, 0x08, 0x32, 0xc0, 0x47, 0x0b, 0x01, 0x41, 0x06, 0x09, 0x00,
+  0x00, 0x20, 0xc8, 0x20, 0x03, 0x01, 0x00, 0x04, 0x19, 0x64, 0x60, 0x85, 0x80, 0x20, 0x83, 0x0c,
+  0x2c, 0x03, 0x10, 0x64, 0x90, 0xc1, 0x01, 0x00, 0x82, 0x0c, 0x32, 0xb8, 0x42, 0x40, 0x90, 0x41,
+  0x06, 0x77, 0x00, 0x08, 0x32, 0xc8, 0xe0, 0x28, 0x00, 0x41, 0x06, 0x19, 0x68, 0x1a, 0x20, 0xc8,
+  0x20, 0x03, 0x4d, 0xee, 0x04, 0x19, 0xa4, 0x60, 0x00, 0x80, 0x20, 0x83, 0x14, 0xac, 0x00, 0x10,
+  0x64, 0x90, 0x05, 0x00, 0x00, 0x82, 0x0c, 0xb2, 0x04, 0x06, 0x40, 0x90, 0x41, 0x16, 0x02, 0x00,
+  0x08, 0x32, 0xc8, 0xe2, 0x00, 0x00, 0x41, 0x06, 0x59, 0xdc, 0x01, 0x20, 0xc8, 0x20, 0x8b, 0x4b,
+  0x03, 0x04, 0x19, 0x64, 0x71, 0x14, 0x80, 0x20, 0x83, 0x2c, 0x8e, 0xa6, 0x11, 0x64, 0x90, 0x45,
+  0xa6, 0x01, 0x82, 0x0c, 0xb2, 0xcc, 0x34, 0x40, 0x90, 0x41, 0x96, 0x49, 0x01, 0x08, 0x32, 0x48,
+  0x44, 0x93, 0x3b, 0x41, 0x06, 0x99, 0x06, 0x00, 0x20, 0xc8, 0x20, 0x93, 0xa9, 0x0c, 0x04, 0x19,
+  0x64, 0x72, 0x00, 0x80, 0x20, 0x83, 0x4c, 0x2e, 0x30, 0x10, 0x64, 0x90, 0xc9, 0x15, 0x02, 0x82,
+  0x0c, 0x32, 0xb9, 0x03, 0x40, 0x90, 0x41, 0x26, 0x47, 0xd3, 0x08, 0x32, 0xc8, 0x34, 0x0b, 0x01,
+  0x41, 0x06, 0x99, 0x66, 0x72, 0x27, 0xc8, 0x20, 0xd3, 0x4c, 0x8e, 0x06, 0x19, 0x64, 0x9a, 0x14,
+  0x80, 0x20, 0x83, 0x64, 0xc9, 0x1d, 0x10, 0x64, 0x90, 0x8e, 0x16, 0x02, 0x82, 0x0c, 0xf2, 0xb5,
+  0x32, 0x41, 0x90, 0x41, 0x3e, 0x77, 0x00, 0x08, 0x32, 0xc8, 0x27, 0x0b, 0x01, 0x41, 0x06, 0xf9,
+  0x64, 0x72, 0x27, 0xc8, 0x20, 0x5f, 0x95, 0x85, 0x04, 0x19, 0x66, 0x70, 0x07, 0x80, 0x20, 0xc3,
+  0x0c, 0x14, 0x00, 0x10, 0x64, 0x98, 0x81, 0x26, 0x77, 0x82, 0x0c, 0xb3, 0xb8, 0x03, 0x40, 0x90,
+  0x61, 0x22, 0x00, 0x00, 0x08, 0x32, 0x4c, 0x54, 0x08, 0x00, 0x41, 0x86, 0x89, 0x92, 0xa3, 0x20,
+  0xc8, 0x30, 0x51, 0x7a, 0x75, 0x06, 0x19, 0xe6, 0x02, 0x00, 0x80, 0x20, 0xc3, 0x7c, 0xee, 0x00,
+  0x10, 0x64, 0x98, 0x4f, 0x06, 0x06, 0x82, 0x0c, 0xf3, 0x51, 0x5a, 0x40, 0x90, 0x61, 0xbe, 0xca,
+  0x00, 0x08, 0x32, 0xcc, 0x59, 0x08, 0x00, 0x41, 0x86, 0x39, 0x5f, 0x9d, 0x20, 0xc8, 0x30, 0x29,
+  0x00, 0x00, 0x04, 0x19, 0x26, 0x2d, 0x04, 0x80, 0x20, 0xc3, 0xa4, 0x69, 0x00, 0x10, 0x64, 0x98,
+  0x34, 0xb9, 0x03, 0x82, 0x0c, 0x93, 0xa6, 0x57, 0x67, 0x90, 0x61, 0x52, 0x56, 0x08, 0x08, 0x32,
+  0x4c, 0xfa, 0xea, 0x04, 0x41, 0x86, 0x49, 0x33, 0x00, 0x20, 0xc8, 0x40, 0x0b, 0x01, 0x00, 0x04,
+  0x19, 0x68, 0x71, 0x07, 0x80, 0x20, 0x03, 0x2d, 0x2e, 0x0d, 0x10, 0x64, 0xa0, 0x45, 0x3a, 0x00,
+  0x82, 0x0c, 0x14, 0x01, 0x00, 0x40, 0x90, 0x81, 0xa2, 0x42, 0x00, 0x08, 0x32, 0x50, 0x64, 0x2a,
+  0x03, 0x41, 0x06, 0x8a, 0x92, 0x3b, 0x20, 0xc8, 0x40, 0x11, 0x2b, 0x04, 0x04, 0x19, 0x28, 0x7a,
+  0x95, 0x81, 0x20, 0x03, 0x45, 0x19, 0x00, 0x10, 0x64, 0xa0, 0x69, 0x00, 0x00, 0x82, 0x0c, 0x34,
+  0x8d, 0xc0, 0x40, 0x90, 0x81, 0x26, 0x02, 0x00, 0x08, 0x32, 0xd0, 0xe4, 0x00, 0x00, 0x41, 0x06,
+  0x9a, 0xdc, 0x01, 0x20, 0xc8, 0x40, 0x93, 0xa3, 0x00, 0x04, 0x19, 0x68, 0x72, 0xb4, 0x80, 0x20,
+  0x03, 0x4d, 0x8e, 0xa6, 0x11, 0x64, 0xa0, 0xac, 0x10, 0x00, 0x82, 0x0c, 0xf4, 0x55, 0x06, 0x40,
+  0x90, 0x81, 0xd2, 0x02, 0x00, 0x08, 0x32, 0x50, 0x9a, 0x1c, 0x05, 0x41, 0x06, 0x9a, 0x01, 0x00,
+  0x20, 0xc8, 0x50, 0x65, 0x72, 0x07, 0x04, 0x19, 0x6c, 0x21, 0x00, 0x80, 0x20, 0x83, 0x7d, 0xb5,
+  0x10, 0x10, 0x64, 0xb8, 0xc5, 0x15, 0x02, 0x82, 0x0c, 0x38, 0x8d, 0xc0, 0x40, 0x90, 0x21, 0x03,
+  0x00, 0x00, 0x08, 0x72, 0x84, 0x01, 0x00, 0x00, 0x41, 0x8e, 0x40, 0x0b, 0x00, 0x20, 0xc8, 0x51,
+  0x00, 0x00, 0x00, 0x04, 0x39, 0x8a, 0x2b, 0x04, 0x80, 0x20, 0x47, 0x71, 0x07, 0x00, 0x10, 0xe4,
+  0x28, 0x32, 0xd0, 0x34, 0x82, 0x24, 0x00, 0x00, 0x00, 0x40, 0x90, 0xa4, 0xb8, 0x42, 0x00, 0x08,
+  0x92, 0xa4, 0x49, 0x93, 0x03, 0x41, 0x16, 0x00, 0x00, 0x00, 0x20, 0xc8, 0x12, 0x08, 0x00, 0x00,
+  0x04, 0x59, 0x42, 0x7a, 0x0e, 0x80, 0x20, 0x4b, 0x60, 0x85, 0x00, 0x10, 0x64, 0x09, 0x2d, 0xb9,
+  0x03, 0x82, 0x2c, 0xa1, 0xbd, 0xca, 0x40, 0x90, 0x25, 0xb8, 0x11, 0x18, 0x08, 0xb2, 0x04, 0x9a,
+  0x06, 0x00, 0x41, 0x96, 0x40, 0x93, 0x03, 0x20, 0xc8, 0x32, 0x90, 0xa9, 0x13, 0x04, 0x59, 0x06,
+  0x4a, 0x0e, 0x80, 0x20, 0x0b, 0x29, 0x00, 0x00, 0x10, 0x64, 0x21, 0x85, 0x00, 0x00, 0x82, 0x2c,
+  0x85, 0xa5, 0x01, 0x40, 0x90, 0xa5, 0xb8, 0x01, 0x00, 0x08, 0xb2, 0xb0, 0x02, 0x00, 0x00, 0x41,
+  0x16, 0x56, 0x08, 0x00, 0x20, 0xc8, 0xc2, 0x8a, 0xa3, 0x00, 0x04, 0x59, 0x58, 0x99, 0x34, 0x8d,
+  0x20, 0x0b, 0x4b, 0x2e, 0x30, 0x10, 0x64, 0x61, 0xc9, 0x51, 0x00, 0x82, 0x2c, 0xec, 0x39, 0x00,
+  0x40, 0x90, 0x85, 0x51, 0x56, 0x08, 0x08, 0xb2, 0xb0, 0xea, 0x0e, 0x00, 0x41, 0x16, 0x37, 0xd2,
+  0x00, 0x20, 0xc8, 0xe2, 0x08, 0x00, 0x00, 0x04, 0x59, 0x1c, 0x49, 0x03, 0x80, 0x20, 0x8b, 0x4b,
+  0xee, 0x00, 0x10, 0x64, 0x71, 0xb1, 0x4e, 0x00, 0x82, 0x2c, 0x8e, 0x16, 0x00, 0x40, 0x90, 0xc5,
+  0xd1, 0x42, 0x00, 0x08, 0xb2, 0x38, 0x9a, 0xdc, 0x01, 0x41, 0x16, 0x47, 0x93, 0xa3, 0x20, 0xc8,
+  0xe2, 0x68, 0x7a, 0x75, 0x06, 0x59, 0x1c, 0x65, 0x85, 0x80, 0x20, 0x8b, 0xa3, 0x2c, 0xb9, 0x13,
+  0x64, 0x71, 0x34, 0x03, 0x00, 0x82, 0x2c, 0x10, 0x15, 0x00, 0x40, 0x90, 0x05, 0x26, 0x5a, 0x08,
+  0x08, 0xb2, 0xc8, 0x40, 0xd3, 0x00, 0x41, 0x16, 0x29, 0x58, 0x72, 0x27, 0xc8, 0x22, 0x0b, 0x00,
+  0x00, 0x04, 0x59, 0x64, 0x21, 0x85, 0x80, 0x20, 0x8b, 0x2c, 0xae, 0x10, 0x10, 0x64, 0x91, 0x45,
+  0x16, 0x02, 0x82, 0x2c, 0xb2, 0xc8, 0xe4, 0x68, 0x90, 0x45, 0x26, 0x02, 0x00, 0x08, 0xb2, 0xc8,
+  0xc4, 0x0a, 0x01, 0x41, 0x16, 0x99, 0xdc, 0x01, 0x20, 0xc8, 0x22, 0x93, 0xa3, 0x00, 0x04, 0x59,
+  0x64, 0x72, 0xb4, 0x80, 0x20, 0x8b, 0x4c, 0x13, 0x15, 0x12, 0x64, 0x91, 0x69, 0x52, 0x00, 0x82,
+  0x2c, 0x92, 0xa5, 0xc0, 0x40, 0x90, 0x65, 0x06, 0x5a, 0x08, 0x08, 0xb2, 0xcc, 0xe2, 0x0e, 0x00,
+  0x41, 0x96, 0x89, 0x0a, 0x01, 0x20, 0xc8, 0x42, 0x69, 0x95, 0x85, 0x04, 0x79, 0x8a, 0x23, 0x00,
+  0x80, 0x20, 0x0f, 0x0a, 0x32, 0x05, 0x16, 0xe4, 0x49, 0xc1, 0x25, 0x77, 0x82, 0x3c, 0x8f, 0x15,
+  0x02, 0x40, 0x90, 0xa7, 0xca, 0xc0, 0x00, 0x08, 0x32, 0x8d, 0x44, 0x00, 0x00, 0x41, 0x26, 0x52,
+  0x00, 0x00, 0x20, 0xc8, 0x54, 0x1c, 0x01, 0x00, 0x04, 0x99, 0x4e, 0x01, 0x00, 0x80, 0x20, 0xd3,
+  0x29, 0xee, 0x00, 0x10, 0x64, 0x3a, 0x28, 0xb9, 0x02, 0x82, 0x4c, 0xac, 0x10, 0x00, 0x40, 0x90,
+  0x89, 0x25, 0x02, 0x00, 0x08, 0x32, 0xb1, 0x64, 0x2a, 0x03, 0x41, 0x26, 0xc6, 0x0a, 0x00, 0x20,
+  0xc8, 0xc4, 0x58, 0x72, 0x07, 0x04, 0x99, 0xd8, 0x93, 0x8e, 0x82, 0x20, 0x13, 0x7b, 0xf2, 0x5d,
+  0x17, 0x64, 0x62, 0x8f, 0x16, 0x02, 0x82, 0x4c, 0xec, 0xd5, 0x09, 0x40, 0x90, 0x89, 0xbd, 0x3a,
+  0x27, 0x08, 0x32, 0xb5, 0x90, 0x56, 0x21, 0x41, 0xa6, 0x16, 0x5c, 0x99, 0x20, 0xc8, 0xd4, 0x82,
+  0x3b, 0x00, 0x04, 0x99, 0x5a, 0x21, 0x00, 0x80, 0x20, 0x53, 0x2b, 0xee, 0x00, 0x10, 0x64, 0x6a,
+  0x45, 0xbe, 0x3a, 0x83, 0x4c, 0x2d, 0x0d, 0x00, 0x40, 0x90, 0xa9, 0x25, 0x07, 0x00, 0x08, 0x32,
+  0x35, 0x48, 0x01, 0x00, 0x41, 0x26, 0x37, 0x92, 0x3b, 0x20, 0xc8, 0xe4, 0x08, 0x00, 0x00, 0x04,
+  0x99, 0x1c, 0x49, 0x03, 0x80, 0x20, 0x93, 0x23, 0xac, 0x00, 0x10, 0x64, 0x72, 0x84, 0x15, 0x02,
+  0x82, 0x4c, 0xae, 0x90, 0xb4, 0x4a, 0x90, 0xc9, 0x15, 0x77, 0x00, 0x08, 0x32, 0xb9, 0x53, 0x08,
+  0x00, 0x41, 0x26, 0x77, 0xea, 0x9c, 0x20, 0xc8, 0xe4, 0x92, 0x3b, 0x00, 0x04, 0x99, 0x5c, 0x9a,
+  0x14, 0x80, 0x20, 0x93, 0xa3, 0x00, 0x00, 0x10, 0x64, 0x72, 0xb4, 0x00, 0x00, 0x82, 0x4c, 0x8e,
+  0x16, 0x02, 0x40, 0x90, 0xc9, 0xd1, 0x34, 0x00, 0x08, 0x32, 0x39, 0x9a, 0xdc, 0x01, 0x41, 0x26,
+  0x47, 0x93, 0xa3, 0x20, 0xc8, 0xe4, 0x28, 0x0b, 0x0c, 0x04, 0x99, 0x1c, 0x65, 0x85, 0x80, 0x20,
+  0x93, 0xa3, 0xf2, 0xd5, 0x19, 0x64, 0x92, 0x45, 0xbe, 0x3a, 0x83, 0x4c, 0x32, 0x31, 0x00, 0x40,
+  0x90, 0x69, 0x16, 0x17, 0x18, 0x08, 0x32, 0xcd, 0xe2, 0x92, 0x3b, 0x41, 0xa6, 0x89, 0x0a, 0x01,
+  0x20, 0xc8, 0x34, 0x91, 0xa9, 0x0c, 0x04, 0x99, 0x26, 0x62, 0x85, 0x80, 0x20, 0xd3, 0x7c, 0x2e,
+  0x30, 0x10, 0x64, 0x9a, 0x4f, 0x16, 0x02, 0x82, 0x4c, 0x73, 0x16, 0x02, 0x40, 0x90, 0x69, 0xce,
+  0xe4, 0x0e, 0x08, 0x32, 0x4d, 0x5a, 0x08, 0x00, 0x41, 0xa6, 0x49, 0x8b, 0x2c, 0x20, 0xc8, 0x34,
+  0x29, 0x4a, 0x0e, 0x04, 0x99, 0x26, 0x4d, 0x03, 0x80, 0x20, 0xd3, 0xa4, 0x69, 0x04, 0x16, 0x64,
+  0x9a, 0x34, 0xbd, 0x3a, 0x83, 0x4c, 0x93, 0xa6, 0x77, 0x5d, 0x90, 0x69, 0xd2, 0x0c, 0x00, 0x08,
+  0x32, 0xd1, 0x02, 0x00, 0x00, 0x41, 0x26, 0x5a, 0x08, 0x00, 0x20, 0xc8, 0x44, 0x8b, 0xa9, 0x13,
+  0x04, 0x99, 0x68, 0x71, 0x00, 0x80, 0x20, 0x13, 0x2d, 0x2e, 0x30, 0x10, 0x64, 0xa2, 0xc5, 0x1d,
+  0x00, 0x82, 0x4c, 0x14, 0x15, 0x02, 0x40, 0x90, 0x89, 0xa2, 0xe4, 0x0e, 0x08, 0x32, 0xd1, 0x34,
+  0x82, 0x3b, 0x41, 0x26, 0x9a, 0x1c, 0x00, 0x20, 0xc8, 0x44, 0x93, 0x3b, 0x00, 0x04, 0x99, 0x68,
+  0x9a, 0xc9, 0x9d, 0x20, 0x13, 0xad, 0xac, 0x00, 0x10, 0x64, 0x83, 0xc9, 0x51, 0x00, 0x82, 0x6c,
+  0xf0, 0xb9, 0x03, 0x40, 0x90, 0x2f, 0x24, 0x77, 0x00, 0x08, 0xf2, 0x05, 0x56, 0x08, 0x00, 0x41,
+  0xbe, 0xc0, 0x92, 0x3b, 0x20, 0xc8, 0x17, 0x58, 0x7a, 0xb5, 0x04, 0xf9, 0x08, 0x00, 0x00, 0x80,
+  0x20, 0x1f, 0x29, 0x93, 0x16, 0x12, 0xe4, 0x23, 0xc9, 0x01, 0x00, 0x82, 0x7c, 0x24, 0xb9, 0x03,
+  0x40, 0x90, 0x8f, 0x24, 0x47, 0xd3, 0x08, 0xf2, 0x19, 0x53, 0x5f, 0x9d, 0x41, 0xbe, 0x14, 0x58,
+  0x21, 0x20, 0xc8, 0x97, 0x46, 0x1a, 0x00, 0x04, 0xf9, 0x92, 0x4b, 0xee, 0x80, 0x20, 0x5f, 0x9a,
+  0x34, 0x0d, 0x10, 0xe4, 0x5b, 0x00, 0x00, 0x00, 0x82, 0x7c, 0xab, 0x10, 0x00, 0x40, 0x90, 0x8f,
+  0x11, 0x00, 0x00, 0x08, 0xf2, 0x31, 0x92, 0x1c, 0x05, 0x41, 0x3e, 0x56, 0xdc, 0x01, 0x20, 0xc8,
+  0xc7, 0x92, 0x0b, 0x0c, 0x04, 0xf9, 0x18, 0x2b, 0x0c, 0x80, 0x20, 0x1f, 0x7b, 0x32, 0x38, 0x10,
+  0xe4, 0x63, 0x4f, 0x16, 0x02, 0x82, 0x7c, 0x0d, 0x00, 0x00, 0x40, 0x90, 0xaf, 0x05, 0x77, 0x00,
+  0x08, 0xf2, 0x35, 0xc1, 0x0a, 0x01, 0x41, 0xbe, 0x26, 0x64, 0x01, 0x20, 0xc8, 0xd7, 0x0a, 0x00,
+  0x00, 0x04, 0xf9, 0x5a, 0x21, 0x00, 0x80, 0x20, 0x5f, 0x2b, 0xa6, 0x32, 0x10, 0xe4, 0x6b, 0xc5,
+  0x1d, 0x00, 0x82, 0x7c, 0xad, 0xb8, 0x54, 0x40, 0x90, 0xaf, 0x95, 0x39, 0x00, 0x08, 0xf2, 0xb5,
+  0x34, 0x00, 0x00, 0x41, 0xbe, 0x96, 0x46, 0x60, 0x20, 0xc8, 0xd7, 0x12, 0x01, 0x00, 0x04, 0xf9,
+  0x5a, 0x62, 0x85, 0x80, 0x20, 0x5f, 0x4b, 0x0e, 0x00, 0x10, 0xe4, 0x6b, 0xc9, 0x1d, 0x00, 0x82,
+  0x7c, 0x2d, 0x39, 0x0a, 0x40, 0x90, 0xaf, 0x25, 0x47, 0x0b, 0x08, 0xf2, 0xb5, 0xe4, 0x68, 0x21,
+  0x41, 0xbe, 0xf6, 0xe4, 0xab, 0x33, 0xc8, 0xd7, 0x9e, 0xcc, 0x00, 0x04, 0xf9, 0x1a, 0x0c, 0x8e,
+  0x82, 0x20, 0x5f, 0x83, 0x14, 0x00, 0x10, 0xe4, 0x73, 0x04, 0x00, 0x00, 0x82, 0x7c, 0x8e, 0xb0,
+  0x14, 0x58, 0x90, 0xcf, 0xd1, 0x42, 0x00, 0x08, 0xf2, 0x39, 0x5a, 0xe6, 0x9c, 0x41, 0x3e, 0x47,
+  0x93, 0x3b, 0x20, 0xc8, 0xe7, 0xe8, 0x6b, 0x85, 0x04, 0xf9, 0x9e, 0x2c, 0x00, 0x80, 0x20, 0xdf,
+  0x93, 0x85, 0x00, 0x10, 0xe4, 0x7b, 0x32, 0x0d, 0x00, 0x82, 0x7c, 0x4f, 0x3a, 0x0a, 0x40, 0x90,
+  0xef, 0xc9, 0x57, 0x19, 0x08, 0xf2, 0xc9, 0xc0, 0x00, 0x00, 0x41, 0x3e, 0x19, 0x58, 0x21, 0x20,
+  0xc8, 0x27, 0x03, 0x2b, 0x73, 0x06, 0xf9, 0x64, 0x70, 0x07, 0x80, 0x20, 0x9f, 0x0c, 0x14, 0x00,
+  0x10, 0xe4, 0x93, 0x82, 0x15, 0x02, 0x82, 0x7c, 0x72, 0x24, 0x77, 0x40, 0x90, 0x4f, 0x16, 0x00,
+  0x00, 0x08, 0xf2, 0xc9, 0x42, 0x00, 0x00, 0x41, 0x3e, 0x59, 0x1c, 0x00, 0x20, 0xc8, 0x27, 0x8b,
+  0x3b, 0x00, 0x04, 0xf9, 0x64, 0x71, 0xb4, 0x90, 0x20, 0x9f, 0x2c, 0xb2, 0x10, 0x10, 0xe4, 0x93,
+  0x65, 0xa6, 0x01, 0x82, 0x7c, 0x32, 0x05, 0x0a, 0x40, 0x90, 0x4f, 0xa6, 0x01, 0x00, 0x08, 0xf2,
+  0xc9, 0x44, 0x00, 0x00, 0x41, 0x3e, 0x99, 0x1c, 0x00, 0x20, 0xc8, 0x27, 0x93, 0x0b, 0x0c, 0x04,
+  0xf9, 0x64, 0x72, 0x07, 0x80, 0x20, 0x9f, 0x4c, 0x8e, 0x02, 0x10, 0xe4, 0x93, 0xe9, 0xc9, 0x42,
+  0x82, 0x7c, 0x32, 0x4d, 0x0a, 0x40, 0x90, 0x4f, 0x3a, 0x9a, 0xdc, 0x09, 0xf2, 0xc9, 0xd7, 0x0a,
+  0x01, 0x41, 0x3e, 0xf9, 0xdc, 0x01, 0x20, 0xc8, 0x27, 0x9f, 0x4b, 0xee, 0x04, 0xf9, 0xe4, 0x9b,
+  0x69, 0x80, 0x20, 0x9f, 0x7c, 0x34, 0xb9, 0x13, 0xe4, 0x93, 0xaf, 0xce, 0x09, 0x82, 0x7c, 0xf2,
+  0xdd, 0x0c, 0x40, 0x90, 0x4f, 0xc2, 0xe4, 0x28, 0x08, 0xf2, 0xcd, 0x42, 0x00, 0x00, 0x41, 0x3e,
+  0x1a, 0x08, 0x00, 0x20, 0xc8, 0x47, 0x43, 0x2b, 0x04, 0x04, 0xf9, 0x68, 0xa0, 0x69, 0x80, 0x20,
+  0x1f, 0x0d, 0x34, 0xb9, 0x13, 0xe4, 0xa3, 0x05, 0x00, 0x00, 0x82, 0x7c, 0xb4, 0xb8, 0x03, 0x40,
+  0x90, 0x8f, 0x16, 0xf9, 0x2a, 0x0b, 0xf2, 0x51, 0x04, 0x00, 0x00, 0x41, 0x3e, 0x8a, 0x0a, 0x01,
+  0x20, 0xc8, 0x47, 0x51, 0x72, 0x07, 0x04, 0xf9, 0x68, 0x1a, 0x00, 0x80, 0x20, 0x1f, 0x4d, 0x0e,
+  0x00, 0x10, 0xe4, 0xa3, 0xc9, 0x1d, 0x00, 0x82, 0x7c, 0x34, 0x4d, 0x0a, 0x40, 0x90, 0x8f, 0xd2,
+  0xe4, 0x0e, 0x08, 0xf2, 0x51, 0x9a, 0x1c, 0x05, 0x41, 0xbe, 0x4a, 0x00, 0x00, 0x20, 0xc8, 0x57,
+  0x49, 0x72, 0x07, 0x04, 0xf9, 0x2a, 0x61, 0x85, 0x80, 0x20, 0x5f, 0x4d, 0x2e, 0xb8, 0x13, 0xe4,
+  0xab, 0x2c, 0x30, 0x00, 0x82, 0x7c, 0x55, 0x06, 0x06, 0x40, 0x90, 0xaf, 0xca, 0x40, 0x01, 0x08,
+  0xf2, 0x55, 0x59, 0x08, 0x00, 0x41, 0xbe, 0x2a, 0x4d, 0x9d, 0x20, 0xc8, 0x57, 0x65, 0x72, 0x07,
+  0x04, 0xf9, 0xaa, 0x7c, 0x75, 0x82, 0x20, 0x5f, 0x9d, 0x85, 0x00, 0x10, 0xe4, 0xab, 0x33, 0xbd,
+  0x3a, 0x83, 0x7c, 0x75, 0x52, 0x00, 0x40, 0x90, 0xaf, 0x4e, 0x5a, 0x08, 0x08, 0xf2, 0xd5, 0x49,
+  0xd3, 0x00, 0x41, 0x3e, 0x5b, 0x00, 0x00, 0x20, 0xc8, 0x67, 0x0b, 0x01, 0x00, 0x04, 0xf9, 0x6c,
+  0x71, 0x00, 0x80, 0x20, 0x9f, 0x2d, 0x8e, 0x02, 0x10, 0xe4, 0xb3, 0xc5, 0xd1, 0x34, 0x82, 0x7c,
+  0x36, 0x03, 0x00, 0x40, 0x90, 0xef, 0x06, 0x56, 0x08, 0x08, 0xf2, 0xdd, 0xe0, 0x0e, 0x00, 0x41,
+  0xbe, 0x1b, 0x64, 0x21, 0x20, 0xc8, 0x77, 0x03, 0x2d, 0x04, 0x04, 0xf9, 0x6e, 0x01, 0x00, 0x80,
+  0x20, 0xdf, 0x2d, 0x04, 0x00, 0x10, 0xe4, 0xbb, 0xc5, 0x01, 0x00, 0x82, 0x7c, 0x37, 0x0d, 0x00,
+  0x40, 0x90, 0xef, 0x26, 0x77, 0x00, 0x08, 0xf2, 0x5d, 0x77, 0x0a, 0x01, 0x41, 0xbe, 0x0c, 0x00,
+  0x00, 0x20, 0x48, 0x9a, 0x5c, 0x99, 0x13, 0x04, 0x59, 0x93, 0x23, 0x00, 0x80, 0x20, 0x2b, 0x2b,
+  0xee, 0x00, 0x10, 0x64, 0x75, 0x23, 0xbd, 0x3a, 0x83, 0xac, 0x8e, 0x00, 0x00, 0x40, 0x90, 0xd5,
+  0xd1, 0xe4, 0x0e, 0x08, 0xb2, 0xca, 0xe2, 0x0e, 0x00, 0x41, 0xd6, 0x59, 0x00, 0x00, 0x20, 0xc8,
+  0x3a, 0x93, 0x3b, 0x00, 0x04, 0x59, 0xe7, 0xbb, 0x19, 0x80, 0x20, 0xeb, 0xa4, 0xc9, 0x01, 0x10,
+  0xe6, 0x08, 0x2c, 0x03, 0x00, 0xc2, 0x1c, 0x05, 0x00, 0x00, 0x40, 0x98, 0xa3, 0x10, 0x00, 0x00,
+  0x08, 0x73, 0x14, 0x03, 0x00, 0x00, 0x61, 0x8e, 0xe2, 0x0a, 0x01, 0x20, 0xcc, 0x51, 0x64, 0x21,
+  0x00, 0x84, 0x39, 0xca, 0xac, 0x13, 0x80, 0x30, 0x47, 0x72, 0x85, 0x00, 0x10, 0xe6, 0x48, 0x93,
+  0x26, 0x77, 0xc2, 0x1c, 0x4f, 0x06, 0x77, 0x40, 0x98, 0xe3, 0x49, 0x02, 0x00, 0x08, 0x13, 0x15,
+  0x00, 0x00, 0x00, 0x61, 0xa2, 0x42, 0x00, 0x00, 0x20, 0x4c, 0x54, 0x92, 0x4b, 0xee, 0x84, 0x89,
+  0x8a, 0x23, 0x00, 0x80, 0x30, 0x51, 0x71, 0x45, 0x32, 0x10, 0x26, 0x2a, 0x2e, 0x0d, 0x00, 0xc2,
+  0x44, 0xc5, 0xd1, 0x02, 0x40, 0x98, 0xa8, 0x38, 0x9a, 0xdc, 0x09, 0x13, 0x15, 0x59, 0x08, 0x00,
+  0x61, 0xa2, 0x22, 0x4d, 0x9d, 0x20, 0x4c, 0x54, 0x64, 0x72, 0x07, 0x84, 0x89, 0x8a, 0x7c, 0x75,
+  0xce, 0x30, 0x51, 0x99, 0xb4, 0x10, 0x10, 0x26, 0x4a, 0x23, 0xbd, 0x3a, 0xc3, 0x44, 0x89, 0x15,
+  0x02, 0x40, 0x98, 0x28, 0xcd, 0x42, 0x00, 0x08, 0x13, 0x3d, 0x96, 0x01, 0x00, 0x61, 0xa2, 0x27,
+  0x0b, 0x01, 0x20, 0x4c, 0xf4, 0x28, 0x2b, 0x04, 0x84, 0x99, 0x1c, 0x01, 0x00, 0x80, 0x30, 0x61,
+  0x18, 0xe9, 0xd5, 0x19, 0x26, 0x0c, 0x2c, 0x03, 0x00, 0xc2, 0x84, 0xc1, 0x0d, 0x00, 0x40, 0x98,
+  0x30, 0xb8, 0x03, 0x00, 0x08, 0x13, 0x06, 0x47, 0x0b, 0x01, 0x61, 0xc2, 0xe0, 0x68, 0x72, 0x27,
+  0x4c, 0x18, 0x68, 0x21, 0x00, 0x84, 0x09, 0x03, 0xcd, 0x00, 0x80, 0x30, 0x61, 0xc8, 0x00, 0x00,
+  0x10, 0x26, 0x2c, 0x00, 0x00, 0x00, 0xc2, 0x84, 0x85, 0x00, 0x00, 0x40, 0x98, 0xb0, 0x90, 0x22,
+  0x0b, 0x09, 0x13, 0x16, 0x06, 0x00, 0x00, 0x61, 0xc2, 0xc2, 0x0a, 0x01, 0x20, 0x4c, 0x58, 0x58,
+  0x72, 0x07, 0x84, 0x09, 0x8b, 0x0b, 0x0c, 0x80, 0x30, 0x61, 0x71, 0x04, 0x00, 0x10, 0x26, 0x2c,
+  0xee, 0x00, 0x00, 0xc2, 0x84, 0xc5, 0xa5, 0x01, 0x40, 0x98, 0xb0, 0xb8, 0xe4, 0x0e, 0x08, 0x13,
+  0x16, 0x47, 0x01, 0x00, 0x61, 0xc2, 0xe2, 0x68, 0x01, 0x20, 0x4c, 0x58, 0x1c, 0x4d, 0x03, 0x84,
+  0x09, 0x8b, 0xa3, 0xc9, 0x9d, 0x30, 0x61, 0x71, 0x54, 0x16, 0x12, 0x26, 0x2c, 0x30, 0x0d, 0x00,
+  0xc2, 0x84, 0x45, 0x16, 0x02, 0x40, 0x98, 0xb0, 0xc8, 0x34, 0x00, 0x08, 0x13, 0x16, 0x99, 0x5e,
+  0x9d, 0x61, 0xc2, 0x22, 0x5f, 0x9d, 0x20, 0x4c, 0x58, 0x66, 0x70, 0x07, 0x84, 0x09, 0xcb, 0xa4,
+  0xc9, 0x9d, 0x30, 0x21, 0x2a, 0x8e, 0xa6, 0x11, 0x26, 0x4c, 0xc1, 0x1d, 0x00, 0xc2, 0x84, 0x69,
+  0x04, 0x0a, 0x40, 0x98, 0x30, 0x8d, 0x42, 0x00, 0x08, 0x13, 0xa6, 0x91, 0x06, 0x00, 0x61, 0xc2,
+  0x44, 0x00, 0x00, 0x20, 0x4c, 0x98, 0x58, 0x62, 0x00, 0x84, 0x09, 0x13, 0x4b, 0xaf, 0xce, 0x30,
+  0x61, 0x72, 0x03, 0x00, 0x10, 0x26, 0x4c, 0xee, 0x14, 0x02, 0xc2, 0x84, 0x49, 0x06, 0x49, 0x40,
+  0x98, 0x30, 0xc9, 0x42, 0x00, 0x08, 0x13, 0x26, 0xf9, 0x2a, 0x03, 0x61, 0xc2, 0x34, 0x0b, 0x01,
+  0x20, 0x4c, 0x98, 0x66, 0x7a, 0x75, 0x86, 0x09, 0x59, 0x21, 0x00, 0x80, 0x30, 0xe1, 0x73, 0x45,
+  0x66, 0x10, 0x26, 0x7c, 0xb2, 0x10, 0x00, 0xc2, 0x84, 0x4f, 0xba, 0x03, 0x40, 0x98, 0xf0, 0x5d,
+  0x00, 0x00, 0x08, 0x13, 0xc2, 0x64, 0x93, 0xa3, 0x61, 0x42, 0x19, 0xdc, 0x01, 0x20, 0x4c, 0x28,
+  0x83, 0xa3, 0x69, 0x84, 0x09, 0x65, 0xa0, 0x00, 0x80, 0x30, 0xa1, 0x0c, 0xb4, 0x10, 0x10, 0x26,
+  0x94, 0x05, 0x00, 0x00, 0xc2, 0x84, 0xb2, 0x10, 0x00, 0x40, 0x98, 0x50, 0x16, 0x47, 0x01, 0x08,
+  0x13, 0xca, 0x22, 0x0b, 0x01, 0x61, 0x42, 0x99, 0x06, 0x00, 0x20, 0x4c, 0x28, 0xd3, 0x08, 0x0c,
+  0x84, 0x09, 0x65, 0x72, 0x07, 0x80, 0x30, 0xa1, 0x4c, 0x8e, 0x16, 0x12, 0x26, 0x94, 0xe9, 0x55,
+  0x06, 0xc2, 0x84, 0x32, 0xc9, 0x42, 0x40, 0x98, 0x50, 0xa6, 0x99, 0x1c, 0x08, 0x13, 0xca, 0xe7,
+  0x0e, 0x00, 0x61, 0x42, 0x1a, 0x1c, 0x05, 0x20, 0x4c, 0x48, 0x0b, 0x01, 0x00, 0x84, 0x09, 0x69,
+  0x72, 0x14, 0x80, 0x30, 0x21, 0x7d, 0xad, 0x10, 0x10, 0x26, 0xa4, 0x19, 0x00, 0x00, 0xc2, 0x84,
+  0x19, 0x00, 0x00, 0x40, 0x98, 0xb3, 0x38, 0x00, 0x00, 0x08, 0x73, 0xa2, 0xe2, 0x28, 0x00, 0x61,
+  0xce, 0x34, 0xcb, 0x9c, 0x20, 0xcc, 0xf9, 0xe6, 0xab, 0x0c, 0x84, 0x39, 0x61, 0x71, 0xc9, 0x9d,
+  0x30, 0x27, 0x4c, 0x03, 0x00, 0x10, 0xe6, 0x84, 0xc9, 0x15, 0x02, 0xc2, 0x9c, 0x30, 0xb9, 0x03,
+  0x40, 0x98, 0x13, 0x26, 0x47, 0x01, 0x08, 0x73, 0xc2, 0x34, 0x51, 0x01, 0x61, 0x4e, 0xf8, 0x64,
+  0x1a, 0x20, 0xcc, 0x09, 0x5f, 0x9d, 0x13, 0x84, 0x39, 0x21, 0x4d, 0x03, 0x80, 0x30, 0x27, 0xcc,
+  0x00, 0x00, 0x10, 0xe6, 0x9c, 0xb3, 0x10, 0x00, 0xc2, 0x9c, 0x93, 0xa6, 0x01, 0x40, 0x98, 0x73,
+  0xd2, 0xe4, 0x00, 0x08, 0x73, 0x52, 0x00, 0x00, 0x00, 0x61, 0x4e, 0x1a, 0x64, 0x21, 0x20, 0xcc,
+  0x49, 0x0b, 0x00, 0x00, 0x84, 0x39, 0x69, 0x21, 0x00, 0x80, 0x30, 0x27, 0x2d, 0x0e, 0x00, 0x10,
+  0xe6, 0xa4, 0xc5, 0x15, 0x02, 0xc2, 0x9c, 0xb4, 0xb8, 0x03, 0x40, 0x98, 0x93, 0x16, 0xf7, 0xea,
+  0x0c, 0x73, 0xd2, 0x22, 0x0b, 0x01, 0x61, 0x4e, 0x5a, 0xe4, 0xab, 0x33, 0xcc, 0x49, 0xcb, 0xa4,
+  0x00, 0x84, 0x39, 0xa9, 0xa9, 0x73, 0x82, 0x30, 0x27, 0x45, 0x85, 0x00, 0x10, 0xe6, 0xa4, 0x28,
+  0xb9, 0x03, 0xc2, 0x9c, 0x14, 0xa5, 0x57, 0x67, 0x98, 0x93, 0x22, 0x96, 0x6c, 0x09, 0x73, 0xd2,
+  0x34, 0x00, 0x00, 0x61, 0x4e, 0x9a, 0x46, 0x60, 0x20, 0xcc, 0x49, 0xd3, 0x08, 0xb6, 0x84, 0x39,
+  0x69, 0x72, 0x00, 0x80, 0x30, 0x27, 0x4d, 0xae, 0x10, 0x10, 0xe6, 0xa4, 0xc9, 0x1d, 0x00, 0xc2,
+  0x9c, 0x34, 0x39, 0x5a, 0x48, 0x98, 0x93, 0x26, 0x47, 0xd3, 0x08, 0x73, 0xd2, 0x34, 0x69, 0x1a,
+  0x61, 0x4e, 0xca, 0x0a, 0x00, 0x20, 0xcc, 0x49, 0xeb, 0x08, 0xee, 0x84, 0x39, 0x69, 0x4d, 0xaf,
+  0xce, 0x30, 0x27, 0xad, 0x32, 0x30, 0x10, 0xe6, 0xa4, 0xd7, 0x51, 0x00, 0xc2, 0x9c, 0x35, 0x1d,
+  0x00, 0x40, 0x98, 0xb3, 0xca, 0x42, 0x00, 0x08, 0x73, 0xd6, 0x49, 0x01, 0x00, 0x61, 0xd2, 0x30,
+  0x00, 0x00, 0x20, 0x4c, 0x1a, 0x46, 0x7a, 0x75, 0x86, 0x49, 0x43, 0x4b, 0xee, 0x80, 0x30, 0x69,
+  0x70, 0x23, 0x30, 0x10, 0x26, 0x0d, 0xee, 0x00, 0x00, 0xc2, 0xa4, 0xc1, 0x25, 0x77, 0x40, 0x98,
+  0x34, 0xb8, 0x64, 0x0b, 0x09, 0x93, 0x06, 0x59, 0x08, 0x00, 0x61, 0xd2, 0x20, 0x4d, 0x9d, 0x20,
+  0x4c, 0x3a, 0x92, 0x3b, 0x00, 0x84, 0x49, 0x47, 0x65, 0x85, 0x80, 0x30, 0x69, 0x01, 0x00, 0x00,
+  0x10, 0x26, 0x2d, 0x04, 0x00, 0x00, 0xc2, 0xa4, 0xc5, 0xa5, 0xe0, 0x4e, 0x98, 0xb4, 0xc8, 0xc0,
+  0x00, 0x08, 0x93, 0x96, 0x59, 0x08, 0x00, 0x61, 0xd2, 0x32, 0x11, 0x2d, 0x24, 0x4c, 0x5a, 0x66,
+  0x06, 0x00, 0x84, 0x49, 0x11, 0x00, 0x00, 0x80, 0x30, 0x29, 0x0a, 0x8e, 0x02, 0x10, 0x26, 0x45,
+  0x81, 0x26, 0x47, 0xc3, 0xa4, 0x88, 0x00, 0x00, 0x40, 0x98, 0x14, 0x15, 0x02, 0x00, 0x08, 0x93,
+  0xa2, 0xe2, 0x0a, 0x00, 0x61, 0x52, 0x54, 0xdc, 0x01, 0x20, 0x4c, 0x8a, 0x8a, 0xa3, 0x00, 0x84,
+  0x49, 0x51, 0x71, 0xb4, 0x90, 0x30, 0x29, 0x2a, 0x32, 0x30, 0x10, 0x26, 0x45, 0x45, 0x26, 0x77,
+  0xc2, 0xa4, 0xa8, 0xc8, 0xd7, 0x4a, 0x98, 0x14, 0x15, 0xf9, 0xea, 0x0c, 0x93, 0xa2, 0x32, 0x69,
+  0x01, 0x61, 0x52, 0x94, 0x06, 0x00, 0x20, 0x4c, 0x8a, 0xd2, 0xa0, 0x85, 0x84, 0x49, 0x51, 0x22,
+  0x00, 0x80, 0x30, 0x29, 0x4a, 0xee, 0x00, 0x10, 0x26, 0x45, 0xc9, 0x51, 0x00, 0xc2, 0xa4, 0x28,
+  0xbd, 0xca, 0x40, 0x98, 0x14, 0xb1, 0xe4, 0x0e, 0x08, 0x93, 0x22, 0x99, 0xdc, 0x01, 0x61, 0x52,
+  0x44, 0x93, 0x2b, 0x20, 0x4c, 0x8a, 0x68, 0x72, 0x07, 0x84, 0x49, 0x11, 0x4d, 0x8e, 0x82, 0x30,
+  0x69, 0x1a, 0x81, 0x01, 0x10, 0x26, 0x4d, 0x23, 0xb8, 0x03, 0xc2, 0xa4, 0x69, 0x04, 0x47, 0x41,
+  0x98, 0x34, 0x8d, 0x42, 0x00, 0x08, 0x93, 0xa6, 0x81, 0x28, 0x00, 0x61, 0xd2, 0x34, 0x92, 0xa3,
+  0x20, 0x4c, 0x9a, 0x08, 0x00, 0x00, 0x84, 0x49, 0x93, 0x3b, 0x00, 0x80, 0x30, 0x69, 0x72, 0x69,
+  0x00, 0x10, 0x26, 0x4d, 0x2e, 0x39, 0x00, 0xc2, 0xa4, 0xc9, 0x25, 0x77, 0x40, 0x98, 0x34, 0xb9,
+  0x97, 0x01, 0x08, 0x93, 0x26, 0x47, 0x0b, 0x01, 0x61, 0xd2, 0x34, 0x29, 0x00, 0x20, 0x4c, 0x9a,
+  0x28, 0x00, 0x00, 0x84, 0x49, 0x93, 0x2d, 0x04, 0x80, 0x30, 0x69, 0xb2, 0x69, 0x00, 0x10, 0x26,
+  0x7d, 0x23, 0xb9, 0x03, 0xc2, 0xa4, 0x8f, 0x00, 0x00, 0x40, 0x98, 0xf4, 0xc9, 0xe4, 0x28, 0x08,
+  0x93, 0xca, 0x34, 0x00, 0x00, 0x61, 0x52, 0x99, 0x1c, 0x05, 0x20, 0x4c, 0x2a, 0xd3, 0x9c, 0x13,
+  0x84, 0x49, 0x69, 0x21, 0x00, 0x80, 0x30, 0x29, 0x2d, 0xee, 0x00, 0x10, 0x26, 0xa5, 0x28, 0x0d,
+  0x00, 0xc2, 0xa4, 0x34, 0x11, 0x00, 0x40, 0x98, 0x94, 0x3e, 0x59, 0x08, 0x08, 0x93, 0xd2, 0x2a,
+  0x5f, 0x9d, 0x61, 0xd2, 0x4a, 0x00, 0x00, 0x20, 0x4c, 0x5a, 0x1d, 0x01, 0x00, 0x84, 0x49, 0xab,
+  0x63, 0x85, 0x80, 0x30, 0x69, 0x95, 0x85, 0x00, 0x10, 0x26, 0xad, 0x32, 0x51, 0x00, 0xc2, 0xac,
+  0x85, 0x15, 0x02, 0x40, 0x98, 0xd5, 0x11, 0x00, 0x00, 0x08, 0xb3, 0x3a, 0xc2, 0x0a, 0x01, 0x61,
+  0x56, 0x57, 0x64, 0x60, 0x20, 0xcc, 0xea, 0x4e, 0x21, 0x00, 0x84, 0x59, 0x1d, 0x4d, 0x03, 0x80,
+  0x30, 0xab, 0xa3, 0xe9, 0xd5, 0x19, 0x66, 0x75, 0x94, 0x15, 0x02, 0xc2, 0xac, 0xb2, 0xb8, 0x03,
+  0x40, 0x98, 0x75, 0x06, 0x96, 0x06, 0x08, 0xb3, 0x4e, 0x04, 0x00, 0x00, 0x61, 0xd6, 0xb9, 0xd2,
+  0x00, 0x20, 0xcc, 0x3a, 0x69, 0x21, 0x00, 0x84, 0x59, 0x69, 0x91, 0xaf, 0xce, 0x30, 0x73, 0x60,
+  0x85, 0x00, 0x10, 0x66, 0x0e, 0x19, 0x00, 0x00, 0xc2, 0xcc, 0x23, 0x38, 0x0a, 0x40, 0x98, 0x79,
+  0x14, 0x57, 0x08, 0x08, 0x33, 0x8f, 0xe4, 0x00, 0x00, 0x61, 0xe6, 0x59, 0x1c, 0x00, 0x20, 0xcc,
+  0x3c, 0x51, 0x01, 0x00, 0x84, 0x99, 0x27, 0x2a, 0x04, 0x80, 0x30, 0xf3, 0x44, 0xa6, 0xce, 0x19,
+  0x66, 0x9e, 0xc9, 0x1d, 0x00, 0xc2, 0xcc, 0xf3, 0xc9, 0xc0, 0x40, 0x98, 0x79, 0xbe, 0x2a, 0x0b,
+  0x09, 0x33, 0xcf, 0x49, 0x93, 0x03, 0x61, 0xe6, 0x49, 0x0b, 0x01, 0x20, 0xcc, 0x3c, 0x69, 0x1a,
+  0x00, 0x84, 0x99, 0x27, 0x4d, 0xee, 0x80, 0x40, 0xc3, 0x00, 0x00, 0x00, 0x10, 0x68, 0x18, 0xc9,
+  0x1d, 0x00, 0x02, 0x0d, 0x0d, 0x00, 0x00, 0x40, 0xa0, 0xa1, 0x05, 0x77, 0x00, 0x08, 0x34, 0x38,
+  0x02, 0x00, 0x00, 0x81, 0x06, 0x47, 0xd3, 0x00, 0x20, 0xd0, 0xe0, 0x68, 0x72, 0x07, 0x04, 0x1a,
+  0x64, 0x01, 0x00, 0x80, 0x40, 0x83, 0x2c, 0x2e, 0x30, 0x10, 0x68, 0x90, 0x65, 0x8e, 0xc0, 0x02,
+  0x0d, 0x32, 0x11, 0x00, 0x40, 0xa0, 0x41, 0x26, 0x07, 0x00, 0x08, 0x34, 0xc8, 0x34, 0x63, 0x9d,
+  0x81, 0x06, 0xc9, 0x0a, 0x01, 0x20, 0xd0, 0x30, 0x51, 0x21, 0x00, 0x04, 0x1a, 0x26, 0x2d, 0x04,
+  0x80, 0x40, 0xc3, 0xa4, 0xc9, 0x51, 0x10, 0x68, 0xa0, 0x00, 0x00, 0x00, 0x02, 0x0d, 0xb4, 0x38,
+  0x5a, 0x48, 0xa0, 0x25, 0x30, 0x00, 0x00, 0x08, 0xb4, 0xb0, 0x27, 0x5f, 0x9d, 0x81, 0x16, 0x47,
+  0x00, 0x00, 0x20, 0xd0, 0xe2, 0xd2, 0x08, 0x0c, 0x04, 0x5a, 0x5c, 0x72, 0x07, 0x80, 0x40, 0x8b,
+  0xa3, 0xac, 0x10, 0x10, 0x68, 0x91, 0x81, 0xa6, 0x01, 0x02, 0x45, 0x05, 0x00, 0x00, 0x40, 0xa0,
+  0xa8, 0x10, 0x00, 0x00, 0x08, 0x14, 0x15, 0x07, 0x00, 0x00, 0x81, 0xa2, 0xe2, 0x08, 0x00, 0x20,
+  0x50, 0x54, 0x5c, 0x91, 0x04, 0x04, 0x8a, 0x8a, 0x3b, 0x00, 0x80, 0x40, 0x51, 0x71, 0x69, 0x04,
+  0x16, 0x28, 0x2a, 0x8e, 0x26, 0x77, 0x02, 0x45, 0x45, 0x92, 0x42, 0x40, 0xa0, 0x28, 0x0d, 0x9a,
+  0x02, 0x0b, 0x14, 0x25, 0x06, 0x00, 0x00, 0x81, 0xa2, 0xe4, 0x0a, 0x01, 0x20, 0x50, 0xf4, 0x62,
+  0x9d, 0x00, 0x04, 0x8a, 0x9e, 0x2c, 0x04, 0x80, 0x40, 0xd1, 0x93, 0xc9, 0x01, 0x10, 0xe8, 0x0b,
+  0xae, 0x10, 0x00, 0x02, 0x7d, 0xc1, 0x25, 0x47, 0x41, 0xa0, 0x6f, 0xa4, 0x41, 0x0b, 0x08, 0xf4,
+  0x11, 0x00, 0x00, 0x00, 0x81, 0x3e, 0x52, 0xdc, 0x01, 0x20, 0xd0, 0x47, 0x58, 0x7a, 0x95, 0x05,
+  0xfa, 0x52, 0x18, 0x00, 0x80, 0x40, 0x5f, 0x92, 0x85, 0x00, 0x10, 0xe8, 0x5b, 0x05, 0x00, 0x00,
+  0x02, 0x7d, 0xab, 0x38, 0x00, 0x40, 0xa0, 0x6f, 0x15, 0x77, 0x00, 0x08, 0xf4, 0xb1, 0x22, 0x0b,
+  0x01, 0x81, 0x3e, 0x56, 0x64, 0x72, 0x27, 0xd0, 0xc7, 0x58, 0x72, 0x07, 0x04, 0xfa, 0xd8, 0x6b,
+  0xc9, 0x9d, 0x40, 0x5f, 0x0b, 0x04, 0x00, 0x10, 0xe8, 0x6b, 0xc1, 0xd1, 0x42, 0x02, 0x7d, 0xad,
+  0x00, 0x00, 0x40, 0xa0, 0xaf, 0x15, 0x47, 0x01, 0x08, 0xf4, 0xb5, 0xe4, 0x00, 0x00, 0x81, 0xbe,
+  0x96, 0x26, 0x2a, 0x24, 0xd0, 0xd7, 0xd2, 0xa4, 0x85, 0x04, 0xfa, 0x5a, 0xb2, 0x05, 0x80, 0x40,
+  0x5f, 0x83, 0x32, 0xb9, 0x13, 0xe8, 0x73, 0x00, 0x00, 0x00, 0x02, 0x7d, 0xee, 0x14, 0x00, 0x40,
+  0xa0, 0xcf, 0x9d, 0x42, 0x00, 0x08, 0xf4, 0x39, 0x0a, 0x00, 0x00, 0x81, 0x3e, 0x47, 0x0b, 0x01,
+  0x20, 0xd0, 0xe7, 0x68, 0x1a, 0x00, 0x04, 0xfa, 0x1c, 0x65, 0x85, 0x80, 0x40, 0xdf, 0x93, 0x85,
+  0x00, 0x10, 0xe8, 0x93, 0x21, 0xb9, 0x03, 0x02, 0x7d, 0x32, 0xb0, 0xe2, 0x4e, 0xa0, 0x4f, 0x06,
+  0x77, 0x00, 0x08, 0xf4, 0xc9, 0xe0, 0x5e, 0x9d, 0x81, 0x3e, 0x19, 0x68, 0x21, 0x20, 0xd0, 0x27,
+  0x03, 0x4d, 0xee, 0x04, 0xfa, 0x64, 0xb0, 0xc9, 0x9d, 0x40, 0x9f, 0x14, 0xac, 0x10, 0x10, 0xe8,
+  0x93, 0x85, 0x00, 0x00, 0x02, 0x7d, 0xb2, 0x90, 0x42, 0x40, 0xa0, 0x4f, 0x16, 0x07, 0x00, 0x08,
+  0xf4, 0xc9, 0xe2, 0x0e, 0x00, 0x81, 0x3e, 0x99, 0x06, 0x00, 0x20, 0xd0, 0x27, 0x13, 0x01, 0x00,
+  0x04, 0xfa, 0x64, 0x3a, 0x00, 0x80, 0x40, 0x9f, 0x4c, 0xb4, 0x10, 0x10, 0xe8, 0x93, 0x4f, 0x16,
+  0x02, 0x02, 0x7d, 0xf2, 0xc9, 0x32, 0x41, 0xa0, 0x8f, 0x06, 0x17, 0x18, 0x08, 0xf4, 0x51, 0x54,
+  0x08, 0x00, 0x81, 0x3e, 0x9a, 0xdc, 0x01, 0x20, 0xd0, 0x47, 0x9f, 0x2c, 0x04, 0x04, 0xfa, 0x68,
+  0x06, 0x00, 0x80, 0x40, 0x5f, 0x4d, 0x33, 0x0d, 0x10, 0xe8, 0xab, 0xac, 0x00, 0x00, 0x02, 0x7d,
+  0x55, 0x16, 0x02, 0x40, 0xa0, 0xaf, 0xce, 0x57, 0x19, 0x08, 0xf4, 0x55, 0x5c, 0x08, 0x00, 0x81,
+  0x3e, 0x5b, 0x1c, 0x00, 0x20, 0xd0, 0x67, 0x9f, 0xcc, 0x00, 0x04, 0xfa, 0x2e, 0x00, 0x00, 0x80,
+  0x40, 0xdf, 0x2d, 0x04, 0x00, 0x10, 0xa8, 0x0c, 0x82, 0x65, 0x00, 0x02, 0x95, 0x61, 0x04, 0x06,
+  0x40, 0xa0, 0x32, 0x8c, 0x14, 0x18, 0x08, 0x54, 0x16, 0x02, 0x00, 0x00, 0x81, 0xca, 0xe2, 0x28,
+  0x00, 0x20, 0x50, 0x59, 0x1c, 0x2d, 0x04, 0x04, 0x2a, 0xd3, 0x08, 0x0c, 0x80, 0x40, 0x65, 0x72,
+  0x07, 0x00, 0x10, 0xa8, 0x4c, 0x8f, 0xa6, 0xc0, 0x02, 0x95, 0x49, 0x06, 0x06, 0x40, 0xa0, 0x32,
+  0x4d, 0x5a, 0x08, 0x08, 0x54, 0x26, 0x0a, 0x00, 0x00, 0x81, 0xca, 0xf6, 0xaa, 0x2c, 0x24, 0x50,
+  0xf9, 0x64, 0x21, 0x00, 0x04, 0x2a, 0xdf, 0x05, 0x00, 0x80, 0x40, 0x25, 0x2d, 0x00, 0x00, 0x10,
+  0xa8, 0xa4, 0x34, 0x0d, 0x00, 0x02, 0x95, 0xb6, 0xb8, 0x03, 0x40, 0xa0, 0x34, 0x08, 0x96, 0x1c,
+  0x08, 0x94, 0xa2, 0x42, 0x00, 0x00, 0x81, 0x52, 0x54, 0x1c, 0x05, 0x20, 0x50, 0x8a, 0x92, 0x03,
+  0x00, 0x04, 0x4a, 0xd3, 0x48, 0xee, 0x80, 0x40, 0x69, 0x95, 0x06, 0x00, 0x10, 0xaa, 0x08, 0x8e,
+  0x02, 0x00, 0x42, 0x15, 0x69, 0x00, 0x00, 0x40, 0xa8, 0x22, 0xcd, 0x02, 0x00, 0x08, 0x55, 0xa4,
+  0x99, 0x46, 0x60, 0xa1, 0x8a, 0x44, 0x93, 0x3b, 0x20, 0x54, 0xc1, 0x8a, 0x3b, 0x00, 0x84, 0x2a,
+  0xd8, 0x73, 0x34, 0x8d, 0x50, 0x05, 0x7b, 0x95, 0x01, 0x10, 0xaa, 0x78, 0xb2, 0x10, 0x00, 0x42,
+  0x15, 0x32, 0x39, 0x00, 0x40, 0xa8, 0x23, 0xb8, 0x53, 0x08, 0x08, 0x75, 0x14, 0x37, 0x0a, 0x01,
+  0xa1, 0x8e, 0x32, 0x69, 0x72, 0x27, 0xd4, 0xf1, 0x6e, 0x60, 0x85, 0x84, 0x4a, 0xca, 0x2c, 0x04,
+  0x80, 0x50, 0x4f, 0x71, 0x07, 0x00, 0x10, 0xea, 0x29, 0xf2, 0xd5, 0x09, 0x42, 0x3d, 0x88, 0x02,
+  0x00, 0x40, 0xa8, 0x27, 0xb9, 0x01, 0x00, 0x08, 0xf5, 0x54, 0x59, 0x08, 0x00, 0xa1, 0xa6, 0x91,
+  0xdc, 0x01, 0x20, 0xd4, 0x74, 0x92, 0xa9, 0x13, 0x84, 0x9a, 0x58, 0x21, 0x00, 0x80, 0x50, 0x13,
+  0x7b, 0xf2, 0xd5, 0x19, 0x6a, 0x72, 0x04, 0x00, 0x00, 0x42, 0x4d, 0x8e, 0xb0, 0x0c, 0x40, 0xa8,
+  0xc9, 0x9d, 0x42, 0x00, 0x08, 0x35, 0xb9, 0xe4, 0x0e, 0x00, 0xa1, 0x26, 0x97, 0xe6, 0x9c, 0x33,
+  0xd4, 0xe4, 0x68, 0x21, 0x00, 0x84, 0x9a, 0x1c, 0x4d, 0x03, 0x80, 0x50, 0x93, 0xa3, 0xc9, 0x51,
+  0x10, 0x6a, 0x72, 0x94, 0x01, 0x00, 0x42, 0x4d, 0x8e, 0xb2, 0x42, 0x40, 0xa8, 0x69, 0xae, 0x14,
+  0x18, 0x08, 0x35, 0xcd, 0xc9, 0x92, 0x3b, 0xa1, 0xa6, 0x39, 0x29, 0x00, 0x20, 0xd4, 0x34, 0x69,
+  0x21, 0x00, 0x84, 0x9a, 0x26, 0x4d, 0xee, 0x80, 0x50, 0xd3, 0xa4, 0xac, 0x10, 0x10, 0x6a, 0xa2,
+  0xa8, 0x10, 0x00, 0x42, 0x4d, 0x14, 0x25, 0x77, 0x40, 0xa8, 0x89, 0xa6, 0x49, 0x0b, 0x09, 0x35,
+  0xd1, 0x49, 0x8b, 0x03, 0xa1, 0xb2, 0x30, 0xd2, 0x00, 0x20, 0x54, 0x16, 0x1c, 0x2d, 0x04, 0x84,
+  0xca, 0x46, 0x72, 0x07, 0x80, 0x50, 0x19, 0x29, 0x32, 0x30, 0x10, 0x2a, 0x23, 0xc9, 0x1d, 0x00,
+  0x42, 0x65, 0x84, 0x15, 0x00, 0x40, 0xa8, 0xcc, 0x54, 0x56, 0x00, 0x08, 0x95, 0xa5, 0xe0, 0x0e,
+  0x00, 0xa1, 0xb2, 0x34, 0x92, 0xa3, 0x20, 0x54, 0x96, 0xdc, 0x01, 0x00, 0x84, 0xca, 0x5a, 0xa0,
+  0x00, 0x80, 0x50, 0xd9, 0x93, 0x85, 0x00, 0x10, 0x2a, 0x9b, 0xa8, 0x10, 0x00, 0x42, 0x6d, 0x81,
+  0x16, 0x02, 0x40, 0xa8, 0x4d, 0x04, 0x77, 0x00, 0x08, 0xb5, 0xa5, 0x11, 0x18, 0x00, 0xa1, 0xb6,
+  0x34, 0x82, 0x3b, 0x20, 0xd4, 0x96, 0x06, 0x2a, 0x04, 0x84, 0xda, 0xd2, 0x48, 0x03, 0x80, 0x50,
+  0x5b, 0x6a, 0xaf, 0xce, 0x19, 0x6a, 0x4b, 0x2e, 0x0d, 0x00, 0x42, 0x6d, 0x4f, 0x16, 0x59, 0x48,
+  0xa8, 0x0d, 0xa6, 0x11, 0x18, 0x08, 0xb5, 0xc1, 0xe4, 0x0e, 0x00, 0xa1, 0x36, 0xf8, 0xdc, 0x01,
+  0x20, 0xd4, 0x06, 0x5f, 0x9d, 0x00, 0x84, 0xda, 0x20, 0x2d, 0x04, 0x80, 0x50, 0x1b, 0xa4, 0xc9,
+  0x1d, 0x10, 0xaa, 0x0b, 0xee, 0x14, 0x00, 0x42, 0x75, 0xa4, 0x10, 0x00, 0x40, 0xa8, 0x8e, 0x94,
+  0x59, 0x08, 0x08, 0xd5, 0x91, 0x34, 0x00, 0x00, 0xa1, 0x3a, 0x92, 0x1c, 0x00, 0x20, 0x54, 0x47,
+  0x58, 0x91, 0x85, 0x84, 0xea, 0x88, 0x0c, 0x0c, 0x80, 0x50, 0x5d, 0x01, 0x00, 0x00, 0x10, 0xaa,
+  0x2b, 0xee, 0x00, 0x00, 0x42, 0x75, 0x45, 0x16, 0x02, 0x40, 0xa8, 0xae, 0xc8, 0xe2, 0x0e, 0x08,
+  0xd5, 0x3d, 0x99, 0x5e, 0x65, 0xa1, 0xc2, 0x34, 0x0b, 0x01, 0x20, 0x54, 0x98, 0x66, 0x72, 0x07,
+  0x84, 0x0a, 0x65, 0x01, 0x00, 0x80, 0x50, 0xa1, 0x2c, 0x14, 0x00, 0x10, 0xaa, 0x0c, 0x04, 0x00,
+  0x00, 0x42, 0x95, 0xe1, 0x94, 0x39, 0x41, 0xa8, 0x32, 0x30, 0x00, 0x00, 0x08, 0x55, 0x06, 0x56,
+  0x00, 0x00, 0xa1, 0xca, 0xe0, 0x82, 0x2c, 0x24, 0x54, 0x19, 0xdc, 0x01, 0x00, 0x84, 0x2a, 0x83,
+  0x4b, 0x8e, 0x82, 0x50, 0x65, 0x90, 0x85, 0x00, 0x10, 0xaa, 0x0c, 0x32, 0x0d, 0x00, 0x42, 0x95,
+  0x41, 0x3e, 0x77, 0x40, 0xa8, 0x32, 0xd0, 0xf4, 0xea, 0x0c, 0x55, 0x06, 0xca, 0x92, 0x3b, 0xa1,
+  0x4a, 0x21, 0x0b, 0x01, 0x20, 0x54, 0x39, 0x8a, 0x03, 0x00, 0x84, 0x2a, 0x47, 0x95, 0xc9, 0x9d,
+  0x50, 0x25, 0x01, 0x00, 0x00, 0x10, 0xaa, 0x24, 0xc5, 0x1d, 0x00, 0x42, 0x95, 0xa4, 0x4c, 0x0a,
+  0x40, 0xa8, 0x92, 0x24, 0x77, 0x00, 0x08, 0x55, 0x92, 0xe4, 0x92, 0x3b, 0xa1, 0x4a, 0x92, 0x01,
+  0x00, 0x20, 0x54, 0x59, 0x00, 0x00, 0x00, 0x84, 0x2a, 0x0b, 0x01, 0x00, 0x80, 0x50, 0x65, 0x61,
+  0x00, 0x00, 0x10, 0xaa, 0x2c, 0xac, 0x10, 0x00, 0x42, 0x95, 0xc5, 0x8d, 0xe0, 0x68, 0xa8, 0xb2,
+  0x38, 0x02, 0x00, 0x08, 0x55, 0x16, 0x57, 0x08, 0x00, 0xa1, 0xca, 0xe2, 0x0e, 0x00, 0x20, 0x54,
+  0x59, 0x5c, 0x72, 0x07, 0x84, 0x2a, 0x8b, 0xa3, 0x00, 0x80, 0x50, 0x65, 0x71, 0xb4, 0x10, 0x10,
+  0xaa, 0x2c, 0x8e, 0x26, 0x77, 0x42, 0x95, 0x45, 0x06, 0x06, 0x40, 0xa8, 0xb2, 0x48, 0xf9, 0xea,
+  0x0c, 0x55, 0x96, 0x99, 0x02, 0x03, 0xa1, 0xca, 0x32, 0xd3, 0x00, 0x20, 0x54, 0x59, 0x26, 0xcb,
+  0x00, 0x84, 0x2a, 0xcb, 0xa4, 0x00, 0x80, 0x50, 0xe5, 0x29, 0x04, 0x00, 0x10, 0xaa, 0x3c, 0xc5,
+  0x01, 0x00, 0x42, 0x95, 0xa7, 0xb8, 0x03, 0x40, 0xa8, 0x32, 0x85, 0x01, 0x00, 0x08, 0x55, 0xa6,
+  0x01, 0x00, 0x00, 0xa1, 0xca, 0x34, 0x82, 0x3b, 0x20, 0x54, 0x99, 0x46, 0x70, 0x14, 0x84, 0x2a,
+  0xd3, 0x40, 0x85, 0x80, 0x50, 0x65, 0x1a, 0xc9, 0x1d, 0x10, 0xaa, 0x4c, 0x23, 0xbd, 0x3a, 0x43,
+  0x95, 0x69, 0x24, 0x5a, 0x40, 0xa8, 0x32, 0x11, 0x00, 0x00, 0x08, 0x55, 0x26, 0x92, 0x46, 0x60,
+  0xa1, 0xca, 0xc4, 0x0a, 0x01, 0x20, 0x54, 0x99, 0x58, 0x1a, 0x81, 0x85, 0x2a, 0x93, 0x03, 0x00,
+  0x80, 0x50, 0x65, 0x72, 0x04, 0x00, 0x10, 0xaa, 0x4c, 0xee, 0x14, 0x02, 0x42, 0x95, 0xc9, 0xa5,
+  0x01, 0x40, 0xa8, 0x32, 0x39, 0x0a, 0x00, 0x08, 0x55, 0x26, 0x47, 0x93, 0x3b, 0xa1, 0xca, 0xf4,
+  0x64, 0x70, 0x25, 0x54, 0x99, 0x64, 0x21, 0x00, 0x84, 0x2a, 0xd3, 0x2c, 0x00, 0x80, 0x50, 0x65,
+  0x9a, 0x85, 0x00, 0x10, 0xaa, 0x4c, 0xf3, 0x39, 0x5a, 0x42, 0x95, 0x69, 0xd2, 0x42, 0x40, 0xa8,
+  0x32, 0x4d, 0x9a, 0x06, 0x08, 0x55, 0xa6, 0x49, 0x93, 0x03, 0xa1, 0xca, 0x34, 0x69, 0x72, 0x34,
+  0x54, 0x99, 0x6c, 0x90, 0x85, 0x84, 0x2a, 0x93, 0x2d, 0x04, 0x80, 0x50, 0xe5, 0x02, 0x00, 0x00,
+  0x10, 0xaa, 0x5c, 0x85, 0x00, 0x00, 0x42, 0x95, 0x4d, 0xb0, 0x42, 0x40, 0xa8, 0xb2, 0x15, 0x47,
+  0x01, 0x08, 0x55, 0xb6, 0x34, 0x00, 0x00, 0xa1, 0xca, 0x96, 0x6c, 0x21, 0x20, 0x54, 0xd9, 0x32,
+  0x00, 0x00, 0x84, 0x2a, 0x9f, 0x60, 0x69, 0x80, 0x50, 0xe5, 0x1b, 0xc9, 0x51, 0x10, 0xaa, 0x7c,
+  0xac, 0x10, 0x00, 0x42, 0x95, 0xaf, 0xa5, 0x01, 0x40, 0xa8, 0xf2, 0xb5, 0xe7, 0x00, 0x08, 0x55,
+  0xbe, 0xf6, 0x2a, 0x03, 0xa1, 0xca, 0xd7, 0x5e, 0x9d, 0x20, 0x54, 0xf9, 0x5c, 0x21, 0x00, 0x84,
+  0x2a, 0x9f, 0x0c, 0x0c, 0x80, 0x50, 0xe5, 0x93, 0x85, 0x00, 0x10, 0xaa, 0x7c, 0x32, 0x0d, 0x00,
+  0x42, 0x95, 0x8f, 0x16, 0x02, 0x40, 0xa8, 0x52, 0x86, 0x49, 0x01, 0x08, 0x55, 0xca, 0x42, 0x00,
+  0x00, 0xa1, 0x4a, 0xc9, 0xea, 0x9c, 0x20, 0x54, 0x29, 0x9f, 0x3b, 0x00, 0x84, 0x2a, 0x27, 0x4a,
+  0x03, 0x80, 0x50, 0xe5, 0x9c, 0x34, 0x39, 0x1a, 0xaa, 0xa4, 0x85, 0x00, 0x00, 0x42, 0x95, 0x14,
+  0x15, 0x02, 0x40, 0xa8, 0x92, 0xa2, 0x0c, 0x00, 0x08, 0x55, 0xd2, 0x44, 0x00, 0x00, 0xa1, 0x4a,
+  0x9a, 0xdc, 0x01, 0x20, 0x54, 0x49, 0x93, 0xa3, 0x00, 0x84, 0x2a, 0x69, 0x72, 0xb4, 0x90, 0x50,
+  0x25, 0x4d, 0x8e, 0xa6, 0x11, 0xaa, 0xa4, 0xe9, 0x55, 0x06, 0x42, 0x95, 0x34, 0xcd, 0x32, 0x67,
+  0xa8, 0x92, 0xbe, 0x3a, 0x01, 0x08, 0x55, 0x56, 0xe9, 0x0e, 0x00, 0xa1, 0x4a, 0x5b, 0x00, 0x00,
+  0x20, 0x54, 0x69, 0x8b, 0x03, 0x00, 0x84, 0x3a, 0x47, 0xb2, 0x85, 0x80, 0x50, 0x27, 0x0a, 0xac,
+  0x10, 0x10, 0xea, 0x44, 0x81, 0x16, 0x02, 0x42, 0x9d, 0xa8, 0xc8, 0x02, 0x40, 0xa8, 0x13, 0xa5,
+  0x01, 0x00, 0x08, 0x75, 0x3e, 0x56, 0x08, 0x00, 0xa1, 0xce, 0xe7, 0x68, 0x21, 0x20, 0xd4, 0xf9,
+  0x64, 0x01, 0x00, 0x84, 0x3a, 0x61, 0x71, 0x14, 0x80, 0x50, 0x27, 0x4c, 0xee, 0x00, 0x10, 0xea,
+  0x84, 0xe9, 0xd5, 0x39, 0x43, 0x9d, 0x90, 0x26, 0x77, 0x40, 0xa8, 0x73, 0xd2, 0x42, 0x00, 0x08,
+  0x75, 0x52, 0x00, 0x00, 0x00, 0xa1, 0x4e, 0x5a, 0x00, 0x00, 0x20, 0xd4, 0x49, 0x0b, 0x01, 0x00,
+  0x84, 0x3a, 0x69, 0x31, 0x75, 0x82, 0x50, 0x27, 0x2d, 0x0e, 0x00, 0x10, 0xea, 0xa4, 0xc5, 0x1d,
+  0x00, 0x42, 0x9d, 0xb4, 0xc8, 0x42, 0x40, 0xa8, 0x93, 0x96, 0x59, 0x08, 0x08, 0x75, 0xd2, 0x32,
+  0xd3, 0x00, 0xa1, 0x4e, 0x8a, 0x00, 0x00, 0x20, 0xd4, 0x49, 0x51, 0x01, 0x00, 0x84, 0x3a, 0x29,
+  0x2a, 0x04, 0x80, 0x50, 0x27, 0x45, 0x69, 0x00, 0x10, 0xea, 0xa4, 0x28, 0xbd, 0xca, 0x42, 0x9d,
+  0x14, 0xd1, 0x42, 0x40, 0xa8, 0x93, 0xa6, 0x01, 0x00, 0x08, 0x75, 0xd2, 0x44, 0x00, 0x00, 0xa1,
+  0x4e, 0x9a, 0x1c, 0x00, 0x20, 0xd4, 0x49, 0x93, 0x3b, 0x00, 0x84, 0x3a, 0x69, 0x72, 0x14, 0x80,
+  0x50, 0x27, 0x4d, 0x8e, 0x16, 0x12, 0xea, 0xa4, 0x69, 0x26, 0x77, 0x42, 0x9d, 0x34, 0xd1, 0x42,
+  0x40, 0xa8, 0x93, 0xd2, 0xe4, 0x0e, 0x08, 0x75, 0xd2, 0x2a, 0x5f, 0x9d, 0xa1, 0x4e, 0x7a, 0x03,
+  0x05, 0x20, 0xd4, 0x49, 0x33, 0x00, 0x00, 0x84, 0x4a, 0x03, 0x01, 0x00, 0x80, 0x50, 0x69, 0x60,
+  0x05, 0x00, 0x10, 0x2a, 0x0d, 0xac, 0x10, 0x00, 0x42, 0xa5, 0xa1, 0xa5, 0x57, 0x67, 0xa8, 0x34,
+  0xb8, 0x42, 0x00, 0x08, 0x95, 0x06, 0x97, 0x5e, 0x9d, 0xa1, 0xd2, 0xe0, 0x28, 0x00, 0x20, 0x54,
+  0x1a, 0x68, 0x1a, 0x00, 0x84, 0x4a, 0x0b, 0x00, 0x00, 0x80, 0x50, 0x69, 0x21, 0x00, 0x00, 0x10,
+  0x2a, 0x2d, 0x2c, 0x03, 0x00, 0x42, 0xa5, 0xc5, 0x11, 0x00, 0x40, 0xa8, 0xb4, 0xc8, 0x42, 0x00,
+  0x08, 0x95, 0x22, 0x00, 0x00, 0x00, 0xa1, 0x52, 0x14, 0x08, 0x00, 0x20, 0x54, 0x8a, 0x82, 0xa3,
+  0x85, 0x84, 0x4a, 0x51, 0xa0, 0x00, 0x80, 0x50, 0x29, 0x2a, 0x00, 0x00, 0x10, 0x2a, 0x45, 0x85,
+  0x00, 0x00, 0x42, 0xa5, 0xa8, 0x38, 0x00, 0x40, 0xa8, 0x14, 0x15, 0x77, 0x00, 0x08, 0x95, 0xa2,
+  0xe2, 0x28, 0x00, 0xa1, 0x52, 0x54, 0xe4, 0xab, 0x2c, 0x54, 0x8a, 0xca, 0x4c, 0x8e, 0x86, 0x4a,
+  0x51, 0x99, 0x34, 0x8d, 0x50, 0x29, 0x4a, 0x03, 0x00, 0x10, 0x2a, 0x45, 0x89, 0x00, 0x00, 0x42,
+  0xa5, 0x28, 0x39, 0x00, 0x40, 0xa8, 0x14, 0x25, 0x77, 0x00, 0x08, 0x95, 0xa2, 0x34, 0x0b, 0x01,
+  0xa1, 0x52, 0xc4, 0x92, 0x3b, 0x20, 0x54, 0x8a, 0x68, 0x1a, 0x00, 0x84, 0x4a, 0x11, 0x4d, 0x8e,
+  0x82, 0x50, 0x29, 0xca, 0x00, 0x00, 0x10, 0x2a, 0x4d, 0x03, 0x00, 0x00, 0x42, 0xa5, 0x69, 0x04,
+  0x9a, 0x46, 0xa8, 0x34, 0x0d, 0x9a, 0xdc, 0x09, 0x95, 0x26, 0x02, 0x00, 0x00, 0xa1, 0xd2, 0xe4,
+  0x08, 0x00, 0x20, 0x54, 0x9a, 0x1c, 0x4d, 0xee, 0x84, 0x4a, 0x93, 0xa3, 0xc9, 0xd1, 0x50, 0x69,
+  0x7a, 0xad, 0x10, 0x10, 0x2a, 0x4d, 0xcf, 0x01, 0x00, 0x42, 0xa5, 0x69, 0x16, 0x02, 0x40, 0xa8,
+  0x34, 0x4d, 0x9a, 0x06, 0x08, 0x95, 0x26, 0x5b, 0x08, 0x00, 0xa1, 0xd2, 0x27, 0xdd, 0x01, 0x20,
+  0x54, 0x2a, 0xc3, 0xa4, 0x85, 0x84, 0x4a, 0x65, 0x21, 0x00, 0x80, 0x50, 0x29, 0x4d, 0x04, 0x00,
+  0x10, 0x2a, 0xad, 0x32, 0x50, 0x00, 0x42, 0xa5, 0x55, 0x16, 0x00, 0x40, 0xa8, 0xb4, 0xca, 0xe4,
+  0x0e, 0x08, 0x95, 0x56, 0xe9, 0x28, 0x00, 0xa1, 0xe2, 0x2a, 0x03, 0x2d, 0x20, 0x54, 0x5c, 0x65,
+  0x21, 0x00, 0x84, 0x8a, 0xab, 0x34, 0x95, 0x81, 0x50, 0x71, 0x95, 0x69, 0x04, 0x16, 0x2a, 0xae,
+  0x93, 0x52, 0x00, 0x42, 0xc5, 0x19, 0x00, 0x00, 0x40, 0xb0, 0x61, 0xa0, 0x34, 0x00, 0x08, 0x36,
+  0x31, 0x02, 0x00, 0x00, 0xc1, 0x26, 0xc6, 0x0a, 0x01, 0x20, 0xd8, 0xd4, 0x92, 0x3b, 0x00, 0x04,
+  0x9b, 0x1a, 0x44, 0xb4, 0x90, 0x60, 0x93, 0x1b, 0xc9, 0x1d, 0x10, 0x6c, 0x72, 0x04, 0x00, 0x00,
+  0x82, 0x4d, 0x8e, 0x14, 0x02, 0x40, 0xb0, 0xc9, 0x91, 0xe4, 0x0e, 0x08, 0x36, 0xb9, 0x53, 0x08,
+  0x00, 0xc1, 0x26, 0x97, 0x06, 0x00, 0x20, 0xd8, 0xe4, 0x68, 0x21, 0x00, 0x04, 0x9b, 0x1c, 0x4d,
+  0x23, 0xb0, 0x60, 0x93, 0xa3, 0xc9, 0x01, 0x10, 0x6c, 0x72, 0x34, 0xb9, 0x03, 0x82, 0x4d, 0x8e,
+  0xbe, 0x3a, 0x41, 0xb0, 0x69, 0xa2, 0x42, 0x00, 0x08, 0x36, 0xcd, 0xd7, 0x0a, 0x01, 0xc1, 0xa6,
+  0x39, 0x0b, 0x01, 0x20, 0xd8, 0x34, 0x69, 0x09, 0x8e, 0x06, 0x9b, 0x68, 0x91, 0x85, 0x80, 0x60,
+  0x13, 0x4d, 0x0e, 0x00, 0x10, 0x6c, 0xa2, 0x69, 0x26, 0x07, 0x82, 0x4d, 0x94, 0xa6, 0x32, 0x41,
+  0xb0, 0x4f, 0x16, 0x02, 0x00, 0x08, 0xf6, 0xc9, 0xe2, 0x0e, 0x00, 0xc1, 0x3e, 0x99, 0xdc, 0x01,
+  0x20, 0xd8, 0x27, 0x9f, 0x3b, 0x00, 0x04, 0xfb, 0xaa, 0x34, 0x75, 0xce, 0x60, 0xab, 0x23, 0xac,
+  0x10, 0x10, 0x6e, 0x18, 0x81, 0x26, 0x77, 0xc2, 0x0d, 0xa3, 0xb8, 0x03, 0x40, 0xb8, 0xe1, 0x14,
+  0x00, 0x00, 0x08, 0x37, 0x9c, 0xe2, 0x28, 0x00, 0xe1, 0x86, 0xe4, 0x4e, 0x21, 0x20, 0xdc, 0xc0,
+  0x8a, 0x4c, 0x8e, 0x86, 0x1b, 0x5a, 0x21, 0x00, 0x80, 0x70, 0x43, 0x4b, 0xee, 0x00, 0x10, 0x6e,
+  0x70, 0x04, 0x00, 0x00, 0xc2, 0x0d, 0x8e, 0x16, 0x02, 0x40, 0xb8, 0xc1, 0xd1, 0x14, 0x18, 0x08,
+  0x37, 0x38, 0x9a, 0xdc, 0x01, 0xe1, 0x06, 0x47, 0x93, 0xa3, 0x20, 0xdc, 0x20, 0x83, 0xa3, 0x00,
+  0x84, 0x1b, 0x64, 0x21, 0x00, 0x80, 0x70, 0x83, 0x2c, 0xee, 0x00, 0x10, 0x6e, 0x90, 0x69, 0x04,
+  0x06, 0xc2, 0x0d, 0x32, 0x39, 0x00, 0x40, 0xb8, 0x41, 0x26, 0x77, 0x00, 0x08, 0x37, 0xc8, 0x2a,
+  0xd3, 0x00, 0xe1, 0x86, 0x59, 0x00, 0x00, 0x20, 0xdc, 0x30, 0x5f, 0x9d, 0x13, 0x84, 0x1b, 0x26,
+  0x0d, 0xb2, 0x90, 0x70, 0xc3, 0xa4, 0x69, 0x04, 0x16, 0x6e, 0x98, 0x34, 0xb9, 0x03, 0xc2, 0x0d,
+  0x93, 0xa6, 0x57, 0x67, 0xb8, 0x61, 0xd2, 0x0c, 0x00, 0x08, 0x37, 0x50, 0x54, 0x08, 0x00, 0xe1,
+  0x06, 0x8a, 0x58, 0x21, 0x20, 0xdc, 0x40, 0xd3, 0x00, 0x00, 0x84, 0x1b, 0x28, 0x4b, 0xee, 0x80,
+  0x70, 0x03, 0x7d, 0x8e, 0x02, 0x10, 0x6e, 0xb0, 0x85, 0x00, 0x00, 0xc2, 0x0d, 0x3a, 0x4d, 0x0a,
+  0x40, 0xb8, 0x05, 0x00, 0x00, 0x00, 0x08, 0xb7, 0x04, 0x96, 0xdc, 0x01, 0xe1, 0x96, 0xe0, 0x00,
+  0x00, 0x20, 0xdc, 0x12, 0x1c, 0x01, 0x00, 0x84, 0x5b, 0x82, 0x4b, 0xee, 0x80, 0x70, 0x0b, 0x29,
+  0x8e, 0xa6, 0x11, 0x6e, 0x21, 0x65, 0x52, 0x00, 0xc2, 0x2d, 0x85, 0x00, 0x00, 0x40, 0xb8, 0xa5,
+  0xb8, 0x03, 0x00, 0x08, 0xb7, 0x94, 0x49, 0x01, 0x00, 0xe1, 0x16, 0x63, 0x00, 0x00, 0x20, 0xdc,
+  0x62, 0x6a, 0x72, 0x07, 0x84, 0x5b, 0x58, 0x21, 0x00, 0x80, 0x70, 0x0b, 0x2b, 0x93, 0x16, 0x10,
+  0x6e, 0x61, 0x69, 0x04, 0x06, 0xc2, 0x2d, 0x2c, 0x99, 0x3a, 0x41, 0xb8, 0xa5, 0x05, 0x59, 0x08,
+  0x08, 0xb7, 0x38, 0x02, 0x00, 0x00, 0xe1, 0x16, 0x47, 0x52, 0x60, 0x20, 0xdc, 0xe2, 0x08, 0x2b,
+  0x04, 0x84, 0x5b, 0x5c, 0x1a, 0x00, 0x80, 0x70, 0x8b, 0x4b, 0x33, 0xb9, 0x13, 0x6e, 0x71, 0x14,
+  0x00, 0x00, 0xc2, 0x2d, 0x8e, 0x06, 0x59, 0x48, 0xb8, 0xc5, 0xd1, 0x42, 0x00, 0x08, 0xb7, 0x38,
+  0x9a, 0x06, 0x00, 0xe1, 0x16, 0x47, 0x93, 0x3b, 0x20, 0xdc, 0x02, 0x0b, 0x01, 0x00, 0x84, 0x5b,
+  0xe0, 0xab, 0x92, 0x80, 0x70, 0x0b, 0x7c, 0x75, 0x02, 0x10, 0x6e, 0x81, 0x34, 0xb9, 0x03, 0xc2,
+  0x2d, 0x32, 0xb0, 0x42, 0x40, 0xb8, 0x45, 0x06, 0x07, 0x00, 0x08, 0xb7, 0xc8, 0xe0, 0x68, 0x01,
+  0xe1, 0x16, 0x59, 0x00, 0x00, 0x20, 0xdc, 0x22, 0x0b, 0x01, 0x00, 0x84, 0x5b, 0x64, 0x71, 0x07,
+  0x80, 0x70, 0x8b, 0x2c, 0x8e, 0x02, 0x10, 0x6e, 0x91, 0x45, 0x96, 0x09, 0xc2, 0x2d, 0x32, 0xb9,
+  0x03, 0x40, 0xb8, 0x45, 0x26, 0x47, 0x01, 0x08, 0xb7, 0xc8, 0x34, 0x29, 0x00, 0xe1, 0x16, 0xe9,
+  0x0e, 0x00, 0x20, 0xdc, 0x22, 0x9f, 0x4c, 0xee, 0x84, 0x5b, 0xe4, 0xa3, 0x19, 0x80, 0x70, 0x8b,
+  0x7c, 0x75, 0xce, 0x19, 0x6e, 0x99, 0xc1, 0x15, 0x02, 0xc2, 0x2d, 0x13, 0x15, 0x02, 0x40, 0xb8,
+  0x65, 0xb6, 0xe0, 0x00, 0x08, 0xb7, 0xcc, 0x59, 0x08, 0x00, 0xe1, 0x96, 0x49, 0x93, 0x3b, 0x20,
+  0xdc, 0x42, 0x93, 0x3b, 0x00, 0x84, 0x5b, 0x68, 0x9a, 0x08, 0x00, 0x11, 0x84, 0x2c, 0x00, 0x00,
+  0x20, 0xc2, 0x28, 0x2c, 0x0d, 0x00, 0x44, 0x18, 0x85, 0x25, 0x77, 0x80, 0x08, 0xa3, 0xc8, 0xe4,
+  0x0e, 0x10, 0x61, 0xa4, 0x40, 0x93, 0x03, 0x22, 0x10, 0x00, 0x00, 0x00, 0x40, 0x04, 0x12, 0x64,
+  0x06, 0x00, 0x88, 0x40, 0x0a, 0x00, 0x00, 0x00, 0x11, 0x48, 0x71, 0x04, 0x00, 0x20, 0x02, 0x29,
+  0x8e, 0x26, 0x5b, 0x44, 0x20, 0x45, 0xa6, 0x01, 0x80, 0x08, 0xa4, 0xc8, 0x57, 0x27, 0x10, 0x81,
+  0xa4, 0x53, 0x08, 0x00, 0x22, 0x90, 0xc4, 0x32, 0x00, 0x40, 0x04, 0x92, 0x1c, 0x05, 0x00, 0x88,
+  0x40, 0x12, 0x2d, 0x32, 0x03, 0x11, 0x48, 0x95, 0xe9, 0xd5, 0x29, 0x42, 0x72, 0xaf, 0x25, 0x47,
+  0x45, 0x48, 0x8e, 0x26, 0x77, 0x80, 0x08, 0xab, 0xc8, 0x02, 0x00, 0x10, 0x81, 0x05, 0xc1, 0x0a,
+  0x01, 0x22, 0xb0, 0x30, 0x0a, 0x01, 0x40, 0x04, 0x16, 0x06, 0x2d, 0x04, 0x88, 0xc0, 0x02, 0x4b,
+  0x03, 0x00, 0x11, 0x58, 0x60, 0xc9, 0x51, 0x20, 0x02, 0x0b, 0x6e, 0x00, 0x00, 0x44, 0x60, 0xc1,
+  0x11, 0x00, 0x80, 0x08, 0x2c, 0xb8, 0x42, 0x00, 0x10, 0x81, 0x05, 0x47, 0x93, 0xa3, 0x22, 0xb0,
+  0x20, 0x0b, 0x01, 0x40, 0x04, 0x16, 0x26, 0xa2, 0x00, 0x88, 0xc0, 0x02, 0x2d, 0x00, 0x00, 0x11,
+  0x58, 0xa0, 0x85, 0x00, 0x20, 0x02, 0x0b, 0x34, 0xb9, 0x03, 0x44, 0x60, 0x23, 0xb0, 0x42, 0x80,
+  0x08, 0x6c, 0x04, 0x96, 0x01, 0x10, 0x81, 0x8d, 0xe0, 0x68, 0x21, 0x22, 0xb0, 0x91, 0x66, 0xac,
+  0x4c, 0x04, 0x36, 0xaa, 0x3b, 0x00, 0x88, 0xc0, 0x08, 0x00, 0x00, 0x00, 0x11, 0x18, 0x29, 0x04,
+  0x00, 0x20, 0x02, 0x23, 0xc9, 0x01, 0x00, 0x44, 0x60, 0x24, 0x39, 0x9a, 0x86, 0x08, 0x8c, 0xb0,
+  0x42, 0x00, 0x10, 0x81, 0x91, 0x0c, 0x00, 0x00, 0x22, 0xb0, 0x02, 0x00, 0x00, 0x40, 0x04, 0x56,
+  0x08, 0x00, 0x00, 0x88, 0xc0, 0x0a, 0x2b, 0x04, 0x00, 0x11, 0x58, 0x71, 0xc9, 0x1d, 0x20, 0x02,
+  0x2b, 0x8e, 0x02, 0x00, 0x44, 0x60, 0xc5, 0xd1, 0x42, 0x80, 0x08, 0xac, 0x38, 0x9a, 0x02, 0x13,
+  0x81, 0x15, 0x47, 0x93, 0x2d, 0x22, 0x30, 0x53, 0x59, 0x21, 0x40, 0x04, 0x96, 0x06, 0x00, 0x00,
+  0x88, 0xc0, 0xd2, 0x08, 0xee, 0x00, 0x11, 0x58, 0x1a, 0x28, 0xd9, 0x22, 0x02, 0x4b, 0x03, 0xd1,
+  0x34, 0x44, 0x60, 0x69, 0x24, 0x57, 0x88, 0x08, 0x2c, 0x8d, 0xf4, 0x2a, 0x13, 0x81, 0xa5, 0x91,
+  0x5e, 0x9d, 0x22, 0xb0, 0x34, 0x28, 0x00, 0x40, 0x04, 0x96, 0x08, 0x00, 0x00, 0x88, 0xc0, 0xd2,
+  0x49, 0xee, 0x00, 0x11, 0x58, 0x62, 0x04, 0x00, 0x20, 0x02, 0x4b, 0x2c, 0xb9, 0x03, 0x44, 0x60,
+  0xc9, 0x05, 0x06, 0x80, 0x08, 0x2c, 0x39, 0x02, 0x00, 0x10, 0x81, 0x25, 0x97, 0xdc, 0x01, 0x22,
+  0xb0, 0xe4, 0x28, 0x00, 0x40, 0x04, 0x96, 0x1c, 0x2d, 0x04, 0x88, 0xc0, 0x92, 0xa3, 0x75, 0x4e,
+  0x11, 0x58, 0x92, 0x04, 0x00, 0x20, 0x02, 0x4b, 0xb3, 0x10, 0x00, 0x44, 0x60, 0x69, 0xd2, 0x02,
+  0x80, 0x08, 0x2c, 0xd1, 0xe4, 0x0e, 0x10, 0x81, 0x25, 0xfa, 0xea, 0x04, 0x22, 0x30, 0x06, 0x00,
+  0x00, 0x40, 0x04, 0xc6, 0x08, 0x00, 0x00, 0x88, 0xc0, 0x58, 0x21, 0x00, 0x00, 0x11, 0x18, 0x2b,
+  0xa6, 0x32, 0x20, 0x02, 0x63, 0xc5, 0xd4, 0x09, 0x44, 0x60, 0xac, 0xb8, 0x34, 0x80, 0x08, 0x8c,
+  0x15, 0x19, 0x18, 0x10, 0x81, 0xb1, 0x34, 0x02, 0x03, 0x22, 0x30, 0x96, 0x26, 0x05, 0x40, 0x04,
+  0xc6, 0x58, 0x21, 0x00, 0x88, 0xc0, 0xd8, 0x73, 0x07, 0x00, 0x11, 0x18, 0x7b, 0x95, 0x01, 0x20,
+  0x02, 0x63, 0xaf, 0x4e, 0x00, 0x44, 0x60, 0xec, 0xd5, 0x39, 0x81, 0x08, 0xac, 0xbd, 0x3a, 0xe7,
+  0x14, 0x81, 0xbd, 0x16, 0x64, 0x21, 0x22, 0xb0, 0xe7, 0x0e, 0x00, 0x40, 0x04, 0xf6, 0x1c, 0x4d,
+  0x0e, 0x88, 0xc0, 0x9e, 0xa3, 0xc9, 0x1d, 0x11, 0xd8, 0x8b, 0x75, 0x02, 0x20, 0x02, 0x7b, 0x92,
+  0x00, 0x00, 0x44, 0x60, 0x4f, 0x16, 0x02, 0x80, 0x08, 0xec, 0xc9, 0x22, 0x0b, 0x11, 0x81, 0x3d,
+  0xf9, 0x24, 0x01, 0x22, 0xb0, 0x19, 0xdc, 0x01, 0x40, 0x04, 0x36, 0x11, 0x4d, 0x04, 0x88, 0xc0,
+  0xe6, 0x93, 0xc9, 0x51, 0x11, 0xd8, 0x9c, 0x34, 0xb9, 0x23, 0x02, 0x9b, 0x14, 0x00, 0x00, 0x44,
+  0x60, 0xb4, 0xc8, 0x02, 0x80, 0x08, 0xac, 0xca, 0xe0, 0x28, 0x10, 0x81, 0x55, 0x59, 0x08, 0x00,
+  0x22, 0xb0, 0x4a, 0x01, 0x00, 0x40, 0x84, 0x16, 0x04, 0x2b, 0x04, 0x88, 0xd0, 0x44, 0xa0, 0x00,
+  0x00, 0x11, 0x5a, 0x83, 0xe9, 0xd5, 0x29, 0x42, 0x83, 0x34, 0x39, 0x00, 0x44, 0x70, 0x81, 0x15,
+  0x02, 0x80, 0x08, 0x2e, 0x38, 0x02, 0x00, 0x10, 0xc1, 0x11, 0x00, 0x00, 0x00, 0x22, 0x38, 0x52,
+  0x00, 0x00, 0x40, 0x04, 0x47, 0x0a, 0x01, 0x00, 0x88, 0xe0, 0x48, 0x1a, 0x00, 0x00, 0x11, 0x1c,
+  0x49, 0x23, 0x30, 0x20, 0x82, 0x23, 0xc9, 0x01, 0x00, 0x44, 0x70, 0x24, 0xb9, 0x03, 0x80, 0x08,
+  0x8e, 0xb0, 0x42, 0x00, 0x10, 0xc1, 0x91, 0x99, 0x1c, 0x05, 0x22, 0x38, 0x72, 0x83, 0x3b, 0x40,
+  0x04, 0x47, 0x6e, 0x12, 0x0c, 0x88, 0xe0, 0x0a, 0x01, 0x00, 0x00, 0x11, 0x5c, 0x61, 0x85, 0x00,
+  0x20, 0x82, 0x2b, 0x2e, 0x0d, 0x00, 0x44, 0x70, 0xc5, 0x25, 0x77, 0x80, 0x08, 0xae, 0xc8, 0xe4,
+  0x0e, 0x10, 0xc1, 0xa5, 0x91, 0x06, 0x00, 0x22, 0xb8, 0x34, 0xd2, 0x08, 0x4c, 0x04, 0x97, 0x58,
+  0x72, 0x07, 0x88, 0xe0, 0x92, 0x23, 0x00, 0x00, 0x11, 0x5c, 0x92, 0x29, 0x30, 0x20, 0x82, 0x4b,
+  0xb4, 0x00, 0x00, 0x44, 0x70, 0x6f, 0x24, 0x47, 0x81, 0x08, 0xee, 0xb5, 0xc0, 0x00, 0x10, 0xc1,
+  0xbd, 0x96, 0x06, 0x00, 0x22, 0xb8, 0xd7, 0x5e, 0x65, 0x40, 0x04, 0xf7, 0x64, 0x70, 0x07, 0x88,
+  0xe0, 0x68, 0x32, 0x75, 0x02, 0x11, 0x60, 0x21, 0x00, 0x00, 0x20, 0x02, 0x2c, 0x8e, 0x00, 0x00,
+  0x44, 0x80, 0xc5, 0x1d, 0x00, 0x80, 0x08, 0xb0, 0xb8, 0x34, 0x00, 0x10, 0x01, 0x16, 0x47, 0x01,
+  0x00, 0x22, 0xc0, 0x34, 0x92, 0xa9, 0x53, 0x04, 0x98, 0x08, 0x00, 0x00, 0x88, 0x00, 0xd3, 0x49,
+  0x0e, 0x00, 0x11, 0x60, 0x3a, 0x75, 0x4e, 0x20, 0x02, 0x4c, 0x8e, 0xa6, 0x01, 0x44, 0x80, 0xe9,
+  0xc9, 0x14, 0x98, 0x08, 0x30, 0x3d, 0x0a, 0x00, 0x10, 0x01, 0x26, 0x9a, 0xdc, 0x01, 0x22, 0x40,
+  0x56, 0x08, 0x00, 0x40, 0x04, 0xf8, 0x5a, 0x21, 0x00, 0x88, 0x00, 0x65, 0x70, 0x00, 0x00, 0x11,
+  0xa0, 0x2c, 0x8e, 0xa6, 0x21, 0x02, 0x94, 0xc9, 0x01, 0x00, 0x44, 0x80, 0x34, 0xb9, 0x03, 0x80,
+  0x08, 0x32, 0x8c, 0x34, 0x00, 0x10, 0x41, 0x86, 0x91, 0x1c, 0x05, 0x22, 0xc8, 0x40, 0x00, 0x00,
+  0x40, 0x04, 0x19, 0x58, 0x21, 0x00, 0x88, 0x20, 0x43, 0x4b, 0xaf, 0x4e, 0x11, 0x64, 0x70, 0x07,
+  0x00, 0x20, 0x82, 0x0c, 0x8e, 0x02, 0x00, 0x44, 0x90, 0xc1, 0xd1, 0x42, 0x80, 0x08, 0x32, 0xc8,
+  0x42, 0x00, 0x10, 0x41, 0x06, 0x99, 0x06, 0x00, 0x22, 0xc8, 0x20, 0x93, 0x3b, 0x40, 0x04, 0x19,
+  0x64, 0x72, 0x14, 0x88, 0x20, 0x03, 0x4d, 0xee, 0x00, 0x11, 0x64, 0xa0, 0xc9, 0x51, 0x20, 0x82,
+  0x14, 0xc1, 0x1d, 0x00, 0x44, 0x90, 0x82, 0xa5, 0x01, 0x80, 0x08, 0x52, 0xbc, 0x3a, 0x01, 0x10,
+  0x41, 0x8e, 0x42, 0x00, 0x00, 0x22, 0xc8, 0x81, 0x00, 0x00, 0x40, 0x04, 0x39, 0xd2, 0x28, 0x04,
+  0x88, 0x20, 0x47, 0x22, 0x00, 0x00, 0x11, 0xe4, 0x78, 0xf5, 0xd5, 0x29, 0x82, 0x1c, 0x55, 0x06,
+  0x06, 0x44, 0x90, 0x04, 0x00, 0x00, 0x80, 0x08, 0x92, 0xb0, 0x42, 0x00, 0x10, 0x41, 0x16, 0x00,
+  0x00, 0x00, 0x22, 0xc8, 0x12, 0x1c, 0x05, 0x40, 0x04, 0x59, 0x08, 0x00, 0x00, 0x88, 0x20, 0x8b,
+  0x23, 0x00, 0x00, 0x11, 0x64, 0x71, 0x07, 0x00, 0x20, 0x82, 0x2c, 0xee, 0x30, 0x00, 0x44, 0x90,
+  0xc5, 0xa5, 0x01, 0x80, 0x08, 0xb2, 0xb8, 0xf4, 0xea, 0x14, 0x41, 0x16, 0x47, 0x01, 0x00, 0x22,
+  0xc8, 0x22, 0x03, 0x03, 0x40, 0x04, 0x59, 0x64, 0x90, 0x04, 0x88, 0x20, 0x8b, 0x0c, 0x14, 0x00,
+  0x11, 0x64, 0x91, 0x85, 0x00, 0x20, 0x82, 0x2c, 0xb2, 0x4c, 0x00, 0x44, 0x90, 0x45, 0xa6, 0x11,
+  0x98, 0x08, 0xb2, 0xc8, 0x0c, 0x00, 0x10, 0x41, 0x96, 0x99, 0xdc, 0x01, 0x22, 0xc8, 0x32, 0x69,
+  0x22, 0x40, 0x04, 0x99, 0x82, 0x3b, 0x00, 0x88, 0x20, 0x53, 0x70, 0x14, 0x00, 0x11, 0x64, 0x1a,
+  0x81, 0x02, 0x20, 0x82, 0x4c, 0xa3, 0xc8, 0x42, 0x44, 0x90, 0x69, 0xa4, 0x01, 0x80, 0x08, 0x32,
+  0x8d, 0xf4, 0xea, 0x14, 0x41, 0x26, 0x02, 0x00, 0x00, 0x22, 0xc8, 0x74, 0x0a, 0x01, 0x40, 0x04,
+  0x99, 0x58, 0x01, 0x00, 0x88, 0x20, 0x13, 0x2b, 0x04, 0x00, 0x11, 0x64, 0x72, 0x23, 0x30, 0x20,
+  0x82, 0x4c, 0x8e, 0x00, 0x00, 0x44, 0x90, 0xc9, 0x1d, 0x00, 0x80, 0x08, 0x32, 0xb9, 0x53, 0x08,
+  0x10, 0x41, 0x26, 0x47, 0x0b, 0x01, 0x22, 0xc8, 0xe4, 0x68, 0x1a, 0x40, 0x04, 0x99, 0x1c, 0x4d,
+  0xab, 0x88, 0x20, 0x93, 0xcb, 0x00, 0x00, 0x11, 0x64, 0x7a, 0xb2, 0x10, 0x20, 0x82, 0x4c, 0x32,
+  0x0d, 0x00, 0x44, 0x90, 0x69, 0xa6, 0x11, 0x98, 0x08, 0x32, 0xcd, 0xe4, 0x0e, 0x10, 0x41, 0xa6,
+  0x49, 0x01, 0x00, 0x22, 0xc8, 0x34, 0x69, 0x1a, 0x40, 0x04, 0x99, 0x68, 0x1a, 0x00, 0x88, 0x20,
+  0x57, 0x01, 0x00, 0x00, 0x11, 0xe4, 0x2a, 0x04, 0x00, 0x20, 0x82, 0x64, 0x45, 0xbe, 0x3a, 0x45,
+  0x90, 0x0d, 0x00, 0x00, 0x80, 0x08, 0xb2, 0x05, 0x56, 0xdc, 0x11, 0x41, 0xb6, 0xe0, 0x00, 0x00,
+  0x22, 0xc8, 0x56, 0x00, 0x00, 0x40, 0x04, 0xd9, 0x8a, 0x3b, 0x00, 0x88, 0x20, 0x1d, 0x01, 0x00,
+  0x00, 0x11, 0xe4, 0x0b, 0x14, 0x00, 0x20, 0x82, 0x7c, 0x82, 0x15, 0x02, 0x44, 0x90, 0x8f, 0x25,
+  0x77, 0x80, 0x08, 0xf2, 0xb1, 0xe4, 0x28, 0x10, 0x41, 0xbe, 0x56, 0x08, 0x00, 0x22, 0xc8, 0xd7,
+  0x92, 0x3b, 0x40, 0x04, 0xf9, 0x5a, 0xb2, 0x05, 0x88, 0x20, 0x9f, 0x1b, 0x00, 0x00, 0x11, 0xe4,
+  0x73, 0x04, 0x00, 0x20, 0x82, 0x7c, 0xee, 0x00, 0x00, 0x44, 0x90, 0x4f, 0x06, 0x07, 0x80, 0x08,
+  0xf2, 0xc9, 0x42, 0x00, 0x10, 0x41, 0x3e, 0x99, 0x6c, 0x01, 0x22, 0xc8, 0x37, 0x69, 0x72, 0x47,
+  0x04, 0xf9, 0x28, 0x2b, 0x04, 0x88, 0x20, 0x67, 0x60, 0x85, 0x00, 0x11, 0xe4, 0x2c, 0x04, 0x00,
+  0x20, 0x82, 0x9c, 0x34, 0x0d, 0x00, 0x44, 0x90, 0x93, 0x26, 0x77, 0x80, 0x08, 0x92, 0x02, 0x00,
+  0x00, 0x10, 0x41, 0xd2, 0x60, 0x93, 0x3b, 0x22, 0x48, 0x5a, 0x00, 0x00, 0x40, 0x04, 0x49, 0x8b,
+  0x3b, 0x00, 0x88, 0x20, 0x69, 0x71, 0x14, 0x00, 0x11, 0x24, 0x2d, 0x8e, 0xa6, 0x21, 0x82, 0xa4,
+  0x65, 0x26, 0x47, 0x45, 0x90, 0x14, 0x01, 0x00, 0x80, 0x08, 0x92, 0xa2, 0x42, 0x00, 0x10, 0x41,
+  0x52, 0x94, 0x6c, 0x21, 0x22, 0x48, 0x8a, 0x28, 0x00, 0x40, 0x04, 0x49, 0x51, 0x06, 0x00, 0x88,
+  0x20, 0x69, 0x32, 0x75, 0x02, 0x11, 0x24, 0x4d, 0xee, 0x00, 0x20, 0x82, 0xa4, 0xc9, 0x51, 0x00,
+  0x44, 0x90, 0x54, 0xa6, 0x01, 0x80, 0x08, 0x92, 0xca, 0xe4, 0x0e, 0x10, 0x41, 0x52, 0x9a, 0x06,
+  0x00, 0x22, 0x48, 0x5a, 0x65, 0x60, 0x40, 0x04, 0x49, 0x6f, 0x70, 0x14, 0x88, 0x20, 0xeb, 0xa4,
+  0x85, 0x00, 0x11, 0xa4, 0x2d, 0x04, 0x00, 0x20, 0x82, 0xb4, 0xc5, 0x15, 0x02, 0x44, 0x90, 0xb6,
+  0xb8, 0x03, 0x80, 0x08, 0x32, 0x03, 0x00, 0x00, 0x10, 0x61, 0xa2, 0xe2, 0x0e, 0x00, 0x22, 0xcc,
+  0x96, 0x26, 0x2a, 0x44, 0x84, 0x09, 0x93, 0x2b, 0x04, 0x88, 0x30, 0xe1, 0xa4, 0x85, 0x00, 0x11,
+  0x26, 0x2d, 0x00, 0x00, 0x20, 0xc2, 0xa4, 0xc9, 0x1d, 0x00, 0x44, 0xa0, 0x00, 0x00, 0x00, 0x80,
+  0x08, 0x34, 0x10, 0x00, 0x00, 0x10, 0x81, 0x06, 0x52, 0x00, 0x00, 0x22, 0xd0, 0xc0, 0x92, 0x2d,
+  0x44, 0x04, 0x1a, 0x68, 0x2a, 0x04, 0x88, 0x40, 0x03, 0x65, 0xc5, 0x1d, 0x11, 0xe8, 0x08, 0x34,
+  0xb9, 0x23, 0x02, 0x1d, 0x08, 0x00, 0x00, 0x44, 0xa0, 0x85, 0x00, 0x00, 0x80, 0x08, 0x14, 0x05,
+  0x77, 0x00, 0x10, 0x81, 0x22, 0x02, 0x00, 0x00, 0x22, 0x50, 0x54, 0x00, 0x00, 0x40, 0x04, 0x8a,
+  0x8a, 0x03, 0x00, 0x88, 0x40, 0x51, 0x71, 0x07, 0x00, 0x11, 0x28, 0x2a, 0x8e, 0x16, 0x20, 0x02,
+  0x45, 0xc5, 0xd1, 0x42, 0x44, 0xa0, 0xa8, 0xc8, 0x64, 0x8b, 0x08, 0x14, 0x19, 0x00, 0x00, 0x10,
+  0x81, 0xa2, 0x34, 0x00, 0x00, 0x22, 0x50, 0x94, 0x1c, 0x00, 0x40, 0x04, 0x8a, 0x92, 0x3b, 0x00,
+  0x88, 0x40, 0x11, 0x03, 0x00, 0x00, 0x11, 0x28, 0x7a, 0x34, 0xad, 0x22, 0x02, 0x45, 0x32, 0xbd,
+  0x3a, 0x45, 0xa0, 0x88, 0x16, 0x02, 0x80, 0x08, 0x14, 0xd1, 0x34, 0x02, 0x13, 0x81, 0x22, 0x9a,
+  0xdc, 0x01, 0x22, 0x50, 0x44, 0x65, 0x21, 0x40, 0x04, 0x9a, 0x46, 0x21, 0x00, 0x88, 0x40, 0x13,
+  0x01, 0x00, 0x00, 0x11, 0x68, 0x22, 0x69, 0x00, 0x20, 0x02, 0x4d, 0xee, 0x00, 0x00, 0x44, 0xa0,
+  0xc9, 0xd1, 0xe4, 0xa8, 0x08, 0x34, 0x3d, 0x9a, 0x06, 0x10, 0x81, 0xa6, 0x99, 0x1c, 0x05, 0x22,
+  0x50, 0x99, 0x1c, 0x00, 0x40, 0x04, 0x4a, 0x03, 0x05, 0x00, 0x88, 0x40, 0x69, 0x06, 0x00, 0x00,
+  0x11, 0x68, 0x95, 0x85, 0x00, 0x20, 0x02, 0xad, 0xb3, 0x10, 0x00, 0x44, 0xa8, 0x69, 0xa4, 0x57,
+  0xa7, 0x08, 0x95, 0xb1, 0xe4, 0x28, 0x10, 0xa1, 0xb6, 0xe0, 0x68, 0x1a, 0x22, 0x54, 0x47, 0x00,
+  0x00, 0x40, 0x84, 0xea, 0x08, 0x2b, 0x04, 0x88, 0x50, 0x5d, 0x71, 0x04, 0x00, 0x11, 0xaa, 0x3b,
+  0x85, 0x00, 0x20, 0x42, 0x75, 0x69, 0x00, 0x00, 0x44, 0xa8, 0x8e, 0x02, 0x00, 0x80, 0x08, 0xd5,
+  0xd1, 0x42, 0x00, 0x10, 0xa1, 0x3a, 0x9a, 0x06, 0x00, 0x22, 0x54, 0x47, 0x93, 0xa3, 0x40, 0x84,
+  0xea, 0x28, 0x2b, 0x04, 0x88, 0x50, 0x1d, 0x7d, 0x95, 0x01, 0x11, 0xaa, 0x04, 0x00, 0x00, 0x20,
+  0x42, 0x9d, 0x14, 0x00, 0x00, 0x44, 0xa8, 0x93, 0x16, 0x02, 0x80, 0x08, 0x75, 0xd2, 0xe4, 0x0e,
+  0x10, 0xc1, 0x06, 0x47, 0x93, 0x3b, 0x22, 0xd8, 0x02, 0x00, 0x00, 0x40, 0x04, 0x5b, 0x08, 0x00,
+  0x00, 0x88, 0x60, 0x0b, 0x0b, 0xac, 0x10, 0x11, 0x6c, 0x61, 0x69, 0x04, 0x26, 0x82, 0x2d, 0x6e,
+  0x00, 0x00, 0x44, 0xb0, 0xc5, 0x11, 0x00, 0x80, 0x08, 0xb6, 0xb8, 0x03, 0x00, 0x10, 0xc1, 0x16,
+  0x97, 0x06, 0x00, 0x22, 0xd8, 0xe2, 0x92, 0x3b, 0x40, 0x04, 0x5b, 0x1c, 0x05, 0x00, 0x88, 0x60,
+  0x8b, 0xa3, 0xa9, 0x10, 0x11, 0x6c, 0x91, 0x85, 0x00, 0x20, 0x82, 0x2d, 0x32, 0x0d, 0x00, 0x44,
+  0xb0, 0x45, 0xbe, 0xca, 0x80, 0x08, 0xb6, 0xcc, 0x42, 0x00, 0x10, 0xc1, 0x96, 0x99, 0xdc, 0x01,
+  0x22, 0xd8, 0x44, 0x92, 0x3b, 0x40, 0x04, 0x9b, 0x4e, 0x21, 0x00, 0x88, 0x60, 0x93, 0x23, 0x00,
+  0x00, 0x11, 0xec, 0x93, 0xaf, 0x32, 0x20, 0x82, 0x2e, 0x00, 0x00, 0x00, 0x44, 0xd0, 0xba, 0x04,
+  0x06, 0x80, 0x08, 0x5a, 0xa7, 0x99, 0x1c, 0x15, 0x41, 0x6b, 0x56, 0x08, 0x00, 0xa2, 0x84, 0x11,
+  0x66, 0x21, 0x40, 0x94, 0x30, 0x12, 0x01, 0x00, 0x88, 0x12, 0x46, 0x95, 0x81, 0x01, 0x51, 0x02,
+  0x49, 0x8e, 0xa6, 0x21, 0x4a, 0x20, 0x93, 0xca, 0x42, 0x44, 0x09, 0xa7, 0x10, 0x00, 0x80, 0x28,
+  0xe1, 0x14, 0x53, 0xe7, 0x14, 0x25, 0x9c, 0xe2, 0x0e, 0x00, 0xa2, 0x84, 0x53, 0x5c, 0x72, 0x47,
+  0x94, 0x70, 0x90, 0xa9, 0x13, 0x88, 0x12, 0x0e, 0x4a, 0x23, 0x30, 0x51, 0xc2, 0x41, 0xc9, 0x51,
+  0x20, 0x4a, 0x38, 0x88, 0x16, 0x02, 0x44, 0x09, 0x27, 0xb9, 0x03, 0x80, 0x28, 0x21, 0x4d, 0x5a,
+  0x08, 0x10, 0x25, 0xa4, 0x99, 0x01, 0x00, 0xa2, 0x04, 0x56, 0x08, 0x00, 0x40, 0x94, 0xc0, 0x8a,
+  0x2b, 0x04, 0x88, 0x12, 0x58, 0x99, 0xb4, 0x10, 0x51, 0x02, 0x4b, 0x23, 0x30, 0x20, 0x4a, 0x60,
+  0x0c, 0x00, 0x00, 0x44, 0x09, 0x8c, 0x15, 0x02, 0x80, 0x28, 0x81, 0xb1, 0x34, 0x00, 0x10, 0x25,
+  0xb0, 0xe7, 0x68, 0x1a, 0xa2, 0x04, 0xf6, 0x64, 0x21, 0x40, 0x94, 0xc0, 0x2a, 0x2b, 0x04, 0x88,
+  0x12, 0x1a, 0x00, 0x00, 0x00, 0x51, 0x42, 0x0b, 0x0e, 0x00, 0x20, 0x4a, 0x68, 0xc5, 0x1d, 0x00,
+  0x44, 0x09, 0x2d, 0xb9, 0x34, 0x80, 0x28, 0xa1, 0xa5, 0x49, 0x01, 0x10, 0x25, 0xb4, 0x34, 0x69,
+  0x21, 0xa2, 0x84, 0x96, 0x6c, 0x21, 0x40, 0x94, 0xe0, 0x08, 0x00, 0x00, 0x88, 0x12, 0xdc, 0x29,
+  0x04, 0x00, 0x51, 0x82, 0x3b, 0x95, 0x01, 0x20, 0x4a, 0x70, 0xa7, 0xce, 0x09, 0x44, 0x09, 0x2e,
+  0x39, 0x00, 0x80, 0x28, 0xc1, 0x2d, 0x00, 0x00, 0x10, 0x25, 0x38, 0x5a, 0x08, 0x00, 0xa2, 0x04,
+  0x47, 0x93, 0x3b, 0x40, 0x94, 0xe0, 0x68, 0x06, 0x00, 0x88, 0x12, 0xe0, 0x73, 0x65, 0x02, 0x51,
+  0x02, 0x9c, 0x85, 0x00, 0x20, 0x4a, 0x80, 0x19, 0x00, 0x00, 0x44, 0x09, 0x32, 0x30, 0x00, 0x80,
+  0x28, 0x41, 0x06, 0x77, 0x00, 0x10, 0x25, 0xc8, 0x30, 0x93, 0x3b, 0xa2, 0x04, 0x19, 0x68, 0x72,
+  0x47, 0x94, 0x20, 0x05, 0x2b, 0x04, 0x88, 0x12, 0x64, 0x01, 0x00, 0x00, 0x51, 0x82, 0x2c, 0x04,
+  0x00, 0x20, 0x4a, 0x90, 0xc5, 0x05, 0x47, 0x45, 0x09, 0xb2, 0xb8, 0x03, 0x80, 0x28, 0x41, 0x16,
+  0x47, 0x01, 0x10, 0x25, 0xc8, 0xe2, 0x68, 0x21, 0xa2, 0x04, 0x59, 0x1c, 0x4d, 0x43, 0x94, 0x20,
+  0xd3, 0x00, 0x00, 0x88, 0x12, 0x64, 0x1a, 0x81, 0x01, 0x51, 0x82, 0x4c, 0x23, 0x48, 0x20, 0x4a,
+  0x90, 0x89, 0x00, 0x00, 0x44, 0x09, 0x32, 0x99, 0x3a, 0x81, 0x28, 0x41, 0xa6, 0x03, 0x00, 0x10,
+  0x25, 0xc8, 0xe4, 0x00, 0x00, 0xa2, 0x04, 0x99, 0x5c, 0x21, 0x40, 0x94, 0x20, 0x93, 0x3b, 0x00,
+  0x88, 0x12, 0x64, 0x9a, 0x85, 0x00, 0x51, 0x82, 0x4c, 0x33, 0x0d, 0x20, 0x4a, 0x90, 0x69, 0x52,
+  0x00, 0x44, 0x09, 0xd2, 0x1d, 0x00, 0x80, 0x28, 0x41, 0x3a, 0x9a, 0xdc, 0x11, 0x25, 0xc8, 0xd7,
+  0x92, 0x3b, 0xa2, 0x04, 0xf9, 0xe4, 0xab, 0x53, 0x94, 0x20, 0x1f, 0x05, 0x00, 0x88, 0x12, 0xe4,
+  0xa3, 0xc9, 0x1d, 0x51, 0x82, 0x7c, 0xd5, 0x1d, 0x20, 0x4a, 0x90, 0x34, 0xb9, 0x03, 0x44, 0x09,
+  0x33, 0xb0, 0x42, 0x80, 0x28, 0x61, 0x06, 0x56, 0xdc, 0x11, 0x25, 0xcc, 0x20, 0x0b, 0x01, 0xa2,
+  0x84, 0x19, 0x28, 0x00, 0x40, 0x94, 0x30, 0x03, 0x2d, 0x04, 0x88, 0x12, 0x66, 0x71, 0x07, 0x00,
+  0x51, 0xc2, 0x2c, 0x32, 0x39, 0x2a, 0x4a, 0x98, 0x08, 0x00, 0x00, 0x44, 0x09, 0x13, 0x15, 0x02,
+  0x80, 0x28, 0x61, 0xa2, 0x22, 0x03, 0x13, 0x25, 0x4c, 0x94, 0xdc, 0x01, 0xa2, 0x84, 0x89, 0xd2,
+  0xab, 0x53, 0x94, 0x30, 0x51, 0x06, 0x00, 0x88, 0x12, 0x66, 0x7b, 0x95, 0x01, 0x51, 0xc2, 0x7c,
+  0xee, 0x00, 0x20, 0x4a, 0x98, 0x4f, 0xbe, 0x3a, 0x45, 0x09, 0x13, 0xd2, 0xe4, 0x8e, 0x28, 0x61,
+  0xce, 0x02, 0x00, 0x10, 0x25, 0xcc, 0x59, 0x08, 0x00, 0xa2, 0x84, 0x39, 0xd3, 0x08, 0x4c, 0x94,
+  0x30, 0x67, 0x2a, 0x04, 0x88, 0x12, 0xe6, 0xa4, 0x00, 0x00, 0x51, 0xc2, 0x9c, 0x19, 0x00, 0x20,
+  0x4a, 0x98, 0x14, 0x00, 0x00, 0x44, 0x09, 0x93, 0x16, 0x02, 0x80, 0x28, 0x61, 0xd2, 0x34, 0x00,
+  0x10, 0x25, 0x4c, 0xca, 0x0a, 0x01, 0xa2, 0x84, 0x49, 0xe5, 0xab, 0x53, 0x94, 0x30, 0x69, 0x06,
+  0x00, 0x88, 0x12, 0x68, 0x01, 0x00, 0x00, 0x51, 0x02, 0x2d, 0x04, 0x00, 0x20, 0x4a, 0xa0, 0xc5,
+  0x1d, 0x00, 0x44, 0x09, 0xb4, 0x38, 0x0a, 0x80, 0x28, 0x81, 0x16, 0x47, 0x0b, 0x11, 0x25, 0xd0,
+  0x22, 0x83, 0x04, 0xa2, 0x04, 0x5a, 0xa4, 0xa9, 0x53, 0x94, 0x40, 0xcb, 0xa4, 0x00, 0x88, 0x12,
+  0x28, 0x2a, 0x04, 0x00, 0x51, 0x02, 0x45, 0x69, 0x00, 0x20, 0x4a, 0xa0, 0x28, 0x39, 0x0a, 0x44,
+  0x09, 0x34, 0x0d, 0x00, 0x80, 0x28, 0x81, 0xa6, 0x11, 0x18, 0x10, 0x25, 0xd0, 0xe4, 0x00, 0x00,
+  0xa2, 0x04, 0x9a, 0x1c, 0x05, 0x40, 0x94, 0x40, 0x93, 0xa3, 0x69, 0x88, 0x12, 0x68, 0x9a, 0x29,
+  0x30, 0x51, 0x02, 0x4d, 0x33, 0xb9, 0x23, 0x4a, 0xa0, 0x69, 0x52, 0x00, 0x44, 0x09, 0x94, 0x25,
+  0x47, 0x8b, 0x28, 0x81, 0x56, 0x59, 0x08, 0x10, 0x25, 0xd0, 0x2a, 0xd3, 0x00, 0xa2, 0x84, 0x2a,
+  0x0b, 0x01, 0x40, 0x94, 0x60, 0x0b, 0x01, 0x00, 0x88, 0x12, 0x6c, 0x71, 0x00, 0x00, 0x51, 0x82,
+  0x2d, 0x2e, 0x30, 0x20, 0x4a, 0xb0, 0xc5, 0x1d, 0x00, 0x44, 0x09, 0xb6, 0x48, 0x53, 0xa7, 0x28,
+  0xc1, 0xa6, 0x59, 0x08, 0x10, 0x45, 0xa4, 0x49, 0xd3, 0x00, 0xa2, 0x8c, 0x20, 0x58, 0x21, 0x40,
+  0x94, 0x11, 0x06, 0x00, 0x00, 0x88, 0x32, 0xc2, 0x2a, 0x04, 0x00, 0x51, 0x46, 0x60, 0xc9, 0x01,
+  0x20, 0xca, 0x08, 0x2c, 0x39, 0x0a, 0x44, 0x19, 0xc1, 0x9d, 0x42, 0x80, 0x28, 0x23, 0xb8, 0x54,
+  0x08, 0x10, 0x65, 0x04, 0x47, 0x01, 0x00, 0xa2, 0x8c, 0x30, 0x0b, 0x01, 0x40, 0x94, 0x11, 0x68,
+  0x21, 0x00, 0x88, 0x32, 0x0a, 0x00, 0x00, 0x00, 0x51, 0x46, 0x21, 0x00, 0x00, 0x20, 0xca, 0x28,
+  0x0e, 0x00, 0x00, 0x44, 0x19, 0xc5, 0x0d, 0x00, 0x80, 0x28, 0xa3, 0x38, 0x02, 0x00, 0x10, 0x65,
+  0x14, 0x77, 0x00, 0x00, 0xa2, 0x8c, 0xe2, 0x4e, 0x21, 0x40, 0x94, 0x51, 0x64, 0x01, 0x00, 0x88,
+  0x32, 0x8a, 0x2c, 0x04, 0x00, 0x51, 0x46, 0x91, 0x69, 0x00, 0x20, 0xca, 0x28, 0xd2, 0x01, 0x00,
+  0x44, 0x19, 0x45, 0xbe, 0xca, 0x80, 0x28, 0xa3, 0xc8, 0x49, 0xd3, 0x10, 0x65, 0x94, 0xf9, 0x2a,
+  0x03, 0xa2, 0x8c, 0xe4, 0x06, 0x00, 0x40, 0x94, 0x91, 0x1c, 0x49, 0xee, 0x88, 0x32, 0xd2, 0x9b,
+  0xc9, 0x1d, 0x51, 0xc6, 0x2a, 0x04, 0x00, 0x20, 0xca, 0x78, 0x6e, 0x00, 0x00, 0x44, 0x19, 0x4f,
+  0x16, 0x02, 0x80, 0x28, 0xe3, 0xc9, 0x34, 0x00, 0x10, 0x65, 0x3c, 0x99, 0xdc, 0x01, 0xa2, 0x8c,
+  0x37, 0x93, 0x3b, 0x40, 0x94, 0x51, 0x59, 0x72, 0x07, 0x88, 0x32, 0xaa, 0x2c, 0x04, 0x00, 0x51,
+  0x46, 0x95, 0x29, 0xb8, 0x23, 0x0a, 0x29, 0xee, 0x14, 0x02, 0x44, 0x21, 0x69, 0xa0, 0x42, 0x80,
+  0x28, 0x24, 0x39, 0x5a, 0x08, 0x10, 0xa5, 0x84, 0x91, 0xdc, 0x01, 0xa2, 0x94, 0x40, 0x58, 0x21,
+  0x40, 0x94, 0x12, 0x5c, 0x0a, 0x0c, 0x88, 0x52, 0x48, 0x71, 0x07, 0x00, 0x51, 0x0a, 0x4b, 0xee,
+  0x00, 0x20, 0x4a, 0x61, 0x69, 0x26, 0x77, 0x44, 0x29, 0x2c, 0xcd, 0x09, 0x80, 0x28, 0x45, 0x26,
+  0x77, 0x00, 0x10, 0xa5, 0x48, 0x97, 0x06, 0x00, 0xa2, 0x98, 0x02, 0x00, 0x00, 0x40, 0x14, 0x53,
+  0x82, 0x3b, 0x00, 0x88, 0x62, 0x0a, 0x01, 0x00, 0x00, 0x51, 0x4c, 0x61, 0x00, 0x00, 0x20, 0x8a,
+  0x29, 0xac, 0xc8, 0x42, 0x44, 0x31, 0x85, 0xa5, 0x55, 0x88, 0x28, 0xa6, 0x38, 0x02, 0x00, 0x10,
+  0xc5, 0x14, 0x77, 0x00, 0x00, 0xa2, 0x98, 0xe2, 0x4e, 0x21, 0x40, 0x14, 0x53, 0x5c, 0x1a, 0x00,
+  0x88, 0x62, 0x8a, 0x2c, 0x00, 0x00, 0x51, 0x4c, 0x91, 0x85, 0x00, 0x20, 0x8a, 0x29, 0xd2, 0xd4,
+  0x09, 0x44, 0x31, 0x45, 0xbe, 0xca, 0x80, 0x28, 0xa6, 0xcc, 0x42, 0x00, 0x10, 0xc5, 0x94, 0x99,
+  0xdc, 0x01, 0xa2, 0x98, 0x44, 0x00, 0x00, 0x40, 0x14, 0x93, 0x64, 0x21, 0x00, 0x88, 0x62, 0x18,
+  0x01, 0x00, 0x00, 0x51, 0xcc, 0x73, 0xc5, 0x1d, 0x20, 0x8a, 0xa1, 0x85, 0x00, 0x00, 0x44, 0x31,
+  0x34, 0xb9, 0x03, 0x80, 0x28, 0x86, 0x56, 0x59, 0xdc, 0x11, 0xc5, 0x54, 0x02, 0x00, 0x00, 0xa2,
+  0x98, 0x2a, 0x0b, 0x01, 0x40, 0x14, 0x53, 0x67, 0x01, 0x00, 0x88, 0x72, 0x82, 0xa3, 0x00, 0x00,
+  0x51, 0x4e, 0x91, 0x85, 0x00, 0x20, 0xca, 0x41, 0x69, 0x16, 0x00, 0x44, 0x49, 0x93, 0xa6, 0xc0,
+  0x80, 0x28, 0x2c, 0x10, 0x00, 0x00, 0x10, 0x85, 0x05, 0x56, 0x08, 0x00, 0xa2, 0xb0, 0xc0, 0xd2,
+  0x00, 0x40, 0x14, 0x16, 0xdc, 0x01, 0x00, 0x88, 0xc2, 0x02, 0xa4, 0xc9, 0x16, 0x51, 0x58, 0x98,
+  0x85, 0x00, 0x20, 0x0a, 0x1b, 0x85, 0x00, 0x00, 0x44, 0x61, 0x03, 0x15, 0x02, 0x80, 0x28, 0x6c,
+  0xa4, 0x49, 0x01, 0x10, 0x85, 0x11, 0x00, 0x00, 0x00, 0xa2, 0x30, 0x52, 0x08, 0x00, 0x40, 0x14,
+  0x46, 0x92, 0x03, 0x00, 0x88, 0xc2, 0x48, 0x72, 0x07, 0x00, 0x51, 0x18, 0x49, 0xcf, 0x1d, 0x20,
+  0x0a, 0x23, 0xb2, 0x10, 0x00, 0x44, 0x61, 0x45, 0x06, 0x77, 0x80, 0x28, 0xcc, 0x98, 0xca, 0x0a,
+  0x10, 0x85, 0x99, 0xca, 0x0a, 0x01, 0xa2, 0x30, 0x53, 0x65, 0x01, 0x40, 0x14, 0x96, 0xc2, 0x08,
+  0x0c, 0x88, 0xc2, 0x52, 0xa0, 0xc9, 0x1d, 0x51, 0x58, 0x1a, 0xc9, 0x1d, 0x20, 0x0a, 0x4b, 0x2e,
+  0x50, 0x00, 0x44, 0x61, 0xc9, 0x11, 0x00, 0x80, 0x28, 0x2c, 0xb9, 0x03, 0x00, 0x10, 0x85, 0x25,
+  0x97, 0x1c, 0x05, 0xa2, 0xb0, 0xe4, 0x28, 0x00, 0x40, 0x14, 0x96, 0x9e, 0x7c, 0x75, 0x8a, 0xc2,
+  0xd2, 0x2c, 0x00, 0x00, 0x51, 0x58, 0x9a, 0xc9, 0x1d, 0x20, 0x0a, 0x63, 0x04, 0x00, 0x00, 0x44,
+  0x61, 0xac, 0x00, 0x00, 0x80, 0x28, 0x8c, 0x15, 0x02, 0x00, 0x10, 0x85, 0xb1, 0xc2, 0x0a, 0x01,
+  0xa2, 0x30, 0x56, 0x5c, 0x60, 0x40, 0x14, 0xc6, 0x8a, 0x3b, 0x00, 0x88, 0xc2, 0x58, 0x32, 0x75,
+  0x02, 0x51, 0x18, 0x63, 0x00, 0x00, 0x20, 0x0a, 0x63, 0x2c, 0xd0, 0x02, 0x44, 0x61, 0x8c, 0x15,
+  0x00, 0x80, 0x28, 0x8c, 0x3d, 0x77, 0x00, 0x10, 0x85, 0xb1, 0xe7, 0x28, 0x00, 0xa2, 0xb0, 0xf6,
+  0x5a, 0x21, 0x40, 0x14, 0xd6, 0x5e, 0x65, 0x00, 0x88, 0xc2, 0xde, 0x28, 0x04, 0x00, 0x51, 0xd8,
+  0x73, 0x04, 0x00, 0x20, 0x0a, 0x7b, 0xb2, 0x00, 0x00, 0x44, 0x61, 0x4f, 0x16, 0x02, 0x80, 0x28,
+  0xec, 0xc9, 0x34, 0x00, 0x10, 0x85, 0x3d, 0x99, 0xdc, 0x01, 0xa2, 0xb0, 0x27, 0x9f, 0xa3, 0x40,
+  0x14, 0x36, 0x93, 0x3b, 0x00, 0x88, 0xc2, 0x26, 0x4d, 0x8e, 0x16, 0x51, 0xd8, 0xa4, 0x19, 0x00,
+  0x20, 0x0a, 0xab, 0xac, 0x00, 0x00, 0x44, 0x69, 0x61, 0x14, 0x02, 0x80, 0x28, 0x2d, 0x0c, 0x54,
+  0x08, 0x10, 0xa5, 0x05, 0x47, 0x93, 0xa3, 0xa2, 0xb4, 0x20, 0xd3, 0xab, 0x53, 0x94, 0x16, 0x68,
+  0x21, 0x00, 0x88, 0xd2, 0x12, 0x01, 0x00, 0x00, 0x51, 0x5a, 0x72, 0x04, 0x00, 0x20, 0x4a, 0x4b,
+  0xee, 0x14, 0x02, 0x44, 0x69, 0xc9, 0xa5, 0x01, 0x80, 0x28, 0x2d, 0xb9, 0x49, 0x01, 0x10, 0xa5,
+  0x25, 0xfb, 0x2a, 0x03, 0xa2, 0xb4, 0xc7, 0x0a, 0x01, 0x40, 0x94, 0x06, 0x59, 0x60, 0x00, 0x88,
+  0xd2, 0xe0, 0x73, 0x07, 0x00, 0x51, 0x5c, 0x60, 0x00, 0x00, 0x20, 0x8a, 0x0b, 0xac, 0x10, 0x00,
+  0x44, 0x71, 0xc1, 0x8d, 0xe0, 0x8e, 0x28, 0x2e, 0x38, 0x02, 0x00, 0x10, 0xc5, 0x05, 0x77, 0x00,
+  0x00, 0xa2, 0xb8, 0xe0, 0x28, 0x00, 0x40, 0x14, 0x17, 0x1c, 0x4d, 0xee, 0x88, 0xe2, 0x82, 0x2c,
+  0x04, 0x00, 0x51, 0x5c, 0x90, 0xc9, 0x01, 0x20, 0x8a, 0x0b, 0xb4, 0x10, 0x00, 0x44, 0x71, 0x81,
+  0x26, 0x47, 0x81, 0x28, 0x8e, 0x00, 0x00, 0x00, 0x10, 0xc5, 0x91, 0x42, 0x00, 0x00, 0xa2, 0x38,
+  0x92, 0x08, 0x00, 0x40, 0x14, 0x47, 0x18, 0x00, 0x00, 0x88, 0xe2, 0x08, 0x2b, 0x04, 0x00, 0x51,
+  0x1c, 0x61, 0xc9, 0x1d, 0x20, 0x8a, 0x23, 0x2c, 0x03, 0x00, 0x44, 0x71, 0x44, 0x16, 0x59, 0x88,
+  0x28, 0x8e, 0x4c, 0x9a, 0xdc, 0x11, 0xc5, 0x91, 0x0c, 0x00, 0x00, 0xa2, 0xb8, 0x02, 0x00, 0x00,
+  0x40, 0x14, 0x57, 0x58, 0x1a, 0x81, 0x89, 0xe2, 0x8a, 0x1b, 0x81, 0x01, 0x51, 0x5c, 0x71, 0xa4,
+  0x10, 0x20, 0x8a, 0x2b, 0xee, 0x00, 0x00, 0x44, 0x71, 0xc5, 0x9d, 0x32, 0x81, 0x28, 0xae, 0xc8,
+  0x42, 0x00, 0x10, 0xc5, 0x95, 0x59, 0x08, 0x00, 0xa2, 0xb8, 0x32, 0x4d, 0x9d, 0x40, 0x14, 0x57,
+  0x66, 0x72, 0x07, 0x88, 0xe2, 0x4e, 0x95, 0xc9, 0x1d, 0x51, 0x5c, 0x1a, 0x69, 0x00, 0x20, 0x8a,
+  0x4b, 0xae, 0x10, 0x00, 0x44, 0x71, 0xc9, 0x51, 0x00, 0x80, 0x28, 0x6e, 0x01, 0x00, 0x00, 0x10,
+  0xc5, 0x3d, 0x99, 0xdc, 0x01, 0xa2, 0xb8, 0x89, 0x92, 0x3b, 0x40, 0x14, 0x47, 0x8b, 0x4b, 0x03,
+  0x88, 0xe2, 0x28, 0x4a, 0xee, 0x00, 0x51, 0x1c, 0xcd, 0x00, 0x00, 0x20, 0x0a, 0x0c, 0x2e, 0xb9,
+  0x03, 0x44, 0x81, 0xc5, 0x11, 0x00, 0x80, 0x28, 0xb0, 0x38, 0x9a, 0x06, 0x10, 0x05, 0xa6, 0x27,
+  0x03, 0x03, 0xa2, 0x40, 0x0a, 0x00, 0x00, 0x40, 0x14, 0x48, 0x93, 0xa3, 0x69, 0x88, 0x22, 0x83,
+  0x60, 0x00, 0x00, 0x51, 0x64, 0x10, 0x2c, 0x39, 0x2a, 0x8a, 0x0c, 0x04, 0x00, 0x00, 0x44, 0x91,
+  0x81, 0x05, 0x06, 0x80, 0x28, 0x32, 0xb0, 0xe4, 0x00, 0x10, 0x45, 0x06, 0x47, 0x00, 0x00, 0xa2,
+  0xc8, 0xe0, 0x0a, 0x01, 0x40, 0x14, 0x39, 0x02, 0x2b, 0x00, 0x88, 0x22, 0x09, 0x00, 0x00, 0x00,
+  0x51, 0x24, 0x99, 0x85, 0x00, 0x20, 0x8a, 0x2c, 0x00, 0x00, 0x00, 0x44, 0x91, 0x85, 0x00, 0x00,
+  0x80, 0x28, 0xb2, 0xb8, 0x01, 0x00, 0x10, 0x45, 0x16, 0x47, 0x00, 0x00, 0xa2, 0xc8, 0xe2, 0x0e,
+  0x00, 0x40, 0x14, 0x59, 0xdc, 0x29, 0x04, 0x88, 0x22, 0x8b, 0x4b, 0xee, 0x00, 0x51, 0x64, 0x91,
+  0x81, 0x01, 0x20, 0x8a, 0x2c, 0xb2, 0x10, 0x00, 0x44, 0x91, 0x27, 0x50, 0x00, 0x80, 0x28, 0xf2,
+  0x14, 0x02, 0x00, 0x10, 0x45, 0x9e, 0x22, 0x93, 0xa3, 0xa2, 0xc8, 0x93, 0x08, 0x00, 0x40, 0x14,
+  0x99, 0x82, 0xa3, 0x85, 0x88, 0x22, 0xd3, 0x00, 0x00, 0x00, 0x51, 0x64, 0x1a, 0xa8, 0x10, 0x20,
+  0x8a, 0x4c, 0x23, 0xb9, 0x03, 0x44, 0x91, 0x89, 0x00, 0x00, 0x80, 0x28, 0x32, 0x11, 0x06, 0x00,
+  0x10, 0x45, 0x26, 0x96, 0x1c, 0x05, 0xa2, 0xc8, 0xc4, 0x32, 0x00, 0x40, 0x14, 0x99, 0x1c, 0x01,
+  0x00, 0x88, 0x22, 0x93, 0x2b, 0x04, 0x00, 0x51, 0x64, 0x72, 0x07, 0x00, 0x20, 0x8a, 0x4c, 0x8e,
+  0xa6, 0x01, 0x44, 0x91, 0xe9, 0x39, 0x00, 0x80, 0x28, 0x32, 0xd1, 0x42, 0x00, 0x10, 0x45, 0xae,
+  0x02, 0x00, 0x00, 0xa2, 0xc8, 0x55, 0x08, 0x00, 0x40, 0x14, 0xb9, 0x8a, 0x2b, 0x04, 0x88, 0x22,
+  0x19, 0x01, 0x00, 0x00, 0x51, 0x64, 0x03, 0x00, 0x00, 0x20, 0x8a, 0x6c, 0x89, 0x00, 0x00, 0x44,
+  0x91, 0x2d, 0x39, 0x00, 0x80, 0x28, 0xf2, 0xb1, 0xe4, 0x0e, 0x10, 0x45, 0x3e, 0x37, 0x68, 0x21,
+  0xa2, 0xc8, 0xe7, 0x68, 0x21, 0x40, 0x14, 0xf9, 0x64, 0x90, 0x05, 0x88, 0x22, 0x9f, 0x2c, 0x04,
+  0x00, 0x51, 0xe4, 0x93, 0xc9, 0x1d, 0x20, 0x8a, 0x7c, 0x32, 0x39, 0x0a, 0x44, 0x91, 0x8f, 0xa6,
+  0x01, 0x80, 0x28, 0xf2, 0x55, 0xf9, 0xea, 0x14, 0x45, 0xd2, 0x42, 0x00, 0x00, 0xa2, 0x48, 0x5a,
+  0x48, 0x1a, 0x40, 0x14, 0x49, 0x8b, 0x03, 0x00, 0x88, 0x22, 0x69, 0x71, 0x14, 0x00, 0x51, 0x24,
+  0x45, 0x85, 0x00, 0x20, 0x8a, 0xbc, 0x05, 0x00, 0x00, 0x44, 0x99, 0x05, 0x00, 0x00, 0x80, 0x28,
+  0x13, 0x01, 0x00, 0x00, 0x10, 0x65, 0xa2, 0x02, 0x00, 0x00, 0xa2, 0x4c, 0x54, 0xdc, 0x01, 0x40,
+  0x94, 0x89, 0x8a, 0xa3, 0x00, 0x88, 0x32, 0x51, 0x1a, 0x34, 0x0d, 0x51, 0x26, 0x4a, 0x04, 0x00,
+  0x20, 0xca, 0x44, 0xaf, 0x25, 0x77, 0x44, 0x99, 0xe8, 0xc9, 0xe4, 0x8e, 0x28, 0x13, 0xd1, 0xe4,
+  0x68, 0x11, 0x65, 0xa6, 0xc0, 0x0a, 0x01, 0xa2, 0xcc, 0x34, 0xd2, 0x00, 0x40, 0x94, 0x99, 0x46,
+  0x72, 0x05, 0x88, 0x32, 0xdf, 0x48, 0x8e, 0x02, 0x51, 0xe6, 0x6b, 0x85, 0x00, 0x20, 0xca, 0x7c,
+  0x33, 0x8d, 0xc0, 0x44, 0x99, 0x6f, 0x66, 0x00, 0x80, 0x28, 0xf3, 0x55, 0x59, 0x08, 0x10, 0x65,
+  0xc2, 0xe0, 0x0e, 0x00, 0xa2, 0x4c, 0x58, 0x08, 0x00, 0x40, 0x94, 0x09, 0x51, 0x21, 0x00, 0x88,
+  0x32, 0x21, 0x4a, 0xee, 0x00, 0x51, 0x26, 0x4c, 0x03, 0x00, 0x20, 0xca, 0x84, 0xc9, 0x1d, 0x00,
+  0x44, 0x99, 0xf0, 0x51, 0x00, 0x80, 0x28, 0x13, 0xca, 0xc0, 0x00, 0x10, 0x65, 0x42, 0x9a, 0xdc,
+  0x01, 0xa2, 0x4c, 0x98, 0x01, 0x00, 0x40, 0x94, 0x39, 0x9f, 0xa3, 0x85, 0x88, 0x32, 0xe7, 0x93,
+  0xaf, 0x32, 0x51, 0xe6, 0x9c, 0xe9, 0xd5, 0x29, 0xca, 0x9c, 0xf3, 0xd5, 0x09, 0x44, 0x99, 0x93,
+  0x02, 0x00, 0x80, 0x28, 0x73, 0xd2, 0x42, 0x00, 0x10, 0x65, 0x4e, 0x9a, 0x06, 0x00, 0xa2, 0xcc,
+  0x49, 0x93, 0x3b, 0x40, 0x94, 0x39, 0x69, 0x7a, 0x75, 0x8a, 0x32, 0x29, 0x00, 0x00, 0x00, 0x51,
+  0x26, 0x0d, 0x0e, 0x00, 0x20, 0xca, 0xa4, 0xc1, 0x15, 0x00, 0x44, 0x99, 0x34, 0xb8, 0x03, 0x80,
+  0x28, 0x93, 0x06, 0x59, 0x08, 0x10, 0x65, 0xd2, 0x02, 0x00, 0x00, 0xa2, 0x4c, 0x5a, 0x02, 0x03,
+  0x40, 0x94, 0x49, 0x0b, 0x01, 0x00, 0x88, 0x32, 0x69, 0x71, 0x00, 0x00, 0x51, 0x26, 0x2d, 0xee,
+  0x00, 0x20, 0xca, 0xa4, 0xc5, 0xd1, 0x02, 0x44, 0x99, 0xb4, 0x48, 0x00, 0x80, 0x28, 0x93, 0x16,
+  0x19, 0x18, 0x10, 0x65, 0xd2, 0x22, 0x0b, 0x01, 0xa2, 0x4c, 0x5a, 0x64, 0x1a, 0x40, 0x94, 0x49,
+  0x8b, 0x4c, 0xab, 0x88, 0x32, 0x69, 0x91, 0xaf, 0x15, 0x51, 0x26, 0x2d, 0xf2, 0x55, 0x26, 0xca,
+  0xa4, 0x45, 0xbe, 0x3a, 0x45, 0x99, 0xb4, 0xcc, 0xe4, 0xa8, 0x28, 0x93, 0x9a, 0x5a, 0x08, 0x10,
+  0x65, 0x52, 0x53, 0xe7, 0x04, 0xa2, 0x4c, 0x8a, 0x00, 0x00, 0x40, 0x94, 0x49, 0x51, 0x09, 0x0c,
+  0x88, 0x32, 0x29, 0x2a, 0x04, 0x00, 0x51, 0x26, 0x45, 0xc5, 0x1d, 0x20, 0xca, 0xa4, 0xc8, 0xd4,
+  0x09, 0x44, 0x99, 0x14, 0xa5, 0x01, 0x80, 0x28, 0x93, 0xa2, 0xe4, 0x00, 0x10, 0x65, 0x52, 0x94,
+  0x1c, 0x05, 0xa2, 0x4c, 0x8a, 0xd2, 0xab, 0x53, 0x94, 0x49, 0x11, 0x2b, 0x73, 0x8a, 0x32, 0x29,
+  0x62, 0xc9, 0x1d, 0x51, 0x26, 0x45, 0x34, 0xb9, 0x23, 0xca, 0xa4, 0x69, 0x00, 0x00, 0x44, 0x99,
+  0x34, 0x8d, 0xc0, 0x80, 0x28, 0x93, 0x26, 0x92, 0xdc, 0x11, 0x65, 0xd2, 0xc4, 0x0a, 0x01, 0xa2,
+  0x4c, 0x9a, 0x1c, 0x00, 0x40, 0x94, 0x49, 0x93, 0x0b, 0x0c, 0x88, 0x32, 0x69, 0x72, 0x07, 0x00,
+  0x51, 0x26, 0x4d, 0x8e, 0x02, 0x20, 0xca, 0xa4, 0xc9, 0xd1, 0x42, 0x44, 0x99, 0x34, 0x39, 0x9a,
+  0x86, 0x28, 0x93, 0xa6, 0x99, 0x02, 0x13, 0x65, 0xd2, 0x34, 0xd3, 0x2a, 0xa2, 0x4c, 0x9a, 0x66,
+  0x72, 0x47, 0x94, 0x49, 0xd3, 0x9c, 0x73, 0x8a, 0x32, 0x69, 0x9a, 0x14, 0x00, 0x51, 0x26, 0x4d,
+  0x93, 0x16, 0x20, 0xca, 0xa4, 0x69, 0xd2, 0x34, 0x44, 0x99, 0x34, 0xd1, 0x34, 0x80, 0x28, 0x93,
+  0x26, 0x9b, 0xdc, 0x11, 0x65, 0x52, 0x96, 0x06, 0x00, 0xa2, 0x4c, 0xfa, 0x5a, 0x01, 0x40, 0x94,
+  0x49, 0x9f, 0x3b, 0x00, 0x88, 0x32, 0xe9, 0x93, 0x69, 0x00, 0x51, 0x26, 0x7d, 0x75, 0x02, 0x20,
+  0xca, 0xa4, 0x32, 0x30, 0x00, 0x44, 0x99, 0x94, 0x16, 0x02, 0x80, 0x28, 0x93, 0xd2, 0xe4, 0x68,
+  0x11, 0x65, 0xd2, 0x2a, 0x01, 0x00, 0xa2, 0x4c, 0x5a, 0x65, 0x21, 0x40, 0x94, 0x49, 0xab, 0x7c,
+  0x75, 0x8a, 0x32, 0x69, 0x06, 0x00, 0x00, 0x51, 0x66, 0x4d, 0x04, 0x00, 0x20, 0xca, 0xac, 0x69,
+  0x16, 0x02, 0x44, 0xa1, 0x85, 0x00, 0x00, 0x80, 0x28, 0x14, 0xa5, 0x01, 0x00, 0x10, 0x85, 0xd6,
+  0xf9, 0x2a, 0x03, 0xa2, 0xd8, 0x02, 0x00, 0x00, 0x40, 0x14, 0x5b, 0x58, 0x21, 0x00, 0x88, 0x62,
+  0x0b, 0x4b, 0x03, 0x00, 0x51, 0x6c, 0x71, 0x00, 0x00, 0x20, 0x8a, 0x2d, 0x8e, 0x00, 0x00, 0x44,
+  0xb1, 0xc5, 0x25, 0x07, 0x80, 0x28, 0xb6, 0xb8, 0xe4, 0x0e, 0x10, 0xc5, 0x16, 0x97, 0x1c, 0x05,
+  0xa2, 0xd8, 0xe2, 0x68, 0x5a, 0x45, 0x14, 0x5b, 0x1c, 0x4d, 0xee, 0x88, 0x62, 0x8b, 0x2c, 0x04,
+  0x00, 0x51, 0x6c, 0x91, 0xc9, 0x11, 0x20, 0x8a, 0x2d, 0x93, 0x26, 0x77, 0x44, 0xb9, 0x41, 0x3a,
+  0x00, 0x80, 0x48, 0xe3, 0xb5, 0xb4, 0x0a, 0x11, 0xe9, 0x94, 0x59, 0x00, 0x00, 0x22, 0x1d, 0x94,
+  0x04, 0x2b, 0x44, 0xa4, 0x83, 0x92, 0xa3, 0x69, 0x88, 0x74, 0x10, 0x4d, 0xee, 0x00, 0x91, 0x58,
+  0x60, 0xc9, 0x15, 0x22, 0x12, 0x0b, 0x8e, 0x00, 0x00, 0x44, 0x72, 0xc1, 0x01, 0x00, 0x80, 0x48,
+  0x2e, 0x38, 0x02, 0x00, 0x10, 0xc9, 0x05, 0x97, 0x06, 0x00, 0x22, 0xb9, 0xe0, 0xd2, 0xab, 0x53,
+  0x24, 0x17, 0x68, 0x72, 0x07, 0x88, 0xe4, 0x08, 0x00, 0x00, 0x00, 0x91, 0x1c, 0x29, 0x04, 0x00,
+  0x20, 0x92, 0x23, 0x69, 0x50, 0x00, 0x44, 0x72, 0x24, 0xb9, 0xc0, 0x8a, 0x48, 0x8e, 0x24, 0x47,
+  0x01, 0x10, 0xc9, 0x15, 0x00, 0x00, 0x00, 0x22, 0xb9, 0xe2, 0x92, 0x3b, 0x40, 0x24, 0x57, 0x64,
+  0x60, 0x85, 0x88, 0xe4, 0x8a, 0x2c, 0x04, 0x00, 0x91, 0x5c, 0x1a, 0xc9, 0x51, 0x20, 0x92, 0x4b,
+  0x8e, 0x26, 0x47, 0x45, 0x72, 0x0b, 0x00, 0x00, 0x80, 0x48, 0xb0, 0x00, 0x00, 0x00, 0x10, 0x49,
+  0x06, 0x56, 0x08, 0x00, 0x22, 0xc9, 0x44, 0x00, 0x00, 0x40, 0x24, 0x99, 0x58, 0x01, 0x00, 0x88,
+  0x24, 0x93, 0x2d, 0x04, 0x00, 0x91, 0x64, 0x06, 0x00, 0x00, 0x20, 0xd2, 0x44, 0xc9, 0x1d, 0x00,
+  0x44, 0x9a, 0x8f, 0x95, 0xc0, 0x80, 0x48, 0x93, 0x16, 0x02, 0x00, 0x10, 0x69, 0xd2, 0xe2, 0x02,
+  0x03, 0x22, 0x4d, 0x5a, 0x1c, 0x4d, 0x43, 0xa4, 0x59, 0x65, 0x91, 0x00, 0x88, 0x44, 0x51, 0x71,
+  0x07, 0x00, 0x91, 0x28, 0x32, 0x95, 0x15, 0x22, 0x12, 0x45, 0xc9, 0x01, 0x00, 0x44, 0xa2, 0x69,
+  0x50, 0x00, 0x80, 0x48, 0xb6, 0x38, 0x9a, 0xdc, 0x11, 0x49, 0xeb, 0xe4, 0x0a, 0x01, 0x82, 0x85,
+  0x91, 0xdc, 0x01, 0x40, 0xb0, 0x70, 0x8a, 0x03, 0x00, 0x08, 0x16, 0x12, 0x4d, 0x03, 0x00, 0xc1,
+  0xc2, 0x02, 0x00, 0x00, 0x20, 0x58, 0x60, 0x04, 0x00, 0x00, 0x04, 0x0b, 0xec, 0xb9, 0x03, 0x80,
+  0x60, 0x81, 0x3d, 0x47, 0x01, 0x10, 0x2c, 0x34, 0x00, 0x00, 0x00, 0x82, 0x85, 0x16, 0x58, 0x21,
+  0x40, 0xb0, 0xe0, 0x08, 0x00, 0x00, 0x08, 0x16, 0xdc, 0x29, 0x04, 0x00, 0xc1, 0x82, 0xa3, 0x81,
+  0x01, 0x20, 0x58, 0x70, 0xb4, 0x10, 0x00, 0x04, 0x0b, 0x8e, 0xa6, 0x01, 0x80, 0x60, 0x01, 0xd2,
+  0xe4, 0x0e, 0x10, 0x2c, 0xc8, 0x40, 0x01, 0x00, 0x82, 0x05, 0x39, 0x68, 0x72, 0x47, 0xb0, 0x20,
+  0x0b, 0x00, 0x00, 0x08, 0x16, 0x64, 0x91, 0x81, 0x01, 0xc1, 0x82, 0x2c, 0xf2, 0xd5, 0x29, 0x58,
+  0x90, 0x69, 0x14, 0x02, 0x04, 0x0b, 0x32, 0x39, 0x00, 0x80, 0x60, 0x41, 0x26, 0x77, 0x00, 0x10,
+  0x2c, 0xc8, 0xe4, 0xd2, 0x00, 0x82, 0x05, 0x99, 0x1c, 0x05, 0x40, 0xb0, 0x20, 0xd3, 0x44, 0x00,
+  0x08, 0x16, 0x64, 0x9a, 0x69, 0x00, 0xc1, 0x82, 0x74, 0xe9, 0xb5, 0x22, 0x58, 0x90, 0x4f, 0xbe,
+  0x3a, 0x05, 0x0b, 0xf2, 0x55, 0x06, 0x80, 0x60, 0x41, 0xbe, 0x2a, 0x0b, 0x11, 0x2c, 0x48, 0x48,
+  0x93, 0x3b, 0x82, 0x85, 0x19, 0x64, 0x21, 0x40, 0xb0, 0x30, 0x93, 0x4b, 0x8e, 0x0a, 0x16, 0xe6,
+  0x93, 0xc9, 0x1d, 0xc1, 0xc2, 0xa4, 0x05, 0x00, 0x20, 0x58, 0x98, 0x34, 0x0d, 0x00, 0x04, 0x0b,
+  0x93, 0x26, 0x77, 0x80, 0x60, 0x61, 0x52, 0x56, 0x08, 0x10, 0x2c, 0xd0, 0x40, 0x29, 0x00, 0x82,
+  0x05, 0x5a, 0x00, 0x00, 0x40, 0xb0, 0x40, 0x8b, 0xa9, 0x0c, 0x08, 0x16, 0x68, 0x71, 0x00, 0x00,
+  0xc1, 0x02, 0x45, 0x65, 0x4e, 0x20, 0x58, 0xa0, 0x28, 0x0d, 0x00, 0x04, 0x0b, 0x34, 0x39, 0x00,
+  0x80, 0x60, 0x81, 0x26, 0x57, 0x00, 0x10, 0x2c, 0xd0, 0x44, 0x93, 0xa3, 0x82, 0x05, 0x9a, 0x6c,
+  0x21, 0x40, 0xb0, 0x40, 0x29, 0x2b, 0x04, 0x08, 0x16, 0x6c, 0x91, 0x19, 0x00, 0xc1, 0x0a, 0x00,
+  0x00, 0x00, 0x20, 0x58, 0x09, 0x6e, 0x00, 0x00, 0x04, 0x2b, 0x23, 0x38, 0x00, 0x80, 0x60, 0x85,
+  0x00, 0x00, 0x00, 0x10, 0xac, 0x14, 0x47, 0x0b, 0x00, 0x82, 0x15, 0x56, 0x1c, 0x05, 0x40, 0xb0,
+  0xc2, 0x92, 0x3b, 0x00, 0x08, 0x56, 0x58, 0x72, 0x14, 0x00, 0xc1, 0x0a, 0x63, 0x81, 0x01, 0x20,
+  0x58, 0x61, 0x2c, 0x0d, 0x00, 0x04, 0x2b, 0xec, 0xc9, 0xc0, 0x80, 0x60, 0x85, 0xbd, 0xea, 0x0e,
+  0x10, 0xac, 0x38, 0x02, 0x00, 0x00, 0x82, 0x15, 0x57, 0x08, 0x00, 0x40, 0xb0, 0x22, 0x0b, 0x00,
+  0x00, 0x08, 0x56, 0x64, 0x21, 0x00, 0x00, 0xc1, 0x8a, 0x2c, 0x32, 0xb9, 0x23, 0x58, 0x91, 0xe9,
+  0x55, 0x06, 0x04, 0x2b, 0xf2, 0xc9, 0x57, 0xa7, 0x60, 0x65, 0xd2, 0x42, 0x00, 0x10, 0x2c, 0x15,
+  0x00, 0x00, 0x00, 0x82, 0xa5, 0xe2, 0x92, 0x3b, 0x40, 0xb0, 0x74, 0x50, 0x01, 0x00, 0x08, 0x96,
+  0x0e, 0x2a, 0xb2, 0x00, 0xc1, 0x12, 0x63, 0x85, 0x00, 0x20, 0x58, 0x6a, 0xc1, 0x01, 0x00, 0x04,
+  0x4b, 0xad, 0x00, 0x00, 0x80, 0x60, 0xa9, 0x15, 0xf9, 0xea, 0x14, 0x2c, 0xb5, 0x34, 0x29, 0x00,
+  0x82, 0x25, 0x47, 0x00, 0x00, 0x40, 0xb0, 0xe4, 0x4e, 0x65, 0x00, 0x08, 0x96, 0x5c, 0x1a, 0x81,
+  0x01, 0xc1, 0x92, 0x4b, 0xb6, 0x10, 0x20, 0x58, 0x72, 0x14, 0x00, 0x00, 0x04, 0x4b, 0x8e, 0x16,
+  0x02, 0x80, 0x60, 0xc9, 0xd1, 0xe4, 0x0e, 0x10, 0x2c, 0x39, 0xca, 0x00, 0x00, 0x82, 0x25, 0x47,
+  0x59, 0x21, 0x40, 0xb0, 0xe4, 0x68, 0x06, 0x00, 0x08, 0x96, 0xa4, 0x90, 0x85, 0x00, 0xc1, 0xd2,
+  0x0c, 0x0e, 0x00, 0x20, 0x58, 0x9a, 0x4f, 0x06, 0x06, 0x04, 0x4b, 0xf4, 0x39, 0x0a, 0x80, 0x60,
+  0x2f, 0xd0, 0x42, 0x00, 0x10, 0xec, 0x91, 0xe4, 0x0e, 0x00, 0x82, 0xbd, 0x34, 0x02, 0x2b, 0x44,
+  0xb0, 0xb7, 0x00, 0x00, 0x00, 0x08, 0xf6, 0x58, 0x21, 0x00, 0x00, 0xc1, 0x1e, 0x4b, 0x03, 0x00,
+  0x20, 0xd8, 0x6b, 0x05, 0x00, 0x00, 0x04, 0x7b, 0x2d, 0x0d, 0x00, 0x80, 0x60, 0xaf, 0xb1, 0x22,
+  0x0b, 0x11, 0xec, 0x39, 0x02, 0x00, 0x00, 0x82, 0x3d, 0x47, 0x0b, 0x01, 0x40, 0xb0, 0xf7, 0x64,
+  0x21, 0x00, 0x08, 0xf6, 0x60, 0x22, 0x00, 0x00, 0xc1, 0x9e, 0x04, 0x00, 0x00, 0x20, 0xd8, 0x93,
+  0xc1, 0x1d, 0x00, 0x04, 0x7b, 0x32, 0x38, 0x5a, 0x88, 0x60, 0x4f, 0x16, 0x00, 0x00, 0x10, 0xec,
+  0xc9, 0xe2, 0x0e, 0x00, 0x82, 0x3d, 0x99, 0x46, 0x60, 0x40, 0xb0, 0x27, 0x93, 0xa3, 0x69, 0x08,
+  0xf6, 0x64, 0x4b, 0x03, 0x00, 0xc1, 0x9e, 0x7c, 0x34, 0x11, 0x20, 0xd8, 0x93, 0x8f, 0xa6, 0x55,
+  0x04, 0x7b, 0xf2, 0xd5, 0x39, 0x81, 0x60, 0x8f, 0x16, 0x07, 0x00, 0x10, 0xec, 0xd1, 0xe2, 0x0e,
+  0x00, 0x82, 0xbd, 0x2a, 0xd3, 0xa0, 0x45, 0xb0, 0x57, 0xa5, 0xa3, 0x05, 0x08, 0xf6, 0xea, 0x4c,
+  0xee, 0x00, 0xc1, 0x9e, 0x2d, 0x04, 0x00, 0x20, 0x18, 0x2c, 0x0c, 0x00, 0x00, 0x04, 0xab, 0x04,
+  0x00, 0x00, 0x80, 0x60, 0x35, 0x39, 0x02, 0x00, 0x10, 0xac, 0xba, 0x93, 0x06, 0x00, 0x82, 0x55,
+  0xf7, 0x5a, 0x01, 0x40, 0xb0, 0xea, 0x68, 0x21, 0x00, 0x88, 0x17, 0x5c, 0x72, 0xb4, 0x10, 0xf1,
+  0xc2, 0xa4, 0x69, 0x00, 0x20, 0x1e, 0x29, 0x00, 0x00, 0x00, 0xc4, 0x2b, 0x32, 0xb9, 0x03, 0x80,
+  0x78, 0xa6, 0xb8, 0x34, 0x00, 0x10, 0xcf, 0x14, 0x99, 0x5e, 0x9d, 0xe2, 0x9d, 0xe4, 0xd2, 0x00,
+  0x40, 0x3c, 0xf4, 0x64, 0x21, 0x00, 0x88, 0x97, 0x1c, 0x2d, 0x04, 0x00, 0xf1, 0x58, 0x18, 0xc9,
+  0x1d, 0x20, 0x1e, 0x0b, 0xae, 0x10, 0x00, 0xc4, 0x63, 0x41, 0x06, 0x06, 0x80, 0x78, 0x2c, 0xc8,
+  0xf4, 0xea, 0x14, 0x8f, 0x0d, 0x04, 0x00, 0x00, 0xe2, 0xb1, 0x91, 0xdc, 0x01, 0x40, 0x3c, 0x46,
+  0x00, 0x00, 0x00, 0x88, 0xc7, 0x8a, 0xa3, 0x00, 0x00, 0xf1, 0x98, 0xa9, 0xac, 0x10, 0x20, 0x1e,
+  0x4b, 0x23, 0x05, 0x06, 0xc4, 0x63, 0x89, 0xa5, 0x39, 0x81, 0x78, 0x2c, 0x39, 0x02, 0x00, 0x10,
+  0x8f, 0x25, 0x77, 0x00, 0x00, 0xe2, 0xb1, 0x34, 0x61, 0x1a, 0x40, 0x3c, 0xc6, 0x08, 0x2b, 0x04,
+  0x88, 0xc7, 0x58, 0x01, 0x00, 0x00, 0xf1, 0x18, 0x2b, 0x32, 0x11, 0x20, 0x1e, 0x63, 0x0c, 0x00,
+  0x00, 0xc4, 0x63, 0x8c, 0x15, 0x02, 0x80, 0x78, 0xac, 0x05, 0x96, 0x06, 0x10, 0x8f, 0xcd, 0x40,
+  0xcb, 0x9c, 0xe2, 0xb1, 0x49, 0xd3, 0x00, 0x40, 0xbc, 0x16, 0x46, 0x1a, 0x00, 0x88, 0xd7, 0x02,
+  0x01, 0x00, 0x00, 0xf1, 0x9a, 0x08, 0x33, 0x39, 0x2a, 0x5e, 0x13, 0xc9, 0x1d, 0x00, 0xc4, 0x6b,
+  0x82, 0x15, 0x02, 0x80, 0x78, 0xad, 0x00, 0x00, 0x00, 0x10, 0xaf, 0x15, 0xc6, 0x0a, 0x01, 0xe2,
+  0xb5, 0x32, 0x33, 0x00, 0x40, 0xbc, 0x96, 0xdc, 0x01, 0x00, 0x88, 0xd7, 0x92, 0xa3, 0x00, 0x00,
+  0xf1, 0x5a, 0x2b, 0xee, 0x00, 0x20, 0x5e, 0x83, 0x88, 0x15, 0x02, 0xc4, 0x6b, 0x30, 0x03, 0x00,
+  0x80, 0x78, 0x2e, 0xb0, 0xe4, 0x0e, 0x10, 0xcf, 0x11, 0x00, 0x00, 0x00, 0xe2, 0x39, 0x52, 0x08,
+  0x00, 0x40, 0x3c, 0x47, 0x8a, 0xa3, 0x00, 0x88, 0xe7, 0x48, 0x22, 0x00, 0x00, 0xf1, 0x1c, 0x99,
+  0xc9, 0x1d, 0x20, 0x9e, 0x2b, 0xa6, 0x32, 0x00, 0xc4, 0x73, 0xc5, 0x11, 0x00, 0x80, 0x78, 0xae,
+  0xb8, 0x03, 0x00, 0x10, 0xcf, 0x15, 0x59, 0x08, 0x00, 0xe2, 0xb9, 0x34, 0xd2, 0x00, 0x40, 0x3c,
+  0x97, 0x4e, 0x21, 0x00, 0x88, 0xe7, 0x26, 0x4a, 0x03, 0x00, 0xf1, 0x1c, 0x45, 0x65, 0xce, 0x29,
+  0x9e, 0xa3, 0x69, 0x52, 0x00, 0xc4, 0x7b, 0x81, 0x26, 0x77, 0x80, 0x78, 0x8f, 0x00, 0x00, 0x00,
+  0x10, 0xef, 0x91, 0x34, 0x93, 0x3b, 0xe2, 0xbd, 0x25, 0xe7, 0xab, 0x53, 0xbc, 0xc7, 0x8a, 0xa3,
+  0x00, 0x88, 0xf7, 0x5a, 0x71, 0x07, 0x00, 0xf1, 0x5e, 0x2b, 0x8e, 0x02, 0x20, 0xde, 0x6b, 0x45,
+  0x12, 0x00, 0xc4, 0x7b, 0x32, 0xb9, 0x03, 0x80, 0x78, 0x4f, 0x26, 0x47, 0x0b, 0x11, 0xef, 0x55,
+  0x98, 0xdc, 0x01, 0xe2, 0xbd, 0x5b, 0x08, 0x00, 0x40, 0x3c, 0x58, 0x5c, 0x21, 0x00, 0x88, 0x07,
+  0x13, 0x0d, 0x14, 0x00, 0xf1, 0x64, 0x18, 0x00, 0x00, 0x20, 0x9e, 0x0c, 0xa3, 0x10, 0x00, 0xc4,
+  0x93, 0x61, 0xa4, 0x11, 0x98, 0x78, 0x32, 0xb0, 0xe4, 0x0e, 0x10, 0x4f, 0x86, 0x56, 0x08, 0x00,
+  0xe2, 0xc9, 0xe0, 0x0a, 0x01, 0x40, 0x3c, 0x19, 0x1c, 0x4d, 0x03, 0x88, 0x27, 0x83, 0x1c, 0x81,
+  0x01, 0xf1, 0x64, 0x90, 0x05, 0x00, 0x20, 0x9e, 0x0c, 0xb2, 0x10, 0x00, 0xc4, 0x93, 0x41, 0xa6,
+  0x01, 0x80, 0x78, 0x52, 0x04, 0x77, 0x00, 0x10, 0x4f, 0x8e, 0xe2, 0x0e, 0x00, 0xe2, 0xc9, 0x51,
+  0x1c, 0x05, 0x40, 0x3c, 0x39, 0x50, 0x01, 0x00, 0x88, 0x27, 0x07, 0x2a, 0xee, 0x00, 0xf1, 0xe4,
+  0x48, 0x03, 0x00, 0x20, 0x9e, 0x1c, 0x89, 0x00, 0x00, 0xc4, 0x93, 0x23, 0xb9, 0x03, 0x80, 0x78,
+  0x72, 0xa4, 0x49, 0x01, 0x10, 0x4f, 0x8e, 0x2a, 0x5f, 0x9d, 0xe2, 0x49, 0x02, 0x00, 0x00, 0x40,
+  0x3c, 0x49, 0x0a, 0x00, 0x00, 0x88, 0x27, 0x49, 0x21, 0x00, 0x00, 0xf1, 0x24, 0x29, 0xf2, 0xd5,
+  0x29, 0x9e, 0x24, 0xc9, 0xd1, 0x34, 0xc4, 0x93, 0x24, 0x4d, 0x5a, 0x88, 0x78, 0x92, 0xb0, 0x42,
+  0x00, 0x10, 0x4f, 0x12, 0x49, 0x00, 0x00, 0xe2, 0xc9, 0x02, 0x00, 0x00, 0x40, 0x3c, 0x59, 0x08,
+  0x00, 0x00, 0x88, 0x27, 0x0b, 0x4b, 0xee, 0x00, 0xf1, 0x64, 0x61, 0xc9, 0x51, 0x20, 0x9e, 0x2c,
+  0x8e, 0x00, 0x00, 0xc4, 0x93, 0xc5, 0x15, 0x00, 0x80, 0x78, 0xb2, 0xb8, 0x42, 0x00, 0x10, 0x4f,
+  0x16, 0x77, 0x00, 0x00, 0xe2, 0xc9, 0xe2, 0xd2, 0x00, 0x40, 0x3c, 0x59, 0xdc, 0xab, 0x0c, 0x88,
+  0x27, 0x8b, 0xa3, 0x00, 0x00, 0xf1, 0x64, 0x71, 0xb4, 0x10, 0x20, 0x9e, 0x2c, 0xb2, 0x10, 0x00,
+  0xc4, 0x93, 0x45, 0x26, 0x77, 0x80, 0x78, 0xb2, 0x4c, 0x0a, 0x00, 0x10, 0x4f, 0x96, 0x49, 0x53,
+  0x60, 0xe2, 0xc9, 0x83, 0x0a, 0x01, 0x40, 0x3c, 0x79, 0x92, 0x03, 0x00, 0x88, 0x27, 0x53, 0xa0,
+  0x00, 0x00, 0xf1, 0x64, 0x1a, 0x81, 0x01, 0x20, 0x9e, 0x4c, 0x23, 0xb0, 0x42, 0xc4, 0x93, 0x69,
+  0x04, 0xc9, 0x80, 0x78, 0x32, 0x8d, 0x42, 0x00, 0x10, 0x4f, 0xa6, 0x81, 0x8a, 0x3b, 0xe2, 0xc9,
+  0x34, 0x68, 0x1a, 0x40, 0x3c, 0x99, 0x08, 0x00, 0x00, 0x88, 0x27, 0x13, 0x2b, 0x00, 0x00, 0xf1,
+  0x64, 0x62, 0x85, 0x00, 0x20, 0x9e, 0x4c, 0x2c, 0x0d, 0x00, 0xc4, 0x93, 0xc9, 0x11, 0x00, 0x80,
+  0x78, 0x32, 0xb9, 0x42, 0x00, 0x10, 0x4f, 0x26, 0x57, 0x64, 0x01, 0xe2, 0xc9, 0xe4, 0x0e, 0x00,
+  0x40, 0x3c, 0x99, 0x5c, 0x7a, 0x75, 0x8a, 0x27, 0x93, 0xa3, 0x00, 0x00, 0xf1, 0x64, 0x72, 0x34,
+  0x39, 0x20, 0x9e, 0x4c, 0x4f, 0x26, 0x77, 0xc4, 0x93, 0x49, 0x16, 0x02, 0x80, 0x78, 0x32, 0xcd,
+  0x42, 0x00, 0x10, 0x4f, 0xa6, 0x59, 0x64, 0x01, 0xe2, 0xc9, 0x34, 0xcb, 0x04, 0x40, 0x3c, 0x99,
+  0x66, 0x72, 0x07, 0x88, 0x27, 0xd3, 0x4c, 0x8e, 0x02, 0xf1, 0x64, 0x9a, 0xe9, 0xd5, 0x29, 0x9e,
+  0x4c, 0xf3, 0xb9, 0x03, 0xc4, 0x93, 0x69, 0x52, 0x00, 0x80, 0x78, 0x32, 0x4d, 0x5a, 0xdc, 0x11,
+  0x4f, 0xa6, 0x49, 0x93, 0x3b, 0xe2, 0xc9, 0x44, 0x93, 0xa3, 0x40, 0x3c, 0xb9, 0x0a, 0x01, 0x00,
+  0x88, 0x27, 0x59, 0x71, 0x07, 0x00, 0xf1, 0x24, 0x4b, 0xb6, 0x10, 0x20, 0x9e, 0x6c, 0x00, 0x00,
+  0x00, 0xc4, 0x93, 0x2d, 0xb0, 0x42, 0x80, 0x78, 0xb2, 0x15, 0x02, 0x00, 0x10, 0x4f, 0x3a, 0x0a,
+  0x00, 0x00, 0xe2, 0x49, 0x47, 0x0b, 0x01, 0x40, 0x3c, 0xf9, 0x58, 0x21, 0x00, 0x88, 0x27, 0x1f,
+  0x2b, 0x8e, 0x02, 0xf1, 0xe4, 0x63, 0xc9, 0x01, 0x20, 0x9e, 0x7c, 0x8e, 0x00, 0x00, 0xc4, 0x93,
+  0x4f, 0x12, 0x00, 0x80, 0x78, 0xf2, 0xc9, 0x42, 0x00, 0x10, 0x4f, 0x3e, 0x69, 0x2a, 0x03, 0xe2,
+  0xc9, 0x27, 0xd3, 0x00, 0x40, 0x3c, 0xf9, 0x64, 0x7a, 0x75, 0x8a, 0x27, 0xa5, 0x4b, 0xaf, 0x4e,
+  0xf1, 0xe4, 0xa4, 0x69, 0x00, 0x20, 0x9e, 0xa4, 0x00, 0x00, 0x00, 0xc4, 0x93, 0x34, 0xc8, 0x42,
+  0x80, 0x78, 0x92, 0x06, 0x0a, 0x00, 0x10, 0x4f, 0xd2, 0x02, 0x00, 0x00, 0xe2, 0x49, 0x5a, 0x08,
+  0x00, 0x40, 0x3c, 0x49, 0x8b, 0x03, 0x00, 0x88, 0x27, 0x29, 0x2a, 0x00, 0x00, 0xf1, 0x24, 0x45,
+  0x69, 0x00, 0x20, 0x9e, 0xa4, 0x28, 0x39, 0x5a, 0xc4, 0x93, 0x14, 0x51, 0x00, 0x80, 0x78, 0x92,
+  0xa6, 0x11, 0x18, 0x10, 0x4f, 0xd2, 0xe4, 0x28, 0x00, 0xe2, 0x49, 0x9a, 0x1c, 0x2d, 0x44, 0x3c,
+  0x49, 0xd3, 0xab, 0x0c, 0x88, 0x27, 0x69, 0x9a, 0x69, 0x00, 0xf1, 0x24, 0xad, 0x92, 0x00, 0x20,
+  0x9e, 0xa4, 0x19, 0x00, 0x00, 0xc4, 0x93, 0xb6, 0x10, 0x00, 0x80, 0x78, 0xd2, 0x16, 0x99, 0xdc,
+  0x11, 0x4f, 0xda, 0x44, 0x00, 0x00, 0xe2, 0x4d, 0x5a, 0x66, 0x1a, 0x40, 0x3c, 0x8a, 0x8a, 0xa3,
+  0x00, 0x88, 0x57, 0x4d, 0x95, 0x81, 0x01, 0xf1, 0x6a, 0x72, 0x05, 0x00, 0x20, 0x5e, 0x75, 0x04,
+  0x00, 0x00, 0xc4, 0xab, 0x8e, 0x14, 0x02, 0x80, 0x78, 0xd5, 0x91, 0x34, 0x00, 0x10, 0xaf, 0x3a,
+  0xc2, 0x0a, 0x01, 0xe2, 0x55, 0x47, 0x0b, 0x01, 0x40, 0xbc, 0xea, 0x68, 0x1a, 0x00, 0x88, 0x57,
+  0x1d, 0x4d, 0x23, 0x30, 0xf1, 0xea, 0x0c, 0xb4, 0x10, 0x20, 0x5e, 0x9d, 0xcf, 0xd1, 0x42, 0xc4,
+  0xab, 0xf3, 0xc9, 0xe2, 0x80, 0x78, 0x75, 0xd2, 0xe4, 0x00, 0x10, 0xaf, 0x4e, 0x9a, 0xdc, 0x01,
+  0xe2, 0xd9, 0x02, 0x00, 0x00, 0x40, 0x3c, 0x5b, 0x64, 0x60, 0x00, 0x88, 0x67, 0x8b, 0x2c, 0x04,
+  0x00, 0xf1, 0x6c, 0x91, 0xc9, 0x1d, 0x20, 0x9e, 0x7d, 0x04, 0x00, 0x00, 0xc4, 0xbb, 0xc5, 0x1d,
+  0x00, 0x80, 0x78, 0xb7, 0xcc, 0x02, 0x00, 0x10, 0xef, 0x26, 0x57, 0x08, 0x00, 0xe2, 0xe1, 0x3a,
+  0x67, 0x72, 0x47, 0xc8, 0x30, 0x00, 0x00, 0x00, 0x08, 0x19, 0x46, 0xa0, 0x29, 0x30, 0x21, 0xc3,
+  0x28, 0x04, 0x00, 0x20, 0x64, 0x18, 0x28, 0x0d, 0x00, 0x84, 0x0c, 0x23, 0x0d, 0x00, 0x80, 0x90,
+  0x61, 0x24, 0x47, 0x01, 0x10, 0x32, 0x8c, 0x2a, 0x0b, 0x00, 0x42, 0x06, 0x02, 0x00, 0x00, 0x40,
+  0xc8, 0x70, 0x8a, 0x3b, 0x00, 0x08, 0x19, 0x0e, 0x4a, 0x03, 0x00, 0x21, 0xc3, 0x2a, 0x8e, 0x02,
+  0x20, 0x64, 0x60, 0x05, 0x00, 0x00, 0x84, 0x0c, 0xac, 0xb8, 0x03, 0x80, 0x90, 0x81, 0xd1, 0x42,
+  0x00, 0x10, 0x32, 0xb4, 0x40, 0x01, 0x00, 0x42, 0x86, 0x56, 0x00, 0x00, 0x40, 0xc8, 0xd0, 0x0a,
+  0x01, 0x00, 0x08, 0x19, 0xda, 0xab, 0x13, 0x01, 0x21, 0x83, 0x23, 0x00, 0x00, 0x20, 0x64, 0x70,
+  0x05, 0x00, 0x00, 0x84, 0x0c, 0xee, 0x14, 0x02, 0x80, 0x90, 0xc1, 0xd1, 0x42, 0x00, 0x10, 0x32,
+  0x38, 0x9a, 0x06, 0x00, 0x42, 0x06, 0x47, 0x93, 0x2b, 0x40, 0xc8, 0x20, 0x03, 0x05, 0x00, 0x08,
+  0x19, 0xa4, 0x60, 0x85, 0x00, 0x21, 0x83, 0x2c, 0x04, 0x00, 0x20, 0x64, 0x90, 0x85, 0x24, 0x77,
+  0x84, 0x0c, 0xb2, 0xb8, 0x03, 0x80, 0x90, 0x41, 0x16, 0x59, 0x08, 0x10, 0x32, 0x48, 0x44, 0x93,
+  0x03, 0x42, 0x06, 0x99, 0x46, 0x60, 0x40, 0xc8, 0x20, 0x93, 0x3b, 0x00, 0x08, 0x19, 0x64, 0x72,
+  0x14, 0x00, 0x21, 0x83, 0x4c, 0x8e, 0x16, 0x20, 0x64, 0x90, 0x69, 0xa2, 0x42, 0x84, 0x0c, 0x32,
+  0xd1, 0x42, 0x80, 0x90, 0x41, 0xb2, 0xe4, 0x0e, 0x10, 0x32, 0xc8, 0xd7, 0x0a, 0x01, 0x42, 0x06,
+  0xf9, 0xdc, 0x01, 0x40, 0xc8, 0x20, 0x5f, 0x9d, 0x13, 0x08, 0x19, 0x24, 0x94, 0x81, 0x01, 0x21,
+  0xc3, 0x0c, 0xac, 0x10, 0x20, 0x64, 0x98, 0x81, 0x02, 0x00, 0x84, 0x0c, 0xb3, 0x10, 0x00, 0x80,
+  0x90, 0x61, 0xa2, 0x42, 0x00, 0x10, 0x32, 0x4c, 0x54, 0x64, 0x21, 0x42, 0x86, 0xf9, 0x28, 0x00,
+  0x40, 0xc8, 0x30, 0x67, 0x21, 0x00, 0x08, 0x19, 0xe6, 0x44, 0xc9, 0x1d, 0x21, 0xc3, 0x9c, 0x69,
+  0x00, 0x20, 0x64, 0x98, 0x33, 0x8d, 0xc0, 0x84, 0x0c, 0x93, 0x16, 0x02, 0x80, 0x90, 0x61, 0xd2,
+  0xf4, 0xea, 0x14, 0x32, 0xd0, 0x02, 0x00, 0x00, 0x42, 0x06, 0x5a, 0x1c, 0x2d, 0x44, 0xc8, 0x40,
+  0xd3, 0x00, 0x00, 0x08, 0x19, 0x68, 0x1a, 0xc1, 0x51, 0x21, 0x03, 0x4d, 0x04, 0x00, 0x20, 0x64,
+  0xa0, 0xc9, 0x1d, 0x00, 0x84, 0x0c, 0x34, 0x39, 0x0a, 0x80, 0x90, 0x81, 0xb2, 0x02, 0x00, 0x10,
+  0x32, 0xd0, 0x0b, 0x00, 0x00, 0x42, 0x06, 0x5b, 0xdc, 0x01, 0x40, 0xc8, 0x80, 0x93, 0xa9, 0x13,
+  0x08, 0x39, 0x42, 0x4b, 0x8e, 0x02, 0x21, 0x47, 0x70, 0x07, 0x00, 0x20, 0xe4, 0x28, 0x30, 0x39,
+  0x00, 0x84, 0x1c, 0x45, 0x96, 0x09, 0x80, 0x90, 0x05, 0x00, 0x00, 0x00, 0x10, 0xb2, 0x84, 0x91,
+  0x1c, 0x05, 0x42, 0x96, 0xc0, 0x32, 0x00, 0x40, 0xc8, 0x12, 0x5c, 0x72, 0x07, 0x08, 0x59, 0x02,
+  0x2d, 0x04, 0x00, 0x21, 0x0b, 0x01, 0x00, 0x00, 0x20, 0x64, 0x21, 0xc9, 0x1d, 0x00, 0x84, 0x2c,
+  0x24, 0x39, 0x0a, 0x80, 0x90, 0xa5, 0x38, 0x02, 0x00, 0x10, 0xb2, 0xb0, 0x02, 0x00, 0x00, 0x42,
+  0x16, 0x56, 0x08, 0x00, 0x40, 0xc8, 0xc2, 0xd2, 0xa4, 0x00, 0x08, 0x59, 0xd8, 0xa3, 0x85, 0x00,
+  0x21, 0x8b, 0x0b, 0xee, 0x00, 0x20, 0x64, 0x71, 0x04, 0x00, 0x00, 0x84, 0x2c, 0x8e, 0x14, 0x02,
+  0x80, 0x90, 0xc5, 0xa5, 0x01, 0x00, 0x10, 0xb2, 0xb8, 0x44, 0x92, 0x3b, 0x42, 0x16, 0x97, 0xdc,
+  0x01, 0x40, 0xc8, 0xe2, 0x68, 0x1a, 0x00, 0x08, 0x59, 0x1c, 0x4d, 0xee, 0x00, 0x21, 0x8b, 0xa3,
+  0xac, 0x10, 0x20, 0x64, 0x81, 0xc9, 0x1d, 0x00, 0x84, 0x2c, 0x12, 0x00, 0x00, 0x80, 0x90, 0x45,
+  0x16, 0x00, 0x00, 0x10, 0xb2, 0xc8, 0xe2, 0x0e, 0x00, 0x42, 0x16, 0x99, 0x08, 0x00, 0x40, 0xc8,
+  0x22, 0x93, 0x3b, 0x00, 0x08, 0x59, 0x26, 0x4a, 0xee, 0x00, 0x21, 0xcb, 0x6c, 0xaf, 0x32, 0x20,
+  0xe4, 0x29, 0x8e, 0x02, 0x00, 0x84, 0x4c, 0xc1, 0x1d, 0x00, 0x80, 0x90, 0x89, 0x4c, 0x2a, 0x0b,
+  0x10, 0x32, 0x15, 0x47, 0x00, 0x00, 0x42, 0xa6, 0x22, 0x0b, 0x01, 0x40, 0xc8, 0x74, 0x0a, 0x01,
+  0x00, 0x08, 0x99, 0x58, 0x71, 0x14, 0x00, 0x21, 0x53, 0x0b, 0xac, 0x4c, 0x20, 0x64, 0x6a, 0x61,
+  0xa2, 0x42, 0x84, 0x4c, 0x8e, 0x00, 0x00, 0x80, 0x90, 0xc9, 0x91, 0xe4, 0x0e, 0x10, 0x32, 0x39,
+  0xc2, 0x0a, 0x01, 0x42, 0x26, 0x77, 0x0a, 0x01, 0x40, 0xc8, 0xe4, 0xd2, 0x08, 0xee, 0x08, 0x99,
+  0x5c, 0x32, 0x75, 0x00, 0x21, 0x93, 0x4b, 0x0e, 0x00, 0x20, 0x64, 0x72, 0x69, 0x16, 0x77, 0x84,
+  0x4c, 0x8e, 0x02, 0x00, 0x80, 0x90, 0xc9, 0xd1, 0x20, 0x0b, 0x10, 0x32, 0x39, 0x5a, 0x08, 0x00,
+  0x42, 0x26, 0x47, 0x53, 0x60, 0x40, 0xc8, 0xe4, 0x68, 0x1a, 0x00, 0x08, 0x99, 0x1c, 0x4d, 0xee,
+  0x00, 0x21, 0x93, 0xa3, 0xe9, 0xd5, 0x29, 0x64, 0x72, 0x94, 0x15, 0x02, 0x84, 0x4c, 0x32, 0x11,
+  0x00, 0x80, 0x90, 0x49, 0x26, 0x77, 0x00, 0x10, 0x32, 0x49, 0x77, 0x00, 0x00, 0x42, 0xa6, 0x19,
+  0x46, 0x60, 0x40, 0xc8, 0x34, 0x83, 0xa3, 0x00, 0x08, 0x99, 0x26, 0x4a, 0x82, 0x01, 0x21, 0xd3,
+  0x7c, 0xb2, 0x10, 0x20, 0x64, 0x9a, 0x8f, 0x16, 0x02, 0x84, 0x4c, 0x73, 0x96, 0xc0, 0x80, 0x90,
+  0x69, 0xce, 0xf4, 0xea, 0x14, 0x32, 0x4d, 0x5a, 0x08, 0x00, 0x42, 0xa6, 0x49, 0xd3, 0x00, 0x40,
+  0xc8, 0x34, 0x69, 0x72, 0x07, 0x08, 0x99, 0x68, 0x71, 0x07, 0x00, 0x21, 0x13, 0x2d, 0x8e, 0x16,
+  0x22, 0x64, 0xa2, 0x69, 0x04, 0x06, 0x84, 0x4c, 0x34, 0xb9, 0x03, 0x80, 0x90, 0x89, 0x26, 0x9a,
+  0xdc, 0x11, 0x32, 0x51, 0x99, 0x26, 0x00, 0x42, 0xb6, 0xe2, 0x02, 0x2d, 0x44, 0xc8, 0x17, 0xdc,
+  0x01, 0x00, 0x08, 0xf9, 0x82, 0x7c, 0x75, 0x02, 0x21, 0x1f, 0x01, 0x00, 0x00, 0x20, 0xe4, 0x23,
+  0x85, 0x00, 0x00, 0x84, 0x7c, 0x24, 0x8d, 0x42, 0x80, 0x90, 0x8f, 0x24, 0x47, 0x01, 0x10, 0xf2,
+  0x11, 0x56, 0x08, 0x00, 0x42, 0xbe, 0x05, 0x00, 0x00, 0x40, 0xc8, 0xc7, 0x08, 0x00, 0x00, 0x08,
+  0xf9, 0x18, 0x29, 0xb2, 0x00, 0x21, 0x1f, 0x4b, 0x0c, 0x00, 0x20, 0xe4, 0x63, 0xcf, 0x1d, 0x00,
+  0x84, 0x7c, 0x8c, 0x16, 0x02, 0x80, 0x90, 0xaf, 0x15, 0x00, 0x00, 0x10, 0xf2, 0xb5, 0xe2, 0x28,
+  0x00, 0x42, 0xbe, 0x56, 0x1c, 0x2d, 0x44, 0xc8, 0xd7, 0xca, 0x2c, 0x04, 0x08, 0xf9, 0x5a, 0x9a,
+  0x34, 0x0d, 0x21, 0x9f, 0x23, 0x00, 0x00, 0x20, 0xe4, 0x73, 0x34, 0x15, 0x02, 0x84, 0x7c, 0x0f,
+  0xa6, 0x01, 0x80, 0x90, 0x0f, 0x26, 0x02, 0x00, 0x10, 0xf2, 0xc9, 0xc0, 0x0a, 0x01, 0x42, 0x3e,
+  0x19, 0xdc, 0x01, 0x40, 0xc8, 0x27, 0x83, 0xcc, 0x00, 0x08, 0xf9, 0x64, 0xa0, 0x00, 0x00, 0x21,
+  0x9f, 0x0c, 0x34, 0xb9, 0x23, 0xe4, 0x93, 0x85, 0x00, 0x00, 0x84, 0x7c, 0xb2, 0xb8, 0x03, 0x80,
+  0x90, 0x4f, 0x16, 0x47, 0xd3, 0x10, 0xf2, 0xc9, 0x22, 0x0b, 0x00, 0x42, 0x3e, 0x59, 0x64, 0x72,
+  0x47, 0xc8, 0x27, 0x8b, 0x7c, 0x75, 0x0a, 0xf9, 0x64, 0x32, 0x75, 0x02, 0x21, 0x9f, 0x4c, 0xee,
+  0x00, 0x20, 0xe4, 0x93, 0xc9, 0xd1, 0x42, 0x84, 0x7c, 0x32, 0x4d, 0x54, 0x88, 0x90, 0x4f, 0xb2,
+  0x34, 0x00, 0x10, 0xf2, 0xc9, 0x47, 0x0b, 0x01, 0x42, 0x3e, 0x0a, 0x00, 0x00, 0x40, 0xc8, 0x47,
+  0x03, 0x2b, 0x04, 0x08, 0xf9, 0x68, 0x71, 0x14, 0x00, 0x21, 0x1f, 0x2d, 0x93, 0x16, 0x20, 0xe4,
+  0xa3, 0x88, 0x15, 0x02, 0x84, 0x7c, 0x14, 0x65, 0x00, 0x80, 0x90, 0x8f, 0x26, 0x77, 0x00, 0x10,
+  0xf2, 0xd1, 0x27, 0x5f, 0x9d, 0x42, 0x3e, 0x5a, 0x19, 0x00, 0x40, 0xc8, 0x47, 0x33, 0x00, 0x00,
+  0x08, 0xf9, 0xaa, 0x3b, 0x00, 0x00, 0x21, 0x5f, 0x95, 0x85, 0x00, 0x20, 0xe4, 0xab, 0xb3, 0x10,
+  0x00, 0x84, 0x7c, 0x75, 0x26, 0x77, 0x80, 0x90, 0xaf, 0x4e, 0x0a, 0x00, 0x10, 0xf2, 0xd9, 0x42,
+  0x00, 0x00, 0x42, 0x3e, 0x5b, 0x64, 0x21, 0x40, 0xc8, 0x77, 0x83, 0x3b, 0x00, 0x08, 0xf9, 0x6e,
+  0xa0, 0xc9, 0x01, 0x21, 0xdf, 0x2d, 0xee, 0x00, 0x20, 0xe4, 0xbb, 0x45, 0xbe, 0x3a, 0x85, 0x7c,
+  0xd7, 0x1d, 0x00, 0x80, 0x90, 0x35, 0x39, 0x02, 0x00, 0x10, 0xb2, 0x3a, 0x02, 0x00, 0x00, 0x42,
+  0x56, 0x57, 0x64, 0x21, 0x40, 0xc8, 0xea, 0x4e, 0x21, 0x00, 0x08, 0x59, 0x5d, 0x72, 0x07, 0x00,
+  0x51, 0x45, 0x72, 0x85, 0x00, 0x20, 0xaa, 0x48, 0x8e, 0x02, 0x00, 0x44, 0x1d, 0xc5, 0x01, 0x00,
+  0x80, 0xa8, 0xa3, 0x38, 0x5a, 0x00, 0x10, 0x75, 0xb0, 0x77, 0x0b, 0x01, 0xa2, 0x9e, 0x40, 0x0b,
+  0x01, 0x40, 0xd4, 0x83, 0x0a, 0x01, 0x00, 0x88, 0x7a, 0x12, 0x01, 0x00, 0x00, 0x51, 0x4f, 0x9a,
+  0x85, 0x00, 0x20, 0x6a, 0x0a, 0xb4, 0xc8, 0x42, 0x44, 0x4d, 0x8e, 0x14, 0x02, 0x80, 0xa8, 0xc9,
+  0x25, 0x47, 0x01, 0x10, 0x35, 0x39, 0x1a, 0x18, 0x00, 0xa2, 0x26, 0x47, 0xd3, 0xab, 0x53, 0xd4,
+  0xe4, 0x28, 0x2b, 0x04, 0x88, 0x9a, 0x1c, 0xcd, 0x00, 0x00, 0x51, 0x13, 0x2d, 0x8e, 0x16, 0x20,
+  0x6a, 0xa2, 0xaf, 0x65, 0x00, 0x44, 0x65, 0x04, 0x00, 0x00, 0x80, 0xa8, 0x8c, 0x14, 0x02, 0x00,
+  0x10, 0x95, 0x91, 0xe2, 0x0e, 0x00, 0xa2, 0x32, 0x22, 0x8b, 0x03, 0x40, 0x54, 0x46, 0x32, 0x00,
+  0x00, 0x88, 0xca, 0xd2, 0x40, 0x14, 0x00, 0x51, 0x59, 0x72, 0x04, 0x00, 0x20, 0x2a, 0x63, 0xc9,
+  0x1d, 0x00, 0x44, 0x65, 0xcf, 0xd1, 0x42, 0x80, 0xa8, 0x2d, 0x8d, 0xe4, 0x28, 0x10, 0xb5, 0xa5,
+  0x49, 0x0b, 0x01, 0xa2, 0xb6, 0x27, 0x93, 0x3b, 0x40, 0xd4, 0x06, 0x0b, 0x01, 0x00, 0x88, 0xda,
+  0xe0, 0x9b, 0x08, 0x00, 0x51, 0x1d, 0x29, 0xf2, 0xd5, 0x29, 0xaa, 0x2b, 0x8e, 0x00, 0x00, 0x44,
+  0x75, 0x69, 0x26, 0x77, 0x80, 0xa8, 0x2e, 0xd9, 0x14, 0x18, 0x10, 0xd5, 0xcd, 0x34, 0x93, 0xa3,
+  0xa2, 0x42, 0x19, 0x08, 0x00, 0x40, 0x54, 0x28, 0x8b, 0x03, 0x00, 0x88, 0x2a, 0x83, 0x60, 0x85,
+  0x00, 0x51, 0x65, 0x18, 0x00, 0x00, 0x20, 0xaa, 0x0c, 0x04, 0x00, 0x00, 0x44, 0x95, 0xc1, 0x11,
+  0x00, 0x80, 0xa8, 0x32, 0xb8, 0x03, 0x00, 0x10, 0x55, 0x06, 0x47, 0x01, 0x00, 0xa2, 0xca, 0x91,
+  0x0e, 0x00, 0x40, 0x54, 0x39, 0x92, 0xa3, 0x00, 0x88, 0x2a, 0x09, 0x00, 0x00, 0x00, 0x51, 0x25,
+  0x29, 0x04, 0x00, 0x20, 0xaa, 0x24, 0xc5, 0xd1, 0x34, 0x44, 0x95, 0x24, 0xb9, 0x03, 0x80, 0xa8,
+  0xb2, 0x38, 0x00, 0x00, 0x10, 0x55, 0x16, 0x77, 0x00, 0x00, 0xa2, 0xca, 0xe2, 0x52, 0x21, 0x40,
+  0x54, 0x59, 0x5c, 0x72, 0x07, 0x88, 0x2a, 0x8b, 0x0c, 0x8e, 0x02, 0x51, 0x65, 0x91, 0x85, 0x00,
+  0x20, 0xaa, 0x2c, 0x33, 0x0d, 0x00, 0x44, 0x95, 0x65, 0xd2, 0x42, 0x80, 0xa8, 0x32, 0x05, 0x96,
+  0x01, 0x10, 0x55, 0xa6, 0x91, 0x06, 0x00, 0xa2, 0xca, 0x34, 0x92, 0x3b, 0x40, 0x54, 0x99, 0x08,
+  0x00, 0x00, 0x88, 0x2a, 0x13, 0x61, 0x00, 0x00, 0x51, 0x65, 0x62, 0xc9, 0x1d, 0x20, 0xaa, 0x4c,
+  0x2c, 0x03, 0x00, 0x44, 0x95, 0xc9, 0x25, 0x77, 0x80, 0xa8, 0x32, 0x39, 0x5a, 0x08, 0x10, 0x55,
+  0xa6, 0xe7, 0x68, 0x1a, 0xa2, 0xca, 0x34, 0x27, 0x05, 0x40, 0x54, 0x99, 0x26, 0x4d, 0x0e, 0x88,
+  0x2a, 0xd3, 0xcc, 0x00, 0x00, 0x51, 0x65, 0xa2, 0x45, 0x16, 0x20, 0xaa, 0x5c, 0x45, 0x16, 0x02,
+  0x44, 0x95, 0x0d, 0x00, 0x00, 0x80, 0xa8, 0xb2, 0x15, 0x77, 0x00, 0x10, 0x55, 0xb6, 0x44, 0x00,
+  0x00, 0xa2, 0xca, 0xc7, 0x0a, 0x01, 0x40, 0x54, 0xf9, 0x5a, 0x72, 0x07, 0x88, 0x2a, 0x9f, 0x3b,
+  0x00, 0x00, 0x51, 0xe5, 0x93, 0x85, 0x00, 0x20, 0xaa, 0x7c, 0x32, 0x0d, 0x00, 0x44, 0x95, 0xb2,
+  0x00, 0x00, 0x80, 0xa8, 0x92, 0x02, 0x00, 0x00, 0x10, 0x55, 0xd2, 0xe2, 0x0e, 0x00, 0xa2, 0x4a,
+  0x9a, 0x01, 0x00, 0x40, 0x54, 0x69, 0x0b, 0x00, 0x00, 0x88, 0x3a, 0x51, 0x72, 0x07, 0x00, 0x51,
+  0xe7, 0x73, 0x04, 0x00, 0x20, 0xea, 0x7c, 0xb2, 0x10, 0x00, 0x44, 0x9d, 0x30, 0xb9, 0x03, 0x80,
+  0xa8, 0x73, 0x3e, 0x59, 0x08, 0x10, 0x75, 0xd2, 0x02, 0x00, 0x00, 0xa2, 0x4e, 0x5a, 0x08, 0x00,
+  0x40, 0xd4, 0x49, 0x8b, 0x2b, 0x04, 0x88, 0x3a, 0x69, 0x71, 0x07, 0x00, 0x51, 0x27, 0x2d, 0xb3,
+  0x10, 0x20, 0xea, 0xa4, 0x06, 0x00, 0x00, 0x44, 0x9d, 0x14, 0x99, 0x4a, 0x81, 0xa8, 0x93, 0xa2,
+  0xe4, 0x0e, 0x10, 0x75, 0x52, 0xc4, 0x0a, 0x00, 0xa2, 0x4e, 0x9a, 0x06, 0x00, 0x40, 0xd4, 0x49,
+  0xd3, 0x08, 0x0c, 0x88, 0x3a, 0x69, 0x22, 0x00, 0x00, 0x51, 0x27, 0x4d, 0x0e, 0x00, 0x20, 0xea,
+  0xa4, 0xc9, 0x1d, 0x00, 0x44, 0x9d, 0x34, 0xcd, 0x34, 0x80, 0xa8, 0x93, 0x56, 0x99, 0x1c, 0x15,
+  0x75, 0xd2, 0x0c, 0x00, 0x00, 0xa2, 0xd2, 0xc0, 0x52, 0x60, 0x40, 0x54, 0x1a, 0x5a, 0x7a, 0x75,
+  0x8a, 0x4a, 0x83, 0x2b, 0x81, 0x01, 0x51, 0x69, 0x70, 0x14, 0x00, 0x20, 0x2a, 0x0d, 0xb4, 0x10,
+  0x00, 0x44, 0xa5, 0x85, 0x65, 0x00, 0x80, 0xa8, 0xb4, 0xc8, 0x40, 0x01, 0x10, 0x95, 0x22, 0x00,
+  0x00, 0x00, 0xa2, 0x52, 0x14, 0x64, 0x21, 0x40, 0x54, 0x8a, 0x0a, 0x00, 0x00, 0x88, 0x4a, 0x51,
+  0x21, 0x00, 0x00, 0x51, 0x29, 0x32, 0x95, 0x01, 0x20, 0x2a, 0x45, 0xc9, 0x1d, 0x00, 0x44, 0xa5,
+  0x28, 0x39, 0x0a, 0x80, 0xa8, 0x14, 0x25, 0x47, 0x0b, 0x11, 0x95, 0x22, 0x5a, 0x08, 0x00, 0xa2,
+  0x52, 0x44, 0x93, 0x3b, 0x40, 0x54, 0x9a, 0x1c, 0x01, 0x00, 0x88, 0x4a, 0x93, 0x3b, 0x00, 0x00,
+  0x51, 0x69, 0x72, 0xb4, 0x10, 0x20, 0x2a, 0x4d, 0x8e, 0x26, 0x77, 0x44, 0xa5, 0x69, 0xd2, 0xe4,
+  0x8e, 0xa8, 0x34, 0xd9, 0xf4, 0xea, 0x14, 0x95, 0xca, 0xe2, 0x68, 0x21, 0xa2, 0xd2, 0xca, 0x92,
+  0x3b, 0x40, 0x54, 0x5a, 0x5d, 0x60, 0x00, 0x88, 0x4a, 0xab, 0x4c, 0xee, 0x00, 0x51, 0x69, 0x9d,
+  0x95, 0x01, 0x20, 0xf2, 0x08, 0xac, 0x10, 0x00, 0x44, 0x1e, 0x85, 0x15, 0x02, 0x80, 0xc8, 0xa3,
+  0x38, 0x02, 0x00, 0x10, 0x79, 0x14, 0x77, 0x00, 0x00, 0x22, 0x8f, 0x22, 0xdd, 0x01, 0x40, 0x64,
+  0x49, 0x32, 0x00, 0x00, 0x88, 0x2c, 0x8b, 0x1b, 0xc1, 0x51, 0x91, 0x65, 0x92, 0x85, 0x00, 0x20,
+  0xb2, 0x6c, 0x69, 0x04, 0x06, 0x44, 0x96, 0x8f, 0x00, 0x00, 0x80, 0xc8, 0x93, 0xa6, 0x59, 0x08,
+  0x10, 0x99, 0x0e, 0x9a, 0xdc, 0x01, 0x22, 0x53, 0x94, 0x1c, 0x00, 0x40, 0x64, 0x8a, 0x92, 0x3b,
+  0x00, 0x88, 0x4c, 0x13, 0xcb, 0x81, 0x81, 0x11, 0x44, 0x9a, 0x85, 0x00, 0x30, 0x82, 0x90, 0x05,
+  0x00, 0x00, 0x46, 0x18, 0x61, 0xa4, 0x01, 0xc0, 0x08, 0x23, 0xc8, 0xe4, 0x0e, 0x18, 0x61, 0x14,
+  0x00, 0x00, 0x00, 0x23, 0x8c, 0xe2, 0x08, 0x00, 0x60, 0x84, 0x51, 0x26, 0x2d, 0xee, 0x8c, 0x30,
+  0x12, 0x05, 0x00, 0x80, 0x11, 0x46, 0x9d, 0x69, 0x00, 0x30, 0x02, 0x01, 0x00, 0x00, 0x00, 0x46,
+  0x20, 0x24, 0xb9, 0xc0, 0xc0, 0x08, 0xa4, 0x38, 0x5a, 0x08, 0x18, 0x81, 0x14, 0x59, 0x08, 0x00,
+  0x23, 0x90, 0x34, 0x02, 0x03, 0x60, 0x04, 0x92, 0x1c, 0x01, 0x00, 0x8c, 0x40, 0x92, 0xa3, 0xc9,
+  0xd1, 0x11, 0x48, 0x72, 0x19, 0x00, 0x30, 0x02, 0xa9, 0xb3, 0xcc, 0x09, 0x46, 0x38, 0x28, 0xb9,
+  0x03, 0xc0, 0x08, 0x07, 0xc9, 0xe4, 0x28, 0x18, 0xe1, 0x20, 0x9a, 0x82, 0x3b, 0x23, 0x9c, 0x44,
+  0x00, 0x00, 0x60, 0x84, 0x93, 0xdc, 0x01, 0x00, 0x8c, 0x70, 0x2a, 0x01, 0x00, 0x80, 0x11, 0x4e,
+  0x9d, 0xb4, 0x10, 0x30, 0xc2, 0xd1, 0x2c, 0xb9, 0x03, 0x46, 0x48, 0x05, 0x00, 0x00, 0xc0, 0x08,
+  0xa9, 0x01, 0x00, 0x00, 0x18, 0x21, 0xb9, 0x05, 0x00, 0x00, 0x23, 0x24, 0xb7, 0x0a, 0x01, 0x60,
+  0x84, 0xe4, 0x68, 0x1a, 0x81, 0x8d, 0x90, 0x26, 0x62, 0x00, 0x80, 0x11, 0xd2, 0x7c, 0xae, 0x10,
+  0x30, 0x42, 0xa2, 0x89, 0x00, 0x00, 0x46, 0x60, 0x61, 0x20, 0x0a, 0xc0, 0x08, 0x2c, 0x8c, 0xe4,
+  0x28, 0x18, 0x81, 0x85, 0x53, 0x64, 0x21, 0x23, 0xb0, 0xc0, 0x0a, 0x01, 0x60, 0x04, 0x16, 0x58,
+  0x1a, 0x00, 0x8c, 0xc0, 0x42, 0x2b, 0x04, 0x80, 0x11, 0x58, 0x70, 0x04, 0x00, 0x30, 0x02, 0x0b,
+  0xee, 0x00, 0x00, 0x46, 0x60, 0xc1, 0x51, 0x00, 0xc0, 0x08, 0x2c, 0xc8, 0xe0, 0x28, 0x18, 0x81,
+  0x05, 0x59, 0x08, 0x00, 0x23, 0xb0, 0x40, 0x0b, 0x01, 0x60, 0x04, 0x16, 0x68, 0x1a, 0x00, 0x8c,
+  0xc0, 0x46, 0x70, 0x07, 0x80, 0x11, 0xd8, 0x28, 0x8e, 0x02, 0x30, 0x02, 0x1b, 0x65, 0xa2, 0x42,
+  0x46, 0x60, 0x03, 0x15, 0x02, 0xc0, 0x08, 0x6c, 0xa0, 0x22, 0x0b, 0x19, 0x81, 0x8d, 0x34, 0x69,
+  0x01, 0x23, 0xb0, 0xf1, 0x68, 0x72, 0x67, 0x04, 0x36, 0x5e, 0x65, 0x00, 0x8c, 0xc0, 0x46, 0x95,
+  0x85, 0x80, 0x11, 0x18, 0x01, 0x00, 0x00, 0x30, 0x02, 0x23, 0x85, 0x00, 0x00, 0x46, 0x60, 0xa4,
+  0x38, 0x00, 0xc0, 0x08, 0x8c, 0x14, 0x77, 0x00, 0x18, 0x81, 0x91, 0x44, 0x00, 0x00, 0x23, 0x30,
+  0x92, 0x4c, 0x65, 0x60, 0x04, 0x46, 0x92, 0x3b, 0x00, 0x8c, 0xc0, 0x48, 0x72, 0xc9, 0x9d, 0x11,
+  0x18, 0x49, 0x33, 0xb9, 0x33, 0x02, 0x23, 0x2c, 0x0d, 0x00, 0x46, 0x60, 0x84, 0xa5, 0x11, 0xd8,
+  0x08, 0x8c, 0xb0, 0xe4, 0x28, 0x18, 0x81, 0x91, 0x49, 0x93, 0x3b, 0x23, 0x30, 0x72, 0x03, 0x05,
+  0x60, 0x04, 0x46, 0x32, 0x00, 0x00, 0x8c, 0xc0, 0x0a, 0x00, 0x00, 0x80, 0x11, 0x58, 0x71, 0x07,
+  0x00, 0x30, 0x02, 0x2b, 0x2e, 0x05, 0x06, 0x46, 0x60, 0xc5, 0xd1, 0x42, 0xc0, 0x08, 0xac, 0x38,
+  0x9a, 0xdc, 0x19, 0x81, 0x19, 0x03, 0x00, 0x00, 0x23, 0xb0, 0x14, 0x68, 0x21, 0x60, 0x04, 0x96,
+  0x46, 0x70, 0x14, 0x8c, 0xc0, 0xd2, 0x08, 0x34, 0x8d, 0x11, 0x58, 0x1a, 0x85, 0x00, 0x30, 0x02,
+  0x4b, 0x23, 0x03, 0x00, 0x46, 0x60, 0x89, 0x00, 0x00, 0xc0, 0x08, 0x2c, 0x9d, 0x42, 0x00, 0x18,
+  0x81, 0xa5, 0x53, 0x64, 0x01, 0x23, 0xb0, 0x74, 0xea, 0x9c, 0x73, 0x04, 0x96, 0x58, 0x21, 0x00,
+  0x8c, 0xc0, 0x12, 0x4b, 0x03, 0x80, 0x11, 0x58, 0x72, 0x04, 0x00, 0x30, 0x02, 0x4b, 0x8e, 0x24,
+  0x5b, 0x46, 0x60, 0xc9, 0x1d, 0x00, 0xc0, 0x08, 0x2c, 0xb9, 0x14, 0x18, 0x18, 0x81, 0x25, 0x97,
+  0x06, 0x00, 0x23, 0xb0, 0xe4, 0x92, 0x3b, 0x60, 0x04, 0x96, 0x5c, 0x72, 0x14, 0x8c, 0xc0, 0x92,
+  0xa3, 0x00, 0x80, 0x11, 0x58, 0x72, 0x34, 0x0d, 0x30, 0x02, 0x4b, 0x8e, 0x26, 0x77, 0x46, 0x60,
+  0xe9, 0xb9, 0xe4, 0xce, 0x08, 0x2c, 0xc9, 0xe7, 0x28, 0x18, 0x81, 0xa5, 0x59, 0x00, 0x00, 0x23,
+  0xb0, 0x34, 0x0b, 0x01, 0x60, 0x04, 0x96, 0x66, 0x1a, 0x85, 0x8c, 0xc0, 0xd2, 0x4c, 0xaf, 0xce,
+  0x11, 0x58, 0x9a, 0x93, 0x02, 0x30, 0x02, 0x4b, 0x93, 0x02, 0x00, 0x46, 0x60, 0x69, 0xd2, 0x42,
+  0xc0, 0x08, 0x2c, 0xd1, 0x14, 0x18, 0x18, 0x81, 0x25, 0x9b, 0x5e, 0x9d, 0x23, 0x30, 0x46, 0x00,
+  0x00, 0x60, 0x04, 0xc6, 0x08, 0x2b, 0x00, 0x8c, 0xc0, 0x18, 0x61, 0x85, 0x80, 0x11, 0x18, 0x2b,
+  0x00, 0x00, 0x30, 0x02, 0x63, 0x85, 0x00, 0x00, 0x46, 0x60, 0xac, 0x90, 0x34, 0xc0, 0x08, 0x8c,
+  0x15, 0x77, 0x00, 0x18, 0x81, 0xb1, 0xe2, 0x28, 0x00, 0x23, 0x30, 0x56, 0xe4, 0xab, 0x73, 0x04,
+  0xc6, 0xca, 0xa4, 0x00, 0x8c, 0xc0, 0x18, 0x2a, 0xb2, 0x90, 0x11, 0x18, 0x4b, 0x07, 0x00, 0x30,
+  0x02, 0x63, 0xc9, 0x1d, 0x00, 0x46, 0x60, 0x2c, 0xcd, 0x42, 0xc0, 0x08, 0x8c, 0xb1, 0xe4, 0x0e,
+  0x18, 0x81, 0xb1, 0xd7, 0x0a, 0x01, 0x23, 0x30, 0xf6, 0x1c, 0x00, 0x60, 0x04, 0xc6, 0xde, 0x2d,
+  0x8e, 0x8e, 0xc0, 0x5a, 0x21, 0x00, 0x80, 0x11, 0x58, 0x4b, 0x03, 0x00, 0x30, 0x02, 0x6b, 0xc9,
+  0x1d, 0x00, 0x46, 0x60, 0x8f, 0xbd, 0xca, 0xc0, 0x08, 0xec, 0xb5, 0x42, 0x00, 0x18, 0x81, 0x3d,
+  0x97, 0x1c, 0x05, 0x23, 0xb0, 0xe7, 0x92, 0xa3, 0x65, 0x04, 0xf6, 0x20, 0x4d, 0x05, 0x8c, 0xc0,
+  0x9e, 0x0c, 0xee, 0x80, 0x11, 0xd8, 0x93, 0x41, 0x16, 0x32, 0x02, 0x7b, 0x92, 0x00, 0x00, 0x46,
+  0x60, 0x4f, 0x16, 0x02, 0xc0, 0x08, 0xec, 0x49, 0x53, 0x19, 0x18, 0x81, 0x3d, 0x99, 0xdc, 0x01,
+  0x23, 0xb0, 0x27, 0x5f, 0x9d, 0x60, 0x04, 0x36, 0x83, 0x03, 0x00, 0x8c, 0xc0, 0xe6, 0xa4, 0xc9,
+  0x9d, 0x11, 0xd8, 0xa4, 0x85, 0x00, 0x30, 0x02, 0x9b, 0x34, 0x0d, 0x00, 0x46, 0x60, 0x14, 0x00,
+  0x00, 0xc0, 0x08, 0x8c, 0x16, 0x00, 0x00, 0x18, 0x81, 0xd1, 0x42, 0x00, 0x00, 0x23, 0x30, 0x5a,
+  0x1c, 0x00, 0x60, 0x04, 0x46, 0x8b, 0x2c, 0x00, 0x8c, 0xc0, 0x2a, 0x01, 0x00, 0x80, 0x11, 0x58,
+  0x25, 0x0c, 0x00, 0x30, 0x02, 0xab, 0x84, 0x15, 0x02, 0x46, 0x60, 0xb5, 0xc8, 0x42, 0xc0, 0x08,
+  0xac, 0x9e, 0x42, 0x00, 0x18, 0x81, 0xd5, 0xc4, 0x0a, 0x00, 0x23, 0xb0, 0xea, 0x0a, 0x01, 0x60,
+  0x04, 0x56, 0x65, 0x21, 0x00, 0x8c, 0xc0, 0xaa, 0x4c, 0x8e, 0x82, 0x11, 0x58, 0x9d, 0x85, 0x00,
+  0x30, 0x02, 0xcb, 0x00, 0x00, 0x00, 0x46, 0x68, 0x81, 0xa5, 0x11, 0xd8, 0x08, 0x2d, 0xb8, 0x53,
+  0x08, 0x18, 0xa1, 0x89, 0x40, 0x0b, 0x01, 0x23, 0xb4, 0x22, 0x09, 0x00, 0x60, 0x84, 0x96, 0xdc,
+  0x01, 0x00, 0x8c, 0xd0, 0xd2, 0x2c, 0x04, 0x80, 0x11, 0x1a, 0x4c, 0x23, 0x38, 0x30, 0x42, 0x83,
+  0x4f, 0x06, 0x06, 0x46, 0x68, 0xf0, 0xc9, 0x14, 0xd8, 0x08, 0x2e, 0xb8, 0xe4, 0x0e, 0x18, 0xc1,
+  0x05, 0x5a, 0x08, 0x00, 0x23, 0x38, 0x02, 0x00, 0x00, 0x60, 0x04, 0x47, 0x0a, 0x01, 0x00, 0x8c,
+  0xe0, 0x48, 0x91, 0xc9, 0x9d, 0x11, 0x1c, 0x49, 0x8e, 0x02, 0x30, 0x82, 0x23, 0xb0, 0x00, 0x00,
+  0x46, 0x70, 0x64, 0xd2, 0xe4, 0xce, 0x08, 0x8e, 0x64, 0x00, 0x00, 0x18, 0xc1, 0x15, 0x00, 0x00,
+  0x00, 0x23, 0xb8, 0x42, 0x00, 0x00, 0x60, 0x04, 0x57, 0x58, 0x0a, 0x0c, 0x8c, 0xe0, 0x8a, 0x23,
+  0x00, 0x80, 0x11, 0x5c, 0x71, 0x07, 0x00, 0x30, 0x82, 0x2b, 0x2e, 0xb9, 0x03, 0x46, 0x70, 0xc5,
+  0xd1, 0xb4, 0xca, 0x08, 0xae, 0xc8, 0x42, 0x00, 0x18, 0xc1, 0x15, 0x99, 0x01, 0x00, 0x23, 0xb8,
+  0x32, 0xd3, 0x00, 0x60, 0x04, 0x57, 0x26, 0x4d, 0xee, 0x8c, 0xe0, 0x4e, 0x71, 0x07, 0x80, 0x11,
+  0xdc, 0x71, 0xb4, 0x10, 0x30, 0x82, 0x4b, 0x04, 0x00, 0x00, 0x46, 0x70, 0x89, 0xb0, 0x42, 0xc0,
+  0x08, 0x2e, 0x9d, 0x42, 0x00, 0x18, 0xc1, 0x25, 0x9b, 0xdc, 0x01, 0x23, 0xb8, 0x27, 0x83, 0x2c,
+  0x64, 0x04, 0xf7, 0x64, 0x21, 0x00, 0x8c, 0xe0, 0x26, 0x02, 0x00, 0x80, 0x11, 0xdc, 0x7c, 0xad,
+  0x10, 0x30, 0x82, 0xa3, 0xc5, 0x51, 0x00, 0x46, 0x70, 0x34, 0x8d, 0xc0, 0xc0, 0x08, 0x30, 0xb8,
+  0x14, 0x18, 0x18, 0x01, 0x16, 0x00, 0x00, 0x00, 0x23, 0xc0, 0x42, 0x00, 0x00, 0x60, 0x04, 0x58,
+  0x1c, 0x00, 0x00, 0x8c, 0x00, 0x8b, 0x23, 0x00, 0x80, 0x11, 0x60, 0x71, 0x05, 0x00, 0x30, 0x02,
+  0x2c, 0xee, 0x00, 0x00, 0x46, 0x80, 0xc5, 0xd1, 0x42, 0xc0, 0x08, 0xb0, 0x38, 0x9a, 0x02, 0x1b,
+  0x01, 0x16, 0x19, 0x68, 0x01, 0x23, 0xc0, 0x22, 0x03, 0x4d, 0x63, 0x04, 0x58, 0x64, 0x21, 0x00,
+  0x8c, 0x00, 0x8b, 0x4c, 0xaf, 0xb2, 0x11, 0x60, 0x91, 0x2e, 0x30, 0x30, 0x02, 0x2c, 0x32, 0x03,
+  0x00, 0x46, 0x80, 0x65, 0xa6, 0x01, 0xc0, 0x08, 0x10, 0x25, 0x77, 0x00, 0x18, 0x01, 0xa6, 0xe0,
+  0x0a, 0x01, 0x23, 0xc0, 0x14, 0x1c, 0x2d, 0x64, 0x04, 0x98, 0x46, 0x70, 0x85, 0x8c, 0x00, 0xd3,
+  0x48, 0xee, 0x80, 0x11, 0x60, 0x9a, 0xaf, 0xce, 0x39, 0x02, 0x4c, 0x34, 0xb9, 0x03, 0x46, 0x80,
+  0xcf, 0x1d, 0x00, 0xc0, 0x08, 0xf0, 0xc9, 0x34, 0x02, 0x1b, 0x01, 0xc2, 0x02, 0x00, 0x00, 0x23,
+  0x40, 0x98, 0x01, 0x00, 0x60, 0x04, 0x28, 0x03, 0xa5, 0x85, 0x8c, 0x00, 0x65, 0x7a, 0x75, 0x82,
+  0x11, 0xa0, 0x7c, 0xb2, 0x10, 0x30, 0x02, 0x94, 0xaf, 0x4e, 0x00, 0x46, 0x80, 0x13, 0x15, 0x02,
+  0xc0, 0x08, 0x90, 0xa6, 0x11, 0x18, 0x18, 0x01, 0xd2, 0xe4, 0x68, 0x01, 0x23, 0xc0, 0x0c, 0x00,
+  0x00, 0x60, 0x04, 0x19, 0x46, 0x72, 0x14, 0x8c, 0x20, 0xc3, 0xa0, 0xc9, 0xd1, 0x11, 0x64, 0x60,
+  0x00, 0x00, 0x30, 0x82, 0x0c, 0x2c, 0x39, 0x0a, 0x46, 0x90, 0xa1, 0x25, 0x77, 0xc0, 0x08, 0x32,
+  0x38, 0x02, 0x00, 0x18, 0x41, 0x06, 0x77, 0x00, 0x00, 0x23, 0xc8, 0xe0, 0xd2, 0xab, 0x73, 0x04,
+  0x19, 0x1c, 0x2d, 0x04, 0x8c, 0x20, 0x83, 0x0c, 0xee, 0x80, 0x11, 0x64, 0x90, 0x85, 0x00, 0x30,
+  0x82, 0x0c, 0x32, 0xb9, 0x03, 0x46, 0x90, 0x81, 0x16, 0x02, 0xc0, 0x08, 0x32, 0xd0, 0x32, 0x27,
+  0x18, 0x41, 0x06, 0x9a, 0x06, 0x00, 0x23, 0xc8, 0x90, 0x01, 0x00, 0x60, 0x04, 0x29, 0x82, 0x3b,
+  0x00, 0x8c, 0x20, 0x45, 0xa0, 0x05, 0x80, 0x11, 0xa4, 0x60, 0x85, 0x00, 0x30, 0x82, 0x1c, 0x05,
+  0x00, 0x00, 0x46, 0x90, 0xa3, 0xb8, 0x03, 0xc0, 0x08, 0x72, 0xa0, 0x42, 0x00, 0x18, 0x41, 0x8e,
+  0x2a, 0x0b, 0x01, 0x23, 0x48, 0x02, 0x00, 0x00, 0x60, 0x04, 0x49, 0x0a, 0x00, 0x00, 0x8c, 0x20,
+  0x49, 0x71, 0x07, 0x80, 0x11, 0x24, 0x29, 0x2e, 0x39, 0x3a, 0x82, 0x24, 0x65, 0x4e, 0x00, 0x46,
+  0x90, 0x24, 0x05, 0x77, 0xc0, 0x08, 0x92, 0xa4, 0x01, 0x00, 0x18, 0x41, 0x92, 0xe4, 0x00, 0x00,
+  0x23, 0x48, 0x92, 0x26, 0x4d, 0x63, 0x04, 0x59, 0x00, 0x00, 0x00, 0x8c, 0x20, 0x4b, 0xa0, 0xc9,
+  0x9d, 0x11, 0x64, 0x21, 0x00, 0x00, 0x30, 0x82, 0x2c, 0xac, 0x10, 0x00, 0x46, 0x90, 0xc5, 0x11,
+  0x00, 0xc0, 0x08, 0xb2, 0xb8, 0x42, 0x00, 0x18, 0x41, 0x16, 0x77, 0x00, 0x00, 0x23, 0xc8, 0xe2,
+  0x8e, 0x3b, 0x60, 0x04, 0x59, 0x5c, 0x1a, 0x00, 0x8c, 0x20, 0x8b, 0x4b, 0xee, 0x80, 0x11, 0x64,
+  0x71, 0xc9, 0xa5, 0x31, 0x82, 0x2c, 0x2e, 0x39, 0x5a, 0x46, 0x90, 0xc5, 0xa5, 0x57, 0xe7, 0x08,
+  0xb2, 0x38, 0x5a, 0x08, 0x18, 0x41, 0x16, 0x47, 0xd3, 0x00, 0x23, 0xc8, 0xe2, 0x68, 0x22, 0x60,
+  0x04, 0x59, 0x60, 0x72, 0x00, 0x8c, 0x20, 0x8b, 0x0c, 0xac, 0x90, 0x11, 0x64, 0x91, 0x41, 0x16,
+  0x30, 0x82, 0x2c, 0x32, 0x50, 0x00, 0x46, 0x90, 0x45, 0x16, 0x00, 0xc0, 0x08, 0xb2, 0xc8, 0x42,
+  0x00, 0x18, 0x41, 0x16, 0x59, 0x64, 0x21, 0x23, 0xc8, 0x22, 0xd3, 0x00, 0x60, 0x04, 0x59, 0x64,
+  0x72, 0x07, 0x8c, 0x20, 0x8b, 0x7c, 0xb2, 0x90, 0x11, 0x64, 0x91, 0xaf, 0x32, 0x30, 0x82, 0x2c,
+  0x72, 0x16, 0x02, 0x46, 0x90, 0x45, 0x66, 0x00, 0xc0, 0x08, 0xb2, 0xcc, 0x42, 0x00, 0x18, 0x41,
+  0x96, 0x99, 0xdc, 0x01, 0x23, 0xc8, 0x32, 0x29, 0x00, 0x60, 0x04, 0x59, 0x26, 0x2d, 0x04, 0x8c,
+  0x20, 0xcb, 0xa4, 0x69, 0x80, 0x11, 0x64, 0x99, 0x34, 0xb9, 0x33, 0x82, 0x2c, 0xb3, 0x4e, 0x00,
+  0x46, 0x90, 0x65, 0x66, 0x00, 0xc0, 0x08, 0xf2, 0x14, 0x00, 0x00, 0x18, 0x41, 0x9e, 0x42, 0x00,
+  0x00, 0x23, 0xc8, 0x53, 0xdc, 0x01, 0x60, 0x04, 0x79, 0x8a, 0x4b, 0x0e, 0x8c, 0x20, 0x0f, 0x32,
+  0x75, 0x82, 0x11, 0xe4, 0x49, 0xee, 0x00, 0x30, 0x82, 0x3c, 0xc9, 0x51, 0x00, 0x46, 0x90, 0x29,
+  0xb0, 0x42, 0xc0, 0x08, 0x32, 0x05, 0x56, 0xdc, 0x19, 0x41, 0xa6, 0xc0, 0x92, 0xa3, 0x23, 0xc8,
+  0x14, 0x68, 0x1a, 0x60, 0x04, 0x99, 0x46, 0x70, 0x07, 0x8c, 0x20, 0xd3, 0x40, 0x85, 0x80, 0x11,
+  0x64, 0x1a, 0x88, 0x02, 0x30, 0x82, 0x4c, 0x23, 0x0d, 0x00, 0x46, 0x90, 0x69, 0x24, 0x07, 0xc0,
+  0x08, 0x32, 0x8d, 0xe4, 0x0e, 0x18, 0x41, 0xa6, 0x91, 0x1c, 0x05, 0x23, 0xc8, 0x34, 0xd2, 0xab,
+  0x73, 0x04, 0x99, 0x06, 0x4d, 0xee, 0x8c, 0x20, 0x13, 0x01, 0x00, 0x80, 0x11, 0x64, 0x3a, 0x85,
+  0x00, 0x30, 0x82, 0x4c, 0xac, 0x00, 0x00, 0x46, 0x90, 0x89, 0x15, 0x02, 0xc0, 0x08, 0x32, 0xb1,
+  0x64, 0xea, 0x1c, 0x41, 0x26, 0x47, 0x00, 0x00, 0x23, 0xc8, 0xe4, 0x0a, 0x00, 0x60, 0x04, 0x99,
+  0x5c, 0x21, 0x00, 0x8c, 0x20, 0x93, 0x3b, 0x00, 0x80, 0x11, 0x64, 0x72, 0x69, 0x00, 0x30, 0x82,
+  0x4c, 0x2e, 0xb9, 0x03, 0x46, 0x90, 0xc9, 0x25, 0x47, 0xc1, 0x08, 0x32, 0xb9, 0xf4, 0xea, 0x1c,
+  0x41, 0x26, 0x47, 0xd3, 0x2a, 0x23, 0xc8, 0xe4, 0x68, 0x72, 0x67, 0x04, 0x99, 0x1c, 0xa5, 0x00,
+  0x8c, 0x20, 0xd3, 0x93, 0x34, 0x8d, 0x11, 0x64, 0x92, 0x81, 0x01, 0x30, 0x82, 0x4c, 0xb2, 0x10,
+  0x00, 0x46, 0x90, 0x69, 0x16, 0x02, 0xc0, 0x08, 0x32, 0xcd, 0x34, 0x00, 0x18, 0x41, 0xa6, 0x99,
+  0xdc, 0x01, 0x23, 0xc8, 0x34, 0x29, 0x00, 0x60, 0x04, 0x99, 0x26, 0x4d, 0x81, 0x8d, 0x20, 0xd3,
+  0xa4, 0xc9, 0x9d, 0x11, 0x64, 0x9a, 0x75, 0x02, 0x30, 0x82, 0x4c, 0x14, 0x00, 0x00, 0x46, 0x90,
+  0x89, 0x26, 0x47, 0xc1, 0x08, 0x32, 0x51, 0x56, 0x08, 0x18, 0x41, 0x26, 0x5b, 0x08, 0x00, 0x23,
+  0xc8, 0x05, 0x00, 0x00, 0x60, 0x04, 0xb9, 0x0a, 0x00, 0x00, 0x8c, 0x20, 0x57, 0x91, 0xc1, 0x9d,
+  0x11, 0x24, 0x7b, 0xb4, 0x10, 0x30, 0x82, 0x6c, 0xc1, 0x01, 0x00, 0x46, 0x90, 0x2d, 0x50, 0x00,
+  0xc0, 0x08, 0xb2, 0x15, 0x00, 0x00, 0x18, 0x41, 0xb6, 0x42, 0x00, 0x00, 0x23, 0xc8, 0x56, 0x1c,
+  0x00, 0x60, 0x04, 0xd9, 0x8a, 0x2b, 0x04, 0x8c, 0x20, 0x5b, 0x71, 0x07, 0x80, 0x11, 0x64, 0x4b,
+  0x0e, 0x00, 0x30, 0x82, 0x6c, 0xaf, 0x15, 0x00, 0x46, 0x90, 0x0d, 0x22, 0x0a, 0xc0, 0x08, 0xf2,
+  0xb1, 0x42, 0x00, 0x18, 0x41, 0x3e, 0x96, 0xdc, 0x01, 0x23, 0xc8, 0xc7, 0x5e, 0x9d, 0x60, 0x04,
+  0xf9, 0x18, 0x4d, 0xee, 0x8c, 0x20, 0x5f, 0x2b, 0x04, 0x80, 0x11, 0xe4, 0x6b, 0x69, 0x00, 0x30,
+  0x82, 0x7c, 0x2d, 0xbd, 0x3a, 0x47, 0x90, 0xcf, 0xd1, 0xe4, 0xe8, 0x08, 0xf2, 0xc9, 0x02, 0x00,
+  0x18, 0x41, 0x3e, 0x59, 0x08, 0x00, 0x23, 0xc8, 0x27, 0xd3, 0x9c, 0x60, 0x04, 0xf9, 0xa4, 0x3b,
+  0x00, 0x8c, 0x20, 0x9f, 0x7c, 0xee, 0x80, 0x11, 0xe4, 0x93, 0xaf, 0x32, 0x30, 0x82, 0x7c, 0x14,
+  0x00, 0x00, 0x46, 0x90, 0xef, 0xba, 0x42, 0xc0, 0x08, 0x52, 0x06, 0x07, 0x00, 0x18, 0x41, 0xca,
+  0x44, 0x92, 0xa3, 0x23, 0xc8, 0x89, 0x92, 0x3b, 0x60, 0x04, 0x39, 0x93, 0x3b, 0x00, 0x8c, 0x20,
+  0xe7, 0x93, 0x69, 0x80, 0x11, 0x24, 0x2d, 0x04, 0x00, 0x30, 0x82, 0xa4, 0xc5, 0x01, 0x00, 0x46,
+  0x90, 0xb4, 0xb8, 0x03, 0xc0, 0x08, 0x92, 0x16, 0x97, 0x06, 0x18, 0x41, 0xd2, 0xe2, 0x28, 0x00,
+  0x23, 0x48, 0x5a, 0x24, 0x00, 0x60, 0x04, 0x49, 0x8b, 0x7c, 0x75, 0x8e, 0x20, 0x69, 0x99, 0x85,
+  0x80, 0x11, 0x24, 0x2d, 0x93, 0x02, 0x30, 0x82, 0xa4, 0xa8, 0x00, 0x00, 0x46, 0x90, 0x14, 0x15,
+  0x02, 0xc0, 0x08, 0x92, 0x22, 0x53, 0x19, 0x18, 0x41, 0x52, 0x94, 0x06, 0x00, 0x23, 0x48, 0x8a,
+  0x92, 0x3b, 0x60, 0x04, 0x49, 0xd3, 0x08, 0xee, 0x8c, 0x20, 0x69, 0x32, 0x95, 0x81, 0x11, 0x24,
+  0x4d, 0xee, 0x00, 0x30, 0x82, 0xa4, 0x69, 0x26, 0x77, 0x46, 0x90, 0x34, 0x51, 0x00, 0xc0, 0x08,
+  0x92, 0x56, 0x56, 0x08, 0x18, 0x41, 0xda, 0x42, 0x00, 0x00, 0x23, 0x48, 0x5b, 0xdc, 0x01, 0x60,
+  0x04, 0x69, 0x8b, 0x0c, 0x0c, 0x8c, 0x20, 0x6d, 0x91, 0xaf, 0xce, 0x11, 0xa4, 0x4d, 0xa6, 0xce,
+  0x39, 0xc2, 0x44, 0xc1, 0xd1, 0x34, 0x46, 0x98, 0xa8, 0x10, 0x00, 0xc0, 0x08, 0x13, 0x26, 0x5a,
+  0x08, 0x18, 0x61, 0xd2, 0x42, 0x00, 0x00, 0x23, 0x4c, 0x5a, 0xdc, 0x01, 0x60, 0x84, 0x49, 0x51,
+  0x21, 0x00, 0x8c, 0x30, 0x29, 0x4a, 0xee, 0x80, 0x11, 0x26, 0x45, 0x14, 0x00, 0x30, 0xc2, 0xa4,
+  0x69, 0x04, 0x06, 0x46, 0x98, 0x34, 0x39, 0x00, 0xc0, 0x08, 0x93, 0x26, 0x77, 0x00, 0x18, 0x61,
+  0xd2, 0xe4, 0x28, 0x00, 0x23, 0x4c, 0x2a, 0x5f, 0x2b, 0x64, 0x84, 0x59, 0x65, 0x72, 0x85, 0x8c,
+  0x40, 0xc3, 0x48, 0xee, 0x80, 0x11, 0x68, 0x60, 0x65, 0x02, 0x30, 0x02, 0x0d, 0x2e, 0xb8, 0x03,
+  0x46, 0xa0, 0xc1, 0x11, 0x00, 0xc0, 0x08, 0x34, 0x38, 0x9a, 0x06, 0x18, 0x81, 0x06, 0x59, 0x00,
+  0x00, 0x23, 0xd0, 0x20, 0x67, 0x2a, 0x64, 0x04, 0x3a, 0x9e, 0x7c, 0x75, 0x8e, 0x40, 0x0b, 0x00,
+  0x00, 0x80, 0x11, 0x68, 0x21, 0x00, 0x00, 0x30, 0x02, 0x2d, 0xae, 0x00, 0x00, 0x46, 0xa0, 0x08,
+  0x00, 0x00, 0xc0, 0x08, 0x14, 0x05, 0xfa, 0xea, 0x1c, 0x81, 0xa2, 0x02, 0x00, 0x00, 0x23, 0x50,
+  0x54, 0x08, 0x00, 0x60, 0x04, 0x8a, 0x8a, 0xa9, 0x0c, 0x8c, 0x40, 0x51, 0x71, 0x00, 0x80, 0x11,
+  0x28, 0x2a, 0xee, 0x00, 0x30, 0x02, 0x45, 0x45, 0x06, 0x06, 0x46, 0xa0, 0xa8, 0xc8, 0x42, 0xc0,
+  0x08, 0x14, 0x95, 0x59, 0x08, 0x18, 0x81, 0x22, 0x03, 0x00, 0x00, 0x23, 0x50, 0x64, 0x2a, 0x03,
+  0x60, 0x04, 0x8a, 0x4c, 0x9d, 0x85, 0x8c, 0x40, 0x51, 0x22, 0x00, 0x80, 0x11, 0x28, 0x4a, 0x06,
+  0x00, 0x30, 0x02, 0x45, 0x89, 0x15, 0x02, 0x46, 0xa0, 0x28, 0xb9, 0x42, 0xc0, 0x08, 0x14, 0x25,
+  0x77, 0x00, 0x18, 0x81, 0xa2, 0xe4, 0x68, 0x1a, 0x23, 0x50, 0xf4, 0x5a, 0x21, 0x60, 0x04, 0x8a,
+  0x9e, 0x0c, 0x0c, 0x8c, 0x40, 0x91, 0x2c, 0x04, 0x80, 0x11, 0x28, 0xa2, 0x2c, 0x0d, 0x30, 0x02,
+  0x4d, 0x23, 0xbd, 0x3a, 0x47, 0xa0, 0x89, 0x00, 0x00, 0xc0, 0x08, 0x34, 0x9d, 0x42, 0x00, 0x18,
+  0x81, 0x26, 0x77, 0x00, 0x00, 0x23, 0xd0, 0xe4, 0xd8, 0xab, 0x6c, 0x04, 0x9a, 0x1c, 0x2d, 0x04,
+  0x8c, 0x40, 0xd3, 0x44, 0xc9, 0x9d, 0x11, 0x68, 0x9a, 0xc9, 0x1d, 0x30, 0x02, 0x4d, 0x93, 0x02,
+  0x00, 0x46, 0xa0, 0x89, 0xa6, 0x57, 0xe7, 0x08, 0x54, 0x16, 0x00, 0x00, 0x18, 0x81, 0xd2, 0x40,
+  0x00, 0x00, 0x23, 0x50, 0x9a, 0x08, 0x00, 0x60, 0x04, 0x4a, 0x93, 0x03, 0x00, 0x8c, 0x40, 0x29,
+  0x2d, 0x04, 0x80, 0x11, 0x68, 0x25, 0x0c, 0x00, 0x30, 0x02, 0xad, 0xb2, 0x10, 0x00, 0x46, 0xa0,
+  0x55, 0x26, 0x77, 0xc0, 0x08, 0x75, 0x84, 0x49, 0xd3, 0x18, 0xa1, 0x8e, 0xe4, 0x0e, 0x00, 0x23,
+  0x54, 0x02, 0x00, 0x00, 0x60, 0x84, 0x5a, 0x00, 0x00, 0x00, 0x8c, 0x50, 0xcb, 0x4c, 0xee, 0x80,
+  0x11, 0xaa, 0xa9, 0xb2, 0x10, 0x30, 0x42, 0x3d, 0x05, 0x00, 0x00, 0x46, 0xa8, 0x69, 0xa4, 0x57,
+  0xe7, 0x08, 0x95, 0x11, 0x00, 0x00, 0x18, 0xa1, 0xba, 0xe0, 0x0a, 0x01, 0x23, 0x54, 0x47, 0x00,
+  0x00, 0x60, 0x84, 0xea, 0x4e, 0x21, 0x00, 0x8c, 0x50, 0x5d, 0x1a, 0x81, 0x81, 0x11, 0xaa, 0x4b,
+  0xb6, 0x10, 0x30, 0x42, 0x75, 0x14, 0x00, 0x00, 0x46, 0xa8, 0x8e, 0x16, 0x02, 0xc0, 0x08, 0xd5,
+  0xd1, 0x32, 0xe7, 0x1c, 0xa1, 0x3a, 0x9a, 0x02, 0x03, 0x23, 0x54, 0x47, 0x93, 0xa3, 0x60, 0x84,
+  0xea, 0x68, 0x7a, 0x75, 0x8e, 0x50, 0x1d, 0x65, 0x85, 0x80, 0x11, 0xaa, 0xa3, 0xaf, 0x4e, 0x30,
+  0x42, 0x95, 0x69, 0xd2, 0x34, 0x46, 0xa8, 0xb3, 0x10, 0x00, 0xc0, 0x08, 0x75, 0x96, 0x59, 0x08,
+  0x18, 0xa1, 0x4e, 0x54, 0x08, 0x00, 0x23, 0xd4, 0x89, 0x58, 0x21, 0x60, 0x84, 0x3a, 0x1f, 0x01,
+  0x00, 0x8c, 0x50, 0xe7, 0x6b, 0x85, 0x80, 0x11, 0xea, 0x7c, 0x2d, 0x03, 0x30, 0x42, 0x9d, 0xcf,
+  0x01, 0x00, 0x46, 0xa8, 0xf3, 0xd5, 0x39, 0xc1, 0x08, 0x75, 0xd2, 0xf4, 0xea, 0x1c, 0xc1, 0x06,
+  0x96, 0x06, 0x00, 0x23, 0xd8, 0x02, 0x00, 0x00, 0x60, 0x04, 0x5b, 0x08, 0x00, 0x00, 0x8c, 0x60,
+  0x0b, 0x2b, 0x00, 0x80, 0x11, 0x6c, 0x61, 0x85, 0x00, 0x30, 0x82, 0x2d, 0x2c, 0x0d, 0x00, 0x46,
+  0xb0, 0xc5, 0x01, 0x00, 0xc0, 0x08, 0xb6, 0x38, 0x02, 0x00, 0x18, 0xc1, 0x16, 0x57, 0x08, 0x00,
+  0x23, 0xd8, 0xe2, 0x0e, 0x00, 0x60, 0x04, 0x5b, 0x5c, 0x1a, 0x00, 0x8c, 0x60, 0x8b, 0x4b, 0xee,
+  0x80, 0x11, 0x6c, 0x71, 0x14, 0x00, 0x30, 0x82, 0x2d, 0x8e, 0x16, 0x00, 0x46, 0xb0, 0xc5, 0xd1,
+  0x42, 0xc0, 0x08, 0xb6, 0x38, 0x9a, 0x06, 0x18, 0xc1, 0x16, 0x47, 0x93, 0x3b, 0x23, 0xd8, 0x22,
+  0x03, 0x03, 0x60, 0x04, 0x5b, 0x64, 0x21, 0x00, 0x8c, 0x60, 0x8b, 0x34, 0x75, 0x82, 0x11, 0x6c,
+  0x91, 0xaf, 0x32, 0x30, 0x82, 0x2d, 0xb3, 0x10, 0x00, 0x46, 0xb0, 0x65, 0x26, 0x47, 0xc1, 0x08,
+  0xb6, 0xcc, 0x64, 0x0b, 0x19, 0xc1, 0x96, 0x49, 0x01, 0x00, 0x23, 0xd8, 0x32, 0x69, 0x72, 0x67,
+  0x04, 0x9b, 0x06, 0x00, 0x00, 0x8c, 0x60, 0x93, 0xa3, 0x05, 0x80, 0x11, 0x6c, 0x92, 0x04, 0x00,
+  0x30, 0x82, 0x4d, 0x33, 0xb9, 0x03, 0x46, 0xb0, 0x8f, 0xa5, 0x42, 0xc0, 0x08, 0xb7, 0xb8, 0x03,
+  0x00, 0x18, 0xe1, 0x16, 0x47, 0x0b, 0x01, 0x23, 0xdc, 0x22, 0x93, 0x3b, 0x60, 0x04, 0x1d, 0x58,
+  0x72, 0x07, 0x8c, 0xa0, 0x03, 0x4b, 0xaf, 0xb2, 0x11, 0x74, 0x70, 0x69, 0x00, 0x30, 0x82, 0x0e,
+  0x34, 0x8d, 0xc0, 0x46, 0xd0, 0x45, 0x26, 0x47, 0xcb, 0x08, 0x5a, 0x27, 0x02, 0x00, 0x18, 0x41,
+  0x6b, 0x06, 0x00, 0x00, 0x23, 0x68, 0xcd, 0x0a, 0x01, 0x60, 0x04, 0xad, 0x33, 0x00, 0x00, 0x8c,
+  0x12, 0x46, 0x70, 0x07, 0x80, 0x51, 0xc2, 0xc8, 0x00, 0x00, 0x30, 0x4a, 0x20, 0x00, 0x00, 0x00,
+  0x46, 0x09, 0xad, 0xb8, 0x03, 0xc0, 0x28, 0xa1, 0x15, 0x59, 0x08, 0x18, 0x25, 0xb4, 0x32, 0x07,
+  0x00, 0xa3, 0x84, 0x96, 0x1c, 0x05, 0x60, 0x94, 0xe0, 0x4e, 0x01, 0x00, 0x8c, 0x12, 0x1c, 0x65,
+  0x85, 0x80, 0x51, 0x02, 0x7c, 0x8e, 0x02, 0x30, 0x4a, 0x80, 0x8f, 0xa6, 0x01, 0x46, 0x09, 0xb2,
+  0xb8, 0x03, 0xc0, 0x28, 0x41, 0x16, 0x47, 0xd3, 0x18, 0x25, 0xc8, 0x22, 0xcb, 0x04, 0xa3, 0x04,
+  0x99, 0x5e, 0x65, 0x60, 0x94, 0x20, 0x5f, 0x72, 0x07, 0x8c, 0x12, 0xe4, 0x6b, 0x85, 0x80, 0x51,
+  0xc2, 0x0c, 0x04, 0x00, 0x30, 0x4a, 0x98, 0x14, 0x00, 0x00, 0x46, 0x09, 0x93, 0x16, 0x02, 0xc0,
+  0x28, 0x61, 0xd2, 0xe4, 0x00, 0x18, 0x25, 0xd0, 0x34, 0x00, 0x00, 0xa3, 0x04, 0x9a, 0x5c, 0x21,
+  0x60, 0x94, 0x40, 0x93, 0x3b, 0x00, 0x8c, 0x12, 0x70, 0x71, 0x07, 0x80, 0x51, 0x82, 0x66, 0x85,
+  0x00, 0x30, 0xca, 0x08, 0x2c, 0x39, 0x5a, 0x46, 0x19, 0xc1, 0x01, 0x00, 0xc0, 0x28, 0xa3, 0xb0,
+  0x42, 0x00, 0x18, 0x65, 0x14, 0x96, 0xdc, 0x01, 0xa3, 0x8c, 0xc2, 0x32, 0x00, 0x60, 0x94, 0x51,
+  0x1c, 0x01, 0x00, 0x8c, 0x32, 0x8a, 0x0c, 0x92, 0x80, 0x51, 0x46, 0x91, 0x85, 0x00, 0x30, 0xca,
+  0x28, 0xf2, 0xd5, 0x09, 0x46, 0x19, 0x28, 0x39, 0x00, 0xc0, 0x28, 0x23, 0x8d, 0xf4, 0xea, 0x1c,
+  0x65, 0x24, 0x57, 0x00, 0x00, 0xa3, 0x8c, 0xe4, 0x0e, 0x00, 0x60, 0x94, 0x51, 0x65, 0x21, 0x00,
+  0x8c, 0x42, 0x12, 0x4b, 0xee, 0x80, 0x51, 0xc8, 0x93, 0x24, 0x39, 0x3a, 0x8a, 0x29, 0x04, 0x00,
+  0x00, 0x46, 0x31, 0x85, 0x14, 0x02, 0xc0, 0x28, 0xa6, 0x38, 0x02, 0x00, 0x18, 0xc5, 0x14, 0x77,
+  0x00, 0x00, 0xa3, 0x98, 0x22, 0x8b, 0x04, 0x60, 0x14, 0x53, 0x66, 0x99, 0x13, 0x8c, 0x62, 0xaa,
+  0x2c, 0x04, 0x80, 0x51, 0x4e, 0x90, 0x85, 0x00, 0x30, 0xca, 0x41, 0xc5, 0x1d, 0x00, 0x46, 0x39,
+  0x28, 0xb9, 0x03, 0xc0, 0x28, 0xc9, 0x51, 0x00, 0x00, 0x18, 0x85, 0x8d, 0xe4, 0x00, 0x00, 0xa3,
+  0xb0, 0xf1, 0x5a, 0x21, 0x60, 0x14, 0x46, 0x00, 0x00, 0x00, 0x8c, 0xc2, 0x48, 0x01, 0x00, 0x80,
+  0x51, 0x18, 0x29, 0x04, 0x00, 0x30, 0x0a, 0x23, 0xe9, 0xd5, 0x09, 0x46, 0x61, 0x84, 0x25, 0x77,
+  0xc0, 0x28, 0xac, 0x08, 0x59, 0x08, 0x18, 0x85, 0x15, 0x06, 0x00, 0x00, 0xa3, 0xb0, 0xe4, 0x0e,
+  0x00, 0x60, 0x14, 0x96, 0x5c, 0x72, 0x07, 0x8c, 0xc2, 0x92, 0xa3, 0x00, 0x80, 0x51, 0x18, 0x23,
+  0x00, 0x00, 0x30, 0x0a, 0x63, 0x05, 0x00, 0x00, 0x46, 0x61, 0x2c, 0x0d, 0x00, 0xc0, 0x28, 0x8c,
+  0xbd, 0x96, 0x1c, 0x1d, 0x85, 0xb1, 0xe7, 0x0e, 0x00, 0xa3, 0x30, 0xf6, 0x6e, 0x21, 0x60, 0x14,
+  0xd6, 0x8a, 0x3b, 0x00, 0x8c, 0xc2, 0xe8, 0x93, 0x05, 0x80, 0x51, 0x9a, 0x60, 0x69, 0x00, 0x30,
+  0x4a, 0x13, 0x2c, 0xb9, 0x03, 0x46, 0x69, 0x69, 0x24, 0x77, 0xc0, 0x28, 0x2d, 0x4d, 0x0a, 0x00,
+  0x18, 0xa5, 0x41, 0x2a, 0x0b, 0x01, 0xa3, 0x38, 0x02, 0x00, 0x00, 0x60, 0x14, 0x57, 0x64, 0x70,
+  0x14, 0x8c, 0xe2, 0x8a, 0x4c, 0xee, 0x80, 0x51, 0x5c, 0x12, 0xac, 0x10, 0x30, 0x8a, 0x7b, 0xb2,
+  0x10, 0x00, 0x46, 0x81, 0x05, 0x00, 0x00, 0xc0, 0x28, 0xb0, 0xb8, 0x34, 0x00, 0x18, 0x05, 0x26,
+  0x5b, 0x08, 0x00, 0xa3, 0x40, 0x56, 0xdc, 0x01, 0x60, 0x14, 0x19, 0x48, 0x21, 0x00, 0x8c, 0x22,
+  0xcb, 0x48, 0x81, 0x81, 0x51, 0x64, 0x21, 0x00, 0x00, 0x30, 0x8a, 0x2c, 0x2e, 0x0d, 0x00, 0x46,
+  0x91, 0x45, 0x16, 0x02, 0xc0, 0x28, 0x32, 0x11, 0x00, 0x00, 0x18, 0x45, 0x26, 0x77, 0x00, 0x00,
+  0xa3, 0xc8, 0xe4, 0xd2, 0xab, 0x73, 0x14, 0xd9, 0x5e, 0x0b, 0x0c, 0x8c, 0x22, 0x1b, 0x4c, 0x03,
+  0x80, 0x51, 0xe6, 0x48, 0x03, 0x00, 0x30, 0xca, 0x44, 0xc9, 0x1d, 0x00, 0x46, 0x99, 0x88, 0x02,
+  0x00, 0xc0, 0x28, 0x33, 0x39, 0x02, 0x00, 0x18, 0x65, 0x3e, 0x19, 0x64, 0x21, 0xa3, 0x4c, 0x88,
+  0x0a, 0x01, 0x60, 0x94, 0x09, 0x1f, 0x2d, 0x04, 0x8c, 0x32, 0xe1, 0xab, 0x0c, 0x80, 0x51, 0x26,
+  0x05, 0x00, 0x00, 0x30, 0xca, 0xa4, 0x81, 0x26, 0x77, 0x46, 0x99, 0xb4, 0x00, 0x00, 0xc0, 0x28,
+  0x93, 0x16, 0x02, 0x00, 0x18, 0x65, 0xd2, 0xe2, 0x00, 0x00, 0xa3, 0x4c, 0x5a, 0xdc, 0x01, 0x60,
+  0x94, 0x49, 0x8b, 0x2c, 0x04, 0x8c, 0x32, 0x69, 0x91, 0xaf, 0xce, 0x51, 0x26, 0x45, 0x00, 0x00,
+  0x30, 0xca, 0xa4, 0xa8, 0x10, 0x00, 0x46, 0x99, 0x14, 0x95, 0x09, 0xc0, 0x28, 0x93, 0x22, 0x53,
+  0x27, 0x18, 0x65, 0xd2, 0x44, 0x00, 0x00, 0xa3, 0x4c, 0x9a, 0x58, 0x21, 0x60, 0x94, 0x49, 0x93,
+  0x03, 0x00, 0x8c, 0x32, 0x69, 0x72, 0x07, 0x80, 0x51, 0x26, 0x4d, 0x13, 0x01, 0x30, 0xca, 0xa4,
+  0x69, 0x26, 0x77, 0x46, 0x99, 0x34, 0x4d, 0x5a, 0xc0, 0x28, 0x93, 0xca, 0xf4, 0xea, 0x1c, 0x65,
+  0x52, 0x9a, 0x06, 0x00, 0xa3, 0x4c, 0x9a, 0x01, 0x00, 0x60, 0x14, 0x5b, 0x08, 0x00, 0x00, 0x8c,
+  0x62, 0x8b, 0x4c, 0x8e, 0x82, 0x81, 0x82, 0x60, 0x69, 0x00, 0x30, 0x50, 0x18, 0xc1, 0x01, 0x00,
+  0x06, 0x0a, 0x23, 0xc8, 0x57, 0xe7, 0x40, 0x61, 0x14, 0x02, 0x00, 0x18, 0x28, 0x8c, 0xe2, 0x0e,
+  0x00, 0x03, 0x85, 0x51, 0x1c, 0x4d, 0x63, 0xa0, 0x30, 0x8a, 0x4c, 0xee, 0x0c, 0x14, 0x46, 0x91,
+  0xaf, 0xce, 0x81, 0xc2, 0x40, 0x00, 0x00, 0x30, 0x50, 0x18, 0xa8, 0x10, 0x00, 0x06, 0x0a, 0x03,
+  0x25, 0x9a, 0xc6, 0x40, 0x61, 0x20, 0x56, 0x08, 0x18, 0x28, 0x0c, 0x44, 0xd3, 0x00, 0x03, 0x85,
+  0x91, 0x46, 0x60, 0x60, 0xa0, 0x30, 0x92, 0x03, 0x00, 0x0c, 0x14, 0x46, 0x72, 0x07, 0x80, 0x81,
+  0xc2, 0x78, 0x32, 0xb9, 0x33, 0x50, 0x18, 0xaf, 0x32, 0x00, 0x06, 0x0a, 0x83, 0x26, 0x57, 0xc8,
+  0x40, 0x61, 0x54, 0x06, 0x00, 0x18, 0x28, 0x8c, 0x2a, 0x0b, 0x01, 0x03, 0x85, 0x91, 0x01, 0x00,
+  0x60, 0xa0, 0x40, 0x00, 0x00, 0x00, 0x0c, 0x14, 0x48, 0x72, 0x00, 0x80, 0x81, 0x02, 0x99, 0x81,
+  0x16, 0x32, 0x50, 0x30, 0x55, 0x16, 0x02, 0x06, 0x0a, 0x27, 0xb0, 0x42, 0xc0, 0x40, 0xe1, 0x14,
+  0x00, 0x00, 0x18, 0x28, 0x9c, 0x42, 0x00, 0x00, 0x03, 0x85, 0x53, 0x1c, 0x00, 0x60, 0xa0, 0x70,
+  0x8a, 0x3b, 0x00, 0x0c, 0x14, 0x4e, 0x91, 0x85, 0x80, 0x81, 0xc2, 0x29, 0x33, 0x30, 0x30, 0x50,
+  0x38, 0x08, 0x00, 0x00, 0x06, 0x0a, 0x07, 0x15, 0x02, 0xc0, 0x40, 0xe1, 0xa0, 0x32, 0x01, 0x18,
+  0x28, 0x1c, 0x64, 0xea, 0x04, 0x03, 0x85, 0x83, 0x92, 0xa3, 0x60, 0xa0, 0x70, 0x10, 0x03, 0x00,
+  0x0c, 0x14, 0x4e, 0x1a, 0x85, 0x80, 0x81, 0xc2, 0x49, 0x8e, 0xa6, 0x31, 0x50, 0x38, 0x69, 0xa6,
+  0x42, 0x06, 0x0a, 0xc7, 0x11, 0x00, 0xc0, 0x40, 0xe1, 0x54, 0x56, 0xdc, 0x19, 0x28, 0x9c, 0xea,
+  0x68, 0x1a, 0x03, 0x85, 0x53, 0x65, 0x72, 0x60, 0xa0, 0x90, 0x02, 0x2b, 0x00, 0x0c, 0x14, 0xd2,
+  0x08, 0x34, 0x8d, 0x81, 0x42, 0x1a, 0xa8, 0xb8, 0x33, 0x50, 0x48, 0xae, 0x10, 0x00, 0x06, 0x0a,
+  0xc9, 0x1d, 0x00, 0xc0, 0x40, 0x21, 0x4d, 0x44, 0xd3, 0x18, 0x28, 0xa4, 0x99, 0x5e, 0x9d, 0x03,
+  0x85, 0x55, 0x00, 0x00, 0x60, 0xa0, 0xb0, 0x0a, 0x01, 0x00, 0x0c, 0x14, 0x56, 0x71, 0x07, 0x80,
+  0x81, 0xc2, 0x2a, 0x8e, 0x02, 0x30, 0x50, 0x58, 0x45, 0xbe, 0x3a, 0x07, 0x0a, 0x0c, 0x00, 0x00,
+  0xc0, 0x40, 0x81, 0x11, 0x00, 0x00, 0x18, 0x28, 0x30, 0xc2, 0x0a, 0x01, 0x03, 0x05, 0x56, 0x00,
+  0x00, 0x60, 0xa0, 0xc0, 0x0a, 0x01, 0x00, 0x0c, 0x14, 0x58, 0x71, 0x00, 0x80, 0x81, 0x02, 0x2b,
+  0xee, 0x00, 0x30, 0x50, 0x60, 0xc5, 0x51, 0x00, 0x06, 0x0a, 0xac, 0xc8, 0x42, 0xc0, 0x40, 0x81,
+  0x15, 0x99, 0x01, 0x18, 0x28, 0xb0, 0x64, 0xea, 0x04, 0x03, 0x05, 0x96, 0x5e, 0x65, 0x60, 0xa0,
+  0xc0, 0xd2, 0x2c, 0x00, 0x0c, 0x14, 0x58, 0x9a, 0xc9, 0x9d, 0x81, 0x02, 0x63, 0x85, 0x00, 0x30,
+  0x50, 0x60, 0xac, 0xcc, 0x39, 0x07, 0x0a, 0x8c, 0xa5, 0x01, 0xc0, 0x40, 0x81, 0xb1, 0xe4, 0x00,
+  0x18, 0x28, 0xb0, 0xd7, 0x0a, 0x01, 0x03, 0x05, 0xf6, 0xdc, 0x01, 0x60, 0xa0, 0xc0, 0x9e, 0xa3,
+  0x05, 0x0c, 0x14, 0xd8, 0x93, 0x81, 0x81, 0x81, 0x02, 0x7b, 0xb2, 0x10, 0x30, 0x50, 0x60, 0x4f,
+  0x26, 0x77, 0x06, 0x0a, 0xec, 0x51, 0x00, 0xc0, 0x40, 0x81, 0xbd, 0x3a, 0x01, 0x18, 0x28, 0xb0,
+  0x2a, 0xd3, 0x00, 0x03, 0x85, 0x06, 0x00, 0x00, 0x60, 0xa0, 0xd0, 0x02, 0x2b, 0x04, 0x0c, 0x14,
+  0x5a, 0x60, 0xc9, 0x81, 0x81, 0x42, 0x0b, 0x0e, 0x00, 0x30, 0x50, 0x68, 0xc1, 0xd1, 0x34, 0x06,
+  0x0a, 0x2d, 0xd0, 0x02, 0xc0, 0x40, 0xa1, 0x05, 0x9a, 0xdc, 0x19, 0x28, 0xb4, 0x02, 0x00, 0x00,
+  0x03, 0x85, 0x56, 0x08, 0x00, 0x60, 0xa0, 0xd0, 0x8a, 0x3b, 0x00, 0x0c, 0x14, 0x5a, 0x22, 0x00,
+  0x80, 0x81, 0x42, 0x4b, 0x0e, 0x00, 0x30, 0x50, 0x68, 0xc9, 0x15, 0x02, 0x06, 0x0a, 0x2d, 0x39,
+  0x0a, 0xc0, 0x40, 0xa1, 0x25, 0x47, 0xd3, 0x18, 0x28, 0xb4, 0x34, 0x0b, 0x01, 0x03, 0x85, 0x96,
+  0x66, 0x72, 0x67, 0xa0, 0xd0, 0x12, 0x2d, 0x04, 0x0c, 0x14, 0x5a, 0xa2, 0x69, 0x80, 0x81, 0x42,
+  0x7b, 0xb5, 0xcc, 0x39, 0x50, 0x68, 0x90, 0x26, 0x77, 0x06, 0x0a, 0x2d, 0x03, 0x00, 0xc0, 0x40,
+  0xc1, 0x8d, 0x40, 0x01, 0x18, 0x28, 0xb8, 0x91, 0x5e, 0x9d, 0x03, 0x05, 0x47, 0x00, 0x00, 0x60,
+  0xa0, 0xe0, 0x48, 0x21, 0x00, 0x0c, 0x14, 0x1c, 0x61, 0x00, 0x80, 0x81, 0x82, 0x23, 0xac, 0x00,
+  0x30, 0x50, 0x70, 0x84, 0x15, 0x02, 0x06, 0x0a, 0x8e, 0xb0, 0x32, 0xe7, 0x40, 0xc1, 0x15, 0x00,
+  0x00, 0x18, 0x28, 0xb8, 0x53, 0x08, 0x00, 0x03, 0x05, 0x77, 0x50, 0x99, 0x60, 0xa0, 0xe0, 0x4e,
+  0x1a, 0x00, 0x0c, 0x14, 0xdc, 0x49, 0xee, 0x80, 0x81, 0x82, 0x3b, 0x8e, 0x16, 0x32, 0x50, 0x70,
+  0x69, 0x00, 0x00, 0x06, 0x0a, 0x2e, 0xb9, 0x03, 0xc0, 0x40, 0xc1, 0x25, 0x47, 0x01, 0x18, 0x28,
+  0xb8, 0xe4, 0x68, 0x21, 0x03, 0x05, 0x97, 0x66, 0x72, 0x74, 0xa0, 0xe0, 0x28, 0x00, 0x00, 0x0c,
+  0x14, 0x1c, 0x0d, 0x14, 0x80, 0x81, 0x82, 0xa3, 0x05, 0x00, 0x30, 0x50, 0x70, 0xb4, 0x10, 0x00,
+  0x06, 0x0a, 0x8e, 0x16, 0x59, 0xc0, 0x40, 0xc1, 0xd1, 0x32, 0x27, 0x18, 0x28, 0x38, 0x9a, 0x02,
+  0x03, 0x03, 0x05, 0x47, 0xd3, 0x00, 0x60, 0xa0, 0xe0, 0x68, 0x1a, 0x81, 0x0d, 0x14, 0x1c, 0x4d,
+  0x8e, 0x80, 0x81, 0x82, 0xa3, 0xc9, 0x1d, 0x30, 0x50, 0x70, 0x34, 0x39, 0x0a, 0x06, 0x0a, 0x8e,
+  0xa6, 0x57, 0xd9, 0x40, 0xc1, 0xd1, 0xf4, 0xea, 0x1c, 0x28, 0x38, 0xca, 0x0a, 0x01, 0x03, 0x05,
+  0x47, 0x59, 0x5a, 0x65, 0xa0, 0xe0, 0xe8, 0xab, 0x73, 0x0e, 0x14, 0x1c, 0x95, 0x81, 0x81, 0x81,
+  0xc2, 0x73, 0xc9, 0x15, 0x32, 0x50, 0x78, 0xb2, 0x10, 0x00, 0x06, 0x0a, 0xb0, 0x10, 0x00, 0xc0,
+  0x40, 0x01, 0x16, 0x07, 0x00, 0x18, 0x28, 0xc0, 0xe2, 0x02, 0x03, 0x03, 0x05, 0x58, 0x64, 0x21,
+  0x60, 0xa0, 0x00, 0x8b, 0x4c, 0x8e, 0x0e, 0x14, 0x60, 0x91, 0xaf, 0x96, 0x81, 0x02, 0x2c, 0x33,
+  0x39, 0x3a, 0x50, 0x80, 0x88, 0x26, 0x47, 0x07, 0x0a, 0x30, 0x0d, 0x00, 0xc0, 0x40, 0x01, 0x26,
+  0x56, 0x08, 0x18, 0x28, 0xc0, 0xe4, 0x92, 0x3b, 0x03, 0x05, 0x98, 0x1c, 0x05, 0x60, 0xa0, 0x00,
+  0xd3, 0x44, 0x05, 0x0c, 0x14, 0xe0, 0x6b, 0x85, 0x80, 0x81, 0x02, 0xa4, 0x85, 0x00, 0x30, 0x50,
+  0x80, 0x34, 0xb9, 0x03, 0x06, 0x0a, 0x30, 0x03, 0x00, 0xc0, 0x40, 0x41, 0x06, 0x02, 0x00, 0x18,
+  0x28, 0xc8, 0xc0, 0xd2, 0x00, 0x03, 0x05, 0x19, 0xdc, 0x01, 0x60, 0xa0, 0x20, 0x83, 0xa3, 0x00,
+  0x0c, 0x14, 0x64, 0x70, 0xb4, 0x90, 0x81, 0x82, 0x0c, 0x8e, 0xa6, 0x31, 0x50, 0x90, 0x41, 0x06,
+  0x06, 0x06, 0x0a, 0x32, 0xc8, 0x42, 0xc0, 0x40, 0x41, 0x06, 0xf9, 0xea, 0x1c, 0x28, 0xc8, 0x40,
+  0x01, 0x00, 0x03, 0x05, 0x19, 0x68, 0x21, 0x60, 0xa0, 0x20, 0x03, 0x4d, 0x03, 0x0c, 0x14, 0x64,
+  0xa0, 0xc9, 0x81, 0x81, 0x82, 0x0c, 0x34, 0xb9, 0x33, 0x50, 0x90, 0x81, 0x66, 0x00, 0x06, 0x0a,
+  0x52, 0xb0, 0x42, 0xc0, 0x40, 0x41, 0x0a, 0x96, 0xdc, 0x19, 0x28, 0x48, 0x21, 0x03, 0x03, 0x03,
+  0x05, 0x29, 0x64, 0x1a, 0x60, 0xa0, 0x20, 0x0b, 0x00, 0x00, 0x0c, 0x14, 0x64, 0x21, 0x00, 0x80,
+  0x81, 0x82, 0x2c, 0xa6, 0x32, 0x30, 0x50, 0x90, 0xc5, 0x01, 0x00, 0x06, 0x0a, 0xb2, 0xb8, 0x03,
+  0xc0, 0x40, 0x41, 0x16, 0x97, 0xdc, 0x19, 0x28, 0xc8, 0xe2, 0x28, 0x00, 0x03, 0x05, 0x59, 0x1c,
+  0x4d, 0x63, 0xa0, 0x20, 0x8b, 0x2c, 0x00, 0x0c, 0x14, 0x64, 0x91, 0x85, 0x80, 0x81, 0x82, 0x2c,
+  0x32, 0x15, 0x30, 0x50, 0x90, 0x45, 0xbe, 0x3a, 0x07, 0x0a, 0xb2, 0x4c, 0x54, 0xc0, 0x40, 0x41,
+  0x96, 0x49, 0x01, 0x18, 0x28, 0xc8, 0x14, 0x28, 0x00, 0x03, 0x05, 0x99, 0x44, 0x72, 0x60, 0xa0,
+  0x20, 0xd3, 0x00, 0x00, 0x0c, 0x14, 0x64, 0x1a, 0x81, 0x81, 0x81, 0x82, 0x4c, 0x04, 0x00, 0x30,
+  0x50, 0x90, 0xc9, 0x54, 0x06, 0x06, 0x0a, 0x32, 0x99, 0x3a, 0xe7, 0x40, 0x41, 0x26, 0x07, 0x00,
+  0x18, 0x28, 0xc8, 0xe4, 0x82, 0x3b, 0x03, 0x05, 0x99, 0x5c, 0x21, 0x60, 0xa0, 0x20, 0x93, 0x3b,
+  0x00, 0x0c, 0x14, 0x64, 0x72, 0x14, 0x80, 0x81, 0x82, 0x4c, 0x8e, 0x16, 0x30, 0x50, 0x90, 0xc9,
+  0xd1, 0x42, 0x06, 0x0a, 0x32, 0x39, 0x9a, 0xc6, 0x40, 0x41, 0xa6, 0x57, 0xe7, 0x1c, 0x28, 0xc8,
+  0x34, 0xcb, 0x9c, 0x03, 0x05, 0x99, 0x66, 0x1a, 0x60, 0xa0, 0x20, 0xd3, 0x4c, 0x0e, 0x0c, 0x14,
+  0x64, 0x9a, 0xc9, 0xd1, 0x81, 0x82, 0x4c, 0x73, 0x02, 0x30, 0x50, 0x90, 0x69, 0x52, 0x00, 0x06,
+  0x0a, 0x32, 0x4d, 0x9a, 0xc6, 0x40, 0x41, 0x26, 0x5a, 0x08, 0x18, 0x28, 0xc8, 0x64, 0x0b, 0x01,
+  0x03, 0x05, 0xc9, 0x02, 0x4b, 0x63, 0xa0, 0x20, 0xd9, 0x29, 0x04, 0x0c, 0x14, 0x24, 0x4b, 0xaf,
+  0xce, 0x81, 0x82, 0x64, 0x69, 0x02, 0x30, 0x50, 0x90, 0x8e, 0x00, 0x00, 0x06, 0x0a, 0xd2, 0x25,
+  0x07, 0xc0, 0x40, 0x41, 0xba, 0xe4, 0x0e, 0x18, 0x28, 0x48, 0x47, 0x93, 0x3b, 0x03, 0x05, 0xf9,
+  0x92, 0x3b, 0x60, 0xa0, 0x20, 0x5f, 0x2b, 0x04, 0x0c, 0x14, 0xe4, 0x6b, 0xc9, 0x9d, 0x81, 0x82,
+  0x7c, 0x0e, 0x00, 0x30, 0x50, 0x90, 0xcf, 0x05, 0x06, 0x06, 0x0a, 0xf2, 0xb9, 0x03, 0xc0, 0x40,
+  0x41, 0x3e, 0x47, 0x0b, 0x19, 0x28, 0xc8, 0x27, 0x03, 0x03, 0x03, 0x05, 0xf9, 0x64, 0x70, 0x67,
+  0xa0, 0x20, 0x9f, 0x7c, 0x75, 0x0e, 0x14, 0xe4, 0x93, 0x14, 0x80, 0x81, 0x82, 0x7c, 0x14, 0x00,
+  0x30, 0x50, 0x90, 0x8f, 0x26, 0x77, 0x06, 0x0a, 0xf2, 0x55, 0x06, 0xc0, 0x40, 0x41, 0xbe, 0xca,
+  0x0a, 0x19, 0x28, 0xc8, 0x57, 0x27, 0x00, 0x03, 0x05, 0xf9, 0xea, 0x9c, 0x60, 0xa0, 0x20, 0xdf,
+  0x05, 0x00, 0x0c, 0x14, 0x24, 0x2c, 0x00, 0x80, 0x81, 0x82, 0x84, 0xb4, 0x10, 0x30, 0x50, 0x90,
+  0x32, 0xbd, 0x3a, 0x07, 0x0a, 0x92, 0x16, 0x02, 0xc0, 0x40, 0x41, 0x52, 0x56, 0x08, 0x18, 0x28,
+  0xcc, 0xc0, 0x0a, 0x01, 0x03, 0x85, 0x19, 0xdc, 0x01, 0x60, 0xa0, 0x30, 0x83, 0xa3, 0x85, 0x0c,
+  0x14, 0x66, 0x90, 0x81, 0x81, 0x81, 0xc2, 0x0c, 0x93, 0x02, 0x30, 0x50, 0x98, 0x81, 0x02, 0x00,
+  0x06, 0x0a, 0x33, 0xd0, 0xe4, 0xce, 0x40, 0x61, 0x16, 0x00, 0x00, 0x18, 0x28, 0xcc, 0x42, 0x00,
+  0x00, 0x03, 0x85, 0x59, 0x1c, 0x00, 0x60, 0xa0, 0x30, 0x8b, 0x2b, 0x04, 0x0c, 0x14, 0x66, 0x71,
+  0x07, 0x80, 0x81, 0xc2, 0x2c, 0x8e, 0x02, 0x30, 0x50, 0x98, 0x45, 0xbe, 0x3a, 0x07, 0x0a, 0xb3,
+  0x4c, 0x04, 0xc0, 0x40, 0x61, 0x96, 0x99, 0x06, 0x18, 0x28, 0x4c, 0x54, 0x00, 0x00, 0x03, 0x85,
+  0x89, 0x0a, 0x01, 0x60, 0xa0, 0x30, 0x51, 0x99, 0x13, 0x0c, 0x14, 0x26, 0x4a, 0x03, 0x80, 0x81,
+  0xc2, 0x44, 0x69, 0x50, 0x30, 0x50, 0x98, 0x88, 0x01, 0x00, 0x06, 0x0a, 0x13, 0xb1, 0x42, 0xc0,
+  0x40, 0x61, 0x22, 0x0a, 0x00, 0x18, 0x28, 0xcc, 0xe4, 0x0e, 0x00, 0x03, 0x85, 0xb9, 0x00, 0x00,
+  0x60, 0xa0, 0x30, 0x5b, 0x32, 0x75, 0x0e, 0x14, 0xe6, 0x6b, 0xa9, 0x90, 0x81, 0xc2, 0x7c, 0x2d,
+  0xb9, 0x33, 0x50, 0x98, 0xaf, 0x65, 0x00, 0x06, 0x0a, 0xf3, 0x39, 0x00, 0xc0, 0x40, 0x61, 0x3e,
+  0x97, 0x06, 0x18, 0x28, 0xcc, 0x27, 0x03, 0x03, 0x03, 0x85, 0xf9, 0x64, 0x1a, 0x60, 0xa0, 0x30,
+  0x9f, 0x4c, 0xab, 0x0c, 0x14, 0xe6, 0xa3, 0x69, 0x80, 0x81, 0xc2, 0x7c, 0x34, 0x39, 0x30, 0x50,
+  0x98, 0xaf, 0x4e, 0x00, 0x06, 0x0a, 0xf3, 0xd5, 0x39, 0xc1, 0x40, 0x61, 0xbe, 0x3a, 0xe7, 0x1c,
+  0x28, 0xcc, 0x77, 0x93, 0x3b, 0x03, 0x85, 0x09, 0x93, 0x3b, 0x60, 0xa0, 0x30, 0x67, 0x21, 0x00,
+  0x0c, 0x14, 0xe6, 0x44, 0x85, 0x80, 0x81, 0xc2, 0x9c, 0xc9, 0xd4, 0x39, 0x50, 0x98, 0x33, 0x39,
+  0x00, 0x06, 0x0a, 0x73, 0x26, 0x77, 0xc0, 0x40, 0x61, 0xce, 0x57, 0x19, 0x18, 0x28, 0xcc, 0x49,
+  0x01, 0x00, 0x03, 0x85, 0x39, 0x69, 0x01, 0x60, 0xa0, 0x30, 0x27, 0x2d, 0x04, 0x0c, 0x14, 0xe6,
+  0xa4, 0x65, 0x82, 0x81, 0xc2, 0x9c, 0x34, 0x39, 0x3a, 0x50, 0x98, 0x93, 0xd2, 0x34, 0x06, 0x0a,
+  0x93, 0x02, 0x00, 0xc0, 0x40, 0x61, 0xd2, 0x02, 0x00, 0x18, 0x28, 0x4c, 0x5a, 0x08, 0x00, 0x03,
+  0x85, 0x49, 0x8b, 0x3b, 0x60, 0xa0, 0x30, 0xa9, 0xa9, 0x13, 0x0c, 0x14, 0x26, 0x4d, 0x81, 0x81,
+  0x81, 0xc2, 0xa4, 0x69, 0x00, 0x30, 0x50, 0x98, 0x34, 0x8d, 0xc0, 0x06, 0x0a, 0x93, 0xa6, 0x55,
+  0xc0, 0x40, 0x61, 0xd2, 0xe4, 0x0e, 0x18, 0x28, 0x4c, 0x9a, 0x1c, 0x05, 0x03, 0x85, 0x49, 0xd3,
+  0xab, 0x73, 0xa0, 0x30, 0x69, 0xb2, 0x85, 0x0c, 0x14, 0x26, 0x65, 0x85, 0x80, 0x81, 0xc2, 0xa4,
+  0x2c, 0x0d, 0x30, 0x50, 0x98, 0x94, 0x25, 0x02, 0x06, 0x0a, 0x93, 0xbe, 0xe0, 0xe8, 0x40, 0x61,
+  0xd2, 0x57, 0x19, 0x18, 0x28, 0x4c, 0x9a, 0x01, 0x00, 0x03, 0x05, 0x0a, 0x00, 0x00, 0x60, 0xa0,
+  0x40, 0x83, 0x60, 0x05, 0x0c, 0x14, 0x68, 0x20, 0x00, 0x80, 0x81, 0x02, 0x0d, 0x0e, 0x00, 0x30,
+  0x50, 0xa0, 0x05, 0x00, 0x00, 0x06, 0x0a, 0xb4, 0x10, 0x00, 0xc0, 0x40, 0x81, 0x16, 0x53, 0x19,
+  0x18, 0x28, 0xd0, 0xe2, 0x00, 0x00, 0x03, 0x05, 0x5a, 0x5c, 0x60, 0x60, 0xa0, 0x40, 0x8b, 0x3b,
+  0x00, 0x0c, 0x14, 0x68, 0x71, 0x14, 0x80, 0x81, 0x02, 0x2d, 0x8e, 0x16, 0x30, 0x50, 0xa0, 0xc5,
+  0xd1, 0x42, 0x06, 0x0a, 0xb4, 0xc8, 0x42, 0xc0, 0x40, 0x81, 0x16, 0x99, 0x1c, 0x1d, 0x28, 0xd0,
+  0x22, 0x5f, 0x9d, 0x03, 0x05, 0x5a, 0x26, 0x2a, 0x60, 0xa0, 0x40, 0xcb, 0x4c, 0xee, 0x0c, 0x14,
+  0x68, 0x99, 0x14, 0x80, 0x81, 0x02, 0x35, 0x95, 0x01, 0x30, 0x50, 0xa0, 0xa6, 0xce, 0x09, 0x06,
+  0x0a, 0x14, 0x01, 0x00, 0xc0, 0x40, 0x81, 0xa2, 0x02, 0x00, 0x18, 0x28, 0x50, 0x54, 0x08, 0x00,
+  0x03, 0x05, 0x8a, 0xd2, 0x00, 0x60, 0xa0, 0x40, 0x51, 0x1a, 0x81, 0x0d, 0x14, 0x28, 0x4a, 0x05,
+  0x80, 0x81, 0x02, 0x45, 0xc9, 0x1d, 0x30, 0x50, 0xa0, 0x88, 0x02, 0x00, 0x06, 0x0a, 0x14, 0xd1,
+  0x42, 0xc0, 0x40, 0x81, 0xa6, 0x40, 0x01, 0x18, 0x28, 0xd0, 0x34, 0x00, 0x00, 0x03, 0x05, 0x9a,
+  0x46, 0x60, 0x60, 0xa0, 0x40, 0xd3, 0x28, 0x04, 0x0c, 0x14, 0x68, 0x22, 0x00, 0x80, 0x81, 0x02,
+  0x4d, 0xa6, 0x4e, 0x30, 0x50, 0xa0, 0x89, 0x15, 0x02, 0x06, 0x0a, 0x34, 0x39, 0x00, 0xc0, 0x40,
+  0x81, 0x26, 0x17, 0x18, 0x18, 0x28, 0xd0, 0xe4, 0x0e, 0x00, 0x03, 0x05, 0x9a, 0x5c, 0x72, 0x67,
+  0xa0, 0x40, 0x93, 0xa3, 0x00, 0x0c, 0x14, 0x68, 0x72, 0xb4, 0x90, 0x81, 0x02, 0x4d, 0x8e, 0xa6,
+  0x31, 0x50, 0xa0, 0xe9, 0xb9, 0x03, 0x06, 0x0a, 0x34, 0xbd, 0xca, 0xc0, 0x40, 0x81, 0xa6, 0x57,
+  0x27, 0x18, 0x28, 0xd0, 0x34, 0x0b, 0x01, 0x03, 0x05, 0x9a, 0x66, 0x72, 0x74, 0xa0, 0x40, 0xd3,
+  0xa4, 0x00, 0x0c, 0x14, 0x68, 0x9a, 0xb4, 0x80, 0x81, 0x02, 0x4d, 0x34, 0x0d, 0x30, 0x50, 0xa0,
+  0x89, 0x26, 0x77, 0x06, 0x0a, 0x34, 0xd9, 0x42, 0xc0, 0x40, 0x81, 0xb2, 0x42, 0x00, 0x18, 0x28,
+  0x50, 0x96, 0x1c, 0x00, 0x03, 0x05, 0xfa, 0x5a, 0x21, 0x60, 0xa0, 0x40, 0x9f, 0x2c, 0x04, 0x0c,
+  0x14, 0xe8, 0x93, 0xa9, 0x90, 0x81, 0x02, 0x7d, 0x75, 0x4e, 0x30, 0x50, 0xa0, 0xb2, 0x10, 0x00,
+  0x06, 0x0a, 0x94, 0x16, 0x02, 0xc0, 0x40, 0x81, 0x56, 0x59, 0x00, 0x18, 0x28, 0xd0, 0x2a, 0x0b,
+  0x01, 0x03, 0x05, 0x5a, 0xe5, 0xab, 0x73, 0xa0, 0x40, 0x33, 0x00, 0x00, 0x0c, 0x14, 0xea, 0x2c,
+  0x04, 0x80, 0x81, 0x82, 0x2d, 0x00, 0x00, 0x30, 0x50, 0xb0, 0x85, 0x00, 0x00, 0x06, 0x0a, 0xb6,
+  0x90, 0x14, 0xd8, 0x40, 0xc1, 0x16, 0x07, 0x00, 0x18, 0x28, 0xd8, 0xe2, 0x0e, 0x00, 0x03, 0x05,
+  0x5b, 0x1c, 0x05, 0x60, 0xa0, 0x60, 0x8b, 0x7c, 0x75, 0x0e, 0x14, 0x6c, 0x99, 0x08, 0x80, 0x81,
+  0x82, 0x4d, 0x2e, 0x30, 0x30, 0x50, 0xb0, 0xc9, 0x1d, 0x00, 0x06, 0x0a, 0x36, 0x39, 0x0a, 0xc0,
+  0x40, 0xc1, 0xa6, 0x57, 0x27, 0x18, 0x28, 0xd8, 0x27, 0xd3, 0x00, 0x03, 0x05, 0xfb, 0xea, 0x9c,
+  0x60, 0xa0, 0x80, 0x8b, 0x3b, 0x00, 0x0c, 0x14, 0x70, 0x1a, 0x00, 0x80, 0x81, 0x02, 0x4e, 0x0e,
+  0x00, 0x30, 0x50, 0xc0, 0x89, 0xa6, 0x01, 0x06, 0x0a, 0x19, 0x00, 0x00, 0xc0, 0x40, 0x41, 0x27,
+  0x07, 0x00, 0x18, 0x28, 0x68, 0x56, 0x08, 0x00, 0x03, 0x05, 0xcd, 0x92, 0xa3, 0x60, 0xa0, 0x02,
+  0x00, 0x00, 0x00, 0x0c, 0x54, 0xc2, 0x48, 0xee, 0x80, 0x81, 0x4a, 0x60, 0x85, 0x00, 0x30, 0x50,
+  0x09, 0xed, 0xb9, 0x03, 0x06, 0x2a, 0xc1, 0x11, 0x00, 0xc0, 0x40, 0x25, 0x38, 0x5a, 0x08, 0x18,
+  0xa8, 0x04, 0x47, 0xd3, 0x00, 0x03, 0x95, 0x20, 0x0b, 0x01, 0x60, 0xa0, 0x12, 0x64, 0x79, 0x75,
+  0x0e, 0x54, 0x82, 0x4c, 0x23, 0xb0, 0x81, 0x4a, 0xa0, 0x00, 0x00, 0x30, 0x50, 0x19, 0xc5, 0x01,
+  0x00, 0x06, 0x2a, 0x04, 0x00, 0x00, 0xc0, 0x40, 0x85, 0x14, 0x07, 0x00, 0x18, 0xa8, 0x90, 0xe4,
+  0x68, 0x01, 0x03, 0x15, 0x32, 0x69, 0x1a, 0x60, 0xa0, 0x52, 0x08, 0x00, 0x00, 0x0c, 0x54, 0x0a,
+  0x4b, 0x23, 0xb0, 0x81, 0x4a, 0x71, 0x04, 0x00, 0x30, 0x50, 0x29, 0x32, 0xb9, 0x03, 0x06, 0x2a,
+  0xc6, 0x98, 0x3a, 0xc1, 0x40, 0x25, 0x39, 0x9a, 0xdc, 0x19, 0xa8, 0x30, 0x02, 0x00, 0x00, 0x03,
+  0x15, 0x56, 0x00, 0x00, 0x60, 0xa0, 0xc2, 0x0a, 0x01, 0x00, 0x0c, 0x54, 0x58, 0x71, 0x05, 0x80,
+  0x81, 0x0a, 0x2b, 0xee, 0x00, 0x30, 0x50, 0x61, 0xc5, 0xd1, 0x42, 0x06, 0x2a, 0xac, 0xc8, 0x42,
+  0xc0, 0x40, 0x85, 0xa5, 0x01, 0x00, 0x18, 0xa8, 0xb0, 0x44, 0x00, 0x00, 0x03, 0x15, 0x96, 0x1c,
+  0x05, 0x60, 0xa0, 0xc2, 0x18, 0x00, 0x00, 0x0c, 0x54, 0xd8, 0x6b, 0x00, 0x80, 0x81, 0x0a, 0x7b,
+  0x2d, 0xb9, 0x33, 0x50, 0x61, 0xcf, 0x1d, 0x00, 0x06, 0x2a, 0xec, 0xd9, 0x02, 0xc0, 0x40, 0x85,
+  0xd1, 0xe4, 0x0e, 0x18, 0xa8, 0x38, 0x02, 0x00, 0x00, 0x03, 0x15, 0x47, 0x0a, 0x01, 0x60, 0xa0,
+  0xe2, 0x08, 0x2b, 0x00, 0x0c, 0x54, 0x1c, 0x61, 0x85, 0x80, 0x81, 0x8a, 0x23, 0xac, 0xb8, 0x33,
+  0x50, 0x71, 0xe4, 0x16, 0x02, 0x06, 0x2a, 0xee, 0x14, 0x02, 0xc0, 0x40, 0xc5, 0x1d, 0x54, 0x00,
+  0x18, 0xa8, 0xb8, 0x93, 0x5e, 0x9d, 0x03, 0x15, 0x97, 0xdc, 0x01, 0x60, 0xa0, 0xe2, 0xd2, 0x93,
+  0x85, 0x0c, 0x54, 0x5c, 0x9a, 0xc9, 0x9d, 0x81, 0x8a, 0xa3, 0x05, 0x00, 0x30, 0x50, 0x71, 0xb4,
+  0x10, 0x00, 0x06, 0x2a, 0x8e, 0xa6, 0x01, 0xc0, 0x40, 0xc5, 0xd1, 0x34, 0x02, 0x1b, 0xa8, 0x38,
+  0x9a, 0x1c, 0x00, 0x03, 0x15, 0x47, 0x93, 0x3b, 0x60, 0xa0, 0xe2, 0x68, 0x7a, 0x75, 0x0e, 0x54,
+  0x1c, 0x65, 0x85, 0x80, 0x81, 0x8a, 0xa3, 0x2c, 0x15, 0x32, 0x50, 0x71, 0x94, 0x25, 0x47, 0x07,
+  0x2a, 0x8e, 0x66, 0x00, 0xc0, 0x40, 0x05, 0x16, 0x02, 0x00, 0x18, 0xa8, 0xc0, 0x32, 0x51, 0x21,
+  0x03, 0x15, 0x98, 0x46, 0x70, 0x67, 0xa0, 0x02, 0xd3, 0x01, 0x00, 0x0c, 0x54, 0x60, 0x72, 0x07,
+  0x80, 0x81, 0x0a, 0x4c, 0x33, 0x39, 0x30, 0x50, 0x81, 0xaf, 0x25, 0x77, 0x06, 0x2a, 0x90, 0xa6,
+  0x01, 0xc0, 0x40, 0x45, 0x06, 0x06, 0x00, 0x18, 0xa8, 0xc8, 0xe0, 0x00, 0x00, 0x03, 0x15, 0x59,
+  0x08, 0x00, 0x60, 0xa0, 0x22, 0x8b, 0xa9, 0x73, 0x0e, 0x54, 0x64, 0x71, 0x00, 0x80, 0x81, 0x8a,
+  0x2c, 0xee, 0x00, 0x30, 0x50, 0x91, 0xc5, 0xd1, 0x42, 0x06, 0x2a, 0xb2, 0xc8, 0x02, 0xc0, 0x40,
+  0x45, 0x96, 0x19, 0xeb, 0x1c, 0xa8, 0xc8, 0x34, 0x0a, 0x01, 0x03, 0x15, 0x99, 0x08, 0x00, 0x60,
+  0xa0, 0x22, 0x93, 0x3b, 0x00, 0x0c, 0x54, 0x64, 0x72, 0x14, 0x80, 0x81, 0x8a, 0x4c, 0x8e, 0xa6,
+  0x31, 0x50, 0x91, 0xe9, 0xb9, 0x03, 0x06, 0x2a, 0x32, 0x4d, 0x5a, 0xc8, 0x40, 0x45, 0xba, 0x34,
+  0x00, 0x18, 0xa8, 0xc8, 0xe7, 0x92, 0x3b, 0x03, 0x15, 0xf9, 0x68, 0x72, 0x67, 0xa0, 0x22, 0x6b,
+  0x1a, 0x00, 0x0c, 0x54, 0x66, 0x10, 0xac, 0x90, 0x81, 0xca, 0x44, 0x85, 0x00, 0x30, 0x50, 0x99,
+  0x28, 0xbd, 0xca, 0x06, 0x2a, 0xf3, 0xb9, 0x42, 0xc0, 0x40, 0x65, 0xbe, 0xca, 0x00, 0x18, 0xa8,
+  0xcc, 0x49, 0x0b, 0x01, 0x03, 0x15, 0x5a, 0xdc, 0x01, 0x60, 0xa0, 0x14, 0x5c, 0x01, 0x00, 0x0c,
+  0x94, 0x82, 0x4b, 0x81, 0x81, 0x81, 0x52, 0x90, 0x81, 0x01, 0x30, 0x50, 0x1a, 0xa8, 0x10, 0x00,
+  0x06, 0x4a, 0x24, 0xc8, 0x64, 0xcb, 0x40, 0x89, 0x24, 0x77, 0x00, 0x18, 0x28, 0x11, 0x96, 0x5e,
+  0x2d, 0x03, 0x25, 0x32, 0x69, 0x72, 0x74, 0xa0, 0x54, 0x08, 0x00, 0x00, 0x0c, 0x94, 0x4a, 0x72,
+  0x00, 0x80, 0x81, 0x52, 0x71, 0x04, 0x00, 0x30, 0x50, 0x2a, 0x8e, 0x24, 0x77, 0x06, 0x4a, 0xc5,
+  0x1d, 0x00, 0xc0, 0x40, 0xa9, 0x38, 0x5a, 0x08, 0x18, 0x28, 0x15, 0x47, 0x93, 0x3b, 0x03, 0xa5,
+  0x53, 0x08, 0x00, 0x60, 0xa0, 0x74, 0xca, 0x01, 0x00, 0x0c, 0x94, 0x4e, 0x71, 0x07, 0x80, 0x81,
+  0xd2, 0x29, 0xb2, 0x10, 0x30, 0x50, 0x3a, 0x45, 0xbe, 0x3a, 0x07, 0x4a, 0x07, 0x01, 0x00, 0xc0,
+  0x40, 0xe9, 0xa0, 0x42, 0x00, 0x18, 0x28, 0x1d, 0xc4, 0x0a, 0x01, 0x03, 0xa5, 0x93, 0x1c, 0x4d,
+  0x63, 0xa0, 0x74, 0xd2, 0x73, 0x14, 0x0c, 0x94, 0x8e, 0xa3, 0x69, 0x80, 0x81, 0x12, 0x23, 0x00,
+  0x00, 0x30, 0x50, 0x62, 0x84, 0x15, 0x02, 0x06, 0x4a, 0xac, 0x00, 0x00, 0xc0, 0x40, 0x89, 0x15,
+  0x02, 0x00, 0x18, 0x28, 0xb1, 0xe2, 0x0e, 0x00, 0x03, 0x25, 0x56, 0x1c, 0x05, 0x60, 0xa0, 0xc4,
+  0x8a, 0xa3, 0x85, 0x0c, 0x94, 0x58, 0x1a, 0x00, 0x80, 0x81, 0x12, 0x4b, 0x2e, 0x30, 0x30, 0x50,
+  0x62, 0x2c, 0xb9, 0x03, 0x06, 0x4a, 0x8c, 0x25, 0x47, 0xcb, 0x40, 0x89, 0x3d, 0x77, 0x00, 0x18,
+  0x28, 0xb1, 0xe7, 0x68, 0x21, 0x03, 0x25, 0xf6, 0x1c, 0x4d, 0x63, 0xa0, 0xc4, 0x9e, 0x2c, 0x04,
+  0x0c, 0x94, 0xd8, 0x93, 0xaf, 0xce, 0x81, 0x12, 0xab, 0xb2, 0x10, 0x30, 0x50, 0x62, 0x19, 0x00,
+  0x00, 0x06, 0x4a, 0x0d, 0x00, 0x00, 0xc0, 0x40, 0xa9, 0x85, 0x51, 0x08, 0x18, 0x28, 0xb5, 0x40,
+  0x00, 0x00, 0x03, 0xa5, 0x16, 0x18, 0x00, 0x60, 0xa0, 0xd4, 0x02, 0x2b, 0x04, 0x0c, 0x94, 0x5a,
+  0x70, 0x00, 0x80, 0x81, 0x52, 0x0b, 0x14, 0x00, 0x30, 0x50, 0x6a, 0x81, 0x16, 0x02, 0x06, 0x4a,
+  0x2d, 0xd0, 0xe4, 0xce, 0x40, 0xa9, 0x05, 0x9a, 0x1c, 0x1d, 0x28, 0x35, 0xc1, 0x32, 0x00, 0x03,
+  0xa5, 0x56, 0x08, 0x00, 0x60, 0xa0, 0xd4, 0x8a, 0x3b, 0x00, 0x0c, 0x94, 0x5a, 0x91, 0x69, 0x80,
+  0x81, 0x52, 0x4b, 0x04, 0x00, 0x30, 0x50, 0x6a, 0x89, 0x24, 0x77, 0x06, 0x4a, 0x2d, 0xb9, 0x03,
+  0xc0, 0x40, 0xa9, 0x25, 0x47, 0x01, 0x18, 0x28, 0xb5, 0x64, 0x0b, 0x01, 0x03, 0xa5, 0xf6, 0x64,
+  0x1a, 0x60, 0xa0, 0xd4, 0x1e, 0x4d, 0xee, 0x0c, 0x94, 0x1a, 0xa4, 0xc9, 0x9d, 0x81, 0x52, 0xab,
+  0x69, 0x50, 0x30, 0x50, 0x72, 0x81, 0x00, 0x00, 0x06, 0x4a, 0x2e, 0xb0, 0x0c, 0xc0, 0x40, 0xc9,
+  0x05, 0x77, 0x00, 0x18, 0x28, 0xb9, 0x91, 0x06, 0x00, 0x03, 0x25, 0x37, 0x92, 0xa3, 0x60, 0xa0,
+  0xe4, 0x06, 0x4d, 0x0e, 0x0c, 0x94, 0x1c, 0x01, 0x00, 0x80, 0x81, 0x92, 0x23, 0x85, 0x00, 0x30,
+  0x50, 0x72, 0x24, 0xb9, 0x03, 0x06, 0x4a, 0x8e, 0xb0, 0x02, 0xc0, 0x40, 0xc9, 0x11, 0x56, 0x08,
+  0x18, 0x28, 0xb9, 0x42, 0x00, 0x00, 0x03, 0x25, 0x77, 0x0a, 0x00, 0x60, 0xa0, 0xe4, 0x4e, 0x21,
+  0x00, 0x0c, 0x94, 0xdc, 0x41, 0x81, 0x95, 0x81, 0x92, 0x3b, 0xa8, 0x10, 0x30, 0x50, 0x72, 0xa7,
+  0xbe, 0x3a, 0x07, 0x4a, 0xee, 0xd4, 0x09, 0xc0, 0x40, 0xc9, 0x9d, 0x3a, 0x27, 0x18, 0x28, 0xb9,
+  0x53, 0xe7, 0x9c, 0x03, 0x25, 0x97, 0x06, 0x00, 0x60, 0xa0, 0xe4, 0xd2, 0x08, 0x0c, 0x0c, 0x94,
+  0x5c, 0x22, 0x00, 0x80, 0x81, 0x92, 0x4b, 0xa6, 0xce, 0x39, 0x50, 0x72, 0xc9, 0x1d, 0x00, 0x06,
+  0x4a, 0x2e, 0x39, 0x0a, 0xc0, 0x40, 0xc9, 0x25, 0x47, 0x0b, 0x18, 0x28, 0xb9, 0xe4, 0x68, 0x21,
+  0x03, 0x25, 0x97, 0x1c, 0x4d, 0x63, 0xa0, 0xe4, 0xd2, 0x93, 0x85, 0x0c, 0x94, 0x5c, 0x9a, 0xb1,
+  0xce, 0x81, 0x92, 0x5b, 0x00, 0x00, 0x30, 0x50, 0x72, 0xcf, 0x1d, 0x00, 0x06, 0x4a, 0x2e, 0xd6,
+  0x39, 0xc1, 0x40, 0xc9, 0x51, 0x00, 0x00, 0x18, 0x28, 0x39, 0x1a, 0xdc, 0x01, 0x03, 0x25, 0x47,
+  0x0b, 0x00, 0x60, 0xa0, 0xe4, 0x68, 0x21, 0x00, 0x0c, 0x94, 0x1c, 0x2d, 0xee, 0x80, 0x81, 0x92,
+  0xa3, 0x69, 0x00, 0x30, 0x50, 0x72, 0x34, 0xad, 0x42, 0x06, 0x4a, 0x8e, 0x26, 0x07, 0xc0, 0x40,
+  0xc9, 0xd1, 0xe4, 0x0a, 0x19, 0x28, 0x39, 0x9a, 0xdc, 0x01, 0x03, 0x25, 0x47, 0x93, 0xa3, 0x60,
+  0xa0, 0xe4, 0x68, 0x7a, 0x75, 0x0e, 0x94, 0x1c, 0x4d, 0x14, 0x80, 0x81, 0x92, 0xa3, 0x0c, 0x00,
+  0x30, 0x50, 0x72, 0x94, 0x15, 0x00, 0x06, 0x4a, 0x8e, 0xb2, 0x42, 0xc0, 0x40, 0xc9, 0x51, 0x96,
+  0x1c, 0x1d, 0x28, 0x39, 0x9a, 0x01, 0x00, 0x03, 0x25, 0x97, 0x01, 0x00, 0x60, 0xa0, 0x24, 0x03,
+  0x01, 0x00, 0x0c, 0x94, 0x64, 0x01, 0x00, 0x80, 0x81, 0x92, 0x2c, 0x04, 0x00, 0x30, 0x50, 0x92,
+  0xc5, 0x1d, 0x00, 0x06, 0x4a, 0xb2, 0xc8, 0x14, 0xd8, 0x40, 0x49, 0x96, 0x49, 0x01, 0x18, 0x28,
+  0xc9, 0x34, 0x00, 0x00, 0x03, 0x25, 0x99, 0x1c, 0x00, 0x60, 0xa0, 0x24, 0x93, 0x3b, 0x00, 0x0c,
+  0x94, 0x64, 0x9a, 0x85, 0x80, 0x81, 0x92, 0x64, 0x69, 0x00, 0x30, 0x50, 0x92, 0xaf, 0x15, 0x02,
+  0x06, 0x4a, 0xf2, 0xcd, 0xe4, 0xce, 0x40, 0x69, 0x02, 0x00, 0x00, 0x18, 0x28, 0xcd, 0xc0, 0x0a,
+  0x01, 0x03, 0xa5, 0x19, 0xdc, 0x01, 0x60, 0xa0, 0x34, 0x83, 0xa3, 0x00, 0x0c, 0x94, 0x66, 0xa0,
+  0x85, 0x80, 0x81, 0xd2, 0x2c, 0x0e, 0x00, 0x30, 0x50, 0x9a, 0xc5, 0x05, 0x06, 0x06, 0x4a, 0xb3,
+  0x38, 0x5a, 0xc0, 0x40, 0x69, 0xa2, 0x02, 0x00, 0x18, 0x28, 0x4d, 0x54, 0x08, 0x00, 0x03, 0xa5,
+  0x89, 0x4c, 0x65, 0x60, 0xa0, 0x34, 0x51, 0x0a, 0x0c, 0x0c, 0x94, 0x26, 0x4a, 0x03, 0x80, 0x81,
+  0xd2, 0x44, 0xac, 0x10, 0x30, 0x50, 0x9a, 0x0b, 0x00, 0x00, 0x06, 0x4a, 0xf3, 0xb9, 0x42, 0xc0,
+  0x40, 0x69, 0x3e, 0x59, 0x08, 0x18, 0x28, 0xcd, 0x27, 0x93, 0x03, 0x03, 0xa5, 0xf9, 0x64, 0x72,
+  0x74, 0xa0, 0x34, 0xdf, 0x8c, 0x75, 0x0e, 0x94, 0xe6, 0xa3, 0x00, 0x80, 0x81, 0xd2, 0x84, 0xc9,
+  0x1d, 0x30, 0x50, 0x9a, 0xb3, 0x10, 0x00, 0x06, 0x4a, 0x73, 0xa6, 0xe0, 0xce, 0x40, 0x69, 0xce,
+  0xe4, 0x0e, 0x18, 0x28, 0xcd, 0x99, 0x1c, 0x05, 0x03, 0xa5, 0x39, 0x67, 0x0a, 0x6c, 0xa0, 0x34,
+  0x27, 0x2d, 0x04, 0x0c, 0x94, 0x26, 0x05, 0x00, 0x80, 0x81, 0xd2, 0xa4, 0x05, 0x00, 0x30, 0x50,
+  0x9a, 0xb4, 0x10, 0x00, 0x06, 0x4a, 0x93, 0x16, 0x59, 0xc8, 0x40, 0x69, 0xd2, 0x34, 0x00, 0x18,
+  0x28, 0x4d, 0x9a, 0x46, 0x60, 0x03, 0xa5, 0x49, 0x53, 0x99, 0x60, 0xa0, 0x34, 0x69, 0x72, 0x00,
+  0x0c, 0x94, 0x26, 0x4d, 0xee, 0x80, 0x81, 0xd2, 0xa4, 0xc9, 0x51, 0x30, 0x50, 0x9a, 0x34, 0xbd,
+  0x67, 0x06, 0x4a, 0x93, 0xb2, 0x02, 0xc0, 0x40, 0x89, 0x02, 0x00, 0x00, 0x18, 0x28, 0xd1, 0x20,
+  0x0b, 0x00, 0x03, 0x25, 0x1a, 0x64, 0x21, 0x60, 0xa0, 0x44, 0x0b, 0x00, 0x00, 0x0c, 0x94, 0x68,
+  0x71, 0x07, 0x80, 0x81, 0x12, 0x2d, 0x8e, 0x02, 0x30, 0x50, 0xa2, 0x45, 0x16, 0x02, 0x06, 0x4a,
+  0x14, 0x15, 0x02, 0xc0, 0x40, 0x89, 0x26, 0x02, 0x00, 0x18, 0x28, 0xd1, 0xe4, 0x0e, 0x00, 0x03,
+  0x25, 0x9a, 0x1c, 0x2d, 0x64, 0xa0, 0x44, 0xd3, 0x44, 0x85, 0x0c, 0x94, 0x68, 0x9a, 0x34, 0x8d,
+  0x81, 0x12, 0xad, 0xb2, 0x10, 0x30, 0x50, 0xa2, 0x55, 0xbe, 0xca, 0x06, 0x4a, 0xb6, 0xb8, 0x03,
+  0xc0, 0x40, 0xc9, 0x16, 0x19, 0xdc, 0x19, 0x28, 0xe9, 0x34, 0x11, 0x00, 0x03, 0xbd, 0xe0, 0x08,
+  0x00, 0x60, 0xa0, 0x37, 0x0a, 0x01, 0x00, 0x0c, 0xf4, 0x08, 0x00, 0x00, 0x80, 0x81, 0x1e, 0x29,
+  0x04, 0x00, 0x30, 0xd0, 0x23, 0xc5, 0x01, 0x00, 0x06, 0x7a, 0x84, 0x15, 0x02, 0xc0, 0x40, 0x8f,
+  0xb0, 0xe7, 0x0e, 0x18, 0xe8, 0x25, 0x07, 0x00, 0x00, 0x03, 0xbd, 0xe4, 0x06, 0x00, 0x60, 0xa0,
+  0x97, 0x9e, 0x3b, 0x00, 0x0c, 0xf4, 0x56, 0x71, 0x07, 0x80, 0x81, 0x1e, 0x2b, 0xee, 0x00, 0x30,
+  0xd0, 0x63, 0x4f, 0x96, 0x09, 0x06, 0x7a, 0x8c, 0x26, 0x47, 0xc1, 0x40, 0xcf, 0x91, 0x42, 0x00,
+  0x18, 0xe8, 0x39, 0x0a, 0x00, 0x00, 0x03, 0x3d, 0x47, 0x93, 0x3b, 0x60, 0xa0, 0xe7, 0x68, 0xb2,
+  0x85, 0x0c, 0xf4, 0x5c, 0x06, 0x00, 0x80, 0x81, 0x1e, 0x4c, 0x8e, 0x02, 0x30, 0xd0, 0x93, 0x81,
+  0x00, 0x00, 0x06, 0x7a, 0x32, 0xb8, 0x03, 0xc0, 0x40, 0x4f, 0x16, 0x00, 0x00, 0x18, 0xe8, 0xc9,
+  0x42, 0x00, 0x00, 0x03, 0x3d, 0x59, 0x08, 0x2b, 0x64, 0xa0, 0x27, 0x8b, 0x3b, 0x00, 0x0c, 0xf4,
+  0x64, 0x71, 0xb4, 0x90, 0x81, 0x9e, 0x2c, 0x33, 0x0d, 0x30, 0xd0, 0x93, 0xc9, 0x1d, 0x00, 0x06,
+  0x7a, 0x32, 0x39, 0x0a, 0xc0, 0x40, 0x4f, 0xa6, 0x89, 0x0a, 0x19, 0xe8, 0x49, 0x06, 0x00, 0x00,
+  0x03, 0x3d, 0xc9, 0x0a, 0x01, 0x60, 0xa0, 0x27, 0x1d, 0x4d, 0x8e, 0x0e, 0xf4, 0xe4, 0x93, 0xc9,
+  0x9d, 0x81, 0x9e, 0x7c, 0x95, 0x01, 0x30, 0xd0, 0x93, 0xaf, 0x4e, 0x00, 0x06, 0x7a, 0x92, 0xa6,
+  0x01, 0xc0, 0x40, 0x6f, 0xa2, 0x42, 0x00, 0x18, 0xe8, 0xcd, 0x89, 0x0a, 0x01, 0x03, 0x3d, 0x5a,
+  0x1c, 0x05, 0x60, 0xa0, 0x47, 0x8b, 0xa3, 0x69, 0x0c, 0xf4, 0x28, 0x2a, 0x04, 0x80, 0x81, 0x1e,
+  0x4d, 0x93, 0xa6, 0x31, 0xd0, 0xab, 0x33, 0xb9, 0x03, 0x06, 0x7a, 0xb6, 0x10, 0x00, 0xc0, 0x40,
+  0xcf, 0x3e, 0x47, 0x01, 0x18, 0xe8, 0xdd, 0xe0, 0x0e, 0x00, 0x03, 0xbd, 0x9b, 0xdc, 0x01, 0x60,
+  0xa0, 0x77, 0xdd, 0x01, 0x00, 0x0c, 0xf4, 0xae, 0x4b, 0xee, 0x80, 0x81, 0xde, 0x75, 0x14, 0x00,
+  0x30, 0x90, 0x0c, 0x8e, 0x00, 0x00, 0x06, 0x92, 0x81, 0x8e, 0xc0, 0xc0, 0x40, 0xb2, 0x00, 0x00,
+  0x00, 0x18, 0x48, 0x16, 0x02, 0x00, 0x00, 0x03, 0xc9, 0x32, 0x69, 0x72, 0x67, 0x20, 0x79, 0x50,
+  0x01, 0x00, 0x0c, 0x24, 0x13, 0x01, 0x00, 0x80, 0x81, 0x64, 0x62, 0xc9, 0x1d, 0x30, 0x90, 0x4c,
+  0x2c, 0x03, 0x00, 0x06, 0x92, 0xac, 0xb8, 0x03, 0xc0, 0x40, 0xf2, 0xb1, 0x34, 0x00, 0x18, 0x48,
+  0xca, 0x42, 0x00, 0x00, 0x03, 0x49, 0x59, 0xdc, 0x01, 0x60, 0x20, 0x49, 0x0b, 0x00, 0x00, 0x0c,
+  0x24, 0x69, 0x71, 0x34, 0x8d, 0x81, 0x24, 0x4d, 0x93, 0x16, 0x32, 0x10, 0x0d, 0xee, 0x00, 0x00,
+  0x06, 0xa2, 0x85, 0x00, 0x00, 0xc0, 0x40, 0x14, 0x15, 0x02, 0x00, 0x18, 0x88, 0xa2, 0xe4, 0x0e,
+  0x00, 0x03, 0x51, 0x94, 0x1c, 0x2d, 0x64, 0x20, 0x9a, 0x5c, 0x21, 0x00, 0x0c, 0x44, 0x93, 0xa3,
+  0x00, 0x80, 0x81, 0x68, 0x9a, 0xc9, 0x1d, 0x30, 0x10, 0x95, 0xc9, 0x1d, 0x00, 0x06, 0xa2, 0xf2,
+  0xd5, 0x09, 0xc0, 0x40, 0xd5, 0x11, 0x00, 0x00, 0x18, 0xa8, 0x3a, 0x9a, 0x5e, 0x9d, 0x23, 0x8d,
+  0xe2, 0x68, 0x5a, 0x65, 0xa4, 0x51, 0xe4, 0x4c, 0xab, 0x8c, 0x64, 0xa8, 0x01, 0x00, 0x80, 0x91,
+  0x4c, 0x95, 0x05, 0x00, 0x30, 0xd2, 0x09, 0xb2, 0x00, 0x00, 0x46, 0x3a, 0x45, 0x16, 0x02, 0xc0,
+  0x48, 0x27, 0xb1, 0x42, 0x00, 0x18, 0xe9, 0x24, 0x97, 0xdc, 0x01, 0x23, 0x31, 0x02, 0x00, 0x00,
+  0x60, 0x24, 0x46, 0x0a, 0x00, 0x00, 0x8c, 0xc4, 0x48, 0x9a, 0x14, 0x80, 0x91, 0x58, 0x72, 0x07,
+  0x00, 0x30, 0x12, 0x63, 0xac, 0x10, 0x00, 0x46, 0x62, 0x34, 0x39, 0x0a, 0xc0, 0x48, 0x2c, 0x03,
+  0x00, 0x00, 0x18, 0xa9, 0x41, 0x00, 0x00, 0x00, 0x23, 0xb9, 0x20, 0x58, 0x21, 0x60, 0x24, 0x17,
+  0xda, 0xab, 0x0c, 0x8c, 0xe4, 0x08, 0x00, 0x00, 0x80, 0x91, 0x1c, 0x19, 0x69, 0x00, 0x30, 0x92,
+  0x23, 0x05, 0x00, 0x00, 0x46, 0x72, 0xa4, 0x10, 0x00, 0xc0, 0x48, 0x8e, 0x14, 0x77, 0x00, 0x18,
+  0xc9, 0x91, 0x64, 0xea, 0x9c, 0x23, 0x39, 0x92, 0x26, 0x4d, 0x63, 0x24, 0x47, 0x18, 0x00, 0x00,
+  0x8c, 0xe4, 0x0a, 0x00, 0x00, 0x80, 0x91, 0x5c, 0x21, 0x00, 0x00, 0x30, 0x92, 0x2b, 0xac, 0x00,
+  0x00, 0x46, 0x72, 0xc5, 0x51, 0x00, 0xc0, 0x48, 0xae, 0xc8, 0xe0, 0x0e, 0x18, 0xc9, 0x15, 0x99,
+  0xdc, 0x01, 0x23, 0xb9, 0x32, 0x9f, 0x3b, 0x60, 0x24, 0x77, 0x0a, 0x01, 0x00, 0x8c, 0xe4, 0x4e,
+  0x9a, 0xc9, 0x9d, 0x91, 0x5c, 0x1a, 0xc9, 0x1d, 0x30, 0x92, 0x4b, 0x04, 0x00, 0x00, 0x46, 0x72,
+  0xa9, 0x10, 0x00, 0xc0, 0x48, 0x2e, 0xb1, 0xe4, 0x0e, 0x18, 0xc9, 0xad, 0x42, 0x00, 0x00, 0x23,
+  0xb9, 0x47, 0x00, 0x00, 0x60, 0x24, 0xf7, 0x5a, 0x72, 0x07, 0x8c, 0xe4, 0x9e, 0x2c, 0x32, 0xb0,
+  0x91, 0xdc, 0x9c, 0x95, 0x01, 0x30, 0x92, 0xa3, 0x85, 0x00, 0x00, 0x46, 0x7a, 0xf2, 0xc9, 0xe4,
+  0xce, 0x48, 0xb0, 0x38, 0x02, 0x00, 0x18, 0x09, 0x16, 0x77, 0x00, 0x00, 0x23, 0x49, 0x02, 0x00,
+  0x00, 0x60, 0x24, 0x59, 0x00, 0x00, 0x00, 0x8c, 0x24, 0x8b, 0x2b, 0x04, 0x80, 0x91, 0x64, 0x91,
+  0xa6, 0x32, 0x30, 0x92, 0x4c, 0x8e, 0x01, 0x00, 0x46, 0x92, 0x69, 0xd2, 0xe4, 0xce, 0x48, 0xb2,
+  0xa5, 0x99, 0x1c, 0x1d, 0x49, 0xb6, 0x27, 0x0b, 0x01, 0x23, 0x4d, 0x44, 0x01, 0x00, 0x60, 0xa4,
+  0x09, 0x8b, 0x03, 0x00, 0x8c, 0x34, 0x21, 0x4a, 0x03, 0x80, 0x91, 0x26, 0x2d, 0x04, 0x00, 0x30,
+  0xd2, 0xa4, 0x05, 0xd2, 0x34, 0x46, 0x9a, 0xb4, 0xc8, 0x57, 0xe7, 0x48, 0x93, 0x96, 0x49, 0x0b,
+  0x18, 0x69, 0xd2, 0xe4, 0x0e, 0x00, 0x23, 0x4d, 0xca, 0x0a, 0x01, 0x60, 0xa4, 0x59, 0x65, 0x21,
+  0x00, 0x8c, 0x44, 0x83, 0x23, 0x00, 0x80, 0x91, 0x28, 0x7a, 0xf2, 0xd5, 0x39, 0x12, 0x45, 0x34,
+  0x15, 0x02, 0x46, 0xa2, 0x35, 0x8d, 0xe0, 0xce, 0x48, 0xb6, 0xb0, 0x0c, 0x00, 0x18, 0xc9, 0x16,
+  0x99, 0xdc, 0x01, 0x23, 0x69, 0x9d, 0xdc, 0x01, 0x60, 0xb0, 0x30, 0x82, 0x03, 0x00, 0x0c, 0x16,
+  0x46, 0x21, 0x00, 0x80, 0xc1, 0xc2, 0x40, 0x89, 0x15, 0x32, 0x58, 0x18, 0xc9, 0x01, 0x00, 0x06,
+  0x0b, 0x23, 0xb9, 0xe4, 0xce, 0x60, 0x61, 0xa4, 0x49, 0xd3, 0x18, 0x2c, 0x8c, 0xe7, 0x0e, 0x00,
+  0x83, 0x85, 0xf1, 0x6e, 0x21, 0x60, 0xb0, 0x30, 0x68, 0x21, 0x00, 0x0c, 0x16, 0x06, 0x4d, 0xaf,
+  0xce, 0xc1, 0xc2, 0xa8, 0xb2, 0x10, 0x30, 0x58, 0x20, 0x85, 0x00, 0x00, 0x06, 0x0b, 0xa6, 0x3a,
+  0x5a, 0xc8, 0x60, 0xe1, 0x14, 0x02, 0x00, 0x18, 0x2c, 0x9c, 0xe2, 0x0e, 0x00, 0x83, 0x85, 0x83,
+  0x0a, 0x00, 0x60, 0xb0, 0x70, 0x50, 0x21, 0x00, 0x0c, 0x16, 0x4e, 0x72, 0x07, 0x80, 0xc1, 0xc2,
+  0xa9, 0xf2, 0xd5, 0x39, 0x58, 0x48, 0x03, 0x00, 0x00, 0x06, 0x0b, 0x69, 0x04, 0x47, 0xc1, 0x60,
+  0x81, 0x11, 0x00, 0x00, 0x18, 0x2c, 0xb0, 0x42, 0x00, 0x00, 0x83, 0x05, 0x56, 0xdc, 0x01, 0x60,
+  0xb0, 0xc0, 0x8a, 0x7c, 0x75, 0x0e, 0x16, 0x58, 0x32, 0x95, 0x81, 0xc1, 0x02, 0x4b, 0xee, 0x00,
+  0x30, 0x58, 0x60, 0x2c, 0xd0, 0x34, 0x06, 0x0b, 0x8c, 0xa5, 0xc0, 0xc0, 0x60, 0x81, 0x3d, 0x77,
+  0x00, 0x18, 0x2c, 0xb0, 0xe7, 0x28, 0x00, 0x83, 0x05, 0xf6, 0x64, 0x21, 0x60, 0xb0, 0xc0, 0x1e,
+  0x2d, 0x04, 0x0c, 0x16, 0xd8, 0xab, 0x13, 0x80, 0xc1, 0x42, 0x0b, 0xee, 0x00, 0x30, 0x58, 0x68,
+  0x42, 0x16, 0x02, 0x06, 0x0b, 0xad, 0x00, 0x00, 0xc0, 0x60, 0xa1, 0x25, 0x5b, 0x08, 0x18, 0x2c,
+  0xb4, 0x49, 0x93, 0xa3, 0x83, 0x05, 0x47, 0x00, 0x00, 0x60, 0xb0, 0xe0, 0x08, 0x2b, 0x04, 0x0c,
+  0x16, 0xdc, 0x49, 0x81, 0x81, 0xc1, 0x82, 0x3b, 0x75, 0x02, 0x30, 0x58, 0x70, 0x69, 0x04, 0x06,
+  0x06, 0x0b, 0x2e, 0xb1, 0x42, 0xc0, 0x60, 0xc1, 0x25, 0x77, 0x00, 0x18, 0x2c, 0xb8, 0xe4, 0x28,
+  0x00, 0x83, 0x05, 0x97, 0x26, 0x2d, 0x64, 0xb0, 0xe0, 0x28, 0x00, 0x00, 0x0c, 0x16, 0x1c, 0x2d,
+  0x00, 0x80, 0xc1, 0x82, 0xa3, 0x85, 0x00, 0x30, 0x58, 0x70, 0x34, 0x0d, 0x00, 0x06, 0x0b, 0x8e,
+  0x26, 0x77, 0xc0, 0x60, 0xc1, 0x51, 0x56, 0x08, 0x18, 0x2c, 0xc0, 0x42, 0x00, 0x00, 0x83, 0x05,
+  0x58, 0xe4, 0xab, 0x73, 0xb0, 0x00, 0xd3, 0x00, 0x00, 0x0c, 0x16, 0x60, 0x1a, 0x81, 0x81, 0xc1,
+  0x02, 0x7c, 0x0e, 0x00, 0x30, 0x58, 0x80, 0x4f, 0xbe, 0x3a, 0x07, 0x0b, 0x32, 0x4c, 0x5a, 0xc8,
+  0x60, 0x41, 0x06, 0x0a, 0x00, 0x18, 0x2c, 0xc8, 0x40, 0x93, 0x3b, 0x83, 0x05, 0x29, 0x58, 0x21,
+  0x60, 0xb0, 0x20, 0x0b, 0x00, 0x00, 0x0c, 0x16, 0x64, 0x21, 0x00, 0x80, 0xc1, 0x82, 0x2c, 0xa6,
+  0xba, 0x33, 0x58, 0x90, 0xc5, 0x01, 0x00, 0x06, 0x0b, 0xb2, 0xb8, 0x42, 0xc0, 0x60, 0x41, 0x16,
+  0x77, 0x00, 0x18, 0x2c, 0xc8, 0xe2, 0x28, 0x00, 0x83, 0x05, 0x59, 0x1c, 0x2d, 0x64, 0xb0, 0x20,
+  0x8b, 0x2c, 0x04, 0x0c, 0x16, 0x64, 0x99, 0x29, 0xb0, 0xc1, 0x82, 0x2c, 0x93, 0x02, 0x30, 0x58,
+  0x90, 0x49, 0x30, 0x00, 0x06, 0x0b, 0x32, 0x0d, 0x00, 0xc0, 0x60, 0x41, 0xa6, 0x11, 0x18, 0x18,
+  0x2c, 0xc8, 0x34, 0x68, 0x1a, 0x83, 0x05, 0x99, 0x08, 0x00, 0x60, 0xb0, 0x20, 0x93, 0x03, 0x00,
+  0x0c, 0x16, 0x64, 0x72, 0x07, 0x80, 0xc1, 0x82, 0x4c, 0x8e, 0x02, 0x30, 0x58, 0x90, 0xc9, 0xd1,
+  0x02, 0x06, 0x0b, 0x32, 0xcd, 0xe4, 0xce, 0x60, 0x41, 0xa6, 0x99, 0x1c, 0x1d, 0x2c, 0xc8, 0x34,
+  0x63, 0x9d, 0x83, 0x05, 0xe9, 0x08, 0x00, 0x60, 0xb0, 0x20, 0xdd, 0x29, 0xee, 0x0c, 0x16, 0xe4,
+  0x6b, 0xc5, 0x9d, 0xc1, 0x82, 0x7c, 0x32, 0xb9, 0x33, 0x58, 0x90, 0x30, 0x0d, 0x00, 0x06, 0x0b,
+  0x12, 0xd2, 0x02, 0xc0, 0x60, 0x41, 0x66, 0x00, 0x00, 0x18, 0x2c, 0xcc, 0x40, 0x00, 0x00, 0x83,
+  0x85, 0x19, 0x58, 0x99, 0x60, 0xb0, 0x30, 0x43, 0x2b, 0x04, 0x0c, 0x16, 0x66, 0x70, 0x07, 0x80,
+  0xc1, 0xc2, 0x0c, 0x8e, 0x02, 0x30, 0x58, 0x98, 0x61, 0x22, 0x00, 0x06, 0x0b, 0xb3, 0x04, 0x47,
+  0xc1, 0x60, 0x61, 0x16, 0x53, 0x19, 0x18, 0x2c, 0xcc, 0x62, 0xea, 0x04, 0x83, 0x85, 0x59, 0x64,
+  0x21, 0x60, 0xb0, 0x30, 0x51, 0x21, 0x00, 0x0c, 0x16, 0x26, 0x32, 0x95, 0x81, 0xc1, 0xc2, 0x44,
+  0xc9, 0x1d, 0x30, 0x58, 0x98, 0x28, 0xbd, 0x3a, 0x07, 0x0b, 0x13, 0x51, 0x00, 0xc0, 0x60, 0x61,
+  0x3e, 0x77, 0x00, 0x18, 0x2c, 0xcc, 0x47, 0x93, 0x3b, 0x83, 0x85, 0xf9, 0x2a, 0x03, 0x60, 0xb0,
+  0x30, 0x5f, 0x9d, 0x13, 0x0c, 0x16, 0x26, 0x44, 0x14, 0x80, 0xc1, 0xc2, 0x9c, 0x85, 0x00, 0x30,
+  0x58, 0x98, 0x33, 0x0d, 0x00, 0x06, 0x0b, 0x73, 0x26, 0x77, 0xc0, 0x60, 0x61, 0x4e, 0x4a, 0x01,
+  0x18, 0x2c, 0x4c, 0x1a, 0xdc, 0x01, 0x83, 0x85, 0x49, 0x83, 0xa3, 0x60, 0xb0, 0x30, 0x69, 0x21,
+  0x00, 0x0c, 0x16, 0x26, 0x4d, 0x03, 0x80, 0xc1, 0xc2, 0xa4, 0xc9, 0x1d, 0x30, 0x58, 0x98, 0x34,
+  0xbd, 0x3a, 0x07, 0x0b, 0x93, 0x32, 0x00, 0xc0, 0x60, 0x61, 0x52, 0x56, 0x08, 0x18, 0x2c, 0x50,
+  0x00, 0x00, 0x00, 0x83, 0x05, 0x1a, 0x68, 0x0a, 0x6c, 0xb0, 0x40, 0x0b, 0x00, 0x00, 0x0c, 0x16,
+  0x68, 0x21, 0x00, 0x80, 0xc1, 0x02, 0x2d, 0xee, 0x00, 0x30, 0x58, 0xa0, 0x45, 0x16, 0x02, 0x06,
+  0x0b, 0xb4, 0xc8, 0x34, 0xc0, 0x60, 0x81, 0xa6, 0x01, 0x00, 0x18, 0x2c, 0xd0, 0x34, 0x02, 0x03,
+  0x83, 0x05, 0x9a, 0x1c, 0x00, 0x60, 0xb0, 0x40, 0x93, 0x3b, 0x00, 0x0c, 0x16, 0x68, 0x72, 0xc9,
+  0x9d, 0xc1, 0x02, 0x4d, 0x8e, 0x02, 0x30, 0x58, 0xa0, 0x2c, 0x0d, 0x00, 0x06, 0x0b, 0xf4, 0xd5,
+  0x09, 0xc0, 0x60, 0x81, 0xd2, 0x42, 0x00, 0x18, 0x2c, 0xd0, 0x2a, 0x93, 0x3b, 0x83, 0x05, 0x5b,
+  0x08, 0x00, 0x60, 0xb0, 0x60, 0x8b, 0x03, 0x00, 0x0c, 0x16, 0x6c, 0x71, 0x07, 0x80, 0xc1, 0x82,
+  0x2d, 0x32, 0xb9, 0x33, 0x58, 0xb0, 0x4f, 0x26, 0x77, 0x06, 0x0b, 0x37, 0x39, 0x00, 0xc0, 0x60,
+  0x01, 0x27, 0x5b, 0x08, 0x18, 0x2c, 0xe0, 0xe7, 0x0e, 0x00, 0x83, 0x05, 0xfc, 0x66, 0x72, 0x67,
+  0xb0, 0x90, 0x01, 0x00, 0x00, 0x0c, 0x56, 0x00, 0x00, 0x00, 0x80, 0xc1, 0x4a, 0x60, 0x85, 0x00,
+  0x30, 0x58, 0x09, 0x2c, 0x0d, 0x00, 0x06, 0x2b, 0x81, 0x25, 0x77, 0xc0, 0x60, 0x25, 0x38, 0x02,
+  0x00, 0x18, 0xac, 0x04, 0x59, 0x08, 0x00, 0x83, 0x95, 0x20, 0xd3, 0x00, 0x60, 0xb0, 0x12, 0x64,
+  0x72, 0x07, 0x0c, 0x56, 0x02, 0x2d, 0x04, 0x80, 0xc1, 0x8a, 0x08, 0x2d, 0x39, 0x3a, 0x58, 0x11,
+  0xc1, 0xd1, 0x34, 0x06, 0x2b, 0x23, 0xd0, 0xe4, 0xce, 0x60, 0x65, 0xa0, 0xe4, 0x0e, 0x18, 0xac,
+  0x8c, 0xe4, 0x0e, 0x00, 0x83, 0x15, 0x02, 0x00, 0x00, 0x60, 0xb0, 0x42, 0x8a, 0x3b, 0x00, 0x0c,
+  0x56, 0x0a, 0x00, 0x00, 0x80, 0xc1, 0x4a, 0x21, 0x65, 0x02, 0x30, 0x58, 0x29, 0x84, 0xbd, 0x3a,
+  0x07, 0x2b, 0xc5, 0x11, 0x00, 0xc0, 0x60, 0xa5, 0xc8, 0x14, 0x18, 0x18, 0xac, 0x94, 0x99, 0x1c,
+  0x05, 0x83, 0x95, 0x32, 0x69, 0x21, 0x60, 0xb0, 0xc2, 0x08, 0x00, 0x00, 0x0c, 0x56, 0x58, 0x01,
+  0x00, 0x80, 0xc1, 0x0a, 0x2b, 0x04, 0x00, 0x30, 0x58, 0x61, 0xc5, 0x15, 0x02, 0x06, 0x2b, 0xac,
+  0x38, 0x9a, 0xc6, 0x60, 0x85, 0x15, 0x99, 0x06, 0x18, 0xac, 0xb0, 0x22, 0x93, 0x3b, 0x83, 0x15,
+  0x96, 0x46, 0x72, 0x60, 0xb0, 0xc2, 0x92, 0x3b, 0x00, 0x0c, 0x56, 0x58, 0xa2, 0x85, 0x80, 0xc1,
+  0x0a, 0x63, 0x85, 0x00, 0x30, 0x58, 0x61, 0xaf, 0x15, 0x00, 0x06, 0x2b, 0xec, 0xb5, 0x42, 0xc0,
+  0x60, 0x85, 0xd1, 0x34, 0x00, 0x18, 0xac, 0x38, 0x02, 0x00, 0x00, 0x83, 0x15, 0x47, 0x92, 0x03,
+  0x60, 0xb0, 0xe2, 0x08, 0x03, 0x00, 0x0c, 0x56, 0x1c, 0x61, 0x05, 0x80, 0xc1, 0x8a, 0x23, 0xb2,
+  0x10, 0x30, 0x58, 0x71, 0xc5, 0x1d, 0x00, 0x06, 0x2b, 0xee, 0x14, 0x00, 0xc0, 0x60, 0xc5, 0x9d,
+  0x42, 0x00, 0x18, 0xac, 0xb8, 0x93, 0x5e, 0x9d, 0x83, 0x15, 0x97, 0x08, 0x00, 0x60, 0xb0, 0xe2,
+  0x92, 0x0b, 0x0c, 0x0c, 0x56, 0x5c, 0x72, 0x07, 0x80, 0xc1, 0x8a, 0xa3, 0x00, 0x00, 0x30, 0x58,
+  0x71, 0x34, 0xb8, 0x03, 0x06, 0x2b, 0x8e, 0x16, 0x00, 0xc0, 0x60, 0xc5, 0xd1, 0x42, 0x00, 0x18,
+  0xac, 0x38, 0x5a, 0xe6, 0x04, 0x83, 0x15, 0x47, 0xd3, 0x00, 0x60, 0xb0, 0xe2, 0x68, 0x1a, 0x81,
+  0x0d, 0x56, 0x1c, 0x4d, 0x0e, 0x80, 0xc1, 0x8a, 0xa3, 0xc9, 0x1d, 0x30, 0x58, 0x71, 0x94, 0x15,
+  0x02, 0x06, 0x2b, 0xf0, 0xb9, 0x03, 0xc0, 0x60, 0x05, 0xd2, 0xe4, 0x28, 0x18, 0xac, 0xc8, 0xc0,
+  0x0a, 0x01, 0x83, 0x15, 0x19, 0xdc, 0x01, 0x60, 0xb0, 0x22, 0x83, 0x0c, 0x0c, 0x0c, 0x56, 0xa4,
+  0x60, 0x85, 0x80, 0xc1, 0x8a, 0x2c, 0x00, 0x00, 0x30, 0x58, 0x91, 0x85, 0x00, 0x00, 0x06, 0x2b,
+  0xb2, 0x38, 0x00, 0xc0, 0x60, 0x45, 0x16, 0x77, 0x00, 0x18, 0xac, 0xc8, 0xe2, 0x68, 0x21, 0x83,
+  0x15, 0x59, 0x64, 0x21, 0x60, 0xb0, 0x22, 0x93, 0x0b, 0x0c, 0x0c, 0x56, 0x64, 0x72, 0x85, 0x80,
+  0xc1, 0x8a, 0x4c, 0xee, 0x00, 0x30, 0x58, 0x91, 0xc9, 0xd1, 0x34, 0x06, 0x2b, 0xf2, 0xb5, 0x42,
+  0xc0, 0x60, 0x45, 0x3e, 0x99, 0xdc, 0x19, 0xac, 0xcc, 0x22, 0x93, 0x3b, 0x83, 0x95, 0x89, 0x32,
+  0x00, 0x60, 0xb0, 0x32, 0x5f, 0x9d, 0x13, 0x0c, 0x56, 0xe6, 0xbb, 0x85, 0x80, 0xc1, 0xca, 0x9c,
+  0x34, 0x39, 0x3a, 0x58, 0x99, 0xb4, 0x10, 0x00, 0x06, 0x2b, 0x93, 0xa6, 0xe0, 0xce, 0x60, 0x65,
+  0xd2, 0xe4, 0x0e, 0x18, 0xac, 0x4c, 0xca, 0x00, 0x00, 0x83, 0x15, 0x5a, 0x08, 0x00, 0x60, 0xb0,
+  0x42, 0xd3, 0x08, 0x0c, 0x0c, 0x96, 0xc2, 0x48, 0xee, 0x80, 0xc1, 0x12, 0x29, 0xee, 0x00, 0x30,
+  0x58, 0x2a, 0x04, 0x00, 0x00, 0x06, 0x4b, 0x85, 0x30, 0x00, 0xc0, 0x60, 0xa9, 0x30, 0x00, 0x00,
+  0x18, 0x2c, 0x15, 0x57, 0x24, 0x01, 0x83, 0xa5, 0x22, 0x8b, 0x03, 0x60, 0xb0, 0x54, 0x64, 0x1a,
+  0x00, 0x0c, 0x96, 0x0e, 0x00, 0x00, 0x80, 0xc1, 0xd2, 0x09, 0x34, 0x0d, 0x30, 0x58, 0x3a, 0x05,
+  0x00, 0x00, 0x06, 0x4b, 0x07, 0xb1, 0xe4, 0xce, 0x60, 0xe9, 0x20, 0x9a, 0xdc, 0x19, 0x2c, 0xb1,
+  0x42, 0x00, 0x00, 0x83, 0x25, 0x56, 0x58, 0x21, 0x60, 0xb0, 0xc4, 0x8a, 0x3b, 0x00, 0x0c, 0x96,
+  0x58, 0x71, 0x34, 0x8d, 0xc1, 0x12, 0x4b, 0x8e, 0x16, 0x32, 0x58, 0x62, 0xac, 0x10, 0x00, 0x06,
+  0x4b, 0x0d, 0x00, 0x00, 0xc0, 0x60, 0xa9, 0x05, 0xf6, 0xea, 0x1c, 0x2c, 0xb5, 0xe0, 0x02, 0x03,
+  0x83, 0xa5, 0x56, 0x08, 0x00, 0x60, 0xb0, 0xd4, 0x8a, 0x3b, 0x00, 0x0c, 0x96, 0x5a, 0x71, 0xc9,
+  0x81, 0xc1, 0x52, 0x4b, 0x8e, 0x02, 0x30, 0x58, 0x6a, 0x69, 0x26, 0x77, 0x06, 0x4b, 0xed, 0x55,
+  0x9a, 0xc6, 0x60, 0xc9, 0x05, 0x77, 0x00, 0x18, 0x2c, 0x39, 0x02, 0x00, 0x00, 0x83, 0x25, 0x47,
+  0x0a, 0x01, 0x60, 0xb0, 0xe4, 0xca, 0xa4, 0x69, 0x0c, 0x96, 0xdc, 0x29, 0x04, 0x80, 0xc1, 0x92,
+  0x3b, 0xee, 0x00, 0x30, 0x58, 0x72, 0xa7, 0xba, 0x03, 0x06, 0x4b, 0x2e, 0x11, 0x00, 0xc0, 0x60,
+  0xc9, 0x25, 0x07, 0x00, 0x18, 0x2c, 0xb9, 0x34, 0x0b, 0x01, 0x83, 0x25, 0xb7, 0x32, 0x00, 0x60,
+  0xb0, 0xe4, 0x28, 0x00, 0x00, 0x0c, 0x96, 0x1c, 0x1d, 0x00, 0x80, 0xc1, 0x92, 0xa3, 0x05, 0x00,
+  0x30, 0x58, 0x72, 0xb4, 0x10, 0x00, 0x06, 0x4b, 0x8e, 0x16, 0x47, 0xc1, 0x60, 0xc9, 0xd1, 0x14,
+  0x1c, 0x1d, 0x2c, 0x39, 0x9a, 0x06, 0x00, 0x83, 0x25, 0x47, 0xd3, 0x08, 0x6c, 0xb0, 0xe4, 0x68,
+  0x72, 0x07, 0x0c, 0x96, 0x1c, 0x4d, 0xaf, 0xce, 0xc1, 0x92, 0xa3, 0xac, 0x10, 0x30, 0x58, 0x92,
+  0x81, 0x16, 0x02, 0x06, 0x4b, 0xb2, 0x10, 0x00, 0xc0, 0x60, 0x49, 0x16, 0x47, 0x0b, 0x19, 0x2c,
+  0xc9, 0x64, 0xea, 0x04, 0x83, 0xa5, 0x19, 0xe4, 0xab, 0x73, 0xb0, 0x34, 0x0b, 0x01, 0x00, 0x0c,
+  0x96, 0x66, 0x71, 0x69, 0x80, 0xc1, 0xd2, 0x44, 0x00, 0x00, 0x30, 0x58, 0x9a, 0xc8, 0xd4, 0x09,
+  0x06, 0x4b, 0x13, 0x25, 0x77, 0xc0, 0x60, 0x69, 0x3e, 0x47, 0xd3, 0x18, 0x2c, 0xcd, 0x47, 0x93,
+  0xa3, 0x83, 0xa5, 0xf9, 0xea, 0x04, 0x60, 0xb0, 0x34, 0x27, 0x2d, 0x04, 0x0c, 0x96, 0x26, 0x0d,
+  0x14, 0x80, 0xc1, 0xd2, 0xa4, 0x85, 0x00, 0x30, 0x58, 0x9a, 0x34, 0xb9, 0x03, 0x06, 0x4b, 0x14,
+  0x00, 0x00, 0xc0, 0x60, 0x89, 0x16, 0x00, 0x00, 0x18, 0x2c, 0xd1, 0x42, 0x00, 0x00, 0x83, 0x25,
+  0x5a, 0x1c, 0x2d, 0x64, 0xb0, 0x44, 0x51, 0x21, 0x00, 0x0c, 0x96, 0x28, 0x4a, 0xaf, 0xce, 0xc1,
+  0x12, 0x45, 0x19, 0x00, 0x30, 0x58, 0xa2, 0x69, 0x04, 0x06, 0x06, 0x4b, 0x34, 0x8d, 0xe0, 0xce,
+  0x60, 0x89, 0x3e, 0x0a, 0x00, 0x18, 0x2c, 0xd1, 0x0c, 0x00, 0x00, 0x83, 0xbd, 0xd0, 0x92, 0x3b,
+  0x60, 0xb0, 0x37, 0x82, 0x60, 0x00, 0x0c, 0xf6, 0x08, 0x00, 0x00, 0x80, 0xc1, 0x1e, 0x29, 0x8e,
+  0x16, 0x30, 0xd8, 0x23, 0x69, 0x00, 0x00, 0x06, 0x7b, 0x84, 0x15, 0x00, 0xc0, 0x60, 0x8f, 0xc8,
+  0x34, 0x00, 0x18, 0xec, 0x31, 0x02, 0x00, 0x00, 0x83, 0x3d, 0x56, 0x08, 0x00, 0x60, 0xb0, 0xc7,
+  0x92, 0xa3, 0x00, 0x0c, 0xf6, 0x18, 0x4b, 0xee, 0x80, 0xc1, 0x1e, 0x63, 0xe9, 0xd5, 0x32, 0xd8,
+  0x63, 0xcf, 0xd1, 0x42, 0x06, 0x7b, 0x2d, 0x10, 0x00, 0xc0, 0x60, 0xaf, 0x05, 0x56, 0x08, 0x18,
+  0xec, 0xb5, 0xe0, 0x0e, 0x00, 0x83, 0xbd, 0x16, 0x64, 0x72, 0x74, 0xb0, 0xd7, 0x02, 0x05, 0x00,
+  0x0c, 0xf6, 0x9a, 0x60, 0x00, 0x80, 0xc1, 0x5e, 0x2b, 0x8e, 0x16, 0x30, 0xd8, 0x6b, 0x69, 0x00,
+  0x00, 0x06, 0x7b, 0x2d, 0x39, 0x00, 0xc0, 0x60, 0xaf, 0x25, 0x47, 0x01, 0x18, 0xec, 0xb5, 0x34,
+  0x0b, 0x01, 0x83, 0xbd, 0xf6, 0x5a, 0x21, 0x60, 0xb0, 0xd7, 0x9e, 0x3b, 0x00, 0x0c, 0xf6, 0x1c,
+  0x01, 0x00, 0x80, 0xc1, 0x9e, 0x23, 0x85, 0x00, 0x30, 0xd8, 0x73, 0xa7, 0x10, 0x00, 0x06, 0x7b,
+  0x2e, 0xb9, 0x03, 0xc0, 0x60, 0xcf, 0x3d, 0x99, 0xdc, 0x19, 0xec, 0x39, 0x5a, 0x08, 0x00, 0x83,
+  0x3d, 0x47, 0x8b, 0x2c, 0x64, 0xb0, 0xe7, 0x68, 0x0a, 0x0c, 0x0c, 0xf6, 0x1c, 0x4d, 0x03, 0x80,
+  0xc1, 0x9e, 0xa3, 0xc9, 0x01, 0x30, 0xd8, 0x73, 0x54, 0x16, 0x02, 0x06, 0x7b, 0x4f, 0x06, 0x9a,
+  0xc6, 0x60, 0x0f, 0xbe, 0x56, 0x08, 0x18, 0xec, 0xc9, 0xc0, 0x0a, 0x01, 0x83, 0x3d, 0x19, 0xdc,
+  0x01, 0x60, 0xb0, 0x27, 0x83, 0x4c, 0xee, 0x0c, 0xf6, 0xa4, 0x60, 0x85, 0x80, 0xc1, 0x9e, 0x2c,
+  0x00, 0x00, 0x30, 0xd8, 0x93, 0x85, 0x00, 0x00, 0x06, 0x7b, 0xb2, 0x90, 0x42, 0xc0, 0x60, 0x4f,
+  0x16, 0x77, 0x00, 0x18, 0xec, 0xc9, 0xe2, 0x68, 0x1a, 0x83, 0x3d, 0x59, 0x66, 0x21, 0x60, 0xb0,
+  0x27, 0xcb, 0xa4, 0x85, 0x0c, 0xf6, 0x64, 0x3a, 0x00, 0x80, 0xc1, 0x9e, 0x4c, 0x0e, 0x00, 0x30,
+  0xd8, 0x93, 0xc9, 0x1d, 0x00, 0x06, 0x7b, 0x32, 0x39, 0x0a, 0xc0, 0x60, 0x4f, 0x26, 0x47, 0x0b,
+  0x18, 0xec, 0xc9, 0x27, 0x0b, 0x01, 0x83, 0xbd, 0x49, 0x93, 0x3b, 0x60, 0xb0, 0x47, 0x01, 0x00,
+  0x00, 0x0c, 0xf6, 0x68, 0x60, 0x85, 0x80, 0xc1, 0x1e, 0x2d, 0x24, 0xb9, 0x33, 0xd8, 0xa3, 0xc5,
+  0x51, 0x00, 0x06, 0x7b, 0xb4, 0xc8, 0xc0, 0xc0, 0x60, 0x8f, 0x16, 0x59, 0x08, 0x18, 0xec, 0xd1,
+  0x32, 0x93, 0xa3, 0x83, 0x3d, 0x8a, 0x4c, 0x65, 0x60, 0xb0, 0x47, 0x51, 0x06, 0x00, 0x0c, 0xf6,
+  0x68, 0x1a, 0x00, 0x80, 0xc1, 0x1e, 0x4d, 0xee, 0x00, 0x30, 0xd8, 0xa3, 0xc9, 0x51, 0x00, 0x06,
+  0x7b, 0xf4, 0x31, 0x00, 0xc0, 0x60, 0xaf, 0xb2, 0x34, 0x00, 0x18, 0xec, 0x55, 0x77, 0x00, 0x00,
+  0x83, 0xbd, 0x2a, 0x09, 0x00, 0x60, 0xb0, 0x57, 0x65, 0x21, 0x00, 0x0c, 0xf6, 0xaa, 0x4c, 0xee,
+  0x80, 0xc1, 0x5e, 0x9d, 0x85, 0x00, 0x30, 0xd8, 0xab, 0x33, 0xb9, 0x03, 0x06, 0x7b, 0x75, 0xc2,
+  0xca, 0xc0, 0x60, 0xcf, 0x16, 0x77, 0x00, 0x18, 0xec, 0xd9, 0x32, 0x27, 0x00, 0x83, 0xbd, 0x5b,
+  0x08, 0x00, 0x60, 0xb0, 0x77, 0x59, 0x06, 0x00, 0x0c, 0xf6, 0xae, 0x3b, 0x00, 0x80, 0xc1, 0xde,
+  0x75, 0xb4, 0x00, 0x30, 0x58, 0x25, 0x85, 0x00, 0x00, 0x06, 0xab, 0xa6, 0xca, 0xe4, 0xce, 0x60,
+  0x35, 0xc9, 0x34, 0x00, 0x18, 0xac, 0x32, 0x02, 0x00, 0x00, 0x83, 0x55, 0x56, 0x08, 0x00, 0x60,
+  0xb0, 0xca, 0x9e, 0x7c, 0x75, 0x0e, 0x56, 0xd9, 0xab, 0x13, 0x80, 0xc1, 0xaa, 0x23, 0x00, 0x00,
+  0x30, 0x58, 0x75, 0x84, 0x15, 0x02, 0x06, 0xab, 0x8e, 0xdc, 0x02, 0xc0, 0x60, 0xd5, 0x15, 0x57,
+  0x08, 0x18, 0xac, 0xba, 0x53, 0x08, 0x00, 0x83, 0x55, 0x77, 0x10, 0x00, 0x60, 0xb0, 0xea, 0xd2,
+  0x00, 0x00, 0x0c, 0x56, 0x5d, 0x22, 0x00, 0x80, 0xc1, 0xaa, 0x4b, 0xa6, 0x32, 0x30, 0x58, 0x75,
+  0xc9, 0x1d, 0x00, 0x06, 0xab, 0x6e, 0x01, 0x00, 0xc0, 0x60, 0xd5, 0xad, 0x34, 0x02, 0x1b, 0xac,
+  0x3a, 0x0a, 0x00, 0x00, 0x83, 0x55, 0x47, 0x0b, 0x00, 0x60, 0xb0, 0xea, 0x68, 0x21, 0x00, 0x0c,
+  0x56, 0x1d, 0x4d, 0x03, 0x80, 0xc1, 0xaa, 0xa3, 0xc9, 0x1d, 0x30, 0x58, 0x75, 0x34, 0x39, 0x0a,
+  0x06, 0xab, 0x8e, 0xa6, 0x57, 0xe7, 0x60, 0xd5, 0x51, 0x56, 0x08, 0x18, 0xac, 0xca, 0xe2, 0x28,
+  0x00, 0x83, 0xd5, 0x19, 0x64, 0x70, 0x67, 0xb0, 0x3a, 0x8b, 0x3b, 0x00, 0x0c, 0x56, 0xe7, 0x73,
+  0x07, 0x80, 0xc1, 0xea, 0xa4, 0xc9, 0x1d, 0x30, 0x5e, 0x18, 0x00, 0x00, 0x00, 0xc6, 0x0b, 0xa4,
+  0x38, 0x9a, 0xc6, 0x78, 0x41, 0xb3, 0x42, 0x00, 0x18, 0xaf, 0x04, 0x9a, 0x06, 0x00, 0xe3, 0x15,
+  0x46, 0x00, 0x00, 0x60, 0xbc, 0xc2, 0x12, 0x01, 0x00, 0x8c, 0x57, 0x64, 0xa0, 0x85, 0x80, 0xf1,
+  0x4c, 0x71, 0x07, 0x00, 0x30, 0x1e, 0x4a, 0x81, 0x02, 0x00, 0xc6, 0x43, 0x69, 0x50, 0x00, 0xc0,
+  0x78, 0xe8, 0xb9, 0x14, 0x18, 0x18, 0x0f, 0xbd, 0x99, 0xdc, 0x01, 0xe3, 0xb1, 0x20, 0x58, 0x21,
+  0x60, 0x3c, 0x16, 0x58, 0x01, 0x00, 0x8c, 0xc7, 0x02, 0x2b, 0x04, 0x80, 0xf1, 0x58, 0x90, 0x85,
+  0x00, 0x30, 0x1e, 0x1b, 0x81, 0x02, 0x00, 0xc6, 0x63, 0xa3, 0x90, 0x42, 0xc0, 0x78, 0x6c, 0x14,
+  0x07, 0x00, 0x18, 0x8f, 0x8d, 0x32, 0x51, 0x01, 0xe3, 0x31, 0x02, 0x00, 0x00, 0x60, 0x3c, 0x46,
+  0x12, 0x4b, 0xee, 0x8c, 0xc7, 0x52, 0x60, 0x69, 0x80, 0xf1, 0x58, 0x62, 0x85, 0x00, 0x30, 0x1e,
+  0x4b, 0x0e, 0x00, 0x00, 0xc6, 0x63, 0xc9, 0x25, 0x77, 0xc0, 0x78, 0x2c, 0x3d, 0x9a, 0xdc, 0x19,
+  0x8f, 0x25, 0x99, 0x5c, 0x1a, 0xe3, 0xb1, 0x44, 0xd3, 0x08, 0x6e, 0x3c, 0xc6, 0x8a, 0x0b, 0x0c,
+  0x8c, 0xc7, 0x18, 0x2b, 0x04, 0x80, 0xf1, 0x18, 0x63, 0xc9, 0x1d, 0x30, 0x1e, 0x63, 0xcf, 0x1d,
+  0x00, 0xc6, 0x63, 0xec, 0xc9, 0xe2, 0xce, 0x78, 0x8c, 0x3d, 0xf9, 0xea, 0x1c, 0x8f, 0x3d, 0x96,
+  0x01, 0x00, 0xe3, 0xb1, 0xe7, 0x48, 0x72, 0x67, 0x3c, 0xf6, 0x64, 0x70, 0x00, 0x8c, 0xc7, 0x9e,
+  0x2c, 0x04, 0x80, 0xf1, 0xd8, 0x5c, 0x00, 0x00, 0x30, 0x1e, 0xab, 0x04, 0x00, 0x00, 0xc6, 0x6b,
+  0xc1, 0x11, 0x00, 0xc0, 0x78, 0x2d, 0xb8, 0x03, 0x00, 0x18, 0xaf, 0x05, 0x47, 0x93, 0x03, 0xe3,
+  0x35, 0x11, 0xdc, 0x01, 0x60, 0xbc, 0x26, 0x58, 0x72, 0x07, 0x8c, 0xd7, 0x8a, 0x4b, 0x85, 0x80,
+  0xf1, 0x5a, 0x0a, 0xee, 0x00, 0x30, 0x5e, 0x4b, 0x84, 0x15, 0x02, 0xc6, 0x6b, 0xe9, 0x14, 0x77,
+  0xc0, 0x78, 0x2d, 0x39, 0x52, 0x08, 0x18, 0xaf, 0xc1, 0x02, 0x00, 0x00, 0xe3, 0x35, 0x58, 0xdc,
+  0x01, 0x60, 0xbc, 0x06, 0x93, 0xa3, 0x05, 0x8c, 0xd7, 0x60, 0x06, 0x00, 0x80, 0xf1, 0x5c, 0x18,
+  0x85, 0x00, 0x30, 0x9e, 0x0b, 0xac, 0x10, 0x00, 0xc6, 0x73, 0xc1, 0xa5, 0x01, 0xc0, 0x78, 0x2e,
+  0xc8, 0x42, 0x00, 0x18, 0xcf, 0x11, 0x00, 0x00, 0x00, 0xe3, 0x39, 0x52, 0x00, 0x00, 0x60, 0x3c,
+  0x47, 0x58, 0x72, 0x07, 0x8c, 0xe7, 0x88, 0x2c, 0x04, 0x80, 0xf1, 0x1c, 0x91, 0xc9, 0x1d, 0x30,
+  0x9e, 0x2b, 0x04, 0x00, 0x00, 0xc6, 0x73, 0x85, 0xa5, 0x01, 0xc0, 0x78, 0xae, 0xb8, 0x03, 0x00,
+  0x18, 0xcf, 0x15, 0x47, 0x01, 0x00, 0xe3, 0xb9, 0xe2, 0x68, 0x72, 0x74, 0x3c, 0x77, 0x0a, 0x00,
+  0x00, 0x8c, 0xe7, 0x4e, 0x31, 0x95, 0x81, 0xf1, 0x5c, 0x0a, 0x2e, 0x39, 0x3a, 0x9e, 0x4b, 0x6e,
+  0x00, 0x00, 0xc6, 0x73, 0xc9, 0x91, 0x42, 0xc0, 0x78, 0x2e, 0xb9, 0x34, 0x00, 0x18, 0xcf, 0x25,
+  0x97, 0xdc, 0x01, 0xe3, 0xb9, 0xf9, 0x5a, 0x21, 0x60, 0x3c, 0x47, 0x0b, 0x01, 0x00, 0x8c, 0xf7,
+  0xc2, 0x08, 0xee, 0x80, 0xf1, 0x1e, 0x01, 0x00, 0x00, 0x30, 0xde, 0x23, 0xc5, 0x1d, 0x00, 0xc6,
+  0x7b, 0x0b, 0x00, 0x00, 0xc0, 0x78, 0x8f, 0x11, 0x00, 0x00, 0x18, 0xef, 0xb1, 0x47, 0x0b, 0x01,
+  0xe3, 0xbd, 0x96, 0xdc, 0x01, 0x60, 0xbc, 0xd7, 0x12, 0x4d, 0xee, 0x8c, 0xf7, 0xda, 0xab, 0x73,
+  0x82, 0xf1, 0x9e, 0x23, 0x00, 0x00, 0x30, 0xde, 0x73, 0xb4, 0x10, 0x00, 0xc6, 0x7b, 0x12, 0x00,
+  0x00, 0xc0, 0x78, 0x4f, 0x16, 0x02, 0x00, 0x18, 0xef, 0xc9, 0x62, 0xea, 0x9c, 0xe3, 0x3d, 0x59,
+  0xdc, 0x01, 0x60, 0xbc, 0x27, 0xcb, 0x4c, 0xee, 0x8c, 0xf7, 0x64, 0x12, 0x0c, 0x80, 0xf1, 0x9e,
+  0x7c, 0x32, 0x30, 0x30, 0xde, 0x93, 0x4f, 0x16, 0x02, 0xc6, 0x7b, 0x13, 0xa5, 0x01, 0xc0, 0x78,
+  0x8f, 0x86, 0x01, 0x00, 0x18, 0xef, 0xd1, 0xe2, 0x0e, 0x00, 0xe3, 0xbd, 0x2a, 0x03, 0x2d, 0x64,
+  0xbc, 0x77, 0x8b, 0xa9, 0x0c, 0x8c, 0x07, 0x13, 0x29, 0x04, 0x80, 0xf1, 0xe0, 0xa4, 0x69, 0x00,
+  0x30, 0x9e, 0x0c, 0x42, 0x16, 0x02, 0xc6, 0x93, 0x81, 0x15, 0x02, 0xc0, 0x78, 0x32, 0xb0, 0xe4,
+  0x00, 0x18, 0x4f, 0x06, 0x96, 0x01, 0x00, 0xe3, 0xc9, 0xd0, 0x02, 0x2b, 0x60, 0x3c, 0x19, 0x1c,
+  0x01, 0x00, 0x8c, 0x27, 0x83, 0x2b, 0x04, 0x80, 0xf1, 0x64, 0x70, 0x07, 0x00, 0x30, 0x9e, 0x0c,
+  0x8e, 0x02, 0x00, 0xc6, 0x93, 0xc1, 0xd1, 0x42, 0xc0, 0x78, 0x32, 0xc8, 0x20, 0x0b, 0x19, 0x4f,
+  0x06, 0x59, 0x00, 0x00, 0xe3, 0xc9, 0x20, 0xd3, 0x00, 0x60, 0x3c, 0x19, 0xe4, 0xab, 0x13, 0x8c,
+  0x27, 0x03, 0x05, 0x00, 0x80, 0xf1, 0x64, 0xa0, 0xc5, 0x51, 0x30, 0x9e, 0x0c, 0x34, 0x39, 0x0a,
+  0xc6, 0x93, 0x82, 0xa5, 0x01, 0xc0, 0x78, 0x52, 0xb0, 0xe4, 0x0e, 0x18, 0x4f, 0x0a, 0xf6, 0x2a,
+  0x03, 0xe3, 0x49, 0x21, 0x5f, 0x65, 0x60, 0x3c, 0x39, 0x02, 0xa5, 0x85, 0x8c, 0x27, 0x47, 0x21,
+  0x65, 0x82, 0xf1, 0xe4, 0x40, 0x85, 0x00, 0x30, 0x9e, 0x1c, 0x28, 0x0d, 0x00, 0xc6, 0x93, 0x03,
+  0x25, 0x47, 0xc1, 0x78, 0x72, 0x24, 0x77, 0x00, 0x18, 0x4f, 0x0e, 0x5a, 0x08, 0x00, 0xe3, 0xc9,
+  0x51, 0xe5, 0xab, 0x73, 0x3c, 0x49, 0x00, 0x00, 0x00, 0x8c, 0x27, 0x49, 0x71, 0x07, 0x80, 0xf1,
+  0x24, 0x79, 0xb2, 0x10, 0x30, 0x9e, 0x24, 0x32, 0xb0, 0x02, 0xc6, 0x93, 0x05, 0x00, 0x00, 0xc0,
+  0x78, 0xb2, 0x10, 0x00, 0x00, 0x18, 0x4f, 0x16, 0x07, 0x00, 0x00, 0xe3, 0xc9, 0xe2, 0x46, 0x60,
+  0x60, 0x3c, 0x59, 0x1c, 0x01, 0x00, 0x8c, 0x27, 0x8b, 0x2b, 0x00, 0x80, 0xf1, 0x64, 0x71, 0x85,
+  0x00, 0x30, 0x9e, 0x2c, 0xee, 0x00, 0x00, 0xc6, 0x93, 0xc5, 0x9d, 0xe2, 0xe8, 0x78, 0xb2, 0xb8,
+  0x34, 0x00, 0x18, 0x4f, 0x16, 0x97, 0xdc, 0x01, 0xe3, 0xc9, 0xe2, 0x58, 0x06, 0x60, 0x3c, 0x59,
+  0x1c, 0x05, 0x00, 0x8c, 0x27, 0x8b, 0xa3, 0x05, 0x80, 0xf1, 0x64, 0x91, 0x81, 0x15, 0x32, 0x9e,
+  0x2c, 0xb2, 0x00, 0x00, 0xc6, 0x93, 0x45, 0x16, 0x02, 0xc0, 0x78, 0xb2, 0xc8, 0x32, 0x01, 0x18,
+  0x4f, 0x16, 0x99, 0x46, 0x60, 0xe3, 0xc9, 0x22, 0x93, 0x3b, 0x60, 0x3c, 0x59, 0xa4, 0xa3, 0x00,
+  0x8c, 0x27, 0xcb, 0x2c, 0x04, 0x80, 0xf1, 0x64, 0x99, 0x69, 0x00, 0x30, 0x9e, 0x2c, 0x93, 0x26,
+  0x47, 0xc7, 0x93, 0x07, 0x15, 0x52, 0xc8, 0x78, 0xf2, 0x38, 0x02, 0x00, 0x18, 0x4f, 0xa6, 0xc0,
+  0x0a, 0x01, 0xe3, 0xc9, 0x14, 0xdc, 0x01, 0x60, 0x3c, 0x99, 0x02, 0x4d, 0xee, 0x8c, 0x27, 0xd3,
+  0x00, 0x00, 0x80, 0xf1, 0x64, 0x1a, 0x81, 0x02, 0x30, 0x9e, 0x4c, 0xa3, 0x10, 0x00, 0xc6, 0x93,
+  0x69, 0xa0, 0xe4, 0xce, 0x78, 0x32, 0x0d, 0x44, 0x0b, 0x18, 0x4f, 0xa6, 0x91, 0x06, 0x00, 0xe3,
+  0xc9, 0x34, 0xd2, 0x08, 0x6c, 0x3c, 0x99, 0x46, 0x1a, 0x05, 0x8c, 0x27, 0xd3, 0x48, 0x0e, 0x80,
+  0xf1, 0x64, 0x1a, 0xe9, 0xd5, 0x39, 0x9e, 0x4c, 0x23, 0xcd, 0x02, 0xc6, 0x93, 0x69, 0xd0, 0x34,
+  0xc0, 0x78, 0x32, 0x11, 0x00, 0x00, 0x18, 0x4f, 0x26, 0x92, 0xdc, 0x01, 0xe3, 0xc9, 0x74, 0x0a,
+  0x01, 0x60, 0x3c, 0x99, 0xdc, 0x00, 0x00, 0x8c, 0x27, 0x93, 0x23, 0x00, 0x80, 0xf1, 0x64, 0x72,
+  0xa4, 0xb8, 0x33, 0x9e, 0x4c, 0xae, 0x10, 0x00, 0xc6, 0x93, 0xc9, 0x1d, 0x00, 0xc0, 0x78, 0x32,
+  0xb9, 0x53, 0x08, 0x18, 0x4f, 0x26, 0x97, 0x02, 0x03, 0xe3, 0xc9, 0xe4, 0xd2, 0x00, 0x60, 0x3c,
+  0x99, 0x5c, 0x72, 0x14, 0x8c, 0x27, 0x93, 0x4b, 0xaf, 0xb2, 0xf1, 0x64, 0x7a, 0x2d, 0x30, 0x30,
+  0x9e, 0x4c, 0xb2, 0x00, 0x00, 0xc6, 0x93, 0x49, 0x16, 0x02, 0xc0, 0x78, 0x32, 0xcd, 0x34, 0x00,
+  0x18, 0x4f, 0xa6, 0x99, 0x1c, 0x00, 0xe3, 0xc9, 0x34, 0x29, 0x00, 0x60, 0x3c, 0x99, 0x26, 0x2d,
+  0x04, 0x8c, 0x27, 0xd3, 0xa4, 0xc9, 0x9d, 0xf1, 0x64, 0xa2, 0x85, 0x00, 0x30, 0x9e, 0x4c, 0x34,
+  0xb9, 0x03, 0xc6, 0x93, 0x89, 0xa6, 0x57, 0xe7, 0x78, 0x32, 0xd9, 0xe4, 0x0e, 0x18, 0x4f, 0xae,
+  0x42, 0x00, 0x00, 0xe3, 0xc9, 0x55, 0x26, 0x05, 0x60, 0x3c, 0xb9, 0x66, 0x72, 0x07, 0x8c, 0x27,
+  0xd9, 0xbb, 0x85, 0x80, 0xf1, 0x64, 0x0b, 0x82, 0x01, 0x30, 0x9e, 0x6c, 0x85, 0x00, 0x00, 0xc6,
+  0x93, 0x8e, 0x16, 0x02, 0xc0, 0x78, 0xf2, 0x8d, 0xe4, 0x0e, 0x18, 0x4f, 0x3e, 0x02, 0x00, 0x00,
+  0xe3, 0xc9, 0xe7, 0x08, 0x00, 0x60, 0x3c, 0xf9, 0x5c, 0x1a, 0x00, 0x8c, 0x27, 0x9f, 0x4b, 0x8e,
+  0x82, 0xf1, 0xe4, 0x93, 0x85, 0x00, 0x30, 0x9e, 0x7c, 0x32, 0x05, 0x06, 0xc6, 0x93, 0x6f, 0x16,
+  0x02, 0xc0, 0x78, 0xf2, 0x5d, 0x00, 0x00, 0x18, 0x4f, 0xbe, 0x5b, 0x00, 0x00, 0xe3, 0x49, 0x19,
+  0x66, 0x99, 0x60, 0x3c, 0x39, 0x67, 0x1a, 0x00, 0x8c, 0x27, 0x27, 0x4d, 0x8e, 0x82, 0xf1, 0x24,
+  0x0d, 0xee, 0x00, 0x30, 0x9e, 0xa4, 0x05, 0x00, 0x00, 0xc6, 0x93, 0xb4, 0x10, 0x00, 0xc0, 0x78,
+  0x92, 0x16, 0x47, 0x0b, 0x19, 0x4f, 0x52, 0x54, 0x08, 0x00, 0xe3, 0x49, 0x8a, 0x18, 0x00, 0x60,
+  0x3c, 0x49, 0x11, 0x2b, 0x04, 0x8c, 0x27, 0x69, 0x1a, 0x00, 0x80, 0xf1, 0x24, 0x4d, 0x04, 0x00,
+  0x30, 0x9e, 0xa4, 0x89, 0xbd, 0x3a, 0xc7, 0x93, 0x34, 0x39, 0x00, 0xc0, 0x78, 0x92, 0x26, 0x47,
+  0x0b, 0x19, 0x4f, 0xd2, 0x34, 0x93, 0x03, 0xe3, 0x49, 0x9a, 0x66, 0x72, 0x67, 0x3c, 0x59, 0x13,
+  0x01, 0x00, 0x8c, 0x27, 0x6d, 0x21, 0x00, 0x80, 0xf1, 0xa4, 0x4d, 0x03, 0x00, 0x30, 0x9e, 0xb4,
+  0xc9, 0x01, 0x00, 0xc6, 0x93, 0xd7, 0x1d, 0x00, 0xc0, 0x78, 0x32, 0x07, 0x06, 0x00, 0x18, 0x8f,
+  0x06, 0x97, 0xdc, 0x01, 0xe3, 0xd5, 0x22, 0x93, 0x3b, 0x60, 0xbc, 0xca, 0x8a, 0x03, 0x00, 0x8c,
+  0x57, 0x1d, 0x01, 0x00, 0x80, 0xf1, 0xaa, 0x23, 0x85, 0x00, 0x30, 0x5e, 0x75, 0xc9, 0x1d, 0x00,
+  0xc6, 0xab, 0x2e, 0xd1, 0xb4, 0xca, 0x78, 0xd5, 0xd1, 0xc0, 0x00, 0x18, 0xaf, 0x3a, 0x9a, 0x06,
+  0x00, 0xe3, 0x55, 0x47, 0x93, 0x3b, 0x60, 0xbc, 0xea, 0x28, 0x03, 0x00, 0x8c, 0x57, 0x1d, 0x65,
+  0x65, 0x82, 0xf1, 0xaa, 0xcb, 0x00, 0x00, 0x30, 0x5e, 0x95, 0xc1, 0x1d, 0x00, 0xc6, 0xab, 0x13,
+  0xa5, 0x11, 0xd8, 0x78, 0x75, 0xd2, 0xe4, 0x28, 0x18, 0xcf, 0x16, 0x00, 0x00, 0x00, 0xe3, 0xd9,
+  0x42, 0x00, 0x00, 0x60, 0x3c, 0x5b, 0xdc, 0x00, 0x00, 0x8c, 0x67, 0x8b, 0x2c, 0x04, 0x80, 0xf1,
+  0x6e, 0x21, 0x00, 0x00, 0x30, 0xde, 0x2d, 0xae, 0x00, 0x00, 0xc6, 0xbb, 0xac, 0xb8, 0xe4, 0xe8,
+  0x90, 0xc9, 0xd1, 0x42, 0x00, 0x18, 0xf2, 0x91, 0x44, 0x00, 0x00, 0x43, 0x3e, 0x47, 0x0b, 0x01,
+  0x60, 0xc8, 0x57, 0x93, 0xa3, 0x69, 0x8c, 0x2a, 0x1e, 0x2b, 0x04, 0x80, 0x51, 0x47, 0x01, 0x00,
+  0x00, 0x30, 0xea, 0x28, 0xae, 0x10, 0x00, 0x46, 0x1d, 0xc5, 0xd1, 0x34, 0xc0, 0xa8, 0xa3, 0x38,
+  0x9a, 0x1c, 0x18, 0xf5, 0x20, 0x5a, 0x08, 0x00, 0xa3, 0x26, 0x56, 0x00, 0x00, 0x60, 0xd4, 0xe4,
+  0x28, 0x00, 0x00, 0x8c, 0x9a, 0x1c, 0x4d, 0x03, 0x80, 0x51, 0x93, 0xa3, 0xc9, 0x1d, 0x30, 0x6a,
+  0x92, 0xc9, 0x25, 0x77, 0x46, 0x4d, 0x33, 0xb0, 0x42, 0xc0, 0xa8, 0x69, 0xa2, 0xe4, 0x0e, 0x18,
+  0x35, 0x4d, 0x5a, 0x08, 0x00, 0xa3, 0x32, 0x02, 0x00, 0x00, 0x60, 0x54, 0x66, 0x4c, 0x95, 0x85,
+  0x8c, 0xca, 0x18, 0x01, 0x00, 0x80, 0x51, 0x19, 0x2d, 0x04, 0x00, 0x30, 0x6a, 0x13, 0x0c, 0x00,
+  0x00, 0x46, 0x6d, 0x42, 0xbe, 0xca, 0xc0, 0xa8, 0x2d, 0xb1, 0x34, 0x00, 0x18, 0xb5, 0x25, 0x47,
+  0x00, 0x00, 0xa3, 0xb6, 0xe4, 0x0e, 0x00, 0x60, 0xd4, 0x96, 0x5e, 0x9d, 0x13, 0x8c, 0xda, 0x60,
+  0x01, 0x00, 0x80, 0x51, 0x1b, 0x4c, 0xee, 0x00, 0x30, 0x6a, 0x83, 0xcf, 0xd1, 0x34, 0x46, 0x75,
+  0x04, 0x00, 0x00, 0xc0, 0xa8, 0x8e, 0xb0, 0xe4, 0x0e, 0x18, 0xd5, 0xa5, 0x91, 0xdc, 0x01, 0xa3,
+  0xba, 0x49, 0x93, 0x03, 0x60, 0x54, 0x47, 0x69, 0x21, 0x00, 0x8c, 0x0a, 0x8b, 0x4b, 0xee, 0x80,
+  0x51, 0x65, 0x18, 0x69, 0x00, 0x30, 0xaa, 0x0c, 0xac, 0x10, 0x00, 0x46, 0x95, 0xc1, 0x15, 0x02,
+  0xc0, 0xa8, 0x32, 0xb8, 0x03, 0x00, 0x18, 0x55, 0x8e, 0xe4, 0x00, 0x00, 0xa3, 0x4a, 0x02, 0x00,
+  0x00, 0x60, 0x54, 0x49, 0x0a, 0x01, 0x00, 0x8c, 0x2a, 0x49, 0x71, 0xb4, 0x90, 0x51, 0x65, 0x01,
+  0x00, 0x00, 0x30, 0xaa, 0x2c, 0xad, 0x10, 0x00, 0x46, 0x95, 0xc5, 0x11, 0x00, 0xc0, 0xa8, 0xb2,
+  0xb8, 0xe2, 0x0e, 0x18, 0x55, 0x16, 0x47, 0x33, 0x00, 0xa3, 0xca, 0x22, 0x0b, 0x01, 0x60, 0x54,
+  0x99, 0x82, 0x03, 0x00, 0x8c, 0x2a, 0xd3, 0x28, 0x00, 0x80, 0x51, 0x65, 0x1a, 0x69, 0x00, 0x30,
+  0xaa, 0x4c, 0x0e, 0x00, 0x00, 0x46, 0x95, 0xc9, 0x11, 0x00, 0xc0, 0xa8, 0x32, 0xb9, 0x42, 0x00,
+  0x18, 0x55, 0x26, 0x77, 0xca, 0x04, 0xa3, 0xca, 0xe4, 0xd2, 0x00, 0x60, 0x54, 0x99, 0xdc, 0xab,
+  0x0c, 0x8c, 0x2a, 0x93, 0xa3, 0x00, 0x80, 0x51, 0x65, 0x72, 0xb4, 0x10, 0x30, 0xaa, 0x4c, 0x8e,
+  0xa6, 0x01, 0x46, 0x95, 0x69, 0x26, 0x77, 0xc0, 0xa8, 0x32, 0x4d, 0x5a, 0xdc, 0x19, 0x55, 0xb6,
+  0xe2, 0x0e, 0x00, 0xa3, 0xca, 0xe7, 0x08, 0x00, 0x60, 0x54, 0xf9, 0x5c, 0x21, 0x00, 0x8c, 0x2a,
+  0x9f, 0x2c, 0x04, 0x80, 0x51, 0xa5, 0x2c, 0x8e, 0x02, 0x30, 0xaa, 0xa4, 0x81, 0x16, 0x02, 0x46,
+  0x95, 0xb4, 0x10, 0x00, 0xc0, 0xa8, 0x92, 0x16, 0x77, 0x00, 0x18, 0x55, 0x52, 0x54, 0x08, 0x00,
+  0xa3, 0x4a, 0x9a, 0x1c, 0x00, 0x60, 0x54, 0x49, 0x93, 0xa3, 0x69, 0x8c, 0x2a, 0xa9, 0x0c, 0x0c,
+  0x80, 0x51, 0x27, 0x2a, 0x04, 0x00, 0x30, 0xea, 0x44, 0xc9, 0x51, 0x00, 0x46, 0x9d, 0x88, 0x32,
+  0x00, 0xc0, 0xa8, 0x33, 0x0d, 0x00, 0x00, 0x18, 0x75, 0x26, 0x96, 0x5e, 0x9d, 0xa3, 0xce, 0xe4,
+  0x08, 0x00, 0x60, 0xd4, 0x09, 0x01, 0x00, 0x00, 0x8c, 0x3a, 0x21, 0x4a, 0xee, 0x80, 0x51, 0x27,
+  0x05, 0x00, 0x00, 0x30, 0xea, 0xa4, 0x81, 0x52, 0x00, 0x46, 0x9d, 0xb4, 0x00, 0x00, 0xc0, 0xa8,
+  0x93, 0x16, 0x77, 0x00, 0x18, 0x75, 0x52, 0x54, 0x08, 0x00, 0xa3, 0x4e, 0x8a, 0xd2, 0x00, 0x60,
+  0xd4, 0x49, 0xd3, 0x00, 0x00, 0x8c, 0x3a, 0x69, 0x22, 0x00, 0x80, 0x51, 0x27, 0x4d, 0x2e, 0x30,
+  0x30, 0xea, 0xa4, 0xc9, 0x1d, 0x00, 0x46, 0x9d, 0x34, 0x39, 0x0a, 0xc0, 0xa8, 0x93, 0x56, 0x06,
+  0x00, 0x18, 0x75, 0xd6, 0x59, 0x08, 0x00, 0xa3, 0x52, 0x00, 0x00, 0x00, 0x60, 0x54, 0x1a, 0x1c,
+  0x01, 0x00, 0x8c, 0x4a, 0x83, 0x2c, 0x04, 0x80, 0x51, 0x69, 0x90, 0x45, 0x16, 0x32, 0x2a, 0x2d,
+  0x04, 0x00, 0x00, 0x46, 0xa5, 0x85, 0x01, 0x00, 0xc0, 0xa8, 0xb4, 0x38, 0x00, 0x00, 0x18, 0x95,
+  0x16, 0x57, 0x08, 0x00, 0xa3, 0x52, 0x04, 0x00, 0x00, 0x60, 0x54, 0x8a, 0x02, 0x05, 0x00, 0x8c,
+  0x4a, 0x51, 0x01, 0x00, 0x80, 0x51, 0x29, 0x2a, 0x04, 0x00, 0x30, 0x2a, 0x45, 0x85, 0x24, 0x47,
+  0x47, 0xa5, 0xa8, 0xb8, 0xc0, 0xc0, 0xa8, 0x14, 0x15, 0x77, 0x00, 0x18, 0x95, 0xa2, 0x22, 0x0b,
+  0x01, 0xa3, 0x52, 0x94, 0xdc, 0x01, 0x60, 0x54, 0x8a, 0x92, 0xa3, 0x85, 0x8c, 0x4a, 0x51, 0x9a,
+  0x85, 0x80, 0x51, 0x29, 0x4a, 0x93, 0x02, 0x30, 0x2a, 0x45, 0xb4, 0x10, 0x00, 0x46, 0xa5, 0x88,
+  0x96, 0x39, 0xc1, 0xa8, 0x14, 0xd1, 0xc4, 0x0a, 0x19, 0x95, 0xa6, 0x11, 0x64, 0x60, 0xa3, 0xd2,
+  0x34, 0x50, 0x21, 0x60, 0x54, 0x9a, 0x46, 0x1a, 0x00, 0x8c, 0x4a, 0x13, 0x01, 0x00, 0x80, 0x51,
+  0x69, 0x72, 0x04, 0x00, 0x30, 0x2a, 0x4d, 0xae, 0x10, 0x00, 0x46, 0xa5, 0x69, 0x52, 0x00, 0xc0,
+  0xa8, 0x34, 0xd9, 0x57, 0x19, 0x18, 0x95, 0xca, 0xe4, 0x0e, 0x00, 0xa3, 0x52, 0xf9, 0xe4, 0xab,
+  0x73, 0x54, 0x4a, 0x8b, 0x03, 0x00, 0x8c, 0x4a, 0x69, 0x71, 0x07, 0x80, 0x51, 0x69, 0x25, 0x00,
+  0x00, 0x30, 0x2a, 0xae, 0xb2, 0x10, 0x00, 0x46, 0x1e, 0x61, 0x01, 0x00, 0xc0, 0xc8, 0x23, 0xc8,
+  0x42, 0x00, 0x18, 0x79, 0x14, 0x57, 0x08, 0x00, 0x23, 0x8f, 0xe2, 0x68, 0x72, 0x67, 0xe4, 0x91,
+  0x08, 0x2b, 0x04, 0x8c, 0xec, 0x28, 0x62, 0x85, 0x80, 0x91, 0x65, 0x70, 0x14, 0x00, 0x30, 0xb2,
+  0x0c, 0x34, 0xb9, 0x03, 0x46, 0x96, 0x04, 0x00, 0x00, 0xc0, 0xc8, 0xb2, 0x38, 0x02, 0x00, 0x18,
+  0x59, 0x16, 0x47, 0x0b, 0x01, 0x23, 0xcb, 0x44, 0x00, 0x00, 0x60, 0x64, 0xf9, 0x6a, 0x1a, 0x00,
+  0x8c, 0x2c, 0x27, 0x2a, 0x04, 0x80, 0x91, 0x27, 0x2d, 0x04, 0x00, 0x30, 0xf2, 0xa4, 0xc9, 0x1d,
+  0x00, 0x46, 0x9e, 0x34, 0xcd, 0x42, 0xc0, 0xc8, 0x34, 0x2c, 0x00, 0x00, 0x18, 0x99, 0xa2, 0xe4,
+  0x00, 0x00, 0x23, 0xd3, 0x24, 0x0b, 0x01, 0x60, 0x64, 0x2a, 0xcb, 0xa4, 0x85, 0x8c, 0xac, 0x75,
+  0xa2, 0x45, 0x82, 0x91, 0xb5, 0x66, 0x85, 0x00, 0x40, 0xc2, 0x49, 0x03, 0x00, 0x00, 0x48, 0x60,
+  0x04, 0x00, 0x00, 0x00, 0x09, 0x8c, 0x14, 0x00, 0x00, 0x20, 0x81, 0x91, 0x0b, 0x00, 0x00, 0x24,
+  0xb0, 0xe4, 0x08, 0x00, 0x80, 0x04, 0x96, 0x5c, 0x1a, 0x00, 0x90, 0xc0, 0x92, 0xa3, 0xc9, 0x1d,
+  0x12, 0x58, 0x92, 0xc9, 0x1d, 0x40, 0x02, 0x7b, 0xad, 0x00, 0x00, 0x48, 0x60, 0x4f, 0x26, 0x77,
+  0x00, 0x09, 0x8c, 0x16, 0x99, 0x06, 0x20, 0x81, 0x51, 0x0a, 0x00, 0x00, 0x24, 0xb0, 0x0c, 0x00,
+  0x00, 0x80, 0x84, 0x56, 0x00, 0x00, 0x00, 0x90, 0xe0, 0x02, 0x23, 0x00, 0x00, 0x12, 0x1c, 0x29,
+  0x04, 0x00, 0x40, 0x82, 0x23, 0xc5, 0x54, 0x06, 0x48, 0x70, 0x24, 0xb9, 0x03, 0x00, 0x09, 0x8e,
+  0xc8, 0x42, 0x00, 0x20, 0xc1, 0x95, 0x81, 0x0a, 0x01, 0x24, 0xb8, 0xe2, 0x08, 0x00, 0x80, 0x04,
+  0x57, 0x1c, 0x4d, 0x03, 0x90, 0xe0, 0xd2, 0x4c, 0xee, 0x00, 0x12, 0x60, 0x01, 0x00, 0x00, 0x40,
+  0x02, 0x2c, 0x6e, 0x52, 0x00, 0x48, 0x80, 0x69, 0xa4, 0x11, 0x18, 0x09, 0x50, 0x26, 0x47, 0x01,
+  0x20, 0x41, 0x06, 0x59, 0x08, 0x00, 0x24, 0xc8, 0x02, 0x00, 0x00, 0x80, 0x04, 0x59, 0x08, 0x00,
+  0x00, 0x90, 0x20, 0x8b, 0x23, 0x00, 0x00, 0x12, 0x64, 0x71, 0x85, 0x00, 0x40, 0x82, 0x2c, 0x2e,
+  0x39, 0x00, 0x48, 0x90, 0xc5, 0xd1, 0x42, 0x00, 0x09, 0x32, 0x8d, 0x34, 0x00, 0x20, 0x41, 0xa6,
+  0x91, 0xdc, 0x01, 0x24, 0xc8, 0x44, 0x00, 0x00, 0x80, 0x04, 0x99, 0x4e, 0x21, 0x00, 0x90, 0x20,
+  0x93, 0x23, 0x00, 0x00, 0x12, 0x64, 0x72, 0x14, 0x00, 0x40, 0x82, 0x4c, 0x93, 0x16, 0x02, 0x48,
+  0x90, 0xab, 0x10, 0x00, 0x00, 0x09, 0xf2, 0xb1, 0x03, 0x00, 0x20, 0x41, 0xbe, 0x56, 0x08, 0x00,
+  0x24, 0xc8, 0x27, 0x0b, 0x01, 0x80, 0x04, 0x49, 0x0b, 0x00, 0x00, 0x90, 0x20, 0x69, 0x72, 0x07,
+  0x00, 0x12, 0x24, 0xad, 0xb2, 0x10, 0x40, 0xc2, 0x84, 0x4f, 0x16, 0x02, 0x48, 0x98, 0xb4, 0x10,
+  0x00, 0x00, 0x09, 0xb4, 0xb0, 0x54, 0x08, 0x20, 0x81, 0xa2, 0xe2, 0x02, 0x03, 0x24, 0x50, 0x44,
+  0x0b, 0x01, 0x80, 0x04, 0x9a, 0x58, 0x06, 0x00, 0x90, 0x40, 0x9f, 0x2c, 0x04, 0x00, 0x12, 0x6a,
+  0x0b, 0x04, 0x00, 0x40, 0x42, 0x75, 0x04, 0x00, 0x00, 0x48, 0xa8, 0x2e, 0xb9, 0x03, 0x00, 0x09,
+  0xd5, 0xa5, 0x99, 0x06, 0x20, 0xa1, 0xce, 0xe2, 0x0e, 0x00, 0x24, 0xd4, 0x49, 0x0b, 0x01, 0x80,
+  0x84, 0x4a, 0x51, 0x21, 0x00, 0x90, 0x60, 0x8b, 0x3b, 0x00, 0x00, 0x12, 0x6c, 0x71, 0x34, 0x0d,
+  0x40, 0x82, 0x2d, 0x8e, 0x26, 0x47, 0x49, 0xb0, 0xc9, 0xd1, 0x42, 0x00, 0x29, 0x61, 0x04, 0x77,
+  0x00, 0x20, 0x25, 0x8c, 0x42, 0x00, 0x00, 0xa4, 0x84, 0x51, 0x1c, 0x00, 0x80, 0x94, 0x30, 0x8a,
+  0x3b, 0x00, 0x90, 0x12, 0x46, 0x71, 0xc9, 0x1d, 0x52, 0xc2, 0x28, 0xb2, 0x10, 0x40, 0x4a, 0x18,
+  0x45, 0xa6, 0x01, 0x48, 0x09, 0x03, 0xa5, 0x01, 0x00, 0x29, 0x61, 0xa0, 0xe4, 0x0e, 0x20, 0x25,
+  0x0c, 0xc4, 0x92, 0x3b, 0xa4, 0x84, 0x91, 0x08, 0x00, 0x80, 0x94, 0x30, 0x92, 0xa9, 0x13, 0x90,
+  0x12, 0x46, 0x72, 0x07, 0x00, 0x52, 0xc2, 0x48, 0xb6, 0x00, 0x40, 0x4a, 0x18, 0x34, 0x0d, 0x00,
+  0x48, 0x09, 0x23, 0x03, 0x00, 0x00, 0x29, 0x81, 0x00, 0x00, 0x00, 0x20, 0x25, 0x90, 0x12, 0x68,
+  0x21, 0xa4, 0x04, 0x52, 0xdc, 0x01, 0x80, 0x94, 0x40, 0x58, 0x21, 0x00, 0x90, 0x12, 0xc8, 0xa4,
+  0x69, 0x00, 0x52, 0x82, 0xa9, 0xc9, 0x1d, 0x40, 0x4a, 0x38, 0x00, 0x00, 0x00, 0x48, 0x09, 0x27,
+  0x50, 0x00, 0x00, 0x29, 0xe1, 0x14, 0x00, 0x00, 0x20, 0x25, 0x9c, 0x42, 0x00, 0x00, 0xa4, 0x84,
+  0x53, 0xdc, 0x01, 0x80, 0x94, 0x70, 0x8a, 0x2c, 0x04, 0x90, 0x12, 0x4e, 0x91, 0xc9, 0x1d, 0x52,
+  0xc2, 0x29, 0x33, 0xb9, 0x43, 0x4a, 0x38, 0x08, 0x00, 0x00, 0x48, 0x09, 0x07, 0x15, 0x00, 0x00,
+  0x29, 0xe1, 0xa0, 0x42, 0x00, 0x20, 0x25, 0x1c, 0x94, 0x02, 0x03, 0xa4, 0x84, 0x93, 0x06, 0x00,
+  0x80, 0x94, 0x70, 0xd2, 0x2c, 0x04, 0x90, 0x12, 0x4e, 0x9a, 0xb4, 0x10, 0x52, 0xc2, 0x79, 0xee,
+  0x00, 0x40, 0x4a, 0x38, 0x55, 0x16, 0x00, 0x48, 0x09, 0xa7, 0xca, 0x42, 0x00, 0x29, 0x21, 0x8d,
+  0x20, 0x0b, 0x21, 0x25, 0x24, 0x57, 0x08, 0x00, 0xa4, 0x84, 0x34, 0x29, 0x00, 0x80, 0x94, 0x90,
+  0x66, 0x06, 0x00, 0x90, 0x12, 0x56, 0x72, 0x00, 0x00, 0x52, 0x02, 0x23, 0x00, 0x00, 0x40, 0x4a,
+  0x60, 0xa4, 0x10, 0x00, 0x48, 0x09, 0x8c, 0xa4, 0x01, 0x00, 0x29, 0x81, 0x11, 0x56, 0x08, 0x20,
+  0x25, 0xb0, 0x02, 0x00, 0x00, 0xa4, 0x04, 0x56, 0x08, 0x00, 0x80, 0x94, 0xc0, 0x8a, 0x03, 0x00,
+  0x90, 0x12, 0x58, 0x71, 0x81, 0x01, 0x52, 0x02, 0x2b, 0xee, 0x00, 0x40, 0x4a, 0x60, 0xc5, 0xd1,
+  0x34, 0x48, 0x09, 0xac, 0x48, 0x02, 0x00, 0x29, 0x81, 0x15, 0x59, 0x08, 0x20, 0x25, 0xb0, 0x22,
+  0x93, 0x3b, 0xa4, 0x04, 0x56, 0x64, 0x06, 0x80, 0x94, 0xc0, 0xca, 0x4c, 0xee, 0x90, 0x12, 0x58,
+  0x72, 0x07, 0x00, 0x52, 0x02, 0x4b, 0x8e, 0x02, 0x40, 0x4a, 0x60, 0x2c, 0x39, 0x0a, 0x48, 0x09,
+  0xec, 0xc9, 0x42, 0x00, 0x29, 0x81, 0x3d, 0x0a, 0x00, 0x20, 0x25, 0xb0, 0x57, 0x5f, 0x9d, 0xa4,
+  0x04, 0xf6, 0xea, 0x9c, 0x80, 0x94, 0xc0, 0xde, 0x2d, 0x04, 0x90, 0x12, 0x18, 0x4d, 0xaf, 0x4e,
+  0x52, 0x42, 0x03, 0x00, 0x00, 0x40, 0x4a, 0x68, 0x81, 0x15, 0x02, 0x48, 0x09, 0x2d, 0xb8, 0x03,
+  0x00, 0x29, 0xa1, 0x05, 0x59, 0x08, 0x20, 0x25, 0xb4, 0x40, 0x0b, 0x01, 0xa4, 0x84, 0x56, 0x08,
+  0x00, 0x80, 0x94, 0xd0, 0x8a, 0x3b, 0x00, 0x90, 0x12, 0x5a, 0x71, 0x14, 0x00, 0x52, 0x42, 0x2b,
+  0x32, 0x30, 0x40, 0x4a, 0x68, 0x45, 0x16, 0x02, 0x48, 0x09, 0x2d, 0x0d, 0x0a, 0x00, 0x29, 0xa1,
+  0x25, 0x02, 0x00, 0x20, 0x25, 0xb4, 0x34, 0x29, 0x00, 0xa4, 0x84, 0xc6, 0x92, 0x3b, 0x80, 0x94,
+  0xd0, 0x5e, 0x95, 0x85, 0x90, 0x12, 0x1c, 0x01, 0x00, 0x00, 0x52, 0x82, 0x23, 0xac, 0xcc, 0x49,
+  0x4a, 0x70, 0xa7, 0x00, 0x00, 0x48, 0x09, 0xee, 0x14, 0x02, 0x00, 0x29, 0xc1, 0x25, 0x02, 0x00,
+  0x20, 0x25, 0xb8, 0xe4, 0x0e, 0x00, 0xa4, 0x04, 0x97, 0x26, 0x2a, 0x84, 0x94, 0xe0, 0x28, 0x00,
+  0x00, 0x90, 0x12, 0x1c, 0x0d, 0x0c, 0x00, 0x52, 0x82, 0xa3, 0x05, 0x00, 0x40, 0x4a, 0x70, 0xb4,
+  0x10, 0x00, 0x48, 0x09, 0x8e, 0x16, 0x59, 0x00, 0x29, 0xc1, 0xd1, 0x34, 0x00, 0x20, 0x25, 0x38,
+  0x9a, 0x1c, 0x00, 0xa4, 0x04, 0x47, 0x93, 0x3b, 0x80, 0x94, 0xe0, 0x68, 0x7a, 0x75, 0x92, 0x12,
+  0x1c, 0x4d, 0x13, 0x00, 0x52, 0x82, 0xa3, 0x2c, 0x30, 0x40, 0x4a, 0x70, 0x94, 0x15, 0x02, 0x48,
+  0x09, 0x2e, 0x03, 0x00, 0x00, 0x29, 0x01, 0x86, 0x01, 0x00, 0x20, 0x25, 0xc0, 0x40, 0x93, 0x03,
+  0xa4, 0x04, 0x58, 0x08, 0x00, 0x80, 0x94, 0x00, 0x91, 0xa9, 0x0c, 0x90, 0x12, 0x20, 0x62, 0xc5,
+  0x51, 0x52, 0x02, 0x4c, 0xa6, 0x32, 0x40, 0x4a, 0x80, 0xc9, 0x01, 0x00, 0x48, 0x09, 0x30, 0xcd,
+  0x34, 0x00, 0x29, 0x01, 0xca, 0xe4, 0x02, 0x23, 0x25, 0xc0, 0x0c, 0x00, 0x00, 0xa4, 0x04, 0x09,
+  0x00, 0x00, 0x80, 0x94, 0x20, 0x83, 0x48, 0x03, 0x90, 0x12, 0x64, 0x18, 0x00, 0x00, 0x52, 0x82,
+  0x0c, 0x04, 0x00, 0x40, 0x4a, 0x90, 0x81, 0x01, 0x00, 0x48, 0x09, 0x32, 0xb0, 0x42, 0x00, 0x29,
+  0x41, 0x06, 0x96, 0x02, 0x23, 0x25, 0xc8, 0xe0, 0x00, 0x00, 0xa4, 0x04, 0x19, 0xdc, 0x01, 0x80,
+  0x94, 0x20, 0x83, 0xa3, 0x00, 0x90, 0x12, 0x64, 0x90, 0x85, 0x00, 0x52, 0x82, 0x0c, 0xb2, 0x4c,
+  0x40, 0x4a, 0x90, 0x81, 0x16, 0x02, 0x48, 0x09, 0x32, 0xd0, 0x34, 0x00, 0x29, 0x41, 0x06, 0x9a,
+  0x1c, 0x20, 0x25, 0xc8, 0x40, 0x65, 0x01, 0xa4, 0x04, 0x29, 0x18, 0x00, 0x80, 0x94, 0x20, 0x05,
+  0x2b, 0x04, 0x90, 0x12, 0x64, 0x01, 0x00, 0x00, 0x52, 0x82, 0x2c, 0x04, 0x00, 0x40, 0x4a, 0x90,
+  0xc5, 0x01, 0x00, 0x48, 0x09, 0xb2, 0xb8, 0x03, 0x00, 0x29, 0x41, 0x16, 0x97, 0x06, 0x20, 0x25,
+  0xc8, 0xe2, 0x92, 0x3b, 0xa4, 0x04, 0x59, 0x1c, 0x05, 0x80, 0x94, 0x20, 0x8b, 0xa3, 0x85, 0x90,
+  0x12, 0x64, 0x91, 0x81, 0x01, 0x52, 0x82, 0x2c, 0xb2, 0x10, 0x40, 0x4a, 0x90, 0x45, 0xbe, 0x67,
+  0x48, 0x09, 0xb2, 0xc8, 0x57, 0x27, 0x29, 0x41, 0xa6, 0x01, 0x00, 0x20, 0x25, 0xc8, 0x34, 0x0a,
+  0x01, 0xa4, 0x04, 0x99, 0x08, 0x00, 0x80, 0x94, 0x20, 0x93, 0xa9, 0x0c, 0x90, 0x12, 0x64, 0x32,
+  0x75, 0x4e, 0x52, 0x82, 0x4c, 0x0e, 0x00, 0x40, 0x4a, 0x90, 0xc9, 0x1d, 0x00, 0x48, 0x09, 0x32,
+  0xb9, 0xe4, 0x0e, 0x29, 0x41, 0x26, 0x97, 0x1c, 0x25, 0x25, 0xc8, 0xe4, 0x28, 0x00, 0xa4, 0x04,
+  0x99, 0x1c, 0x2d, 0x80, 0x94, 0x20, 0x93, 0xa3, 0x69, 0x90, 0x12, 0x64, 0x7a, 0xad, 0x10, 0x52,
+  0x82, 0x4c, 0x4f, 0x06, 0x46, 0x4a, 0x90, 0xe9, 0xd5, 0x09, 0x48, 0x09, 0x32, 0xcd, 0x42, 0x00,
+  0x29, 0x41, 0xa6, 0x49, 0x0b, 0x20, 0x25, 0xc8, 0x44, 0xd3, 0x00, 0xa4, 0x04, 0x99, 0x6c, 0x72,
+  0x87, 0x94, 0x20, 0x19, 0x00, 0x00, 0x90, 0x12, 0x24, 0x2b, 0x04, 0x00, 0x52, 0x82, 0x64, 0x69,
+  0x00, 0x40, 0x4a, 0x90, 0xad, 0x10, 0x00, 0x48, 0x09, 0xd2, 0x9d, 0x42, 0x00, 0x29, 0x41, 0x3a,
+  0x5a, 0x08, 0x20, 0x25, 0xc8, 0xc7, 0x00, 0x00, 0xa4, 0x04, 0xf9, 0x5a, 0x21, 0x80, 0x94, 0x20,
+  0x9f, 0x03, 0x00, 0x90, 0x12, 0xe4, 0x93, 0x04, 0x00, 0x52, 0x82, 0x7c, 0xb2, 0x10, 0x40, 0x4a,
+  0x90, 0x4f, 0x26, 0x77, 0x48, 0x09, 0xf2, 0xc9, 0x57, 0x27, 0x29, 0x41, 0x3e, 0x9a, 0xdc, 0x21,
+  0x25, 0xc8, 0x57, 0x27, 0x00, 0xa4, 0x04, 0xf9, 0xea, 0x9c, 0x80, 0x94, 0x20, 0x65, 0x70, 0x07,
+  0x90, 0x12, 0xa4, 0x2c, 0x04, 0x00, 0x52, 0x82, 0xa4, 0x00, 0x00, 0x40, 0x4a, 0x90, 0xb4, 0x10,
+  0x00, 0x48, 0x09, 0x92, 0x26, 0x77, 0x00, 0x29, 0x41, 0xd6, 0x34, 0x00, 0x20, 0x25, 0xc8, 0x0c,
+  0x00, 0x00, 0xa4, 0x84, 0x19, 0x18, 0x00, 0x80, 0x94, 0x30, 0x03, 0x4b, 0xee, 0x90, 0x12, 0x66,
+  0xa0, 0x85, 0x00, 0x52, 0xc2, 0x2c, 0x00, 0x00, 0x40, 0x4a, 0x98, 0x85, 0x00, 0x00, 0x48, 0x09,
+  0xb3, 0xb8, 0x03, 0x00, 0x29, 0x61, 0x96, 0x99, 0x1c, 0x25, 0x25, 0x4c, 0x04, 0x00, 0x00, 0xa4,
+  0x84, 0x89, 0x0a, 0x00, 0x80, 0x94, 0x30, 0x51, 0x21, 0x00, 0x90, 0x12, 0x26, 0x4a, 0x03, 0x00,
+  0x52, 0xc2, 0x44, 0xc9, 0x1d, 0x40, 0x4a, 0x98, 0x28, 0x39, 0x0a, 0x48, 0x09, 0x13, 0x31, 0x00,
+  0x00, 0x29, 0x61, 0x22, 0x9a, 0x1c, 0x20, 0x25, 0x4c, 0x44, 0x93, 0x3b, 0xa4, 0x84, 0x89, 0xa8,
+  0x2c, 0x84, 0x94, 0x30, 0x17, 0x00, 0x00, 0x90, 0x12, 0xe6, 0x6b, 0xc9, 0x1d, 0x52, 0xc2, 0x7c,
+  0xee, 0x00, 0x40, 0x4a, 0x98, 0xcf, 0xd1, 0x34, 0x48, 0x09, 0xf3, 0x49, 0x02, 0x00, 0x29, 0x61,
+  0x3e, 0x59, 0x08, 0x20, 0x25, 0xcc, 0x27, 0xd3, 0x2a, 0xa4, 0x84, 0xf9, 0x2a, 0x03, 0x80, 0x94,
+  0x30, 0x5f, 0x9d, 0x00, 0x90, 0x12, 0xe6, 0xcb, 0x00, 0x00, 0x52, 0xc2, 0x84, 0xc9, 0x1d, 0x40,
+  0x4a, 0x98, 0x90, 0xa6, 0xc0, 0x48, 0x09, 0x73, 0x16, 0x02, 0x00, 0x29, 0x61, 0xce, 0x34, 0x00,
+  0x20, 0x25, 0xcc, 0x99, 0x46, 0x60, 0xa4, 0x84, 0x39, 0x93, 0x3b, 0x80, 0x94, 0x30, 0x27, 0x4d,
+  0x03, 0x90, 0x12, 0xe6, 0xa4, 0xc9, 0x1d, 0x52, 0xc2, 0x9c, 0x34, 0x39, 0x4a, 0x4a, 0x98, 0x14,
+  0x00, 0x00, 0x48, 0x09, 0x93, 0x16, 0x00, 0x00, 0x29, 0x61, 0xd2, 0x42, 0x00, 0x20, 0x25, 0x4c,
+  0x9a, 0x02, 0x03, 0xa4, 0x84, 0x49, 0xd3, 0x00, 0x80, 0x94, 0x30, 0x69, 0x1a, 0x81, 0x91, 0x12,
+  0x26, 0x4d, 0x0e, 0x00, 0x52, 0xc2, 0xa4, 0xc9, 0x1d, 0x40, 0x4a, 0x98, 0x34, 0xd9, 0x42, 0x48,
+  0x09, 0x93, 0xb2, 0x42, 0x00, 0x29, 0x61, 0x52, 0x96, 0x01, 0x20, 0x25, 0x4c, 0x9a, 0x01, 0x00,
+  0xa4, 0x04, 0x0a, 0x00, 0x00, 0x80, 0x94, 0x40, 0x03, 0x2b, 0x04, 0x90, 0x12, 0x68, 0xa0, 0x69,
+  0x00, 0x52, 0x02, 0x2d, 0x00, 0x00, 0x40, 0x4a, 0xa0, 0x85, 0x00, 0x00, 0x48, 0x09, 0xb4, 0x90,
+  0xe4, 0x28, 0x29, 0x81, 0x16, 0x56, 0x08, 0x20, 0x25, 0xd0, 0xe2, 0x00, 0x00, 0xa4, 0x04, 0x5a,
+  0x5c, 0x21, 0x80, 0x94, 0x40, 0x8b, 0x3b, 0x00, 0x90, 0x12, 0x68, 0x71, 0x14, 0x00, 0x52, 0x02,
+  0x2d, 0x12, 0x00, 0x40, 0x4a, 0xa0, 0xa8, 0x00, 0x00, 0x48, 0x09, 0x14, 0x15, 0x02, 0x00, 0x29,
+  0x81, 0xa2, 0x34, 0x00, 0x20, 0x25, 0x50, 0x94, 0x46, 0x60, 0xa4, 0x04, 0x8a, 0x92, 0x3b, 0x80,
+  0x94, 0x40, 0x11, 0x05, 0x00, 0x90, 0x12, 0x28, 0xa2, 0x85, 0x00, 0x52, 0x02, 0x4d, 0x03, 0x00,
+  0x40, 0x4a, 0xa0, 0x69, 0x04, 0x06, 0x48, 0x09, 0x34, 0x8d, 0x42, 0x00, 0x29, 0x81, 0x26, 0x07,
+  0x00, 0x20, 0x25, 0xd0, 0xe4, 0x02, 0x03, 0xa4, 0x04, 0x9a, 0x5c, 0x21, 0x80, 0x94, 0x40, 0x93,
+  0x3b, 0x00, 0x90, 0x12, 0x68, 0x72, 0x14, 0x00, 0x52, 0x02, 0x4d, 0x8e, 0xa6, 0x41, 0x4a, 0xa0,
+  0x49, 0x26, 0x77, 0x48, 0x09, 0x34, 0x4d, 0x0a, 0x00, 0x29, 0x81, 0x26, 0x5a, 0x08, 0x20, 0x25,
+  0xd0, 0x64, 0x0b, 0x01, 0xa4, 0x04, 0xca, 0x0a, 0x01, 0x80, 0x94, 0x40, 0x5f, 0x9d, 0x13, 0x90,
+  0x12, 0xa8, 0x2c, 0x04, 0x00, 0x52, 0x02, 0xa5, 0x69, 0x00, 0x40, 0x4a, 0xa0, 0x54, 0xbe, 0x3a,
+  0x49, 0x09, 0xb4, 0xca, 0x32, 0x27, 0x29, 0x81, 0x56, 0x99, 0x1c, 0x25, 0x25, 0xd0, 0x2a, 0x5f,
+  0x9d, 0xa4, 0x04, 0x9a, 0x01, 0x00, 0x80, 0x94, 0x60, 0x0b, 0x00, 0x00, 0x90, 0x12, 0x6c, 0x21,
+  0x00, 0x00, 0x52, 0x82, 0x2d, 0x0e, 0x00, 0x40, 0x4a, 0xb0, 0x45, 0xba, 0x03, 0x48, 0x09, 0x36,
+  0xcd, 0xe2, 0x28, 0x29, 0x01, 0xa7, 0x49, 0x0b, 0x21, 0x25, 0xe0, 0x34, 0x69, 0x1a, 0xa4, 0x84,
+  0x0c, 0x00, 0x00, 0x80, 0x94, 0xa0, 0x83, 0x3b, 0x00, 0x90, 0x12, 0x74, 0x21, 0x00, 0x00, 0x52,
+  0x82, 0x2e, 0x0e, 0x00, 0x40, 0x4a, 0xd0, 0x19, 0x00, 0x00, 0x48, 0x11, 0x4f, 0xa6, 0x01, 0x00,
+  0x29, 0xe2, 0xc9, 0xe4, 0x0e, 0x20, 0x45, 0xc8, 0xe2, 0x28, 0x00, 0xa4, 0x8c, 0x20, 0x00, 0x00,
+  0x80, 0x94, 0x11, 0x18, 0x00, 0x00, 0x90, 0x32, 0x02, 0x2b, 0x04, 0x00, 0x52, 0x46, 0x60, 0x29,
+  0x30, 0x40, 0xca, 0x08, 0x2d, 0x0d, 0x00, 0x48, 0x19, 0xc1, 0x11, 0x00, 0x00, 0x29, 0x23, 0xb8,
+  0x42, 0x00, 0x20, 0x65, 0x04, 0x77, 0x00, 0x00, 0xa4, 0x8c, 0xe0, 0xd2, 0x00, 0x80, 0x94, 0x11,
+  0x5c, 0x72, 0x07, 0x90, 0x32, 0x82, 0x4b, 0xaf, 0x4e, 0x52, 0x46, 0x70, 0x14, 0x00, 0x40, 0xca,
+  0x08, 0x8e, 0xa6, 0x01, 0x48, 0x19, 0x41, 0x12, 0x00, 0x00, 0x29, 0x23, 0xc8, 0x42, 0x00, 0x20,
+  0x65, 0x04, 0xf9, 0x2a, 0x03, 0xa4, 0x8c, 0x02, 0x00, 0x00, 0x80, 0x94, 0x51, 0x08, 0x00, 0x00,
+  0x90, 0x32, 0x0a, 0x49, 0x03, 0x00, 0x52, 0x46, 0x21, 0x0c, 0x00, 0x40, 0xca, 0x28, 0xac, 0x10,
+  0x00, 0x48, 0x19, 0x85, 0xa5, 0x01, 0x00, 0x29, 0xa3, 0x38, 0x00, 0x00, 0x20, 0x65, 0x14, 0x37,
+  0x00, 0x00, 0xa4, 0x8c, 0xe2, 0x08, 0x00, 0x80, 0x94, 0x51, 0xdc, 0x01, 0x00, 0x90, 0x32, 0x8a,
+  0x3b, 0x85, 0x00, 0x52, 0x46, 0x71, 0x69, 0x00, 0x40, 0xca, 0x28, 0x2e, 0x39, 0x00, 0x48, 0x19,
+  0xc5, 0x25, 0x77, 0x00, 0x29, 0xa3, 0xb8, 0x57, 0x19, 0x20, 0x65, 0x14, 0x47, 0x01, 0x00, 0xa4,
+  0x8c, 0xe2, 0x68, 0x21, 0x80, 0x94, 0x51, 0x1c, 0x4d, 0x81, 0x91, 0x32, 0x8a, 0xa3, 0x69, 0x15,
+  0x52, 0x46, 0x71, 0x34, 0xb9, 0x43, 0xca, 0x28, 0x8e, 0x26, 0x47, 0x49, 0x19, 0x05, 0x66, 0x00,
+  0x00, 0x29, 0xa3, 0xc8, 0xe0, 0x0e, 0x20, 0x65, 0x14, 0x19, 0x28, 0x00, 0xa4, 0x8c, 0x22, 0x07,
+  0x00, 0x80, 0x94, 0x51, 0x64, 0x21, 0x00, 0x90, 0x32, 0x8a, 0x4c, 0x03, 0x00, 0x52, 0x46, 0x91,
+  0xc9, 0x01, 0x40, 0xca, 0x28, 0x32, 0xb9, 0x03, 0x48, 0x19, 0x45, 0xa6, 0x57, 0x27, 0x29, 0xa3,
+  0xc8, 0x64, 0x0b, 0x20, 0x65, 0x14, 0xf9, 0x64, 0x21, 0xa4, 0x8c, 0x22, 0x33, 0x00, 0x80, 0x94,
+  0x51, 0x66, 0x72, 0x07, 0x90, 0x32, 0xca, 0xa4, 0x69, 0x00, 0x52, 0x06, 0x2a, 0x33, 0xad, 0x42,
+  0xca, 0x40, 0x69, 0x00, 0x00, 0x48, 0x19, 0x69, 0x00, 0x00, 0x00, 0x29, 0x23, 0x8d, 0x42, 0x00,
+  0x20, 0x65, 0xa4, 0x91, 0x06, 0x00, 0xa4, 0x8c, 0x34, 0x92, 0x3b, 0x80, 0x94, 0x91, 0x48, 0x21,
+  0x00, 0x90, 0x32, 0x12, 0x61, 0x05, 0x00, 0x52, 0x46, 0x62, 0x85, 0x00, 0x40, 0xca, 0x48, 0xae,
+  0x10, 0x00, 0x48, 0x19, 0xc9, 0x25, 0x77, 0x00, 0x29, 0x23, 0x4d, 0x44, 0x01, 0x20, 0x65, 0xac,
+  0x22, 0x0b, 0x01, 0xa4, 0x0c, 0x46, 0x00, 0x00, 0x80, 0x94, 0xf1, 0x04, 0x2b, 0x04, 0x90, 0x32,
+  0x1e, 0x4b, 0x03, 0x00, 0x52, 0xc6, 0x63, 0xc9, 0x1d, 0x40, 0xca, 0x78, 0x2d, 0xbd, 0x3a, 0x49,
+  0x19, 0xcf, 0x11, 0x00, 0x00, 0x29, 0xe3, 0xb9, 0x03, 0x00, 0x20, 0x65, 0x3c, 0x47, 0x01, 0x00,
+  0xa4, 0x8c, 0xe7, 0x68, 0x72, 0x94, 0x94, 0xf1, 0x62, 0x9d, 0x00, 0x90, 0x32, 0x9e, 0x24, 0x00,
+  0x00, 0x52, 0xc6, 0x93, 0x85, 0x00, 0x40, 0xca, 0x78, 0x32, 0xb9, 0x03, 0x48, 0x19, 0x4f, 0xbe,
+  0x3a, 0x01, 0x29, 0xe3, 0x5d, 0x00, 0x00, 0x20, 0x65, 0x50, 0x54, 0x08, 0x00, 0xa4, 0x0c, 0x9a,
+  0x06, 0x00, 0x80, 0x94, 0x51, 0x09, 0x00, 0x00, 0x90, 0x32, 0x6a, 0x72, 0x00, 0x00, 0x52, 0x46,
+  0x95, 0x23, 0xb8, 0x43, 0xca, 0xa8, 0x32, 0x0d, 0x00, 0x48, 0x21, 0x00, 0x00, 0x00, 0x00, 0x29,
+  0xa4, 0x00, 0x00, 0x00, 0x20, 0x85, 0x14, 0x47, 0x00, 0x00, 0xa4, 0x90, 0x44, 0x00, 0x00, 0x80,
+  0x14, 0x92, 0x1c, 0x00, 0x00, 0x90, 0x42, 0xaa, 0x0c, 0x0c, 0x00, 0x52, 0x0a, 0x00, 0x00, 0x00,
+  0x40, 0x4a, 0x29, 0x2e, 0x30, 0x00, 0x48, 0x29, 0x45, 0x16, 0x00, 0x00, 0x29, 0xa5, 0xc8, 0x34,
+  0x02, 0x23, 0xa5, 0xb0, 0x22, 0x5f, 0x9d, 0xa4, 0x14, 0xc6, 0x0a, 0x01, 0x80, 0x94, 0xe2, 0x08,
+  0x00, 0x00, 0x90, 0x52, 0x1c, 0x05, 0x00, 0x00, 0x52, 0x8a, 0xa3, 0x05, 0x00, 0x40, 0x4a, 0x71,
+  0x34, 0x39, 0x5a, 0x48, 0x29, 0x8e, 0xb2, 0x42, 0x00, 0x29, 0x05, 0x16, 0x00, 0x00, 0x20, 0xa5,
+  0xc8, 0xe0, 0x0e, 0x00, 0xa4, 0x14, 0x59, 0xdc, 0x01, 0x80, 0x94, 0x22, 0x8b, 0x0c, 0x0c, 0x90,
+  0x52, 0x64, 0x99, 0x14, 0x00, 0x52, 0x8a, 0x4c, 0x03, 0x00, 0x40, 0x4a, 0x91, 0xc9, 0x1d, 0x00,
+  0x48, 0x29, 0x92, 0x26, 0x77, 0x00, 0x29, 0x65, 0xa2, 0x34, 0x00, 0x20, 0xa5, 0x4c, 0x5a, 0x08,
+  0x00, 0xa4, 0x98, 0x02, 0x00, 0x00, 0x80, 0x14, 0x53, 0x08, 0x00, 0x00, 0x90, 0x62, 0x8a, 0xa9,
+  0x0e, 0x00, 0x52, 0x4c, 0x61, 0x85, 0x00, 0x40, 0x8a, 0x29, 0x2c, 0xb9, 0x03, 0x48, 0x31, 0xc5,
+  0x01, 0x00, 0x00, 0x29, 0xa6, 0xb8, 0x01, 0x00, 0x20, 0xc5, 0x14, 0x47, 0x00, 0x00, 0xa4, 0x98,
+  0xe2, 0x0a, 0x01, 0x80, 0x14, 0x53, 0xdc, 0x01, 0x00, 0x90, 0x62, 0x8a, 0x3b, 0x85, 0x00, 0x52,
+  0x4c, 0x71, 0x69, 0x00, 0x40, 0x8a, 0x29, 0x2e, 0xb9, 0xc0, 0x48, 0x31, 0xc5, 0x25, 0x77, 0x00,
+  0x29, 0xa6, 0xb8, 0xe4, 0x28, 0x20, 0xc5, 0x14, 0x47, 0x01, 0x00, 0xa4, 0x98, 0xe2, 0x68, 0x21,
+  0x80, 0x14, 0x53, 0x1c, 0x4d, 0x03, 0x90, 0x62, 0x8a, 0xa3, 0x69, 0x15, 0x52, 0x4c, 0x71, 0x34,
+  0x39, 0x40, 0x8a, 0x29, 0x8e, 0x26, 0x47, 0x49, 0x31, 0x45, 0x06, 0x47, 0x01, 0x29, 0xa6, 0xc8,
+  0x20, 0x0b, 0x21, 0xc5, 0x14, 0x19, 0x68, 0x21, 0xa4, 0x98, 0x22, 0x0b, 0x00, 0x80, 0x14, 0x53,
+  0x64, 0x21, 0x00, 0x90, 0x62, 0x8a, 0x4c, 0x03, 0x00, 0x52, 0x4c, 0x91, 0xc9, 0x1d, 0x40, 0x8a,
+  0x29, 0x32, 0xd1, 0x42, 0x48, 0x31, 0x45, 0x3e, 0x77, 0x00, 0x29, 0xa6, 0xc8, 0x57, 0x19, 0x20,
+  0xc5, 0x14, 0xf9, 0xea, 0x04, 0xa4, 0x98, 0x32, 0xd3, 0xab, 0x93, 0x14, 0x93, 0x0a, 0x00, 0x00,
+  0x90, 0x62, 0x12, 0x2b, 0x04, 0x00, 0x52, 0x4c, 0x72, 0x00, 0x00, 0x40, 0x8a, 0x49, 0xb6, 0x10,
+  0x00, 0x48, 0x31, 0x8c, 0x00, 0x00, 0x00, 0x29, 0x86, 0x15, 0x77, 0x00, 0x20, 0xc5, 0x30, 0x9a,
+  0x06, 0x00, 0xa4, 0x98, 0xc7, 0x0a, 0x01, 0x80, 0x14, 0xf3, 0x5a, 0x1a, 0x00, 0x90, 0x62, 0x9e,
+  0x2c, 0x04, 0x00, 0x52, 0x0c, 0x2d, 0x04, 0x00, 0x40, 0x8a, 0xa1, 0xc9, 0x1d, 0x00, 0x48, 0x31,
+  0x34, 0xb9, 0xe4, 0x00, 0x29, 0x86, 0x26, 0x5b, 0x26, 0x20, 0xc5, 0x50, 0x9a, 0x1c, 0x05, 0xa4,
+  0x98, 0x4a, 0x00, 0x00, 0x80, 0x14, 0x53, 0x4f, 0x21, 0x00, 0x90, 0x62, 0x6a, 0x72, 0x07, 0x00,
+  0x52, 0x4c, 0x4d, 0x33, 0xb9, 0x43, 0x8a, 0xa9, 0xac, 0x10, 0x00, 0x48, 0x31, 0x95, 0x15, 0x59,
+  0x00, 0x29, 0xa6, 0xb2, 0x34, 0x00, 0x20, 0xc5, 0x54, 0xc7, 0x0a, 0x01, 0xa4, 0x98, 0x2a, 0x09,
+  0x00, 0x80, 0x14, 0x53, 0x65, 0x01, 0x00, 0x90, 0x62, 0xaa, 0x2c, 0x04, 0x00, 0x52, 0x4c, 0x95,
+  0x45, 0x16, 0x42, 0x8a, 0xa9, 0x32, 0x0d, 0x00, 0x48, 0x31, 0x55, 0xa6, 0x11, 0x18, 0x29, 0xa6,
+  0xca, 0xe4, 0x0e, 0x20, 0xc5, 0x54, 0x59, 0x27, 0x00, 0xa4, 0x98, 0x2a, 0x33, 0x00, 0x80, 0x14,
+  0x53, 0x27, 0x05, 0x00, 0x90, 0x62, 0xaa, 0x2d, 0x04, 0x00, 0x52, 0x4e, 0x10, 0xac, 0x10, 0x40,
+  0xca, 0x29, 0x8e, 0x24, 0x47, 0x49, 0x39, 0x28, 0x50, 0x00, 0x00, 0x29, 0x07, 0xc9, 0xe4, 0x0e,
+  0x20, 0xe5, 0xd4, 0x49, 0x01, 0x00, 0xa4, 0xa4, 0x56, 0x08, 0x00, 0x80, 0x94, 0x34, 0x69, 0x90,
+  0x85, 0x90, 0x92, 0x26, 0x65, 0x85, 0x00, 0x52, 0x54, 0x21, 0x00, 0x00, 0x40, 0x0a, 0x0b, 0x82,
+  0x01, 0x00, 0x48, 0x61, 0x41, 0xb0, 0xe0, 0x0e, 0x29, 0x2c, 0x8c, 0xe4, 0x0e, 0x20, 0x85, 0x05,
+  0x02, 0x00, 0x00, 0xa4, 0xb0, 0xc0, 0x0a, 0x01, 0x80, 0x14, 0x16, 0x58, 0x1a, 0x00, 0x90, 0xc2,
+  0x02, 0x4b, 0xee, 0x00, 0x52, 0x58, 0x60, 0xc9, 0x51, 0x40, 0x0a, 0x0b, 0x8e, 0x00, 0x00, 0x48,
+  0x61, 0xc1, 0x1d, 0x00, 0x00, 0x29, 0x2c, 0xb8, 0x53, 0x08, 0x20, 0x85, 0x05, 0x97, 0xdc, 0x01,
+  0xa4, 0xb0, 0xe0, 0x28, 0x00, 0x80, 0x14, 0x16, 0x1c, 0x4d, 0x8e, 0x92, 0xc2, 0x82, 0x2c, 0x04,
+  0x00, 0x52, 0x58, 0x90, 0x65, 0x02, 0x40, 0x0a, 0x0b, 0x32, 0x8d, 0xc0, 0x48, 0x61, 0x41, 0xbe,
+  0xca, 0x00, 0x29, 0x2c, 0xd0, 0x34, 0x00, 0x20, 0x85, 0x05, 0x9a, 0x1c, 0x00, 0xa4, 0xb0, 0x90,
+  0x01, 0x00, 0x80, 0x14, 0x36, 0x8a, 0x2c, 0x04, 0x90, 0xc2, 0x06, 0x02, 0x00, 0x00, 0x52, 0xd8,
+  0x40, 0x85, 0x00, 0x40, 0x0a, 0x1b, 0xe9, 0x55, 0x06, 0x48, 0x61, 0x63, 0x01, 0x00, 0x00, 0x29,
+  0x8c, 0x00, 0x00, 0x00, 0x20, 0x85, 0x91, 0x02, 0x00, 0x00, 0xa4, 0x30, 0x52, 0x08, 0x00, 0x80,
+  0x14, 0x46, 0x8a, 0x3b, 0x00, 0x90, 0xc2, 0x48, 0x72, 0x07, 0x00, 0x52, 0x18, 0x49, 0x33, 0xd6,
+  0x49, 0x0a, 0x23, 0x69, 0xce, 0x09, 0x48, 0x61, 0x84, 0x15, 0x02, 0x00, 0x29, 0x8c, 0xb0, 0x0c,
+  0x00, 0x20, 0x85, 0x11, 0x88, 0x0a, 0x01, 0xa4, 0x30, 0x22, 0x0b, 0x29, 0x84, 0x14, 0x46, 0x26,
+  0x05, 0x00, 0x90, 0xc2, 0xc8, 0xcc, 0x00, 0x00, 0x52, 0x18, 0xc9, 0x00, 0x00, 0x40, 0x0a, 0x2b,
+  0x04, 0x00, 0x00, 0x48, 0x61, 0xc5, 0x25, 0x47, 0x01, 0x29, 0xac, 0xc8, 0x42, 0x00, 0x20, 0x85,
+  0x95, 0x49, 0x01, 0x00, 0xa4, 0x30, 0x63, 0xea, 0x04, 0x80, 0x14, 0x66, 0x4c, 0x9d, 0x13, 0x90,
+  0xc2, 0x4c, 0x95, 0x85, 0x00, 0x52, 0x98, 0xa9, 0xf2, 0xd5, 0x49, 0x0a, 0x4b, 0xc1, 0x51, 0x00,
+  0x48, 0x61, 0x29, 0xc8, 0x42, 0x00, 0x29, 0x2c, 0x0d, 0x00, 0x00, 0x20, 0x85, 0xa5, 0x11, 0x1c,
+  0x05, 0xa4, 0xb0, 0x34, 0xd2, 0x00, 0x80, 0x14, 0x96, 0x46, 0x72, 0x07, 0x90, 0xc2, 0x12, 0x01,
+  0x00, 0x00, 0x52, 0x58, 0x22, 0x85, 0x00, 0x40, 0x0a, 0x4b, 0xa7, 0x00, 0x00, 0x48, 0x61, 0xe9,
+  0x14, 0x02, 0x00, 0x29, 0x2c, 0x1d, 0x54, 0x08, 0x20, 0x85, 0xa5, 0x53, 0xe7, 0x9c, 0xa4, 0xb0,
+  0xc4, 0x0a, 0x00, 0x80, 0x14, 0x96, 0x58, 0x21, 0x00, 0x90, 0xc2, 0x12, 0x4b, 0x81, 0x01, 0x52,
+  0x58, 0x72, 0x00, 0x00, 0x40, 0x0a, 0x4b, 0x8e, 0x00, 0x00, 0x48, 0x61, 0xc9, 0x91, 0x42, 0x00,
+  0x29, 0x2c, 0xb9, 0x02, 0x00, 0x20, 0x85, 0x25, 0x57, 0x08, 0x00, 0xa4, 0xb0, 0xe4, 0x0e, 0x00,
+  0x80, 0x14, 0x96, 0x5c, 0x1a, 0x00, 0x90, 0xc2, 0x92, 0x4b, 0x0e, 0x00, 0x52, 0x58, 0x72, 0xc9,
+  0x1d, 0x40, 0x0a, 0x4b, 0x2e, 0x39, 0x0a, 0x48, 0x61, 0xc9, 0xd1, 0xe4, 0x0e, 0x29, 0x2c, 0x49,
+  0x0a, 0x00, 0x20, 0x85, 0xa5, 0x59, 0x08, 0x00, 0xa4, 0xb0, 0x34, 0x93, 0x3b, 0x80, 0x14, 0x96,
+  0xe6, 0xab, 0x13, 0x90, 0xc2, 0xd2, 0xa4, 0x00, 0x00, 0x52, 0x58, 0x9a, 0x34, 0xb9, 0x43, 0x0a,
+  0x4b, 0xb4, 0x00, 0x00, 0x48, 0x61, 0x89, 0x16, 0x02, 0x00, 0x29, 0x2c, 0xd1, 0x34, 0x00, 0x20,
+  0x85, 0x25, 0x9a, 0x5e, 0x9d, 0xa4, 0xb0, 0x44, 0x19, 0x00, 0x80, 0x14, 0x96, 0x6c, 0x21, 0x00,
+  0x90, 0xc2, 0x92, 0x2d, 0xb2, 0x10, 0x52, 0x18, 0x23, 0x00, 0x00, 0x40, 0x0a, 0x63, 0x84, 0x15,
+  0x02, 0x48, 0x61, 0xac, 0x00, 0x00, 0x00, 0x29, 0x8c, 0x15, 0x02, 0x00, 0x20, 0x85, 0xb1, 0x62,
+  0x2a, 0x03, 0xa4, 0x30, 0x56, 0xdc, 0x01, 0x80, 0x14, 0xc6, 0x8a, 0x0c, 0x0e, 0x90, 0xc2, 0x58,
+  0x91, 0x85, 0x00, 0x52, 0x18, 0x2b, 0x32, 0xd9, 0x42, 0x0a, 0x63, 0x45, 0xbe, 0x3a, 0x49, 0x61,
+  0xac, 0x4c, 0x0a, 0x00, 0x29, 0x8c, 0x25, 0x47, 0xd3, 0x20, 0x85, 0x31, 0x56, 0x08, 0x00, 0xa4,
+  0x30, 0xc6, 0xd2, 0x00, 0x80, 0x14, 0xc6, 0x58, 0x72, 0x07, 0x90, 0xc2, 0x18, 0x4b, 0x8e, 0x02,
+  0x52, 0x18, 0x7b, 0xad, 0x00, 0x40, 0x0a, 0x63, 0xaf, 0x15, 0x02, 0x48, 0x61, 0xec, 0xb9, 0x03,
+  0x00, 0x29, 0x8c, 0x3d, 0x59, 0x08, 0x20, 0x85, 0xb1, 0x57, 0xe7, 0x9c, 0xa4, 0x30, 0x46, 0x0b,
+  0x01, 0x80, 0x14, 0xc6, 0x28, 0x2b, 0xee, 0x90, 0xc2, 0x18, 0x65, 0x65, 0x4e, 0x52, 0x58, 0x03,
+  0x00, 0x00, 0x40, 0x0a, 0x7b, 0x82, 0x15, 0x02, 0x48, 0x61, 0x8f, 0x00, 0x00, 0x00, 0x29, 0xec,
+  0xb5, 0x57, 0x19, 0x20, 0x85, 0x3d, 0x19, 0x18, 0x00, 0xa4, 0xb0, 0x27, 0x09, 0x00, 0x80, 0x14,
+  0xf6, 0x64, 0x01, 0x00, 0x90, 0xc2, 0x9e, 0x2c, 0xc1, 0x01, 0x52, 0xd8, 0x93, 0x85, 0x00, 0x40,
+  0x0a, 0x7b, 0x32, 0x0d, 0x00, 0x48, 0x61, 0x4f, 0x66, 0x00, 0x00, 0x29, 0xec, 0xd1, 0x42, 0x00,
+  0x20, 0x85, 0x3d, 0x5b, 0x08, 0x00, 0xa4, 0xb0, 0x77, 0x01, 0x00, 0x80, 0x14, 0xf6, 0x6e, 0x72,
+  0x07, 0x90, 0xc2, 0x66, 0xa0, 0x00, 0x00, 0x52, 0x18, 0x2d, 0x00, 0x00, 0x40, 0x0a, 0xab, 0x04,
+  0x00, 0x00, 0x48, 0x61, 0xf5, 0x14, 0x02, 0x00, 0x29, 0xac, 0xb2, 0xe4, 0x0e, 0x20, 0x85, 0x55,
+  0x47, 0x0b, 0x01, 0xa4, 0xb0, 0x0a, 0x69, 0x01, 0x80, 0x14, 0x56, 0xe5, 0x08, 0x0c, 0x90, 0xc2,
+  0xaa, 0x2c, 0x00, 0x00, 0x52, 0x58, 0x95, 0x85, 0x00, 0x40, 0x0a, 0xab, 0x33, 0xb9, 0x03, 0x48,
+  0x61, 0x19, 0x00, 0x00, 0x00, 0x29, 0x2c, 0xa7, 0x01, 0x00, 0x20, 0xa5, 0x05, 0x16, 0xdc, 0x01,
+  0xa4, 0xb4, 0xc0, 0x32, 0x00, 0x80, 0x94, 0x16, 0x1c, 0x00, 0x00, 0x90, 0xd2, 0x44, 0x60, 0x85,
+  0x00, 0x52, 0x9a, 0x60, 0x85, 0x00, 0x40, 0x4a, 0x13, 0xec, 0xb9, 0x03, 0x48, 0x69, 0x85, 0x25,
+  0x5b, 0x00, 0x29, 0x2d, 0x0d, 0x0a, 0x00, 0x20, 0xa5, 0x25, 0xc2, 0x00, 0x00, 0xa4, 0xb4, 0xe4,
+  0x08, 0x00, 0x80, 0x94, 0x96, 0xdc, 0x01, 0x00, 0x90, 0xd2, 0x92, 0x4b, 0xc1, 0x1d, 0x52, 0x5a,
+  0x72, 0xb4, 0x10, 0x40, 0x4a, 0x4b, 0xb2, 0x10, 0x00, 0x48, 0x69, 0x89, 0x96, 0x39, 0x01, 0x29,
+  0xad, 0x3d, 0x99, 0x0a, 0x21, 0xa5, 0xc1, 0x40, 0x01, 0x00, 0xa4, 0x34, 0x88, 0x92, 0x3b, 0x80,
+  0x94, 0x06, 0x93, 0x03, 0x00, 0x90, 0xd2, 0x60, 0x72, 0x07, 0x00, 0x52, 0x1a, 0x7c, 0xb2, 0x10,
+  0x40, 0x4a, 0x83, 0x4f, 0x26, 0x77, 0x48, 0x69, 0x90, 0x9a, 0xca, 0x00, 0x29, 0x0d, 0x66, 0x00,
+  0x00, 0x20, 0xc5, 0x05, 0x51, 0x0b, 0x01, 0xa4, 0xb8, 0xc0, 0xd2, 0x00, 0x80, 0x14, 0x17, 0x58,
+  0x62, 0x00, 0x90, 0xe2, 0x42, 0x7b, 0x95, 0x01, 0x52, 0x5c, 0x70, 0x07, 0x00, 0x40, 0x8a, 0x0b,
+  0x32, 0x30, 0x00, 0x48, 0x71, 0x41, 0x06, 0x5a, 0x00, 0x29, 0x2e, 0xc8, 0x42, 0x00, 0x20, 0xc5,
+  0x05, 0x99, 0xdc, 0x01, 0xa4, 0xb8, 0x20, 0x5f, 0x9d, 0x93, 0x14, 0x47, 0x00, 0x00, 0x00, 0x90,
+  0xe2, 0x48, 0x21, 0x00, 0x00, 0x52, 0x1c, 0x29, 0xae, 0x00, 0x40, 0x8a, 0x23, 0xc5, 0x1d, 0x00,
+  0x48, 0x71, 0xa4, 0x38, 0x9a, 0x06, 0x29, 0x8e, 0x14, 0x99, 0xdc, 0x21, 0xc5, 0x91, 0x42, 0x01,
+  0x00, 0xa4, 0x38, 0x92, 0x46, 0x60, 0x80, 0x14, 0x47, 0xd2, 0x01, 0x00, 0x90, 0xe2, 0x48, 0x72,
+  0x85, 0x00, 0x52, 0x1c, 0x49, 0xee, 0x00, 0x40, 0x8a, 0x23, 0x69, 0xd2, 0x42, 0x48, 0x71, 0x84,
+  0x05, 0x56, 0x08, 0x29, 0x8e, 0x3c, 0x77, 0x00, 0x20, 0xc5, 0x11, 0x98, 0xdc, 0x01, 0xa4, 0x38,
+  0x22, 0x83, 0x3b, 0x80, 0x14, 0x47, 0x26, 0x4d, 0xee, 0x90, 0xe2, 0xc8, 0x05, 0x00, 0x00, 0x52,
+  0x1c, 0xb9, 0x81, 0x02, 0x40, 0x8a, 0x23, 0x19, 0x00, 0x00, 0x48, 0x71, 0x05, 0x00, 0x00, 0x00,
+  0x29, 0xae, 0x10, 0x00, 0x00, 0x20, 0xc5, 0x15, 0x52, 0x08, 0x00, 0xa4, 0xb8, 0x42, 0x58, 0x21,
+  0x80, 0x14, 0x57, 0x58, 0x72, 0x00, 0x90, 0xe2, 0x0a, 0x4b, 0xee, 0x00, 0x52, 0x5c, 0x61, 0xe9,
+  0xd5, 0x49, 0x8a, 0x2b, 0x0e, 0x00, 0x00, 0x48, 0x71, 0xc5, 0x05, 0x77, 0x00, 0x29, 0xae, 0x38,
+  0x02, 0x00, 0x20, 0xc5, 0x15, 0x57, 0x08, 0x00, 0xa4, 0xb8, 0xe2, 0x0e, 0x00, 0x80, 0x14, 0x57,
+  0x5c, 0x1a, 0x00, 0x90, 0xe2, 0x8a, 0xa3, 0x00, 0x00, 0x52, 0x5c, 0x71, 0xb4, 0x10, 0x40, 0x8a,
+  0x2b, 0x8e, 0xa6, 0x01, 0x48, 0x71, 0xc5, 0xd1, 0xe4, 0x0e, 0x29, 0xae, 0x38, 0xfa, 0xea, 0x24,
+  0xc5, 0x15, 0x19, 0x64, 0x01, 0xa4, 0xb8, 0x22, 0x03, 0x05, 0x80, 0x14, 0x57, 0x64, 0x21, 0x00,
+  0x90, 0xe2, 0x8a, 0x4c, 0xee, 0x00, 0x52, 0x5c, 0x91, 0x19, 0x00, 0x40, 0x8a, 0x2b, 0x93, 0xa6,
+  0x01, 0x48, 0x71, 0x65, 0x66, 0x00, 0x00, 0x29, 0xee, 0x00, 0x00, 0x00, 0x20, 0xc5, 0x9d, 0x02,
+  0x00, 0x00, 0xa4, 0xb8, 0x53, 0x1c, 0x2d, 0x84, 0x14, 0x77, 0x10, 0x2b, 0x04, 0x90, 0xe2, 0x4e,
+  0x72, 0x14, 0x00, 0x52, 0xdc, 0xa9, 0x32, 0x30, 0x40, 0x8a, 0x3b, 0x75, 0xd2, 0x42, 0x48, 0x71,
+  0x69, 0x14, 0x02, 0x00, 0x29, 0x2e, 0x8d, 0xf4, 0xea, 0x24, 0xc5, 0x25, 0x02, 0x00, 0x00, 0xa4,
+  0xb8, 0x44, 0x0a, 0x00, 0x80, 0x14, 0x97, 0x4e, 0x21, 0x00, 0x90, 0xe2, 0x12, 0x4b, 0xc1, 0x1d,
+  0x52, 0x5c, 0x62, 0x69, 0x00, 0x40, 0x8a, 0x4b, 0x2e, 0xb9, 0x03, 0x48, 0x71, 0xc9, 0xd1, 0xe4,
+  0x00, 0x29, 0x2e, 0xcd, 0x40, 0x0b, 0x21, 0xc5, 0xa5, 0x49, 0x93, 0x3b, 0xa4, 0xb8, 0x44, 0x93,
+  0xa3, 0x80, 0x14, 0xf7, 0x08, 0x00, 0x00, 0x90, 0xe2, 0x1e, 0x4b, 0x03, 0x00, 0x52, 0xdc, 0x6b,
+  0x81, 0xa6, 0x41, 0x8a, 0x7b, 0x2d, 0x0d, 0x00, 0x48, 0x71, 0xaf, 0xbd, 0x56, 0x00, 0x29, 0xee,
+  0xb9, 0x03, 0x00, 0x20, 0xc5, 0x3d, 0x47, 0x13, 0x01, 0xa4, 0xb8, 0x27, 0xd3, 0x00, 0x80, 0x14,
+  0xf7, 0xa4, 0x4c, 0xee, 0x90, 0xe2, 0x9e, 0x2d, 0x13, 0x01, 0x52, 0x1c, 0x2d, 0x00, 0x00, 0x40,
+  0x8a, 0xa3, 0x85, 0x00, 0x00, 0x48, 0x71, 0xb4, 0xb8, 0x42, 0x00, 0x29, 0x8e, 0x16, 0x59, 0x08,
+  0x20, 0xc5, 0xd1, 0x22, 0x93, 0x3b, 0xa4, 0x38, 0x9a, 0x1c, 0x00, 0x80, 0x14, 0x47, 0x65, 0x21,
+  0x00, 0x90, 0xe2, 0x28, 0xcd, 0x00, 0x00, 0x52, 0x1c, 0xad, 0xac, 0x10, 0x40, 0x8a, 0xcb, 0x00,
+  0x00, 0x00, 0x48, 0x81, 0x81, 0x26, 0x77, 0x00, 0x29, 0xb0, 0x10, 0x00, 0x00, 0x20, 0x05, 0x16,
+  0x56, 0x08, 0x00, 0xa4, 0xc0, 0xe2, 0x08, 0x00, 0x80, 0x14, 0x58, 0xdc, 0x29, 0x00, 0x90, 0x02,
+  0x8b, 0xa3, 0x85, 0x00, 0x52, 0x60, 0x71, 0x34, 0x0d, 0x40, 0x0a, 0x2c, 0x32, 0xc8, 0x02, 0x48,
+  0x81, 0x45, 0x16, 0x02, 0x00, 0x29, 0xb0, 0xc8, 0xe4, 0x0e, 0x20, 0x05, 0xa6, 0x11, 0x58, 0x21,
+  0xa4, 0xc0, 0x34, 0x0a, 0x01, 0x80, 0x14, 0x98, 0x46, 0x72, 0x07, 0x90, 0x02, 0x93, 0x3b, 0x00,
+  0x00, 0x52, 0x60, 0x72, 0xc9, 0x1d, 0x40, 0x0a, 0x4c, 0x2e, 0xbd, 0x3a, 0x49, 0x81, 0x69, 0x26,
+  0x77, 0x00, 0x29, 0x90, 0x15, 0x77, 0x00, 0x20, 0x05, 0xb2, 0x37, 0x51, 0x21, 0xa4, 0x40, 0x19,
+  0x28, 0x00, 0x80, 0x14, 0x28, 0x05, 0x2b, 0xee, 0x90, 0x02, 0x65, 0x01, 0x00, 0x00, 0x52, 0xa0,
+  0x2c, 0xee, 0x00, 0x40, 0x0a, 0x94, 0xc9, 0x05, 0x06, 0x48, 0x81, 0x32, 0xb9, 0x03, 0x00, 0x29,
+  0x50, 0x66, 0x00, 0x00, 0x20, 0x05, 0x66, 0x00, 0x00, 0x00, 0xa4, 0xc8, 0x20, 0x18, 0x00, 0x80,
+  0x14, 0x19, 0x04, 0xcb, 0x00, 0x90, 0x22, 0xc3, 0x48, 0xaf, 0x4e, 0x52, 0x64, 0x70, 0xa7, 0x00,
+  0x40, 0x8a, 0x0c, 0x8e, 0x02, 0x00, 0x48, 0x91, 0xc1, 0xd1, 0xe2, 0x0e, 0x29, 0x32, 0xc8, 0xc0,
+  0x32, 0x20, 0x45, 0x06, 0x99, 0x01, 0x00, 0xa4, 0xc8, 0x40, 0x0b, 0x00, 0x80, 0x14, 0x29, 0x02,
+  0x2b, 0x13, 0x90, 0x22, 0x05, 0x2b, 0x0e, 0x00, 0x52, 0xa4, 0x60, 0xc9, 0x1d, 0x40, 0x8a, 0x1c,
+  0xc9, 0x51, 0x00, 0x48, 0x91, 0x23, 0xcd, 0x09, 0x00, 0x29, 0x72, 0xa4, 0x49, 0x01, 0x20, 0x45,
+  0x12, 0x00, 0x00, 0x00, 0xa4, 0x48, 0x52, 0x00, 0x00, 0x80, 0x14, 0x49, 0xd2, 0x00, 0x00, 0x90,
+  0x22, 0x49, 0x22, 0x00, 0x00, 0x52, 0x24, 0x61, 0x85, 0x00, 0x40, 0x8a, 0x2c, 0x00, 0x00, 0x00,
+  0x48, 0x91, 0x65, 0x24, 0x77, 0x00, 0x29, 0xb2, 0x10, 0x00, 0x00, 0x20, 0x45, 0x16, 0x52, 0x08,
+  0x00, 0xa4, 0xc8, 0x62, 0x2a, 0x2b, 0x84, 0x14, 0x59, 0x92, 0x3b, 0x00, 0x90, 0x22, 0x0b, 0x4b,
+  0xaf, 0x4e, 0x52, 0x64, 0x71, 0x04, 0x00, 0x40, 0x8a, 0x2c, 0xae, 0x10, 0x00, 0x48, 0x91, 0xc5,
+  0x1d, 0x00, 0x00, 0x29, 0xb2, 0xb8, 0xe4, 0x28, 0x20, 0x45, 0x16, 0x97, 0x5e, 0x9d, 0xa4, 0xc8,
+  0xe2, 0x92, 0x2d, 0x84, 0x14, 0x59, 0x1c, 0x05, 0x00, 0x90, 0x22, 0x8b, 0xa3, 0x69, 0x00, 0x52,
+  0x64, 0x91, 0x81, 0x01, 0x40, 0x8a, 0x2c, 0xb2, 0x10, 0x00, 0x48, 0x91, 0x45, 0xa6, 0x01, 0x00,
+  0x29, 0xb2, 0xc8, 0xe4, 0x28, 0x20, 0x45, 0x16, 0xf9, 0xea, 0x9c, 0xa4, 0xc8, 0x22, 0x67, 0x72,
+  0x87, 0x14, 0x59, 0x66, 0x1a, 0x00, 0x90, 0x22, 0xcb, 0xa4, 0xc9, 0x01, 0x52, 0xe4, 0x29, 0xee,
+  0x00, 0x40, 0x8a, 0x3c, 0x45, 0x12, 0x00, 0x48, 0x91, 0x07, 0xb1, 0xe2, 0x28, 0x29, 0x32, 0x05,
+  0x06, 0x00, 0x20, 0x45, 0xa6, 0x01, 0x00, 0x00, 0xa4, 0xc8, 0x34, 0x0a, 0x00, 0x80, 0x14, 0x99,
+  0x46, 0x1a, 0x00, 0x90, 0x22, 0xd3, 0xa0, 0x69, 0x00, 0x52, 0x64, 0x22, 0x00, 0x00, 0x40, 0x8a,
+  0x4c, 0xac, 0x04, 0x77, 0x48, 0x91, 0x89, 0x15, 0x02, 0x00, 0x29, 0x32, 0xb1, 0xe4, 0x0e, 0x20,
+  0x45, 0x26, 0x07, 0x00, 0x00, 0xa4, 0xc8, 0xe4, 0x08, 0x00, 0x80, 0x14, 0x99, 0x5c, 0x21, 0x00,
+  0x90, 0x22, 0x93, 0x3b, 0x00, 0x00, 0x52, 0x64, 0x72, 0xc9, 0x51, 0x40, 0x8a, 0x4c, 0xee, 0xd5,
+  0x09, 0x48, 0x91, 0xc9, 0x51, 0x00, 0x00, 0x29, 0x32, 0x39, 0x5a, 0x08, 0x20, 0x45, 0x26, 0x47,
+  0x53, 0x21, 0xa4, 0xc8, 0xe4, 0x32, 0x00, 0x80, 0x14, 0x99, 0x64, 0xa0, 0x00, 0x90, 0x22, 0x93,
+  0x2c, 0x04, 0x00, 0x52, 0x64, 0x92, 0xe9, 0xd5, 0x49, 0x8a, 0x4c, 0x33, 0xb9, 0x03, 0x48, 0x91,
+  0x69, 0xd2, 0xe4, 0x0e, 0x29, 0x32, 0x51, 0x56, 0x08, 0x20, 0x45, 0xae, 0x42, 0x00, 0x00, 0xa4,
+  0x48, 0x56, 0xdc, 0x01, 0x80, 0x14, 0xd9, 0x82, 0x60, 0x00, 0x90, 0x22, 0x5b, 0x90, 0x85, 0x00,
+  0x52, 0x64, 0x0b, 0x34, 0xb9, 0x43, 0x8a, 0x6c, 0x42, 0x16, 0x02, 0x48, 0x91, 0x2d, 0xb9, 0x42,
+  0x00, 0x29, 0xb2, 0x25, 0x77, 0x00, 0x20, 0x45, 0xb6, 0xf4, 0x2a, 0x03, 0xa4, 0xc8, 0x96, 0x26,
+  0x05, 0x80, 0x14, 0xe9, 0x08, 0x00, 0x00, 0x90, 0x22, 0x1f, 0x03, 0x00, 0x00, 0x52, 0xe4, 0x63,
+  0x85, 0x00, 0x40, 0x8a, 0x7c, 0x2c, 0x03, 0x00, 0x48, 0x91, 0xaf, 0xa5, 0x11, 0x18, 0x29, 0xf2,
+  0xb5, 0xe4, 0x0e, 0x20, 0x45, 0x3e, 0x47, 0x00, 0x00, 0xa4, 0xc8, 0xe7, 0x0e, 0x00, 0x80, 0x14,
+  0xf9, 0x24, 0x01, 0x00, 0x90, 0x22, 0x9f, 0x2c, 0x04, 0x00, 0x52, 0xe4, 0xab, 0x2c, 0x30, 0x40,
+  0x8a, 0x9c, 0xc9, 0x15, 0x02, 0x48, 0x91, 0xf3, 0xd5, 0x59, 0x08, 0x29, 0x92, 0x02, 0x00, 0x00,
+  0x20, 0x45, 0xd2, 0xc0, 0x92, 0x3b, 0xa4, 0x48, 0x1a, 0x1c, 0x2d, 0x84, 0x14, 0x49, 0x0b, 0x01,
+  0x00, 0x90, 0x22, 0x69, 0x71, 0x07, 0x00, 0x52, 0x24, 0x45, 0x00, 0x00, 0x40, 0x8a, 0xa4, 0xa8,
+  0x10, 0x00, 0x48, 0x91, 0x34, 0x0d, 0x00, 0x00, 0x29, 0x92, 0x26, 0x02, 0x00, 0x20, 0x45, 0xd2,
+  0xe4, 0x00, 0x00, 0xa4, 0x48, 0x9a, 0xdc, 0x01, 0x80, 0x14, 0x49, 0x93, 0xa3, 0x69, 0x90, 0x22,
+  0x69, 0x9a, 0x14, 0x00, 0x52, 0x24, 0x7d, 0x32, 0xb9, 0x43, 0x8a, 0xa4, 0x34, 0xbd, 0x67, 0x48,
+  0x91, 0x34, 0x03, 0x00, 0x00, 0x29, 0xd2, 0x06, 0x0a, 0x00, 0x20, 0x45, 0x66, 0x00, 0x00, 0x00,
+  0xa4, 0xcc, 0x91, 0x9e, 0x24, 0x80, 0x94, 0x59, 0x00, 0x00, 0x00, 0x90, 0x32, 0x0b, 0x4b, 0xaf,
+  0x4e, 0x52, 0x66, 0x71, 0x07, 0x00, 0x40, 0xca, 0x2c, 0x93, 0xa6, 0xc0, 0x48, 0x99, 0xa8, 0x10,
+  0x00, 0x00, 0x29, 0x13, 0x15, 0x47, 0x00, 0x20, 0x65, 0xa2, 0xe2, 0x0e, 0x00, 0xa4, 0x4c, 0x54,
+  0x1c, 0x2d, 0x80, 0x94, 0x89, 0xd2, 0x08, 0x0e, 0x90, 0x32, 0x51, 0x72, 0x00, 0x00, 0x52, 0x26,
+  0x4a, 0xee, 0x00, 0x40, 0xca, 0x44, 0xaf, 0x4e, 0x00, 0x48, 0x99, 0x48, 0xa6, 0x01, 0x00, 0x29,
+  0x13, 0x51, 0x00, 0x00, 0x20, 0x65, 0x22, 0x9a, 0x06, 0x00, 0xa4, 0x4c, 0x44, 0x93, 0x3b, 0x80,
+  0x94, 0x89, 0x28, 0x2b, 0x04, 0x90, 0x32, 0x93, 0xa3, 0x29, 0x30, 0x52, 0x26, 0x2b, 0x04, 0x00,
+  0x40, 0xca, 0x6c, 0xc5, 0x1d, 0x00, 0x48, 0x99, 0x8f, 0x15, 0x02, 0x00, 0x29, 0xf3, 0xb1, 0xe4,
+  0x0e, 0x20, 0x65, 0xbe, 0x56, 0x08, 0x00, 0xa4, 0xcc, 0xd7, 0x5e, 0x65, 0x80, 0x94, 0xf9, 0x64,
+  0x70, 0x07, 0x90, 0x32, 0x9f, 0x24, 0x00, 0x00, 0x52, 0xe6, 0x93, 0x85, 0x00, 0x40, 0xca, 0x7c,
+  0x32, 0x0d, 0x00, 0x48, 0x99, 0x4f, 0x26, 0x77, 0x00, 0x29, 0xf3, 0xc9, 0x99, 0x02, 0x23, 0x65,
+  0xbe, 0x2a, 0x0b, 0x01, 0xa4, 0x4c, 0x18, 0x58, 0x21, 0x80, 0x94, 0x09, 0x0b, 0x01, 0x00, 0x90,
+  0x32, 0x61, 0x71, 0x00, 0x00, 0x52, 0x26, 0x2c, 0xee, 0x00, 0x40, 0xca, 0x84, 0xc5, 0xd1, 0x34,
+  0x48, 0x99, 0xb0, 0xc8, 0x42, 0x00, 0x29, 0x13, 0xa2, 0x42, 0x00, 0x20, 0x65, 0x42, 0x44, 0x0b,
+  0x01, 0xa4, 0x4c, 0x98, 0x06, 0x00, 0x80, 0x94, 0x09, 0xd3, 0x08, 0x0c, 0x90, 0x32, 0x61, 0x22,
+  0x00, 0x00, 0x52, 0x26, 0x4c, 0x0e, 0x00, 0x40, 0xca, 0x84, 0xc9, 0x1d, 0x00, 0x48, 0x99, 0x30,
+  0x39, 0x5a, 0x08, 0x29, 0x13, 0xa6, 0xe7, 0x0e, 0x20, 0x65, 0xc2, 0xf4, 0x2a, 0x03, 0xa4, 0x4c,
+  0x98, 0x66, 0x21, 0x80, 0x94, 0x09, 0xd3, 0x44, 0x85, 0x90, 0x32, 0x61, 0x9a, 0xc9, 0x01, 0x52,
+  0x26, 0x7c, 0x69, 0x00, 0x40, 0xca, 0x84, 0xaf, 0x05, 0x06, 0x48, 0x99, 0xf0, 0xb9, 0x03, 0x00,
+  0x29, 0x13, 0x3e, 0x59, 0x00, 0x20, 0x65, 0xc2, 0x27, 0x93, 0x3b, 0xa4, 0x4c, 0xf8, 0xe4, 0xab,
+  0x93, 0x94, 0x09, 0x1f, 0x2d, 0x04, 0x90, 0x32, 0xe1, 0xab, 0xb2, 0x10, 0x52, 0x26, 0x7c, 0x75,
+  0xce, 0x49, 0xca, 0x84, 0xcf, 0x16, 0x02, 0x48, 0x99, 0x50, 0x9a, 0x3a, 0x01, 0x29, 0x13, 0x52,
+  0x00, 0x00, 0x20, 0x65, 0x42, 0x5a, 0x08, 0x00, 0xa4, 0x4c, 0x48, 0xd3, 0x00, 0x80, 0x94, 0x09,
+  0x29, 0x2b, 0x04, 0x90, 0x32, 0x21, 0x65, 0xc5, 0x01, 0x52, 0x26, 0xa4, 0x2c, 0xb9, 0x43, 0xca,
+  0x84, 0x34, 0x03, 0x00, 0x48, 0x99, 0x30, 0x03, 0x00, 0x00, 0x29, 0x73, 0x06, 0xf9, 0xea, 0x24,
+  0x65, 0xce, 0x42, 0x00, 0x00, 0xa4, 0xcc, 0x89, 0x00, 0x00, 0x80, 0x94, 0x39, 0x1f, 0x2d, 0x04,
+  0x90, 0x32, 0xe7, 0x2c, 0x04, 0x00, 0x52, 0xe6, 0x9c, 0x34, 0x0d, 0x40, 0xca, 0x9c, 0x14, 0x00,
+  0x00, 0x48, 0x99, 0x93, 0x16, 0x02, 0x00, 0x29, 0x73, 0xd2, 0xf4, 0xea, 0x24, 0x65, 0x4e, 0xca,
+  0x0a, 0x01, 0xa4, 0x4c, 0x0a, 0x00, 0x00, 0x80, 0x94, 0x49, 0xc3, 0x08, 0xee, 0x90, 0x32, 0x69,
+  0x58, 0x85, 0x00, 0x52, 0x26, 0x0d, 0xac, 0x10, 0x40, 0xca, 0xa4, 0x81, 0xa5, 0x01, 0x48, 0x99,
+  0x34, 0xb4, 0x02, 0x00, 0x29, 0x93, 0x06, 0x77, 0x00, 0x20, 0x65, 0xd2, 0xe0, 0x68, 0x21, 0xa4,
+  0x4c, 0x1a, 0x1c, 0x4d, 0x83, 0x94, 0x49, 0x83, 0x2c, 0x04, 0x90, 0x32, 0x69, 0x90, 0xc9, 0x51,
+  0x52, 0x26, 0x0d, 0x93, 0x02, 0x40, 0xca, 0xa4, 0x81, 0x26, 0x07, 0x48, 0x99, 0x34, 0xd0, 0xe4,
+  0x0e, 0x29, 0x93, 0x8e, 0x22, 0x0b, 0x21, 0x65, 0xd2, 0x02, 0x00, 0x00, 0xa4, 0x4c, 0x5a, 0x82,
+  0x3b, 0x80, 0x94, 0x49, 0x0b, 0x01, 0x00, 0x90, 0x32, 0x69, 0x21, 0x29, 0x30, 0x52, 0x26, 0x2d,
+  0x24, 0x0d, 0x40, 0xca, 0xa4, 0x85, 0x24, 0x07, 0x48, 0x99, 0xb4, 0x90, 0xe4, 0x0e, 0x29, 0x93,
+  0x16, 0x56, 0x08, 0x20, 0x65, 0xd2, 0xe2, 0x00, 0x00, 0xa4, 0x4c, 0x5a, 0x5c, 0x70, 0x80, 0x94,
+  0x49, 0x8b, 0x0b, 0x8e, 0x92, 0x32, 0x69, 0x71, 0x85, 0x00, 0x52, 0x26, 0x2d, 0xee, 0x00, 0x40,
+  0xca, 0xa4, 0xc5, 0x25, 0x77, 0x48, 0x99, 0xb4, 0x38, 0x0a, 0x00, 0x29, 0x93, 0x16, 0x47, 0x0b,
+  0x21, 0x65, 0xd2, 0xe2, 0x68, 0x1a, 0xa4, 0x4c, 0x5a, 0x64, 0x21, 0x80, 0x94, 0x49, 0x8b, 0x4c,
+  0x03, 0x90, 0x32, 0x69, 0x91, 0xc9, 0x1d, 0x52, 0x26, 0x2d, 0xf2, 0xd5, 0x49, 0xca, 0xa4, 0x45,
+  0x66, 0x00, 0x48, 0x99, 0xb4, 0x4c, 0x0a, 0x00, 0x29, 0x93, 0x1a, 0x00, 0x00, 0x20, 0x65, 0x52,
+  0x04, 0x00, 0x00, 0xa4, 0x4c, 0x8a, 0x0a, 0x00, 0x80, 0x94, 0x49, 0x51, 0x21, 0x00, 0x90, 0x32,
+  0x29, 0x2a, 0xee, 0x00, 0x52, 0x26, 0x45, 0x45, 0x02, 0x40, 0xca, 0xa4, 0xa8, 0x4c, 0x00, 0x48,
+  0x99, 0x14, 0x99, 0xca, 0x00, 0x29, 0x93, 0x22, 0x53, 0x27, 0x20, 0x65, 0x52, 0x94, 0x06, 0x00,
+  0xa4, 0x4c, 0x8a, 0x92, 0x2b, 0x80, 0x94, 0x49, 0x51, 0x72, 0x07, 0x90, 0x32, 0x29, 0x4a, 0xaf,
+  0x4e, 0x52, 0x26, 0x45, 0xac, 0x10, 0x40, 0xca, 0xa4, 0x88, 0x25, 0x77, 0x48, 0x99, 0x14, 0xb1,
+  0xe4, 0x28, 0x29, 0x93, 0x22, 0x0a, 0x00, 0x20, 0x65, 0x52, 0x44, 0x0b, 0x00, 0xa4, 0x4c, 0x8a,
+  0x68, 0x21, 0x80, 0x94, 0x49, 0x11, 0x4d, 0x03, 0x90, 0x32, 0x29, 0xca, 0x00, 0x00, 0x52, 0x26,
+  0x4d, 0x81, 0x15, 0x42, 0xca, 0xa4, 0x49, 0x08, 0x06, 0x48, 0x99, 0x34, 0x0d, 0x00, 0x00, 0x29,
+  0x93, 0xa6, 0x11, 0x18, 0x20, 0x65, 0xd2, 0x34, 0x0a, 0x01, 0xa4, 0x4c, 0x9a, 0x46, 0x72, 0x87,
+  0x94, 0x49, 0xd3, 0xa0, 0x00, 0x90, 0x32, 0x69, 0x1a, 0xb4, 0x10, 0x52, 0x26, 0x4d, 0x04, 0x00,
+  0x40, 0xca, 0xa4, 0xc9, 0x54, 0x06, 0x48, 0x99, 0x34, 0x99, 0x3a, 0x01, 0x29, 0x93, 0x26, 0x56,
+  0x08, 0x20, 0x65, 0xd2, 0xe4, 0x00, 0x00, 0xa4, 0x4c, 0x9a, 0x5c, 0x21, 0x80, 0x94, 0x49, 0x93,
+  0x3b, 0x00, 0x90, 0x32, 0x69, 0x72, 0xc9, 0x1d, 0x52, 0x26, 0x4d, 0xee, 0xb9, 0x43, 0xca, 0xa4,
+  0xc9, 0x51, 0x00, 0x48, 0x99, 0x34, 0x39, 0x5a, 0x00, 0x29, 0x93, 0x26, 0x47, 0x0b, 0x21, 0x65,
+  0xd2, 0xe4, 0x68, 0x1a, 0xa4, 0x4c, 0x9a, 0x9e, 0x3b, 0x80, 0x94, 0x49, 0xd3, 0xab, 0x13, 0x90,
+  0x32, 0x69, 0x9a, 0x03, 0x00, 0x52, 0x26, 0x4d, 0xb3, 0x10, 0x40, 0xca, 0xa4, 0x69, 0x16, 0x47,
+  0x49, 0x99, 0x34, 0x4d, 0x54, 0x08, 0x29, 0x93, 0xa6, 0x99, 0x0a, 0x21, 0x65, 0xd2, 0x34, 0xd3,
+  0x2a, 0xa4, 0x4c, 0x9a, 0x66, 0x72, 0x87, 0x94, 0x49, 0xd3, 0x4c, 0x8e, 0x92, 0x32, 0x69, 0x9a,
+  0x73, 0x02, 0x52, 0x26, 0x4d, 0x93, 0x02, 0x40, 0xca, 0xa4, 0x69, 0xd2, 0x02, 0x48, 0x99, 0x34,
+  0x4d, 0x5a, 0x08, 0x29, 0x93, 0x26, 0x0a, 0x00, 0x20, 0x65, 0xd2, 0x44, 0x0b, 0x01, 0xa4, 0x4c,
+  0x9a, 0x6c, 0x21, 0x80, 0x94, 0x49, 0x93, 0x4d, 0xee, 0x90, 0x32, 0x29, 0x2b, 0x04, 0x00, 0x52,
+  0x26, 0x65, 0xc9, 0x1d, 0x40, 0xca, 0xa4, 0x2c, 0x03, 0x00, 0x48, 0x99, 0xf4, 0xa5, 0x01, 0x00,
+  0x29, 0x93, 0xbe, 0x56, 0x08, 0x20, 0x65, 0xd2, 0x27, 0x03, 0x03, 0xa4, 0x4c, 0x2a, 0x83, 0x3b,
+  0x80, 0x94, 0x49, 0x65, 0x91, 0x05, 0x90, 0x32, 0x29, 0x2d, 0x04, 0x00, 0x52, 0x26, 0xa5, 0x69,
+  0x00, 0x40, 0xca, 0xa4, 0x34, 0x39, 0x00, 0x48, 0x99, 0x94, 0x26, 0x77, 0x00, 0x29, 0x93, 0xd2,
+  0xf4, 0xea, 0x24, 0x65, 0x52, 0x9a, 0x01, 0x00, 0xa4, 0x4c, 0x5a, 0xdd, 0x01, 0x80, 0x94, 0x49,
+  0xab, 0xa3, 0x85, 0x90, 0x32, 0x69, 0x95, 0x85, 0x00, 0x52, 0x26, 0xad, 0x32, 0xb9, 0x43, 0xca,
+  0xa4, 0x55, 0xbe, 0x3a, 0x49, 0x99, 0xf4, 0xa6, 0x57, 0x27, 0x29, 0x93, 0x66, 0x00, 0x00, 0x20,
+  0x65, 0x56, 0x02, 0x00, 0x00, 0xa4, 0xcc, 0xca, 0x0a, 0x01, 0x80, 0x94, 0x59, 0xdd, 0x01, 0x00,
+  0x90, 0x32, 0xab, 0xa3, 0x85, 0x00, 0x52, 0x66, 0x95, 0xc1, 0x51, 0x40, 0xca, 0xac, 0xb2, 0x00,
+  0x00, 0x48, 0x99, 0x55, 0x16, 0x02, 0x00, 0x29, 0xb3, 0xca, 0x34, 0x00, 0x20, 0x65, 0x56, 0x99,
+  0xdc, 0x01, 0xa4, 0xcc, 0x3a, 0x29, 0x00, 0x80, 0x94, 0x59, 0x27, 0x2d, 0x04, 0x90, 0x32, 0x33,
+  0x00, 0x00, 0x00, 0x52, 0x68, 0x01, 0x00, 0x00, 0x40, 0x0a, 0x45, 0x00, 0x00, 0x00, 0x48, 0xa1,
+  0x28, 0x50, 0x00, 0x00, 0x29, 0x14, 0x15, 0x00, 0x00, 0x20, 0x85, 0xa2, 0x22, 0x93, 0x3b, 0xa4,
+  0xd0, 0x44, 0x00, 0x00, 0x80, 0x14, 0x9a, 0x1c, 0x49, 0x0e, 0x90, 0x42, 0x2b, 0x4b, 0x0e, 0x00,
+  0x52, 0x6c, 0x01, 0x00, 0x00, 0x40, 0x8a, 0x2d, 0x04, 0x00, 0x00, 0x48, 0xb1, 0x85, 0x14, 0x02,
+  0x00, 0x29, 0xb6, 0x24, 0x77, 0x00, 0x20, 0xc5, 0x16, 0x96, 0x5e, 0x2b, 0xa4, 0xd8, 0xc2, 0x32,
+  0x00, 0x80, 0x14, 0x5b, 0x5c, 0x21, 0x00, 0x90, 0x62, 0x8b, 0x3b, 0x00, 0x00, 0x52, 0x6c, 0x71,
+  0x69, 0x00, 0x40, 0x8a, 0x2d, 0x2e, 0xb9, 0x03, 0x48, 0xb1, 0xc5, 0x51, 0x00, 0x00, 0x29, 0xb6,
+  0x38, 0x9a, 0x08, 0x20, 0xc5, 0x16, 0x47, 0x93, 0x3b, 0xa4, 0xd8, 0x22, 0x0b, 0x00, 0x80, 0x14,
+  0x5b, 0x64, 0x21, 0x00, 0x90, 0x62, 0x8b, 0x7c, 0x19, 0x00, 0x52, 0x6c, 0x91, 0xb2, 0x10, 0x40,
+  0x8a, 0x2d, 0x93, 0x26, 0x77, 0x48, 0xb1, 0xe9, 0x14, 0x02, 0x00, 0x29, 0x36, 0xb9, 0xc3, 0x00,
+  0x20, 0xc5, 0x26, 0x59, 0x00, 0x00, 0xa4, 0x5c, 0x00, 0x00, 0x00, 0x80, 0x94, 0x9b, 0x68, 0x21,
+  0x00, 0x90, 0x72, 0xd9, 0xab, 0x13, 0x00, 0x52, 0xae, 0xa3, 0x85, 0x00, 0x40, 0x92, 0x0b, 0xb2,
+  0x10, 0x00, 0x48, 0x72, 0x04, 0x00, 0x00, 0x00, 0x49, 0x2e, 0x8d, 0xe0, 0x0e, 0x20, 0x89, 0x22,
+  0x9a, 0x5e, 0x9d, 0xe4, 0x3d, 0x59, 0xdc, 0x01, 0x80, 0x3c, 0x19, 0x58, 0x21, 0x00, 0x90, 0x27,
+  0xd3, 0x2c, 0x04, 0x00, 0xf2, 0xaa, 0xa3, 0x69, 0x00, 0x40, 0x2a, 0x95, 0x45, 0xbe, 0x3a, 0xc9,
+  0x2d, 0x32, 0xb9, 0x03, 0x40, 0x11, 0x13, 0xa6, 0x49, 0x01, 0x28, 0x62, 0xd2, 0x22, 0x0b, 0x01,
+  0x45, 0xe4, 0xe0, 0x0e, 0x00, 0xa0, 0x88, 0x3c, 0x0a, 0x00, 0x00, 0x14, 0x91, 0xe7, 0xa4, 0x00,
+  0x80, 0x32, 0x82, 0x4c, 0xa7, 0x00, 0x50, 0xc6, 0x08, 0x8e, 0x02, 0x00, 0xca, 0x18, 0xc9, 0xd1,
+  0x54, 0x48, 0x19, 0xa5, 0x38, 0x5a, 0x00, 0x28, 0xa3, 0x30, 0x02, 0x00, 0x00, 0x65, 0x14, 0x56,
+  0x1c, 0x4d, 0xa3, 0x8c, 0xe2, 0x4e, 0x21, 0x00, 0x94, 0x51, 0x64, 0x72, 0x00, 0x80, 0x32, 0x8a,
+  0x64, 0x65, 0xce, 0x59, 0x46, 0xac, 0xb2, 0x0c, 0x00, 0xca, 0xa0, 0xe9, 0xc9, 0x34, 0x40, 0x31,
+  0xa6, 0x00, 0x00, 0x00, 0x28, 0xc6, 0x24, 0x9a, 0x1c, 0x05, 0x85, 0x05, 0x59, 0x00, 0x00, 0xa0,
+  0xb0, 0x40, 0x8b, 0x3b, 0x00, 0x14, 0x96, 0x1c, 0x65, 0x85, 0x80, 0xc2, 0x5e, 0x2b, 0xee, 0x00,
+  0x50, 0xd8, 0xab, 0xb2, 0x10, 0x00, 0x4a, 0x13, 0xac, 0xc8, 0x42, 0x40, 0x69, 0xcf, 0x25, 0x53,
+  0x19, 0x28, 0xed, 0x49, 0x77, 0x00, 0x00, 0xa5, 0x3d, 0x8a, 0x92, 0xa3, 0xa0, 0x34, 0x18, 0x5c,
+  0x72, 0x07, 0x94, 0x06, 0x0b, 0x01, 0x00, 0x80, 0xd2, 0x60, 0x71, 0x04, 0x00, 0x50, 0x1a, 0x2c,
+  0xee, 0x00, 0x00, 0x4a, 0x83, 0x45, 0x16, 0x02, 0x40, 0x69, 0xb0, 0xc8, 0xe4, 0x0e, 0x28, 0x0d,
+  0xa6, 0x11, 0x28, 0x00, 0xa5, 0xc1, 0x34, 0x28, 0x00, 0xa0, 0x34, 0x98, 0x5c, 0x0a, 0x0c, 0x94,
+  0x06, 0x9f, 0x0c, 0xee, 0x80, 0xd2, 0xa0, 0x2c, 0x04, 0x00, 0x50, 0x1a, 0x94, 0x45, 0xa6, 0x55,
+  0x4a, 0x83, 0x32, 0x11, 0x00, 0x40, 0x69, 0x90, 0x16, 0x77, 0x00, 0x28, 0x0d, 0xd2, 0xe2, 0x68,
+  0x01, 0xa5, 0x41, 0x9a, 0x4c, 0x9d, 0xa0, 0x34, 0x98, 0x01, 0x00, 0x00, 0x14, 0x17, 0x64, 0x91,
+  0x69, 0x80, 0xe2, 0x82, 0x4c, 0x03, 0x00, 0x50, 0x5c, 0x90, 0xc9, 0xd1, 0x42, 0x8a, 0x1b, 0x45,
+  0x26, 0x47, 0x4b, 0x71, 0xa6, 0xcc, 0x49, 0x0b, 0x28, 0xee, 0xa4, 0xc0, 0x0a, 0x01, 0xc5, 0x9d,
+  0xc7, 0x32, 0x00, 0xa0, 0xb8, 0x34, 0x67, 0x1a, 0x00, 0x14, 0xf7, 0x56, 0x71, 0x00, 0x80, 0xe2,
+  0x9e, 0x4c, 0x04, 0x00, 0x50, 0xdc, 0x84, 0xc5, 0x01, 0x00, 0x8a, 0x9b, 0x14, 0x01, 0x00, 0x40,
+  0x71, 0x93, 0xa6, 0x49, 0x01, 0x28, 0x8e, 0x22, 0x00, 0x00, 0x00, 0xc5, 0x51, 0x54, 0x08, 0x00,
+  0xa0, 0x38, 0x8a, 0x68, 0x7a, 0x75, 0x16, 0x47, 0xd3, 0x28, 0x04, 0x80, 0xe2, 0x68, 0x92, 0x85,
+  0x00, 0x50, 0x1c, 0x9d, 0xb4, 0x10, 0x00, 0x8a, 0xb3, 0x45, 0xa6, 0x01, 0x40, 0x91, 0x65, 0x14,
+  0x00, 0x00, 0x28, 0xb2, 0x38, 0xc2, 0x92, 0x3b, 0x45, 0x16, 0x99, 0x26, 0x4d, 0xa3, 0xc8, 0xc7,
+  0xd8, 0x01, 0x00, 0x14, 0x8a, 0x0a, 0x00, 0x00, 0x80, 0x42, 0x1f, 0x29, 0xb2, 0x10, 0x50, 0xe8,
+  0x23, 0x19, 0x00, 0x00, 0x0a, 0x95, 0xc5, 0xa5, 0x01, 0x40, 0xa1, 0xb2, 0xb8, 0xe4, 0x00, 0x28,
+  0x55, 0xa6, 0x59, 0x08, 0x00, 0xa5, 0xca, 0x34, 0x69, 0x99, 0xa0, 0x54, 0x8a, 0x92, 0x03, 0x00,
+  0x94, 0x4a, 0xeb, 0xa4, 0x00, 0x80, 0x62, 0xd3, 0x48, 0xb3, 0x10, 0x50, 0x6c, 0x6a, 0x69, 0x22,
+  0x00, 0x8a, 0x4d, 0x32, 0xb9, 0x03, 0x40, 0xc1, 0x61, 0x94, 0x99, 0xdc, 0x29, 0x38, 0x90, 0xe4,
+  0x0e, 0x00, 0x05, 0x07, 0x77, 0x0a, 0x01, 0xa0, 0xe0, 0x20, 0x8b, 0x3b, 0x00, 0x14, 0x1c, 0x64,
+  0x1a, 0x81, 0x81, 0x82, 0xc3, 0x7c, 0x37, 0xb9, 0x53, 0x70, 0xa0, 0xc9, 0x51, 0x00, 0x0a, 0x8e,
+  0x55, 0x06, 0x77, 0x40, 0xc1, 0xb1, 0xca, 0x42, 0x00, 0x28, 0x38, 0x56, 0x59, 0x1c, 0x00, 0x05,
+  0xc7, 0x2a, 0x93, 0x3b, 0xa0, 0xe0, 0x58, 0xe5, 0xa4, 0x00, 0x14, 0x1c, 0xeb, 0x7c, 0x75, 0x82,
+  0x82, 0x2b, 0x29, 0xf2, 0x5d, 0x57, 0x70, 0x65, 0x4f, 0x16, 0x02, 0x0a, 0xae, 0x8e, 0x00, 0x00,
+  0x40, 0xc1, 0xd5, 0xd1, 0x42, 0x00, 0x28, 0xb8, 0x3a, 0x9a, 0x06, 0x00, 0x05, 0xd7, 0x89, 0x68,
+  0x1a, 0xc0, 0x84, 0xe4, 0x08, 0x00, 0x00, 0x98, 0xe0, 0x48, 0x60, 0x85, 0x00, 0x53, 0xc2, 0x40,
+  0x85, 0x00, 0x60, 0x4a, 0x20, 0x00, 0x00, 0x00, 0x4c, 0x09, 0xa7, 0xb8, 0x03, 0x80, 0x29, 0xc1,
+  0x11, 0x00, 0x00, 0x30, 0x25, 0x38, 0x9a, 0xdc, 0x01, 0xa6, 0x04, 0x19, 0xdc, 0x01, 0xc0, 0x94,
+  0x20, 0x0b, 0x49, 0xee, 0x98, 0x12, 0x64, 0x71, 0x00, 0x00, 0x53, 0x82, 0x4c, 0x2e, 0x39, 0x6a,
+  0x4a, 0x90, 0x49, 0x16, 0x02, 0x4c, 0x09, 0xf2, 0xb9, 0x03, 0x80, 0x29, 0x61, 0x06, 0x47, 0xd3,
+  0x30, 0x25, 0xcc, 0x99, 0x06, 0x00, 0xa6, 0x84, 0x49, 0x93, 0x2b, 0xc4, 0x94, 0x40, 0x0b, 0x00,
+  0x00, 0x98, 0x12, 0x68, 0x71, 0x07, 0x00, 0x53, 0x02, 0x2d, 0x8e, 0x16, 0x62, 0x4a, 0xa0, 0xc9,
+  0x01, 0x00, 0x4c, 0x09, 0x34, 0xd1, 0x42, 0x80, 0x29, 0x81, 0xd2, 0xf4, 0xea, 0x34, 0x25, 0xd8,
+  0x22, 0x0b, 0x01, 0xa6, 0x8c, 0x02, 0x00, 0x00, 0xc0, 0x94, 0x51, 0x5c, 0xa0, 0x00, 0x98, 0x32,
+  0x8a, 0x23, 0x00, 0x00, 0x53, 0x46, 0x71, 0x07, 0x00, 0x60, 0xca, 0x28, 0xb3, 0x10, 0x00, 0x4c,
+  0x19, 0x65, 0xd2, 0x02, 0x80, 0x29, 0x63, 0x15, 0x00, 0x00, 0x30, 0x65, 0x30, 0x02, 0x00, 0x00,
+  0xa6, 0x8c, 0xd7, 0xd2, 0x00, 0xc0, 0x94, 0xf1, 0x1c, 0x01, 0x00, 0x98, 0x32, 0x9e, 0x4c, 0x03,
+  0x00, 0x53, 0x4c, 0x21, 0x00, 0x00, 0x60, 0x8a, 0x29, 0x2e, 0x39, 0x0a, 0x4c, 0x31, 0xc5, 0xd1,
+  0xe4, 0xa8, 0x29, 0x86, 0xbd, 0x56, 0x08, 0x30, 0x45, 0x15, 0x00, 0x00, 0x00, 0xa6, 0x30, 0x52,
+  0x64, 0xb2, 0xc5, 0x14, 0x66, 0xaa, 0x24, 0x00, 0x98, 0xc2, 0x92, 0x23, 0x00, 0x00, 0x53, 0x58,
+  0xa2, 0x2c, 0x03, 0x60, 0x0a, 0x63, 0x45, 0xbe, 0x3a, 0x4d, 0x61, 0x8f, 0xa5, 0xc0, 0x80, 0x29,
+  0x6c, 0x16, 0x77, 0x00, 0x30, 0x85, 0xd1, 0x62, 0x2a, 0x03, 0xa6, 0xb4, 0xe0, 0xd2, 0x00, 0xc0,
+  0x94, 0x96, 0x46, 0x70, 0x07, 0x98, 0xe2, 0x42, 0x0b, 0xee, 0x00, 0x53, 0x5c, 0x70, 0xb4, 0x10,
+  0x60, 0x8a, 0x23, 0x00, 0x00, 0x00, 0x4c, 0x71, 0x24, 0x8d, 0xc0, 0x80, 0x29, 0xee, 0xa0, 0x42,
+  0x00, 0x30, 0xc5, 0xa5, 0x83, 0x0a, 0x01, 0xa6, 0xb8, 0xc7, 0x92, 0x03, 0xc0, 0x14, 0xf7, 0x64,
+  0x21, 0x00, 0x98, 0xe2, 0x9e, 0x7c, 0x75, 0x4e, 0x53, 0x64, 0x60, 0x69, 0x00, 0x60, 0x8a, 0x0c,
+  0xae, 0x10, 0x00, 0x4c, 0x91, 0x41, 0x06, 0x06, 0x80, 0x29, 0xb2, 0x00, 0x00, 0x00, 0x30, 0x45,
+  0x16, 0xf6, 0xdc, 0x01, 0xa6, 0xc8, 0xe2, 0x08, 0x00, 0xc0, 0x14, 0x99, 0x58, 0x31, 0x75, 0x9a,
+  0x32, 0x47, 0x72, 0xb4, 0x00, 0x53, 0x66, 0x71, 0xb4, 0x10, 0x60, 0xca, 0x44, 0x05, 0x00, 0x00,
+  0x4c, 0x99, 0xa8, 0xb8, 0x42, 0x80, 0x29, 0x13, 0x99, 0x2a, 0x09, 0x30, 0x65, 0xb6, 0xe0, 0x0e,
+  0x00, 0xa6, 0x4c, 0x58, 0x08, 0x00, 0xc0, 0x94, 0x09, 0x5f, 0x2b, 0x04, 0x98, 0x32, 0x29, 0x00,
+  0x00, 0x00, 0x53, 0x26, 0x2d, 0x00, 0x00, 0x60, 0xca, 0xa4, 0x85, 0x00, 0x00, 0x4c, 0x99, 0xb4,
+  0x98, 0x3a, 0x81, 0x29, 0x93, 0x16, 0x07, 0x00, 0x30, 0x65, 0xd2, 0x22, 0x0b, 0x01, 0xa6, 0x4c,
+  0x5a, 0xe4, 0xab, 0xd3, 0x94, 0x49, 0xcb, 0xa4, 0x00, 0x98, 0x32, 0x69, 0xa1, 0xa6, 0x4e, 0x53,
+  0x26, 0x45, 0x85, 0x00, 0x60, 0xca, 0xa4, 0x69, 0x04, 0x77, 0x4c, 0x99, 0x34, 0x11, 0x00, 0x80,
+  0x29, 0x93, 0x26, 0x53, 0x19, 0x30, 0x65, 0xd2, 0xe4, 0x00, 0x00, 0xa6, 0x4c, 0x9a, 0xdc, 0x01,
+  0xc0, 0x94, 0x49, 0x93, 0xa3, 0x85, 0x98, 0x32, 0x69, 0x9a, 0x14, 0x00, 0x53, 0x26, 0x9d, 0x14,
+  0x00, 0x60, 0xca, 0xac, 0x8e, 0xa6, 0x01, 0x4c, 0x12, 0xaf, 0xa5, 0x01, 0x80, 0x49, 0xa3, 0xc8,
+  0x34, 0x00, 0x30, 0x69, 0xac, 0x42, 0x00, 0x00, 0x26, 0x99, 0x12, 0xdc, 0x01, 0xc0, 0x24, 0x53,
+  0xdc, 0x29, 0x04, 0x98, 0x64, 0xd2, 0x48, 0xaf, 0x4e, 0x93, 0x0c, 0x45, 0x85, 0x00, 0x60, 0xd2,
+  0x29, 0xac, 0x00, 0x00, 0x4c, 0x3a, 0xc5, 0x11, 0x00, 0x80, 0x49, 0xa7, 0xc8, 0x42, 0x00, 0x30,
+  0xe9, 0x94, 0x99, 0x06, 0x00, 0x26, 0x9d, 0x83, 0x4c, 0x9d, 0xc0, 0xa4, 0x83, 0x00, 0x00, 0x00,
+  0x98, 0x74, 0x10, 0x01, 0x00, 0x00, 0x93, 0x0e, 0x2a, 0x04, 0x00, 0x60, 0xd2, 0x41, 0xc5, 0x1d,
+  0x00, 0x4c, 0x3a, 0x28, 0xb9, 0x03, 0x80, 0x49, 0x2c, 0x38, 0x02, 0x00, 0x30, 0x89, 0x05, 0x47,
+  0x93, 0x3b, 0x26, 0xb1, 0x91, 0x66, 0x21, 0xc0, 0x24, 0x46, 0x00, 0x00, 0x00, 0x98, 0xc4, 0x48,
+  0x71, 0xb4, 0x10, 0x93, 0x58, 0x01, 0x00, 0x00, 0x60, 0x12, 0x4b, 0x23, 0x15, 0x02, 0x4c, 0x62,
+  0xc9, 0x11, 0x00, 0x80, 0x49, 0x2c, 0x39, 0x92, 0x1c, 0x35, 0x89, 0x25, 0x77, 0x00, 0x00, 0x26,
+  0xb1, 0x44, 0x93, 0xa3, 0xc0, 0x24, 0xc6, 0x08, 0x00, 0x00, 0x98, 0xc4, 0x18, 0x4b, 0x34, 0x0d,
+  0x93, 0x18, 0x7b, 0x34, 0x39, 0x6a, 0x12, 0x7b, 0x8e, 0x02, 0x00, 0x4c, 0x62, 0x55, 0x16, 0x53,
+  0xa7, 0x49, 0x4d, 0xb0, 0x42, 0x00, 0x30, 0xa9, 0x3d, 0x02, 0x00, 0x00, 0x26, 0xb9, 0x20, 0x58,
+  0x06, 0xc0, 0x24, 0x17, 0x06, 0x00, 0x00, 0x98, 0xe4, 0xc2, 0x48, 0x03, 0x00, 0x93, 0x5c, 0x60,
+  0x81, 0x02, 0x60, 0x92, 0x0b, 0xac, 0x10, 0x00, 0x4c, 0x72, 0x41, 0x16, 0x02, 0x80, 0x49, 0x2e,
+  0x48, 0x53, 0x19, 0x30, 0xc9, 0x05, 0x99, 0x5e, 0x9d, 0x26, 0x39, 0x02, 0x00, 0x00, 0xc0, 0x24,
+  0x47, 0x0a, 0x01, 0x00, 0x98, 0xe4, 0x48, 0x71, 0x07, 0x00, 0x93, 0x1c, 0x29, 0xb2, 0x00, 0x60,
+  0x92, 0x23, 0x89, 0x15, 0x02, 0x4c, 0x72, 0x24, 0xb9, 0x03, 0x80, 0x49, 0x8e, 0x24, 0x47, 0x0b,
+  0x30, 0xc9, 0x91, 0x34, 0x29, 0x00, 0x26, 0x39, 0xc2, 0x0a, 0x01, 0xc0, 0x24, 0x47, 0x58, 0x06,
+  0x00, 0x98, 0xe4, 0x88, 0x2c, 0x04, 0x00, 0x93, 0x1c, 0x99, 0x19, 0x00, 0x60, 0x92, 0x2b, 0x00,
+  0x00, 0x00, 0x4c, 0x72, 0x85, 0x00, 0x00, 0x80, 0x49, 0xae, 0x10, 0x56, 0x08, 0x30, 0xc9, 0x15,
+  0x96, 0x01, 0x00, 0x26, 0xb9, 0xe2, 0x08, 0x00, 0xc0, 0x24, 0x57, 0x5c, 0x1a, 0x00, 0x98, 0xe4,
+  0x0a, 0x94, 0x85, 0x00, 0x93, 0x5c, 0x91, 0x85, 0x00, 0x60, 0x92, 0x2b, 0x33, 0xb9, 0x03, 0x4c,
+  0x72, 0xa7, 0x00, 0x00, 0x80, 0x49, 0xee, 0x14, 0x53, 0x27, 0x30, 0xc9, 0x9d, 0xe2, 0x68, 0x21,
+  0x26, 0xb9, 0x83, 0x0a, 0x01, 0xc0, 0x24, 0x77, 0x50, 0x1a, 0x00, 0x98, 0xe4, 0x0e, 0x4a, 0xee,
+  0x00, 0x93, 0xdc, 0x49, 0x23, 0x30, 0x60, 0x92, 0x3b, 0x55, 0x02, 0x00, 0x4c, 0x72, 0xa7, 0xca,
+  0x02, 0x80, 0x49, 0x2e, 0x8d, 0xe0, 0x0e, 0x30, 0xc9, 0x25, 0x02, 0x00, 0x00, 0x26, 0xb9, 0xc4,
+  0x0a, 0x01, 0xc0, 0x24, 0x97, 0x58, 0x06, 0x00, 0x98, 0xe4, 0x92, 0x4b, 0xc1, 0x16, 0x93, 0x5c,
+  0x9a, 0x85, 0x00, 0x60, 0x92, 0x5b, 0x85, 0x00, 0x00, 0x4c, 0x72, 0x4f, 0x06, 0x06, 0x80, 0x49,
+  0x8e, 0x22, 0x53, 0xe7, 0x34, 0xc9, 0xd1, 0xe4, 0x0e, 0x00, 0x26, 0x39, 0x9a, 0x1c, 0x2d, 0xc4,
+  0x24, 0x47, 0x93, 0xa3, 0x69, 0x98, 0xf4, 0x5a, 0x91, 0x81, 0x01, 0x93, 0x9e, 0x0c, 0x8e, 0xa6,
+  0x61, 0xd2, 0x93, 0x85, 0x00, 0x00, 0x4c, 0x82, 0x85, 0x00, 0x00, 0x80, 0x49, 0x30, 0x8d, 0x57,
+  0x27, 0x30, 0x09, 0xa6, 0x59, 0x08, 0x00, 0x26, 0xc1, 0x64, 0x0b, 0x01, 0xc0, 0x24, 0x19, 0x68,
+  0x72, 0x85, 0x98, 0x24, 0x47, 0x71, 0x00, 0x00, 0x93, 0x64, 0x61, 0xc9, 0x1d, 0x60, 0x92, 0x2c,
+  0x2e, 0x39, 0x5a, 0x4c, 0x92, 0xc5, 0xd1, 0xe4, 0x8e, 0x49, 0xb2, 0xc8, 0xe4, 0x0e, 0x30, 0x49,
+  0xa6, 0x91, 0xdc, 0x01, 0x26, 0xc9, 0x44, 0x00, 0x00, 0xc0, 0x24, 0x99, 0xdc, 0x01, 0x00, 0x98,
+  0x24, 0x93, 0xa3, 0xc9, 0x1d, 0x93, 0x64, 0xa2, 0x85, 0x00, 0x60, 0x92, 0x6c, 0x69, 0xc6, 0x3a,
+  0x4d, 0x92, 0xb4, 0xb8, 0xc0, 0x80, 0x49, 0x92, 0xa6, 0x11, 0x18, 0x30, 0x49, 0xd2, 0xe7, 0x0e,
+  0x00, 0x26, 0x4d, 0x54, 0x08, 0x00, 0xc0, 0xa4, 0x89, 0x68, 0x1a, 0x00, 0x98, 0x34, 0x21, 0x4d,
+  0x03, 0x00, 0x93, 0xe6, 0xa4, 0x69, 0x04, 0x66, 0xd2, 0xa4, 0x05, 0x00, 0x00, 0x4c, 0x9a, 0xb4,
+  0x38, 0x00, 0x80, 0x49, 0x93, 0x16, 0x77, 0x00, 0x30, 0x69, 0xd2, 0x32, 0x0b, 0x01, 0x26, 0x4d,
+  0x6a, 0x00, 0x00, 0xc0, 0xa4, 0x49, 0x4d, 0x65, 0x00, 0x98, 0x34, 0x29, 0x2a, 0x00, 0x00, 0x93,
+  0x26, 0x45, 0xc9, 0x1d, 0x60, 0xd2, 0xa4, 0x28, 0xbd, 0x3a, 0x4d, 0x9a, 0x34, 0x0d, 0x9a, 0x86,
+  0x49, 0x93, 0x26, 0x77, 0x00, 0x30, 0x69, 0xd2, 0xe4, 0x92, 0x3b, 0x26, 0x4d, 0x9a, 0x66, 0x0a,
+  0xcc, 0xa4, 0x49, 0x69, 0x72, 0x07, 0x98, 0x34, 0x69, 0x06, 0x00, 0x00, 0x93, 0x68, 0x60, 0xc9,
+  0x1d, 0x60, 0x12, 0x0d, 0x8e, 0x00, 0x00, 0x4c, 0xa2, 0xc5, 0x11, 0x00, 0x80, 0x49, 0xb4, 0xb8,
+  0xe4, 0x0e, 0x30, 0x89, 0xa2, 0xe0, 0x0e, 0x00, 0x26, 0x51, 0x54, 0x00, 0x00, 0xc0, 0x24, 0x8a,
+  0x8a, 0x03, 0x00, 0x98, 0x44, 0x51, 0x71, 0xb4, 0x10, 0x93, 0x28, 0x4a, 0xa6, 0x4e, 0x60, 0x12,
+  0x45, 0xc9, 0x51, 0x00, 0x4c, 0xa2, 0x28, 0x4d, 0x0a, 0x80, 0x49, 0x34, 0xb1, 0x64, 0x0b, 0x31,
+  0x89, 0x26, 0x77, 0x00, 0x00, 0x26, 0xd1, 0xe4, 0xce, 0xab, 0xd3, 0x24, 0xfa, 0x5a, 0x21, 0x00,
+  0x98, 0x44, 0x65, 0x21, 0x85, 0x00, 0x93, 0x28, 0x2d, 0x04, 0x00, 0x60, 0x92, 0x2d, 0x04, 0x00,
+  0x00, 0x4c, 0xb2, 0xc5, 0x11, 0x00, 0x80, 0x49, 0xb6, 0xb8, 0x34, 0x00, 0x30, 0x49, 0x87, 0x91,
+  0xdc, 0x01, 0x26, 0xe9, 0xe0, 0x68, 0x72, 0xc7, 0x24, 0x1d, 0x64, 0x21, 0x00, 0x98, 0xa4, 0x0b,
+  0x01, 0x00, 0x00, 0x93, 0x74, 0x71, 0x07, 0x00, 0x60, 0x92, 0x2e, 0xf3, 0x55, 0x06, 0x4c, 0xd2,
+  0x9a, 0x15, 0x02, 0x80, 0x49, 0x5a, 0xb3, 0x22, 0x0b, 0x31, 0x2c, 0x8c, 0xe0, 0x0e, 0x00, 0x86,
+  0x85, 0x51, 0x08, 0x00, 0xc0, 0xb0, 0x30, 0x8a, 0x03, 0x00, 0x18, 0x16, 0x46, 0x71, 0x07, 0x00,
+  0xc3, 0xc2, 0x40, 0x85, 0x00, 0x60, 0x58, 0x18, 0xc9, 0x1d, 0x00, 0x0c, 0x0b, 0x63, 0x15, 0x02,
+  0x80, 0x61, 0x61, 0x3c, 0x47, 0x0b, 0x31, 0x2c, 0x8c, 0x27, 0xcb, 0x04, 0x86, 0x85, 0x41, 0x0b,
+  0x01, 0xc0, 0xb0, 0x40, 0x00, 0x00, 0x00, 0x18, 0x16, 0x48, 0x01, 0x00, 0x00, 0xc3, 0x02, 0x29,
+  0x8e, 0xa6, 0x61, 0x58, 0x20, 0xc9, 0xd1, 0x42, 0x0c, 0x0b, 0x44, 0x16, 0x02, 0x80, 0x61, 0xe1,
+  0x14, 0x00, 0x00, 0x30, 0x2c, 0x9c, 0x42, 0x00, 0x00, 0x86, 0x85, 0x53, 0xdc, 0x01, 0xc0, 0xb0,
+  0x70, 0x8a, 0xa3, 0x05, 0x18, 0x16, 0x4e, 0x91, 0xc9, 0x51, 0xc3, 0xc2, 0x29, 0xf2, 0xd5, 0x69,
+  0x58, 0x38, 0x65, 0x16, 0x02, 0x0c, 0x0b, 0x07, 0x15, 0x02, 0x80, 0x61, 0xe1, 0xa4, 0x11, 0x18,
+  0x30, 0x2c, 0x9c, 0xe4, 0x0e, 0x00, 0x86, 0x85, 0xf3, 0x1c, 0x05, 0xc0, 0xb0, 0x70, 0xaa, 0x0c,
+  0x8e, 0x1a, 0x16, 0xd2, 0x29, 0x00, 0x00, 0xc3, 0x42, 0x72, 0x07, 0x00, 0x60, 0x58, 0x48, 0x33,
+  0xb9, 0x03, 0x0c, 0x0b, 0xab, 0xc8, 0xe4, 0x8e, 0x61, 0x81, 0x05, 0x56, 0x08, 0x30, 0x2c, 0x30,
+  0x02, 0x00, 0x00, 0x86, 0x05, 0x46, 0x58, 0x01, 0xc0, 0xb0, 0xc0, 0x08, 0x2b, 0x04, 0x18, 0x16,
+  0x58, 0x01, 0x00, 0x00, 0xc3, 0x02, 0x2b, 0x04, 0x00, 0x60, 0x58, 0x60, 0xc5, 0x01, 0x00, 0x0c,
+  0x0b, 0xac, 0xb8, 0x03, 0x80, 0x61, 0x81, 0x15, 0x47, 0xd3, 0x30, 0x2c, 0xb0, 0x22, 0x0b, 0x01,
+  0x86, 0x05, 0x56, 0x66, 0x21, 0xc0, 0xb0, 0xc0, 0x4a, 0x06, 0x00, 0x18, 0x16, 0x58, 0x1a, 0x00,
+  0x00, 0xc3, 0x02, 0x4b, 0x23, 0x30, 0x60, 0x58, 0x60, 0xc9, 0x1d, 0x00, 0x0c, 0x0b, 0x2c, 0xcd,
+  0x34, 0x80, 0x61, 0x81, 0xb1, 0x42, 0x00, 0x30, 0x2c, 0x30, 0x96, 0xdc, 0x01, 0x86, 0x05, 0xf6,
+  0x68, 0x72, 0xc0, 0xb0, 0xc0, 0x5e, 0x9d, 0x13, 0x18, 0x16, 0xd8, 0xbb, 0x19, 0x00, 0xc3, 0x42,
+  0x0b, 0xac, 0x10, 0x60, 0x58, 0x68, 0xc1, 0x1d, 0x00, 0x0c, 0x0b, 0x4d, 0xb0, 0x42, 0x80, 0x61,
+  0xa1, 0x15, 0x00, 0x00, 0x30, 0x2c, 0xb4, 0x42, 0x00, 0x00, 0x86, 0x85, 0x56, 0x1c, 0x00, 0xc0,
+  0xb0, 0xd0, 0x8a, 0x3b, 0x00, 0x18, 0x16, 0x5a, 0x71, 0x34, 0x0d, 0xc3, 0x42, 0x2b, 0x33, 0xb9,
+  0x63, 0x58, 0x68, 0x69, 0x00, 0x00, 0x0c, 0x0b, 0x2d, 0x11, 0x00, 0x80, 0x61, 0xa1, 0x25, 0x77,
+  0x00, 0x30, 0x2c, 0xb4, 0xe4, 0x68, 0x01, 0x86, 0x85, 0x96, 0x26, 0x05, 0xc0, 0xb0, 0xd0, 0x9e,
+  0x2c, 0x04, 0x18, 0x16, 0x1a, 0x44, 0x85, 0x00, 0xc3, 0x82, 0x03, 0x00, 0x00, 0x60, 0x58, 0x70,
+  0x03, 0x00, 0x00, 0x0c, 0x0b, 0x6e, 0xa4, 0x57, 0xa7, 0x61, 0xc1, 0x11, 0x00, 0x00, 0x30, 0x2c,
+  0x38, 0x52, 0x08, 0x00, 0x86, 0x05, 0x77, 0x0a, 0x01, 0xc0, 0xb0, 0xe0, 0x4e, 0x9d, 0x13, 0x18,
+  0x16, 0x5c, 0x1a, 0x00, 0x00, 0xc3, 0x82, 0x4b, 0xee, 0x00, 0x60, 0x58, 0x70, 0xc9, 0xd1, 0x02,
+  0x0c, 0x0b, 0x2e, 0x4d, 0x0a, 0x80, 0x61, 0xc1, 0x2d, 0x00, 0x00, 0x30, 0x2c, 0xb8, 0x95, 0x06,
+  0x00, 0x86, 0x05, 0xf7, 0xea, 0x04, 0xc0, 0xb0, 0xe0, 0x28, 0x00, 0x00, 0x18, 0x16, 0x1c, 0x0d,
+  0xee, 0x00, 0xc3, 0x82, 0xa3, 0x81, 0x02, 0x60, 0x58, 0x70, 0xb4, 0x00, 0x00, 0x0c, 0x0b, 0x8e,
+  0x16, 0x02, 0x80, 0x61, 0xc1, 0xd1, 0x62, 0xea, 0x34, 0x2c, 0x38, 0x5a, 0x64, 0x21, 0x86, 0x05,
+  0x47, 0xd3, 0x00, 0xc0, 0xb0, 0xe0, 0x68, 0x2a, 0x04, 0x18, 0x16, 0x1c, 0x4d, 0x0e, 0x00, 0xc3,
+  0x82, 0xa3, 0xc9, 0x1d, 0x60, 0x58, 0x70, 0x34, 0x39, 0x0a, 0x0c, 0x0b, 0x8e, 0xa6, 0x57, 0xa7,
+  0x61, 0xc1, 0x51, 0xf9, 0x2a, 0x33, 0x2c, 0x38, 0x9a, 0x01, 0x00, 0x86, 0x05, 0x58, 0x08, 0x00,
+  0xc0, 0xb0, 0x00, 0x8b, 0x3b, 0x00, 0x18, 0x16, 0x60, 0x91, 0xc1, 0x01, 0xc3, 0x02, 0x4c, 0x03,
+  0x00, 0x60, 0x58, 0x80, 0xc9, 0x1d, 0x00, 0x0c, 0x0b, 0x30, 0x39, 0x0a, 0x80, 0x61, 0x01, 0x3e,
+  0x77, 0x00, 0x30, 0x2c, 0xc0, 0x57, 0x27, 0x00, 0x86, 0x05, 0x48, 0x0b, 0x01, 0xc0, 0xb0, 0x00,
+  0x69, 0x72, 0x00, 0x18, 0x16, 0x20, 0x4d, 0xee, 0x00, 0xc3, 0x02, 0xcc, 0x00, 0x00, 0x60, 0x58,
+  0x90, 0x00, 0x00, 0x00, 0x0c, 0x0b, 0x32, 0x88, 0xe4, 0x8e, 0x61, 0x41, 0x06, 0x56, 0x08, 0x30,
+  0x2c, 0xc8, 0xc0, 0x32, 0x00, 0x86, 0x05, 0x19, 0xdc, 0x01, 0xc0, 0xb0, 0x20, 0x83, 0xa3, 0x69,
+  0x18, 0x16, 0x64, 0x90, 0xaf, 0x4e, 0xc3, 0x82, 0x0c, 0xb4, 0x10, 0x60, 0x58, 0x90, 0x81, 0xa6,
+  0x01, 0x0c, 0x0b, 0x52, 0xc8, 0x14, 0x98, 0x61, 0x41, 0x0e, 0x54, 0x08, 0x30, 0x2c, 0xc8, 0x02,
+  0x00, 0x00, 0x86, 0x05, 0x59, 0x08, 0x00, 0xc0, 0xb0, 0x20, 0x8b, 0x03, 0x00, 0x18, 0x16, 0x64,
+  0x71, 0x85, 0x00, 0xc3, 0x82, 0x2c, 0xae, 0x4c, 0x60, 0x58, 0x90, 0xc5, 0x1d, 0x00, 0x0c, 0x0b,
+  0xb2, 0xb8, 0x14, 0x9c, 0x61, 0x41, 0x16, 0x47, 0x0b, 0x30, 0x2c, 0xc8, 0xe2, 0x68, 0x1a, 0x86,
+  0x05, 0x59, 0x20, 0x05, 0xc0, 0xb0, 0x20, 0x8b, 0x0c, 0x0c, 0x18, 0x16, 0x64, 0x91, 0x85, 0x00,
+  0xc3, 0x82, 0x2c, 0xf2, 0xd5, 0x69, 0x58, 0x90, 0x65, 0xc6, 0x3a, 0x0d, 0x0b, 0xb2, 0xcc, 0x39,
+  0x81, 0x61, 0x41, 0x96, 0x49, 0x01, 0x30, 0x2c, 0xc8, 0x32, 0x69, 0x01, 0x86, 0x05, 0x99, 0x06,
+  0x00, 0xc0, 0xb0, 0x20, 0xd3, 0x08, 0x0c, 0x18, 0x16, 0x64, 0x1a, 0xb4, 0x10, 0xc3, 0x82, 0x4c,
+  0x04, 0x00, 0x60, 0x58, 0x90, 0xc9, 0x54, 0x06, 0x0c, 0x0b, 0x32, 0x99, 0x3a, 0x81, 0x61, 0x41,
+  0x26, 0x56, 0x08, 0x30, 0x2c, 0xc8, 0xe4, 0x00, 0x00, 0x86, 0x05, 0x99, 0xdc, 0x01, 0xc0, 0xb0,
+  0x20, 0x93, 0xa3, 0x00, 0x18, 0x16, 0x64, 0x72, 0xb4, 0x10, 0xc3, 0x82, 0x4c, 0xcf, 0x1d, 0x60,
+  0x58, 0x90, 0xe9, 0xd5, 0x09, 0x0c, 0x0b, 0x32, 0xcd, 0x42, 0x80, 0x61, 0x41, 0xa6, 0x89, 0x0a,
+  0x30, 0x2c, 0xc8, 0x34, 0x93, 0x3b, 0x86, 0x05, 0x99, 0x26, 0x05, 0xc0, 0xb0, 0x20, 0xd3, 0xa4,
+  0x05, 0x18, 0x16, 0x24, 0x4b, 0x03, 0x00, 0xc3, 0x82, 0x74, 0xc9, 0x51, 0x60, 0x58, 0x90, 0x8e,
+  0xa6, 0xc0, 0x0c, 0x0b, 0xd2, 0xd1, 0xe4, 0x8e, 0x61, 0x41, 0xbe, 0x56, 0x08, 0x30, 0x2c, 0xc8,
+  0xe7, 0x68, 0x01, 0x86, 0x05, 0xf9, 0x64, 0x72, 0xc7, 0xb0, 0x20, 0x9f, 0x4c, 0x8e, 0x1a, 0x16,
+  0xe4, 0xa3, 0xc9, 0x1d, 0xc3, 0x82, 0x7c, 0xf5, 0x55, 0x66, 0x58, 0x90, 0xaf, 0xca, 0x42, 0x0c,
+  0x0b, 0xf2, 0xd5, 0x09, 0x80, 0x61, 0x41, 0xbe, 0x3a, 0x27, 0x30, 0x2c, 0xc8, 0x57, 0xe7, 0x9c,
+  0x86, 0x05, 0xf9, 0x6e, 0x21, 0xc0, 0xb0, 0x20, 0x21, 0x2a, 0x13, 0x18, 0x16, 0x24, 0x4d, 0x03,
+  0x00, 0xc3, 0x82, 0xa4, 0x69, 0x15, 0x62, 0x58, 0x90, 0x55, 0x26, 0x77, 0x0c, 0x0b, 0x33, 0xb0,
+  0x42, 0x80, 0x61, 0x61, 0x06, 0x77, 0x00, 0x30, 0x2c, 0xcc, 0x40, 0x0b, 0x01, 0x86, 0x85, 0x19,
+  0x68, 0x72, 0xc7, 0xb0, 0x30, 0xc3, 0x2d, 0x04, 0x18, 0x16, 0x66, 0x01, 0x00, 0x00, 0xc3, 0xc2,
+  0x2c, 0x04, 0x00, 0x60, 0x58, 0x98, 0xc5, 0x15, 0x02, 0x0c, 0x0b, 0xb3, 0x38, 0x0a, 0x80, 0x61,
+  0x61, 0xa2, 0x02, 0x00, 0x30, 0x2c, 0x4c, 0x54, 0x08, 0x00, 0x86, 0x85, 0x89, 0xd2, 0x00, 0xc0,
+  0xb0, 0x30, 0x51, 0x72, 0x07, 0x18, 0x16, 0x26, 0x62, 0x05, 0x00, 0xc3, 0xc2, 0x44, 0xb4, 0x10,
+  0x60, 0x58, 0x98, 0x89, 0x00, 0x00, 0x0c, 0x0b, 0x73, 0x01, 0x00, 0x80, 0x61, 0x61, 0xbe, 0x56,
+  0x08, 0x30, 0x2c, 0xcc, 0xe7, 0x0e, 0x00, 0x86, 0x85, 0xf9, 0x64, 0x21, 0xc0, 0xb0, 0x30, 0x1f,
+  0x2d, 0x04, 0x18, 0x16, 0xe6, 0xab, 0x13, 0x00, 0xc3, 0xc2, 0x84, 0x69, 0x00, 0x60, 0x58, 0x98,
+  0x90, 0x16, 0x02, 0x0c, 0x0b, 0x13, 0xd2, 0xe4, 0x8e, 0x61, 0x61, 0xce, 0xe4, 0x0e, 0x30, 0x2c,
+  0xcc, 0x99, 0x1c, 0x05, 0x86, 0x85, 0x39, 0x69, 0x21, 0xc0, 0xb0, 0x30, 0x27, 0x4d, 0xee, 0x18,
+  0x16, 0xe6, 0xcc, 0x00, 0x00, 0xc3, 0xc2, 0xa4, 0x00, 0x00, 0x60, 0x58, 0x98, 0xb4, 0x00, 0x00,
+  0x0c, 0x0b, 0x93, 0x16, 0x02, 0x80, 0x61, 0x61, 0xd2, 0x22, 0x0b, 0x31, 0x2c, 0x4c, 0x9a, 0x02,
+  0x03, 0x86, 0x85, 0x49, 0xd3, 0x00, 0xc0, 0xb0, 0x30, 0x69, 0x72, 0x00, 0x18, 0x16, 0x26, 0x4d,
+  0xee, 0x00, 0xc3, 0xc2, 0xa4, 0xc9, 0x51, 0x60, 0x58, 0x98, 0x34, 0x39, 0x5a, 0x0c, 0x0b, 0x93,
+  0xa6, 0x57, 0xa7, 0x61, 0x61, 0x52, 0x16, 0x18, 0x30, 0x2c, 0x4c, 0x9a, 0x01, 0x00, 0x86, 0x05,
+  0x0a, 0x00, 0x00, 0xc0, 0xb0, 0x40, 0x83, 0x03, 0x00, 0x18, 0x16, 0x68, 0x01, 0x00, 0x00, 0xc3,
+  0x02, 0x2d, 0x04, 0x00, 0x60, 0x58, 0xa0, 0xe5, 0x00, 0x00, 0x0c, 0x0b, 0xb4, 0x38, 0x00, 0x80,
+  0x61, 0x81, 0x16, 0x77, 0x00, 0x30, 0x2c, 0xd0, 0xe2, 0x28, 0x00, 0x86, 0x05, 0x5a, 0x1c, 0x4d,
+  0xc3, 0xb0, 0x40, 0x8b, 0x7c, 0xad, 0x18, 0x16, 0x68, 0x91, 0x19, 0x00, 0xc3, 0x02, 0x45, 0x85,
+  0x00, 0x60, 0x58, 0xa0, 0x28, 0xb9, 0x03, 0x0c, 0x0b, 0x14, 0x25, 0x47, 0x8b, 0x61, 0x81, 0x22,
+  0x0a, 0x00, 0x30, 0x2c, 0x50, 0x94, 0x01, 0x00, 0x86, 0x05, 0x9a, 0x02, 0x4d, 0xc3, 0xb0, 0x40,
+  0x93, 0x48, 0xee, 0x18, 0x16, 0x68, 0x1a, 0x81, 0x01, 0xc3, 0x02, 0x4d, 0x03, 0x15, 0x62, 0x58,
+  0xa0, 0x89, 0x00, 0x00, 0x0c, 0x0b, 0x34, 0xb1, 0x42, 0x80, 0x61, 0x81, 0x26, 0x07, 0x00, 0x30,
+  0x2c, 0xd0, 0xe4, 0x0e, 0x00, 0x86, 0x05, 0x9a, 0x5c, 0x22, 0xc0, 0xb0, 0x40, 0x93, 0xa3, 0x00,
+  0x18, 0x16, 0x68, 0x72, 0xb4, 0x00, 0xc3, 0x02, 0x4d, 0x8e, 0x16, 0x62, 0x58, 0xa0, 0xe9, 0x39,
+  0x0a, 0x0c, 0x0b, 0x34, 0xbd, 0x3a, 0x81, 0x61, 0x81, 0xa6, 0x59, 0x08, 0x30, 0x2c, 0xd0, 0x34,
+  0x93, 0x2b, 0x86, 0x05, 0x9a, 0x26, 0x05, 0xc0, 0xb0, 0x40, 0x93, 0x2d, 0x04, 0x18, 0x16, 0x28,
+  0x2b, 0x04, 0x00, 0xc3, 0x02, 0x7d, 0x32, 0x30, 0x60, 0x58, 0xa0, 0x4f, 0x66, 0x00, 0x0c, 0x0b,
+  0xf4, 0xd1, 0x42, 0x80, 0x61, 0x81, 0x56, 0x96, 0xdc, 0x31, 0x2c, 0xd0, 0x2a, 0x0b, 0x01, 0x86,
+  0x05, 0x5a, 0xe5, 0xab, 0xd3, 0xb0, 0x40, 0x33, 0x00, 0x00, 0x18, 0x16, 0x6a, 0x1a, 0x00, 0x00,
+  0xc3, 0x42, 0x4d, 0xee, 0x00, 0x60, 0x58, 0xb0, 0x05, 0x00, 0x00, 0x0c, 0x0b, 0xb6, 0x10, 0x00,
+  0x80, 0x61, 0xc1, 0x16, 0x53, 0x19, 0x30, 0x2c, 0xd8, 0xe2, 0x0e, 0x00, 0x86, 0x05, 0x5b, 0x5c,
+  0x1a, 0xc0, 0xb0, 0x60, 0x8b, 0xa3, 0x69, 0x18, 0x16, 0x6c, 0x91, 0xaf, 0x4e, 0xc3, 0x02, 0x2e,
+  0x00, 0x00, 0x60, 0x58, 0xc0, 0xc9, 0x1d, 0x00, 0x0c, 0x0b, 0x38, 0xcd, 0x39, 0x81, 0x61, 0x21,
+  0x03, 0x00, 0x00, 0x30, 0x2c, 0xe8, 0x0c, 0x00, 0x00, 0x86, 0x8d, 0x22, 0x0b, 0x01, 0xc0, 0xb0,
+  0x02, 0x00, 0x00, 0x00, 0x18, 0x56, 0x82, 0x60, 0x85, 0x00, 0xc3, 0x4a, 0x10, 0x2c, 0xb9, 0x63,
+  0x58, 0x09, 0x03, 0xd1, 0x34, 0x0c, 0x2b, 0x61, 0xa4, 0x01, 0x80, 0x61, 0x25, 0xb0, 0x42, 0x00,
+  0x30, 0xac, 0x04, 0x96, 0x06, 0x00, 0x86, 0x95, 0xc0, 0x92, 0x3b, 0xc0, 0xb0, 0x12, 0x1c, 0x01,
+  0x00, 0x18, 0x56, 0x82, 0x2b, 0x04, 0x00, 0xc3, 0x4a, 0x70, 0xa7, 0x00, 0x60, 0x58, 0x09, 0x8e,
+  0x02, 0x00, 0x0c, 0x2b, 0xc1, 0xd1, 0x42, 0x80, 0x61, 0x25, 0x38, 0x9a, 0x06, 0x30, 0xac, 0x04,
+  0x47, 0x65, 0x01, 0x86, 0x95, 0x20, 0x0b, 0x01, 0xc0, 0xb0, 0x12, 0x64, 0x1a, 0x00, 0x18, 0x56,
+  0x04, 0x4b, 0x03, 0x00, 0xc3, 0x8a, 0xa8, 0x69, 0x00, 0x60, 0x58, 0x19, 0x88, 0x15, 0x02, 0x0c,
+  0x2b, 0x03, 0xd1, 0x42, 0x80, 0x61, 0x65, 0x24, 0x77, 0x00, 0x30, 0xac, 0x8c, 0x34, 0x13, 0x01,
+  0x86, 0x15, 0x02, 0x00, 0x00, 0xc0, 0xb0, 0x42, 0x8a, 0x3b, 0x00, 0x18, 0x56, 0x48, 0x71, 0xb4,
+  0x10, 0xc3, 0x0a, 0x49, 0xee, 0x00, 0x60, 0x58, 0x21, 0xc9, 0x51, 0x00, 0x0c, 0x2b, 0x05, 0x00,
+  0x00, 0x80, 0x61, 0xa5, 0x10, 0x00, 0x00, 0x30, 0xac, 0x14, 0x96, 0x06, 0x00, 0x86, 0x95, 0x22,
+  0x03, 0x03, 0xc0, 0xb0, 0x52, 0x24, 0x01, 0x00, 0x18, 0x56, 0x8a, 0x2c, 0x04, 0x00, 0xc3, 0x4a,
+  0x99, 0xb4, 0x10, 0x60, 0x58, 0x31, 0xa6, 0x32, 0x00, 0x0c, 0x2b, 0xa6, 0xb2, 0x42, 0x80, 0x61,
+  0xc5, 0x54, 0x59, 0x08, 0x30, 0xac, 0x30, 0x00, 0x00, 0x00, 0x86, 0x15, 0x46, 0x00, 0x00, 0xc0,
+  0xb0, 0xc2, 0x08, 0x2b, 0x04, 0x18, 0x56, 0x18, 0x91, 0xaf, 0x4e, 0xc3, 0x0a, 0x2b, 0x00, 0x00,
+  0x60, 0x58, 0x61, 0x85, 0x00, 0x00, 0x0c, 0x2b, 0xac, 0x38, 0x00, 0x80, 0x61, 0x85, 0x15, 0x77,
+  0x00, 0x30, 0xac, 0xb0, 0xe2, 0x28, 0x00, 0x86, 0x15, 0x96, 0x46, 0x60, 0xc0, 0xb0, 0xc2, 0x92,
+  0x3b, 0x00, 0x18, 0x56, 0x58, 0x72, 0xc9, 0x1d, 0xc3, 0x0a, 0x63, 0x85, 0x00, 0x60, 0x58, 0x61,
+  0xaf, 0xa5, 0x01, 0x0c, 0x2b, 0xec, 0xb9, 0x03, 0x80, 0x61, 0x85, 0x3d, 0x59, 0x08, 0x30, 0xac,
+  0xb0, 0x57, 0x19, 0x00, 0x86, 0x15, 0xf6, 0xea, 0x04, 0xc0, 0xb0, 0xc2, 0x5e, 0x9d, 0x13, 0x18,
+  0x56, 0x1c, 0x01, 0x00, 0x00, 0xc3, 0x8a, 0x23, 0x85, 0x00, 0x60, 0x58, 0x71, 0x24, 0x0d, 0x00,
+  0x0c, 0x2b, 0x8e, 0xb0, 0x42, 0x80, 0x61, 0xc5, 0x15, 0x77, 0x00, 0x30, 0xac, 0xb8, 0xe2, 0x28,
+  0x00, 0x86, 0x15, 0x77, 0x0a, 0x01, 0xc0, 0xb0, 0xe2, 0x4e, 0x71, 0x07, 0x18, 0x56, 0xdc, 0x29,
+  0x73, 0x02, 0xc3, 0x8a, 0x3b, 0x2e, 0x30, 0x60, 0x58, 0x71, 0x89, 0xa4, 0xc0, 0x0c, 0x2b, 0x2e,
+  0xb1, 0x42, 0x80, 0x61, 0xc5, 0x25, 0x17, 0x18, 0x30, 0xac, 0xb8, 0xe4, 0x82, 0x3b, 0x86, 0x15,
+  0x97, 0x1c, 0x05, 0xc0, 0xb0, 0xe2, 0xd2, 0x4c, 0x03, 0x18, 0x56, 0x5c, 0x9a, 0xb1, 0x4e, 0xc3,
+  0x8a, 0x7b, 0x0e, 0x00, 0x60, 0x58, 0x71, 0x14, 0x00, 0x00, 0x0c, 0x2b, 0x8e, 0x06, 0x59, 0x88,
+  0x61, 0xc5, 0xd1, 0x40, 0x0b, 0x30, 0xac, 0x38, 0x5a, 0x00, 0x00, 0x86, 0x15, 0x47, 0x0b, 0x01,
+  0xc0, 0xb0, 0xe2, 0x68, 0x71, 0x14, 0x18, 0x56, 0x1c, 0x2d, 0xb2, 0x00, 0xc3, 0x8a, 0xa3, 0x65,
+  0x02, 0x60, 0x58, 0x71, 0x34, 0x0d, 0x00, 0x0c, 0x2b, 0x8e, 0x26, 0x77, 0x80, 0x61, 0xc5, 0xd1,
+  0xf4, 0xea, 0x34, 0xac, 0xc0, 0x02, 0x00, 0x00, 0x86, 0x15, 0x58, 0x08, 0x00, 0xc0, 0xb0, 0x02,
+  0xcb, 0xa4, 0x00, 0x18, 0x56, 0x60, 0x22, 0x00, 0x00, 0xc3, 0x0a, 0x4c, 0xee, 0x00, 0x60, 0x58,
+  0x81, 0xe9, 0x55, 0x06, 0x0c, 0x2b, 0x30, 0xcd, 0x14, 0x98, 0x61, 0x05, 0xa6, 0x99, 0xdc, 0x31,
+  0xac, 0x40, 0x5a, 0x08, 0x00, 0x86, 0x15, 0x48, 0xd3, 0x00, 0xc0, 0xb0, 0x02, 0x33, 0x00, 0x00,
+  0x18, 0x56, 0x24, 0x00, 0x00, 0x00, 0xc3, 0x8a, 0x0c, 0x04, 0x00, 0x60, 0x58, 0x91, 0x81, 0x15,
+  0x02, 0x0c, 0x2b, 0x32, 0xb8, 0x03, 0x80, 0x61, 0x45, 0x06, 0x6a, 0xea, 0x34, 0xac, 0xc8, 0x40,
+  0x25, 0x01, 0x86, 0x15, 0x29, 0x58, 0x21, 0xc0, 0xb0, 0x22, 0x07, 0x2d, 0x04, 0x18, 0x56, 0x64,
+  0x01, 0x00, 0x00, 0xc3, 0x8a, 0x2c, 0x04, 0x00, 0x60, 0x58, 0x91, 0xc5, 0x54, 0x56, 0x0c, 0x2b,
+  0xb2, 0x38, 0x00, 0x80, 0x61, 0x45, 0x16, 0x77, 0x00, 0x30, 0xac, 0xc8, 0xe2, 0x92, 0x3b, 0x86,
+  0x15, 0x59, 0x1c, 0x2d, 0xc4, 0xb0, 0x22, 0x8b, 0x4c, 0xee, 0x18, 0x56, 0x64, 0x99, 0xc9, 0x1d,
+  0xc3, 0x8a, 0x4c, 0x03, 0x00, 0x60, 0x58, 0x91, 0x69, 0xd0, 0x42, 0x0c, 0x2b, 0x32, 0x99, 0xca,
+  0x80, 0x61, 0x45, 0x26, 0x53, 0x27, 0x30, 0xac, 0xc8, 0xc4, 0x92, 0xa3, 0x86, 0x15, 0x99, 0x5c,
+  0x21, 0xc0, 0xb0, 0x22, 0x93, 0x3b, 0x00, 0x18, 0x56, 0x64, 0x72, 0x14, 0x00, 0xc3, 0x8a, 0x4c,
+  0x8e, 0x16, 0x62, 0x58, 0x91, 0xc9, 0xd1, 0x34, 0x0c, 0x2b, 0x32, 0xcd, 0xe4, 0x8e, 0x61, 0x45,
+  0xa6, 0x49, 0x01, 0x30, 0xac, 0xc8, 0x64, 0xcb, 0x04, 0x86, 0x15, 0xe9, 0x0e, 0x00, 0xc0, 0xb0,
+  0x22, 0x5d, 0x72, 0x07, 0x18, 0x56, 0xa4, 0xa3, 0x89, 0x00, 0xc3, 0x8a, 0x7c, 0xad, 0x10, 0x60,
+  0x58, 0x91, 0xcf, 0x01, 0x00, 0x0c, 0x2b, 0xf2, 0xb9, 0x03, 0x80, 0x61, 0x45, 0x3e, 0x59, 0x08,
+  0x30, 0xac, 0xc8, 0x57, 0x27, 0x00, 0x86, 0x15, 0xf9, 0x6e, 0x06, 0xc0, 0xb0, 0x32, 0x83, 0x3b,
+  0x00, 0x18, 0x56, 0x66, 0x21, 0x00, 0x00, 0xc3, 0xca, 0x2c, 0xee, 0x00, 0x60, 0x58, 0x99, 0x28,
+  0xad, 0x42, 0x0c, 0x2b, 0xf3, 0x39, 0x9a, 0x86, 0x61, 0x65, 0x3e, 0x9a, 0xdc, 0x31, 0xac, 0xcc,
+  0x57, 0x61, 0x1a, 0x86, 0x95, 0x39, 0x69, 0x1a, 0xc0, 0xb0, 0x32, 0x29, 0x00, 0x00, 0x18, 0x56,
+  0x26, 0x4d, 0x03, 0x00, 0xc3, 0xca, 0xa4, 0xac, 0x10, 0x60, 0x58, 0x99, 0x54, 0x16, 0x02, 0x0c,
+  0x4b, 0x04, 0x00, 0x00, 0x80, 0x61, 0x89, 0x24, 0x02, 0x00, 0x30, 0x2c, 0x15, 0x02, 0x00, 0x00,
+  0x86, 0xa5, 0xe2, 0x68, 0x72, 0xc7, 0xb0, 0x74, 0x0a, 0x01, 0x00, 0x18, 0x96, 0x0e, 0x4a, 0xee,
+  0x00, 0xc3, 0x12, 0x23, 0x00, 0x00, 0x60, 0x58, 0x62, 0x05, 0x00, 0x00, 0x0c, 0x4b, 0xac, 0xc8,
+  0x02, 0x80, 0x61, 0x89, 0x15, 0x99, 0x01, 0x30, 0x2c, 0xb1, 0x32, 0x69, 0x1a, 0x86, 0x25, 0x96,
+  0x1c, 0x00, 0xc0, 0xb0, 0xc4, 0x9e, 0x3b, 0x00, 0x18, 0x96, 0xd8, 0x93, 0xaf, 0x4e, 0xc3, 0x52,
+  0x03, 0x00, 0x00, 0x60, 0x58, 0x6a, 0x81, 0x01, 0x00, 0x0c, 0x4b, 0x2d, 0xb8, 0x03, 0x80, 0x61,
+  0xa9, 0x05, 0x47, 0x0b, 0x31, 0x2c, 0xb5, 0xe0, 0x68, 0x1a, 0x86, 0xa5, 0x16, 0x26, 0x05, 0xc0,
+  0xb0, 0xd4, 0x02, 0x2d, 0x04, 0x18, 0x96, 0x5a, 0x21, 0x00, 0x00, 0xc3, 0x52, 0x2b, 0xee, 0x00,
+  0x60, 0x58, 0x6a, 0xc9, 0x1d, 0x00, 0x0c, 0x4b, 0x2d, 0xb9, 0xe4, 0x8e, 0x61, 0xa9, 0x25, 0x47,
+  0x01, 0x30, 0x2c, 0x35, 0x98, 0x5e, 0x9d, 0x86, 0xa5, 0x06, 0x65, 0x21, 0xc0, 0xb0, 0xe4, 0x82,
+  0xa3, 0x00, 0x18, 0x96, 0x1c, 0x01, 0x00, 0x00, 0xc3, 0x92, 0x23, 0x85, 0x00, 0x60, 0x58, 0x72,
+  0x24, 0x03, 0x00, 0x0c, 0x4b, 0xee, 0x14, 0x00, 0x80, 0x61, 0xc9, 0x9d, 0x42, 0x00, 0x30, 0x2c,
+  0xb9, 0x53, 0x64, 0x21, 0x86, 0x25, 0x77, 0x50, 0x21, 0xc0, 0xb0, 0xe4, 0xd2, 0x08, 0x0c, 0x18,
+  0x96, 0x5c, 0x22, 0x00, 0x00, 0xc3, 0x92, 0x4b, 0xae, 0x00, 0x60, 0x58, 0x72, 0x69, 0x52, 0x00,
+  0x0c, 0x4b, 0xee, 0xb9, 0x03, 0x80, 0x61, 0xc9, 0x51, 0x00, 0x00, 0x30, 0x2c, 0x39, 0x1a, 0x18,
+  0x00, 0x86, 0x25, 0x47, 0x0b, 0x00, 0xc0, 0xb0, 0xe4, 0x68, 0x21, 0x00, 0x18, 0x96, 0x1c, 0x2d,
+  0xee, 0x00, 0xc3, 0x92, 0xa3, 0x69, 0x00, 0x60, 0x58, 0x72, 0x34, 0xb9, 0x42, 0x0c, 0x4b, 0x8e,
+  0x26, 0x77, 0x80, 0x61, 0xc9, 0xd1, 0xf4, 0xea, 0x34, 0x2c, 0x39, 0xca, 0x0a, 0x01, 0x86, 0x25,
+  0x47, 0x59, 0x06, 0xc0, 0xb0, 0xe4, 0xe8, 0xab, 0x0c, 0x18, 0x96, 0x1c, 0xcd, 0x00, 0x00, 0xc3,
+  0x92, 0x0c, 0xb4, 0x10, 0x60, 0x58, 0x92, 0x05, 0x00, 0x00, 0x0c, 0x4b, 0x32, 0xb9, 0x03, 0x80,
+  0x61, 0x49, 0x3e, 0x96, 0x01, 0x30, 0x2c, 0xcd, 0x20, 0x18, 0x00, 0x86, 0xa5, 0x19, 0xdc, 0x01,
+  0xc0, 0xb0, 0x34, 0x0b, 0x01, 0x00, 0x18, 0x96, 0x66, 0x71, 0x07, 0x00, 0xc3, 0xd2, 0x44, 0xc1,
+  0x1d, 0x60, 0x58, 0x9a, 0xa8, 0x10, 0x00, 0x0c, 0x4b, 0x13, 0x99, 0x3a, 0x81, 0x61, 0x69, 0x26,
+  0x77, 0x00, 0x30, 0x2c, 0xcd, 0x27, 0xd3, 0x00, 0x86, 0xa5, 0xf9, 0xea, 0x9c, 0xc0, 0xb0, 0x34,
+  0xdf, 0x2d, 0x04, 0x18, 0x96, 0xe6, 0x4c, 0x03, 0x00, 0xc3, 0xd2, 0x9c, 0xc9, 0x1d, 0x60, 0x58,
+  0x9a, 0x14, 0x00, 0x00, 0x0c, 0x4b, 0x93, 0x16, 0x02, 0x80, 0x61, 0x69, 0xd2, 0x32, 0x01, 0x30,
+  0x2c, 0x4d, 0x9a, 0x06, 0x00, 0x86, 0xa5, 0x49, 0xd3, 0x08, 0xcc, 0xb0, 0x34, 0x69, 0x72, 0x07,
+  0x18, 0x96, 0x26, 0x4d, 0x8e, 0x02, 0xc3, 0xd2, 0xa4, 0xe9, 0xd5, 0x69, 0x58, 0x9a, 0x94, 0x01,
+  0x00, 0x0c, 0x4b, 0x93, 0xb2, 0x42, 0x80, 0x61, 0x69, 0x52, 0x56, 0xdc, 0x31, 0x2c, 0x4d, 0x2a,
+  0x5f, 0x9d, 0x86, 0x25, 0x0a, 0x00, 0x00, 0xc0, 0xb0, 0x44, 0x0b, 0x01, 0x00, 0x18, 0x96, 0x68,
+  0x21, 0x69, 0x00, 0xc3, 0x12, 0x2d, 0xee, 0x00, 0x60, 0x58, 0xa2, 0xa6, 0x4e, 0x00, 0x0c, 0x4b,
+  0x14, 0x15, 0x02, 0x80, 0x61, 0x89, 0xa2, 0x0c, 0x00, 0x30, 0x2c, 0xd1, 0xc4, 0x0a, 0x01, 0x86,
+  0x25, 0x9a, 0x1c, 0x00, 0xc0, 0xb0, 0x44, 0x93, 0x3b, 0x00, 0x18, 0x96, 0x28, 0x2b, 0x04, 0x00,
+  0xc3, 0x12, 0xad, 0x8e, 0x02, 0x60, 0x58, 0xa2, 0x19, 0x00, 0x00, 0x0c, 0x4b, 0xb6, 0xb8, 0x42,
+  0x80, 0x61, 0x2c, 0xb1, 0x42, 0x00, 0x30, 0xec, 0x85, 0x81, 0x68, 0x1a, 0x86, 0xbd, 0x30, 0x68,
+  0x1a, 0xc0, 0xb0, 0x17, 0x58, 0x06, 0x00, 0x18, 0xf6, 0x82, 0x3b, 0x00, 0x00, 0xc3, 0xde, 0x40,
+  0x69, 0x04, 0x66, 0xd8, 0x23, 0x00, 0x00, 0x00, 0x0c, 0x7b, 0xa4, 0x00, 0x00, 0x80, 0x61, 0x8f,
+  0x14, 0x02, 0x00, 0x30, 0xec, 0x91, 0xe2, 0x0a, 0x01, 0x86, 0x3d, 0x92, 0x1c, 0x05, 0xc0, 0xb0,
+  0x47, 0x58, 0x21, 0x00, 0x18, 0xf6, 0x08, 0x4b, 0x8e, 0x02, 0xc3, 0x1e, 0x91, 0x85, 0x00, 0x60,
+  0xd8, 0x33, 0xa6, 0x4e, 0x00, 0x0c, 0x7b, 0x69, 0x14, 0x02, 0x80, 0x61, 0x2f, 0x8d, 0xe4, 0x0e,
+  0x30, 0xec, 0xa5, 0x53, 0x08, 0x00, 0x86, 0xbd, 0xc4, 0x0a, 0x01, 0xc0, 0xb0, 0x97, 0xdc, 0x01,
+  0x00, 0x18, 0xf6, 0xd2, 0x4c, 0x03, 0x00, 0xc3, 0x5e, 0x9a, 0x14, 0x00, 0x60, 0xd8, 0x63, 0x84,
+  0x15, 0x02, 0x0c, 0x7b, 0xac, 0x00, 0x00, 0x80, 0x61, 0x8f, 0x15, 0x02, 0x00, 0x30, 0xec, 0xb1,
+  0xe2, 0x68, 0x21, 0x86, 0x3d, 0x56, 0x26, 0x4d, 0xc3, 0xb0, 0xc7, 0x12, 0x01, 0x00, 0x18, 0xf6,
+  0x58, 0x9a, 0x73, 0x02, 0xc3, 0x1e, 0x7b, 0xee, 0x00, 0x60, 0xd8, 0x63, 0x4f, 0x06, 0x06, 0x0c,
+  0x7b, 0xec, 0xc9, 0x42, 0x80, 0x61, 0x8f, 0xbd, 0x9b, 0x02, 0x33, 0xec, 0x35, 0x00, 0x00, 0x00,
+  0x86, 0xbd, 0x16, 0x46, 0x70, 0xc7, 0xb0, 0xd7, 0x02, 0x01, 0x00, 0x18, 0xf6, 0x5a, 0x70, 0x07,
+  0x00, 0xc3, 0x5e, 0x0b, 0xf2, 0xd5, 0x69, 0xd8, 0x6b, 0x81, 0x16, 0x02, 0x0c, 0x7b, 0x2d, 0xd0,
+  0xe4, 0xa8, 0x61, 0xaf, 0x15, 0x00, 0x00, 0x30, 0xec, 0xb5, 0x42, 0x00, 0x00, 0x86, 0xbd, 0x56,
+  0x88, 0xcc, 0xc0, 0xb0, 0xd7, 0x8a, 0x03, 0x00, 0x18, 0xf6, 0x5a, 0x71, 0x85, 0x00, 0xc3, 0x5e,
+  0x2b, 0x8e, 0xa6, 0x61, 0xd8, 0x6b, 0x45, 0xa6, 0x01, 0x0c, 0x7b, 0x2d, 0x0d, 0x00, 0x80, 0x61,
+  0xaf, 0xa5, 0x41, 0x01, 0x30, 0xec, 0xb5, 0xe4, 0x0e, 0x00, 0x86, 0xbd, 0x96, 0x1c, 0x05, 0xc0,
+  0xb0, 0xd7, 0xd2, 0x2c, 0x04, 0x18, 0xf6, 0x5a, 0x9a, 0xc9, 0x1d, 0xc3, 0x5e, 0x4b, 0xf3, 0xd5,
+  0x69, 0xd8, 0x6b, 0xaf, 0x15, 0x77, 0x0c, 0x7b, 0xed, 0xb9, 0x03, 0x80, 0x61, 0xaf, 0xc1, 0x34,
+  0x00, 0x30, 0xec, 0x35, 0x98, 0x01, 0x00, 0x86, 0xbd, 0x96, 0x01, 0x00, 0xc0, 0xb0, 0xe7, 0x82,
+  0x3b, 0x00, 0x18, 0xf6, 0x1c, 0x01, 0x00, 0x00, 0xc3, 0x9e, 0x23, 0x69, 0x00, 0x60, 0xd8, 0x73,
+  0xa7, 0x10, 0x00, 0x0c, 0x7b, 0x8e, 0x16, 0x02, 0x80, 0x61, 0xcf, 0xd1, 0x22, 0x0b, 0x31, 0xec,
+  0x39, 0x9a, 0xdc, 0x01, 0x86, 0x3d, 0x47, 0x93, 0xa3, 0xc0, 0xb0, 0xe7, 0x28, 0x2b, 0x04, 0x18,
+  0xf6, 0x1c, 0x65, 0xc9, 0x1d, 0xc3, 0xde, 0x63, 0x69, 0x00, 0x60, 0xd8, 0x7b, 0x2c, 0xb9, 0x42,
+  0x0c, 0x7b, 0xaf, 0x15, 0x02, 0x80, 0x61, 0xef, 0x39, 0x02, 0x00, 0x30, 0xec, 0x3d, 0x77, 0x0a,
+  0x01, 0x86, 0xbd, 0x27, 0x0b, 0x01, 0xc0, 0xb0, 0xf7, 0x64, 0x71, 0x07, 0x18, 0xf6, 0x9e, 0x4c,
+  0x03, 0x00, 0xc3, 0xde, 0x93, 0xc9, 0x1d, 0x60, 0xd8, 0x83, 0x8f, 0x15, 0x02, 0x0c, 0x7b, 0x30,
+  0x03, 0x00, 0x80, 0x61, 0x4f, 0x02, 0x00, 0x00, 0x30, 0xec, 0xc9, 0x40, 0x00, 0x00, 0x86, 0x3d,
+  0x19, 0x58, 0x21, 0xc0, 0xb0, 0x27, 0x03, 0x4b, 0xee, 0x18, 0xf6, 0x64, 0x60, 0x19, 0x00, 0xc3,
+  0x9e, 0x0c, 0x0e, 0x00, 0x60, 0xd8, 0x93, 0xc1, 0x1d, 0x00, 0x0c, 0x7b, 0x32, 0xd0, 0x14, 0x98,
+  0x61, 0x4f, 0x12, 0x00, 0x00, 0x30, 0xec, 0xc9, 0x02, 0x00, 0x00, 0x86, 0x3d, 0x59, 0x82, 0x2c,
+  0xc0, 0xb0, 0x27, 0x0b, 0x01, 0x00, 0x18, 0xf6, 0x64, 0x71, 0x00, 0x00, 0xc3, 0x9e, 0x2c, 0xee,
+  0x00, 0x60, 0xd8, 0x93, 0xc5, 0xd1, 0x34, 0x0c, 0x7b, 0xb2, 0xc8, 0xe4, 0x8e, 0x61, 0x4f, 0x16,
+  0xe9, 0x0e, 0x30, 0xec, 0xc9, 0x32, 0xd3, 0x00, 0x86, 0x3d, 0x99, 0x06, 0x00, 0xc0, 0xb0, 0x27,
+  0x13, 0x01, 0x00, 0x18, 0xf6, 0x64, 0x62, 0x00, 0x00, 0xc3, 0x9e, 0x4c, 0x0e, 0x00, 0x60, 0xd8,
+  0x93, 0xc9, 0x1d, 0x00, 0x0c, 0x7b, 0x32, 0x39, 0x0a, 0x80, 0x61, 0x4f, 0xa6, 0x57, 0x19, 0x30,
+  0xec, 0xc9, 0x34, 0x0b, 0x01, 0x86, 0x3d, 0x99, 0x26, 0x2d, 0xc0, 0xb0, 0x27, 0xd3, 0xa4, 0x85,
+  0x18, 0xf6, 0x64, 0xb2, 0x85, 0x00, 0xc3, 0x9e, 0x64, 0x65, 0x02, 0x60, 0xd8, 0x93, 0x2f, 0xb9,
+  0x03, 0x0c, 0x7b, 0xf2, 0xb5, 0x02, 0x80, 0x61, 0x4f, 0x3e, 0x99, 0xdc, 0x31, 0xec, 0xc9, 0x57,
+  0xe7, 0x04, 0x86, 0x3d, 0x29, 0x0b, 0x01, 0xc0, 0xb0, 0x37, 0x8b, 0x3b, 0x00, 0x18, 0xf6, 0x28,
+  0x00, 0x00, 0x00, 0xc3, 0x1e, 0x0d, 0x14, 0x00, 0x60, 0xd8, 0xa3, 0x05, 0x00, 0x00, 0x0c, 0x7b,
+  0xb4, 0x10, 0x00, 0x80, 0x61, 0x8f, 0x16, 0x77, 0x00, 0x30, 0xec, 0x51, 0x94, 0xdc, 0x01, 0x86,
+  0x3d, 0x9a, 0x06, 0x00, 0xc0, 0xb0, 0x47, 0xd3, 0x08, 0x0c, 0x18, 0xf6, 0x68, 0x32, 0x95, 0x01,
+  0xc3, 0x1e, 0x4d, 0x0e, 0x00, 0x60, 0xd8, 0xa3, 0xc9, 0x1d, 0x00, 0x0c, 0x7b, 0x34, 0x39, 0x0a,
+  0x80, 0x61, 0x8f, 0x26, 0x47, 0xd3, 0x30, 0xec, 0xd1, 0x44, 0x0b, 0x01, 0x86, 0x3d, 0x4a, 0x93,
+  0x3b, 0xc0, 0xb0, 0x47, 0x29, 0x2b, 0xee, 0x18, 0xf6, 0x2a, 0x01, 0x00, 0x00, 0xc3, 0x5e, 0x25,
+  0x05, 0x00, 0x60, 0xd8, 0xab, 0x2c, 0x0d, 0x00, 0x0c, 0x7b, 0x95, 0x25, 0x07, 0x80, 0x61, 0xaf,
+  0xb2, 0xe4, 0x28, 0x30, 0xec, 0x55, 0x47, 0x00, 0x00, 0x86, 0xbd, 0xea, 0x0e, 0x00, 0xc0, 0xb0,
+  0x57, 0x5d, 0x7a, 0x75, 0x1a, 0xf6, 0xaa, 0x0c, 0x8e, 0x16, 0xc3, 0x5e, 0x95, 0x81, 0x02, 0x60,
+  0xd8, 0xab, 0x32, 0xd0, 0x42, 0x0c, 0x7b, 0x55, 0x16, 0x02, 0x80, 0x61, 0xaf, 0xca, 0xe2, 0x0e,
+  0x30, 0xec, 0x55, 0x99, 0x06, 0x00, 0x86, 0xbd, 0x2a, 0x93, 0x3b, 0xc0, 0xb0, 0x57, 0x67, 0x72,
+  0x00, 0x18, 0xf6, 0xea, 0xa4, 0x00, 0x00, 0xc3, 0x5e, 0x9d, 0xb4, 0x10, 0x60, 0xd8, 0xab, 0x93,
+  0x26, 0x77, 0x0c, 0x7b, 0xb6, 0x00, 0x00, 0x80, 0x61, 0xcf, 0x16, 0x02, 0x00, 0x30, 0xec, 0xd9,
+  0xe2, 0x0e, 0x00, 0x86, 0x3d, 0x5b, 0x64, 0x21, 0xc0, 0xb0, 0x77, 0x01, 0x00, 0x00, 0x18, 0xf6,
+  0x6e, 0x70, 0x07, 0x00, 0xc3, 0xde, 0x0d, 0x8e, 0xa6, 0x61, 0xd8, 0xbb, 0x81, 0x02, 0x00, 0x0c,
+  0x7b, 0xb7, 0x10, 0x00, 0x80, 0x61, 0xef, 0x16, 0x77, 0x00, 0x30, 0xec, 0xdd, 0xe2, 0x68, 0x01,
+  0x86, 0xbd, 0xcb, 0x00, 0x00, 0xc0, 0xb0, 0x77, 0x59, 0x21, 0x00, 0x18, 0xf6, 0x2e, 0x4b, 0xcf,
+  0x01, 0xc3, 0xde, 0x75, 0x07, 0x00, 0x60, 0xd8, 0xbb, 0xee, 0x30, 0x00, 0x0c, 0x7b, 0x19, 0x00,
+  0x00, 0x80, 0x61, 0x95, 0x00, 0x00, 0x00, 0x30, 0xac, 0x92, 0xe2, 0x00, 0x00, 0x86, 0x55, 0x52,
+  0x1c, 0x2d, 0xc4, 0xb0, 0x5a, 0xd8, 0x01, 0x00, 0x18, 0x56, 0x4d, 0x95, 0xab, 0x00, 0xc3, 0xaa,
+  0xa9, 0xf2, 0xd5, 0x69, 0x58, 0x4d, 0x81, 0x02, 0x00, 0x0c, 0xab, 0xc9, 0x1d, 0x00, 0x80, 0x61,
+  0x35, 0x39, 0x9a, 0xdc, 0x31, 0xac, 0xa6, 0x99, 0x5e, 0x9d, 0x86, 0x55, 0x96, 0x08, 0x00, 0xc0,
+  0xb0, 0xda, 0x92, 0xa3, 0x85, 0x18, 0x56, 0x1d, 0x01, 0x00, 0x00, 0xc3, 0xaa, 0x23, 0xc9, 0x01,
+  0x60, 0x58, 0x75, 0x84, 0x15, 0x02, 0x0c, 0xab, 0xee, 0x14, 0x02, 0x80, 0x61, 0xd5, 0xa5, 0x01,
+  0x00, 0x30, 0xac, 0xba, 0xe4, 0x0e, 0x00, 0x86, 0x55, 0x97, 0x66, 0x21, 0xc0, 0xb0, 0xea, 0xd2,
+  0x4c, 0x03, 0x18, 0x56, 0x1d, 0x2b, 0x00, 0x00, 0xc3, 0xaa, 0xa3, 0x00, 0x00, 0x60, 0x58, 0x75,
+  0xb4, 0x10, 0x00, 0x0c, 0xab, 0x8e, 0x9a, 0xca, 0x80, 0x61, 0xd5, 0xd1, 0xe4, 0x0e, 0x30, 0xac,
+  0x3a, 0x9a, 0x1c, 0x2d, 0x86, 0x55, 0x47, 0xd3, 0xab, 0xcc, 0xb0, 0xea, 0x68, 0x7a, 0x75, 0x1a,
+  0x56, 0x1d, 0x65, 0x85, 0x00, 0xc3, 0xaa, 0xa3, 0x32, 0xb9, 0x63, 0x58, 0x75, 0x34, 0x03, 0x00,
+  0x0c, 0xab, 0xb2, 0x10, 0x00, 0x80, 0x61, 0x55, 0x16, 0x47, 0x01, 0x30, 0xac, 0xca, 0xe4, 0x00,
+  0x00, 0x86, 0xd5, 0x59, 0x08, 0x00, 0xc0, 0xb0, 0x3a, 0x8b, 0xa3, 0x69, 0x18, 0x56, 0x27, 0x32,
+  0x95, 0x01, 0xc3, 0xea, 0x44, 0xc9, 0x1d, 0x60, 0x58, 0x9d, 0x4f, 0x26, 0x47, 0x0d, 0xab, 0xf3,
+  0x55, 0x06, 0x80, 0x61, 0x75, 0xd2, 0x42, 0x00, 0x30, 0xac, 0x4e, 0x9a, 0x06, 0x00, 0x86, 0xd5,
+  0x49, 0x53, 0x21, 0xc0, 0xb0, 0x3a, 0x69, 0x72, 0x14, 0x98, 0x17, 0x64, 0x71, 0x07, 0x00, 0xf3,
+  0x82, 0x2c, 0xb2, 0x10, 0x60, 0x5e, 0x98, 0x28, 0x0d, 0x00, 0xcc, 0x0b, 0xb6, 0x38, 0x5a, 0x88,
+  0x79, 0x24, 0x64, 0x00, 0x00, 0x30, 0x8f, 0x14, 0x02, 0x00, 0x00, 0xe6, 0x15, 0x47, 0x00, 0x00,
+  0xc0, 0xbc, 0xe2, 0x32, 0x00, 0x00, 0x98, 0x57, 0x68, 0x9a, 0xb4, 0x10, 0xf3, 0x4c, 0x11, 0xac,
+  0x10, 0x60, 0x9e, 0xa9, 0x32, 0x85, 0xeb, 0xcc, 0x3b, 0x81, 0x15, 0x02, 0x80, 0x79, 0xa7, 0xb8,
+  0xe4, 0x0e, 0x30, 0xef, 0x94, 0x49, 0x0b, 0x00, 0xe6, 0x9d, 0xe3, 0x08, 0x00, 0xc0, 0xbc, 0x83,
+  0xd2, 0x00, 0x00, 0x98, 0x77, 0xd2, 0x48, 0xee, 0x00, 0xf3, 0x50, 0x58, 0x85, 0x00, 0x60, 0x1e,
+  0x2a, 0x8e, 0x00, 0x00, 0xcc, 0x43, 0xc5, 0x1d, 0x06, 0x80, 0x79, 0xa8, 0xb8, 0xe4, 0x0e, 0x30,
+  0x0f, 0x15, 0x99, 0x18, 0x00, 0xe6, 0xa1, 0x27, 0x0b, 0x01, 0xc0, 0x3c, 0x16, 0x04, 0x2b, 0x04,
+  0x98, 0xc7, 0xc2, 0xa0, 0x00, 0x00, 0xf3, 0x58, 0x60, 0x69, 0x00, 0x60, 0x1e, 0x0b, 0x2c, 0xb9,
+  0x03, 0xcc, 0x63, 0xc1, 0x1d, 0x00, 0x80, 0x79, 0x2c, 0xb8, 0x34, 0x00, 0x30, 0x8f, 0x05, 0x59,
+  0x26, 0x00, 0xe6, 0xb1, 0x20, 0xd3, 0x00, 0xc0, 0x3c, 0x16, 0x68, 0x71, 0x07, 0x98, 0xc7, 0x02,
+  0x4d, 0x8e, 0x16, 0xf3, 0xd8, 0x40, 0x85, 0x00, 0x60, 0x1e, 0x1b, 0xc9, 0x1d, 0x00, 0xcc, 0x63,
+  0x04, 0x00, 0x00, 0x80, 0x79, 0x8c, 0x14, 0x02, 0x00, 0x30, 0x8f, 0x91, 0xe4, 0x0e, 0x00, 0xe6,
+  0x31, 0xc2, 0x92, 0x03, 0xc0, 0x3c, 0x46, 0x58, 0x72, 0x07, 0x98, 0xc7, 0x0a, 0x00, 0x00, 0x00,
+  0xf3, 0x58, 0x71, 0x34, 0x39, 0x6a, 0x1e, 0x2b, 0x32, 0x30, 0x00, 0xcc, 0x63, 0xe6, 0xd5, 0x39,
+  0x81, 0x79, 0xcc, 0x54, 0x19, 0x18, 0x30, 0x8f, 0x99, 0x2a, 0x0b, 0x00, 0xe6, 0xb1, 0x14, 0x1c,
+  0x2d, 0xc4, 0x3c, 0x96, 0x46, 0x70, 0x07, 0x98, 0xc7, 0xd2, 0x08, 0x34, 0x0d, 0xf3, 0x58, 0x1a,
+  0x85, 0x00, 0x60, 0x1e, 0x4b, 0x03, 0x51, 0x00, 0xcc, 0x63, 0x69, 0x24, 0x77, 0x80, 0x79, 0x2c,
+  0x8d, 0x57, 0x19, 0x30, 0x8f, 0xa5, 0x41, 0x53, 0x60, 0xe6, 0xb1, 0x34, 0x68, 0x72, 0xc7, 0x3c,
+  0x96, 0x08, 0x00, 0x00, 0x98, 0xc7, 0x12, 0x61, 0x85, 0x00, 0xf3, 0x58, 0x3a, 0x05, 0x00, 0x60,
+  0x1e, 0x4b, 0x8e, 0x00, 0x00, 0xcc, 0x63, 0xc9, 0x15, 0x02, 0x80, 0x79, 0x2c, 0xb9, 0xe4, 0x0a,
+  0x31, 0x8f, 0x25, 0x47, 0x01, 0x00, 0xe6, 0xb1, 0xe4, 0x68, 0x01, 0xc0, 0x3c, 0x96, 0x66, 0x21,
+  0x00, 0x98, 0xc7, 0xd2, 0x2c, 0x13, 0x00, 0xf3, 0x58, 0x9a, 0x0c, 0x00, 0x60, 0x1e, 0x4b, 0x93,
+  0x26, 0x77, 0xcc, 0x63, 0x89, 0xa6, 0x57, 0xa7, 0x79, 0x8c, 0x15, 0x02, 0x00, 0x30, 0x8f, 0xb1,
+  0xe2, 0x0e, 0x00, 0xe6, 0x31, 0x56, 0x64, 0x60, 0xc0, 0x3c, 0xc6, 0x58, 0x7a, 0x75, 0x9a, 0xc7,
+  0xd8, 0x93, 0xcf, 0x1d, 0xf3, 0x18, 0x7b, 0xf2, 0xd5, 0x69, 0x1e, 0x6b, 0xc1, 0x1d, 0x00, 0xcc,
+  0x63, 0xad, 0x10, 0x00, 0x80, 0x79, 0xac, 0x25, 0x07, 0x00, 0x30, 0x8f, 0xbd, 0x96, 0x06, 0x00,
+  0xe6, 0xb1, 0x27, 0x03, 0x03, 0xc0, 0x3c, 0xf6, 0x64, 0x21, 0x00, 0x98, 0xc7, 0x9e, 0x2c, 0x14,
+  0x00, 0xf3, 0xd8, 0x93, 0x93, 0x02, 0x60, 0x1e, 0x9b, 0xb4, 0x10, 0x00, 0xcc, 0x63, 0x55, 0x26,
+  0x47, 0x8b, 0x79, 0xac, 0x4e, 0x0a, 0x00, 0x30, 0x8f, 0x65, 0x00, 0x00, 0x00, 0xe6, 0xb5, 0xc0,
+  0x92, 0x3b, 0xc0, 0xbc, 0x16, 0x5c, 0x72, 0x00, 0x98, 0xd7, 0x82, 0xa3, 0x69, 0x00, 0xf3, 0x5a,
+  0x70, 0x34, 0x39, 0x6a, 0x5e, 0x13, 0x81, 0x15, 0x02, 0xcc, 0x6b, 0x22, 0xb8, 0x03, 0x80, 0x79,
+  0x4d, 0xb0, 0x34, 0x00, 0x30, 0xaf, 0x15, 0x00, 0x00, 0x00, 0xe6, 0xb5, 0x42, 0x00, 0x00, 0xc0,
+  0xbc, 0x56, 0x58, 0x72, 0x00, 0x98, 0xd7, 0x8a, 0x3b, 0x00, 0x00, 0xf3, 0x5a, 0x71, 0xac, 0xcc,
+  0x69, 0x5e, 0x4b, 0x81, 0x00, 0x00, 0xcc, 0x6b, 0x69, 0x00, 0x00, 0x80, 0x79, 0x2d, 0x8d, 0xe0,
+  0x28, 0x30, 0xaf, 0xa5, 0x91, 0xdc, 0x01, 0xe6, 0xb5, 0xc4, 0x0a, 0x00, 0xc0, 0xbc, 0x96, 0x5c,
+  0x70, 0x07, 0x98, 0xd7, 0x92, 0x23, 0x00, 0x00, 0xf3, 0x5a, 0x72, 0x24, 0x11, 0x60, 0x5e, 0x4b,
+  0xae, 0x10, 0x00, 0xcc, 0x6b, 0xc9, 0x1d, 0x00, 0x80, 0x79, 0x2d, 0xb9, 0x54, 0x08, 0x30, 0xaf,
+  0x25, 0x97, 0x1c, 0x00, 0xe6, 0xb5, 0xe4, 0x92, 0x3b, 0xc0, 0xbc, 0x96, 0x5c, 0x9d, 0x00, 0x98,
+  0xd7, 0xd2, 0x2c, 0x04, 0x00, 0xf3, 0x5a, 0x9a, 0xc9, 0x1d, 0x60, 0x5e, 0x4b, 0x34, 0x39, 0x00,
+  0xcc, 0x6b, 0xb0, 0x10, 0x00, 0x80, 0x79, 0x0d, 0x16, 0x47, 0xd3, 0x30, 0xaf, 0x41, 0x54, 0x08,
+  0x00, 0xe6, 0x35, 0x98, 0xdc, 0x01, 0xc0, 0xbc, 0x06, 0x93, 0xa3, 0x00, 0x98, 0xd7, 0xe0, 0xa3,
+  0xa8, 0x10, 0xf3, 0x1a, 0xa4, 0x45, 0x06, 0x66, 0x9e, 0x0b, 0x04, 0x00, 0x00, 0xcc, 0x73, 0xa1,
+  0x05, 0x06, 0x80, 0x79, 0x2e, 0xb4, 0x20, 0x0b, 0x30, 0xcf, 0x05, 0x37, 0x00, 0x00, 0xe6, 0xb9,
+  0xe0, 0x4e, 0x21, 0xc0, 0x3c, 0x17, 0x1c, 0x05, 0x00, 0x98, 0xe7, 0x82, 0xa3, 0x69, 0x00, 0xf3,
+  0x1c, 0x01, 0x00, 0x00, 0x60, 0x9e, 0x23, 0xc5, 0x1d, 0x00, 0xcc, 0x73, 0x24, 0xb9, 0x03, 0x80,
+  0x79, 0x8e, 0x24, 0x47, 0x01, 0x30, 0xcf, 0x91, 0x34, 0x29, 0x00, 0xe6, 0x39, 0xc2, 0x0a, 0x01,
+  0xc0, 0x3c, 0x47, 0x58, 0x1a, 0x00, 0x98, 0xe7, 0x88, 0x2c, 0x00, 0x00, 0xf3, 0x1c, 0x91, 0x85,
+  0x00, 0x60, 0x9e, 0x2b, 0x00, 0x00, 0x00, 0xcc, 0x73, 0xc5, 0x1d, 0x00, 0x80, 0x79, 0xae, 0xb8,
+  0x34, 0x00, 0x30, 0xcf, 0x15, 0x69, 0x2a, 0x03, 0xe6, 0xb9, 0x22, 0x93, 0x2b, 0xc4, 0x3c, 0x77,
+  0x8a, 0x3b, 0x00, 0x98, 0xe7, 0x4e, 0x99, 0xc9, 0x1d, 0xf3, 0x5c, 0x22, 0x00, 0x00, 0x60, 0x9e,
+  0x4b, 0x84, 0x25, 0x77, 0xcc, 0x73, 0x49, 0x12, 0x00, 0x80, 0x79, 0xce, 0x1d, 0x44, 0x0b, 0x31,
+  0xcf, 0x3d, 0x56, 0x08, 0x00, 0xe6, 0xb9, 0x27, 0x83, 0x03, 0xc0, 0x3c, 0xf7, 0x64, 0x21, 0x00,
+  0x98, 0xe7, 0x9e, 0x34, 0x95, 0x01, 0xf3, 0xdc, 0x93, 0xc9, 0x51, 0x60, 0x9e, 0x7b, 0xb6, 0x10,
+  0x00, 0xcc, 0x73, 0xb3, 0x00, 0x00, 0x80, 0x79, 0x8e, 0x16, 0x77, 0x00, 0x30, 0xcf, 0xd1, 0xe4,
+  0x0e, 0x00, 0xe6, 0xbd, 0xe4, 0x28, 0x00, 0xc0, 0xbc, 0xb7, 0x8a, 0x3b, 0x00, 0x98, 0xf7, 0x58,
+  0x01, 0x00, 0x00, 0xf3, 0x5e, 0x0b, 0x0e, 0x00, 0x60, 0xde, 0x6b, 0xc1, 0xd1, 0x42, 0xcc, 0x7b,
+  0x4d, 0xb0, 0x32, 0x81, 0x79, 0xaf, 0x15, 0x00, 0x00, 0x30, 0xef, 0xb5, 0xe2, 0x0e, 0x00, 0xe6,
+  0xbd, 0x96, 0x08, 0x00, 0xc0, 0xbc, 0xd7, 0x92, 0x03, 0x00, 0x98, 0xf7, 0x5a, 0x72, 0x07, 0x00,
+  0xf3, 0x9e, 0xa3, 0x41, 0x16, 0x60, 0xde, 0x73, 0xb4, 0x10, 0x00, 0xcc, 0x7b, 0xcf, 0x25, 0x07,
+  0x80, 0x79, 0xef, 0xc9, 0x40, 0xd3, 0x30, 0xef, 0x3d, 0x59, 0x1c, 0x05, 0xe6, 0xbd, 0x37, 0xd3,
+  0x00, 0xc0, 0xbc, 0x27, 0x01, 0x00, 0x00, 0x98, 0xf7, 0x64, 0x90, 0xaf, 0x4e, 0xf3, 0x9e, 0x0c,
+  0x14, 0x00, 0x60, 0xde, 0x93, 0x05, 0x00, 0x00, 0xcc, 0x7b, 0xb2, 0x10, 0x00, 0x80, 0x79, 0x4f,
+  0x16, 0xc2, 0x0a, 0x31, 0xef, 0xc9, 0xe2, 0x0e, 0x00, 0xe6, 0x3d, 0x59, 0x1c, 0x2d, 0xc0, 0xbc,
+  0x27, 0x93, 0x2b, 0x04, 0x98, 0xf7, 0x64, 0x72, 0x07, 0x00, 0xf3, 0x9e, 0x4c, 0x8e, 0xa6, 0x61,
+  0xde, 0x93, 0xcf, 0x1d, 0x00, 0xcc, 0x7b, 0xb4, 0xb8, 0x03, 0x80, 0x79, 0x8f, 0x16, 0xf9, 0xea,
+  0x34, 0xef, 0xd1, 0x32, 0x93, 0x3b, 0xe6, 0x3d, 0x8a, 0x58, 0x21, 0xc0, 0xbc, 0x47, 0x13, 0x01,
+  0x00, 0x98, 0xf7, 0x68, 0x72, 0x07, 0x00, 0xf3, 0x1e, 0x4d, 0x8e, 0xa6, 0x61, 0xde, 0xa3, 0x69,
+  0xa6, 0x01, 0xcc, 0x7b, 0xb4, 0xca, 0x42, 0x80, 0x79, 0xaf, 0x26, 0x02, 0x00, 0x30, 0xef, 0x55,
+  0x56, 0x08, 0x00, 0xe6, 0xbd, 0x2a, 0x93, 0x3b, 0xc0, 0xbc, 0x57, 0x67, 0x2a, 0x04, 0x98, 0xf7,
+  0x6e, 0xa0, 0x85, 0x00, 0xf3, 0xde, 0x2d, 0x04, 0x00, 0x60, 0xde, 0xbb, 0xc9, 0x1d, 0x00, 0xcc,
+  0x83, 0x45, 0x26, 0x47, 0x81, 0x79, 0xf0, 0xc9, 0xf4, 0xea, 0x34, 0x0f, 0xca, 0x22, 0x0b, 0x01,
+  0xe6, 0x41, 0x9a, 0xdc, 0x01, 0xc0, 0x3c, 0x19, 0x04, 0x2b, 0x04, 0x98, 0x27, 0x83, 0x60, 0x19,
+  0x00, 0xf3, 0x64, 0x10, 0x32, 0x30, 0x60, 0x9e, 0x0c, 0x23, 0x08, 0x06, 0xcc, 0x93, 0x61, 0x04,
+  0x77, 0x80, 0x79, 0x32, 0x8c, 0xe0, 0x28, 0x30, 0x4f, 0x86, 0x91, 0x06, 0x00, 0xe6, 0xc9, 0xc0,
+  0x0a, 0x01, 0xc0, 0x3c, 0x19, 0x58, 0x2a, 0x04, 0x98, 0x27, 0x03, 0x4b, 0x8e, 0x16, 0xf3, 0x64,
+  0x60, 0xe9, 0xd5, 0x69, 0x9e, 0x0c, 0x2d, 0x30, 0x00, 0xcc, 0x93, 0xa1, 0x05, 0x0a, 0x80, 0x79,
+  0x32, 0xb4, 0x57, 0x27, 0x30, 0x4f, 0x06, 0x17, 0x64, 0x21, 0xe6, 0xc9, 0xe0, 0xca, 0x04, 0xc0,
+  0x3c, 0x19, 0xdc, 0x01, 0x00, 0x98, 0x27, 0x83, 0x4b, 0x03, 0x00, 0xf3, 0x64, 0x70, 0x14, 0x00,
+  0x60, 0x9e, 0x0c, 0x8e, 0x16, 0x02, 0xcc, 0x93, 0x41, 0x12, 0x00, 0x80, 0x79, 0x32, 0xc8, 0x02,
+  0x00, 0x30, 0x4f, 0x06, 0x59, 0x08, 0x00, 0xe6, 0xc9, 0x20, 0x93, 0x3b, 0xc0, 0x3c, 0x19, 0x26,
+  0x05, 0x00, 0x98, 0x27, 0x03, 0x4d, 0xee, 0x00, 0xf3, 0x64, 0xa0, 0xac, 0x00, 0x60, 0x9e, 0x14,
+  0x81, 0x00, 0x00, 0xcc, 0x93, 0x22, 0xb0, 0x42, 0x80, 0x79, 0x52, 0x04, 0x77, 0x00, 0x30, 0x4f,
+  0x8a, 0xe0, 0x68, 0x1a, 0xe6, 0x49, 0x11, 0xe4, 0xab, 0xd3, 0x3c, 0x29, 0x92, 0xa9, 0x73, 0x9a,
+  0x27, 0x05, 0x2b, 0x04, 0x00, 0xf3, 0xa4, 0x60, 0xc9, 0x51, 0x60, 0x9e, 0x14, 0x32, 0xb0, 0x42,
+  0xcc, 0x93, 0x23, 0xb8, 0x03, 0x80, 0x79, 0x72, 0x04, 0x5a, 0x00, 0x30, 0x4f, 0x8e, 0x02, 0x00,
+  0x00, 0xe6, 0xc9, 0x51, 0x08, 0x00, 0xc0, 0x3c, 0x39, 0x0a, 0x49, 0xee, 0x98, 0x27, 0x47, 0x71,
+  0x07, 0x00, 0xf3, 0xe4, 0x40, 0x85, 0x00, 0x60, 0x9e, 0x1c, 0x88, 0x15, 0x02, 0xcc, 0x93, 0x03,
+  0xd1, 0x14, 0x98, 0x79, 0x72, 0xa4, 0x01, 0x00, 0x30, 0x4f, 0x8e, 0x64, 0xea, 0x04, 0xe6, 0xc9,
+  0x91, 0xdc, 0x01, 0xc0, 0x3c, 0x39, 0x92, 0xa3, 0x00, 0x98, 0x27, 0x47, 0x65, 0x85, 0x00, 0xf3,
+  0x24, 0x01, 0x00, 0x00, 0x60, 0x9e, 0x24, 0x05, 0x00, 0x00, 0xcc, 0x93, 0xa4, 0x10, 0x00, 0x80,
+  0x79, 0x92, 0x14, 0x77, 0x00, 0x30, 0x4f, 0x92, 0x34, 0x00, 0x00, 0xe6, 0x49, 0x92, 0xdc, 0x01,
+  0xc0, 0x3c, 0x49, 0x58, 0x01, 0x00, 0x98, 0x27, 0x09, 0x2b, 0x04, 0x00, 0xf3, 0x24, 0x61, 0x69,
+  0x00, 0x60, 0x9e, 0x24, 0x32, 0x30, 0x00, 0xcc, 0x93, 0x64, 0xa6, 0x11, 0x98, 0x79, 0xb2, 0x00,
+  0x00, 0x00, 0x30, 0x4f, 0x16, 0x02, 0x00, 0x00, 0xe6, 0xc9, 0x42, 0x0a, 0x01, 0xc0, 0x3c, 0x59,
+  0x48, 0x7a, 0x75, 0x9a, 0x27, 0x8b, 0xa9, 0x73, 0x02, 0xf3, 0x64, 0x61, 0x05, 0x00, 0x60, 0x9e,
+  0x2c, 0x2c, 0x0d, 0x00, 0xcc, 0x93, 0xc5, 0x0d, 0x00, 0x80, 0x79, 0xb2, 0x38, 0x02, 0x00, 0x30,
+  0x4f, 0x16, 0x57, 0x08, 0x00, 0xe6, 0xc9, 0xe2, 0x0e, 0x00, 0xc0, 0x3c, 0x59, 0xdc, 0x29, 0x04,
+  0x98, 0x27, 0x8b, 0x4b, 0x82, 0x01, 0xf3, 0x64, 0x71, 0x69, 0x00, 0x60, 0x9e, 0x2c, 0x2e, 0xb9,
+  0x03, 0xcc, 0x93, 0xc5, 0x51, 0x00, 0x80, 0x79, 0xb2, 0x38, 0x5a, 0x08, 0x30, 0x4f, 0x16, 0x47,
+  0x93, 0x3b, 0xe6, 0xc9, 0xe2, 0x68, 0x72, 0xd4, 0x3c, 0x59, 0x64, 0x60, 0x00, 0x98, 0x27, 0x8b,
+  0x0c, 0xee, 0x00, 0xf3, 0x64, 0x91, 0x04, 0x00, 0x60, 0x9e, 0x2c, 0xb2, 0x00, 0x00, 0xcc, 0x93,
+  0x45, 0x16, 0x02, 0x80, 0x79, 0xb2, 0xc8, 0x42, 0x0a, 0x30, 0x4f, 0x16, 0x99, 0x06, 0x00, 0xe6,
+  0xc9, 0x22, 0x93, 0x3b, 0xc0, 0x3c, 0x59, 0x64, 0x7a, 0x75, 0x9a, 0x27, 0x8b, 0x7c, 0x95, 0x01,
+  0xf3, 0x64, 0x91, 0xaf, 0x4e, 0x60, 0x9e, 0x2c, 0x32, 0x03, 0x00, 0xcc, 0x93, 0x65, 0x16, 0x02,
+  0x80, 0x79, 0xb2, 0xcc, 0xe4, 0x28, 0x30, 0x4f, 0x96, 0x49, 0x01, 0x00, 0xe6, 0xc9, 0x53, 0x00,
+  0x00, 0xc0, 0x3c, 0x79, 0x8a, 0x3b, 0x00, 0x98, 0x27, 0x53, 0x18, 0x81, 0x01, 0xf3, 0x64, 0x0a,
+  0xee, 0x00, 0x60, 0x9e, 0x4c, 0x41, 0x16, 0x47, 0xcd, 0x93, 0x29, 0xc8, 0x57, 0x99, 0x79, 0x32,
+  0x05, 0x9a, 0x06, 0x30, 0x4f, 0xa6, 0x01, 0x00, 0x00, 0xe6, 0xc9, 0x34, 0x02, 0x03, 0xc0, 0x3c,
+  0x99, 0x46, 0x70, 0x07, 0x98, 0x27, 0xd3, 0x08, 0x14, 0x00, 0xf3, 0x64, 0x1a, 0x85, 0x00, 0x60,
+  0x9e, 0x4c, 0x03, 0x15, 0x02, 0xcc, 0x93, 0x69, 0xa4, 0xc0, 0x80, 0x79, 0x32, 0x8d, 0x14, 0xdc,
+  0x31, 0x4f, 0xa6, 0x91, 0x04, 0x03, 0xe6, 0xc9, 0x34, 0xd2, 0x00, 0xc0, 0x3c, 0x99, 0x46, 0x72,
+  0x07, 0x98, 0x27, 0xd3, 0x48, 0xaf, 0x4e, 0xf3, 0x64, 0x1a, 0xb4, 0x10, 0x60, 0x9e, 0x4c, 0x83,
+  0x26, 0x77, 0xcc, 0x93, 0x89, 0x00, 0x00, 0x80, 0x79, 0x32, 0x11, 0x56, 0x08, 0x30, 0x4f, 0xa6,
+  0x83, 0x28, 0x00, 0xe6, 0xc9, 0x74, 0x92, 0x3b, 0xc0, 0x3c, 0x99, 0x18, 0x00, 0x00, 0x98, 0x27,
+  0x13, 0x4b, 0x81, 0x01, 0xf3, 0x64, 0x62, 0x69, 0x00, 0x60, 0x9e, 0x4c, 0x2c, 0xb9, 0x03, 0xcc,
+  0x93, 0x89, 0xa5, 0x57, 0x99, 0x79, 0x32, 0xb1, 0xf4, 0xea, 0x34, 0x4f, 0x26, 0x07, 0x00, 0x00,
+  0xe6, 0xc9, 0xe4, 0x46, 0x60, 0xc0, 0x3c, 0x99, 0x1c, 0x01, 0x00, 0x98, 0x27, 0x93, 0x2b, 0x04,
+  0x00, 0xf3, 0x64, 0x72, 0x07, 0x00, 0x60, 0x9e, 0x4c, 0xee, 0x14, 0x02, 0xcc, 0x93, 0xc9, 0xa5,
+  0x01, 0x80, 0x79, 0x32, 0xb9, 0x44, 0x00, 0x30, 0x4f, 0x26, 0x97, 0xdc, 0x01, 0xe6, 0xc9, 0xe4,
+  0x68, 0x21, 0xc0, 0x3c, 0x99, 0x1c, 0x35, 0x75, 0x9a, 0x27, 0xd3, 0x93, 0x85, 0x00, 0xf3, 0x64,
+  0x7a, 0x75, 0x16, 0x62, 0x9e, 0x4c, 0xaf, 0xce, 0x09, 0xcc, 0x93, 0x29, 0xd6, 0x09, 0x80, 0x79,
+  0x32, 0xc9, 0x40, 0x01, 0x30, 0x4f, 0x26, 0x49, 0x00, 0x00, 0xe6, 0xc9, 0x24, 0x0b, 0x01, 0xc0,
+  0x3c, 0x99, 0x64, 0x7a, 0x75, 0x9a, 0x27, 0xd3, 0x2c, 0x00, 0x00, 0xf3, 0x64, 0x9a, 0x85, 0x00,
+  0x60, 0x9e, 0x4c, 0xb3, 0xc8, 0x42, 0xcc, 0x93, 0x69, 0xa6, 0x01, 0x80, 0x79, 0x32, 0xcd, 0xe4,
+  0x0e, 0x30, 0x4f, 0xa6, 0x99, 0xe6, 0x04, 0xe6, 0xc9, 0x34, 0x9f, 0x3b, 0xc0, 0x3c, 0x99, 0x26,
+  0x05, 0x00, 0x98, 0x27, 0xd3, 0xa4, 0xc9, 0x1d, 0xf3, 0x64, 0x9a, 0x34, 0x39, 0x6a, 0x9e, 0x4c,
+  0x34, 0xbd, 0x3a, 0xcd, 0x93, 0xc9, 0x16, 0x02, 0x80, 0x79, 0x32, 0xd9, 0xe2, 0x0e, 0x30, 0x4f,
+  0x26, 0x9b, 0xdc, 0x01, 0xe6, 0xc9, 0x64, 0x5f, 0x65, 0xc0, 0x3c, 0xb9, 0x0a, 0x00, 0x00, 0x98,
+  0x27, 0x57, 0x21, 0x00, 0x00, 0xf3, 0xe4, 0x2a, 0x8e, 0x02, 0x60, 0x9e, 0x5c, 0x93, 0x26, 0x77,
+  0xcc, 0x93, 0xac, 0x10, 0x00, 0x80, 0x79, 0x92, 0x15, 0x97, 0x02, 0x33, 0x4f, 0xb2, 0x34, 0x00,
+  0x00, 0xe6, 0x49, 0xc6, 0x0a, 0x01, 0xc0, 0x3c, 0xd9, 0xc2, 0x00, 0x00, 0x98, 0x27, 0x5b, 0x70,
+  0x07, 0x00, 0xf3, 0x64, 0x13, 0x0c, 0x00, 0x60, 0x9e, 0x6c, 0xc5, 0x01, 0x00, 0xcc, 0x93, 0xad,
+  0xb8, 0x03, 0x80, 0x79, 0xb2, 0x25, 0x07, 0x00, 0x30, 0x4f, 0xb6, 0xe4, 0x0e, 0x00, 0xe6, 0xc9,
+  0x96, 0x1c, 0x2d, 0xc4, 0x3c, 0xd9, 0x20, 0x4a, 0xee, 0x98, 0x27, 0xdb, 0xa4, 0x00, 0x00, 0xf3,
+  0x64, 0xab, 0xb2, 0x10, 0x60, 0x9e, 0x74, 0xa7, 0x10, 0x00, 0xcc, 0x93, 0x2f, 0xb8, 0x03, 0x80,
+  0x79, 0xf2, 0x31, 0x00, 0x00, 0x30, 0x4f, 0x3e, 0x16, 0x18, 0x00, 0xe6, 0xc9, 0xc7, 0x82, 0xa3,
+  0xc0, 0x3c, 0xf9, 0x58, 0x21, 0x00, 0x98, 0x27, 0x1f, 0x4b, 0x03, 0x00, 0xf3, 0xe4, 0x6b, 0x69,
+  0x00, 0x60, 0x9e, 0x7c, 0x2d, 0x39, 0x00, 0xcc, 0x93, 0xaf, 0xbd, 0xca, 0x80, 0x79, 0xf2, 0xb5,
+  0x57, 0xe7, 0x34, 0x4f, 0x3e, 0x07, 0x00, 0x00, 0xe6, 0xc9, 0xe7, 0x08, 0x00, 0xc0, 0x3c, 0xf9,
+  0xdc, 0x01, 0x00, 0x98, 0x27, 0x9f, 0x4b, 0xee, 0x00, 0xf3, 0xe4, 0x73, 0x34, 0x05, 0x66, 0x9e,
+  0x7c, 0x8e, 0xa6, 0x55, 0xcc, 0x93, 0xcf, 0xd1, 0xe4, 0x8e, 0x79, 0xf2, 0xc9, 0xc0, 0x00, 0x30,
+  0x4f, 0x3e, 0x19, 0x68, 0x21, 0xe6, 0xc9, 0x27, 0x0b, 0x01, 0xc0, 0x3c, 0xf9, 0x64, 0x91, 0x85,
+  0x98, 0x27, 0x9f, 0x4c, 0x03, 0x00, 0xf3, 0xe4, 0x93, 0xa9, 0x10, 0x60, 0x9e, 0x7c, 0x32, 0x39,
+  0x00, 0xcc, 0x93, 0x4f, 0x26, 0x77, 0x80, 0x79, 0xf2, 0xc9, 0xf4, 0xea, 0x34, 0x4f, 0x3e, 0xf9,
+  0x64, 0x21, 0xe6, 0xc9, 0x27, 0x5f, 0x9d, 0xc0, 0x3c, 0xf9, 0x68, 0x21, 0x00, 0x98, 0x27, 0x1f,
+  0x4d, 0x23, 0x30, 0xf3, 0xe4, 0xa3, 0xc9, 0x1d, 0x60, 0x9e, 0x7c, 0x55, 0xa6, 0xc0, 0xcc, 0x93,
+  0xef, 0x16, 0x00, 0x80, 0x79, 0xf2, 0xdd, 0x42, 0x00, 0x30, 0x4f, 0xca, 0x02, 0x00, 0x00, 0xe6,
+  0x49, 0x59, 0x08, 0x00, 0xc0, 0x3c, 0x29, 0x8b, 0x03, 0x00, 0x98, 0x27, 0x65, 0x1a, 0x00, 0x00,
+  0xf3, 0xa4, 0x4c, 0x0e, 0x00, 0x60, 0x9e, 0x9c, 0x05, 0x00, 0x00, 0xcc, 0x93, 0xb3, 0x38, 0x5a,
+  0x88, 0x79, 0x72, 0xa2, 0x42, 0x00, 0x30, 0x4f, 0xce, 0x99, 0xdc, 0x01, 0xe6, 0xc9, 0x49, 0x0b,
+  0x01, 0xc0, 0x3c, 0x39, 0x69, 0x0a, 0x0c, 0x98, 0x27, 0x27, 0x4d, 0x03, 0x00, 0xf3, 0xe4, 0xa4,
+  0xc9, 0x1d, 0x60, 0x9e, 0x9c, 0x34, 0x03, 0x00, 0xcc, 0x93, 0x14, 0x00, 0x00, 0x80, 0x79, 0x92,
+  0x06, 0x77, 0x00, 0x30, 0x4f, 0xd2, 0x40, 0x01, 0x00, 0xe6, 0x49, 0x1a, 0x68, 0x21, 0xc0, 0x3c,
+  0x49, 0x0b, 0x00, 0x00, 0x98, 0x27, 0x69, 0x21, 0x00, 0x00, 0xf3, 0x24, 0x2d, 0xa6, 0x4e, 0x60,
+  0x9e, 0xa4, 0xc5, 0x05, 0x06, 0xcc, 0x93, 0xb4, 0xb8, 0xe0, 0x8e, 0x79, 0x92, 0x16, 0x57, 0x08,
+  0x30, 0x4f, 0xd2, 0xe2, 0x0e, 0x00, 0xe6, 0x49, 0x5a, 0x1c, 0x05, 0xc0, 0x3c, 0x49, 0x8b, 0x4c,
+  0xee, 0x98, 0x27, 0x29, 0x2a, 0x04, 0x00, 0xf3, 0x24, 0x45, 0xac, 0x10, 0x60, 0x9e, 0xa4, 0x88,
+  0x25, 0x77, 0xcc, 0x93, 0x14, 0x65, 0x00, 0x80, 0x79, 0x92, 0xa6, 0x01, 0x00, 0x30, 0x4f, 0xd2,
+  0x44, 0x00, 0x00, 0xe6, 0x49, 0x9a, 0x5c, 0x21, 0xc0, 0x3c, 0x49, 0x93, 0x3b, 0x00, 0x98, 0x27,
+  0x69, 0x72, 0x14, 0x00, 0xf3, 0x24, 0x4d, 0xaf, 0x32, 0x60, 0x9e, 0xa4, 0x69, 0xc6, 0xca, 0xcc,
+  0x93, 0x34, 0x4d, 0x5a, 0x88, 0x79, 0x92, 0x3e, 0x02, 0x00, 0x30, 0x4f, 0xd2, 0x27, 0x0b, 0x01,
+  0xe6, 0x49, 0x9a, 0x01, 0x00, 0xc0, 0x3c, 0x69, 0x0b, 0x00, 0x00, 0x98, 0x27, 0x6d, 0x21, 0x00,
+  0x00, 0xf3, 0xa4, 0x2d, 0x93, 0x02, 0x60, 0x9e, 0xb4, 0xc9, 0x1d, 0x00, 0xcc, 0x93, 0xf6, 0xb9,
+  0x03, 0x80, 0x79, 0xd2, 0xbe, 0xca, 0x00, 0x30, 0x4f, 0x66, 0x00, 0x00, 0x00, 0xe6, 0x4d, 0x94,
+  0x4c, 0x65, 0xc0, 0xbc, 0x09, 0x13, 0x01, 0x00, 0x98, 0x37, 0x21, 0x05, 0x00, 0x00, 0xf3, 0x26,
+  0x2d, 0x0e, 0x00, 0x60, 0xde, 0xa4, 0x85, 0x02, 0x00, 0xcc, 0x9b, 0x14, 0x15, 0x02, 0x80, 0x79,
+  0x93, 0x22, 0x9a, 0xdc, 0x31, 0x6f, 0xd2, 0x34, 0x51, 0x21, 0xe6, 0xcd, 0x9a, 0x1c, 0x2d, 0xc0,
+  0x3c, 0x5a, 0x08, 0x00, 0x00, 0x98, 0x47, 0x51, 0x60, 0x85, 0x00, 0xf3, 0x28, 0x4a, 0xee, 0x00,
+  0x60, 0x1e, 0x45, 0x89, 0x26, 0x77, 0xcc, 0xab, 0xc5, 0xd1, 0x32, 0x81, 0x79, 0xb5, 0xc8, 0x42,
+  0x00, 0x30, 0xaf, 0xb2, 0x57, 0xe7, 0x04, 0xe6, 0xd5, 0x96, 0x1c, 0x05, 0xc0, 0xbc, 0xea, 0x46,
+  0x72, 0x07, 0x98, 0x57, 0x1d, 0x01, 0x00, 0x00, 0xf3, 0xaa, 0x23, 0xac, 0x10, 0x60, 0x5e, 0x75,
+  0xa7, 0x10, 0x00, 0xcc, 0xab, 0x2e, 0xb9, 0x03, 0x80, 0x79, 0xd5, 0xd1, 0x02, 0x00, 0x30, 0xaf,
+  0x3a, 0x5a, 0x08, 0x00, 0xe6, 0x55, 0x47, 0x8b, 0x2c, 0xc4, 0xbc, 0xea, 0x68, 0x1a, 0x00, 0x98,
+  0x57, 0x1d, 0x4d, 0xee, 0x00, 0xf3, 0xaa, 0xa3, 0xe9, 0xd5, 0x69, 0x5e, 0x75, 0x94, 0x01, 0x00,
+  0xcc, 0xab, 0x8e, 0xb2, 0x42, 0x80, 0x79, 0x55, 0x3a, 0x0a, 0x00, 0x30, 0xaf, 0xca, 0xd7, 0x8a,
+  0x3b, 0xe6, 0xd5, 0x89, 0x0a, 0x01, 0xc0, 0xbc, 0x3a, 0x27, 0x2d, 0x04, 0x98, 0x57, 0xe7, 0xa4,
+  0x29, 0x30, 0xf3, 0xea, 0x9c, 0x19, 0x00, 0x60, 0x5e, 0x9d, 0xb4, 0x10, 0x00, 0xcc, 0xab, 0x93,
+  0x16, 0x49, 0x80, 0x79, 0x75, 0xd2, 0x34, 0x00, 0x30, 0xaf, 0x4e, 0x9a, 0xdc, 0x01, 0xe6, 0x55,
+  0x9a, 0x1c, 0x05, 0xc0, 0xbc, 0x4a, 0x59, 0x1a, 0x81, 0x99, 0x67, 0x0b, 0x00, 0x00, 0x00, 0xf3,
+  0x6c, 0x61, 0x81, 0x02, 0x60, 0x9e, 0x2d, 0x2e, 0x50, 0x00, 0xcc, 0xb3, 0xc5, 0x1d, 0x00, 0x80,
+  0x79, 0xb6, 0xb8, 0xe4, 0x00, 0x30, 0xcf, 0x16, 0x59, 0x08, 0x00, 0xe6, 0xd9, 0x44, 0x00, 0x00,
+  0xc0, 0xbc, 0x0b, 0x00, 0x00, 0x00, 0x98, 0x77, 0x0b, 0x00, 0x00, 0x00, 0xf3, 0x6e, 0x61, 0x81,
+  0x01, 0x60, 0xde, 0x65, 0x2c, 0xb9, 0x03, 0xcc, 0xbb, 0xec, 0xc9, 0x02, 0x80, 0x79, 0x97, 0x55,
+  0x77, 0x00, 0x30, 0xef, 0xba, 0x53, 0x08, 0x00, 0xe6, 0xe1, 0x0c, 0x00, 0x00, 0xc0, 0xbc, 0x3c,
+  0x29, 0x2b, 0x04, 0x18, 0x19, 0x46, 0x01, 0x00, 0x00, 0x23, 0xc3, 0x40, 0xa6, 0x4e, 0x60, 0x64,
+  0x18, 0xc9, 0x01, 0x00, 0x8c, 0x0c, 0x83, 0x16, 0x02, 0x80, 0x91, 0x61, 0x54, 0x59, 0x00, 0x30,
+  0x32, 0x1c, 0x04, 0x00, 0x00, 0x46, 0x86, 0x83, 0x92, 0xa3, 0xc0, 0xc8, 0x70, 0x92, 0xa9, 0x13,
+  0x18, 0x19, 0x4e, 0x3a, 0x85, 0x00, 0x23, 0xc3, 0x49, 0x0e, 0x00, 0x60, 0x64, 0x48, 0x23, 0x0d,
+  0x00, 0x8c, 0x0c, 0x89, 0x00, 0x00, 0x80, 0x91, 0x21, 0x39, 0x0a, 0x00, 0x30, 0x32, 0xa4, 0x99,
+  0x5e, 0x9d, 0x46, 0x06, 0x46, 0x00, 0x00, 0xc0, 0xc8, 0xc0, 0x0a, 0x00, 0x00, 0x18, 0x19, 0x18,
+  0x2b, 0x04, 0x00, 0x23, 0x43, 0x0b, 0xee, 0x00, 0x60, 0x64, 0x68, 0x69, 0xa6, 0x01, 0x8c, 0x0c,
+  0xed, 0xc9, 0x57, 0xa7, 0x91, 0xc1, 0x11, 0x00, 0x00, 0x30, 0x32, 0xb8, 0xe4, 0x82, 0x3b, 0x46,
+  0x06, 0x47, 0x0b, 0x01, 0xc0, 0xc8, 0xe0, 0x68, 0x99, 0x00, 0x18, 0x19, 0x1c, 0x4d, 0xee, 0x00,
+  0x23, 0x83, 0xa3, 0xc9, 0x51, 0x60, 0x64, 0x70, 0x34, 0xbd, 0x3a, 0x8d, 0x0c, 0x8e, 0x32, 0x00,
+  0x80, 0x91, 0xc1, 0x65, 0x00, 0x00, 0x30, 0x32, 0xc0, 0x42, 0x00, 0x00, 0x46, 0x06, 0xf8, 0x28,
+  0x00, 0xc0, 0xc8, 0x20, 0x83, 0x3b, 0x00, 0x18, 0x19, 0x64, 0xa0, 0xc9, 0x01, 0x23, 0x83, 0x2c,
+  0x00, 0x00, 0x60, 0x64, 0x90, 0x85, 0x00, 0x00, 0x8c, 0x0c, 0xb2, 0x38, 0x00, 0x80, 0x91, 0x41,
+  0x16, 0x57, 0x08, 0x30, 0x32, 0xc8, 0x22, 0x0b, 0x01, 0x46, 0x06, 0x99, 0x4c, 0x9d, 0xd3, 0xc8,
+  0x20, 0x93, 0x3b, 0x00, 0x18, 0x19, 0x64, 0x72, 0xb4, 0x10, 0x23, 0x83, 0x4c, 0x33, 0xb9, 0x63,
+  0x64, 0x90, 0xc9, 0x16, 0x02, 0x8c, 0x0c, 0xf2, 0xc9, 0x57, 0xa7, 0x91, 0x41, 0xbe, 0x4a, 0x01,
+  0x30, 0x32, 0x4c, 0x94, 0xdc, 0x01, 0x46, 0x86, 0x89, 0x68, 0x72, 0xc7, 0xc8, 0x30, 0x17, 0x00,
+  0x00, 0x18, 0x19, 0x26, 0x4c, 0xee, 0x00, 0x23, 0xc3, 0x9c, 0xa9, 0x10, 0x60, 0x64, 0x98, 0x93,
+  0x26, 0x77, 0x8c, 0x0c, 0x93, 0x02, 0x00, 0x80, 0x91, 0x61, 0xd2, 0x42, 0x00, 0x30, 0x32, 0xd0,
+  0xc0, 0x00, 0x00, 0x46, 0x06, 0x5a, 0x08, 0x00, 0xc0, 0xc8, 0x40, 0x8b, 0x3b, 0x00, 0x18, 0x19,
+  0x68, 0x71, 0xb4, 0x00, 0x23, 0x03, 0x2d, 0x32, 0xb9, 0x63, 0x64, 0xa0, 0x65, 0x52, 0x00, 0x8c,
+  0x0c, 0x14, 0x15, 0x02, 0x80, 0x91, 0x81, 0xa2, 0xe4, 0x0e, 0x30, 0x32, 0xd0, 0xe4, 0x00, 0x00,
+  0x46, 0x06, 0x9a, 0x5c, 0x60, 0xc0, 0xc8, 0x40, 0x93, 0x3b, 0x00, 0x18, 0x19, 0x68, 0x72, 0x14,
+  0x00, 0x23, 0x03, 0x4d, 0x8e, 0x16, 0x62, 0x64, 0xa0, 0xc9, 0xd1, 0x34, 0x8c, 0x0c, 0x34, 0xd9,
+  0xe2, 0xa8, 0x91, 0xc1, 0x16, 0x02, 0x00, 0x30, 0x32, 0xd8, 0xe2, 0x0e, 0x00, 0x46, 0x06, 0x5c,
+  0x08, 0x00, 0xc0, 0xc8, 0x51, 0x00, 0x00, 0x00, 0x18, 0x39, 0x0a, 0x01, 0x00, 0x00, 0x23, 0xc7,
+  0x73, 0x65, 0x02, 0x60, 0xe4, 0x78, 0xb2, 0x00, 0x00, 0x8c, 0x24, 0x85, 0x00, 0x00, 0x80, 0x91,
+  0xa4, 0x38, 0x9a, 0x06, 0x30, 0x92, 0x54, 0x19, 0x18, 0x00, 0x46, 0x16, 0x00, 0x00, 0x00, 0xc0,
+  0xc8, 0x12, 0x18, 0x00, 0x00, 0x18, 0x59, 0x82, 0x23, 0x00, 0x00, 0x23, 0x8b, 0x60, 0x29, 0x50,
+  0x60, 0x64, 0x19, 0x28, 0x0d, 0x00, 0x8c, 0x2c, 0x45, 0x16, 0x02, 0x80, 0x91, 0x85, 0x11, 0x00,
+  0x00, 0x30, 0xb2, 0xb0, 0x02, 0x00, 0x00, 0x46, 0x16, 0x56, 0x08, 0x00, 0xc0, 0xc8, 0xc2, 0x8a,
+  0x03, 0x00, 0x18, 0x59, 0x18, 0x2b, 0x04, 0x00, 0x23, 0x8b, 0x23, 0x00, 0x00, 0x60, 0x64, 0x71,
+  0x84, 0x15, 0x02, 0x8c, 0x2c, 0x8e, 0xb0, 0xe4, 0x80, 0x91, 0xc5, 0x2d, 0x00, 0x00, 0x30, 0xb2,
+  0x38, 0x5a, 0x08, 0x00, 0x46, 0x16, 0x47, 0x53, 0x60, 0xc0, 0xc8, 0xe2, 0x68, 0x1a, 0x00, 0x18,
+  0x59, 0x1c, 0x4d, 0x23, 0x30, 0x23, 0x8b, 0x0c, 0x07, 0x00, 0x60, 0x64, 0x91, 0xc1, 0x01, 0x00,
+  0x8c, 0x2c, 0x32, 0xb8, 0x03, 0x80, 0x91, 0x45, 0x06, 0x0a, 0x00, 0x30, 0xb2, 0xc8, 0x02, 0x00,
+  0x00, 0x46, 0x16, 0x59, 0x08, 0x00, 0xc0, 0xc8, 0x22, 0x8b, 0x0b, 0x0c, 0x18, 0x59, 0xa4, 0x23,
+  0x00, 0x00, 0x23, 0x8b, 0x7c, 0xb2, 0x10, 0x60, 0x64, 0x91, 0xaf, 0x32, 0x00, 0x8c, 0x2c, 0x73,
+  0x16, 0x02, 0x80, 0x91, 0x65, 0x52, 0x00, 0x00, 0x30, 0xb2, 0x4c, 0x9a, 0x06, 0x00, 0x46, 0x96,
+  0x49, 0x93, 0x03, 0xc0, 0xc8, 0x34, 0x92, 0x3b, 0x00, 0x18, 0x99, 0x08, 0x00, 0x00, 0x00, 0x23,
+  0x53, 0x01, 0x00, 0x00, 0x60, 0x64, 0x2a, 0xd2, 0x05, 0x06, 0x8c, 0x4c, 0xa7, 0xb8, 0x03, 0x80,
+  0x91, 0x89, 0x91, 0x42, 0x00, 0x30, 0x32, 0xb1, 0xe2, 0x0e, 0x00, 0x46, 0x26, 0x56, 0x64, 0x21,
+  0xc0, 0xc8, 0xc4, 0x58, 0x7a, 0x75, 0x1a, 0x99, 0xd8, 0x73, 0x07, 0x00, 0x23, 0x13, 0x7b, 0x32,
+  0xb9, 0x63, 0x64, 0x6a, 0xc5, 0x51, 0x00, 0x8c, 0x4c, 0x8e, 0x00, 0x00, 0x80, 0x91, 0xc9, 0x9d,
+  0x42, 0x00, 0x30, 0x32, 0xb9, 0x53, 0xdc, 0x01, 0x46, 0x26, 0x97, 0x06, 0x00, 0xc0, 0xc8, 0xe4,
+  0xd2, 0x08, 0x0c, 0x18, 0x99, 0x5c, 0x72, 0x07, 0x00, 0x23, 0x93, 0x4b, 0x8e, 0x16, 0x62, 0x64,
+  0x72, 0x69, 0xa6, 0x01, 0x8c, 0x4c, 0xee, 0xd5, 0x89, 0x80, 0x91, 0xc9, 0x51, 0x00, 0x00, 0x30,
+  0x32, 0x39, 0x5a, 0x00, 0x00, 0x46, 0x26, 0x47, 0x0b, 0x01, 0xc0, 0xc8, 0xe4, 0x68, 0x1a, 0x00,
+  0x18, 0x99, 0x1c, 0x4d, 0x8e, 0x02, 0x23, 0x93, 0x2c, 0x04, 0x00, 0x60, 0x64, 0x92, 0xc5, 0x1d,
+  0x00, 0x8c, 0x4c, 0x32, 0x91, 0x34, 0x80, 0x91, 0x69, 0x06, 0x77, 0x00, 0x30, 0x32, 0x4d, 0x54,
+  0x00, 0x00, 0x46, 0xa6, 0x89, 0x0a, 0x01, 0xc0, 0xc8, 0x34, 0x51, 0x7a, 0xcf, 0x18, 0x99, 0xe6,
+  0xa3, 0x85, 0x00, 0x23, 0xd3, 0x7c, 0xd5, 0x1d, 0x60, 0x64, 0x9a, 0x33, 0x0d, 0x00, 0x8c, 0x4c,
+  0x93, 0x16, 0x02, 0x80, 0x91, 0x69, 0xd2, 0x34, 0x00, 0x30, 0x32, 0x4d, 0x9a, 0xdc, 0x01, 0x46,
+  0x26, 0x5a, 0x00, 0x00, 0xc0, 0xc8, 0x44, 0x0b, 0x01, 0x00, 0x18, 0x99, 0x68, 0x71, 0x00, 0x00,
+  0x23, 0x13, 0x2d, 0xee, 0x00, 0x60, 0x64, 0xa2, 0xc9, 0x1d, 0x00, 0x8c, 0x4c, 0x34, 0x39, 0x5a,
+  0x88, 0x91, 0x89, 0x32, 0x00, 0x00, 0x30, 0xf2, 0x85, 0x53, 0x08, 0x00, 0x46, 0xbe, 0xc0, 0x92,
+  0x3b, 0xc0, 0xc8, 0x17, 0x5c, 0xa2, 0x00, 0x18, 0xf9, 0x08, 0x2b, 0x04, 0x00, 0x23, 0x9f, 0xa9,
+  0xac, 0x10, 0x60, 0xe4, 0x4b, 0x33, 0xbd, 0x3a, 0x8d, 0x7c, 0xc9, 0x16, 0x02, 0x80, 0x91, 0x6f,
+  0x15, 0x02, 0x00, 0x30, 0xf2, 0xad, 0xe2, 0x0e, 0x00, 0x46, 0x3e, 0x56, 0x08, 0x00, 0xc0, 0xc8,
+  0xc7, 0x8a, 0xa3, 0x85, 0x18, 0xf9, 0x58, 0x91, 0x05, 0x00, 0x23, 0x1f, 0x63, 0xc9, 0x1d, 0x60,
+  0xe4, 0x6b, 0x00, 0x00, 0x00, 0x8c, 0x7c, 0x2d, 0xb8, 0x03, 0x80, 0x91, 0xaf, 0x05, 0x0a, 0x00,
+  0x30, 0xf2, 0xb5, 0x02, 0x00, 0x00, 0x46, 0xbe, 0x96, 0x06, 0x00, 0xc0, 0xc8, 0xd7, 0xd2, 0xab,
+  0x13, 0x18, 0xf9, 0x5a, 0x9a, 0xc9, 0x51, 0x23, 0x5f, 0x7b, 0x37, 0x03, 0x60, 0xe4, 0x6b, 0x30,
+  0xbd, 0x3a, 0x8d, 0x7c, 0x2d, 0x03, 0x00, 0x80, 0x91, 0xcf, 0x11, 0x00, 0x00, 0x30, 0xf2, 0x39,
+  0x9a, 0xdc, 0x01, 0x46, 0x3e, 0x47, 0xd3, 0x73, 0xc7, 0xc8, 0xe7, 0x28, 0x2b, 0x04, 0x18, 0xf9,
+  0x9e, 0x4c, 0x03, 0x00, 0x23, 0x9f, 0x0c, 0x0e, 0x00, 0x60, 0xe4, 0x93, 0x05, 0x00, 0x00, 0x8c,
+  0x7c, 0xb2, 0x10, 0x00, 0x80, 0x91, 0x4f, 0x16, 0x07, 0x00, 0x30, 0xf2, 0xc9, 0xe2, 0x28, 0x00,
+  0x46, 0x3e, 0x59, 0x1c, 0x4d, 0xc3, 0xc8, 0x27, 0x8b, 0x2c, 0x04, 0x18, 0xf9, 0x64, 0x91, 0x69,
+  0x00, 0x23, 0x9f, 0x2c, 0xf2, 0xd5, 0x69, 0xe4, 0x93, 0x65, 0xd2, 0x42, 0x8c, 0x7c, 0x32, 0xb9,
+  0x03, 0x80, 0x91, 0x4f, 0xa6, 0x89, 0x0a, 0x31, 0xf2, 0xc9, 0x34, 0x93, 0x3b, 0x46, 0x3e, 0xf9,
+  0xea, 0x2c, 0xc0, 0xc8, 0x47, 0x01, 0x00, 0x00, 0x18, 0xf9, 0x68, 0xa0, 0xc9, 0x01, 0x23, 0x1f,
+  0x2d, 0x00, 0x00, 0x60, 0xe4, 0xa3, 0x45, 0x16, 0x02, 0x8c, 0x7c, 0x14, 0x15, 0x02, 0x80, 0x91,
+  0x8f, 0xa6, 0x01, 0x00, 0x30, 0xf2, 0xd1, 0x44, 0x00, 0x00, 0x46, 0x3e, 0x9a, 0xdc, 0x01, 0xc0,
+  0xc8, 0x47, 0x93, 0xa3, 0x85, 0x18, 0xf9, 0x6a, 0x60, 0x00, 0x00, 0x23, 0x5f, 0x95, 0x41, 0x16,
+  0x62, 0xe4, 0xab, 0x92, 0x00, 0x00, 0x8c, 0x7c, 0x55, 0x16, 0x02, 0x80, 0x91, 0xaf, 0xca, 0x53,
+  0x08, 0x30, 0xf2, 0x55, 0x99, 0x5e, 0x9d, 0x46, 0xbe, 0x3a, 0x0b, 0x01, 0xc0, 0xc8, 0x57, 0x27,
+  0x05, 0x00, 0x18, 0xf9, 0xea, 0xa4, 0x05, 0x00, 0x23, 0x9f, 0x2d, 0x00, 0x00, 0x60, 0xe4, 0xb3,
+  0xc5, 0x01, 0x00, 0x8c, 0x7c, 0x37, 0x50, 0x00, 0x80, 0x91, 0xef, 0x16, 0x19, 0x18, 0x30, 0xf2,
+  0xdd, 0x34, 0xd3, 0x00, 0x46, 0xbe, 0xeb, 0x0e, 0x00, 0xc0, 0xc8, 0x77, 0x1d, 0x05, 0x00, 0x18,
+  0x49, 0x83, 0x4c, 0x03, 0x00, 0x23, 0xab, 0x23, 0x00, 0x00, 0x60, 0x64, 0x75, 0xe4, 0x02, 0x00,
+  0x8c, 0xac, 0x8e, 0x64, 0x00, 0x80, 0x91, 0x75, 0x52, 0x16, 0x18, 0x30, 0xb2, 0xd2, 0x2a, 0x0b,
+  0x00, 0xa7, 0x84, 0x81, 0x58, 0x71, 0xe0, 0x94, 0xd0, 0x0a, 0x01, 0x00, 0x9c, 0x32, 0x8a, 0xa3,
+  0x00, 0x80, 0x53, 0x4c, 0x21, 0x00, 0x00, 0x70, 0xca, 0x09, 0x2c, 0x03, 0x00, 0x4e, 0x61, 0x19,
+  0x00, 0x00, 0xc0, 0x29, 0x2e, 0xb0, 0xe4, 0x0e, 0x38, 0xc5, 0x11, 0x00, 0x00, 0x00, 0xa7, 0xb8,
+  0x02, 0x00, 0x00, 0xe0, 0x14, 0x59, 0x00, 0x00, 0x00, 0x9c, 0x32, 0x69, 0x1a, 0x00, 0x80, 0x93,
+  0x5c, 0x3a, 0x85, 0x00, 0x70, 0xd2, 0xa4, 0x85, 0x00, 0x00, 0x4e, 0xa2, 0x28, 0x3d, 0x77, 0xc0,
+  0x61, 0x81, 0x15, 0x59, 0x00, 0x38, 0x2c, 0x38, 0x9a, 0xdc, 0x01, 0x87, 0x05, 0x19, 0x1c, 0x05,
+  0xe0, 0xb0, 0x20, 0x0b, 0x00, 0x00, 0x1c, 0x16, 0x26, 0x02, 0x00, 0x80, 0xc3, 0xc2, 0xa4, 0x45,
+  0x16, 0x72, 0x58, 0x29, 0x84, 0x01, 0x00, 0x0e, 0x2b, 0x30, 0xb9, 0x42, 0xc0, 0x61, 0x45, 0x06,
+  0x47, 0xd3, 0x38, 0x2c, 0xb5, 0x34, 0x0b, 0x01, 0x87, 0x25, 0x0a, 0x00, 0x00, 0xe0, 0xb0, 0xf7,
+  0x64, 0x91, 0x19, 0x1c, 0xf6, 0x64, 0x01, 0x00, 0x80, 0xc3, 0x9e, 0x2c, 0xee, 0x00, 0x70, 0xd8,
+  0xab, 0xc9, 0x01, 0x00, 0x0e, 0x7b, 0x55, 0xa6, 0x01, 0xc0, 0x79, 0x45, 0xa6, 0x99, 0x1c, 0x3d,
+  0xef, 0xd4, 0xe4, 0x0e, 0x00, 0xe7, 0x31, 0x02, 0x00, 0x00, 0xe0, 0x3c, 0x46, 0x92, 0x3b, 0x00,
+  0x9c, 0xc7, 0x12, 0x2b, 0x04, 0x80, 0xf3, 0x58, 0x7a, 0xad, 0x10, 0x70, 0x1e, 0x6b, 0xc9, 0x1d,
+  0x00, 0xce, 0x6b, 0xa1, 0x10, 0x00, 0xc0, 0x79, 0x4d, 0x54, 0x59, 0x08, 0x38, 0xaf, 0x15, 0x97,
+  0x06, 0x00, 0xe7, 0xb5, 0x27, 0x0b, 0x01, 0xe0, 0x3c, 0x17, 0x46, 0x21, 0x00, 0x9c, 0xe7, 0x82,
+  0xa3, 0x00, 0x80, 0xf3, 0x1c, 0x01, 0x00, 0x00, 0x70, 0x9e, 0x2b, 0x2e, 0xb9, 0x03, 0xce, 0x73,
+  0x8f, 0x65, 0x00, 0xc0, 0x79, 0x4f, 0x12, 0x00, 0x00, 0x38, 0xef, 0xc9, 0x42, 0x00, 0x00, 0xe7,
+  0x3d, 0x59, 0x64, 0x01, 0xe0, 0xbc, 0x27, 0xd3, 0x01, 0x00, 0x9c, 0xf7, 0x6e, 0x72, 0x14, 0x80,
+  0xf3, 0x60, 0x72, 0x69, 0x00, 0x70, 0x9e, 0x0c, 0x2c, 0xb9, 0x03, 0xce, 0x93, 0xc1, 0x1d, 0x00,
+  0xc0, 0x79, 0x72, 0x14, 0x02, 0x00, 0x38, 0x4f, 0x8e, 0x34, 0x93, 0xa3, 0xe7, 0x49, 0x02, 0x00,
+  0x00, 0xe0, 0x3c, 0x59, 0x00, 0x00, 0x00, 0x9c, 0x27, 0x0b, 0x2b, 0x04, 0x80, 0xf3, 0x64, 0x71,
+  0x00, 0x00, 0x70, 0x9e, 0x2c, 0x8e, 0x00, 0x00, 0xce, 0x93, 0xc5, 0x1d, 0x00, 0xc0, 0x79, 0xb2,
+  0xb8, 0x54, 0x08, 0x38, 0x4f, 0x16, 0x97, 0xdc, 0x01, 0xe7, 0xc9, 0xe2, 0x28, 0x00, 0xe0, 0x3c,
+  0x59, 0x1c, 0x2d, 0x13, 0x9c, 0x27, 0x8b, 0xa3, 0xc9, 0x9d, 0xf3, 0x64, 0x99, 0x05, 0x00, 0x70,
+  0x9e, 0x3c, 0xc5, 0xd1, 0x34, 0xce, 0x93, 0x69, 0x00, 0x00, 0xc0, 0x79, 0x32, 0x8d, 0x20, 0x0b,
+  0x39, 0x4f, 0xa6, 0x11, 0x68, 0x21, 0xe7, 0xc9, 0x34, 0x92, 0x03, 0xe0, 0x3c, 0x99, 0x46, 0x72,
+  0x07, 0x9c, 0x27, 0x13, 0x4b, 0xaf, 0xce, 0xf3, 0x64, 0x72, 0x07, 0x00, 0x70, 0x9e, 0x4c, 0x2e,
+  0x39, 0x0a, 0xce, 0x93, 0x69, 0x16, 0x02, 0xc0, 0x79, 0x32, 0xd1, 0x42, 0x00, 0x38, 0x4f, 0x26,
+  0x5b, 0x00, 0x00, 0xe7, 0xc9, 0x55, 0x00, 0x00, 0xe0, 0x3c, 0xc9, 0x5e, 0x9d, 0x00, 0x9c, 0x27,
+  0x1d, 0x0d, 0xb2, 0x90, 0xf3, 0xe4, 0x6b, 0x69, 0x00, 0x70, 0x9e, 0x7c, 0x10, 0x15, 0x02, 0xce,
+  0x93, 0x0f, 0xca, 0xe4, 0xe8, 0x79, 0xf2, 0xc9, 0xc0, 0x00, 0x38, 0x4f, 0x3e, 0x59, 0x08, 0x00,
+  0xe7, 0xc9, 0x27, 0x93, 0xa3, 0xe0, 0x3c, 0xf9, 0xe4, 0xab, 0x13, 0x9c, 0x27, 0xdf, 0xa4, 0xc9,
+  0x9d, 0xf3, 0xe4, 0xbb, 0x00, 0x00, 0x70, 0x9e, 0xa4, 0x45, 0x16, 0x02, 0xce, 0x93, 0x34, 0xb9,
+  0x03, 0xc0, 0x79, 0xd2, 0x16, 0x02, 0x00, 0x38, 0xaf, 0x26, 0x47, 0x33, 0x00, 0xe7, 0x55, 0x47,
+  0x00, 0x00, 0xe0, 0xbc, 0xea, 0x16, 0x00, 0x00, 0x9c, 0x57, 0x67, 0x01, 0x00, 0x80, 0xf3, 0x6c,
+  0x7a, 0xee, 0x00, 0x70, 0xde, 0x2d, 0x04, 0x00, 0x00, 0x8e, 0x0c, 0x22, 0x50, 0x00, 0xc0, 0x91,
+  0x61, 0x24, 0x47, 0x01, 0x38, 0x32, 0x8c, 0x34, 0x0b, 0x01, 0x47, 0x86, 0x53, 0x08, 0x00, 0xe0,
+  0xc8, 0x70, 0x8a, 0x3b, 0x00, 0x1c, 0x19, 0x0e, 0x4a, 0x03, 0x80, 0x23, 0xc3, 0x41, 0x14, 0x00,
+  0x70, 0x64, 0x48, 0x04, 0x00, 0x00, 0x8e, 0x0c, 0xab, 0x00, 0x00, 0xc0, 0x91, 0x81, 0x15, 0x02,
+  0x00, 0x38, 0x32, 0xb0, 0x62, 0x2a, 0x03, 0x47, 0x06, 0x56, 0x1c, 0x00, 0xe0, 0xc8, 0xc0, 0x9e,
+  0x2c, 0x04, 0x1c, 0x19, 0x5a, 0x70, 0x00, 0x80, 0x23, 0x43, 0x13, 0xac, 0x38, 0x70, 0x64, 0x68,
+  0x42, 0x26, 0x07, 0x8e, 0x0c, 0xad, 0x38, 0x5a, 0xc8, 0x91, 0xa1, 0x25, 0xc1, 0x0a, 0x39, 0x32,
+  0xb4, 0x2a, 0x5f, 0x9d, 0x47, 0x06, 0x47, 0x00, 0x00, 0xe0, 0xc8, 0xe0, 0x08, 0x2b, 0x04, 0x1c,
+  0x19, 0xdc, 0x29, 0x04, 0x80, 0x23, 0x83, 0x4b, 0xee, 0x00, 0x70, 0x64, 0x70, 0xb4, 0x00, 0x00,
+  0x8e, 0x0c, 0x8e, 0x16, 0x02, 0xc0, 0x91, 0xc1, 0xd1, 0xe4, 0x0e, 0x38, 0x32, 0xc0, 0x42, 0x00,
+  0x00, 0x47, 0x06, 0x19, 0x58, 0x21, 0xe0, 0xc8, 0x20, 0x0b, 0x00, 0x00, 0x1c, 0x19, 0x64, 0x09,
+  0x0c, 0x80, 0x23, 0x83, 0x2c, 0x04, 0x00, 0x70, 0x64, 0x90, 0xc5, 0x01, 0x00, 0x8e, 0x0c, 0xb2,
+  0xb8, 0xe4, 0xce, 0x91, 0x41, 0x16, 0x47, 0x01, 0x38, 0x32, 0xc8, 0xe2, 0x68, 0x21, 0x47, 0x06,
+  0x59, 0x64, 0x21, 0xe0, 0xc8, 0x20, 0xcb, 0x2c, 0x04, 0x1c, 0x19, 0x64, 0x32, 0xc9, 0x81, 0x23,
+  0x83, 0x4c, 0x0e, 0x00, 0x70, 0x64, 0x90, 0xc9, 0x1d, 0x00, 0x8e, 0x0c, 0x32, 0x39, 0x9a, 0xc6,
+  0x91, 0x41, 0xa6, 0x57, 0x19, 0x38, 0x32, 0xc8, 0x57, 0x69, 0x21, 0x47, 0x86, 0x19, 0x68, 0x21,
+  0xe0, 0xc8, 0x30, 0x8b, 0x03, 0x00, 0x1c, 0x19, 0x66, 0x91, 0x85, 0x80, 0x23, 0xc3, 0x44, 0x05,
+  0x00, 0x70, 0x64, 0x98, 0xa8, 0x10, 0x00, 0x8e, 0x0c, 0x13, 0x95, 0x39, 0xc1, 0x91, 0x61, 0x26,
+  0x47, 0x01, 0x38, 0x32, 0xcc, 0x95, 0x01, 0x00, 0x47, 0x86, 0xf9, 0xdc, 0x01, 0xe0, 0xc8, 0x30,
+  0x29, 0x00, 0x00, 0x1c, 0x19, 0x26, 0x0d, 0x0c, 0x80, 0x23, 0xc3, 0xa4, 0x85, 0x00, 0x70, 0x64,
+  0x98, 0x34, 0x39, 0x00, 0x8e, 0x0c, 0x93, 0xa6, 0x57, 0xe7, 0x91, 0x61, 0x66, 0x00, 0x00, 0x38,
+  0x32, 0xd0, 0x42, 0x00, 0x00, 0x47, 0x06, 0x8a, 0x0a, 0x01, 0xe0, 0xc8, 0x40, 0x51, 0x7a, 0x75,
+  0x1e, 0x19, 0x28, 0xa2, 0x69, 0x80, 0x23, 0x03, 0x45, 0x19, 0x00, 0x70, 0x64, 0xa0, 0x89, 0x00,
+  0x00, 0x8e, 0x0c, 0x34, 0xb9, 0x42, 0xc0, 0x91, 0x81, 0x26, 0x77, 0x00, 0x38, 0x32, 0xd0, 0x34,
+  0x69, 0x21, 0x47, 0x06, 0x9a, 0x26, 0x4d, 0xe3, 0xc8, 0x40, 0xab, 0x0c, 0xee, 0x1c, 0x19, 0x68,
+  0x95, 0x85, 0x80, 0x23, 0x83, 0x2d, 0xf2, 0x55, 0x76, 0xe4, 0x08, 0x32, 0x8d, 0x42, 0x8e, 0x1c,
+  0xc5, 0x15, 0x00, 0xc0, 0x91, 0xa3, 0xb8, 0x34, 0x00, 0x38, 0x72, 0x14, 0x99, 0xdc, 0x01, 0x47,
+  0x8e, 0x32, 0x69, 0x21, 0xe0, 0xc8, 0x02, 0x00, 0x00, 0x00, 0x1c, 0x59, 0x82, 0x23, 0x00, 0x80,
+  0x23, 0x4b, 0x61, 0x05, 0x00, 0x70, 0x64, 0x29, 0x8e, 0x00, 0x00, 0x8e, 0x2c, 0x86, 0xa5, 0x01,
+  0xc0, 0x91, 0x85, 0x15, 0x00, 0x00, 0x38, 0xb2, 0xb0, 0xe2, 0x0e, 0x00, 0x47, 0x16, 0xf6, 0x28,
+  0x00, 0xe0, 0xc8, 0xe2, 0x08, 0x00, 0x00, 0x1c, 0x59, 0x1c, 0x29, 0x04, 0x80, 0x23, 0x8b, 0x3b,
+  0x85, 0x00, 0x70, 0x64, 0x71, 0xb4, 0x0c, 0x00, 0x8e, 0x2c, 0x8e, 0x16, 0x02, 0xc0, 0x91, 0xc5,
+  0xd1, 0x34, 0x00, 0x38, 0xb2, 0x38, 0x9a, 0x1c, 0x00, 0x47, 0x16, 0x58, 0x1c, 0x00, 0xe0, 0xc8,
+  0x22, 0x03, 0x4d, 0xee, 0x1c, 0x59, 0x64, 0x61, 0x85, 0x80, 0x23, 0x8b, 0x2c, 0xee, 0x00, 0x70,
+  0x64, 0x91, 0x65, 0xa2, 0x42, 0x8e, 0x2c, 0x32, 0xb9, 0x03, 0xc0, 0x91, 0x45, 0xa6, 0x49, 0xd3,
+  0x38, 0xb2, 0x48, 0x47, 0xd3, 0x2a, 0x47, 0x16, 0xf9, 0x64, 0x21, 0xe0, 0xc8, 0x53, 0x64, 0x21,
+  0x00, 0x1c, 0x99, 0x4e, 0x71, 0x07, 0x80, 0x23, 0xd3, 0x41, 0x85, 0x00, 0x70, 0x64, 0x62, 0x04,
+  0x00, 0x00, 0x8e, 0x4c, 0xac, 0xc8, 0x57, 0xe7, 0x91, 0x89, 0x95, 0x49, 0x01, 0x38, 0x32, 0xb1,
+  0x44, 0x0b, 0x01, 0x47, 0xa6, 0x16, 0x58, 0x21, 0xe0, 0xc8, 0xd4, 0x82, 0x4c, 0x8e, 0x1e, 0x99,
+  0x5a, 0x71, 0x00, 0x80, 0x23, 0x53, 0x2b, 0xb2, 0x10, 0x70, 0x64, 0x6a, 0x45, 0xbe, 0x3a, 0x8f,
+  0x4c, 0x2d, 0xb9, 0x03, 0xc0, 0x91, 0xa9, 0xbd, 0xfa, 0xea, 0x3c, 0x32, 0x39, 0x02, 0x00, 0x00,
+  0x47, 0x26, 0x47, 0x0a, 0x01, 0xe0, 0xc8, 0xe4, 0x08, 0x2b, 0x04, 0x1c, 0x99, 0xdc, 0x29, 0x04,
+  0x80, 0x23, 0x93, 0x4b, 0xee, 0x00, 0x70, 0x64, 0x72, 0x0b, 0x00, 0x00, 0x8e, 0x4c, 0x6e, 0x65,
+  0x00, 0xc0, 0x91, 0xc9, 0xd1, 0xe4, 0x0e, 0x38, 0x32, 0x39, 0x9a, 0x5e, 0x9d, 0x47, 0x26, 0x47,
+  0x59, 0x01, 0xe0, 0xc8, 0x34, 0x8b, 0x4c, 0x03, 0x1c, 0x99, 0xe6, 0x93, 0xc9, 0x9d, 0x23, 0xd3,
+  0x9c, 0x34, 0x15, 0x72, 0x64, 0x9a, 0xb4, 0x10, 0x00, 0x8e, 0x4c, 0x93, 0x16, 0x59, 0xc8, 0x91,
+  0x89, 0x06, 0x77, 0x00, 0x38, 0x32, 0xd1, 0x62, 0x2a, 0x05, 0x47, 0x26, 0x8a, 0x68, 0x21, 0xe0,
+  0xc8, 0x44, 0x93, 0x03, 0x00, 0x1c, 0x99, 0x68, 0x72, 0x07, 0x80, 0x23, 0x5f, 0x70, 0x07, 0x00,
+  0x70, 0xe4, 0x1b, 0xc9, 0x1d, 0x00, 0x8e, 0x7c, 0xa4, 0x38, 0x00, 0xc0, 0x91, 0x8f, 0x14, 0x47,
+  0xd3, 0x38, 0xf2, 0x91, 0xe4, 0x00, 0x00, 0x47, 0x3e, 0x92, 0xdc, 0x01, 0xe0, 0xc8, 0x47, 0x9e,
+  0xa3, 0x69, 0x1c, 0xf9, 0x18, 0x01, 0x00, 0x80, 0x23, 0x1f, 0x23, 0xac, 0x10, 0x70, 0xe4, 0x63,
+  0x05, 0x00, 0x00, 0x8e, 0x7c, 0xac, 0x10, 0x00, 0xc0, 0x91, 0x8f, 0x15, 0x77, 0x00, 0x38, 0xf2,
+  0xb5, 0x90, 0x06, 0x00, 0x47, 0xbe, 0x26, 0x58, 0x21, 0xe0, 0xc8, 0xd7, 0x0a, 0x01, 0x00, 0x1c,
+  0xf9, 0x5a, 0x72, 0x07, 0x80, 0x23, 0x5f, 0x7b, 0x2d, 0x30, 0x70, 0xe4, 0x73, 0x04, 0x00, 0x00,
+  0x8e, 0x7c, 0x8e, 0xb0, 0xc0, 0xc0, 0x91, 0xcf, 0x11, 0x56, 0x08, 0x38, 0xf2, 0xb9, 0x53, 0x08,
+  0x00, 0x47, 0x3e, 0x47, 0x0b, 0x01, 0xe0, 0xc8, 0xe7, 0x68, 0x1a, 0x00, 0x1c, 0xf9, 0x1e, 0x4b,
+  0xee, 0x80, 0x23, 0xdf, 0x93, 0x81, 0x01, 0x70, 0xe4, 0x93, 0x81, 0x15, 0x02, 0x8e, 0x7c, 0x32,
+  0xd0, 0xe4, 0xe8, 0x91, 0x4f, 0x12, 0x00, 0x00, 0x38, 0xf2, 0xc9, 0x42, 0x00, 0x00, 0x47, 0x3e,
+  0x59, 0x4c, 0x65, 0xe0, 0xc8, 0x27, 0x8b, 0x03, 0x00, 0x1c, 0xf9, 0x64, 0x71, 0x07, 0x80, 0x23,
+  0x9f, 0x2c, 0xf2, 0xd5, 0x79, 0xe4, 0x93, 0x29, 0xb8, 0x03, 0x8e, 0x7c, 0x32, 0x8d, 0xe0, 0xce,
+  0x91, 0x4f, 0x26, 0x57, 0x08, 0x38, 0xf2, 0xc9, 0xe4, 0x0e, 0x00, 0x47, 0x3e, 0xe9, 0x28, 0x00,
+  0xe0, 0xc8, 0x27, 0x5f, 0x9d, 0x73, 0x1e, 0xf9, 0x68, 0x90, 0xaf, 0xce, 0x23, 0x1f, 0x2d, 0x04,
+  0x00, 0x70, 0xe4, 0xa3, 0xc5, 0x1d, 0x00, 0x8e, 0x7c, 0x14, 0x15, 0x02, 0xc0, 0x91, 0x8f, 0xa2,
+  0x14, 0x18, 0x38, 0xf2, 0xd5, 0xe4, 0x0e, 0x00, 0x47, 0xbe, 0xca, 0x8a, 0x3b, 0xe0, 0xc8, 0x57,
+  0x65, 0xa0, 0x85, 0x1c, 0xf9, 0xaa, 0x2c, 0x04, 0x80, 0x23, 0x5f, 0x9d, 0x14, 0x00, 0x70, 0xe4,
+  0xab, 0x33, 0x03, 0x00, 0x8e, 0x7c, 0xb6, 0x90, 0xe4, 0xce, 0x91, 0xcf, 0x16, 0x99, 0x56, 0x39,
+  0xf2, 0xdd, 0xc0, 0x0a, 0x01, 0x47, 0xbe, 0x5b, 0x00, 0x00, 0xe0, 0xc8, 0x77, 0x8b, 0x3b, 0x00,
+  0x1c, 0xf9, 0x6e, 0x72, 0x00, 0x80, 0x23, 0xab, 0x23, 0x00, 0x00, 0x70, 0x64, 0x75, 0xb4, 0x10,
+  0x00, 0x8e, 0xac, 0x8e, 0xa6, 0x01, 0xc0, 0x91, 0xd5, 0xd1, 0xe4, 0x00, 0x38, 0xb2, 0xca, 0xe4,
+  0x0e, 0x00, 0x28, 0xb0, 0x20, 0x58, 0x1a, 0x00, 0x05, 0x46, 0xd2, 0x4c, 0x03, 0xa0, 0xc0, 0x8a,
+  0x1b, 0x81, 0x01, 0x14, 0x58, 0x1a, 0x34, 0xd9, 0x82, 0x02, 0x7b, 0x34, 0x0d, 0x00, 0x50, 0x70,
+  0x04, 0x00, 0x00, 0x00, 0x0a, 0x8e, 0x24, 0x02, 0x00, 0x40, 0xc1, 0x25, 0x56, 0x08, 0x00, 0x28,
+  0xc0, 0x22, 0x0b, 0x01, 0x00, 0x05, 0x98, 0x9e, 0x7c, 0x75, 0xa2, 0x20, 0x03, 0x4d, 0x8e, 0x02,
+  0x14, 0x64, 0x91, 0x85, 0x00, 0x80, 0x82, 0x4c, 0x04, 0x00, 0x00, 0x50, 0x90, 0xc9, 0x1d, 0x00,
+  0x00, 0x0a, 0x32, 0xb9, 0x34, 0x00, 0x40, 0x41, 0xb6, 0x40, 0x01, 0x00, 0x28, 0x48, 0xfa, 0xdc,
+  0x01, 0x00, 0x85, 0x49, 0x8b, 0x0c, 0x0c, 0xa0, 0x40, 0x11, 0x4d, 0xee, 0x00, 0x14, 0x68, 0x22,
+  0x00, 0x00, 0x80, 0x42, 0x75, 0xb4, 0x10, 0x00, 0x50, 0xd0, 0xc5, 0x15, 0x02, 0x00, 0x7a, 0xad,
+  0xc8, 0x42, 0x00, 0x40, 0xcf, 0x11, 0x00, 0x00, 0x00, 0xe8, 0xc9, 0x42, 0x18, 0x00, 0x00, 0x3d,
+  0x59, 0x64, 0x21, 0x00, 0xa0, 0x27, 0xd3, 0x48, 0x0e, 0x00, 0xf4, 0x64, 0x22, 0x00, 0x00, 0x80,
+  0x9e, 0x4c, 0x34, 0xb9, 0x03, 0xd0, 0x93, 0xab, 0x38, 0x00, 0x00, 0x7a, 0xf2, 0xb1, 0x34, 0x00,
+  0x40, 0x4f, 0xda, 0xe2, 0x0e, 0x00, 0xa9, 0x3d, 0x19, 0x28, 0x00, 0x20, 0xb5, 0x57, 0x09, 0x00,
+  0x00, 0xa4, 0x06, 0x03, 0x2b, 0x04, 0x80, 0xd4, 0x60, 0x71, 0x00, 0x00, 0x90, 0x1a, 0x2c, 0x8e,
+  0x16, 0x02, 0x52, 0x83, 0x34, 0x0d, 0x00, 0x40, 0x6a, 0x90, 0xa6, 0x99, 0xdc, 0x49, 0x0d, 0xd2,
+  0x34, 0x27, 0x00, 0xc9, 0x85, 0x83, 0x58, 0x21, 0x20, 0xb9, 0xc0, 0x0a, 0x01, 0x00, 0x24, 0x17,
+  0x1c, 0x01, 0x00, 0x80, 0xe4, 0x82, 0x4c, 0xee, 0x00, 0x90, 0x5c, 0x98, 0xc1, 0xd1, 0x34, 0x92,
+  0x0b, 0xb6, 0x10, 0x00, 0x40, 0x72, 0x01, 0x27, 0x77, 0x00, 0x48, 0x6e, 0x04, 0x9a, 0x5e, 0x9d,
+  0xc9, 0x8d, 0x02, 0x00, 0x00, 0x20, 0xb9, 0x51, 0x1c, 0x01, 0x00, 0x24, 0x37, 0x8a, 0x4b, 0x8e,
+  0x82, 0xe4, 0x46, 0x99, 0xe9, 0x55, 0x96, 0xdc, 0x48, 0x03, 0x00, 0x00, 0x92, 0x1b, 0x69, 0x24,
+  0x07, 0x40, 0x72, 0x23, 0x39, 0x5a, 0x08, 0x48, 0x6e, 0x2c, 0x00, 0x00, 0x00, 0xc9, 0x8d, 0xd7,
+  0x92, 0x3b, 0x20, 0x39, 0x12, 0x64, 0x91, 0x05, 0x24, 0x47, 0x0a, 0x00, 0x00, 0x80, 0xe4, 0x48,
+  0x21, 0xb2, 0x00, 0x90, 0x1c, 0x29, 0xee, 0x00, 0x00, 0x92, 0x23, 0xc5, 0xd1, 0x42, 0x40, 0x72,
+  0x24, 0x1d, 0x54, 0x00, 0x48, 0xce, 0x14, 0x02, 0x00, 0x00, 0xc9, 0x99, 0xe2, 0x06, 0x00, 0x20,
+  0x39, 0x53, 0x5c, 0x0a, 0x0c, 0x24, 0x67, 0x8a, 0xa3, 0x85, 0x80, 0xe4, 0x4e, 0x21, 0x19, 0x00,
+  0x90, 0xdc, 0x29, 0x33, 0xb9, 0x03, 0x92, 0x3b, 0xa8, 0x10, 0x00, 0x40, 0x72, 0x07, 0x95, 0x49,
+  0xd3, 0x48, 0xee, 0xa0, 0x34, 0x0b, 0x01, 0xc9, 0x9d, 0x34, 0x92, 0x3b, 0x20, 0xb9, 0x93, 0x8e,
+  0xa3, 0x69, 0x24, 0x87, 0x0a, 0x2b, 0x00, 0x80, 0xe4, 0x50, 0x71, 0x14, 0x00, 0x90, 0x1c, 0x7a,
+  0xb1, 0x4e, 0x04, 0x92, 0x4b, 0x85, 0x00, 0x00, 0x40, 0x72, 0xa9, 0x25, 0x47, 0x0b, 0x49, 0xee,
+  0xb5, 0xe4, 0x0e, 0x00, 0xc9, 0xbd, 0xc6, 0x0a, 0x00, 0x20, 0xb9, 0x27, 0x83, 0x03, 0x00, 0x24,
+  0xf7, 0x64, 0x21, 0x00, 0x80, 0xe4, 0xe6, 0x6b, 0xc1, 0x51, 0x90, 0x1c, 0x0d, 0x2c, 0xb9, 0x03,
+  0x92, 0xa3, 0x81, 0x25, 0x47, 0x41, 0x72, 0x34, 0xb8, 0x03, 0x00, 0x48, 0x8e, 0x06, 0x47, 0x01,
+  0x00, 0xc9, 0xd1, 0x11, 0x58, 0x21, 0x20, 0x39, 0x3a, 0x92, 0xa3, 0x00, 0x24, 0x47, 0x8b, 0x03,
+  0x00, 0x80, 0xe4, 0x68, 0x71, 0x07, 0x00, 0x90, 0x1c, 0x2d, 0x2e, 0xb9, 0x03, 0x92, 0xa3, 0xc5,
+  0x25, 0x47, 0x41, 0x72, 0xb4, 0xc8, 0xc0, 0x0a, 0x49, 0x8e, 0x22, 0x00, 0x00, 0x00, 0xc9, 0x51,
+  0x54, 0x00, 0x00, 0x20, 0x39, 0x8a, 0x0a, 0x01, 0x00, 0x24, 0x47, 0x51, 0x71, 0x85, 0x80, 0xe4,
+  0x28, 0x2a, 0xee, 0x00, 0x90, 0x1c, 0x45, 0xc5, 0x51, 0x00, 0x92, 0xa3, 0xa8, 0xc8, 0x57, 0x67,
+  0x72, 0x14, 0x99, 0xfa, 0xea, 0x4c, 0x8e, 0xa2, 0x34, 0x00, 0x00, 0xc9, 0x51, 0x94, 0x46, 0x60,
+  0x20, 0x39, 0x8a, 0x12, 0x01, 0x00, 0x24, 0x47, 0x51, 0x72, 0x00, 0x80, 0xe4, 0x28, 0x4a, 0xee,
+  0x00, 0x90, 0x1c, 0x45, 0xe9, 0x55, 0x06, 0x92, 0xa3, 0x28, 0xbd, 0x3a, 0x41, 0x72, 0x14, 0x25,
+  0x5b, 0x08, 0x48, 0x8e, 0x22, 0x56, 0xdc, 0x01, 0xc9, 0x51, 0x44, 0x0b, 0x01, 0x20, 0x39, 0x9a,
+  0x08, 0x00, 0x00, 0x24, 0x47, 0x13, 0x4b, 0xee, 0x80, 0xe4, 0x68, 0x72, 0xc1, 0x1d, 0x90, 0x1c,
+  0x4d, 0x8e, 0x00, 0x00, 0x92, 0xa3, 0x69, 0x16, 0x02, 0x40, 0x72, 0x34, 0xcd, 0x14, 0xdc, 0x49,
+  0x8e, 0xa6, 0x99, 0x5e, 0x9d, 0xc9, 0xd1, 0x34, 0x29, 0x00, 0x20, 0x39, 0x4a, 0x8b, 0x3b, 0x00,
+  0x24, 0x47, 0x69, 0x1a, 0x00, 0x80, 0xe4, 0x68, 0x65, 0x69, 0x00, 0x90, 0x1c, 0xad, 0x33, 0xb9,
+  0x03, 0x92, 0xb3, 0x05, 0x00, 0x00, 0x40, 0x72, 0xb6, 0x10, 0x00, 0x00, 0x48, 0xce, 0x16, 0x53,
+  0x19, 0x00, 0xc9, 0xd9, 0x62, 0xea, 0x04, 0x20, 0x39, 0x5b, 0x58, 0x0a, 0x0c, 0x24, 0x67, 0x0b,
+  0x4b, 0x03, 0x80, 0xe4, 0x6c, 0x71, 0x00, 0x00, 0x90, 0x9c, 0x2d, 0x2e, 0xd0, 0x34, 0x92, 0xb3,
+  0xc5, 0x8d, 0xc0, 0x40, 0x72, 0xb6, 0x38, 0x02, 0x00, 0x48, 0xce, 0x16, 0x77, 0x00, 0x00, 0xc9,
+  0xd9, 0xe2, 0x68, 0x0a, 0x2c, 0x39, 0x5b, 0x64, 0x21, 0x00, 0x24, 0x67, 0x8b, 0x4c, 0xee, 0x80,
+  0xe4, 0x6c, 0x99, 0x29, 0x30, 0xa0, 0x02, 0xab, 0xb2, 0xc8, 0x42, 0x54, 0xb0, 0x45, 0xa6, 0x01,
+  0x80, 0xaa, 0xb2, 0x55, 0x56, 0x08, 0x58, 0xc9, 0x91, 0xe2, 0x00, 0x00, 0x2c, 0xb0, 0x24, 0x03,
+  0x03, 0x80, 0x05, 0x99, 0x66, 0x06, 0x00, 0xb0, 0x20, 0x5f, 0x4b, 0x03, 0x00, 0x16, 0x24, 0x4d,
+  0x13, 0x01, 0xc0, 0x52, 0x68, 0xc9, 0x1d, 0x00, 0x58, 0x12, 0x37, 0x39, 0x00, 0x00, 0x4b, 0x23,
+  0xb8, 0x03, 0x00, 0x60, 0x89, 0x00, 0x00, 0x00, 0x00, 0x2c, 0x91, 0x02, 0x00, 0x00, 0x80, 0x25,
+  0x53, 0x00, 0x00, 0x00, 0xb0, 0x64, 0x8a, 0x23, 0x00, 0x00, 0x96, 0x4c, 0x91, 0x85, 0x00, 0xc0,
+  0x92, 0xa1, 0x05, 0x00, 0x00, 0x58, 0x3a, 0x61, 0xd0, 0x02, 0x00, 0x4b, 0x27, 0x38, 0x9a, 0x08,
+  0x60, 0xe9, 0x14, 0x00, 0x00, 0x00, 0x2c, 0x9d, 0x42, 0x00, 0x00, 0x80, 0xa5, 0x53, 0x1c, 0x01,
+  0x00, 0xb0, 0x74, 0x8a, 0xa3, 0x85, 0x00, 0x96, 0x4e, 0x91, 0xa6, 0x32, 0xc0, 0xd2, 0x41, 0x65,
+  0x16, 0x00, 0x58, 0x3a, 0x28, 0x8d, 0xc0, 0x00, 0x4b, 0x07, 0xa5, 0x39, 0x27, 0x60, 0xe9, 0xa0,
+  0x0c, 0x00, 0x00, 0x2c, 0x9d, 0x44, 0x00, 0x00, 0x80, 0xa5, 0x93, 0x5c, 0x1a, 0x00, 0xb0, 0x74,
+  0xd2, 0x6b, 0x85, 0x00, 0x96, 0x4e, 0x9a, 0x34, 0x0d, 0xc0, 0xd2, 0xa9, 0x04, 0x00, 0x00, 0x58,
+  0x3a, 0x55, 0x06, 0x0a, 0x00, 0x4b, 0xa7, 0x4a, 0x02, 0x00, 0x60, 0xe9, 0x54, 0x59, 0x08, 0x00,
+  0x2c, 0x9d, 0x2a, 0x9f, 0x3b, 0x80, 0xa5, 0x53, 0x27, 0x2a, 0x00, 0xb0, 0x74, 0xea, 0x4c, 0x03,
+  0x00, 0x96, 0x8e, 0x66, 0x85, 0x00, 0xc0, 0xd2, 0xd1, 0x2c, 0x39, 0x0a, 0x58, 0x62, 0x61, 0x14,
+  0x02, 0x00, 0x4b, 0x2c, 0x34, 0x77, 0x00, 0x60, 0x89, 0x05, 0x77, 0x00, 0x00, 0x2c, 0x31, 0x02,
+  0x00, 0x00, 0x80, 0x25, 0x66, 0x2a, 0x2b, 0x04, 0xb0, 0xc4, 0xd2, 0x08, 0x14, 0x00, 0x96, 0x58,
+  0x1a, 0x34, 0xb9, 0xc3, 0x12, 0x63, 0x85, 0x00, 0x00, 0x58, 0x62, 0x4f, 0x16, 0x02, 0x00, 0x4b,
+  0xec, 0xc9, 0x32, 0x01, 0x60, 0x89, 0xd1, 0xe4, 0x28, 0x00, 0x2c, 0xb1, 0x9a, 0x06, 0x00, 0x80,
+  0x25, 0x56, 0x65, 0x21, 0x00, 0xb0, 0xe4, 0xc2, 0x28, 0x04, 0x00, 0x96, 0x5c, 0x60, 0x19, 0x00,
+  0xc0, 0x92, 0x0b, 0xb2, 0x10, 0x00, 0x58, 0x72, 0x81, 0x66, 0x00, 0x00, 0x4b, 0x8e, 0x00, 0x00,
+  0x00, 0x60, 0xc9, 0x91, 0xc0, 0x0a, 0x01, 0x2c, 0x39, 0x32, 0x50, 0x21, 0x80, 0x25, 0x47, 0x0a,
+  0x00, 0x00, 0xb0, 0xe4, 0x48, 0x21, 0x00, 0x00, 0x96, 0x1c, 0x29, 0xee, 0x00, 0xc0, 0x92, 0x23,
+  0x45, 0xbe, 0x3a, 0x59, 0x72, 0xa4, 0xc8, 0x0c, 0x00, 0x4b, 0x8e, 0x24, 0x77, 0x00, 0x60, 0xc9,
+  0x91, 0x34, 0x51, 0x21, 0x2c, 0x39, 0x92, 0x66, 0x72, 0x87, 0x25, 0x47, 0x58, 0x01, 0x00, 0xb0,
+  0xe4, 0x88, 0x74, 0x85, 0x00, 0x96, 0x1c, 0x99, 0x14, 0x00, 0xc0, 0x92, 0x23, 0x19, 0x00, 0x00,
+  0x58, 0x72, 0x85, 0x00, 0x00, 0x00, 0x4b, 0xae, 0xb8, 0x01, 0x00, 0x60, 0xc9, 0x15, 0x47, 0x00,
+  0x00, 0x2c, 0xb9, 0xe2, 0x0a, 0x01, 0x80, 0x25, 0x57, 0xdc, 0x01, 0x00, 0xb0, 0xe4, 0x8a, 0x4b,
+  0xee, 0x00, 0x96, 0x5c, 0x71, 0x34, 0x39, 0xca, 0x92, 0x2b, 0x32, 0x08, 0x06, 0x58, 0x72, 0x45,
+  0x06, 0x06, 0x00, 0x4b, 0xae, 0xc8, 0x42, 0x00, 0x60, 0xc9, 0x15, 0x69, 0x00, 0x00, 0x2c, 0xb9,
+  0x22, 0x93, 0x3b, 0x80, 0x25, 0x57, 0x64, 0x72, 0x14, 0xb0, 0xe4, 0xca, 0xa4, 0x85, 0x00, 0x96,
+  0xdc, 0x29, 0x04, 0x00, 0xc0, 0x92, 0x3b, 0xa8, 0x04, 0x06, 0x58, 0x72, 0x69, 0x24, 0x47, 0x01,
+  0x4b, 0x2e, 0x11, 0x00, 0x00, 0x60, 0xc9, 0xa5, 0x27, 0x03, 0x03, 0x2c, 0xb9, 0xf4, 0x64, 0x21,
+  0x80, 0x25, 0x97, 0x9e, 0x4c, 0xab, 0xb0, 0xe4, 0x92, 0x2c, 0x00, 0x00, 0x96, 0x5c, 0x92, 0xe9,
+  0xd5, 0xc9, 0x92, 0x5b, 0xc5, 0x51, 0x00, 0x58, 0x72, 0xaf, 0x39, 0x0a, 0x00, 0x4b, 0xee, 0xc9,
+  0xc0, 0x32, 0x60, 0xc9, 0x3d, 0x19, 0xdc, 0x01, 0x2c, 0xb9, 0x27, 0x0b, 0x01, 0x80, 0x25, 0xf7,
+  0x68, 0x21, 0x00, 0xb0, 0xe4, 0x66, 0x98, 0x14, 0x00, 0x96, 0xdc, 0x44, 0x85, 0x00, 0xc0, 0x92,
+  0x9b, 0x34, 0x0d, 0x00, 0x58, 0x7a, 0x32, 0x0d, 0x00, 0x00, 0x4b, 0xb0, 0x00, 0x00, 0x00, 0x60,
+  0x09, 0x16, 0x02, 0x00, 0x00, 0x2c, 0xc1, 0x42, 0x58, 0x21, 0x80, 0x25, 0x58, 0x1c, 0x4d, 0x03,
+  0xb0, 0x04, 0x65, 0x12, 0xc9, 0x1d, 0x96, 0x64, 0x10, 0xac, 0x10, 0xc0, 0x92, 0x0c, 0x2c, 0x0d,
+  0x00, 0x58, 0x92, 0x85, 0x25, 0x77, 0x00, 0x4b, 0xb2, 0xc8, 0xf4, 0xea, 0x64, 0x49, 0xa6, 0x53,
+  0x08, 0x00, 0x2c, 0xc9, 0xe4, 0xd2, 0x00, 0x80, 0x25, 0x99, 0x66, 0x72, 0x14, 0xb0, 0x24, 0xd3,
+  0xa4, 0x85, 0x00, 0x96, 0x64, 0x9a, 0x34, 0xb9, 0xc3, 0x92, 0x7c, 0x32, 0xd0, 0x42, 0x58, 0x92,
+  0xb2, 0x4c, 0x0a, 0x00, 0x4b, 0xb3, 0xb8, 0x32, 0x27, 0x60, 0x69, 0x22, 0xfa, 0x2a, 0x03, 0x2c,
+  0x4d, 0x58, 0xe4, 0xab, 0x93, 0xa5, 0x09, 0x69, 0x72, 0x14, 0xb0, 0x34, 0x61, 0x06, 0x00, 0x00,
+  0x96, 0xe6, 0x0c, 0xac, 0x10, 0xc0, 0xd2, 0x9c, 0x34, 0x8d, 0xc0, 0x58, 0x9a, 0x14, 0x00, 0x00,
+  0x00, 0x4b, 0x93, 0x06, 0x0a, 0x00, 0x60, 0x69, 0xd2, 0x42, 0x00, 0x00, 0x2c, 0x4d, 0x5a, 0xdc,
+  0x01, 0x80, 0xa5, 0x49, 0x8b, 0xa3, 0x00, 0xb0, 0x34, 0x69, 0x91, 0x85, 0x00, 0x96, 0x26, 0x2d,
+  0xf2, 0xd5, 0xc9, 0xd2, 0xa4, 0xa8, 0x10, 0x00, 0x58, 0x9a, 0x14, 0xa5, 0x01, 0x00, 0x4b, 0x93,
+  0xa2, 0x64, 0x0b, 0x61, 0x69, 0xd2, 0x64, 0xea, 0x9c, 0x2c, 0x4d, 0x9a, 0x1c, 0x00, 0x80, 0xa5,
+  0x49, 0x93, 0xa3, 0x85, 0xb0, 0x34, 0xa9, 0xa4, 0x85, 0x00, 0x96, 0x26, 0xcd, 0x00, 0x00, 0xc0,
+  0x12, 0x0d, 0x2c, 0x39, 0x5a, 0x58, 0xa2, 0x05, 0x00, 0x00, 0x00, 0x4b, 0x14, 0x05, 0x99, 0xdc,
+  0x61, 0x89, 0xa2, 0x42, 0x00, 0x00, 0x2c, 0x51, 0x54, 0x4c, 0x65, 0x80, 0x25, 0x8a, 0x8a, 0x03,
+  0x00, 0xb0, 0x44, 0x51, 0x71, 0x07, 0x00, 0x96, 0x28, 0x2a, 0xb2, 0x10, 0xc0, 0x12, 0x45, 0x89,
+  0x15, 0x02, 0x58, 0xa2, 0x28, 0xb9, 0x03, 0x00, 0x4b, 0x14, 0xa5, 0x57, 0x27, 0x60, 0x89, 0xa2,
+  0xe7, 0x00, 0x00, 0x2c, 0x51, 0x44, 0x8b, 0xa9, 0x93, 0x25, 0x8a, 0x68, 0x72, 0xb4, 0xb0, 0x44,
+  0x53, 0x70, 0x00, 0x00, 0x96, 0x68, 0x1a, 0x69, 0x00, 0xc0, 0x12, 0x4d, 0x2c, 0x0d, 0x00, 0x58,
+  0xa2, 0x6f, 0x04, 0x59, 0x00, 0x4b, 0x94, 0x16, 0x07, 0x00, 0x60, 0x89, 0x56, 0x97, 0xdc, 0x01,
+  0x2c, 0xd1, 0x2a, 0x93, 0x3b, 0x80, 0x25, 0x5b, 0x00, 0x00, 0x00, 0xb0, 0x64, 0x0b, 0x01, 0x00,
+  0x00, 0x96, 0x6c, 0x71, 0x04, 0x00, 0xc0, 0x92, 0x2d, 0xee, 0x00, 0x00, 0x58, 0xb2, 0x45, 0x16,
+  0x02, 0x00, 0x4b, 0xf6, 0xc9, 0x22, 0x0b, 0x61, 0x49, 0x87, 0x55, 0x08, 0x00, 0x2c, 0xe9, 0xe0,
+  0x46, 0x60, 0x80, 0x25, 0x1d, 0xdc, 0x01, 0x00, 0xb0, 0xa4, 0x83, 0x4c, 0x03, 0x00, 0x96, 0x74,
+  0x71, 0xb4, 0x10, 0xc0, 0x92, 0x2e, 0xf2, 0x55, 0x06, 0x58, 0xd2, 0xba, 0x10, 0x00, 0x00, 0x4b,
+  0x5a, 0xa7, 0x57, 0x19, 0x60, 0x49, 0xeb, 0x0c, 0x00, 0x00, 0xec, 0x05, 0x19, 0x08, 0x00, 0x80,
+  0xbd, 0x20, 0x85, 0x2c, 0x04, 0xb0, 0x57, 0x00, 0x00, 0x00, 0x00, 0xf6, 0x4c, 0x71, 0x85, 0x00,
+  0xc0, 0x9e, 0x29, 0x92, 0x00, 0x00, 0xd8, 0x33, 0x45, 0x16, 0x02, 0x00, 0x7b, 0xa8, 0x98, 0xfa,
+  0xea, 0x64, 0x8f, 0x05, 0x37, 0x68, 0x1a, 0xec, 0xb1, 0xe0, 0x5e, 0x65, 0x80, 0x3d, 0x16, 0x68,
+  0x71, 0x07, 0xb0, 0xc7, 0x06, 0x02, 0x00, 0x00, 0xf6, 0xd8, 0xa0, 0x45, 0x16, 0xc0, 0x1e, 0x23,
+  0x00, 0x00, 0x00, 0xd8, 0x63, 0xa4, 0x10, 0x00, 0x00, 0x7b, 0x8c, 0x24, 0x02, 0x00, 0x60, 0x8f,
+  0x15, 0x96, 0xdc, 0x01, 0xec, 0xb1, 0x34, 0x10, 0x05, 0x80, 0x3d, 0x96, 0x08, 0x00, 0x00, 0xb0,
+  0xc7, 0x12, 0x2b, 0x04, 0x00, 0xf6, 0x58, 0x72, 0x69, 0x00, 0xc0, 0x1e, 0x4b, 0x94, 0x15, 0x02,
+  0xd8, 0x63, 0xac, 0xc8, 0x57, 0x27, 0x7b, 0x8c, 0x31, 0x00, 0x00, 0x60, 0x8f, 0xb1, 0x57, 0xe7,
+  0x04, 0xec, 0xb1, 0xe7, 0x08, 0x00, 0x80, 0x3d, 0xf6, 0x64, 0x21, 0x00, 0xb0, 0xc7, 0x9e, 0x2d,
+  0x04, 0x00, 0xf6, 0x58, 0x25, 0x00, 0x00, 0xc0, 0x1e, 0xcb, 0x00, 0x00, 0x00, 0xd8, 0x6b, 0x61,
+  0x04, 0x06, 0x00, 0x7b, 0x2d, 0xb9, 0xe4, 0x0e, 0x60, 0xaf, 0xa5, 0x99, 0x06, 0x00, 0xec, 0xb5,
+  0x34, 0x69, 0x21, 0x80, 0xbd, 0xf6, 0x5a, 0x22, 0x00, 0xb0, 0xd7, 0xe0, 0xab, 0x13, 0x00, 0xf6,
+  0x1c, 0x01, 0x00, 0x00, 0xc0, 0x9e, 0x23, 0x05, 0x00, 0x00, 0xd8, 0x73, 0xa4, 0x10, 0x00, 0x00,
+  0x7b, 0x8e, 0x14, 0x92, 0xdc, 0x61, 0xcf, 0x11, 0x96, 0x06, 0x00, 0xec, 0xb9, 0x02, 0x00, 0x00,
+  0x80, 0x3d, 0x57, 0x58, 0x21, 0x00, 0xb0, 0xe7, 0x8a, 0x3b, 0x00, 0x00, 0xf6, 0x5c, 0x71, 0x69,
+  0x50, 0xc0, 0x9e, 0x2b, 0x8e, 0x26, 0x77, 0xd8, 0x73, 0x45, 0x16, 0x02, 0x00, 0x7b, 0xee, 0x14,
+  0x02, 0x00, 0x60, 0xcf, 0x9d, 0x42, 0x92, 0x3b, 0xec, 0xb9, 0x34, 0x02, 0x03, 0x80, 0x3d, 0x97,
+  0x58, 0x72, 0xb4, 0xb0, 0xe7, 0x92, 0x1b, 0x00, 0x00, 0xf6, 0x5c, 0x9a, 0x85, 0x00, 0xc0, 0x9e,
+  0x4b, 0x33, 0x0d, 0x00, 0xd8, 0x73, 0xab, 0xb8, 0xc0, 0x00, 0x7b, 0x6e, 0xbe, 0xca, 0x00, 0x60,
+  0xef, 0x05, 0x9a, 0x1c, 0x05, 0xec, 0xbd, 0x55, 0xdc, 0x01, 0x80, 0xbd, 0xe7, 0x28, 0x00, 0x00,
+  0xb0, 0xf7, 0x1e, 0x4b, 0x81, 0x01, 0xf6, 0xde, 0x93, 0x85, 0x00, 0xc0, 0xde, 0x93, 0x81, 0x16,
+  0x02, 0xd8, 0x7b, 0xb4, 0xb8, 0x03, 0x00, 0x7b, 0x8f, 0x26, 0x77, 0x00, 0x60, 0xef, 0x55, 0x47,
+  0x00, 0x00, 0xec, 0xbd, 0xea, 0x68, 0x21, 0x80, 0xbd, 0x57, 0x1d, 0x4d, 0xee, 0xb0, 0x07, 0x69,
+  0x21, 0x00, 0x00, 0xf6, 0x64, 0x18, 0x81, 0x01, 0xc0, 0x9e, 0x0c, 0x23, 0xd0, 0x34, 0xd8, 0x93,
+  0x61, 0xa0, 0x32, 0x01, 0x7b, 0x32, 0x0c, 0x0a, 0x00, 0x60, 0x4f, 0x06, 0x56, 0x08, 0x00, 0xec,
+  0xc9, 0xc0, 0x92, 0x03, 0x80, 0x3d, 0x19, 0xd8, 0xab, 0x0c, 0xb0, 0x27, 0x43, 0x4b, 0xee, 0x00,
+  0xf6, 0x64, 0x70, 0x04, 0x00, 0xc0, 0x9e, 0x0c, 0xee, 0x55, 0x06, 0xd8, 0x93, 0xc1, 0xd1, 0x42,
+  0x00, 0x7b, 0x32, 0xc8, 0x42, 0x00, 0x60, 0x4f, 0x06, 0x99, 0x01, 0x00, 0xec, 0xc9, 0x40, 0x01,
+  0x00, 0x80, 0x3d, 0x19, 0x68, 0x06, 0x00, 0xb0, 0x27, 0x07, 0x00, 0x00, 0x00, 0xf6, 0xe4, 0x28,
+  0xee, 0x00, 0xc0, 0x9e, 0x1c, 0xc5, 0xbd, 0x3a, 0xd9, 0x93, 0xa3, 0xc8, 0xe4, 0x0e, 0x7b, 0x72,
+  0x54, 0x99, 0xdc, 0x61, 0x4f, 0x12, 0x00, 0x00, 0x00, 0xec, 0x49, 0x52, 0x00, 0x00, 0x80, 0x3d,
+  0x49, 0x0a, 0x01, 0x00, 0xb0, 0x27, 0x49, 0x71, 0x81, 0x01, 0xf6, 0x24, 0x29, 0xf2, 0xd5, 0xc9,
+  0x9e, 0x24, 0x69, 0x26, 0x77, 0xd8, 0x93, 0x84, 0x25, 0x07, 0x00, 0x7b, 0x92, 0xc8, 0x42, 0x00,
+  0x60, 0x4f, 0x16, 0x00, 0x00, 0x00, 0xec, 0xc9, 0x42, 0x00, 0x00, 0x80, 0x3d, 0x59, 0x08, 0x2b,
+  0x04, 0xb0, 0x27, 0x0b, 0x2b, 0x92, 0x00, 0xf6, 0x64, 0x61, 0x69, 0x00, 0xc0, 0x9e, 0x2c, 0x0e,
+  0x00, 0x00, 0xd8, 0x93, 0xc5, 0x11, 0x00, 0x00, 0x7b, 0xb2, 0xb8, 0x42, 0x00, 0x60, 0x4f, 0x16,
+  0x77, 0x00, 0x00, 0xec, 0xc9, 0xe2, 0x0e, 0x03, 0x80, 0x3d, 0x59, 0x5c, 0x1a, 0x00, 0xb0, 0x27,
+  0x8b, 0xa3, 0x00, 0x00, 0xf6, 0x64, 0x71, 0x34, 0x0d, 0xc0, 0x9e, 0x2c, 0x32, 0xd0, 0x42, 0xd8,
+  0x93, 0x45, 0x16, 0x00, 0x00, 0x7b, 0xb2, 0xc8, 0x42, 0x00, 0x60, 0x4f, 0x16, 0x69, 0x2a, 0x03,
+  0xec, 0xc9, 0x22, 0x4d, 0x9d, 0x80, 0x3d, 0x59, 0x64, 0x1a, 0x00, 0xb0, 0x27, 0x8b, 0x7c, 0xee,
+  0x00, 0xf6, 0x64, 0x99, 0x85, 0x14, 0xc2, 0x9e, 0x2c, 0x93, 0x02, 0x00, 0xd8, 0x93, 0x07, 0x99,
+  0xca, 0x00, 0x7b, 0x32, 0x8d, 0x14, 0xdc, 0x61, 0x4f, 0xa6, 0x91, 0xdc, 0x01, 0xec, 0xc9, 0x34,
+  0x28, 0x00, 0x80, 0x3d, 0x99, 0x06, 0x2d, 0x04, 0xb0, 0x27, 0x13, 0x01, 0x00, 0x00, 0xf6, 0x64,
+  0x22, 0xac, 0x10, 0xc0, 0x9e, 0x4c, 0xa7, 0x4e, 0x00, 0xd8, 0x93, 0x89, 0xa5, 0x57, 0x27, 0x7b,
+  0x32, 0x39, 0x02, 0x00, 0x60, 0x4f, 0x26, 0x77, 0x00, 0x00, 0xec, 0xc9, 0xe4, 0x4e, 0x21, 0x80,
+  0x3d, 0x99, 0x1c, 0x05, 0x00, 0xb0, 0x27, 0x93, 0xa3, 0x05, 0x00, 0xf6, 0x64, 0x72, 0xb4, 0x10,
+  0xc0, 0x9e, 0x4c, 0xcf, 0x16, 0x02, 0xd8, 0x93, 0x49, 0x12, 0x00, 0x00, 0x7b, 0x32, 0xc9, 0x0c,
+  0x00, 0x60, 0x4f, 0xa6, 0x99, 0x06, 0x00, 0xec, 0xc9, 0x34, 0x93, 0x3b, 0x80, 0x3d, 0x99, 0xe6,
+  0x2c, 0x04, 0xb0, 0x27, 0xd3, 0xa4, 0xc9, 0x1d, 0xf6, 0x64, 0xa2, 0x85, 0x00, 0xc0, 0x9e, 0x5c,
+  0x05, 0x00, 0x00, 0xd8, 0x93, 0xab, 0xb8, 0x03, 0x00, 0x7b, 0xb2, 0x05, 0x56, 0x08, 0x60, 0x4f,
+  0xb6, 0x40, 0x93, 0x3b, 0xec, 0xc9, 0x56, 0x00, 0x00, 0x80, 0x3d, 0xd9, 0x12, 0x01, 0x00, 0xb0,
+  0x27, 0x1d, 0x2d, 0x00, 0x00, 0xf6, 0xa4, 0xa3, 0x69, 0x00, 0xc0, 0x9e, 0x7c, 0xac, 0x10, 0x00,
+  0xd8, 0x93, 0xcf, 0x1d, 0x00, 0x00, 0x7b, 0xf2, 0xb9, 0xe4, 0x0e, 0x60, 0x4f, 0x3e, 0x19, 0x18,
+  0x00, 0xec, 0xc9, 0x27, 0x83, 0x2c, 0x84, 0x3d, 0xf9, 0x64, 0xa0, 0x00, 0xb0, 0x27, 0x9f, 0x0c,
+  0x34, 0x0d, 0xf6, 0xe4, 0x93, 0x85, 0x00, 0xc0, 0x9e, 0x7c, 0x32, 0x39, 0x0a, 0xd8, 0x93, 0xaf,
+  0xca, 0x42, 0x00, 0x7b, 0xf2, 0xd9, 0x42, 0x00, 0x60, 0x4f, 0xbe, 0x1b, 0x18, 0x00, 0xec, 0xc9,
+  0x77, 0x83, 0x2c, 0x84, 0x3d, 0x39, 0x69, 0x1a, 0x81, 0xb1, 0x27, 0x27, 0x4d, 0xee, 0x00, 0xf6,
+  0x24, 0x2d, 0x00, 0x00, 0xc0, 0x9e, 0xa4, 0x85, 0x00, 0x00, 0xd8, 0x93, 0xb4, 0xc8, 0x42, 0x00,
+  0x7b, 0x92, 0xa2, 0x42, 0x00, 0x60, 0x4f, 0x52, 0x54, 0x64, 0x01, 0xec, 0x49, 0x8a, 0x92, 0xa3,
+  0x85, 0x3d, 0x49, 0x11, 0x2b, 0x04, 0xb0, 0x27, 0x69, 0x1a, 0x14, 0x00, 0xf6, 0x24, 0x4d, 0x07,
+  0x00, 0xc0, 0x9e, 0xa4, 0xc9, 0x1d, 0x00, 0xd8, 0x93, 0x34, 0x39, 0x5a, 0x00, 0x7b, 0x92, 0xa6,
+  0x57, 0x19, 0x60, 0x4f, 0xd2, 0x34, 0xd3, 0x2a, 0xec, 0x49, 0x9a, 0x66, 0x72, 0x87, 0x3d, 0x49,
+  0xab, 0x2c, 0x04, 0xb0, 0x27, 0x6d, 0x01, 0x00, 0x00, 0xf6, 0xa4, 0x2d, 0xee, 0x00, 0xc0, 0xde,
+  0xa4, 0x69, 0x00, 0x00, 0xd8, 0xa3, 0xc1, 0x11, 0x06, 0x00, 0x7b, 0x35, 0x4d, 0x9a, 0x08, 0x60,
+  0xaf, 0x3a, 0x02, 0x00, 0x00, 0xec, 0x55, 0x47, 0x0a, 0x01, 0x80, 0xbd, 0xea, 0x68, 0x21, 0x00,
+  0xb0, 0x57, 0x1d, 0x2d, 0xee, 0x00, 0xf6, 0xaa, 0xa3, 0xac, 0x00, 0xc0, 0x5e, 0x95, 0x2e, 0x0d,
+  0x00, 0xd8, 0xab, 0xb3, 0x10, 0x00, 0x00, 0x7b, 0x75, 0xd2, 0x42, 0x00, 0x60, 0xaf, 0x4e, 0x9a,
+  0x06, 0x00, 0xec, 0xd5, 0x49, 0x93, 0x3b, 0x80, 0x3d, 0x5b, 0xdc, 0x29, 0x04, 0xb0, 0x67, 0x8b,
+  0x4c, 0x03, 0x00, 0xf6, 0x6c, 0x99, 0xc9, 0x1d, 0xc0, 0xde, 0x2d, 0x04, 0x00, 0x00, 0xd8, 0xbb,
+  0xc5, 0xa5, 0x57, 0x27, 0x7b, 0x39, 0xb0, 0x02, 0x00, 0x60, 0x35, 0xc8, 0xe2, 0x0e, 0x00, 0xac,
+  0x0a, 0x11, 0x68, 0x01, 0x80, 0x55, 0x91, 0x58, 0x1a, 0x00, 0xb0, 0x2a, 0x92, 0x2b, 0x04, 0x00,
+  0x56, 0x45, 0x72, 0x34, 0x05, 0xc6, 0xaa, 0x60, 0xc5, 0x01, 0x00, 0x58, 0x15, 0x32, 0xb0, 0x42,
+  0x00, 0xab, 0x42, 0x26, 0x77, 0x00, 0x60, 0x75, 0x04, 0x02, 0x00, 0x00, 0xac, 0x8e, 0xc0, 0x0a,
+  0x01, 0x80, 0xd5, 0x51, 0x00, 0x00, 0x00, 0xb0, 0x3a, 0x0a, 0x01, 0x00, 0x00, 0x56, 0x47, 0x61,
+  0x07, 0x00, 0xc0, 0xea, 0x28, 0xee, 0x00, 0x00, 0x58, 0x1d, 0xc5, 0xa5, 0x01, 0x00, 0xab, 0xa3,
+  0x48, 0x53, 0x27, 0x60, 0x75, 0xa0, 0xe2, 0x0e, 0x00, 0xac, 0x1e, 0x00, 0x00, 0x00, 0x80, 0xd5,
+  0x13, 0x5a, 0x1a, 0x00, 0xb0, 0x7a, 0x0a, 0x00, 0x00, 0x00, 0x56, 0x4f, 0x21, 0x00, 0x00, 0xc0,
+  0xea, 0x49, 0x0e, 0x00, 0x00, 0x58, 0x3d, 0xef, 0x06, 0x59, 0x08, 0xab, 0xa7, 0xba, 0xf4, 0xea,
+  0x64, 0x35, 0xb5, 0x34, 0x02, 0x03, 0xac, 0x26, 0x07, 0x00, 0x00, 0x80, 0xd5, 0xe4, 0x08, 0x00,
+  0x00, 0xb0, 0x9a, 0x1c, 0x2d, 0x04, 0x00, 0x56, 0x93, 0x0c, 0xb4, 0x10, 0xc0, 0x6a, 0x92, 0x69,
+  0xd2, 0x34, 0x58, 0x4d, 0x13, 0xa5, 0x01, 0x00, 0xab, 0x69, 0xce, 0x02, 0x00, 0x60, 0x35, 0x4d,
+  0x9a, 0xdc, 0x01, 0xac, 0xa6, 0x49, 0x19, 0x00, 0x80, 0x55, 0x16, 0x04, 0x03, 0x00, 0xb0, 0xca,
+  0x08, 0x00, 0x00, 0x00, 0x56, 0x99, 0xa9, 0x93, 0x02, 0xc0, 0x2a, 0x4b, 0x2c, 0xb9, 0x03, 0x58,
+  0x65, 0xc9, 0xa5, 0x01, 0x00, 0xab, 0x2c, 0x4d, 0x5a, 0x00, 0x60, 0x95, 0xb1, 0x42, 0x00, 0x00,
+  0xac, 0x32, 0xf6, 0x68, 0x72, 0x94, 0xd5, 0x16, 0x58, 0x1a, 0x00, 0xb0, 0xda, 0x82, 0x3b, 0x00,
+  0x00, 0x56, 0x9b, 0x08, 0x2e, 0x30, 0xc0, 0x6a, 0x2b, 0xee, 0x00, 0x00, 0x58, 0x6d, 0x45, 0x06,
+  0x56, 0x08, 0xab, 0xad, 0x48, 0x02, 0x00, 0x60, 0xb5, 0xa5, 0x59, 0x08, 0x00, 0xac, 0x36, 0xf8,
+  0x2a, 0x03, 0x80, 0x55, 0x17, 0x1c, 0x01, 0x00, 0xb0, 0xea, 0x08, 0x00, 0x00, 0x00, 0x56, 0x1d,
+  0x49, 0x03, 0x00, 0xc0, 0xaa, 0x23, 0x69, 0xa6, 0xc0, 0x58, 0x75, 0x45, 0x16, 0x59, 0x08, 0xab,
+  0x2e, 0x8d, 0x14, 0xdc, 0x61, 0xd5, 0x3d, 0x99, 0xdc, 0x01, 0xac, 0x42, 0x99, 0x06, 0x00, 0x80,
+  0x55, 0x19, 0x04, 0x2b, 0x04, 0xb0, 0x2a, 0xc3, 0x2a, 0x00, 0x00, 0x56, 0x65, 0x60, 0x85, 0x00,
+  0xc0, 0xaa, 0x0c, 0xae, 0x10, 0x00, 0x58, 0x95, 0xc1, 0x1d, 0x00, 0x00, 0xab, 0x32, 0x38, 0x0a,
+  0x00, 0x60, 0x55, 0x06, 0x59, 0x08, 0x00, 0xac, 0xca, 0x20, 0x93, 0xa9, 0x93, 0x55, 0x19, 0x64,
+  0x7a, 0x75, 0xb2, 0x2a, 0x03, 0x2d, 0xb2, 0x00, 0x56, 0x65, 0xa0, 0xc9, 0x1d, 0xc0, 0xaa, 0x14,
+  0x81, 0x26, 0x77, 0x58, 0x95, 0xa3, 0x10, 0x00, 0x00, 0xab, 0x72, 0x14, 0x77, 0x00, 0x60, 0x55,
+  0x8e, 0xc4, 0x00, 0x00, 0xac, 0xca, 0xb1, 0x00, 0x00, 0x80, 0x55, 0x39, 0xaa, 0x4c, 0xee, 0xb0,
+  0x2a, 0x09, 0x00, 0x00, 0x00, 0x56, 0x25, 0x29, 0x00, 0x00, 0xc0, 0xaa, 0x24, 0xc5, 0x01, 0x00,
+  0x58, 0x95, 0xa4, 0xb8, 0x03, 0x00, 0xab, 0x92, 0x24, 0x53, 0x27, 0x60, 0x55, 0x92, 0xe4, 0x0e,
+  0x00, 0xac, 0x4a, 0x32, 0x33, 0x00, 0x80, 0x55, 0x49, 0x32, 0x00, 0x00, 0xb0, 0x2a, 0x0b, 0x00,
+  0x00, 0x00, 0x56, 0x65, 0x21, 0x00, 0x00, 0xc0, 0xaa, 0x2c, 0xa4, 0x10, 0x00, 0x58, 0x95, 0x85,
+  0xb0, 0xe4, 0x0e, 0xab, 0xb2, 0xb0, 0xe4, 0x0e, 0x60, 0x55, 0x16, 0x96, 0x5e, 0x9d, 0xac, 0xca,
+  0xe2, 0x00, 0x00, 0x80, 0x55, 0x59, 0xdc, 0x01, 0x00, 0xb0, 0x2a, 0x8b, 0x3b, 0x85, 0x00, 0x56,
+  0x65, 0x71, 0xc9, 0x1d, 0xc0, 0xaa, 0x2c, 0xb2, 0x00, 0x00, 0x58, 0x95, 0x45, 0x16, 0x02, 0x00,
+  0xab, 0xb2, 0x48, 0x53, 0x27, 0x60, 0x55, 0x16, 0x99, 0x06, 0x00, 0xac, 0xca, 0x22, 0x93, 0xa3,
+  0x80, 0x55, 0x59, 0xe4, 0xab, 0x0c, 0xb0, 0x2a, 0xcb, 0x2c, 0x04, 0x00, 0x56, 0xe5, 0x01, 0x00,
+  0x00, 0xc0, 0xaa, 0x3c, 0x55, 0x26, 0x77, 0x58, 0x95, 0x69, 0x04, 0x06, 0x00, 0xab, 0x32, 0x8d,
+  0x14, 0x18, 0x60, 0x55, 0xa6, 0x91, 0x1c, 0x2d, 0xac, 0xca, 0x44, 0x00, 0x00, 0x80, 0x55, 0x99,
+  0x4e, 0x21, 0x00, 0xb0, 0x2a, 0x13, 0x2b, 0x04, 0x00, 0x56, 0x65, 0x72, 0x00, 0x00, 0xc0, 0xaa,
+  0x4c, 0x2e, 0x39, 0x5a, 0x58, 0x95, 0xc9, 0x51, 0x00, 0x00, 0xab, 0x32, 0x39, 0x9a, 0x01, 0x60,
+  0x55, 0xa6, 0xd7, 0x0a, 0x01, 0xac, 0xca, 0x34, 0x03, 0x2d, 0x84, 0x55, 0x99, 0x66, 0x06, 0x00,
+  0xb0, 0x2a, 0x13, 0x4d, 0xaf, 0x4e, 0x56, 0xe5, 0x2a, 0x00, 0x00, 0xc0, 0xaa, 0x5c, 0xc5, 0x1d,
+  0x00, 0x58, 0x95, 0xab, 0x38, 0x9a, 0x06, 0xab, 0xb2, 0x05, 0x77, 0x00, 0x60, 0x55, 0x3a, 0x02,
+  0x00, 0x00, 0xac, 0x4a, 0x97, 0xdc, 0x01, 0x80, 0x55, 0xf9, 0x58, 0x99, 0x00, 0xb0, 0x2a, 0x5f,
+  0x2b, 0x04, 0x00, 0x56, 0xe5, 0x6b, 0xaf, 0x32, 0xc0, 0xaa, 0x7c, 0x6e, 0x04, 0x06, 0x58, 0x95,
+  0xcf, 0x11, 0x00, 0x00, 0xab, 0xf2, 0xc9, 0x42, 0x00, 0x60, 0x55, 0xbe, 0x89, 0x0a, 0x01, 0xac,
+  0xca, 0x77, 0xdd, 0x01, 0x80, 0x55, 0x49, 0x01, 0x00, 0x00, 0xb0, 0x2a, 0x69, 0x71, 0x00, 0x00,
+  0x56, 0x25, 0x2d, 0xee, 0x00, 0xc0, 0xaa, 0xa4, 0x45, 0x06, 0x06, 0x58, 0x95, 0xb4, 0x4c, 0x0a,
+  0x00, 0xab, 0x92, 0xa2, 0x42, 0x00, 0x60, 0x55, 0x52, 0xc4, 0x0a, 0x01, 0xac, 0x4a, 0x9a, 0x08,
+  0x00, 0x80, 0x55, 0x49, 0x93, 0x3b, 0x00, 0xb0, 0x2a, 0x69, 0xa2, 0x00, 0x00, 0x56, 0x25, 0x4d,
+  0x34, 0xb9, 0xc3, 0xaa, 0xa4, 0xef, 0x16, 0x02, 0x58, 0x95, 0x34, 0x03, 0x00, 0x00, 0xab, 0x13,
+  0x15, 0x77, 0x00, 0x60, 0x75, 0x22, 0x53, 0x19, 0x00, 0xac, 0x4e, 0x94, 0x1c, 0x00, 0x80, 0xd5,
+  0x89, 0x9e, 0x2c, 0x04, 0xb0, 0x3a, 0x61, 0x21, 0x00, 0x00, 0x56, 0x27, 0x2c, 0x24, 0x39, 0xca,
+  0xea, 0x84, 0xc9, 0x01, 0x00, 0x58, 0x9d, 0xf0, 0xb9, 0x03, 0x00, 0xab, 0x13, 0xd2, 0x42, 0x00,
+  0x60, 0x75, 0x42, 0xca, 0x0a, 0x00, 0xac, 0x4e, 0x48, 0x59, 0x21, 0x80, 0xd5, 0x39, 0x51, 0x21,
+  0x00, 0xb0, 0x3a, 0x29, 0x00, 0x00, 0x00, 0x56, 0x27, 0x0d, 0x0c, 0x00, 0xc0, 0xea, 0xa4, 0x81,
+  0x95, 0x09, 0x58, 0x9d, 0x34, 0xb0, 0x34, 0x00, 0xab, 0x93, 0x16, 0x00, 0x00, 0x60, 0x75, 0xd2,
+  0x42, 0x00, 0x00, 0xac, 0x4e, 0x5a, 0x1c, 0x00, 0x80, 0xd5, 0x49, 0x8b, 0x3b, 0x00, 0xb0, 0x3a,
+  0x69, 0x71, 0xb4, 0x10, 0x56, 0x27, 0x2d, 0x8e, 0xa6, 0xc1, 0xea, 0xa4, 0x45, 0x16, 0x02, 0x58,
+  0x9d, 0x14, 0x15, 0x02, 0x00, 0xab, 0x93, 0xa2, 0xe2, 0x28, 0x60, 0x75, 0x52, 0x94, 0x04, 0x03,
+  0xac, 0x4e, 0x9a, 0x06, 0x00, 0x80, 0xd5, 0x49, 0x13, 0x01, 0x00, 0xb0, 0x3a, 0x69, 0x72, 0x07,
+  0x00, 0x56, 0x27, 0x4d, 0x13, 0x15, 0xc2, 0xea, 0xa4, 0x34, 0xb9, 0x03, 0x58, 0x9d, 0xb4, 0xca,
+  0x42, 0x00, 0xab, 0x93, 0xd6, 0x49, 0x01, 0x60, 0x95, 0x06, 0x56, 0x00, 0x00, 0xac, 0xd2, 0xc0,
+  0x92, 0x3b, 0x80, 0x55, 0x1a, 0x58, 0x06, 0x00, 0xb0, 0x4a, 0x83, 0x23, 0x00, 0x00, 0x56, 0x69,
+  0x70, 0x69, 0x00, 0xc0, 0x2a, 0x0d, 0xb2, 0x10, 0x00, 0x58, 0xa5, 0x81, 0xa6, 0x01, 0x00, 0xab,
+  0xb4, 0xb8, 0x01, 0x00, 0x60, 0x95, 0x9a, 0x9a, 0xdc, 0x01, 0xac, 0x52, 0x04, 0x00, 0x00, 0x80,
+  0x55, 0x8a, 0x02, 0x2b, 0x04, 0xb0, 0x4a, 0x51, 0xa0, 0x00, 0x00, 0x56, 0x29, 0x0a, 0x34, 0xb9,
+  0xc3, 0x2a, 0x45, 0x85, 0x00, 0x00, 0x58, 0xa5, 0xa8, 0xb8, 0x03, 0x00, 0xab, 0x14, 0x25, 0x77,
+  0x00, 0x60, 0x95, 0xa2, 0xe4, 0x92, 0xa3, 0xac, 0x52, 0x44, 0x59, 0x21, 0x80, 0x55, 0x9a, 0x46,
+  0x72, 0x07, 0xb0, 0x4a, 0x13, 0x01, 0x00, 0x00, 0x56, 0x69, 0x62, 0x00, 0x00, 0xc0, 0x2a, 0x4d,
+  0xac, 0x00, 0x00, 0x58, 0xa5, 0xc9, 0x15, 0x02, 0x00, 0xab, 0x34, 0x39, 0x0a, 0x00, 0x60, 0x95,
+  0x26, 0x47, 0x0b, 0x00, 0xac, 0xd2, 0x34, 0x0b, 0x01, 0x80, 0x55, 0x9a, 0x66, 0x91, 0x85, 0xb0,
+  0x4a, 0xd3, 0x4c, 0xee, 0x00, 0x56, 0x69, 0x9a, 0x14, 0x00, 0xc0, 0x2a, 0xad, 0xb2, 0x10, 0x00,
+  0x58, 0xa5, 0x75, 0x16, 0x02, 0x00, 0xab, 0xb4, 0xd2, 0x42, 0x00, 0x60, 0x15, 0xa7, 0x11, 0xdc,
+  0x01, 0xac, 0xe2, 0x0a, 0x51, 0x1a, 0x80, 0x55, 0x9c, 0x01, 0x00, 0x00, 0xb0, 0x3c, 0x8a, 0x4b,
+  0x03, 0x00, 0x96, 0x47, 0x71, 0xc9, 0x01, 0xc0, 0xf2, 0x28, 0x2e, 0xb9, 0x03, 0x58, 0x1e, 0xcf,
+  0x25, 0x77, 0x00, 0xcb, 0xb2, 0x00, 0x00, 0x00, 0x60, 0x79, 0xd2, 0xe2, 0x28, 0x00, 0x2d, 0x30,
+  0x02, 0x00, 0x00, 0xa0, 0x85, 0x16, 0x1c, 0x01, 0x00, 0xb4, 0xe0, 0x8a, 0xa3, 0x65, 0x82, 0x16,
+  0x60, 0x01, 0x00, 0x00, 0xd0, 0x02, 0x2c, 0x2c, 0xb9, 0x03, 0x5a, 0x90, 0x81, 0x15, 0x02, 0x40,
+  0x0b, 0x32, 0xc8, 0x42, 0x00, 0x68, 0x41, 0x16, 0x47, 0x00, 0x00, 0x2d, 0x48, 0x5a, 0xdc, 0x01,
+  0xa0, 0x05, 0x8a, 0x92, 0x3b, 0x00, 0xb4, 0x40, 0xeb, 0x1c, 0x00, 0x80, 0x16, 0xaa, 0xa3, 0x19,
+  0x00, 0xd0, 0x42, 0x9d, 0x14, 0x00, 0x00, 0x5a, 0xb8, 0x8e, 0x00, 0x00, 0x40, 0x2b, 0x61, 0x24,
+  0x06, 0x00, 0x68, 0x25, 0xcc, 0xe0, 0x28, 0x00, 0xad, 0x84, 0x39, 0x93, 0xa3, 0xa5, 0x95, 0x51,
+  0x00, 0x00, 0x00, 0xb4, 0x32, 0x9e, 0x24, 0x00, 0x80, 0x56, 0x4c, 0x71, 0x07, 0x00, 0xd0, 0x0a,
+  0x0b, 0x74, 0x00, 0x00, 0x5a, 0x91, 0x07, 0x25, 0x77, 0x40, 0x2b, 0x32, 0x51, 0x56, 0x08, 0x68,
+  0x65, 0xd2, 0xe2, 0xd2, 0x00, 0xad, 0xd8, 0xe2, 0x08, 0x00, 0xa0, 0xbd, 0x51, 0xa4, 0xa9, 0x0c,
+  0xb4, 0x47, 0x00, 0x00, 0x00, 0x80, 0xf6, 0x48, 0x1a, 0xc1, 0x1d, 0xd0, 0x1e, 0x49, 0x33, 0x03,
+  0x00, 0xda, 0x33, 0xc5, 0x0d, 0x00, 0x40, 0x7b, 0xa6, 0x4a, 0x47, 0xd3, 0x68, 0xef, 0x3c, 0x96,
+  0x1c, 0x00, 0xed, 0xb1, 0xe0, 0x68, 0x72, 0xa5, 0x3d, 0x16, 0x64, 0x72, 0x07, 0xb4, 0xc7, 0x08,
+  0x00, 0x00, 0x80, 0xf6, 0x18, 0x29, 0x04, 0x00, 0xd0, 0x1e, 0x23, 0xc9, 0x1d, 0x00, 0xda, 0x63,
+  0x44, 0x16, 0x02, 0x40, 0x7b, 0x2c, 0x05, 0x02, 0x00, 0x68, 0x8f, 0x25, 0x77, 0x00, 0x00, 0xed,
+  0xb1, 0xe4, 0xd2, 0xab, 0xb3, 0x3d, 0x96, 0x68, 0x72, 0x07, 0xb4, 0xc7, 0x18, 0x01, 0x00, 0x80,
+  0xf6, 0x58, 0x95, 0x04, 0x00, 0xd0, 0x1e, 0xcb, 0x00, 0x00, 0x00, 0xda, 0x6b, 0x81, 0x26, 0x77,
+  0x40, 0x7b, 0x2d, 0x0d, 0x00, 0x00, 0x68, 0xaf, 0x25, 0x96, 0x1c, 0x05, 0xed, 0xb5, 0xe4, 0x92,
+  0x3b, 0xa0, 0xbd, 0xf6, 0x5a, 0x7a, 0x75, 0xb6, 0xd7, 0x60, 0x1a, 0x00, 0x80, 0xf6, 0x5c, 0x18,
+  0xa8, 0x10, 0xd0, 0x9e, 0x23, 0xc9, 0x1d, 0x00, 0xda, 0x73, 0x05, 0x00, 0x00, 0x40, 0x7b, 0xae,
+  0x10, 0x00, 0x00, 0x68, 0xcf, 0x15, 0x47, 0x00, 0x00, 0xed, 0xb9, 0xe2, 0x0e, 0x00, 0xa0, 0x3d,
+  0x57, 0xa4, 0xa3, 0x69, 0xb4, 0xe7, 0x4e, 0x01, 0x00, 0x80, 0xf6, 0xdc, 0x29, 0x2e, 0x30, 0xd0,
+  0x9e, 0x7b, 0x2d, 0x0d, 0x00, 0xda, 0x73, 0x2f, 0xd6, 0x57, 0x67, 0x7b, 0x6e, 0xd2, 0x12, 0x18,
+  0x68, 0xef, 0xb1, 0x44, 0x00, 0x00, 0xed, 0x3d, 0x19, 0x08, 0x00, 0xa0, 0xbd, 0x27, 0x8b, 0x3b,
+  0x00, 0xb4, 0xf7, 0x64, 0x72, 0x07, 0x80, 0xf6, 0x9e, 0x4c, 0xb6, 0x10, 0xd0, 0xde, 0xa3, 0xc5,
+  0x1d, 0x00, 0xda, 0x7b, 0xb4, 0x38, 0x0a, 0x40, 0x7b, 0xaf, 0x4a, 0x02, 0x00, 0x68, 0xef, 0xd9,
+  0x42, 0x00, 0x00, 0xed, 0xc1, 0x42, 0x00, 0x00, 0xa0, 0x3d, 0x98, 0x1c, 0x2b, 0x04, 0xb4, 0x07,
+  0x65, 0x21, 0x00, 0x80, 0xf6, 0x64, 0x60, 0xc9, 0xd1, 0xd2, 0x9e, 0x0c, 0x8e, 0x00, 0x00, 0xda,
+  0x93, 0xc1, 0x1d, 0x00, 0x40, 0x7b, 0x32, 0xb8, 0xe4, 0x0e, 0x68, 0x4f, 0x06, 0x59, 0x08, 0x00,
+  0xed, 0xc9, 0x20, 0x8b, 0x2c, 0xa4, 0x3d, 0x19, 0x64, 0x1a, 0x00, 0xb4, 0x27, 0x03, 0x2d, 0x04,
+  0x80, 0xf6, 0xa4, 0x08, 0x8e, 0x02, 0xd0, 0x9e, 0x14, 0xac, 0x10, 0x00, 0xda, 0x93, 0x82, 0x25,
+  0x77, 0x40, 0x7b, 0x52, 0xc8, 0x42, 0x00, 0x68, 0x4f, 0x8a, 0x2a, 0x03, 0x03, 0xed, 0xc9, 0x51,
+  0xdc, 0x01, 0xa0, 0x3d, 0x39, 0x12, 0x01, 0x00, 0xb4, 0x27, 0x47, 0x72, 0x07, 0x80, 0xf6, 0xe4,
+  0x48, 0x93, 0xa6, 0xd1, 0x9e, 0x24, 0x00, 0x00, 0x00, 0xda, 0x93, 0x24, 0xb0, 0x42, 0x40, 0x7b,
+  0x92, 0x14, 0x00, 0x00, 0x68, 0x4f, 0x92, 0xe4, 0x00, 0x00, 0xed, 0xc9, 0x02, 0x00, 0x00, 0xa0,
+  0x3d, 0x59, 0x08, 0x00, 0x00, 0xb4, 0x27, 0x0b, 0x61, 0x00, 0x80, 0xf6, 0x64, 0x31, 0x95, 0x01,
+  0xd0, 0x9e, 0x2c, 0x2c, 0x05, 0x07, 0xda, 0x93, 0xc5, 0x1d, 0x00, 0x40, 0x7b, 0xb2, 0xb8, 0xe4,
+  0x0e, 0x68, 0x4f, 0x16, 0x97, 0x5e, 0x9d, 0xed, 0xc9, 0xe2, 0xd2, 0xbb, 0xae, 0x3d, 0x59, 0x1c,
+  0x05, 0x00, 0xb4, 0x27, 0x8b, 0xa3, 0xc9, 0x96, 0xf6, 0x64, 0x91, 0x81, 0x16, 0xd2, 0x9e, 0x2c,
+  0xb2, 0x10, 0x00, 0xda, 0x93, 0x65, 0xa6, 0x01, 0x40, 0x7b, 0xb2, 0x4c, 0x9a, 0x1c, 0x6d, 0x4f,
+  0x9e, 0x22, 0x93, 0x3b, 0xed, 0xc9, 0x83, 0x0a, 0x00, 0xa0, 0x3d, 0x99, 0x06, 0x2a, 0x73, 0xb6,
+  0x27, 0xd3, 0x48, 0x81, 0x81, 0xf6, 0x64, 0x1a, 0xc9, 0x51, 0xd0, 0x9e, 0x4c, 0x6e, 0x14, 0x02,
+  0xda, 0x93, 0xc9, 0x11, 0x00, 0x40, 0x7b, 0x32, 0xb9, 0x03, 0x00, 0x68, 0x4f, 0x26, 0x97, 0x1c,
+  0x05, 0xed, 0xc9, 0xe4, 0x68, 0x21, 0xa0, 0x3d, 0x99, 0x9e, 0x03, 0x00, 0xb4, 0x27, 0x93, 0x34,
+  0x75, 0x82, 0xf6, 0x64, 0x9a, 0xc9, 0x1d, 0xd0, 0x9e, 0x4c, 0x34, 0x0d, 0x00, 0xda, 0x93, 0x89,
+  0x26, 0x47, 0x41, 0x7b, 0x72, 0x15, 0x02, 0x00, 0x68, 0x4f, 0xae, 0xe2, 0x0e, 0x00, 0xed, 0xc9,
+  0x55, 0x64, 0x2a, 0xa4, 0x3d, 0xc9, 0x58, 0x72, 0x07, 0xb4, 0x27, 0x5b, 0x70, 0x00, 0x80, 0xf6,
+  0x64, 0x2b, 0x32, 0xb8, 0xd3, 0x9e, 0x74, 0xb4, 0x10, 0x00, 0xda, 0x93, 0x8f, 0x00, 0x00, 0x40,
+  0x7b, 0xf2, 0xb9, 0x03, 0x00, 0x68, 0x4f, 0x3e, 0x97, 0xdc, 0x01, 0xed, 0xc9, 0xe7, 0x68, 0x72,
+  0xa7, 0x3d, 0xf9, 0x64, 0x21, 0x00, 0xb4, 0x27, 0x1f, 0x4d, 0x03, 0x80, 0xf6, 0xe4, 0xb3, 0xc9,
+  0x1d, 0xd0, 0x9e, 0xa4, 0x00, 0x00, 0x00, 0xda, 0x93, 0x34, 0x38, 0x00, 0x40, 0x7b, 0x92, 0x16,
+  0x00, 0x00, 0x68, 0x4f, 0xd2, 0x42, 0x00, 0x00, 0xed, 0x49, 0x5a, 0xdc, 0x01, 0xa0, 0x3d, 0x49,
+  0x8b, 0x2c, 0x04, 0xb4, 0x27, 0x69, 0x91, 0xaf, 0xce, 0xf6, 0x24, 0x45, 0x85, 0x00, 0xd0, 0x9e,
+  0xa4, 0x69, 0x04, 0x06, 0xda, 0x93, 0x34, 0x99, 0x3a, 0x67, 0x7b, 0x92, 0x26, 0x77, 0x00, 0x68,
+  0x4f, 0xd2, 0xf4, 0xea, 0x9c, 0xed, 0x49, 0x4a, 0x33, 0x00, 0xa0, 0x3d, 0x69, 0x8b, 0x03, 0x00,
+  0xb4, 0x27, 0x33, 0x00, 0x00, 0x80, 0xf6, 0x26, 0x2d, 0xa6, 0xce, 0xd9, 0x5e, 0x0d, 0x2c, 0x03,
+  0x00, 0xda, 0xab, 0x69, 0x24, 0x47, 0x41, 0x7b, 0xd5, 0x91, 0x42, 0x00, 0x68, 0xaf, 0x3a, 0x5a,
+  0x08, 0x00, 0xed, 0x55, 0x09, 0x93, 0x3b, 0xa0, 0xbd, 0x3a, 0x69, 0x72, 0x07, 0xb4, 0x57, 0x69,
+  0x22, 0x00, 0x80, 0xf6, 0x6c, 0x01, 0x00, 0x00, 0xd0, 0x9e, 0x2d, 0x8e, 0x00, 0x00, 0xda, 0xb3,
+  0x45, 0x12, 0x00, 0x40, 0x7b, 0x36, 0x39, 0x4a, 0xd3, 0x68, 0x0f, 0x57, 0x19, 0x64, 0x21, 0xed,
+  0xe1, 0x2a, 0x0b, 0x01, 0xa0, 0xbd, 0x1c, 0x04, 0x4b, 0xee, 0xb4, 0x3c, 0x0a, 0x00, 0x00, 0x80,
+  0x96, 0x47, 0x71, 0x07, 0x00, 0xd0, 0xf2, 0x78, 0xb4, 0x00, 0x00, 0x5a, 0x96, 0xc1, 0x11, 0x00,
+  0x40, 0xcb, 0x32, 0xb8, 0x03, 0x00, 0x68, 0x59, 0x12, 0x00, 0x00, 0x00, 0x2d, 0xcb, 0x42, 0x58,
+  0x72, 0xa7, 0x65, 0x59, 0x58, 0x01, 0x00, 0xb4, 0x2c, 0x8b, 0x23, 0x00, 0x80, 0x96, 0x65, 0x9a,
+  0x85, 0x00, 0xd0, 0xb2, 0x4c, 0x33, 0x8d, 0xc0, 0x5a, 0x96, 0x8f, 0x15, 0x02, 0x40, 0xcb, 0x93,
+  0xa6, 0x57, 0x27, 0x68, 0x99, 0x06, 0x56, 0x08, 0x00, 0x2d, 0x53, 0x54, 0x1c, 0x00, 0xa0, 0x65,
+  0x8a, 0x8a, 0x0b, 0x0c, 0xb4, 0x4c, 0x51, 0x91, 0x85, 0x80, 0x96, 0x29, 0x4a, 0x2e, 0x30, 0xd0,
+  0x32, 0x4d, 0x83, 0x26, 0x47, 0x5b, 0xa6, 0xe9, 0x14, 0x02, 0x40, 0xcb, 0x34, 0xb9, 0x11, 0x18,
+  0x70, 0x8f, 0x55, 0x59, 0x08, 0x00, 0xee, 0xc9, 0x50, 0x1c, 0x2d, 0xc4, 0x3d, 0x99, 0x46, 0x72,
+  0x07, 0xb8, 0x2a, 0xc3, 0x08, 0x14, 0x00, 0x57, 0xe7, 0x9c, 0x19, 0x00, 0xe0, 0xea, 0xa4, 0x85,
+  0x00, 0x00, 0x5c, 0xa5, 0x28, 0x8d, 0xc0, 0xc0, 0x83, 0x85, 0x3d, 0x59, 0x08, 0x78, 0xf0, 0x11,
+  0x00, 0x00, 0x00, 0x0f, 0xc2, 0x20, 0x0b, 0x01, 0xe0, 0x41, 0x98, 0x5c, 0x1a, 0x00, 0xc0, 0xc0,
+  0x82, 0x2c, 0x04, 0x00, 0x18, 0x58, 0x1a, 0xc9, 0x1d, 0x00, 0x03, 0x4b, 0x04, 0x00, 0x00, 0x60,
+  0x60, 0xc9, 0x15, 0x02, 0x00, 0x0c, 0x8c, 0x11, 0x00, 0x00, 0x80, 0x81, 0x35, 0x98, 0x06, 0x00,
+  0x30, 0xb0, 0xc7, 0xd2, 0xab, 0x13, 0x06, 0x17, 0x5c, 0x70, 0x07, 0xc0, 0x00, 0x83, 0x4b, 0x03,
+  0x00, 0x18, 0x60, 0x01, 0x00, 0x00, 0x00, 0x83, 0x0c, 0x03, 0xa5, 0xc0, 0x60, 0x90, 0x81, 0xbd,
+  0xca, 0x00, 0x0c, 0x32, 0x38, 0x02, 0x00, 0x80, 0x41, 0x06, 0x77, 0x00, 0x00, 0x30, 0xc8, 0x91,
+  0x01, 0x00, 0x00, 0x06, 0x59, 0x64, 0xa0, 0x85, 0xc0, 0x20, 0xcb, 0x2c, 0x04, 0x00, 0x18, 0xe4,
+  0x29, 0x0e, 0x00, 0x00, 0x83, 0x4c, 0x8f, 0x02, 0x00, 0x60, 0x90, 0x8f, 0x00, 0x00, 0x00, 0x0c,
+  0xf2, 0xc9, 0x02, 0x00, 0x80, 0x41, 0x3e, 0xf9, 0x2a, 0x03, 0x30, 0x48, 0x59, 0x26, 0x2a, 0x00,
+  0x06, 0x69, 0x0b, 0x01, 0x00, 0xc0, 0x30, 0xe7, 0x93, 0x89, 0x00, 0x18, 0x28, 0x2a, 0xee, 0x00,
+  0x00, 0x03, 0x45, 0xc9, 0x51, 0x00, 0x60, 0xa8, 0x8e, 0x00, 0x00, 0x00, 0x0c, 0xd5, 0xd1, 0xe4,
+  0x0e, 0x80, 0xc1, 0x16, 0x02, 0x00, 0x00, 0x30, 0xd8, 0xe2, 0x08, 0x00, 0x00, 0x06, 0x5b, 0x1c,
+  0x05, 0x00, 0xc0, 0x12, 0x5c, 0x32, 0x95, 0x01, 0x58, 0x82, 0xa3, 0x85, 0x00, 0x00, 0x4b, 0x70,
+  0x34, 0xb9, 0x03, 0x60, 0x09, 0xf3, 0xb9, 0xc0, 0x00, 0x2c, 0x61, 0xce, 0xe4, 0x0e, 0x80, 0x25,
+  0x4c, 0x0a, 0x00, 0x00, 0xb0, 0x84, 0x49, 0x0b, 0x01, 0x00, 0x96, 0x30, 0x29, 0x2b, 0x04, 0xc0,
+  0x12, 0x68, 0x71, 0x07, 0x00, 0x58, 0x02, 0x45, 0xac, 0x10, 0x00, 0x4b, 0xa0, 0xc9, 0x1d, 0x00,
+  0x60, 0x09, 0xf4, 0xd5, 0x57, 0x27, 0x2c, 0xa3, 0x10, 0x00, 0x00, 0x80, 0x65, 0x14, 0x77, 0x00,
+  0x00, 0xb0, 0x8c, 0xe2, 0x68, 0x72, 0x07, 0x96, 0x91, 0xdc, 0x01, 0x00, 0xc0, 0x32, 0x1e, 0x4b,
+  0x03, 0x00, 0x58, 0xc6, 0x93, 0x85, 0x00, 0x00, 0x8b, 0x29, 0x00, 0x00, 0x00, 0x60, 0x31, 0x85,
+  0x00, 0x00, 0x00, 0x2c, 0xa6, 0xcc, 0x0c, 0x00, 0x80, 0xc5, 0xb0, 0xe2, 0x0e, 0x00, 0xb0, 0x9c,
+  0x27, 0x03, 0x03, 0x00, 0x96, 0xe4, 0x56, 0x21, 0x00, 0xc0, 0xc2, 0x82, 0xa3, 0x00, 0x00, 0x58,
+  0x98, 0x31, 0x55, 0x66, 0x00, 0x0b, 0x4b, 0x33, 0x0d, 0x00, 0x60, 0x61, 0x69, 0xd2, 0xe4, 0x28,
+  0x2c, 0x2d, 0xb9, 0x03, 0x00, 0x80, 0xc5, 0x05, 0x56, 0x08, 0x00, 0xb0, 0x38, 0x02, 0x00, 0x00,
+  0x00, 0x16, 0x47, 0x58, 0x0a, 0x0c, 0xc0, 0x02, 0x0b, 0x00, 0x00, 0x00, 0x58, 0xa0, 0x0c, 0xac,
+  0x10, 0x00, 0x8b, 0x24, 0x69, 0x00, 0x00, 0x60, 0x91, 0xc9, 0x05, 0x77, 0x00, 0x2c, 0x72, 0x15,
+  0x56, 0x08, 0x80, 0x45, 0x3e, 0x02, 0x00, 0x00, 0xb0, 0xcc, 0xe2, 0x0e, 0x00, 0x00, 0x96, 0x89,
+  0x0a, 0x00, 0x00, 0xc0, 0x32, 0x61, 0x71, 0x05, 0x00, 0x58, 0xe6, 0xa4, 0xc9, 0xd1, 0x02, 0xcb,
+  0xa4, 0x81, 0xca, 0x0c, 0x60, 0x99, 0xb4, 0x10, 0x00, 0x00, 0x2c, 0x93, 0x16, 0x07, 0x00, 0x80,
+  0x65, 0xd2, 0xe2, 0x0e, 0x00, 0xb0, 0x4c, 0x8a, 0x92, 0x3b, 0x00, 0x96, 0x49, 0x11, 0x4d, 0xee,
+  0xc0, 0x32, 0x69, 0x1a, 0x00, 0x00, 0x58, 0x66, 0x9d, 0xb4, 0x10, 0x00, 0x59, 0x90, 0x4f, 0xbe,
+  0x3a, 0x21, 0x2b, 0xb2, 0x38, 0x00, 0x00, 0x64, 0x8f, 0x52, 0x00, 0x00, 0x80, 0xec, 0x55, 0x59,
+  0x08, 0x00, 0xf0, 0x05, 0x5a, 0x00, 0x00, 0x00, 0x3e, 0x53, 0x27, 0x2b, 0x04, 0xc0, 0xc7, 0xd2,
+  0xa0, 0xc9, 0x51, 0xf8, 0x58, 0x72, 0x04, 0x00, 0x00, 0x1f, 0x4b, 0x8e, 0x96, 0x09, 0xe0, 0x7b,
+  0x8c, 0x24, 0x77, 0x00, 0x7c, 0x8f, 0x15, 0x59, 0x00, 0x80, 0xef, 0xd1, 0x34, 0x29, 0x00, 0xf0,
+  0xbd, 0x3a, 0x93, 0x3b, 0x00, 0x3e, 0x18, 0x1c, 0x4d, 0x03, 0xc0, 0x27, 0x83, 0xa3, 0x85, 0x00,
+  0xf8, 0xe4, 0x28, 0xee, 0x00, 0x00, 0x9f, 0x2c, 0x04, 0x00, 0x00, 0xe0, 0x93, 0xc5, 0xcd, 0x01,
+  0x00, 0x7c, 0xb2, 0x38, 0x9a, 0x1c, 0x80, 0x4f, 0xa6, 0x53, 0x08, 0x00, 0xf0, 0xc9, 0xe4, 0x92,
+  0x3b, 0x00, 0x3e, 0xc9, 0x92, 0x03, 0x00, 0xc0, 0x27, 0x1d, 0x01, 0x00, 0x00, 0xf8, 0xe4, 0x73,
+  0x85, 0x00, 0x00, 0x9f, 0x7c, 0x37, 0x05, 0x07, 0xe0, 0x93, 0xb4, 0x00, 0x00, 0x00, 0x7c, 0x92,
+  0xa2, 0x42, 0x00, 0x80, 0x4f, 0x52, 0x44, 0x93, 0x3b, 0x50, 0x86, 0x11, 0x5c, 0x60, 0x00, 0xca,
+  0x30, 0x92, 0x03, 0x00, 0x40, 0x19, 0x46, 0x72, 0x14, 0x00, 0x28, 0xc3, 0xa8, 0xf2, 0xd5, 0x09,
+  0x65, 0x20, 0x23, 0xbd, 0x3a, 0xa1, 0x0c, 0x24, 0x39, 0x00, 0x00, 0x94, 0x81, 0xa4, 0x57, 0xe7,
+  0x84, 0x32, 0x9c, 0xe0, 0x28, 0x00, 0x50, 0x86, 0x53, 0x08, 0x00, 0x00, 0xca, 0x70, 0x6a, 0x7a,
+  0x75, 0x42, 0x19, 0x58, 0x01, 0x00, 0x00, 0x28, 0x03, 0x2b, 0x04, 0x00, 0x00, 0x65, 0x60, 0xc9,
+  0xd4, 0x09, 0xa0, 0x0c, 0x2c, 0xb9, 0x03, 0x00, 0x94, 0x81, 0xbd, 0x06, 0x00, 0x80, 0x32, 0xb0,
+  0x57, 0x8b, 0xa3, 0x50, 0x86, 0x16, 0xe4, 0xab, 0x0c, 0xca, 0xd0, 0x92, 0x3b, 0x00, 0x40, 0x19,
+  0x5a, 0x95, 0x69, 0x00, 0x28, 0x83, 0x23, 0x00, 0x00, 0x00, 0x65, 0x70, 0xa7, 0x10, 0x00, 0xa0,
+  0x0c, 0x8e, 0x96, 0x09, 0x00, 0x94, 0xc1, 0xd1, 0x34, 0x00, 0x80, 0x32, 0x38, 0x9a, 0x1c, 0x00,
+  0x50, 0x06, 0x47, 0x93, 0x3b, 0x00, 0xca, 0xe0, 0x68, 0x7a, 0x75, 0x42, 0x19, 0x60, 0x72, 0x00,
+  0x00, 0x28, 0x03, 0x4c, 0xaf, 0x32, 0x00, 0x65, 0x80, 0x19, 0x00, 0x00, 0xa0, 0x0c, 0x32, 0xb8,
+  0x03, 0x00, 0x94, 0x41, 0x16, 0x02, 0x00, 0x80, 0x32, 0xc8, 0xe2, 0x00, 0x00, 0x50, 0x06, 0x59,
+  0xdc, 0x01, 0x00, 0xca, 0x20, 0x8b, 0xa3, 0x69, 0x40, 0x19, 0x64, 0x22, 0x00, 0x00, 0x28, 0x83,
+  0x4c, 0x8e, 0x02, 0x00, 0x65, 0x90, 0x69, 0xd2, 0x34, 0xa0, 0x0c, 0xf2, 0xc9, 0x02, 0x00, 0x94,
+  0x41, 0x3e, 0x99, 0xdc, 0x81, 0x32, 0x48, 0x5a, 0x08, 0x00, 0x50, 0x86, 0x19, 0x58, 0x06, 0x00,
+  0xca, 0x30, 0x11, 0x00, 0x00, 0x40, 0x19, 0x26, 0x2a, 0x04, 0x00, 0x28, 0xc3, 0x44, 0xc5, 0x1d,
+  0x00, 0x65, 0x98, 0xcf, 0x1d, 0x00, 0xa0, 0x0c, 0x73, 0xbe, 0x3a, 0x27, 0x94, 0x61, 0xd2, 0x34,
+  0x00, 0x80, 0x32, 0x4c, 0x9a, 0xdc, 0x01, 0x50, 0x86, 0x49, 0xd3, 0xab, 0x13, 0xca, 0x30, 0xa9,
+  0x4c, 0xee, 0x40, 0x19, 0x28, 0x00, 0x00, 0x00, 0x28, 0x03, 0x2d, 0x04, 0x00, 0x00, 0x65, 0xa0,
+  0xc5, 0x1d, 0x00, 0xa0, 0x0c, 0xb4, 0xcc, 0x34, 0x00, 0x94, 0x81, 0xa6, 0x03, 0x00, 0x80, 0x32,
+  0xd0, 0x34, 0x69, 0x1a, 0x50, 0x06, 0x4a, 0x0b, 0x01, 0x00, 0xca, 0x51, 0x1c, 0x01, 0x00, 0x40,
+  0x39, 0x8a, 0x2b, 0x04, 0x00, 0x28, 0x47, 0x71, 0x07, 0x00, 0x00, 0x65, 0x01, 0x00, 0x00, 0x00,
+  0xa0, 0x2c, 0x41, 0x16, 0x00, 0x00, 0x94, 0xa5, 0x38, 0x02, 0x00, 0x80, 0xb2, 0x14, 0x47, 0x01,
+  0x00, 0x50, 0x96, 0xe2, 0x68, 0x72, 0x07, 0xca, 0x62, 0x9e, 0x4c, 0xee, 0x40, 0x59, 0x4c, 0xa5,
+  0xc9, 0x1d, 0x28, 0x0b, 0x2b, 0x8e, 0xa6, 0x01, 0x65, 0x61, 0x69, 0xd2, 0x42, 0xa0, 0x2c, 0x2d,
+  0x8d, 0xe0, 0x0e, 0x94, 0xc5, 0x11, 0x00, 0x00, 0x80, 0xb2, 0xb8, 0xe2, 0x0e, 0x00, 0x50, 0x16,
+  0x77, 0x0a, 0x01, 0x00, 0xca, 0xe2, 0x68, 0x91, 0x81, 0x41, 0x59, 0x1c, 0x4d, 0x03, 0x00, 0x28,
+  0x8b, 0xa3, 0xaf, 0x15, 0x02, 0x65, 0x71, 0xd9, 0x15, 0x02, 0xa0, 0x2c, 0x10, 0x00, 0x00, 0x00,
+  0x94, 0x05, 0x16, 0x02, 0x00, 0x80, 0xb2, 0xc8, 0xe2, 0x28, 0x00, 0x50, 0x16, 0x8a, 0x0a, 0x01,
+  0x00, 0xca, 0x54, 0xdc, 0xa0, 0x85, 0x40, 0x99, 0x8a, 0x4c, 0x0e, 0x00, 0x28, 0x13, 0x2b, 0x04,
+  0x00, 0x00, 0x65, 0x6a, 0xc1, 0x01, 0x00, 0xa0, 0x4c, 0xed, 0xd5, 0x09, 0x00, 0x94, 0xc9, 0x0d,
+  0x9a, 0xdc, 0x81, 0x32, 0x39, 0x02, 0x00, 0x00, 0x50, 0x26, 0x47, 0x58, 0x60, 0x00, 0xca, 0xe4,
+  0x4e, 0x99, 0x13, 0x40, 0x99, 0xdc, 0x41, 0xc9, 0x15, 0x28, 0x93, 0x3b, 0xe8, 0x49, 0x00, 0x65,
+  0x72, 0xc9, 0x1d, 0x00, 0xa0, 0x4c, 0x2e, 0x39, 0x9a, 0x06, 0x94, 0xc9, 0xd1, 0x42, 0x00, 0x80,
+  0x32, 0x39, 0x9a, 0x5c, 0x01, 0x50, 0x26, 0x47, 0x93, 0x3b, 0x00, 0xca, 0xe4, 0x68, 0xa2, 0x85,
+  0x40, 0x99, 0x64, 0x21, 0x00, 0x00, 0x28, 0xd3, 0x0c, 0xee, 0x00, 0x00, 0x65, 0x9a, 0x61, 0x26,
+  0x77, 0xa0, 0x4c, 0x13, 0x15, 0x02, 0x00, 0x94, 0x69, 0x22, 0x0a, 0x00, 0x80, 0x32, 0xcd, 0x47,
+  0xd3, 0x00, 0x50, 0xa6, 0x49, 0x0b, 0x01, 0x00, 0xca, 0x34, 0x69, 0x91, 0x05, 0x40, 0x99, 0x26,
+  0x4d, 0xee, 0x00, 0x28, 0xd3, 0xa4, 0xac, 0x10, 0x00, 0x65, 0xa2, 0x69, 0x52, 0x00, 0xa0, 0x7c,
+  0xc1, 0x11, 0x00, 0x00, 0x94, 0x2f, 0xd0, 0xf4, 0xea, 0x84, 0xf2, 0x11, 0x00, 0x00, 0x00, 0x50,
+  0x3e, 0x52, 0x0c, 0x00, 0x00, 0xca, 0x47, 0x9e, 0xa3, 0x00, 0x40, 0xf9, 0x18, 0x01, 0x00, 0x00,
+  0x28, 0x5f, 0x03, 0x00, 0x00, 0x00, 0xe5, 0x6b, 0x21, 0x39, 0x00, 0xa0, 0x7c, 0x2d, 0x50, 0x00,
+  0x00, 0x94, 0xaf, 0x15, 0x02, 0x00, 0x80, 0xf2, 0xb5, 0xe2, 0x0e, 0x00, 0x50, 0xbe, 0x56, 0xe4,
+  0xab, 0x13, 0xca, 0xd7, 0xd2, 0x2c, 0x04, 0x40, 0xf9, 0x5a, 0x9a, 0x14, 0x00, 0x28, 0x5f, 0x4b,
+  0x93, 0x16, 0x02, 0xe5, 0x6b, 0x93, 0x16, 0x00, 0xa0, 0x7c, 0x8e, 0x00, 0x00, 0x00, 0x94, 0xcf,
+  0x25, 0x47, 0x01, 0x80, 0xf2, 0x39, 0x9a, 0x1c, 0x05, 0x50, 0x3e, 0x47, 0x93, 0xa3, 0x05, 0xca,
+  0xf7, 0x64, 0x1a, 0x00, 0x40, 0xf9, 0x64, 0x70, 0x07, 0x00, 0x28, 0x9f, 0x2c, 0x00, 0x00, 0x00,
+  0xe5, 0x93, 0x85, 0x00, 0x00, 0xa0, 0x7c, 0xb2, 0x38, 0x00, 0x00, 0x94, 0x4f, 0x16, 0x17, 0x18,
+  0x80, 0xf2, 0xc9, 0xe2, 0x28, 0x00, 0x50, 0x3e, 0x99, 0x04, 0xcb, 0x00, 0xca, 0x27, 0xd3, 0x40,
+  0x05, 0x40, 0xf9, 0x64, 0x22, 0x00, 0x00, 0x28, 0x9f, 0x4c, 0x33, 0xb9, 0x03, 0xe5, 0x93, 0xc9,
+  0x16, 0x02, 0xa0, 0x7c, 0x92, 0x15, 0x02, 0x00, 0x94, 0x4f, 0xb2, 0x24, 0x18, 0x80, 0xf2, 0x49,
+  0x96, 0xdc, 0x01, 0x50, 0x3e, 0xe9, 0xd2, 0x00, 0x00, 0xca, 0x27, 0x9f, 0x0b, 0x0c, 0x40, 0xf9,
+  0xe4, 0x73, 0x07, 0x00, 0x28, 0x1f, 0x2d, 0x0e, 0x00, 0x00, 0xe5, 0xa3, 0xc5, 0x1d, 0x00, 0xa0,
+  0x7c, 0x14, 0x05, 0x49, 0x00, 0x94, 0x8f, 0xa2, 0x42, 0x00, 0x80, 0xf2, 0x51, 0x94, 0x06, 0x00,
+  0x50, 0x3e, 0x9a, 0x5c, 0x60, 0x00, 0xca, 0x47, 0x93, 0x2b, 0x04, 0x40, 0xf9, 0x68, 0x72, 0x07,
+  0x00, 0x28, 0x1f, 0x95, 0x85, 0x00, 0x00, 0xe5, 0xa3, 0x93, 0x26, 0x77, 0xa0, 0x7c, 0xb4, 0xb2,
+  0x42, 0x00, 0x94, 0xaf, 0x26, 0x07, 0x00, 0x80, 0xf2, 0x55, 0xf9, 0xdc, 0x01, 0x50, 0xbe, 0x3a,
+  0x29, 0x00, 0x00, 0xca, 0x67, 0x0b, 0x01, 0x00, 0x40, 0xf9, 0x6c, 0x99, 0x69, 0x00, 0x28, 0xdf,
+  0x0d, 0x14, 0x00, 0x00, 0x25, 0x45, 0x05, 0x00, 0x00, 0xa0, 0xa4, 0xa8, 0x10, 0x00, 0x00, 0x94,
+  0xd5, 0x11, 0x00, 0x00, 0x80, 0xb2, 0xba, 0xe4, 0x00, 0x00, 0x50, 0x56, 0x47, 0x93, 0x3b, 0x00,
+  0xca, 0x3a, 0x69, 0x01, 0x00, 0xc0, 0x39, 0xaa, 0x2b, 0x00, 0x00, 0x38, 0xa1, 0x4c, 0xa6, 0xce,
+  0x09, 0xe7, 0xa4, 0x85, 0x00, 0x00, 0xe0, 0x9c, 0xb4, 0xc8, 0x57, 0x27, 0x9c, 0x79, 0x14, 0x77,
+  0x00, 0x80, 0x55, 0xb0, 0x42, 0x00, 0x00, 0xb0, 0x0a, 0x59, 0x5c, 0x60, 0x00, 0x56, 0x02, 0x00,
+  0x00, 0x00, 0xc0, 0x7a, 0x8a, 0x23, 0x00, 0x00, 0x58, 0xd9, 0xa0, 0x00, 0x00, 0x00, 0x2b, 0x7b,
+  0x2d, 0xb9, 0x03, 0x60, 0x85, 0x73, 0xd2, 0xe4, 0x0e, 0xac, 0xb2, 0x38, 0x9a, 0xdc, 0x81, 0x55,
+  0x16, 0x69, 0xea, 0x04, 0xb0, 0xca, 0x34, 0x0b, 0x01, 0x00, 0x56, 0xd9, 0x82, 0x3b, 0x00, 0xc0,
+  0x2a, 0x9f, 0x2c, 0x04, 0x00, 0x58, 0xe5, 0x93, 0x19, 0x00, 0x00, 0xab, 0x94, 0x55, 0x16, 0x02,
+  0x60, 0x9d, 0xb3, 0x38, 0x00, 0x00, 0xac, 0x93, 0x16, 0x02, 0x00, 0x80, 0x75, 0xd2, 0x62, 0x2a,
+  0x03, 0xb0, 0x4e, 0x5a, 0xa4, 0x3b, 0x00, 0xd6, 0x49, 0x11, 0x4d, 0x03, 0xc0, 0x3a, 0x69, 0x72,
+  0x07, 0x00, 0x58, 0x27, 0x65, 0x45, 0x16, 0x02, 0xeb, 0xa4, 0x4f, 0x06, 0x06, 0x60, 0xa5, 0xa1,
+  0xa5, 0x01, 0x00, 0xac, 0x14, 0x3d, 0x57, 0x00, 0x80, 0x95, 0xa6, 0x01, 0x00, 0x00, 0xb1, 0x52,
+  0x04, 0x00, 0x00, 0x20, 0x56, 0x9a, 0x26, 0x2b, 0x04, 0xc8, 0x40, 0x00, 0x00, 0x00, 0x00, 0x19,
+  0x48, 0x9a, 0x88, 0x02, 0x20, 0xc3, 0x41, 0xc5, 0x15, 0x02, 0x64, 0x38, 0x9a, 0xa5, 0x01, 0x80,
+  0x0c, 0x69, 0xd2, 0x34, 0x00, 0x90, 0x81, 0x05, 0x21, 0x03, 0x03, 0x32, 0xb0, 0xe0, 0x68, 0x5a,
+  0x45, 0x06, 0x46, 0x00, 0x00, 0x00, 0xc8, 0xc0, 0x48, 0x72, 0xb4, 0x10, 0x19, 0x18, 0x49, 0x93,
+  0xa6, 0x21, 0x03, 0x2b, 0x04, 0x00, 0x00, 0x64, 0x60, 0xc5, 0x0d, 0x00, 0x80, 0x0c, 0xac, 0xb8,
+  0x34, 0x00, 0x90, 0x81, 0xa5, 0xc0, 0x0a, 0x01, 0x32, 0xb0, 0x34, 0x02, 0x05, 0x40, 0x06, 0x96,
+  0x46, 0x1a, 0x00, 0xc8, 0xc0, 0xd2, 0x48, 0xee, 0x00, 0x19, 0x58, 0x22, 0x00, 0x00, 0x20, 0x03,
+  0x4b, 0x2e, 0x05, 0x77, 0x64, 0x60, 0xe9, 0xb5, 0x42, 0x80, 0x0c, 0x2c, 0xcd, 0x42, 0x00, 0x90,
+  0x81, 0x31, 0x02, 0x00, 0x00, 0x32, 0x30, 0x46, 0x0a, 0x01, 0x40, 0x06, 0xc6, 0x0a, 0x01, 0x00,
+  0xc8, 0xc0, 0x58, 0x91, 0x85, 0x00, 0x19, 0x18, 0x4b, 0xb3, 0x10, 0x20, 0x03, 0x63, 0xc9, 0x16,
+  0x02, 0x64, 0x60, 0xec, 0xc9, 0x57, 0xa7, 0x0c, 0xac, 0x15, 0x07, 0x00, 0x90, 0x81, 0xb5, 0x34,
+  0x00, 0x00, 0x32, 0xb0, 0xc7, 0x92, 0x3b, 0x40, 0x06, 0xf6, 0x1c, 0x2d, 0x04, 0xc8, 0xc0, 0x9e,
+  0x2c, 0x04, 0x00, 0x19, 0xd8, 0x93, 0x69, 0x00, 0x20, 0x03, 0x7b, 0xb2, 0xce, 0x09, 0x64, 0x60,
+  0xb3, 0x00, 0x00, 0x80, 0x0c, 0x2c, 0x03, 0x00, 0x00, 0x90, 0xa1, 0xa5, 0x40, 0x93, 0x3b, 0x32,
+  0xb4, 0xe4, 0x18, 0x00, 0x40, 0x06, 0x47, 0x00, 0x00, 0x00, 0xc8, 0xe0, 0x48, 0x21, 0x00, 0x00,
+  0x19, 0x1c, 0x29, 0x2e, 0x30, 0x20, 0x83, 0x23, 0xc5, 0x51, 0x00, 0x64, 0x70, 0xa4, 0x4c, 0x0a,
+  0x80, 0x0c, 0x8e, 0xa4, 0x99, 0xdc, 0x91, 0xc1, 0x91, 0x34, 0x93, 0x2d, 0x32, 0xb8, 0x02, 0x00,
+  0x00, 0x40, 0x06, 0x77, 0x10, 0x2b, 0x04, 0xc8, 0xe0, 0x8e, 0x4b, 0x03, 0x00, 0x19, 0xdc, 0xa9,
+  0xf2, 0xd5, 0x29, 0x83, 0x4b, 0x04, 0x00, 0x00, 0x64, 0x70, 0x69, 0xa6, 0x11, 0x98, 0x0c, 0x8e,
+  0x26, 0x5b, 0x08, 0x90, 0x01, 0x86, 0x91, 0x5e, 0x9d, 0x32, 0xc0, 0x40, 0x0b, 0x01, 0x40, 0x06,
+  0x58, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x0b, 0x01, 0x00, 0x00, 0x19, 0x60, 0x21, 0x85, 0x00, 0x20,
+  0x03, 0x2c, 0x2c, 0x05, 0x06, 0x64, 0x80, 0xc5, 0x1d, 0x00, 0x80, 0x0c, 0xb0, 0xcc, 0x34, 0x02,
+  0x93, 0x01, 0x26, 0x77, 0x00, 0x00, 0x32, 0xc0, 0x34, 0x29, 0x00, 0x40, 0x06, 0xc8, 0x9e, 0x2c,
+  0x04, 0xc8, 0x00, 0x65, 0x91, 0x81, 0x01, 0x19, 0xa0, 0x2c, 0xb2, 0x10, 0x20, 0x03, 0x94, 0x45,
+  0xbe, 0x3a, 0x65, 0x80, 0x32, 0x8d, 0xc0, 0x80, 0x0c, 0x70, 0xce, 0xe4, 0x68, 0x91, 0x01, 0xd2,
+  0x32, 0xd3, 0x00, 0x32, 0x40, 0x9a, 0x1c, 0x2d, 0x44, 0x06, 0x19, 0x04, 0x2b, 0x04, 0xc8, 0x20,
+  0x03, 0x2b, 0x04, 0x00, 0x19, 0x64, 0x70, 0x04, 0x00, 0x20, 0x83, 0x0c, 0x2e, 0x8d, 0xc0, 0x64,
+  0x90, 0xc1, 0xd1, 0x34, 0x80, 0x0c, 0x32, 0xc8, 0x42, 0x00, 0x90, 0x41, 0x8a, 0x40, 0x00, 0x00,
+  0x32, 0x48, 0x11, 0x66, 0x72, 0x54, 0x06, 0x39, 0x82, 0xa3, 0x69, 0xc8, 0x20, 0x07, 0x32, 0x95,
+  0x01, 0x19, 0xe4, 0x48, 0x0e, 0x00, 0x20, 0x83, 0x24, 0x00, 0x00, 0x00, 0x64, 0x90, 0x44, 0xa6,
+  0xe0, 0xa8, 0x0c, 0xb2, 0x00, 0x00, 0x00, 0x90, 0x41, 0x16, 0x02, 0x00, 0x00, 0x32, 0xc8, 0x42,
+  0x58, 0x21, 0x40, 0x06, 0x59, 0x1c, 0x01, 0x00, 0xc8, 0x20, 0x8b, 0x2b, 0x00, 0x00, 0x19, 0x64,
+  0x71, 0x85, 0x00, 0x20, 0x83, 0x2c, 0x2e, 0xb9, 0x03, 0x64, 0x90, 0xc5, 0xa5, 0x57, 0xa7, 0x0c,
+  0xb2, 0x38, 0x0a, 0x00, 0x90, 0x41, 0x16, 0x47, 0x0b, 0x01, 0x32, 0xc8, 0xe2, 0x68, 0x1a, 0x40,
+  0x06, 0x59, 0x1c, 0x4d, 0x8e, 0xca, 0x20, 0x0b, 0x4c, 0x03, 0x00, 0x19, 0x64, 0x91, 0xc9, 0x1d,
+  0x20, 0x83, 0x2c, 0xb3, 0x90, 0x42, 0x64, 0x90, 0x65, 0x22, 0x5a, 0x80, 0x0c, 0xf2, 0x14, 0x19,
+  0x18, 0x90, 0x41, 0xa6, 0x20, 0x0b, 0x01, 0x32, 0xc8, 0x44, 0x00, 0x00, 0x40, 0x06, 0x99, 0x0e,
+  0x2a, 0x04, 0xc8, 0x20, 0x13, 0x03, 0x00, 0x00, 0x19, 0x64, 0x72, 0x03, 0x00, 0x20, 0x83, 0x4c,
+  0x6e, 0x04, 0x06, 0x64, 0x90, 0xc9, 0x15, 0x02, 0x80, 0x0c, 0x32, 0xb9, 0x53, 0x08, 0x90, 0x41,
+  0x26, 0x47, 0x01, 0x00, 0x32, 0xc8, 0xe4, 0x68, 0x72, 0x47, 0x06, 0x99, 0x64, 0x21, 0x00, 0xc8,
+  0x20, 0x93, 0x4c, 0xee, 0x00, 0x19, 0x64, 0x9a, 0x85, 0x00, 0x20, 0x83, 0x4c, 0x33, 0xb9, 0x03,
+  0x64, 0x90, 0x69, 0xd2, 0xe4, 0xa8, 0x0c, 0x72, 0x15, 0x00, 0x00, 0x90, 0x41, 0xae, 0xe2, 0x00,
+  0x00, 0x32, 0x48, 0x47, 0x25, 0x00, 0x40, 0x06, 0xf9, 0x46, 0x60, 0x00, 0xc8, 0x20, 0x9f, 0x1b,
+  0x00, 0x00, 0x19, 0xe4, 0x73, 0xc9, 0x1d, 0x20, 0x83, 0x7c, 0x32, 0x0d, 0x00, 0x64, 0x90, 0x32,
+  0xb9, 0x03, 0x80, 0x0c, 0x52, 0xca, 0x42, 0x00, 0x90, 0x41, 0x4a, 0x9a, 0xdc, 0x01, 0x32, 0xc8,
+  0x59, 0xdc, 0x01, 0x40, 0x06, 0x39, 0x69, 0x1a, 0x00, 0xc8, 0x20, 0x69, 0x71, 0x07, 0x00, 0x19,
+  0x24, 0x2d, 0x32, 0x39, 0x2a, 0x83, 0xa4, 0x65, 0xd2, 0x42, 0x64, 0x90, 0x14, 0x15, 0x00, 0x80,
+  0x0c, 0x92, 0xa2, 0x22, 0x0b, 0x91, 0x41, 0xd2, 0x34, 0x28, 0x00, 0x32, 0x48, 0x9a, 0xdc, 0x01,
+  0x40, 0x06, 0x49, 0x69, 0x21, 0x00, 0xc8, 0x20, 0x6d, 0x91, 0x85, 0x00, 0x19, 0x66, 0x21, 0x00,
+  0x00, 0x20, 0xc3, 0x44, 0x45, 0xae, 0x42, 0x64, 0x98, 0xb4, 0x10, 0x00, 0x80, 0x0c, 0x93, 0x16,
+  0x77, 0x00, 0x90, 0x81, 0x86, 0x91, 0xdc, 0x01, 0x32, 0xd0, 0xc0, 0xd2, 0x00, 0x40, 0x06, 0x5a,
+  0x00, 0x00, 0x00, 0xc8, 0x40, 0x11, 0x00, 0x00, 0x00, 0x19, 0x28, 0x0a, 0x03, 0x00, 0x20, 0x03,
+  0x45, 0x04, 0x00, 0x00, 0x64, 0xa0, 0xa8, 0x10, 0x00, 0x80, 0x0c, 0x14, 0x15, 0x47, 0x01, 0x90,
+  0x81, 0xa2, 0x22, 0x0b, 0x01, 0x32, 0x50, 0x94, 0xdc, 0x01, 0x40, 0x06, 0x8a, 0x28, 0x00, 0x00,
+  0xc8, 0x40, 0x11, 0x4d, 0xee, 0x00, 0x19, 0x28, 0xa2, 0xac, 0x10, 0x20, 0x03, 0x4d, 0x23, 0x48,
+  0x02, 0x64, 0xa0, 0xc9, 0x15, 0x02, 0x80, 0x0c, 0x34, 0xb9, 0x34, 0x00, 0x90, 0x81, 0x26, 0x47,
+  0x01, 0x00, 0x32, 0x50, 0x19, 0x1c, 0x00, 0x40, 0x06, 0x5a, 0x69, 0x21, 0x00, 0xc8, 0x50, 0x5d,
+  0x1a, 0x81, 0x01, 0x19, 0xaa, 0xa3, 0x85, 0x00, 0x20, 0x43, 0x75, 0x34, 0x0d, 0x00, 0x64, 0xa8,
+  0x8e, 0x26, 0x77, 0x80, 0x0c, 0x75, 0xbe, 0x2a, 0x19, 0x90, 0xa1, 0x4e, 0x9a, 0x1c, 0x05, 0x32,
+  0x54, 0x5a, 0xdc, 0x01, 0x40, 0x06, 0x1b, 0x58, 0x06, 0x00, 0xc8, 0x60, 0x0b, 0x00, 0x00, 0x00,
+  0x19, 0x6c, 0x21, 0x00, 0x00, 0x20, 0x83, 0x2d, 0x8e, 0x00, 0x00, 0x64, 0xb0, 0xc5, 0xd1, 0xe4,
+  0x8e, 0x0c, 0xb6, 0xc8, 0x42, 0x00, 0x90, 0xc1, 0x26, 0x02, 0x00, 0x00, 0x32, 0x5c, 0x00, 0x00,
+  0x00, 0x40, 0x86, 0x5b, 0x48, 0x21, 0x00, 0xc8, 0x70, 0xdd, 0x48, 0xee, 0x00, 0x19, 0xb4, 0x4e,
+  0xee, 0x00, 0x20, 0x4b, 0x18, 0x81, 0x01, 0x00, 0x64, 0x09, 0x23, 0xc8, 0x32, 0x81, 0x2c, 0x61,
+  0x14, 0x02, 0x00, 0x90, 0x25, 0x8c, 0xe2, 0x0e, 0x00, 0xb2, 0x84, 0x81, 0x82, 0x03, 0x40, 0x96,
+  0x30, 0x50, 0x72, 0x14, 0xc8, 0x12, 0x46, 0x1a, 0x14, 0x00, 0x59, 0xc2, 0x48, 0xa6, 0x32, 0x20,
+  0x4b, 0x18, 0xc9, 0x05, 0x06, 0x64, 0x09, 0x23, 0xb9, 0x03, 0x80, 0x2c, 0x61, 0xd4, 0xe4, 0x28,
+  0x90, 0x25, 0x8c, 0xea, 0x68, 0x21, 0xb2, 0x84, 0x51, 0xa5, 0x3b, 0x40, 0x96, 0x30, 0xaa, 0xcc,
+  0x00, 0xc8, 0x12, 0x46, 0x06, 0x00, 0x00, 0x59, 0x02, 0x01, 0x00, 0x00, 0x20, 0x4b, 0x20, 0x23,
+  0x39, 0x0a, 0x64, 0x09, 0xa7, 0x00, 0x00, 0x80, 0x2c, 0xe1, 0x14, 0x02, 0x00, 0x90, 0x25, 0x9c,
+  0x42, 0x92, 0x3b, 0xb2, 0x84, 0x53, 0xdc, 0x01, 0x40, 0x96, 0x70, 0x8a, 0xa3, 0x00, 0xc8, 0x12,
+  0x0e, 0x2a, 0x04, 0x00, 0x59, 0xc2, 0x49, 0xa7, 0x10, 0x20, 0x4b, 0x38, 0xc9, 0x01, 0x00, 0x64,
+  0x09, 0x27, 0xb9, 0x03, 0x80, 0x2c, 0xe1, 0x54, 0x56, 0x08, 0x90, 0x25, 0x9c, 0x2a, 0x83, 0x3b,
+  0xb2, 0x84, 0x53, 0xe5, 0xab, 0x53, 0x96, 0x90, 0xdc, 0x01, 0x00, 0xc8, 0x12, 0x12, 0x4d, 0xee,
+  0x00, 0x59, 0xc2, 0x02, 0x00, 0x00, 0x20, 0x4b, 0x58, 0xc5, 0x01, 0x00, 0x64, 0x09, 0xac, 0x00,
+  0x00, 0x80, 0x2c, 0x81, 0x15, 0x02, 0x00, 0x90, 0x25, 0xb0, 0xe2, 0x28, 0x00, 0xb2, 0x04, 0x56,
+  0x66, 0x72, 0x54, 0x96, 0xc0, 0x92, 0xa3, 0x00, 0xc8, 0x12, 0x58, 0xa2, 0x69, 0x00, 0x59, 0x02,
+  0x63, 0x85, 0x00, 0x20, 0x4b, 0x60, 0x2c, 0xbd, 0x3a, 0x65, 0x09, 0x8c, 0x65, 0x00, 0x80, 0x2c,
+  0x81, 0xbd, 0x56, 0x08, 0x90, 0x25, 0xb0, 0x27, 0x0b, 0x01, 0xb2, 0x04, 0xf6, 0x64, 0x99, 0x53,
+  0x96, 0xc0, 0x68, 0x72, 0x07, 0xc8, 0x12, 0x1a, 0x00, 0x00, 0x00, 0x59, 0x42, 0x0b, 0x03, 0x15,
+  0x22, 0x4b, 0x68, 0x81, 0x15, 0x77, 0x64, 0x09, 0x2d, 0xb8, 0x03, 0x80, 0x2c, 0xa1, 0x05, 0x47,
+  0x0b, 0x91, 0x25, 0xb4, 0x20, 0x03, 0x03, 0xb2, 0x84, 0x56, 0xdc, 0x01, 0x40, 0x96, 0xd0, 0xd2,
+  0x00, 0x00, 0xc8, 0x12, 0x5a, 0x72, 0x00, 0x00, 0x59, 0x42, 0x4b, 0xee, 0x00, 0x20, 0x4b, 0x68,
+  0xc9, 0xd1, 0x34, 0x64, 0x09, 0x2d, 0xcd, 0x64, 0x8b, 0x2c, 0xa1, 0xb1, 0xe4, 0x28, 0x90, 0x25,
+  0x38, 0x02, 0x00, 0x00, 0xb2, 0x04, 0x47, 0x0a, 0x01, 0x40, 0x96, 0xe0, 0x4e, 0x21, 0x00, 0xc8,
+  0x12, 0xdc, 0x29, 0xee, 0x00, 0x59, 0x82, 0x4b, 0x03, 0x00, 0x20, 0x4b, 0x70, 0x89, 0x00, 0x00,
+  0x64, 0x09, 0x2e, 0x99, 0xca, 0x80, 0x2c, 0xc1, 0x25, 0x77, 0x00, 0x90, 0x25, 0xb8, 0x34, 0x51,
+  0x21, 0xb2, 0x04, 0x97, 0x66, 0x72, 0x47, 0x96, 0xe0, 0x9e, 0x7c, 0x95, 0xc9, 0x12, 0x5c, 0xac,
+  0x73, 0x02, 0x59, 0x82, 0xa3, 0x00, 0x00, 0x20, 0x4b, 0x70, 0xb4, 0x10, 0x00, 0x64, 0x09, 0x8e,
+  0xa6, 0x01, 0x80, 0x2c, 0xc1, 0xd1, 0x34, 0x02, 0x93, 0x25, 0x38, 0x9a, 0xdc, 0x01, 0xb2, 0x04,
+  0x47, 0x93, 0xa3, 0x40, 0x96, 0xe0, 0x28, 0x2b, 0x04, 0xc8, 0x12, 0x5c, 0x06, 0x00, 0x00, 0x59,
+  0x02, 0x2c, 0x00, 0x00, 0x20, 0x4b, 0x90, 0x61, 0x00, 0x00, 0x64, 0x09, 0x32, 0xb0, 0xe4, 0xa8,
+  0x2c, 0x41, 0x06, 0x59, 0x08, 0x90, 0x25, 0xc8, 0x40, 0x69, 0x1a, 0xb2, 0x04, 0x59, 0x08, 0x00,
+  0x40, 0x96, 0x20, 0x8b, 0xa9, 0x0c, 0xc8, 0x12, 0x64, 0x71, 0x07, 0x00, 0x59, 0x82, 0x2c, 0x8e,
+  0x02, 0x20, 0x4b, 0x90, 0xc5, 0xd1, 0x02, 0x64, 0x09, 0xb2, 0x38, 0x9a, 0x86, 0x2c, 0x41, 0x16,
+  0x19, 0x18, 0x90, 0x25, 0xc8, 0x22, 0x0b, 0x01, 0xb2, 0x04, 0x59, 0x64, 0x1a, 0x40, 0x96, 0x20,
+  0x8b, 0x4c, 0xab, 0xc8, 0x12, 0x64, 0x91, 0xc9, 0x1d, 0x59, 0x82, 0x2c, 0xf2, 0xb5, 0x22, 0x4b,
+  0x90, 0x45, 0xbe, 0x3a, 0x65, 0x09, 0x32, 0x0d, 0x00, 0x80, 0x2c, 0x41, 0x26, 0x02, 0x00, 0x90,
+  0x25, 0xc8, 0xc4, 0x00, 0x00, 0xb2, 0x04, 0x99, 0x1c, 0x00, 0x40, 0x96, 0x20, 0x93, 0x0b, 0x0c,
+  0xc8, 0x12, 0x64, 0x72, 0x07, 0x00, 0x59, 0x82, 0x4c, 0x8e, 0x02, 0x20, 0x4b, 0x90, 0xe9, 0x01,
+  0x00, 0x64, 0x09, 0x32, 0xc9, 0xb4, 0x8a, 0x2c, 0x41, 0xa6, 0x59, 0x08, 0x90, 0x25, 0xc8, 0x34,
+  0x51, 0x21, 0xb2, 0x04, 0x99, 0x66, 0x1a, 0x4b, 0x96, 0x20, 0xd3, 0xa4, 0x69, 0xc8, 0x12, 0x24,
+  0x2b, 0x04, 0x00, 0x59, 0x82, 0x64, 0xc9, 0x1d, 0x20, 0x4b, 0x90, 0x8e, 0x00, 0x00, 0x64, 0x09,
+  0xd2, 0x51, 0x00, 0x80, 0x2c, 0x41, 0xbe, 0x56, 0x08, 0x90, 0x25, 0xc8, 0xd7, 0x92, 0x3b, 0xb2,
+  0x04, 0xf9, 0x64, 0x21, 0x40, 0x96, 0x20, 0x9f, 0x4c, 0xee, 0xc8, 0x12, 0xe4, 0x93, 0xaf, 0x4e,
+  0x59, 0x82, 0x7c, 0x14, 0x00, 0x20, 0x4b, 0x90, 0xaf, 0x4e, 0x00, 0x64, 0x09, 0xf2, 0xd5, 0x39,
+  0xa7, 0x2c, 0x41, 0xbe, 0x5b, 0x08, 0x90, 0x25, 0x48, 0x98, 0x01, 0x00, 0xb2, 0x04, 0x49, 0x0b,
+  0x01, 0x40, 0x96, 0x20, 0x33, 0x00, 0x00, 0xc8, 0x12, 0x66, 0x70, 0x00, 0x00, 0x59, 0xc2, 0x0c,
+  0x32, 0xb0, 0x22, 0x4b, 0x98, 0x81, 0x02, 0x00, 0x64, 0x09, 0x33, 0xd0, 0xe4, 0x8e, 0x2c, 0x61,
+  0x16, 0x02, 0x00, 0x90, 0x25, 0xcc, 0xe2, 0x00, 0x00, 0xb2, 0x84, 0x59, 0x64, 0x21, 0x40, 0x96,
+  0x30, 0x8b, 0xcc, 0x00, 0xc8, 0x12, 0x26, 0x2a, 0x00, 0x00, 0x59, 0xc2, 0x44, 0x85, 0x00, 0x20,
+  0x4b, 0x98, 0xc8, 0x54, 0x06, 0x64, 0x09, 0x13, 0x25, 0x77, 0x80, 0x2c, 0x61, 0x22, 0x56, 0x08,
+  0x90, 0x25, 0x4c, 0x44, 0x51, 0x01, 0xb2, 0x84, 0x99, 0x4c, 0x65, 0x40, 0x96, 0x30, 0x5f, 0x2b,
+  0x04, 0xc8, 0x12, 0xe6, 0x73, 0x07, 0x00, 0x59, 0xc2, 0x7c, 0xb2, 0x10, 0x20, 0x4b, 0x98, 0x4f,
+  0xbe, 0x3a, 0x65, 0x09, 0xf3, 0xd1, 0x14, 0x98, 0x2c, 0x61, 0xbe, 0x5a, 0x08, 0x90, 0x25, 0xcc,
+  0x57, 0xe7, 0x04, 0xb2, 0x84, 0xf9, 0x6e, 0x01, 0x40, 0x96, 0x30, 0x67, 0x21, 0x00, 0xc8, 0x12,
+  0xe6, 0x4c, 0x03, 0x00, 0x59, 0xc2, 0x9c, 0xc9, 0x51, 0x20, 0x4b, 0x98, 0x93, 0x15, 0x02, 0x64,
+  0x09, 0x73, 0xd2, 0xe4, 0xa8, 0x2c, 0x61, 0xce, 0x3a, 0x01, 0x90, 0x25, 0xcc, 0x99, 0x01, 0x00,
+  0xb2, 0x84, 0x49, 0x01, 0x00, 0x40, 0x96, 0x30, 0x69, 0x01, 0x00, 0xc8, 0x12, 0x26, 0x2d, 0x04,
+  0x00, 0x59, 0xc2, 0xa4, 0x29, 0x30, 0x20, 0x4b, 0x98, 0x34, 0x0d, 0x00, 0x64, 0x09, 0x93, 0xa6,
+  0x11, 0x98, 0x2c, 0x61, 0xd2, 0xe4, 0x0e, 0x90, 0x25, 0x4c, 0x9a, 0x5e, 0x9d, 0xb2, 0x84, 0x49,
+  0x19, 0x00, 0x40, 0x96, 0x30, 0x29, 0x2b, 0x04, 0xc8, 0x12, 0x66, 0x06, 0x00, 0x00, 0x59, 0x02,
+  0x05, 0x00, 0x00, 0x20, 0x4b, 0xa0, 0x61, 0xa4, 0xc0, 0x64, 0x09, 0x34, 0x4c, 0x0a, 0x80, 0x2c,
+  0x81, 0x16, 0x00, 0x00, 0x90, 0x25, 0xd0, 0x42, 0x00, 0x00, 0xb2, 0x04, 0x5a, 0x1c, 0x00, 0x40,
+  0x96, 0x40, 0x8b, 0x3b, 0x00, 0xc8, 0x12, 0x68, 0x71, 0x69, 0x00, 0x59, 0x02, 0x2d, 0xb2, 0x10,
+  0x20, 0x4b, 0xa0, 0x45, 0x26, 0x77, 0x64, 0x09, 0xb4, 0x4c, 0x0a, 0x80, 0x2c, 0x81, 0xa2, 0x20,
+  0x0b, 0x91, 0x25, 0x50, 0x94, 0x06, 0x00, 0xb2, 0x04, 0x8a, 0x92, 0xa3, 0x40, 0x96, 0x40, 0xd3,
+  0x00, 0x00, 0xc8, 0x12, 0x68, 0x1a, 0x81, 0x01, 0x59, 0x02, 0x4d, 0x83, 0x02, 0x20, 0x4b, 0xa0,
+  0x89, 0x00, 0x00, 0x64, 0x09, 0x34, 0x39, 0x00, 0x80, 0x2c, 0x81, 0x26, 0x17, 0x28, 0x90, 0x25,
+  0xd0, 0xe4, 0x0a, 0x01, 0xb2, 0x04, 0x9a, 0xdc, 0x01, 0x40, 0x96, 0x40, 0x93, 0xa3, 0x69, 0xc8,
+  0x12, 0x68, 0x7a, 0x95, 0x01, 0x59, 0x02, 0x4d, 0xaf, 0x3a, 0x2a, 0x4b, 0xa0, 0xe9, 0xd5, 0x39,
+  0x65, 0x09, 0x34, 0xcd, 0x34, 0x80, 0x2c, 0x81, 0xa6, 0x49, 0x01, 0x90, 0x25, 0xd0, 0x34, 0x69,
+  0x21, 0xb2, 0x04, 0x9a, 0x26, 0x4d, 0x43, 0x96, 0x40, 0x59, 0x21, 0x00, 0xc8, 0x12, 0xaa, 0x0c,
+  0x8e, 0x02, 0x59, 0x82, 0x2d, 0x00, 0x00, 0x20, 0x4b, 0xb0, 0x85, 0x00, 0x00, 0x64, 0x09, 0xb6,
+  0xb8, 0x03, 0x80, 0x2c, 0xc1, 0x16, 0x59, 0x08, 0x90, 0x25, 0xd8, 0x64, 0xea, 0x04, 0xb2, 0x04,
+  0x5c, 0x1c, 0x05, 0x40, 0x96, 0x80, 0xd3, 0xa4, 0x69, 0xc8, 0x12, 0x74, 0x71, 0x85, 0x00, 0x59,
+  0x82, 0x2e, 0xee, 0x00, 0x20, 0x4b, 0xd0, 0xac, 0x10, 0x00, 0x64, 0x19, 0x41, 0x30, 0x00, 0x80,
+  0x2c, 0x23, 0xb0, 0x34, 0x00, 0x90, 0x65, 0x04, 0x57, 0x08, 0x00, 0xb2, 0x8c, 0xe0, 0xd2, 0x00,
+  0x40, 0x96, 0x11, 0x1c, 0x05, 0x00, 0xc8, 0x32, 0x82, 0x2c, 0x04, 0x00, 0x59, 0x46, 0xa0, 0x00,
+  0x00, 0x20, 0xcb, 0x08, 0xb4, 0x10, 0x00, 0x64, 0x19, 0x05, 0x00, 0x00, 0x80, 0x2c, 0xa3, 0x10,
+  0x00, 0x00, 0x90, 0x65, 0x14, 0xc2, 0x92, 0x3b, 0xb2, 0x8c, 0xc2, 0x0a, 0x01, 0x40, 0x96, 0x51,
+  0x58, 0x7a, 0x75, 0xca, 0x32, 0x8a, 0x03, 0x00, 0x00, 0x59, 0x46, 0x71, 0x04, 0x00, 0x20, 0xcb,
+  0x28, 0xae, 0x10, 0x00, 0x64, 0x19, 0xc5, 0x1d, 0x00, 0x80, 0x2c, 0xa3, 0xb8, 0x34, 0x00, 0x90,
+  0x65, 0x14, 0x97, 0x0a, 0x00, 0xb2, 0x8c, 0xe2, 0xd2, 0x2a, 0x44, 0x96, 0x51, 0x5c, 0x72, 0x07,
+  0xc8, 0x32, 0x8a, 0x9b, 0x85, 0x00, 0x59, 0x46, 0x71, 0x14, 0x00, 0x20, 0xcb, 0x28, 0x8e, 0x16,
+  0x02, 0x64, 0x19, 0xc5, 0xd1, 0xe4, 0x8e, 0x2c, 0xa3, 0x38, 0x5a, 0x27, 0x90, 0x65, 0x14, 0x48,
+  0x0b, 0x01, 0xb2, 0x8c, 0x22, 0x03, 0x03, 0x40, 0x96, 0x51, 0x64, 0x70, 0x14, 0xc8, 0x32, 0x8a,
+  0x0c, 0x8e, 0x16, 0x59, 0x46, 0x91, 0x85, 0x00, 0x20, 0xcb, 0x28, 0x32, 0x05, 0x06, 0x64, 0x19,
+  0x45, 0xa6, 0x39, 0x81, 0x2c, 0xa3, 0xc8, 0x57, 0xe7, 0x94, 0x65, 0x94, 0x99, 0x26, 0x00, 0xb2,
+  0x8c, 0x32, 0x29, 0x00, 0x40, 0x96, 0x51, 0x26, 0x2d, 0x04, 0xc8, 0x32, 0xca, 0xa4, 0xc9, 0x1d,
+  0x59, 0x06, 0x2a, 0xae, 0x00, 0x20, 0xcb, 0x40, 0x69, 0x16, 0x00, 0x64, 0x19, 0x88, 0x02, 0x00,
+  0x80, 0x2c, 0x23, 0x9d, 0x42, 0x00, 0x90, 0x65, 0x24, 0x07, 0x00, 0x00, 0xb2, 0x8c, 0xe4, 0x08,
+  0x00, 0x40, 0x96, 0x91, 0x1c, 0xa5, 0x85, 0xc8, 0x32, 0xd2, 0xab, 0x73, 0x4e, 0x59, 0x46, 0x9a,
+  0x29, 0x30, 0x20, 0xcb, 0x48, 0x33, 0x05, 0x77, 0x64, 0x19, 0xab, 0x10, 0x00, 0x80, 0x2c, 0x63,
+  0x4d, 0x9a, 0xdc, 0x91, 0x65, 0xb0, 0x42, 0x00, 0x00, 0xb2, 0x0c, 0xf6, 0x28, 0x05, 0x40, 0x96,
+  0xf1, 0x58, 0x21, 0x00, 0xc8, 0x32, 0x1e, 0x4b, 0x0e, 0x00, 0x59, 0xc6, 0x63, 0xc9, 0x1d, 0x20,
+  0xcb, 0x78, 0x8e, 0x00, 0x00, 0x64, 0x19, 0xcf, 0x1d, 0x00, 0x80, 0x2c, 0xe3, 0xb9, 0xf4, 0x2a,
+  0x93, 0x65, 0xbc, 0x58, 0x65, 0x06, 0xb2, 0x8c, 0x27, 0x03, 0x4d, 0x43, 0x96, 0xf1, 0x64, 0x21,
+  0x00, 0xc8, 0x32, 0x9e, 0x34, 0x95, 0x01, 0x59, 0xc6, 0xa3, 0xc9, 0x1d, 0x20, 0xcb, 0xa0, 0xc9,
+  0x1d, 0x00, 0x64, 0x19, 0x75, 0x24, 0x77, 0x80, 0x2c, 0xa3, 0xca, 0x42, 0x00, 0x90, 0x65, 0xd4,
+  0x59, 0x08, 0x00, 0xb2, 0x10, 0x00, 0x00, 0x00, 0x40, 0x16, 0x52, 0x00, 0x00, 0x00, 0xc8, 0x42,
+  0x0a, 0x49, 0xee, 0x00, 0x59, 0x48, 0x71, 0x04, 0x00, 0x20, 0x0b, 0x29, 0x32, 0xb9, 0x03, 0x64,
+  0x29, 0x81, 0x14, 0x02, 0x80, 0x2c, 0xa5, 0xb8, 0x42, 0x00, 0x90, 0xa5, 0x30, 0x9a, 0xdc, 0x01,
+  0xb2, 0x94, 0x16, 0x68, 0x72, 0x47, 0x96, 0xe2, 0x08, 0x00, 0x00, 0xc8, 0x52, 0x1c, 0x4d, 0xee,
+  0x00, 0x59, 0x8a, 0x0c, 0xb2, 0x10, 0x20, 0x4b, 0x91, 0x69, 0xa6, 0x01, 0x64, 0x29, 0x13, 0xa5,
+  0x01, 0x80, 0x2c, 0xa6, 0x00, 0x00, 0x00, 0x90, 0xc5, 0x94, 0xe0, 0x0e, 0x00, 0xb2, 0x98, 0x42,
+  0x00, 0x00, 0x40, 0x16, 0x53, 0x58, 0x21, 0x00, 0xc8, 0x62, 0x0a, 0x4b, 0xee, 0x00, 0x59, 0x4c,
+  0x71, 0x23, 0x30, 0x20, 0x8b, 0x29, 0x8e, 0x00, 0x00, 0x64, 0x31, 0xc5, 0x15, 0x02, 0x80, 0x2c,
+  0xa6, 0xb8, 0x03, 0x00, 0x90, 0xc5, 0x14, 0x97, 0xdc, 0x01, 0xb2, 0x98, 0xe2, 0x28, 0x00, 0x40,
+  0x16, 0x53, 0x1c, 0x2d, 0x04, 0xc8, 0x62, 0x8a, 0xa3, 0x29, 0x30, 0x59, 0x4c, 0x71, 0x34, 0x0d,
+  0x20, 0x8b, 0x29, 0x32, 0x50, 0x00, 0x64, 0x31, 0x45, 0x16, 0x02, 0x80, 0x2c, 0xa6, 0xc8, 0x32,
+  0x01, 0x90, 0xc5, 0x14, 0xe9, 0x68, 0x1a, 0xb2, 0x98, 0x22, 0x5f, 0x9d, 0x40, 0x16, 0x53, 0x66,
+  0x21, 0x00, 0xc8, 0x62, 0xca, 0x4c, 0xaf, 0x4e, 0x59, 0x4c, 0x99, 0x14, 0x00, 0x20, 0x8b, 0x29,
+  0x93, 0x96, 0x09, 0x64, 0x31, 0x65, 0xd2, 0x34, 0x80, 0x2c, 0xa6, 0x4c, 0x9a, 0xdc, 0x91, 0xc5,
+  0xa4, 0x20, 0x0b, 0x01, 0xb2, 0x98, 0x34, 0x82, 0x2c, 0x40, 0x16, 0x93, 0x46, 0x72, 0x14, 0xc8,
+  0x62, 0x18, 0x00, 0x00, 0x00, 0x59, 0x0c, 0x2b, 0x04, 0x00, 0x20, 0x8b, 0x61, 0x65, 0x16, 0x02,
+  0x64, 0x31, 0xec, 0x51, 0x00, 0x80, 0x2c, 0x86, 0x16, 0x47, 0x0b, 0x91, 0xc5, 0x50, 0xc4, 0x0a,
+  0x01, 0xb2, 0x18, 0x4a, 0x8b, 0x2c, 0x40, 0x16, 0x43, 0x33, 0x00, 0x00, 0xc8, 0x62, 0xaa, 0x03,
+  0x00, 0x00, 0x59, 0x4c, 0x95, 0x81, 0x01, 0x20, 0x8b, 0xa9, 0x32, 0xd0, 0x34, 0x64, 0x31, 0x55,
+  0x16, 0x02, 0x80, 0x2c, 0xa6, 0xce, 0x34, 0x00, 0x90, 0xc5, 0xd4, 0x49, 0x01, 0x00, 0xb2, 0x9c,
+  0xe2, 0xd2, 0x00, 0x40, 0x96, 0x53, 0x25, 0x01, 0x00, 0xc8, 0x72, 0xea, 0xa4, 0x00, 0x00, 0x59,
+  0x92, 0x23, 0x00, 0x00, 0x20, 0x4b, 0x9a, 0x34, 0x0d, 0x00, 0x64, 0x61, 0x81, 0x15, 0x00, 0x80,
+  0x2c, 0x2c, 0xb0, 0x42, 0x00, 0x90, 0x85, 0x85, 0x16, 0x68, 0x21, 0xb2, 0xb0, 0xe0, 0xd2, 0xab,
+  0x53, 0x16, 0x16, 0x64, 0xa0, 0x00, 0xc8, 0xc2, 0x82, 0x0c, 0x34, 0x0d, 0x59, 0x58, 0x90, 0x85,
+  0x00, 0x20, 0x0b, 0x0b, 0x34, 0xb9, 0x03, 0x64, 0x61, 0x23, 0x8d, 0xc0, 0x80, 0x2c, 0x6c, 0xa4,
+  0x99, 0x06, 0x90, 0x85, 0x8d, 0xd7, 0x0a, 0x01, 0xb2, 0xb0, 0x41, 0xd3, 0x00, 0x40, 0x16, 0x36,
+  0xaa, 0x2c, 0x04, 0xc8, 0xc2, 0x08, 0x00, 0x00, 0x00, 0x59, 0x18, 0x29, 0x04, 0x00, 0x20, 0x0b,
+  0x23, 0xc5, 0x54, 0x06, 0x64, 0x61, 0xa4, 0x38, 0x0a, 0x80, 0x2c, 0x8c, 0x14, 0x47, 0x0b, 0x90,
+  0x85, 0x91, 0x32, 0x29, 0x00, 0xb2, 0x30, 0x92, 0x06, 0x00, 0x40, 0x16, 0x46, 0xa4, 0x3b, 0x00,
+  0xc8, 0xc2, 0xc8, 0x2c, 0x04, 0x00, 0x59, 0x18, 0xc9, 0x00, 0x00, 0x20, 0x0b, 0x2b, 0x00, 0x00,
+  0x00, 0x64, 0x61, 0x85, 0x00, 0x00, 0x80, 0x2c, 0xac, 0xc8, 0x14, 0x18, 0x90, 0x85, 0x19, 0x53,
+  0x5f, 0x9d, 0xb2, 0x30, 0x63, 0xea, 0x9c, 0x40, 0x16, 0x66, 0x18, 0x00, 0x00, 0xc8, 0xc2, 0x0c,
+  0x4b, 0xee, 0x00, 0x59, 0x58, 0x0a, 0xf2, 0xd5, 0x29, 0x0b, 0x4b, 0x03, 0x00, 0x00, 0x64, 0x61,
+  0x69, 0x24, 0x07, 0x80, 0x2c, 0x2c, 0x0d, 0x9a, 0x1c, 0x95, 0x85, 0xa5, 0x53, 0x08, 0x00, 0xb2,
+  0xb0, 0xc4, 0x92, 0x2d, 0x44, 0x16, 0x96, 0x58, 0x06, 0x00, 0xc8, 0xc2, 0x92, 0x23, 0x00, 0x00,
+  0x59, 0x58, 0x72, 0x07, 0x00, 0x20, 0x0b, 0x4b, 0x2e, 0x05, 0x06, 0x64, 0x61, 0xc9, 0x25, 0x77,
+  0x80, 0x2c, 0x2c, 0xb9, 0xf4, 0x2a, 0x93, 0x85, 0x25, 0x97, 0xde, 0x75, 0xb2, 0xb0, 0x24, 0x03,
+  0x05, 0x40, 0x16, 0x96, 0x66, 0x1a, 0x00, 0xc8, 0xc2, 0xd2, 0x84, 0xc9, 0x1d, 0x59, 0x58, 0x9a,
+  0x34, 0x05, 0x26, 0x0b, 0x63, 0x04, 0x00, 0x00, 0x64, 0x61, 0xac, 0x00, 0x00, 0x80, 0x2c, 0x8c,
+  0x15, 0x02, 0x00, 0x90, 0x85, 0xb1, 0xe2, 0x0e, 0x00, 0xb2, 0x30, 0x96, 0x08, 0x00, 0x40, 0x16,
+  0xc6, 0x92, 0x3b, 0x00, 0xc8, 0xc2, 0x58, 0x72, 0x34, 0x0d, 0x59, 0x18, 0x4b, 0x93, 0xa6, 0x21,
+  0x0b, 0x63, 0x2c, 0x0d, 0x00, 0x64, 0x61, 0x8c, 0x25, 0x47, 0x81, 0x2c, 0x8c, 0xbd, 0x56, 0x00,
+  0x90, 0x85, 0xb1, 0x27, 0x0b, 0x01, 0xb2, 0x30, 0xf6, 0x68, 0x1a, 0x40, 0x16, 0xd6, 0x26, 0x4d,
+  0x03, 0xc8, 0xc2, 0xde, 0x08, 0xb2, 0x00, 0x59, 0xd8, 0x73, 0x07, 0x00, 0x20, 0x0b, 0x7b, 0x8e,
+  0x16, 0x02, 0x64, 0x61, 0x4f, 0xa6, 0x01, 0x80, 0x2c, 0xec, 0xc9, 0xe4, 0x28, 0x90, 0x85, 0x3d,
+  0xf9, 0xea, 0x04, 0xb2, 0xb0, 0x47, 0x9f, 0x03, 0x40, 0x16, 0x36, 0x5f, 0x65, 0x00, 0xc8, 0xc2,
+  0x26, 0x94, 0x85, 0x00, 0x59, 0xd8, 0x9c, 0x34, 0xb9, 0x23, 0x0b, 0x9b, 0xb4, 0x10, 0x00, 0x64,
+  0x61, 0xb4, 0x10, 0x00, 0x80, 0x2c, 0xac, 0x26, 0x77, 0x00, 0x90, 0x85, 0x55, 0x96, 0x06, 0x00,
+  0xb2, 0xb0, 0xea, 0x0a, 0x00, 0x40, 0x16, 0x56, 0x65, 0x21, 0x00, 0xc8, 0xc2, 0xaa, 0x34, 0x75,
+  0x02, 0x59, 0x5a, 0x60, 0xc9, 0x1d, 0x20, 0x4b, 0x0b, 0x8e, 0x00, 0x00, 0x64, 0x69, 0x82, 0x15,
+  0x02, 0x80, 0x2c, 0x4d, 0x54, 0x19, 0x18, 0x90, 0xa5, 0x15, 0x00, 0x00, 0x00, 0xb2, 0xb4, 0xe2,
+  0x08, 0x00, 0x40, 0x96, 0x56, 0xdc, 0x01, 0x00, 0xc8, 0xd2, 0xd2, 0x00, 0x00, 0x00, 0x59, 0x5a,
+  0x1a, 0xc9, 0x51, 0x20, 0x4b, 0x4b, 0x83, 0x26, 0x07, 0x64, 0x69, 0xc9, 0x0d, 0x00, 0x80, 0x2c,
+  0x2d, 0xb9, 0x03, 0x00, 0x90, 0xa5, 0xa5, 0x99, 0x01, 0x00, 0xb2, 0xb4, 0x37, 0xd3, 0x00, 0x40,
+  0x96, 0x06, 0x0b, 0x49, 0x03, 0xc8, 0xd2, 0x20, 0x2a, 0x04, 0x00, 0x59, 0x1a, 0x4c, 0x0e, 0x00,
+  0x20, 0x4b, 0x83, 0xc9, 0x1d, 0x00, 0x64, 0x69, 0x30, 0x39, 0x5a, 0x88, 0x2c, 0x0d, 0x3e, 0x47,
+  0xd3, 0x90, 0xc5, 0x05, 0x96, 0xdc, 0x01, 0xb2, 0xb8, 0xe0, 0x00, 0x00, 0x40, 0x16, 0x17, 0x64,
+  0x21, 0x00, 0xc8, 0xe2, 0x02, 0x05, 0x00, 0x00, 0x59, 0x5c, 0xa0, 0xe9, 0xd5, 0x29, 0x8b, 0x0b,
+  0x94, 0x01, 0x00, 0x64, 0x71, 0x04, 0x00, 0x00, 0x80, 0x2c, 0x8e, 0x08, 0x56, 0x08, 0x90, 0xc5,
+  0x91, 0x02, 0x00, 0x00, 0xb2, 0x38, 0x52, 0x08, 0x00, 0x40, 0x16, 0x47, 0x8a, 0x03, 0x00, 0xc8,
+  0xe2, 0x48, 0x71, 0xc9, 0x1d, 0x59, 0x1c, 0x29, 0x8e, 0x02, 0x20, 0x8b, 0x23, 0xe5, 0x55, 0x06,
+  0x64, 0x71, 0xa4, 0xc8, 0xe4, 0x8e, 0x2c, 0x8e, 0x14, 0xf9, 0xea, 0x94, 0xc5, 0x91, 0xe4, 0x0a,
+  0x01, 0xb2, 0x38, 0x92, 0xdc, 0x01, 0x40, 0x16, 0x47, 0x92, 0xa3, 0x69, 0xc8, 0xe2, 0x48, 0x9a,
+  0x29, 0x30, 0x59, 0x1c, 0x61, 0x05, 0x00, 0x20, 0x8b, 0x23, 0xb3, 0x10, 0x00, 0x64, 0x71, 0x24,
+  0x03, 0x00, 0x80, 0x2c, 0xae, 0x00, 0x00, 0x00, 0x90, 0xc5, 0x15, 0x02, 0x00, 0x00, 0xb2, 0xb8,
+  0xc2, 0x0a, 0x00, 0x40, 0x16, 0x57, 0x58, 0x21, 0x00, 0xc8, 0xe2, 0x0a, 0x4b, 0xee, 0x00, 0x59,
+  0x5c, 0x71, 0x81, 0x02, 0x20, 0x8b, 0x2b, 0x6e, 0x00, 0x00, 0x64, 0x71, 0xc5, 0x11, 0x00, 0x80,
+  0x2c, 0xae, 0xb8, 0x42, 0x00, 0x90, 0xc5, 0x15, 0x77, 0x00, 0x00, 0xb2, 0xb8, 0xe2, 0x4e, 0x21,
+  0x40, 0x16, 0x57, 0x5c, 0x1a, 0x00, 0xc8, 0xe2, 0x8a, 0x4b, 0xee, 0x00, 0x59, 0x5c, 0x71, 0x14,
+  0x00, 0x20, 0x8b, 0x2b, 0x8e, 0x26, 0x77, 0x64, 0x71, 0x45, 0x16, 0x02, 0x80, 0x2c, 0xae, 0xc8,
+  0x32, 0x11, 0x90, 0xc5, 0x15, 0x99, 0x1c, 0x2d, 0xb2, 0xb8, 0x22, 0xd3, 0xab, 0x4c, 0x16, 0x57,
+  0x26, 0x05, 0x00, 0xc8, 0xe2, 0xca, 0xa4, 0x69, 0x00, 0x59, 0x5c, 0x1a, 0xa8, 0x10, 0x20, 0x8b,
+  0x4b, 0x23, 0xb9, 0x03, 0x64, 0x71, 0x89, 0x00, 0x00, 0x80, 0x2c, 0x2e, 0x11, 0x06, 0x00, 0x90,
+  0xc5, 0x25, 0x47, 0x8b, 0xa3, 0xb2, 0xb8, 0xe4, 0x68, 0x72, 0x47, 0x16, 0x97, 0x5c, 0x06, 0x00,
+  0xc8, 0xe2, 0xd2, 0x2c, 0x92, 0x00, 0x59, 0x5c, 0x9a, 0xe9, 0xd5, 0x29, 0x8b, 0x4b, 0x33, 0x03,
+  0x00, 0x64, 0x71, 0xab, 0x10, 0x00, 0x80, 0x2c, 0xee, 0xb5, 0x42, 0x00, 0x90, 0xc5, 0x3d, 0x59,
+  0x00, 0x00, 0xb2, 0xb8, 0x27, 0x0b, 0x01, 0x40, 0x16, 0xf7, 0x24, 0x4d, 0x03, 0xc8, 0xe2, 0x1e,
+  0x05, 0x00, 0x00, 0x59, 0xdc, 0x44, 0x85, 0x00, 0x20, 0x8b, 0xa3, 0x85, 0x00, 0x00, 0x64, 0x71,
+  0xb4, 0xb8, 0x03, 0x80, 0x2c, 0x8e, 0xa2, 0xf4, 0xea, 0x94, 0x05, 0x06, 0x96, 0xdc, 0x01, 0xb2,
+  0xc0, 0x02, 0x00, 0x00, 0x40, 0x16, 0x58, 0x02, 0x03, 0x00, 0xc8, 0x02, 0x0b, 0x01, 0x00, 0x00,
+  0x59, 0x60, 0x71, 0x04, 0x00, 0x20, 0x0b, 0x2c, 0x32, 0xbd, 0x3a, 0x65, 0x81, 0x65, 0x16, 0x02,
+  0x80, 0x2c, 0xb0, 0xd0, 0x42, 0x00, 0x90, 0x05, 0xa6, 0x11, 0x28, 0x00, 0xb2, 0xc0, 0xe4, 0x0e,
+  0x00, 0x40, 0x16, 0x98, 0x1c, 0x05, 0x00, 0xc8, 0x02, 0xd3, 0xa4, 0xc9, 0x1d, 0x59, 0xa0, 0x2c,
+  0xee, 0x00, 0x20, 0x0b, 0x94, 0xc9, 0x51, 0x00, 0x64, 0x81, 0x34, 0x4d, 0x9a, 0x86, 0x2c, 0x32,
+  0x9c, 0x42, 0x00, 0x90, 0x45, 0x06, 0x56, 0xdc, 0x01, 0xb2, 0xc8, 0xc0, 0x92, 0x3b, 0x40, 0x16,
+  0x19, 0x1c, 0x01, 0x00, 0xc8, 0x22, 0x83, 0x3b, 0x00, 0x00, 0x59, 0x64, 0x70, 0xc9, 0x01, 0x20,
+  0x8b, 0x0c, 0x8e, 0x16, 0x02, 0x64, 0x91, 0x41, 0x16, 0x02, 0x80, 0x2c, 0x52, 0xb0, 0x42, 0x00,
+  0x90, 0x45, 0x8e, 0x20, 0x0b, 0x01, 0xb2, 0xc8, 0x81, 0xd2, 0x00, 0x40, 0x16, 0x49, 0x00, 0x00,
+  0x00, 0xc8, 0x22, 0x49, 0x99, 0x85, 0x00, 0x59, 0x24, 0x49, 0x13, 0x15, 0x22, 0x8b, 0x24, 0x19,
+  0x00, 0x00, 0x64, 0x91, 0x05, 0x00, 0x00, 0x80, 0x2c, 0xb2, 0x04, 0x02, 0x00, 0x90, 0x45, 0x16,
+  0x02, 0x00, 0x00, 0xb2, 0xc8, 0xc2, 0x0a, 0x01, 0x40, 0x16, 0x59, 0x5c, 0x21, 0x00, 0xc8, 0x22,
+  0x8b, 0x3b, 0x00, 0x00, 0x59, 0x64, 0x71, 0x93, 0x16, 0x22, 0x8b, 0x2c, 0x8e, 0x02, 0x00, 0x64,
+  0x91, 0xc5, 0xd1, 0xe2, 0x8e, 0x2c, 0xb2, 0x38, 0x9a, 0x06, 0x90, 0x45, 0x16, 0x47, 0x93, 0x3b,
+  0xb2, 0xc8, 0x22, 0x0b, 0x01, 0x40, 0x16, 0x59, 0xa4, 0xa9, 0x0c, 0xc8, 0x22, 0x8b, 0x4c, 0x81,
+  0x01, 0x59, 0x64, 0x91, 0x69, 0x00, 0x20, 0x8b, 0x2c, 0xf2, 0xc1, 0x34, 0x64, 0x91, 0x65, 0xd2,
+  0x42, 0x80, 0x2c, 0xf2, 0x14, 0x02, 0x00, 0x90, 0x45, 0xa6, 0x20, 0x5f, 0x65, 0xb2, 0xc8, 0x14,
+  0x68, 0x1a, 0x40, 0x16, 0x99, 0x06, 0x2a, 0x04, 0xc8, 0x22, 0xd3, 0x48, 0xae, 0x10, 0x59, 0x64,
+  0x22, 0x00, 0x00, 0x20, 0x8b, 0x4c, 0x0e, 0x00, 0x00, 0x64, 0x91, 0xc9, 0x11, 0x00, 0x80, 0x2c,
+  0x32, 0xb9, 0x03, 0x00, 0x90, 0x45, 0x26, 0x77, 0x0a, 0x01, 0xb2, 0xc8, 0xe4, 0xd2, 0x00, 0x40,
+  0x16, 0x99, 0x1c, 0x05, 0x00, 0xc8, 0x22, 0x93, 0xa3, 0xc9, 0x1d, 0x59, 0x64, 0x92, 0x85, 0x00,
+  0x20, 0x8b, 0x4c, 0x33, 0x03, 0x00, 0x64, 0x91, 0x2c, 0x11, 0x00, 0x80, 0x2c, 0x92, 0x3d, 0x57,
+  0x08, 0x90, 0x45, 0xb6, 0xc0, 0x0a, 0x01, 0xb2, 0xc8, 0x56, 0x00, 0x00, 0x40, 0x16, 0xd9, 0xd2,
+  0x4c, 0xee, 0xc8, 0x22, 0x1d, 0x4d, 0xee, 0x00, 0x59, 0xe4, 0x6b, 0x05, 0x00, 0x20, 0x8b, 0x7c,
+  0xed, 0xb9, 0x03, 0x64, 0x91, 0x4f, 0x06, 0x06, 0x80, 0x2c, 0xf2, 0xc9, 0xe0, 0x28, 0x90, 0x45,
+  0x3e, 0x19, 0x28, 0x00, 0xb2, 0xc8, 0x27, 0x09, 0x00, 0x40, 0x16, 0xf9, 0x64, 0x21, 0x00, 0xc8,
+  0x22, 0xdf, 0x2c, 0x04, 0x00, 0x59, 0xa4, 0x7c, 0xb2, 0x10, 0x20, 0x8b, 0xa4, 0x41, 0x16, 0x02,
+  0x64, 0x91, 0xb4, 0x00, 0x00, 0x80, 0x2c, 0x92, 0x16, 0x02, 0x00, 0x90, 0x45, 0xd2, 0x22, 0x93,
+  0x3b, 0xb2, 0x48, 0x5a, 0xe4, 0xab, 0x4c, 0x16, 0x49, 0x4d, 0x9d, 0x00, 0xc8, 0x22, 0x69, 0x22,
+  0x00, 0x00, 0x59, 0x24, 0x4d, 0x07, 0x00, 0x20, 0x8b, 0xa4, 0x89, 0x26, 0x77, 0x64, 0x91, 0xf4,
+  0xb5, 0x42, 0x80, 0x2c, 0x92, 0x66, 0x00, 0x00, 0x90, 0x45, 0x56, 0x59, 0x08, 0x00, 0xb2, 0x48,
+  0x1b, 0x28, 0x00, 0x40, 0x96, 0x39, 0xaa, 0x2c, 0x04, 0xc8, 0x32, 0x0b, 0x00, 0x00, 0x00, 0x59,
+  0x66, 0x91, 0xc9, 0x51, 0x20, 0xcb, 0x2c, 0x32, 0x39, 0x5a, 0x64, 0x99, 0x08, 0x00, 0x00, 0x80,
+  0x2c, 0x13, 0x15, 0x00, 0x00, 0x90, 0x65, 0xa2, 0x42, 0x00, 0x00, 0xb2, 0x4c, 0x54, 0x1c, 0x00,
+  0x40, 0x96, 0x89, 0x8a, 0x3b, 0x00, 0xc8, 0x32, 0x51, 0x71, 0x29, 0x30, 0x59, 0x26, 0x4a, 0xee,
+  0x00, 0x20, 0xcb, 0x44, 0xc9, 0xd1, 0x42, 0x64, 0x99, 0xe8, 0xb5, 0x0c, 0x80, 0x2c, 0x13, 0x51,
+  0x00, 0x00, 0x90, 0x65, 0x22, 0x9a, 0x06, 0x00, 0xb2, 0xcc, 0x34, 0xd2, 0x00, 0x40, 0x96, 0x99,
+  0x1c, 0x01, 0x00, 0xc8, 0x32, 0xdf, 0x48, 0x03, 0x00, 0x59, 0xe6, 0x23, 0xac, 0x10, 0x20, 0xcb,
+  0x7c, 0xac, 0x10, 0x00, 0x64, 0x99, 0xcf, 0xd1, 0xe4, 0x8e, 0x2c, 0xf3, 0xc9, 0xe4, 0x28, 0x90,
+  0x65, 0xc2, 0x02, 0x00, 0x00, 0xb2, 0x4c, 0x58, 0x08, 0x00, 0x40, 0x96, 0x09, 0x0b, 0x49, 0xb6,
+  0xc8, 0x32, 0x61, 0x71, 0x81, 0x01, 0x59, 0x26, 0x2c, 0xf2, 0xd5, 0x29, 0xcb, 0x84, 0x08, 0x00,
+  0x00, 0x64, 0x99, 0x10, 0x95, 0x39, 0xa7, 0x2c, 0x13, 0xa6, 0x11, 0x18, 0x90, 0x65, 0xc2, 0x44,
+  0x00, 0x00, 0xb2, 0x4c, 0x98, 0x4c, 0x9d, 0x53, 0x96, 0x09, 0x93, 0x23, 0x00, 0xc8, 0x32, 0x61,
+  0x72, 0x07, 0x00, 0x59, 0x26, 0x4c, 0x8e, 0x02, 0x20, 0xcb, 0x84, 0x69, 0xd2, 0x42, 0x64, 0x99,
+  0xf0, 0xb9, 0xc0, 0x80, 0x2c, 0x13, 0x3e, 0x77, 0x00, 0x90, 0x65, 0xc2, 0x57, 0xe7, 0x04, 0xb2,
+  0x4c, 0x38, 0x59, 0x21, 0x40, 0x96, 0x09, 0x29, 0x00, 0x00, 0xc8, 0x32, 0x21, 0x2d, 0xb2, 0x10,
+  0x59, 0x26, 0xa4, 0xc9, 0x15, 0x20, 0xcb, 0x84, 0x94, 0x15, 0x02, 0x64, 0x99, 0x30, 0x03, 0x00,
+  0x80, 0x2c, 0x73, 0x22, 0x06, 0x00, 0x90, 0x65, 0xce, 0xe7, 0x28, 0x00, 0xb2, 0xcc, 0x39, 0x0b,
+  0x01, 0x40, 0x96, 0x39, 0x69, 0x01, 0x00, 0xc8, 0x32, 0x27, 0x4d, 0x03, 0x00, 0x59, 0xe6, 0xa4,
+  0xac, 0x00, 0x20, 0xcb, 0xa4, 0x00, 0x00, 0x00, 0x64, 0x99, 0x34, 0xb0, 0x02, 0x80, 0x2c, 0x93,
+  0x06, 0x47, 0x0b, 0x91, 0x65, 0xd2, 0x20, 0x93, 0x3b, 0xb2, 0x4c, 0x1a, 0x68, 0x72, 0x54, 0x96,
+  0x49, 0x0b, 0x00, 0x00, 0xc8, 0x32, 0x69, 0x21, 0x00, 0x00, 0x59, 0x26, 0x2d, 0xa6, 0x32, 0x20,
+  0xcb, 0xa4, 0xc5, 0x01, 0x00, 0x64, 0x99, 0xb4, 0xb8, 0xe0, 0x80, 0x2c, 0x93, 0x16, 0x77, 0x00,
+  0x90, 0x65, 0xd2, 0xe2, 0x92, 0x3b, 0xb2, 0x4c, 0x5a, 0x1c, 0x05, 0x40, 0x96, 0x49, 0x8b, 0xa3,
+  0x85, 0xc8, 0x32, 0x69, 0x71, 0x34, 0x0d, 0x59, 0x26, 0x2d, 0x32, 0x30, 0x20, 0xcb, 0xa4, 0x45,
+  0x16, 0x02, 0x64, 0x99, 0xb4, 0xc8, 0x32, 0xa7, 0x2c, 0x93, 0x16, 0x99, 0x06, 0x90, 0x65, 0xd2,
+  0x22, 0x93, 0xa3, 0xb2, 0x4c, 0x5a, 0xe4, 0xab, 0x53, 0x96, 0x49, 0x4d, 0x7d, 0x75, 0xca, 0x32,
+  0xa9, 0xa9, 0x13, 0x00, 0x59, 0x26, 0x45, 0x00, 0x00, 0x20, 0xcb, 0xa4, 0xa8, 0x00, 0x00, 0x64,
+  0x99, 0x14, 0x15, 0x02, 0x80, 0x2c, 0x93, 0xa2, 0x32, 0x27, 0x90, 0x65, 0x52, 0x64, 0xea, 0x04,
+  0xb2, 0x4c, 0x8a, 0xd2, 0x00, 0x40, 0x96, 0x49, 0x51, 0x72, 0x07, 0xc8, 0x32, 0x29, 0x4a, 0x8e,
+  0x16, 0x59, 0x26, 0x45, 0xe9, 0xd5, 0x29, 0xcb, 0xa4, 0x88, 0x01, 0x00, 0x64, 0x99, 0x14, 0x51,
+  0x00, 0x80, 0x2c, 0x93, 0xa2, 0x0c, 0x00, 0x90, 0x65, 0xd2, 0x24, 0x92, 0x3b, 0xb2, 0x4c, 0x9a,
+  0x06, 0x00, 0x40, 0x96, 0x49, 0xd3, 0x08, 0xee, 0xc8, 0x32, 0x69, 0x22, 0x00, 0x00, 0x59, 0x26,
+  0x4d, 0xa6, 0x32, 0x20, 0xcb, 0xa4, 0xe9, 0x00, 0x00, 0x64, 0x99, 0x34, 0xb1, 0x32, 0xa7, 0x2c,
+  0x93, 0x26, 0x07, 0x00, 0x90, 0x65, 0xd2, 0xe4, 0x02, 0x03, 0xb2, 0x4c, 0x9a, 0x5c, 0x21, 0x40,
+  0x96, 0x49, 0x93, 0x3b, 0x00, 0xc8, 0x32, 0x69, 0x72, 0x69, 0x00, 0x59, 0x26, 0x4d, 0x8e, 0x02,
+  0x20, 0xcb, 0xa4, 0xc9, 0xd1, 0x42, 0x64, 0x99, 0x34, 0x39, 0x9a, 0x86, 0x2c, 0x93, 0xa6, 0x57,
+  0x27, 0x90, 0x65, 0xd2, 0x34, 0x0b, 0x01, 0xb2, 0x4c, 0x9a, 0x26, 0x2a, 0x40, 0x96, 0x49, 0xd3,
+  0x4c, 0x03, 0xc8, 0x32, 0x69, 0x9a, 0xc9, 0x1d, 0x59, 0x26, 0x4d, 0x33, 0x39, 0x2a, 0xcb, 0xa4,
+  0x69, 0x52, 0x00, 0x64, 0x99, 0x34, 0x4d, 0x5a, 0x88, 0x2c, 0x93, 0x26, 0x9a, 0x02, 0x93, 0x65,
+  0xd2, 0x44, 0x93, 0x03, 0xb2, 0x4c, 0x9a, 0x68, 0x72, 0x47, 0x96, 0x49, 0x13, 0x95, 0x00, 0xc8,
+  0x32, 0x29, 0x2b, 0x04, 0x00, 0x59, 0x26, 0x65, 0x69, 0x04, 0x26, 0xcb, 0xa4, 0x2c, 0xbd, 0x3a,
+  0x65, 0x99, 0x94, 0x25, 0x5b, 0x80, 0x2c, 0x93, 0xb2, 0x0c, 0x00, 0x90, 0x65, 0xd2, 0xd7, 0x0a,
+  0x01, 0xb2, 0x4c, 0xfa, 0x1c, 0x2d, 0x44, 0x96, 0x49, 0x5f, 0x9d, 0x13, 0xc8, 0x32, 0xe9, 0xb3,
+  0x85, 0x00, 0x59, 0x26, 0x95, 0xc1, 0x1d, 0x20, 0xcb, 0xa4, 0xb3, 0x10, 0x00, 0x64, 0x99, 0x94,
+  0x16, 0x02, 0x80, 0x2c, 0x93, 0x56, 0x56, 0x08, 0x90, 0x65, 0xd2, 0x2a, 0xd3, 0x00, 0xb2, 0x4c,
+  0x5a, 0x65, 0x72, 0x47, 0x96, 0x49, 0xab, 0x7c, 0x75, 0xca, 0x32, 0x69, 0x06, 0x00, 0x00, 0x59,
+  0x66, 0x65, 0x85, 0x00, 0x20, 0xcb, 0xac, 0x2e, 0xb0, 0x02, 0x64, 0x99, 0x55, 0x06, 0x77, 0x80,
+  0x2c, 0xb3, 0x4a, 0x02, 0x00, 0x90, 0x65, 0x56, 0x59, 0x08, 0x00, 0xb2, 0xcc, 0x2a, 0xd3, 0x00,
+  0x40, 0x96, 0x59, 0x65, 0x06, 0x00, 0xc8, 0x32, 0xeb, 0x2c, 0x04, 0x00, 0x59, 0x66, 0x9d, 0xb4,
+  0x10, 0x20, 0x0b, 0x0d, 0x2c, 0xb9, 0x03, 0x64, 0xa1, 0xa8, 0x00, 0x00, 0x80, 0x2c, 0x14, 0x15,
+  0x99, 0xdc, 0x91, 0x85, 0xa2, 0x44, 0x00, 0x00, 0xb2, 0x50, 0x44, 0x93, 0x03, 0x40, 0x16, 0x9a,
+  0x1c, 0x01, 0x00, 0xc8, 0x62, 0x0b, 0x00, 0x00, 0x00, 0x59, 0x6c, 0x19, 0x81, 0x16, 0x22, 0x8b,
+  0x2d, 0x04, 0x00, 0x00, 0x64, 0xb1, 0xc5, 0x54, 0x47, 0x8b, 0x2c, 0xb6, 0x38, 0x02, 0x00, 0x90,
+  0xc5, 0x16, 0x77, 0x18, 0x00, 0xb2, 0xd8, 0x22, 0x83, 0x03, 0x40, 0x16, 0x5b, 0x64, 0x70, 0x07,
+  0xc8, 0x62, 0x8b, 0x0c, 0xb2, 0x10, 0x59, 0x6c, 0x91, 0x85, 0x00, 0x20, 0x8b, 0x4d, 0x23, 0xb9,
+  0x03, 0x64, 0xb1, 0xc9, 0x51, 0x00, 0x80, 0x2c, 0x37, 0xd0, 0x34, 0x00, 0x90, 0xe5, 0x3a, 0x9a,
+  0x06, 0x00, 0x32, 0x89, 0x27, 0x0b, 0x00, 0x40, 0xa6, 0x11, 0x58, 0x7a, 0x75, 0xca, 0x34, 0x0a,
+  0x01, 0x00, 0x00, 0x99, 0x48, 0x91, 0x04, 0x00, 0x20, 0xd3, 0x29, 0xae, 0x10, 0x00, 0x64, 0x3a,
+  0xc5, 0xd1, 0x42, 0x80, 0x4c, 0xe7, 0x3c, 0x59, 0x08, 0x90, 0xe9, 0xa0, 0xe0, 0x00, 0x00, 0x32,
+  0x1d, 0x54, 0x08, 0x00, 0x40, 0xa6, 0x83, 0x92, 0xa3, 0x85, 0xc8, 0x74, 0xd2, 0x44, 0x69, 0x00,
+  0x99, 0xce, 0x6b, 0x85, 0x00, 0x20, 0xd3, 0x79, 0xb2, 0x10, 0x00, 0x64, 0x3a, 0x55, 0xa6, 0x01,
+  0x80, 0x4c, 0x2c, 0xc8, 0x42, 0x00, 0x90, 0x89, 0x11, 0x00, 0x00, 0x00, 0x32, 0x31, 0x52, 0x64,
+  0x60, 0x40, 0x26, 0x46, 0x92, 0x03, 0x00, 0xc8, 0xc4, 0xd2, 0x48, 0xee, 0x00, 0x99, 0x58, 0x3a,
+  0x69, 0x00, 0x20, 0x13, 0x63, 0x65, 0x4e, 0x00, 0x64, 0x62, 0xcf, 0x11, 0x00, 0x80, 0x4c, 0xac,
+  0xca, 0xc0, 0x00, 0x90, 0xc9, 0x05, 0x96, 0x9e, 0x03, 0x32, 0xb9, 0xe0, 0x0e, 0x00, 0x40, 0x26,
+  0x47, 0x00, 0x00, 0x00, 0xc8, 0xe4, 0x48, 0x21, 0x00, 0x00, 0x99, 0x1c, 0x29, 0x0e, 0x00, 0x20,
+  0x93, 0x23, 0xe5, 0xb9, 0x03, 0x64, 0x72, 0x24, 0xb9, 0x03, 0x80, 0x4c, 0x8e, 0x24, 0x47, 0x01,
+  0x90, 0xc9, 0x91, 0x34, 0x93, 0x3b, 0x32, 0x39, 0x92, 0x26, 0x2d, 0x44, 0x26, 0x47, 0x18, 0x00,
+  0x00, 0xc8, 0xe4, 0x08, 0x94, 0x85, 0x00, 0x99, 0x5c, 0x01, 0x00, 0x00, 0x20, 0x93, 0x2b, 0x04,
+  0x00, 0x00, 0x64, 0x72, 0x85, 0xa5, 0x01, 0x80, 0x4c, 0xae, 0x38, 0x00, 0x00, 0x90, 0xc9, 0x15,
+  0x47, 0x00, 0x00, 0x32, 0xb9, 0xe2, 0x0e, 0x00, 0x40, 0x26, 0x57, 0x5c, 0x72, 0x07, 0xc8, 0xe4,
+  0x8a, 0x2c, 0x04, 0x00, 0x99, 0x5c, 0x91, 0x69, 0x00, 0x20, 0x93, 0x2b, 0xb3, 0x10, 0x00, 0x64,
+  0x72, 0xa7, 0x38, 0x00, 0x80, 0x4c, 0xee, 0x14, 0x47, 0xd3, 0x90, 0xc9, 0x9d, 0x22, 0x0b, 0x01,
+  0x32, 0xb9, 0x34, 0x10, 0x4d, 0x43, 0x26, 0x97, 0x46, 0x1a, 0x00, 0xc8, 0xe4, 0xd2, 0xa0, 0x85,
+  0x00, 0x99, 0x5c, 0x22, 0x00, 0x00, 0x20, 0x93, 0x4b, 0xb2, 0x10, 0x00, 0x64, 0x72, 0x4f, 0x16,
+  0x02, 0x80, 0x4c, 0xee, 0x55, 0x99, 0x01, 0x90, 0xc9, 0xcd, 0x99, 0xdc, 0x01, 0x32, 0xb9, 0x49,
+  0xd3, 0xab, 0x53, 0x26, 0x47, 0x01, 0x00, 0x00, 0xc8, 0xe4, 0x68, 0x60, 0x85, 0x00, 0x99, 0x1e,
+  0x45, 0xc9, 0x1d, 0x20, 0x13, 0x2c, 0x0e, 0x00, 0x00, 0x64, 0x92, 0xc1, 0x1d, 0x00, 0x80, 0x4c,
+  0x92, 0x14, 0x02, 0x00, 0x90, 0x49, 0x16, 0x96, 0x56, 0x21, 0x32, 0xc9, 0xe2, 0x0e, 0x00, 0x40,
+  0x26, 0x59, 0x5c, 0x7a, 0x75, 0xca, 0x24, 0xd3, 0x08, 0xee, 0x00, 0x99, 0x64, 0x9a, 0x14, 0x00,
+  0x20, 0x93, 0x4c, 0xb4, 0x10, 0x00, 0x64, 0x92, 0x89, 0x26, 0x47, 0x81, 0x4c, 0x92, 0x16, 0x02,
+  0x00, 0x90, 0x69, 0xa2, 0x42, 0x00, 0x00, 0x32, 0xcd, 0x99, 0x5c, 0x21, 0x40, 0xa6, 0x49, 0x8b,
+  0x3b, 0x00, 0xc8, 0x34, 0x69, 0x91, 0x69, 0x00, 0x99, 0x26, 0x2d, 0x93, 0x02, 0x20, 0xd3, 0xa4,
+  0x28, 0x0d, 0x00, 0x64, 0x9a, 0x34, 0x11, 0x00, 0x80, 0x4c, 0x93, 0x26, 0x17, 0xdc, 0x91, 0x69,
+  0xd2, 0xe4, 0x0e, 0x00, 0x32, 0x4d, 0x9a, 0x5e, 0x65, 0x40, 0xa6, 0x49, 0xd3, 0x4c, 0xab, 0xc8,
+  0x34, 0x69, 0x9a, 0xc9, 0x01, 0x99, 0x26, 0x4d, 0x93, 0x02, 0x20, 0xd3, 0xa4, 0xac, 0x10, 0x00,
+  0x64, 0xa2, 0x61, 0x65, 0x00, 0x80, 0x4c, 0x34, 0x38, 0x5a, 0x08, 0x90, 0x89, 0x16, 0x99, 0x06,
+  0x00, 0x32, 0x51, 0x14, 0x68, 0x72, 0x40, 0x26, 0x8a, 0x0a, 0x00, 0x00, 0xc8, 0x44, 0x51, 0x21,
+  0x00, 0x00, 0x99, 0x28, 0x4a, 0xee, 0x00, 0x20, 0x13, 0x45, 0xe9, 0x55, 0x06, 0x64, 0xa2, 0x69,
+  0x04, 0x0a, 0x80, 0x4c, 0x34, 0x4d, 0x0a, 0x00, 0x90, 0x89, 0x26, 0x5a, 0x08, 0x00, 0x32, 0x51,
+  0xe9, 0x4e, 0x21, 0x40, 0x26, 0x5a, 0x65, 0x21, 0x00, 0xc8, 0x44, 0xab, 0x4c, 0x13, 0x00, 0x99,
+  0x6c, 0x01, 0x00, 0x00, 0x20, 0x93, 0x2d, 0x04, 0x00, 0x00, 0x64, 0xb2, 0x85, 0x15, 0x02, 0x80,
+  0x4c, 0xb6, 0xb8, 0x03, 0x00, 0x90, 0xc9, 0x16, 0x77, 0x0a, 0x01, 0x32, 0xd9, 0xe2, 0xd2, 0x00,
+  0x40, 0x26, 0x5b, 0x64, 0x21, 0x00, 0xc8, 0xa4, 0x83, 0x60, 0x85, 0x00, 0x99, 0x74, 0xa0, 0xe9,
+  0xd5, 0x29, 0x93, 0x2e, 0x8e, 0x16, 0x00, 0x64, 0xd2, 0x3a, 0x39, 0x9a, 0x86, 0x4c, 0x5a, 0xa7,
+  0x49, 0xd3, 0x90, 0x4f, 0xb0, 0x02, 0x00, 0x00, 0xf2, 0xa1, 0x64, 0x0b, 0x01, 0x40, 0x3e, 0x46,
+  0x8a, 0x3b, 0x00, 0xc8, 0xc7, 0x48, 0x22, 0x00, 0x00, 0xf9, 0x18, 0x49, 0xee, 0x00, 0x20, 0x1f,
+  0x4b, 0x8e, 0x00, 0x00, 0xe4, 0x63, 0x89, 0x66, 0x00, 0x80, 0x7c, 0x8c, 0x15, 0x02, 0x00, 0x90,
+  0x8f, 0xb1, 0x22, 0x0b, 0x01, 0xf2, 0xb1, 0x56, 0x1c, 0x05, 0x40, 0x3e, 0xf6, 0x64, 0x21, 0x00,
+  0xc8, 0xd7, 0x8a, 0x3b, 0x05, 0x00, 0xf9, 0x5a, 0x62, 0x00, 0x00, 0x20, 0x5f, 0x83, 0xcf, 0x01,
+  0x00, 0xe4, 0x6b, 0x90, 0x16, 0x02, 0x80, 0x7c, 0x0d, 0x66, 0x00, 0x00, 0x90, 0xcf, 0x11, 0x00,
+  0x00, 0x00, 0xf2, 0x39, 0x52, 0x08, 0x00, 0x40, 0x3e, 0x47, 0x8a, 0x2c, 0x04, 0xc8, 0xe7, 0xc8,
+  0x2d, 0x04, 0x00, 0xf9, 0x5c, 0x71, 0x34, 0x39, 0x20, 0x9f, 0x3b, 0xc5, 0x05, 0x06, 0xe4, 0x73,
+  0xc9, 0x51, 0x00, 0x80, 0x7c, 0x8e, 0x26, 0x47, 0x0b, 0x91, 0xef, 0x05, 0x97, 0x1c, 0x05, 0xf2,
+  0x3d, 0x53, 0x65, 0x21, 0x40, 0xbe, 0xe7, 0x68, 0x21, 0x00, 0xc8, 0xf7, 0x64, 0x60, 0xc9, 0x1d,
+  0xf9, 0x9e, 0x2c, 0x04, 0x00, 0x20, 0xdf, 0x93, 0x8f, 0x26, 0x07, 0xe4, 0x83, 0x34, 0xb0, 0x42,
+  0x80, 0x7c, 0x32, 0x8c, 0xc0, 0x00, 0x90, 0x4f, 0x86, 0x11, 0x68, 0x21, 0xf2, 0xc9, 0x11, 0x68,
+  0x21, 0x40, 0x3e, 0x39, 0x8a, 0x3b, 0x00, 0xc8, 0x27, 0x09, 0x00, 0x00, 0x00, 0xf9, 0x24, 0x29,
+  0x32, 0x30, 0x20, 0x9f, 0x2c, 0x00, 0x00, 0x00, 0xe4, 0x93, 0x25, 0x38, 0x0a, 0x80, 0x7c, 0xb2,
+  0x10, 0x00, 0x00, 0x90, 0x4f, 0x16, 0x47, 0x00, 0x00, 0xf2, 0xc9, 0xe2, 0x0e, 0x00, 0x40, 0x3e,
+  0x59, 0x1c, 0x4d, 0x8e, 0xca, 0x27, 0x8b, 0x0c, 0x8e, 0x02, 0xf9, 0x64, 0x91, 0x05, 0x00, 0x20,
+  0x9f, 0x2c, 0xb2, 0x10, 0x00, 0xe4, 0x93, 0x45, 0xbe, 0x3a, 0x81, 0x7c, 0xb2, 0xcc, 0x42, 0x00,
+  0x90, 0x4f, 0x96, 0x49, 0xd3, 0x00, 0xf2, 0xc9, 0x14, 0xe4, 0xab, 0x53, 0x3e, 0x99, 0x46, 0x60,
+  0x00, 0xc8, 0x27, 0xd3, 0x08, 0x14, 0x00, 0xf9, 0x64, 0x1a, 0xc9, 0x1d, 0x20, 0x9f, 0x4c, 0x04,
+  0x00, 0x00, 0xe4, 0x93, 0xc9, 0x11, 0x00, 0x80, 0x7c, 0x32, 0xb9, 0x03, 0x00, 0x90, 0x4f, 0x26,
+  0x97, 0x5c, 0x01, 0xf2, 0xc9, 0xe4, 0x28, 0x00, 0x40, 0x3e, 0x99, 0x1c, 0x4d, 0x81, 0xc9, 0x27,
+  0x93, 0xa3, 0xc9, 0x16, 0xf9, 0x64, 0x7a, 0x75, 0x02, 0x20, 0x9f, 0x4c, 0x33, 0x0d, 0x00, 0xe4,
+  0x93, 0x69, 0x26, 0x77, 0x80, 0x7c, 0x32, 0xcd, 0xf4, 0xea, 0x94, 0x4f, 0xa6, 0x49, 0x93, 0x3b,
+  0xf2, 0xc9, 0x56, 0x08, 0x00, 0x40, 0x3e, 0xd9, 0x0a, 0x29, 0x04, 0xc8, 0x27, 0x5b, 0x72, 0x07,
+  0x00, 0xf9, 0x64, 0x7b, 0xad, 0x10, 0x20, 0x9f, 0x7c, 0x2d, 0x30, 0x00, 0xe4, 0x93, 0xaf, 0xbd,
+  0xca, 0x80, 0x7c, 0xf2, 0x49, 0x02, 0x00, 0x90, 0x4f, 0x3e, 0x59, 0x48, 0x01, 0xf2, 0xc9, 0x27,
+  0x5f, 0x9d, 0x53, 0x3e, 0x29, 0x83, 0x03, 0x00, 0xc8, 0x27, 0x65, 0x21, 0x00, 0x00, 0xf9, 0x24,
+  0x2d, 0x04, 0x00, 0x20, 0x9f, 0xa4, 0xc9, 0xd1, 0x02, 0xe4, 0x93, 0x34, 0x3d, 0x49, 0x80, 0x7c,
+  0x92, 0x56, 0x59, 0x08, 0x90, 0x4f, 0x56, 0x56, 0x08, 0x00, 0xf2, 0x49, 0x5b, 0x00, 0x00, 0x40,
+  0x3e, 0x99, 0x01, 0x00, 0x00, 0xc8, 0x47, 0x93, 0xa3, 0xc9, 0x1d, 0xf9, 0xea, 0x48, 0xee, 0x00,
+  0x20, 0x5f, 0x75, 0x04, 0x00, 0x00, 0xe4, 0xab, 0x8e, 0x16, 0x02, 0x80, 0x7c, 0x55, 0x16, 0x02,
+  0x00, 0x90, 0xcf, 0x16, 0x02, 0x00, 0x00, 0xf2, 0xe1, 0x2a, 0x03, 0x03, 0x40, 0x56, 0x91, 0x68,
+  0x7a, 0x75, 0xca, 0x2a, 0x2e, 0x2b, 0x04, 0x00, 0x59, 0x47, 0x71, 0x04, 0x00, 0x20, 0xeb, 0x48,
+  0x23, 0x0d, 0x00, 0x64, 0x4d, 0xec, 0xc9, 0x42, 0x80, 0xac, 0xc9, 0x0d, 0x54, 0x26, 0x90, 0x35,
+  0xb9, 0x81, 0x92, 0xa3, 0xb2, 0x26, 0x47, 0x0b, 0x00, 0x40, 0x56, 0x46, 0x00, 0x00, 0x00, 0xc8,
+  0xca, 0x58, 0x91, 0xc9, 0x1d, 0x59, 0xd9, 0x6b, 0xc9, 0x1d, 0x20, 0xab, 0x23, 0x00, 0x00, 0x00,
+  0x64, 0x75, 0xa4, 0x10, 0x00, 0x80, 0xac, 0xae, 0xc8, 0xe0, 0x00, 0x90, 0xd5, 0x3d, 0x47, 0x93,
+  0x3b, 0xb2, 0xc2, 0x30, 0xd2, 0x00, 0x40, 0x56, 0x98, 0x08, 0x00, 0x00, 0xc8, 0x0a, 0x1f, 0x4b,
+  0xee, 0x00, 0x59, 0x65, 0x60, 0x85, 0x00, 0x20, 0xab, 0x0c, 0xee, 0x14, 0x02, 0x64, 0x95, 0xc1,
+  0xd1, 0x42, 0x80, 0xac, 0x52, 0x04, 0x07, 0x00, 0x90, 0x55, 0x0a, 0x96, 0x0a, 0x01, 0xb2, 0x4a,
+  0x02, 0x00, 0x00, 0x40, 0x56, 0x49, 0x12, 0x01, 0x00, 0xc8, 0x2a, 0x0b, 0x00, 0x00, 0x00, 0x59,
+  0x65, 0x21, 0x00, 0x00, 0x20, 0xab, 0x2c, 0xac, 0x10, 0x00, 0x64, 0x95, 0xc5, 0x25, 0x77, 0x80,
+  0xac, 0xb2, 0x38, 0x5a, 0x08, 0x90, 0x55, 0x16, 0x47, 0x93, 0x3b, 0xb2, 0xca, 0x22, 0x83, 0x3b,
+  0x40, 0x56, 0x59, 0x64, 0x70, 0xb4, 0xc8, 0x2a, 0xd3, 0x08, 0xb2, 0x00, 0x59, 0x65, 0x1a, 0xe9,
+  0xd5, 0x29, 0xab, 0x4c, 0x04, 0x00, 0x00, 0x64, 0x95, 0xc9, 0x1d, 0x00, 0x80, 0xac, 0x32, 0xc9,
+  0x40, 0xd3, 0x90, 0x55, 0xa6, 0x99, 0xdc, 0x01, 0xb2, 0xca, 0x34, 0x33, 0x00, 0x40, 0x56, 0xe9,
+  0x68, 0x21, 0x00, 0xc8, 0x2a, 0x5f, 0x0b, 0xb2, 0x10, 0x59, 0xe5, 0xa3, 0x00, 0x00, 0x20, 0xab,
+  0xa4, 0x05, 0x00, 0x00, 0x64, 0x95, 0x94, 0xa6, 0xc0, 0x80, 0xac, 0x93, 0x02, 0x00, 0x00, 0x90,
+  0x75, 0xd2, 0xd0, 0x92, 0x3b, 0xb2, 0x4e, 0x5a, 0x00, 0x00, 0x40, 0xd6, 0x49, 0x0b, 0x01, 0x00,
+  0xc8, 0x3a, 0x29, 0x2a, 0x04, 0x00, 0x59, 0x27, 0x45, 0x0c, 0x00, 0x20, 0xeb, 0xa4, 0x69, 0x04,
+  0x06, 0x64, 0x9d, 0x34, 0x39, 0x00, 0x80, 0xac, 0x93, 0x26, 0x77, 0x00, 0x90, 0x75, 0xd2, 0x34,
+  0xd3, 0x00, 0xb2, 0x4e, 0x9a, 0x26, 0x05, 0x40, 0x56, 0x1a, 0x1c, 0x2d, 0x04, 0xc8, 0x4a, 0x11,
+  0x01, 0x00, 0x00, 0x59, 0x29, 0x2a, 0x00, 0x00, 0x20, 0x2b, 0x45, 0x85, 0x00, 0x00, 0x64, 0xa5,
+  0x28, 0xd9, 0x42, 0x80, 0xac, 0x34, 0x8d, 0xe4, 0x28, 0x90, 0x95, 0x26, 0x77, 0x00, 0x00, 0xb2,
+  0xd2, 0x34, 0x0b, 0x01, 0x40, 0x56, 0x9a, 0x66, 0x06, 0x00, 0xc8, 0x4a, 0x93, 0x2d, 0x04, 0x00,
+  0x59, 0x29, 0x4d, 0x13, 0x15, 0x22, 0x2b, 0xae, 0x93, 0x02, 0x00, 0x66, 0x10, 0xc9, 0x25, 0x77,
+  0xc0, 0x0c, 0x23, 0x38, 0x02, 0x00, 0x98, 0x61, 0x8c, 0x22, 0x0b, 0x01, 0x33, 0x8c, 0xe2, 0x68,
+  0x1a, 0x60, 0x86, 0xf1, 0x1c, 0x01, 0x00, 0xcc, 0x40, 0x00, 0x00, 0x00, 0x80, 0x19, 0x48, 0x71,
+  0x04, 0x00, 0x30, 0x03, 0x29, 0xee, 0x30, 0x00, 0x66, 0x20, 0x45, 0x06, 0x06, 0xc0, 0x0c, 0x24,
+  0x0d, 0x54, 0x08, 0x98, 0x81, 0x24, 0x47, 0x00, 0x00, 0x33, 0x90, 0x34, 0x0b, 0x01, 0x60, 0x06,
+  0x92, 0x68, 0x21, 0x00, 0xcc, 0x70, 0x00, 0x00, 0x00, 0x80, 0x19, 0x4e, 0x70, 0x34, 0x39, 0x30,
+  0xc3, 0x29, 0xf2, 0x55, 0x06, 0x66, 0x38, 0x08, 0x00, 0x00, 0xc0, 0x0c, 0x07, 0x25, 0x5b, 0x00,
+  0x98, 0xe1, 0x20, 0x59, 0x08, 0x00, 0x33, 0x9c, 0x27, 0x0b, 0x01, 0x60, 0x86, 0xd4, 0xd2, 0x00,
+  0x00, 0xcc, 0x90, 0x5a, 0x72, 0x07, 0x80, 0x19, 0x92, 0x23, 0x00, 0x00, 0x30, 0x43, 0x72, 0x34,
+  0x0d, 0x00, 0x66, 0x48, 0x8e, 0x26, 0x47, 0xc1, 0x0c, 0xc9, 0xd1, 0xf4, 0xea, 0x9c, 0x21, 0x4d,
+  0x5a, 0x08, 0x00, 0x33, 0x24, 0x5a, 0x08, 0x00, 0x60, 0x86, 0x44, 0x13, 0x01, 0x00, 0xcc, 0xb0,
+  0x8a, 0x03, 0x00, 0x80, 0x19, 0x56, 0x71, 0x07, 0x00, 0x30, 0x03, 0x0b, 0x02, 0x00, 0x00, 0x66,
+  0x60, 0x61, 0xd0, 0xe4, 0xce, 0x0c, 0x2c, 0xb0, 0xe4, 0x28, 0x98, 0x81, 0x05, 0x96, 0x5e, 0x9d,
+  0x33, 0xb0, 0xd0, 0x5e, 0x9d, 0x60, 0x06, 0x16, 0x1c, 0x01, 0x00, 0xcc, 0xc0, 0x82, 0x3b, 0x00,
+  0x80, 0x19, 0x58, 0x70, 0x29, 0x30, 0x30, 0x03, 0x0b, 0x2e, 0x0d, 0x00, 0x66, 0x60, 0xc1, 0x25,
+  0x77, 0xc0, 0x0c, 0x2c, 0x38, 0x9a, 0xdc, 0x99, 0x81, 0x05, 0x59, 0x08, 0x00, 0x33, 0xb0, 0x20,
+  0x93, 0x3b, 0x60, 0x06, 0x16, 0x68, 0x7a, 0x75, 0xce, 0xc0, 0x46, 0x71, 0x00, 0x80, 0x19, 0xd8,
+  0x28, 0x8e, 0x02, 0x30, 0x03, 0x1b, 0xc9, 0x1d, 0x00, 0x66, 0x60, 0x04, 0x00, 0x00, 0xc0, 0x0c,
+  0x8c, 0x14, 0x00, 0x00, 0x98, 0x81, 0x91, 0x22, 0x03, 0x03, 0x33, 0x30, 0x92, 0x4c, 0x65, 0x60,
+  0x06, 0x46, 0xd2, 0x4c, 0xee, 0xcc, 0xc0, 0x08, 0x2b, 0x04, 0x80, 0x19, 0x18, 0x91, 0x85, 0x00,
+  0x30, 0x03, 0x23, 0xd2, 0x01, 0x00, 0x66, 0x60, 0xe4, 0xa6, 0x11, 0xd8, 0x0c, 0xac, 0x00, 0x00,
+  0x00, 0x98, 0x81, 0x15, 0x92, 0xdc, 0x01, 0x33, 0x30, 0x63, 0x2a, 0x03, 0x60, 0x06, 0x66, 0x4c,
+  0x9d, 0x13, 0xcc, 0xc0, 0x0c, 0x4b, 0x03, 0x80, 0x19, 0x98, 0xa9, 0x32, 0x51, 0x30, 0x03, 0x33,
+  0x55, 0xbe, 0x3a, 0x67, 0x60, 0x69, 0x04, 0x77, 0xc0, 0x0c, 0x2c, 0x8d, 0x22, 0x0b, 0x99, 0x81,
+  0xa5, 0x81, 0x0a, 0x01, 0x33, 0xb0, 0x34, 0xd2, 0x00, 0x60, 0x06, 0x96, 0x46, 0x2a, 0x04, 0xcc,
+  0xc0, 0xd2, 0x48, 0xee, 0x80, 0x19, 0x58, 0x22, 0x00, 0x00, 0x30, 0x03, 0x4b, 0x2c, 0xb8, 0x03,
+  0x66, 0x60, 0x89, 0x25, 0x47, 0xc1, 0x0c, 0x2c, 0xb1, 0x0c, 0x00, 0x98, 0x81, 0x25, 0x07, 0x00,
+  0x00, 0x33, 0xb0, 0xe4, 0x02, 0x2d, 0x64, 0x06, 0x96, 0xdc, 0x08, 0x0c, 0xcc, 0xc0, 0x92, 0x23,
+  0x00, 0x80, 0x19, 0x58, 0x72, 0x07, 0x00, 0x30, 0x03, 0x4b, 0xee, 0x14, 0x02, 0x66, 0x60, 0xc9,
+  0x25, 0x47, 0xc1, 0x0c, 0x2c, 0xb9, 0xf4, 0x2a, 0x9b, 0x81, 0x25, 0x37, 0x93, 0x3b, 0x33, 0xb0,
+  0xe4, 0x28, 0x00, 0x60, 0x06, 0x96, 0x1c, 0x2d, 0x00, 0xcc, 0xc0, 0xd2, 0x93, 0x85, 0x80, 0x19,
+  0x58, 0x9a, 0x69, 0x00, 0x30, 0x03, 0x4b, 0x93, 0x02, 0x00, 0x66, 0x60, 0x69, 0xd2, 0xe4, 0xce,
+  0x0c, 0x2c, 0xd1, 0x02, 0x00, 0x98, 0x81, 0x25, 0x9a, 0x06, 0x00, 0x33, 0xb0, 0x44, 0x93, 0x3b,
+  0x60, 0x06, 0x96, 0x6c, 0x01, 0x00, 0xcc, 0xc0, 0x92, 0x2d, 0x04, 0x80, 0x19, 0x58, 0xb2, 0x29,
+  0x48, 0x30, 0x03, 0x63, 0x04, 0x00, 0x00, 0x66, 0x60, 0x8c, 0x14, 0x02, 0xc0, 0x0c, 0x8c, 0x11,
+  0x56, 0x08, 0x98, 0x81, 0xb1, 0x02, 0x00, 0x00, 0x33, 0x30, 0x56, 0x08, 0x00, 0x60, 0x06, 0xc6,
+  0x8a, 0x03, 0x00, 0xcc, 0xc0, 0x58, 0x71, 0x81, 0x82, 0x19, 0x18, 0x2b, 0xee, 0x00, 0x30, 0x03,
+  0x63, 0xc5, 0xbd, 0x3a, 0x67, 0x60, 0xac, 0xc8, 0xe2, 0xce, 0x0c, 0x8c, 0x25, 0x96, 0x1c, 0x9d,
+  0x81, 0xb1, 0xe4, 0x00, 0x00, 0x33, 0x30, 0x96, 0x1c, 0x05, 0x60, 0x06, 0xc6, 0x92, 0xa3, 0x69,
+  0xcc, 0xc0, 0x58, 0x9a, 0xc9, 0xd1, 0x19, 0x18, 0x4b, 0x14, 0x00, 0x30, 0x03, 0x63, 0x2c, 0x0d,
+  0x00, 0x66, 0x60, 0x8c, 0x25, 0x77, 0xc0, 0x0c, 0x8c, 0xbd, 0x56, 0x08, 0x98, 0x81, 0xb1, 0xe7,
+  0x0e, 0x00, 0x33, 0x30, 0xf6, 0x1c, 0x05, 0x60, 0x06, 0xc6, 0x9e, 0xa3, 0x85, 0xcc, 0xc0, 0xd8,
+  0x73, 0x34, 0x8d, 0x19, 0x18, 0x7b, 0xb2, 0x10, 0x30, 0x03, 0x63, 0xd5, 0x01, 0x00, 0x66, 0x60,
+  0x8f, 0x15, 0x02, 0xc0, 0x0c, 0xec, 0xb1, 0x34, 0x00, 0x98, 0x81, 0xbd, 0x16, 0x58, 0x21, 0x33,
+  0xb0, 0xe7, 0x92, 0xa9, 0x73, 0x06, 0xf6, 0x5c, 0x72, 0x07, 0xcc, 0xc0, 0x9e, 0x2c, 0x00, 0x80,
+  0x19, 0xd8, 0x93, 0x85, 0x00, 0x30, 0x03, 0x7b, 0xd2, 0x54, 0x06, 0x66, 0x60, 0x4f, 0x26, 0x07,
+  0xc0, 0x0c, 0xec, 0xc9, 0xe4, 0x0e, 0x98, 0x81, 0x3d, 0xf9, 0x2a, 0x03, 0x33, 0xb0, 0x47, 0x93,
+  0x3b, 0x60, 0x06, 0xf6, 0x68, 0x7a, 0x75, 0xce, 0xc0, 0xe6, 0xb3, 0x85, 0x80, 0x19, 0xd8, 0xa4,
+  0xe9, 0xd5, 0x39, 0x03, 0xa3, 0x85, 0x00, 0x00, 0x66, 0x60, 0x14, 0x15, 0x02, 0xc0, 0x0c, 0x8c,
+  0xa2, 0x0c, 0x00, 0x98, 0x81, 0xd1, 0xe4, 0x0e, 0x00, 0x33, 0xb0, 0x9a, 0xdc, 0x01, 0x60, 0x06,
+  0x56, 0x59, 0x7a, 0xd7, 0xcd, 0xc0, 0xaa, 0x3b, 0x00, 0x80, 0x19, 0x58, 0x95, 0x85, 0x00, 0x30,
+  0x03, 0xab, 0x32, 0x0d, 0x00, 0x66, 0x60, 0x19, 0x00, 0x00, 0xc0, 0x0c, 0x2d, 0xb0, 0x40, 0x0b,
+  0x99, 0xa1, 0x05, 0xf6, 0xea, 0x04, 0x33, 0x34, 0xc1, 0x92, 0x3b, 0x60, 0x86, 0x26, 0x64, 0x21,
+  0x00, 0xcc, 0xd0, 0x8a, 0x3b, 0x00, 0x80, 0x19, 0x5a, 0x71, 0xc9, 0x1d, 0x30, 0x43, 0x4b, 0x8e,
+  0x00, 0x00, 0x66, 0x68, 0xc9, 0x1d, 0x00, 0xc0, 0x0c, 0x2d, 0xb9, 0x53, 0x08, 0x98, 0xa1, 0xa5,
+  0x99, 0xdc, 0x01, 0x33, 0xb4, 0xe7, 0xd2, 0x00, 0x60, 0x86, 0x06, 0x5f, 0x9d, 0x13, 0xcc, 0xd0,
+  0x60, 0x06, 0x00, 0x80, 0x19, 0x5c, 0x60, 0x69, 0x00, 0x30, 0x83, 0x0b, 0x2c, 0xbd, 0x3a, 0x67,
+  0x70, 0xa1, 0xa5, 0x01, 0xc0, 0x0c, 0x2e, 0xb4, 0x57, 0x19, 0x98, 0xc1, 0x05, 0x47, 0x00, 0x00,
+  0x33, 0xb8, 0x40, 0x01, 0x00, 0x60, 0x06, 0x47, 0x00, 0x00, 0x00, 0xcc, 0xe0, 0x48, 0x01, 0x00,
+  0x80, 0x19, 0x1c, 0x29, 0x04, 0x00, 0x30, 0x83, 0x23, 0x85, 0x24, 0x77, 0x66, 0x70, 0xa4, 0xb8,
+  0x03, 0xc0, 0x0c, 0x8e, 0x14, 0x19, 0x18, 0x98, 0xc1, 0x91, 0x22, 0xd3, 0x00, 0x33, 0x38, 0x92,
+  0x06, 0x00, 0x60, 0x06, 0x47, 0x92, 0x3b, 0x00, 0xcc, 0xe0, 0x48, 0x9a, 0x34, 0x8d, 0x19, 0x1c,
+  0x61, 0x69, 0x00, 0x30, 0x83, 0x23, 0x2c, 0xbd, 0x3a, 0x67, 0x70, 0xe4, 0xa6, 0x01, 0xc0, 0x0c,
+  0xae, 0xb0, 0x42, 0x00, 0x98, 0xc1, 0x15, 0x47, 0x00, 0x00, 0x33, 0xb8, 0xe2, 0x0e, 0x00, 0x60,
+  0x06, 0x57, 0x1c, 0x05, 0x00, 0xcc, 0xe0, 0x8a, 0xa3, 0xc9, 0x9d, 0x19, 0x5c, 0x91, 0x05, 0x00,
+  0x30, 0x83, 0x2b, 0xb2, 0x10, 0x00, 0x66, 0x70, 0xa7, 0x00, 0x00, 0xc0, 0x0c, 0xee, 0x14, 0x17,
+  0x18, 0x98, 0xc1, 0x9d, 0x22, 0xd3, 0x00, 0x33, 0xb8, 0x93, 0xdc, 0x01, 0x60, 0x06, 0x97, 0x46,
+  0x1a, 0x81, 0xcd, 0xe0, 0x12, 0x49, 0x8e, 0x82, 0x19, 0x5c, 0x72, 0x85, 0x00, 0x30, 0x83, 0x4b,
+  0xee, 0x00, 0x00, 0x66, 0x70, 0xab, 0x10, 0x00, 0xc0, 0x0c, 0xee, 0x05, 0x56, 0x08, 0x98, 0xc1,
+  0xcd, 0x47, 0x53, 0x60, 0x33, 0x38, 0x5a, 0xdc, 0x01, 0x60, 0x06, 0x47, 0x8b, 0x4c, 0xee, 0xcc,
+  0xe0, 0x68, 0x99, 0x85, 0x80, 0x19, 0x1c, 0x45, 0xac, 0x10, 0x30, 0x83, 0xa3, 0xc9, 0x1d, 0x00,
+  0x66, 0x70, 0x34, 0x4d, 0x5a, 0xc0, 0x0c, 0x30, 0xb0, 0x0c, 0x00, 0x98, 0x01, 0x06, 0x47, 0x00,
+  0x00, 0x33, 0xc0, 0xe0, 0x0e, 0x00, 0x60, 0x06, 0x18, 0x64, 0x70, 0x07, 0xcc, 0x00, 0x0b, 0x00,
+  0x00, 0x80, 0x19, 0x60, 0x19, 0xc9, 0x1d, 0x30, 0x03, 0x2c, 0x04, 0x00, 0x00, 0x66, 0x80, 0x85,
+  0x25, 0x77, 0xc0, 0x0c, 0xb0, 0xb8, 0x03, 0x00, 0x98, 0x01, 0x16, 0x77, 0x0a, 0x00, 0x33, 0xc0,
+  0xe2, 0x0e, 0x03, 0x60, 0x06, 0x58, 0x5c, 0x72, 0x07, 0xcc, 0x00, 0x8b, 0xa3, 0x69, 0x80, 0x19,
+  0x60, 0x91, 0x81, 0x15, 0x32, 0x03, 0x2c, 0xb2, 0x00, 0x00, 0x66, 0x80, 0x45, 0x16, 0x02, 0xc0,
+  0x0c, 0xb0, 0xc8, 0x14, 0xdc, 0x99, 0x01, 0x16, 0x99, 0x01, 0x00, 0x33, 0xc0, 0x32, 0x93, 0xa3,
+  0x60, 0x06, 0x98, 0x46, 0x72, 0x07, 0xcc, 0x00, 0x13, 0x01, 0x00, 0x80, 0x19, 0x60, 0x62, 0x85,
+  0x00, 0x30, 0x03, 0x4c, 0xee, 0x00, 0x00, 0x66, 0x80, 0xc9, 0xd1, 0xe4, 0xce, 0x0c, 0x90, 0xbd,
+  0x56, 0x08, 0x98, 0x01, 0x4a, 0x02, 0x00, 0x00, 0x33, 0x40, 0x59, 0x08, 0x00, 0x60, 0x06, 0x28,
+  0xd3, 0x00, 0x00, 0xcc, 0x00, 0x65, 0x1a, 0x81, 0x81, 0x19, 0xa0, 0x74, 0x04, 0x00, 0x30, 0x03,
+  0x94, 0xaf, 0x25, 0x77, 0x66, 0x80, 0xb2, 0xb2, 0x42, 0xc0, 0x0c, 0x90, 0x16, 0x77, 0x00, 0x98,
+  0x01, 0xd2, 0x22, 0x5f, 0x65, 0x33, 0x40, 0x9a, 0x1c, 0x05, 0x60, 0x06, 0x98, 0x01, 0x00, 0x00,
+  0xcc, 0x20, 0xc3, 0x08, 0xee, 0x80, 0x19, 0x64, 0x60, 0x85, 0x00, 0x30, 0x83, 0x0c, 0x2c, 0x0d,
+  0x00, 0x66, 0x90, 0xa1, 0x15, 0x02, 0xc0, 0x0c, 0x32, 0x38, 0x02, 0x00, 0x98, 0x41, 0x06, 0x77,
+  0x00, 0x00, 0x33, 0xc8, 0xe0, 0x92, 0x3b, 0x60, 0x06, 0x19, 0x1c, 0xa5, 0x69, 0xcc, 0x20, 0x83,
+  0xa3, 0x19, 0x80, 0x19, 0x64, 0x98, 0xc9, 0x1d, 0x30, 0x83, 0x0c, 0x34, 0x0d, 0x00, 0x66, 0x90,
+  0x81, 0x26, 0x47, 0xcb, 0x0c, 0x32, 0x50, 0x56, 0x08, 0x98, 0x41, 0x8a, 0x40, 0x01, 0x00, 0x33,
+  0x48, 0x11, 0x68, 0x21, 0x60, 0x06, 0x29, 0x92, 0x03, 0x00, 0xcc, 0x20, 0x05, 0x4b, 0xee, 0x80,
+  0x19, 0xe4, 0x08, 0xac, 0x10, 0x30, 0x83, 0x1c, 0xc1, 0x01, 0x00, 0x66, 0x90, 0x23, 0xd0, 0xe4,
+  0xce, 0x0c, 0x72, 0x14, 0x00, 0x00, 0x98, 0x41, 0x8e, 0xe2, 0x00, 0x00, 0x33, 0xc8, 0x81, 0x0a,
+  0x01, 0x60, 0x06, 0x39, 0x50, 0x99, 0x00, 0xcc, 0x20, 0x47, 0x72, 0x07, 0x80, 0x19, 0xe4, 0xa8,
+  0x32, 0xb9, 0x33, 0x83, 0x24, 0x00, 0x00, 0x00, 0x66, 0x90, 0xa4, 0x00, 0x00, 0xc0, 0x0c, 0x92,
+  0x14, 0x02, 0x00, 0x98, 0x41, 0x92, 0x42, 0x92, 0x3b, 0x33, 0x48, 0x52, 0x1c, 0x00, 0x60, 0x06,
+  0x49, 0x12, 0x01, 0x00, 0xcc, 0x20, 0x09, 0x4b, 0xee, 0x80, 0x19, 0x24, 0x91, 0xee, 0x00, 0x30,
+  0x83, 0x2c, 0x00, 0x00, 0x00, 0x66, 0x90, 0x45, 0xb0, 0x42, 0xc0, 0x0c, 0xb2, 0x10, 0x00, 0x00,
+  0x98, 0x41, 0x16, 0x56, 0x08, 0x00, 0x33, 0xc8, 0xc2, 0x92, 0x3b, 0x60, 0x06, 0x59, 0x1c, 0x00,
+  0x00, 0xcc, 0x20, 0x8b, 0x23, 0x00, 0x80, 0x19, 0x64, 0x71, 0x85, 0x00, 0x30, 0x83, 0x2c, 0xae,
+  0xcc, 0x09, 0x66, 0x90, 0xc5, 0x1d, 0x00, 0xc0, 0x0c, 0xb2, 0xb8, 0x34, 0x00, 0x98, 0x41, 0x16,
+  0x97, 0x1c, 0x00, 0x33, 0xc8, 0xe2, 0x92, 0x3b, 0x60, 0x06, 0x59, 0x1c, 0x05, 0x00, 0xcc, 0x20,
+  0x8b, 0xa3, 0xc9, 0x9d, 0x19, 0x64, 0x71, 0xf4, 0xd5, 0x39, 0x83, 0x2c, 0x50, 0x26, 0x77, 0x66,
+  0x90, 0x45, 0x06, 0x77, 0xc0, 0x0c, 0xb2, 0xc8, 0x02, 0x00, 0x98, 0x41, 0x16, 0x59, 0x08, 0x00,
+  0x33, 0xc8, 0x22, 0xd3, 0x00, 0x60, 0x06, 0x59, 0x64, 0x72, 0x07, 0xcc, 0x20, 0x8b, 0x4c, 0xaf,
+  0xce, 0x19, 0x64, 0x99, 0x85, 0x00, 0x30, 0x83, 0x2c, 0x33, 0x0d, 0x00, 0x66, 0x90, 0x65, 0x26,
+  0x77, 0xc0, 0x0c, 0xf2, 0x14, 0x02, 0x00, 0x98, 0x41, 0x9e, 0xe2, 0x28, 0x00, 0x33, 0xc8, 0x83,
+  0x68, 0x72, 0x67, 0x06, 0x79, 0x5c, 0x7a, 0x75, 0xce, 0x20, 0x53, 0x70, 0x07, 0x80, 0x19, 0x64,
+  0x12, 0xac, 0x10, 0x30, 0x83, 0x4c, 0x03, 0x00, 0x00, 0x66, 0x90, 0x69, 0x04, 0x06, 0xc0, 0x0c,
+  0x32, 0x8d, 0xc0, 0x0a, 0x99, 0x41, 0xa6, 0x11, 0x68, 0x21, 0x33, 0xc8, 0x34, 0x50, 0x60, 0x60,
+  0x06, 0x99, 0x06, 0x2a, 0x04, 0xcc, 0x20, 0xd3, 0x40, 0xb4, 0x80, 0x19, 0x64, 0x1a, 0x88, 0xa6,
+  0x31, 0x83, 0x4c, 0x23, 0x0d, 0x00, 0x66, 0x90, 0x69, 0x24, 0x77, 0xc0, 0x0c, 0x32, 0x8d, 0xf4,
+  0xea, 0x9c, 0x41, 0xa6, 0x91, 0x6c, 0x21, 0x33, 0xc8, 0x34, 0x68, 0x1a, 0x60, 0x06, 0x99, 0x08,
+  0x00, 0x00, 0xcc, 0x20, 0xd3, 0x29, 0x04, 0x80, 0x19, 0x64, 0x62, 0x00, 0x00, 0x30, 0x83, 0x4c,
+  0xac, 0xc8, 0x42, 0x66, 0x90, 0x89, 0x25, 0x5b, 0xc8, 0x0c, 0x32, 0x39, 0x00, 0x00, 0x98, 0x41,
+  0x26, 0x47, 0x00, 0x00, 0x33, 0xc8, 0xe4, 0x48, 0x21, 0x60, 0x06, 0x99, 0x5c, 0x21, 0x00, 0xcc,
+  0x20, 0x93, 0x2b, 0x73, 0xce, 0x19, 0x64, 0x72, 0x07, 0x00, 0x30, 0x83, 0x4c, 0xee, 0x14, 0x02,
+  0x66, 0x90, 0xc9, 0xa5, 0x01, 0xc0, 0x0c, 0x32, 0xb9, 0xf4, 0xea, 0x9c, 0x41, 0x26, 0xc7, 0x92,
+  0xa3, 0x33, 0xc8, 0xe4, 0x68, 0x01, 0x60, 0x06, 0x99, 0x1c, 0x2d, 0x04, 0xcc, 0x20, 0x93, 0xa3,
+  0xc9, 0x81, 0x19, 0x64, 0x92, 0x81, 0x01, 0x30, 0x83, 0x4c, 0xb2, 0x10, 0x00, 0x66, 0x90, 0x69,
+  0x16, 0x02, 0xc0, 0x0c, 0x32, 0x4d, 0x54, 0x08, 0x98, 0x41, 0xa6, 0x99, 0x06, 0x00, 0x33, 0xc8,
+  0x34, 0x29, 0x00, 0x60, 0x06, 0x99, 0x26, 0x2d, 0x00, 0xcc, 0x20, 0xd3, 0xa4, 0x85, 0x80, 0x19,
+  0x64, 0x9a, 0x34, 0x0d, 0x30, 0x83, 0x4c, 0x33, 0x03, 0x00, 0x66, 0x90, 0x89, 0x02, 0x00, 0xc0,
+  0x0c, 0x32, 0xd1, 0xe4, 0x0e, 0x98, 0x41, 0xae, 0xe2, 0x0e, 0x00, 0x33, 0xc8, 0x55, 0x64, 0x72,
+  0x60, 0x06, 0xc9, 0x58, 0x01, 0x00, 0xcc, 0x20, 0x1b, 0x00, 0x00, 0x80, 0x19, 0x64, 0x13, 0xac,
+  0x10, 0x30, 0x83, 0x6c, 0x85, 0x00, 0x00, 0x66, 0x90, 0xad, 0xc8, 0x42, 0xc0, 0x0c, 0xb2, 0x25,
+  0x07, 0x00, 0x98, 0x41, 0xb6, 0xe4, 0x82, 0xa3, 0x33, 0x48, 0x47, 0x0b, 0x01, 0x60, 0x06, 0xe9,
+  0x28, 0x2b, 0x00, 0xcc, 0x20, 0x5f, 0x48, 0xee, 0x80, 0x19, 0xe4, 0x1b, 0x29, 0x30, 0x30, 0x83,
+  0x7c, 0x04, 0x00, 0x00, 0x66, 0x90, 0x8f, 0xa5, 0x01, 0xc0, 0x0c, 0xf2, 0xb1, 0xe4, 0x0e, 0x98,
+  0x41, 0xbe, 0x96, 0xdc, 0x01, 0x33, 0xc8, 0xe7, 0x08, 0x00, 0x60, 0x06, 0xf9, 0x64, 0xa0, 0x00,
+  0xcc, 0x20, 0x9f, 0x24, 0x00, 0x80, 0x19, 0xe4, 0x93, 0x05, 0x00, 0x30, 0x83, 0x7c, 0xb2, 0x10,
+  0x00, 0x66, 0x90, 0x4f, 0xa6, 0x01, 0xc0, 0x0c, 0xf2, 0x55, 0x59, 0x08, 0x98, 0x41, 0xbe, 0x1b,
+  0x68, 0x01, 0x33, 0x48, 0x19, 0x58, 0x21, 0x60, 0x06, 0x29, 0x8b, 0x0c, 0xee, 0xcc, 0x20, 0xe7,
+  0x6b, 0x85, 0x80, 0x19, 0xe4, 0xa4, 0x00, 0x00, 0x30, 0x83, 0x9c, 0xb4, 0x10, 0x00, 0x66, 0x90,
+  0x93, 0xa6, 0x55, 0xc0, 0x0c, 0x92, 0x02, 0x00, 0x00, 0x98, 0x41, 0xd2, 0xe0, 0x0e, 0x00, 0x33,
+  0x48, 0x1a, 0x68, 0x21, 0x60, 0x06, 0x49, 0x03, 0x4d, 0xee, 0xcc, 0x20, 0x69, 0x01, 0x00, 0x80,
+  0x19, 0x24, 0x2d, 0x04, 0x00, 0x30, 0x83, 0xa4, 0x85, 0x14, 0x02, 0x66, 0x90, 0xb4, 0x38, 0x00,
+  0xc0, 0x0c, 0x92, 0x16, 0x77, 0x00, 0x98, 0x41, 0xd2, 0x22, 0x0b, 0x00, 0x33, 0x48, 0x5a, 0xe4,
+  0xab, 0x73, 0x06, 0x49, 0x51, 0x01, 0x00, 0xcc, 0x20, 0x29, 0x4a, 0x03, 0x80, 0x19, 0x24, 0x45,
+  0xb4, 0x10, 0x30, 0x83, 0xa4, 0x88, 0x26, 0x77, 0x66, 0x90, 0x34, 0x0d, 0x00, 0xc0, 0x0c, 0x92,
+  0xa6, 0x51, 0x00, 0x98, 0x41, 0xd2, 0x34, 0x68, 0x1a, 0x33, 0x48, 0x9a, 0x08, 0x00, 0x60, 0x06,
+  0x49, 0x93, 0x03, 0x00, 0xcc, 0x20, 0x69, 0x72, 0x07, 0x80, 0x19, 0x24, 0x4d, 0x8e, 0xa6, 0x31,
+  0x83, 0xa4, 0x69, 0x26, 0x77, 0x66, 0x90, 0x34, 0x4d, 0x5a, 0xc8, 0x0c, 0x92, 0x26, 0x5b, 0x08,
+  0x98, 0x41, 0x52, 0x9a, 0x06, 0x00, 0x33, 0x48, 0x5a, 0x65, 0x06, 0x60, 0x06, 0x49, 0x33, 0x00,
+  0x00, 0xcc, 0x20, 0x6d, 0x21, 0x00, 0x80, 0x19, 0xa4, 0x2d, 0x0e, 0x00, 0x30, 0xc3, 0x44, 0x05,
+  0x00, 0x00, 0x66, 0x98, 0x8f, 0x26, 0x77, 0xc0, 0x0c, 0x13, 0x16, 0x02, 0x00, 0x98, 0x61, 0xc2,
+  0xe4, 0x68, 0x01, 0x33, 0x4c, 0x48, 0x93, 0x3b, 0x60, 0x86, 0x09, 0x33, 0x00, 0x00, 0xcc, 0x30,
+  0x27, 0x4d, 0x03, 0x80, 0x19, 0x26, 0x05, 0x00, 0x00, 0x30, 0xc3, 0xa4, 0x81, 0xa6, 0x01, 0x66,
+  0x98, 0xb4, 0x00, 0x00, 0xc0, 0x0c, 0x93, 0x16, 0x02, 0x00, 0x98, 0x61, 0xd2, 0xe2, 0x0e, 0x00,
+  0x33, 0x4c, 0x8a, 0x0a, 0x01, 0x60, 0x86, 0x49, 0xd3, 0x00, 0x00, 0xcc, 0x30, 0x69, 0x72, 0x14,
+  0x80, 0x19, 0x26, 0x4d, 0xb3, 0xb8, 0x33, 0xc3, 0xa4, 0x4f, 0x16, 0x02, 0x66, 0xa0, 0x81, 0x25,
+  0x57, 0xc8, 0x0c, 0x34, 0xb8, 0x03, 0x00, 0x98, 0x81, 0x06, 0x97, 0x06, 0x00, 0x33, 0xd0, 0x51,
+  0x00, 0x00, 0x60, 0x06, 0x5a, 0x58, 0x0a, 0x0c, 0xcc, 0x40, 0x8b, 0x23, 0x00, 0x80, 0x19, 0x68,
+  0x71, 0x87, 0x01, 0x30, 0x03, 0x2d, 0x90, 0xa6, 0x01, 0x66, 0xa0, 0x45, 0x16, 0x02, 0xc0, 0x0c,
+  0xb4, 0xc8, 0x22, 0x0b, 0x99, 0x81, 0x22, 0x00, 0x00, 0x00, 0x33, 0x50, 0x14, 0x58, 0x21, 0x60,
+  0x06, 0x8a, 0x02, 0x7b, 0x75, 0xce, 0x40, 0x11, 0x61, 0x85, 0x80, 0x19, 0x28, 0x2a, 0x04, 0x00,
+  0x30, 0x03, 0x45, 0xc5, 0x1d, 0x00, 0x66, 0xa0, 0xa8, 0xc8, 0xe4, 0xce, 0x0c, 0x14, 0x15, 0xf9,
+  0xea, 0x9c, 0x81, 0xa2, 0x34, 0x00, 0x00, 0x33, 0x50, 0x94, 0x08, 0x00, 0x60, 0x06, 0x8a, 0x92,
+  0x3b, 0x00, 0xcc, 0x40, 0x51, 0x72, 0xb4, 0x90, 0x19, 0x28, 0x4a, 0x93, 0x02, 0x30, 0x03, 0x45,
+  0x8f, 0x26, 0x77, 0x66, 0xa0, 0xe8, 0xd5, 0x39, 0xc1, 0x0c, 0x14, 0xd1, 0xc0, 0x00, 0x98, 0x81,
+  0x22, 0x5a, 0x08, 0x00, 0x33, 0x50, 0x44, 0xd3, 0xab, 0x73, 0x06, 0x9a, 0x46, 0x21, 0x00, 0xcc,
+  0x40, 0x13, 0x01, 0x00, 0x80, 0x19, 0x68, 0x3a, 0xee, 0x00, 0x30, 0x03, 0x4d, 0xac, 0x10, 0x00,
+  0x66, 0xa0, 0xc9, 0x11, 0x00, 0xc0, 0x0c, 0x34, 0xb9, 0xe4, 0x0e, 0x98, 0x81, 0x26, 0xf7, 0x2a,
+  0x03, 0x33, 0xd0, 0x34, 0x29, 0x00, 0x60, 0x06, 0x9a, 0x6c, 0x72, 0x14, 0xcc, 0x40, 0x5f, 0x4b,
+  0x03, 0x80, 0x19, 0xe8, 0x93, 0x85, 0x00, 0x30, 0x03, 0x95, 0x05, 0x00, 0x00, 0x66, 0xa0, 0xb2,
+  0xb8, 0x03, 0xc0, 0x0c, 0x94, 0xca, 0x02, 0x00, 0x98, 0x81, 0x56, 0x02, 0x00, 0x00, 0x33, 0xd0,
+  0x2a, 0x93, 0x03, 0x60, 0x06, 0x5a, 0x67, 0x21, 0x00, 0xcc, 0x40, 0xeb, 0x4c, 0x03, 0x80, 0x19,
+  0x68, 0xb5, 0x69, 0x00, 0x30, 0x43, 0x0d, 0x82, 0x15, 0x02, 0x66, 0xa8, 0x04, 0x00, 0x00, 0xc0,
+  0x0c, 0x95, 0x11, 0x00, 0x00, 0x98, 0xa1, 0xb6, 0x40, 0x01, 0x00, 0x33, 0x54, 0x37, 0x82, 0x3b,
+  0x60, 0x86, 0xea, 0x08, 0x00, 0x00, 0xcc, 0x50, 0x1d, 0x61, 0x85, 0x80, 0x19, 0xaa, 0x3b, 0x88,
+  0x02, 0x30, 0x43, 0x75, 0xc9, 0x05, 0x06, 0x66, 0xa8, 0x2e, 0xcd, 0x58, 0xe7, 0x0c, 0xd5, 0x51,
+  0x00, 0x00, 0x98, 0xa1, 0x3a, 0x5a, 0x08, 0x00, 0x33, 0x54, 0x47, 0xd3, 0x00, 0x60, 0x86, 0xea,
+  0x68, 0x72, 0x07, 0xcc, 0x50, 0x1d, 0x4d, 0x8e, 0x82, 0x19, 0xaa, 0xa3, 0x89, 0x16, 0x32, 0x43,
+  0x75, 0x94, 0x15, 0x02, 0x66, 0xa8, 0x8e, 0xca, 0xe4, 0xce, 0x0c, 0xd5, 0x65, 0x00, 0x00, 0x98,
+  0xa1, 0x3a, 0x9d, 0x1c, 0x05, 0x33, 0x54, 0x19, 0xdc, 0x01, 0x60, 0x86, 0x2a, 0x0b, 0x01, 0x00,
+  0xcc, 0x50, 0x25, 0x65, 0x85, 0x80, 0x19, 0xea, 0x2c, 0x04, 0x00, 0x30, 0x43, 0x9d, 0xc5, 0x1d,
+  0x00, 0x66, 0xa8, 0x13, 0x31, 0x00, 0xc0, 0x0c, 0x75, 0xce, 0x42, 0x00, 0x98, 0xa1, 0xd2, 0x02,
+  0x00, 0x00, 0x33, 0x54, 0x8a, 0x0a, 0x01, 0x60, 0x86, 0x4a, 0xd3, 0x00, 0x00, 0xcc, 0x60, 0x03,
+  0x2b, 0x04, 0x80, 0x19, 0x6c, 0x60, 0xc9, 0x1d, 0x30, 0x83, 0x2d, 0x00, 0x00, 0x00, 0x66, 0xb0,
+  0x85, 0x00, 0x00, 0xc0, 0x0c, 0xb6, 0x90, 0x42, 0x00, 0x98, 0xc1, 0x16, 0x56, 0x00, 0x00, 0x33,
+  0xd8, 0xc2, 0xd2, 0x00, 0x60, 0x06, 0x5b, 0x1c, 0x01, 0x00, 0xcc, 0x60, 0x8b, 0x3b, 0x00, 0x80,
+  0x19, 0x6c, 0x71, 0xa7, 0x10, 0x30, 0x83, 0x2d, 0x2e, 0x0d, 0x00, 0x66, 0xb0, 0xc5, 0xa5, 0x02,
+  0xc0, 0x0c, 0xb6, 0xb8, 0xb4, 0x0a, 0x98, 0xc1, 0x16, 0x37, 0x69, 0x21, 0x33, 0xd8, 0xe2, 0x28,
+  0x00, 0x60, 0x06, 0x5b, 0x1c, 0x4d, 0xee, 0xcc, 0x60, 0x8b, 0xa3, 0xc9, 0xd1, 0x19, 0x6c, 0x91,
+  0x85, 0x00, 0x30, 0x83, 0x2d, 0xb2, 0x4c, 0x00, 0x66, 0xb0, 0x45, 0x9a, 0x3a, 0xc1, 0x0c, 0xb6,
+  0xc8, 0xe4, 0x28, 0x98, 0xc1, 0x96, 0x59, 0x64, 0x06, 0x33, 0xd8, 0x32, 0x93, 0x3b, 0x60, 0x06,
+  0x5b, 0x26, 0x2d, 0x04, 0xcc, 0x60, 0x53, 0x70, 0x07, 0x80, 0x19, 0x6c, 0x1a, 0x81, 0x01, 0x30,
+  0x83, 0x4d, 0xac, 0x10, 0x00, 0x66, 0xb0, 0xaf, 0x25, 0x77, 0xc0, 0x0c, 0x17, 0x00, 0x00, 0x00,
+  0x98, 0x41, 0x07, 0x97, 0x1c, 0x00, 0x33, 0xe8, 0xe0, 0x68, 0x21, 0x60, 0x06, 0x5d, 0x64, 0x0a,
+  0x0c, 0xcc, 0xa0, 0x75, 0x01, 0x00, 0x80, 0x19, 0xb4, 0x4e, 0xa6, 0xce, 0x39, 0x83, 0xd6, 0x2c,
+  0x0d, 0x00, 0xe6, 0x08, 0xa7, 0xc8, 0x42, 0xc0, 0x1c, 0xc1, 0x11, 0x00, 0x00, 0x98, 0x23, 0xc8,
+  0x02, 0x00, 0x00, 0x73, 0x04, 0x59, 0x08, 0x00, 0x60, 0x8e, 0x30, 0x69, 0x21, 0x00, 0xcc, 0x11,
+  0x26, 0x4d, 0x03, 0x80, 0x39, 0xc2, 0xa4, 0xac, 0x00, 0x30, 0xc7, 0x08, 0x23, 0xb9, 0x03, 0xe6,
+  0x18, 0x81, 0x15, 0x02, 0xc0, 0x1c, 0x23, 0xb8, 0x03, 0x00, 0x98, 0x63, 0x04, 0x19, 0x18, 0x00,
+  0x73, 0x8c, 0x40, 0xd3, 0x00, 0x60, 0x8e, 0x51, 0x00, 0x00, 0x00, 0xcc, 0x31, 0x0a, 0x01, 0x00,
+  0x80, 0x39, 0x46, 0x61, 0x85, 0x00, 0x30, 0xc7, 0x28, 0x8e, 0x00, 0x00, 0xe6, 0x18, 0xc5, 0x15,
+  0x00, 0xc0, 0x1c, 0xa3, 0xb8, 0xe4, 0x0e, 0x98, 0x63, 0x14, 0x59, 0x08, 0x00, 0x73, 0x8c, 0x22,
+  0x5f, 0x65, 0x60, 0x8e, 0x51, 0x66, 0x01, 0x00, 0xcc, 0x31, 0xaa, 0x0c, 0xee, 0x80, 0x39, 0x46,
+  0x95, 0x85, 0x00, 0x30, 0x47, 0x01, 0x00, 0x00, 0x00, 0xe6, 0x28, 0x41, 0x16, 0x02, 0xc0, 0x1c,
+  0x25, 0xd0, 0x42, 0x00, 0x98, 0xa3, 0x8c, 0xe2, 0x0e, 0x00, 0x73, 0x94, 0x51, 0x59, 0x21, 0x60,
+  0x8e, 0x32, 0xaa, 0x03, 0x00, 0xcc, 0x51, 0xca, 0xa4, 0x05, 0x80, 0x39, 0x8a, 0xa9, 0x32, 0x39,
+  0x3a, 0x47, 0x49, 0x23, 0x0d, 0x00, 0xe6, 0x28, 0xac, 0x10, 0x00, 0xc0, 0x1c, 0x85, 0x15, 0x07,
+  0x00, 0x98, 0xa3, 0xb0, 0xe2, 0x0e, 0x00, 0x73, 0x14, 0xc6, 0xd2, 0x00, 0x60, 0x8e, 0xc2, 0x5e,
+  0x65, 0x00, 0xcc, 0x51, 0xd8, 0xab, 0x13, 0x80, 0x39, 0x0a, 0xa3, 0x85, 0x00, 0x30, 0x47, 0x71,
+  0x04, 0x00, 0x00, 0xe6, 0x28, 0xee, 0xa4, 0x57, 0xe7, 0x1c, 0xc5, 0x3d, 0x07, 0x00, 0x98, 0xa3,
+  0x38, 0x5a, 0x08, 0x00, 0x73, 0x14, 0x47, 0xd3, 0x00, 0x60, 0x8e, 0xe2, 0x32, 0x00, 0x00, 0xcc,
+  0x51, 0x9c, 0x2e, 0x04, 0x80, 0x39, 0x0a, 0x0c, 0xac, 0x10, 0x30, 0x47, 0x91, 0x81, 0x02, 0x00,
+  0xe6, 0x28, 0xb2, 0x10, 0x00, 0xc0, 0x1c, 0x45, 0x16, 0x99, 0xdc, 0x99, 0xa3, 0xc8, 0x32, 0x29,
+  0x00, 0x73, 0x14, 0x99, 0xdc, 0x01, 0x60, 0x8e, 0x32, 0x03, 0x2b, 0x04, 0xcc, 0x51, 0x26, 0x4d,
+  0x8e, 0x82, 0x39, 0x50, 0x1a, 0xc1, 0x1d, 0x30, 0xc7, 0xa3, 0xc5, 0x1d, 0x00, 0xe6, 0x78, 0xb4,
+  0xc8, 0x42, 0xc0, 0x1c, 0x13, 0x16, 0x07, 0x00, 0x98, 0x83, 0x06, 0x5a, 0x08, 0x00, 0x73, 0xd0,
+  0x02, 0x00, 0x00, 0x60, 0x0e, 0x5a, 0x09, 0x2b, 0x04, 0xcc, 0x12, 0x68, 0x72, 0x07, 0x80, 0x59,
+  0xd8, 0x08, 0x2c, 0xb9, 0x33, 0xcb, 0x84, 0x05, 0x00, 0x00, 0x26, 0x0a, 0x8e, 0x16, 0x00, 0xc0,
+  0x44, 0x41, 0x16, 0x02, 0x00, 0x98, 0x28, 0xcc, 0x27, 0x1d, 0x05, 0x13, 0x85, 0x39, 0x29, 0x00,
+  0x60, 0xa2, 0xc2, 0x8a, 0xa3, 0x69, 0x4c, 0x94, 0x64, 0x72, 0xb4, 0x80, 0x89, 0xd2, 0x0c, 0x93,
+  0x02, 0x30, 0x93, 0x2b, 0xb2, 0x10, 0x00, 0x66, 0x9a, 0x34, 0xb9, 0x03, 0xc0, 0x6c, 0x22, 0x05,
+  0x56, 0x08, 0x98, 0x2d, 0xd1, 0x0c, 0x00, 0x00, 0xb3, 0xc1, 0xe2, 0x0e, 0x00, 0x60, 0x36, 0x58,
+  0x1c, 0x05, 0x00, 0xcc, 0x06, 0xd3, 0x4c, 0x03, 0x80, 0xd9, 0xa0, 0x0c, 0xc9, 0x1d, 0x30, 0x1f,
+  0x49, 0x8e, 0x26, 0x77, 0xe6, 0x63, 0x04, 0x00, 0x00, 0xc0, 0x7c, 0x2c, 0xcd, 0x34, 0x00, 0x98,
+  0x8f, 0x3d, 0x47, 0x00, 0x00, 0xf3, 0xb5, 0xe0, 0x08, 0x00, 0x60, 0x3e, 0x19, 0x8a, 0x3b, 0x00,
+  0xcc, 0x27, 0x13, 0x01, 0x00, 0x80, 0xf9, 0x6c, 0x71, 0xc9, 0x51, 0x30, 0x9f, 0x2d, 0x32, 0x30,
+  0x00, 0xe6, 0xbb, 0xac, 0x00, 0x00, 0xc0, 0x84, 0xa5, 0x10, 0x00, 0x00, 0x98, 0xb0, 0x30, 0x96,
+  0x06, 0x00, 0x13, 0x16, 0x47, 0x0b, 0x01, 0x60, 0xc2, 0x22, 0x0b, 0x00, 0x00, 0x4c, 0x58, 0x64,
+  0x21, 0x00, 0x80, 0x09, 0xcb, 0xa4, 0xc9, 0x1d, 0x30, 0x61, 0x99, 0x94, 0x65, 0x00, 0x26, 0x4c,
+  0x8e, 0x16, 0x02, 0xc0, 0x84, 0xb0, 0x00, 0x00, 0x00, 0x98, 0x10, 0x16, 0x59, 0x4c, 0x9d, 0x13,
+  0xc2, 0x22, 0x9f, 0xa3, 0x60, 0x42, 0x98, 0x1c, 0x01, 0x00, 0x4c, 0x08, 0x93, 0x4b, 0x03, 0x80,
+  0x09, 0xa1, 0x0c, 0x34, 0x0d, 0x30, 0x21, 0x95, 0x81, 0x15, 0x02, 0x66, 0xac, 0x8e, 0x26, 0x77,
+  0xc0, 0xa4, 0xa1, 0x55, 0x59, 0x08, 0x98, 0x34, 0xcc, 0x57, 0xe7, 0x9c, 0x93, 0xa2, 0x34, 0x92,
+  0x3b, 0x60, 0xd2, 0x97, 0xe6, 0xab, 0x13, 0x4c, 0xfa, 0x5a, 0xa0, 0x00, 0x80, 0x49, 0x9f, 0x3b,
+  0x85, 0x00, 0x30, 0xe9, 0x93, 0x81, 0x02, 0x00, 0x26, 0x7d, 0xb2, 0xb8, 0x03, 0xc0, 0xa4, 0x4f,
+  0xa6, 0x51, 0x08, 0x98, 0xf4, 0x51, 0x94, 0xdc, 0x01, 0x93, 0x3e, 0x8a, 0x68, 0x21, 0x60, 0xd2,
+  0x47, 0xd3, 0x00, 0x00, 0x4c, 0xfa, 0x2a, 0x01, 0x00, 0x80, 0x49, 0xdf, 0x75, 0x34, 0xb9, 0x33,
+  0xa9, 0x4c, 0x8e, 0x26, 0x5b, 0x66, 0x65, 0x04, 0x00, 0x00, 0xc0, 0xac, 0x2c, 0xb9, 0x01, 0x00,
+  0x98, 0xb5, 0x25, 0x47, 0x00, 0x00, 0xb3, 0x36, 0x98, 0xdc, 0x01, 0x60, 0x56, 0x19, 0x06, 0x2a,
+  0x04, 0xcc, 0x2a, 0x83, 0x23, 0x00, 0x80, 0x59, 0x65, 0x70, 0x85, 0x00, 0x30, 0xab, 0x2c, 0xee,
+  0x00, 0x00, 0x66, 0x95, 0xa7, 0xb8, 0x03, 0xc0, 0xac, 0x32, 0x39, 0x9a, 0xdc, 0x99, 0x55, 0xa6,
+  0x49, 0x0b, 0x01, 0xb3, 0xca, 0x27, 0x0b, 0x01, 0x60, 0x56, 0x49, 0x69, 0x72, 0x00, 0xcc, 0x3a,
+  0x69, 0x91, 0xaf, 0xce, 0x59, 0x29, 0x0a, 0xee, 0x00, 0x30, 0x2b, 0x45, 0x05, 0x00, 0x00, 0x66,
+  0xa5, 0x28, 0xb9, 0x03, 0xc0, 0xac, 0x94, 0xa2, 0x42, 0x00, 0x98, 0x15, 0x57, 0x56, 0x08, 0x00,
+  0x34, 0xb0, 0x91, 0x26, 0x05, 0x80, 0x96, 0x20, 0x12, 0x01, 0x00, 0xd0, 0x32, 0x8a, 0x3b, 0x00,
+  0x00, 0x5a, 0xd8, 0x9c, 0x85, 0x00, 0x40, 0x8b, 0x23, 0x45, 0x66, 0x00, 0x68, 0x71, 0x45, 0xba,
+  0x03, 0x00, 0x2d, 0xee, 0x5d, 0x00, 0x00, 0xa0, 0x65, 0xc2, 0x42, 0x00, 0x00, 0xb4, 0x4c, 0x5a,
+  0x08, 0x00, 0x80, 0x96, 0x49, 0x51, 0x21, 0x00, 0xd0, 0x32, 0x69, 0x1a, 0x00, 0x00, 0x8a, 0xc2,
+  0xa4, 0xac, 0x10, 0x40, 0x9f, 0x2b, 0x00, 0x00, 0x00, 0xe8, 0x93, 0xc1, 0x15, 0x02, 0x00, 0x7d,
+  0xf2, 0x39, 0x02, 0x00, 0xa0, 0x4f, 0xd2, 0x02, 0x00, 0x00, 0xf4, 0xe1, 0x2a, 0x03, 0x03, 0x80,
+  0xca, 0xe4, 0x5e, 0x9d, 0x00, 0x50, 0xf9, 0x68, 0x1a, 0x00, 0x00, 0x2a, 0x5f, 0x9d, 0x69, 0x00,
+  0x40, 0xeb, 0x28, 0x00, 0x00, 0x00, 0x68, 0x95, 0xc5, 0x11, 0x00, 0x00, 0xad, 0x72, 0xa2, 0xe4,
+  0x0e, 0xa8, 0x2c, 0x8c, 0x2a, 0xd3, 0x2a, 0xb6, 0x04, 0x46, 0x0a, 0x01, 0xc0, 0x96, 0xe0, 0x08,
+  0x00, 0x00, 0xd8, 0x12, 0x68, 0x01, 0x00, 0x00, 0x5b, 0x02, 0x2d, 0xee, 0x00, 0x60, 0xcb, 0x28,
+  0x8e, 0x00, 0x00, 0x6c, 0x31, 0xc9, 0xd1, 0xe4, 0x8e, 0x2d, 0x2e, 0x11, 0x00, 0x00, 0xb0, 0x45,
+  0x92, 0x42, 0x00, 0x00, 0xf6, 0xc9, 0xe2, 0x0e, 0x00, 0xc0, 0xbe, 0x3a, 0x0b, 0x01, 0x00, 0xdc,
+  0x12, 0x46, 0x01, 0x00, 0x80, 0x5b, 0xc2, 0x28, 0xb2, 0x00, 0x70, 0x4b, 0x18, 0xa8, 0x10, 0x00,
+  0x6e, 0x09, 0x03, 0xb1, 0x0c, 0xc0, 0x2d, 0x61, 0x24, 0x47, 0xd3, 0xb8, 0x25, 0x8c, 0x0c, 0x00,
+  0x00, 0xb7, 0x84, 0x53, 0x00, 0x00, 0xe0, 0x96, 0x70, 0x8a, 0x3b, 0x00, 0xdc, 0x12, 0xd2, 0xa4,
+  0x00, 0x80, 0x5b, 0x02, 0x23, 0x00, 0x00, 0x70, 0x4b, 0x60, 0x84, 0x15, 0x02, 0x6e, 0x09, 0xac,
+  0x00, 0x00, 0xc0, 0x2d, 0x81, 0x15, 0x47, 0x0b, 0xb9, 0x25, 0xb0, 0xe4, 0x0e, 0x00, 0xb7, 0x04,
+  0xf6, 0x2a, 0x03, 0xe0, 0x96, 0xd0, 0x82, 0x4c, 0xee, 0xdc, 0x12, 0x5a, 0x71, 0x07, 0x80, 0x5b,
+  0x42, 0x4b, 0x13, 0x01, 0x70, 0x4b, 0x70, 0x04, 0x00, 0x00, 0x6e, 0x09, 0xee, 0x14, 0x02, 0xc0,
+  0x2d, 0xc1, 0x51, 0x00, 0x00, 0xb8, 0x25, 0x38, 0x5a, 0x08, 0x00, 0xb7, 0x04, 0x47, 0x93, 0x03,
+  0xe0, 0x96, 0xe0, 0x68, 0x7a, 0x75, 0xde, 0x12, 0x1c, 0xcd, 0x00, 0x80, 0x5b, 0x02, 0x0c, 0xac,
+  0x10, 0x70, 0x4b, 0x80, 0x05, 0x00, 0x00, 0x6e, 0x09, 0x30, 0xb9, 0x03, 0xc0, 0x2d, 0x41, 0x06,
+  0x17, 0x18, 0xb8, 0x25, 0xc8, 0x20, 0x5f, 0x65, 0xb7, 0x04, 0x59, 0x00, 0x00, 0xe0, 0x96, 0x20,
+  0x0b, 0x01, 0x00, 0xdc, 0x12, 0x64, 0x71, 0x00, 0x80, 0x5b, 0x82, 0x2c, 0xae, 0x10, 0x70, 0x4b,
+  0x90, 0xc5, 0x51, 0x00, 0x6e, 0x09, 0x12, 0x15, 0x02, 0xc0, 0x2d, 0x41, 0xa6, 0x51, 0x08, 0xb8,
+  0x25, 0xc8, 0x44, 0x00, 0x00, 0xb7, 0x04, 0x99, 0x1c, 0x05, 0xe0, 0x96, 0x20, 0x93, 0xa3, 0x69,
+  0xdc, 0x12, 0x64, 0x9a, 0xa8, 0x80, 0x5b, 0x82, 0x4c, 0x33, 0xb9, 0x73, 0x4b, 0x90, 0x6e, 0x04,
+  0x06, 0x6e, 0x09, 0x33, 0xb8, 0x03, 0xc0, 0x2d, 0x61, 0xa2, 0x42, 0x00, 0xb8, 0x25, 0x4c, 0xc4,
+  0x00, 0x00, 0xb7, 0x84, 0xf9, 0x2a, 0x03, 0xe0, 0x96, 0x30, 0x5f, 0x9d, 0x00, 0xdc, 0x12, 0xe6,
+  0x44, 0x81, 0x81, 0x5b, 0xc2, 0x9c, 0x14, 0x00, 0x70, 0x4b, 0x98, 0x93, 0x16, 0x00, 0x6e, 0x09,
+  0x93, 0xa6, 0x01, 0xc0, 0x2d, 0x61, 0xd2, 0xe4, 0x0e, 0xb8, 0x25, 0xd0, 0x02, 0x00, 0x00, 0xb7,
+  0x04, 0x5a, 0x08, 0x00, 0xe0, 0x96, 0x40, 0x8b, 0x2b, 0xee, 0xdc, 0x12, 0x68, 0x71, 0x07, 0x80,
+  0x5b, 0x02, 0x2d, 0x8e, 0xa6, 0x71, 0x4b, 0xa0, 0x45, 0xbe, 0x3a, 0x6f, 0x09, 0x14, 0x99, 0xca,
+  0xc0, 0x2d, 0x81, 0xa2, 0xe4, 0x0e, 0xb8, 0x25, 0xd0, 0xe4, 0x28, 0x00, 0xb7, 0x04, 0xfa, 0xdc,
+  0x01, 0xe0, 0x96, 0x40, 0x65, 0x21, 0x00, 0xdc, 0x12, 0x28, 0x4d, 0xaf, 0xce, 0x5b, 0x42, 0xc5,
+  0x85, 0x00, 0x70, 0x4b, 0xb0, 0x85, 0x00, 0x00, 0x6e, 0x09, 0x36, 0xb9, 0x03, 0xc0, 0x2d, 0x23,
+  0xb0, 0xe4, 0x0e, 0xb8, 0x65, 0x04, 0x47, 0x00, 0x00, 0xb7, 0x8c, 0xe0, 0x0e, 0x00, 0xe0, 0x96,
+  0x11, 0xe4, 0x00, 0x00, 0xdc, 0x32, 0x0a, 0x00, 0x00, 0x80, 0x5b, 0x46, 0x71, 0x07, 0x00, 0x70,
+  0xcb, 0x28, 0x2e, 0x0d, 0x00, 0x6e, 0x19, 0xc5, 0x25, 0x47, 0xc1, 0x2d, 0xa3, 0x38, 0x9a, 0x1c,
+  0xbd, 0x65, 0xa0, 0x02, 0x00, 0x00, 0xb7, 0x0c, 0x54, 0x64, 0x01, 0xe0, 0x96, 0x91, 0x46, 0x72,
+  0x00, 0xdc, 0x32, 0x92, 0x3b, 0x00, 0x80, 0x5b, 0xc6, 0x2a, 0x0e, 0x00, 0x70, 0xcb, 0x78, 0x12,
+  0x00, 0x00, 0x6e, 0x19, 0x4f, 0xbe, 0xca, 0xc0, 0x2d, 0xe3, 0x55, 0x19, 0xdc, 0xb9, 0x65, 0xd4,
+  0x99, 0x1c, 0x05, 0xb7, 0x90, 0xe2, 0x68, 0x72, 0xe7, 0x16, 0x92, 0x08, 0x00, 0x00, 0xdc, 0x42,
+  0x12, 0xb9, 0x00, 0x80, 0x5b, 0x8a, 0xa3, 0x69, 0x00, 0x70, 0x4b, 0x71, 0x94, 0x15, 0x02, 0x6e,
+  0x29, 0x32, 0xc8, 0x57, 0xd9, 0x2d, 0x26, 0x50, 0x00, 0x00, 0xb8, 0xc5, 0x14, 0x00, 0x00, 0x00,
+  0xb7, 0x98, 0x42, 0x00, 0x00, 0xe0, 0x16, 0x53, 0x58, 0x06, 0x00, 0xdc, 0x62, 0x8a, 0x0b, 0x0c,
+  0x80, 0x5b, 0x4c, 0x71, 0x04, 0x00, 0x70, 0x8b, 0x29, 0x2e, 0xb9, 0x03, 0x6e, 0x31, 0xc5, 0x65,
+  0x00, 0xc0, 0x2d, 0xa6, 0x48, 0x02, 0x00, 0xb8, 0xc5, 0x14, 0x59, 0x00, 0x00, 0xb7, 0x98, 0x22,
+  0x5f, 0x65, 0xe0, 0x16, 0x93, 0xdc, 0x01, 0x00, 0xdc, 0x62, 0x18, 0x09, 0xee, 0x80, 0x5b, 0x0c,
+  0x2b, 0x04, 0x00, 0x70, 0x8b, 0x61, 0xc9, 0x1d, 0x00, 0x6e, 0x31, 0x34, 0x03, 0x00, 0xc0, 0x2d,
+  0xa6, 0xca, 0x02, 0x00, 0xb8, 0xc5, 0x54, 0x99, 0x01, 0x00, 0xb7, 0x1c, 0x54, 0x00, 0x00, 0xe0,
+  0x96, 0x53, 0x65, 0x71, 0x07, 0xdc, 0xc2, 0x02, 0x29, 0x04, 0x80, 0x5b, 0x58, 0x70, 0x04, 0x00,
+  0x70, 0x0b, 0x1b, 0x65, 0xa2, 0x42, 0x6e, 0x61, 0x04, 0x00, 0x00, 0xc0, 0x2d, 0x8c, 0x14, 0x02,
+  0x00, 0xb8, 0x85, 0x91, 0xe4, 0x0e, 0x00, 0xb7, 0x30, 0x02, 0xd3, 0x00, 0xe0, 0x16, 0x46, 0x26,
+  0x05, 0x00, 0xdc, 0xc2, 0xd2, 0x00, 0x00, 0x80, 0x5b, 0x58, 0x1a, 0x69, 0x00, 0x70, 0x0b, 0x4b,
+  0x04, 0x00, 0x00, 0x6e, 0x61, 0xc9, 0x11, 0x00, 0xc0, 0x2d, 0x2c, 0x39, 0x52, 0x00, 0xb8, 0x85,
+  0x25, 0x97, 0x06, 0x00, 0xb7, 0xb0, 0xe4, 0x28, 0x00, 0xe0, 0x16, 0xc6, 0x8a, 0x2c, 0x04, 0xdc,
+  0xc2, 0xd8, 0x73, 0x07, 0x80, 0x5b, 0x18, 0x7b, 0x95, 0x15, 0x72, 0x0b, 0x6b, 0x05, 0x00, 0x00,
+  0x6e, 0x61, 0x8f, 0x25, 0x77, 0xc0, 0x2d, 0xec, 0xb9, 0x42, 0x00, 0xb8, 0x85, 0x3d, 0x77, 0x00,
+  0x00, 0xb7, 0xb0, 0x27, 0x0b, 0x01, 0xe0, 0x16, 0x36, 0x9f, 0x4c, 0xee, 0xdc, 0xc2, 0x68, 0x01,
+  0x00, 0x80, 0x5b, 0x58, 0x25, 0xac, 0x10, 0x70, 0x0b, 0xab, 0x2c, 0x03, 0x00, 0x6e, 0x61, 0x55,
+  0x16, 0x02, 0xc0, 0x2d, 0x2d, 0x8c, 0x34, 0x00, 0xb8, 0xa5, 0x05, 0x77, 0x00, 0x00, 0xb7, 0x34,
+  0x11, 0x28, 0x00, 0xe0, 0x16, 0x17, 0x18, 0x00, 0x00, 0xdc, 0xe2, 0x82, 0x2c, 0x04, 0x80, 0x5b,
+  0x1c, 0x01, 0x00, 0x00, 0x70, 0x8b, 0x23, 0xc5, 0x1d, 0x00, 0x6e, 0x71, 0xa4, 0xc8, 0x57, 0xd9,
+  0x2d, 0x8e, 0x94, 0x89, 0x0a, 0xb9, 0xc5, 0x91, 0xe4, 0x0e, 0x00, 0xb7, 0x38, 0x92, 0x5e, 0x2b,
+  0xe4, 0x16, 0x47, 0x58, 0x70, 0x07, 0xdc, 0xe2, 0x08, 0x2b, 0x04, 0x80, 0x5b, 0x5c, 0x21, 0x00,
+  0x00, 0x70, 0x8b, 0x2b, 0x84, 0x15, 0x02, 0x6e, 0x71, 0x45, 0x06, 0x59, 0xc8, 0x2d, 0xae, 0xc8,
+  0x42, 0x00, 0xb8, 0xc5, 0x15, 0xf9, 0x64, 0x21, 0xb7, 0xb8, 0xe4, 0x82, 0x2c, 0xe4, 0x16, 0x47,
+  0x11, 0x00, 0x00, 0xdc, 0x02, 0x83, 0x4b, 0x03, 0x80, 0x5b, 0x60, 0x70, 0x14, 0x00, 0x70, 0x0b,
+  0x2c, 0x2e, 0x0d, 0x00, 0x6e, 0x81, 0xc5, 0xa5, 0x57, 0xe7, 0x2d, 0xb0, 0xc8, 0x42, 0x00, 0xb8,
+  0x05, 0xa6, 0x91, 0xdc, 0x01, 0xb7, 0x40, 0xc6, 0x00, 0x00, 0xe0, 0x16, 0x28, 0x0b, 0x01, 0x00,
+  0xdc, 0x22, 0x03, 0x4b, 0xee, 0x80, 0x5b, 0x64, 0x70, 0x04, 0x00, 0x70, 0x8b, 0x0c, 0xb4, 0x10,
+  0x00, 0x6e, 0x91, 0x81, 0x16, 0x77, 0xc0, 0x2d, 0x52, 0x04, 0x5a, 0x08, 0xb8, 0x45, 0x0e, 0xca,
+  0x0a, 0x00, 0xb7, 0x48, 0x02, 0x00, 0x00, 0xe0, 0x16, 0x49, 0x0a, 0x00, 0x00, 0xdc, 0x22, 0x0b,
+  0x00, 0x00, 0x80, 0x5b, 0x64, 0x21, 0x00, 0x00, 0x70, 0x8b, 0x2c, 0x6e, 0x04, 0x06, 0x6e, 0x91,
+  0xc5, 0x11, 0x00, 0xc0, 0x2d, 0xb2, 0xb8, 0xf4, 0xea, 0xbc, 0x45, 0x16, 0x47, 0x93, 0x2d, 0xb7,
+  0xc8, 0x22, 0x03, 0x03, 0xe0, 0x16, 0x59, 0x64, 0x01, 0x00, 0xdc, 0x22, 0xcb, 0xa4, 0xc9, 0x9d,
+  0x5b, 0x64, 0x22, 0x00, 0x00, 0x70, 0x8b, 0x4c, 0x6e, 0x04, 0x47, 0x6f, 0x91, 0xc9, 0x15, 0x02,
+  0xc0, 0x2d, 0x32, 0xb9, 0xe4, 0x00, 0xb8, 0x45, 0xa6, 0x99, 0x5e, 0x9d, 0xb7, 0xc8, 0x06, 0x00,
+  0x00, 0xe0, 0x16, 0xd9, 0x8a, 0x2c, 0x00, 0xdc, 0x22, 0xdd, 0x29, 0x00, 0x80, 0x5b, 0xe4, 0x93,
+  0x85, 0x00, 0x70, 0x8b, 0xa4, 0x85, 0x00, 0x00, 0x6e, 0x99, 0xa8, 0xb8, 0xc0, 0xc0, 0x2d, 0x13,
+  0x25, 0x07, 0x00, 0xb8, 0x65, 0x26, 0x57, 0x08, 0x00, 0xb7, 0xcc, 0xe4, 0xd2, 0x00, 0xe0, 0x96,
+  0x99, 0x26, 0x4d, 0xee, 0xdc, 0x32, 0x61, 0x21, 0x00, 0x80, 0x5b, 0x26, 0x2c, 0xb2, 0x00, 0x70,
+  0xcb, 0x84, 0x65, 0x52, 0x00, 0x6e, 0x99, 0x30, 0xb9, 0x14, 0xd8, 0x2d, 0x13, 0x26, 0x47, 0xd3,
+  0xb8, 0x65, 0xc2, 0x34, 0x0b, 0x00, 0xb7, 0x4c, 0xf8, 0x5a, 0xb2, 0xe5, 0x96, 0x09, 0x9f, 0x3b,
+  0x00, 0xdc, 0x32, 0xe1, 0xab, 0xb2, 0x90, 0x5b, 0xe6, 0x9c, 0x69, 0x00, 0x70, 0xcb, 0xa4, 0x00,
+  0x00, 0x00, 0x6e, 0x99, 0x34, 0xb0, 0x42, 0xc0, 0x2d, 0x93, 0x06, 0x9a, 0x02, 0xbb, 0x65, 0xd2,
+  0x02, 0x00, 0x00, 0xb7, 0x4c, 0x5a, 0x08, 0x00, 0xe0, 0x96, 0x49, 0x8b, 0x03, 0x00, 0xdc, 0x32,
+  0x69, 0x71, 0x81, 0x81, 0x5b, 0x26, 0x2d, 0xee, 0x00, 0x70, 0xcb, 0xa4, 0x45, 0x16, 0x00, 0x6e,
+  0x99, 0xb4, 0xc8, 0xe4, 0xce, 0x2d, 0x93, 0x16, 0xf9, 0xea, 0xbc, 0x65, 0xd2, 0x32, 0x8b, 0x3b,
+  0xb7, 0x4c, 0x8a, 0x0a, 0x01, 0xe0, 0x96, 0x49, 0x91, 0xa9, 0x0c, 0xdc, 0x32, 0x29, 0x4a, 0x03,
+  0x80, 0x5b, 0x26, 0x45, 0x69, 0x04, 0x76, 0xcb, 0xa4, 0x28, 0xb9, 0x03, 0x6e, 0x99, 0x14, 0xb1,
+  0x02, 0xc0, 0x2d, 0x93, 0x22, 0x5a, 0x08, 0xb8, 0x65, 0x52, 0x44, 0x93, 0x2d, 0xb7, 0x4c, 0x9a,
+  0x46, 0x60, 0xe0, 0x96, 0x49, 0x13, 0x01, 0x00, 0xdc, 0x32, 0x69, 0x72, 0x00, 0x80, 0x5b, 0x26,
+  0x4d, 0x2e, 0xb8, 0x73, 0xcb, 0xa4, 0xc9, 0x11, 0x00, 0x6e, 0x99, 0x34, 0xb9, 0x03, 0xc0, 0x2d,
+  0x93, 0x26, 0x47, 0x01, 0xb8, 0x65, 0xd2, 0xe4, 0x68, 0x1a, 0xb7, 0x4c, 0x9a, 0x66, 0x21, 0xe0,
+  0x96, 0x49, 0xd3, 0x44, 0x00, 0xdc, 0x32, 0x69, 0x9a, 0x14, 0x80, 0x5b, 0x26, 0x4d, 0xb6, 0x10,
+  0x70, 0xcb, 0xa4, 0xac, 0x10, 0x00, 0x6e, 0x99, 0x54, 0x12, 0x00, 0xc0, 0x2d, 0x93, 0x56, 0x96,
+  0xdc, 0xb9, 0x65, 0x56, 0x02, 0x00, 0x00, 0xb7, 0xcc, 0xca, 0x00, 0x00, 0xe0, 0x16, 0x5a, 0xdc,
+  0x01, 0x00, 0xdc, 0x42, 0xe5, 0x93, 0x85, 0x80, 0x5b, 0x6c, 0x91, 0xc9, 0x1d, 0x70, 0xcb, 0x65,
+  0xcc, 0x16, 0x02, 0x2e, 0x0a, 0xa7, 0x10, 0x00, 0xc0, 0x45, 0xe1, 0x14, 0x99, 0x01, 0xb8, 0x28,
+  0xac, 0xe2, 0x68, 0x1a, 0x17, 0x05, 0x56, 0x1c, 0x05, 0xe0, 0xa2, 0xd0, 0x82, 0x3b, 0x00, 0x5c,
+  0x14, 0x5a, 0x72, 0xc9, 0x9d, 0x8b, 0x42, 0x9b, 0xcf, 0x51, 0x70, 0x51, 0x70, 0xb4, 0x10, 0x00,
+  0x2e, 0x0a, 0x10, 0x99, 0x3a, 0xc1, 0x45, 0x41, 0x06, 0x06, 0x00, 0xb8, 0x28, 0xc8, 0x42, 0x00,
+  0x00, 0x17, 0x05, 0x59, 0xdc, 0x01, 0xe0, 0xa2, 0x20, 0x8b, 0x2c, 0x04, 0x5c, 0x14, 0x64, 0x91,
+  0xc9, 0x9d, 0x8b, 0x82, 0x4c, 0x23, 0x30, 0x70, 0x51, 0x90, 0xc9, 0xd1, 0x34, 0x2e, 0x0a, 0xf2,
+  0xb9, 0xc0, 0xc0, 0x45, 0x61, 0x06, 0x77, 0x00, 0xb8, 0x28, 0x4c, 0x94, 0x01, 0x00, 0x17, 0x85,
+  0x49, 0x0b, 0x01, 0xe0, 0xa2, 0x30, 0x69, 0x99, 0x73, 0x5e, 0x14, 0x26, 0x4d, 0x03, 0x80, 0x8b,
+  0xc2, 0xa4, 0xc9, 0x1d, 0x70, 0x51, 0xa0, 0x81, 0x26, 0x5b, 0x2e, 0x0a, 0x34, 0x0d, 0x00, 0xc0,
+  0x45, 0x81, 0x26, 0x02, 0x00, 0xb8, 0x28, 0xd0, 0xe4, 0x0e, 0x00, 0x17, 0x95, 0x30, 0x0a, 0x01,
+  0xe0, 0xa2, 0x32, 0x02, 0x2b, 0x04, 0x5c, 0x54, 0x58, 0x21, 0x00, 0x80, 0x8b, 0xd2, 0x40, 0x85,
+  0x00, 0x70, 0x51, 0x72, 0xa7, 0x10, 0x00, 0x2e, 0x4a, 0x8e, 0x16, 0x02, 0xc0, 0x45, 0xc9, 0xd1,
+  0xe4, 0x0a, 0xb9, 0x28, 0x39, 0x9a, 0xdc, 0x01, 0x17, 0x25, 0x47, 0x93, 0xa3, 0xe0, 0xa2, 0x34,
+  0x51, 0x21, 0x00, 0x5c, 0x94, 0x66, 0x72, 0x07, 0x80, 0x8b, 0xd2, 0x9c, 0x88, 0x02, 0x70, 0x51,
+  0x9a, 0xb4, 0xc8, 0x42, 0x2e, 0x4a, 0x93, 0x26, 0x57, 0xc8, 0x45, 0xaf, 0x25, 0x47, 0x01, 0xb8,
+  0xe8, 0xc9, 0x57, 0xe7, 0x9c, 0x17, 0x3d, 0x5a, 0x1c, 0x2d, 0xe4, 0xa2, 0x47, 0x91, 0xa9, 0x13,
+  0xdc, 0x24, 0xd2, 0x48, 0xaf, 0xce, 0x9b, 0x44, 0x92, 0xe9, 0xd5, 0x79, 0x93, 0x48, 0xb4, 0x10,
+  0x00, 0x6e, 0x12, 0xec, 0xb9, 0x03, 0xc0, 0x4d, 0x23, 0xb8, 0x03, 0x00, 0xb8, 0x69, 0x14, 0x47,
+  0x00, 0x00, 0x37, 0x8d, 0xe2, 0x0a, 0x00, 0xe0, 0xa6, 0x51, 0xdc, 0x01, 0x00, 0xdc, 0x34, 0x8a,
+  0xa3, 0x69, 0x80, 0x9b, 0xc6, 0x23, 0x00, 0x00, 0x70, 0xd3, 0xa8, 0x45, 0x06, 0x06, 0x6e, 0x22,
+  0x85, 0xa5, 0xc0, 0xc0, 0x4d, 0xc5, 0x11, 0x00, 0x00, 0xb8, 0xc9, 0x14, 0x00, 0x00, 0x00, 0x37,
+  0x99, 0x32, 0x50, 0x21, 0xe0, 0x26, 0x53, 0x08, 0x00, 0x00, 0xdc, 0x64, 0x0a, 0x4b, 0xee, 0x80,
+  0x9b, 0x4c, 0x71, 0xc9, 0x1d, 0x70, 0x93, 0x29, 0xee, 0x55, 0x06, 0x6e, 0x32, 0xc5, 0xd1, 0xe4,
+  0xe8, 0x4d, 0xa6, 0xb8, 0x0c, 0x00, 0xb8, 0xc9, 0x14, 0x99, 0x02, 0x03, 0x37, 0x99, 0x32, 0xd3,
+  0xab, 0xf3, 0x26, 0x93, 0x46, 0x72, 0x07, 0xdc, 0x64, 0x68, 0x21, 0x00, 0x80, 0x9b, 0x0c, 0x45,
+  0x85, 0x00, 0x70, 0x93, 0xa9, 0x52, 0x30, 0x00, 0x6e, 0x32, 0x55, 0x16, 0x02, 0xc0, 0x4d, 0x27,
+  0x10, 0x00, 0x00, 0xb8, 0xe9, 0x04, 0x96, 0x06, 0x00, 0x37, 0x9d, 0xc0, 0x92, 0x3b, 0xe0, 0xa6,
+  0x13, 0x5a, 0x01, 0x00, 0xdc, 0x74, 0x82, 0xa3, 0x85, 0x80, 0x9b, 0x4e, 0x90, 0xc9, 0xd1, 0x72,
+  0xd3, 0x09, 0xb4, 0x10, 0x00, 0x6e, 0x3a, 0x05, 0x00, 0x00, 0xc0, 0x4d, 0xa7, 0x18, 0x00, 0x00,
+  0xb8, 0xe9, 0x14, 0x17, 0x64, 0x21, 0x37, 0x9d, 0xe2, 0x08, 0x00, 0xe0, 0xa6, 0x53, 0xdc, 0x01,
+  0x00, 0xdc, 0x74, 0x8a, 0x4b, 0x0e, 0x80, 0x9b, 0x4e, 0x71, 0xc9, 0x51, 0x70, 0xd3, 0x29, 0xb2,
+  0x10, 0x00, 0x6e, 0x3a, 0x45, 0x96, 0x39, 0xc1, 0x4d, 0xa7, 0xc8, 0x0c, 0x00, 0xb8, 0xe9, 0x94,
+  0x59, 0x08, 0x00, 0x37, 0x9d, 0x32, 0x29, 0x00, 0xe0, 0xa6, 0x53, 0x26, 0x2d, 0x04, 0xdc, 0x74,
+  0x0e, 0x2a, 0xb3, 0x90, 0x9b, 0x0e, 0x22, 0x00, 0x00, 0x70, 0xd3, 0x41, 0x05, 0x00, 0x00, 0x6e,
+  0x3a, 0xa8, 0x10, 0x00, 0xc0, 0x4d, 0x07, 0x15, 0x99, 0x01, 0xb8, 0xe9, 0x20, 0x03, 0x00, 0x00,
+  0x37, 0x1d, 0x94, 0x5c, 0x60, 0xe0, 0xa6, 0x83, 0x92, 0x3b, 0x00, 0xdc, 0x74, 0x50, 0xb2, 0x05,
+  0x80, 0x9b, 0x0e, 0x62, 0xc9, 0x51, 0x70, 0xd3, 0x41, 0xb4, 0x10, 0x00, 0x6e, 0x3a, 0x88, 0xa6,
+  0x01, 0xc0, 0x4d, 0x27, 0x8d, 0x34, 0x00, 0xb8, 0xe9, 0xa4, 0x53, 0x08, 0x00, 0x37, 0x9d, 0xe4,
+  0x06, 0x00, 0xe0, 0xa6, 0x93, 0x1c, 0x01, 0x00, 0xdc, 0x74, 0x92, 0x4b, 0xee, 0x80, 0x9b, 0x4e,
+  0x72, 0x14, 0x00, 0x70, 0xd3, 0x49, 0x4f, 0x16, 0x02, 0x6e, 0x3a, 0xe9, 0xd1, 0x42, 0xc0, 0x4d,
+  0x27, 0xcd, 0x0c, 0x00, 0xb8, 0xe9, 0x24, 0x5b, 0x00, 0x00, 0x37, 0x9d, 0x27, 0x58, 0x72, 0xe0,
+  0xa6, 0xf3, 0x58, 0x1a, 0x00, 0xdc, 0x74, 0x9e, 0x2c, 0x04, 0x80, 0x9b, 0x8e, 0x0c, 0xee, 0x00,
+  0x70, 0xd3, 0xa9, 0xee, 0x00, 0x00, 0x6e, 0x3a, 0x55, 0x06, 0x77, 0xc0, 0x4d, 0xa7, 0xca, 0x02,
+  0x00, 0xb8, 0xe9, 0xe8, 0xe4, 0x00, 0x00, 0x37, 0xb1, 0x20, 0x58, 0x21, 0xe0, 0x26, 0x16, 0x06,
+  0x00, 0x00, 0xdc, 0xc4, 0xc2, 0x08, 0x0c, 0x80, 0x9b, 0x58, 0x18, 0xe9, 0xd5, 0x79, 0x13, 0x0b,
+  0xac, 0x10, 0x00, 0x6e, 0x62, 0x83, 0x26, 0x47, 0xc1, 0x4d, 0x6c, 0x54, 0x19, 0x18, 0xb8, 0x89,
+  0x11, 0x00, 0x00, 0x00, 0x37, 0x31, 0x52, 0x08, 0x00, 0xe0, 0x26, 0x46, 0xd2, 0x00, 0x00, 0xdc,
+  0xc4, 0x4c, 0x65, 0x85, 0x80, 0x9b, 0x58, 0x0a, 0x0e, 0x00, 0x70, 0x13, 0x4b, 0x83, 0x02, 0x00,
+  0x6e, 0x62, 0x89, 0x00, 0x00, 0xc0, 0x4d, 0x2c, 0x1d, 0x54, 0x08, 0xb8, 0x89, 0x25, 0x47, 0x00,
+  0x00, 0x37, 0xb1, 0xe4, 0x0e, 0x00, 0xe0, 0x26, 0x96, 0x5e, 0x9d, 0x13, 0xdc, 0xc4, 0x92, 0x2c,
+  0x00, 0x80, 0x9b, 0x58, 0x92, 0x45, 0x16, 0x72, 0x13, 0x4b, 0xb4, 0x00, 0x00, 0x6e, 0x62, 0x8c,
+  0x00, 0x00, 0xc0, 0x4d, 0x8c, 0x15, 0x00, 0x00, 0xb8, 0x89, 0xb1, 0xe2, 0x0e, 0x00, 0x37, 0x31,
+  0x56, 0x1c, 0x4d, 0xe3, 0x26, 0xc6, 0xca, 0x2c, 0x00, 0xdc, 0xc4, 0x58, 0x1a, 0x00, 0x80, 0x9b,
+  0x18, 0x4b, 0x23, 0x30, 0x70, 0x13, 0x63, 0xc9, 0x15, 0x02, 0x6e, 0x62, 0x8c, 0x15, 0x02, 0xc0,
+  0x4d, 0x8c, 0xbd, 0x56, 0x08, 0xb8, 0x89, 0xb1, 0x27, 0x0b, 0x01, 0x37, 0xb1, 0x26, 0x58, 0x21,
+  0xe0, 0x26, 0xd6, 0x92, 0x3b, 0x00, 0xdc, 0xc4, 0x5a, 0x72, 0x14, 0x80, 0x9b, 0xd8, 0x63, 0x85,
+  0x00, 0x70, 0x13, 0x7b, 0x2d, 0x50, 0x00, 0x6e, 0x62, 0xaf, 0x25, 0x77, 0xc0, 0x4d, 0xec, 0xb9,
+  0xf4, 0xea, 0xbc, 0x89, 0x3d, 0x19, 0x64, 0x06, 0x37, 0xb1, 0x27, 0x03, 0x4d, 0xe3, 0x26, 0xf6,
+  0x64, 0x21, 0x00, 0xdc, 0xc4, 0x9e, 0x34, 0x95, 0x81, 0x9b, 0xd8, 0xa3, 0xaf, 0xce, 0x79, 0x13,
+  0x7b, 0x37, 0xc8, 0x42, 0x6e, 0x62, 0xb4, 0x04, 0x9a, 0xc6, 0x4d, 0x8c, 0xa6, 0x11, 0x18, 0xb8,
+  0x89, 0x55, 0x96, 0x5e, 0x9d, 0x37, 0xb1, 0x2a, 0x09, 0x00, 0xe0, 0x26, 0x56, 0x65, 0x9a, 0x13,
+  0xdc, 0xc4, 0xea, 0x4c, 0x8e, 0x82, 0x9b, 0x5a, 0x70, 0xe9, 0xd5, 0x79, 0x53, 0x0b, 0x8e, 0x26,
+  0x07, 0x6e, 0x6a, 0x22, 0xb0, 0x42, 0xc0, 0x4d, 0x2d, 0x0d, 0x00, 0x00, 0xb8, 0xa9, 0xa5, 0x11,
+  0xdc, 0x01, 0x37, 0xb5, 0x34, 0x0a, 0x01, 0xe0, 0xa6, 0x96, 0x1c, 0x4d, 0x0e, 0xdc, 0xd4, 0xe0,
+  0x93, 0xee, 0x80, 0x9b, 0x1a, 0xa4, 0xc9, 0x1d, 0x70, 0x93, 0x0b, 0x42, 0x16, 0x02, 0x6e, 0x72,
+  0x61, 0x00, 0x00, 0xc0, 0x4d, 0x2e, 0x8c, 0x42, 0x00, 0xb8, 0xc9, 0x85, 0x91, 0xdc, 0x01, 0x37,
+  0xb9, 0x50, 0x5c, 0x22, 0xe0, 0x26, 0x17, 0x58, 0x06, 0x00, 0xdc, 0xe4, 0x82, 0x23, 0x00, 0x80,
+  0x9b, 0x5c, 0x70, 0x85, 0x00, 0x70, 0x93, 0x0b, 0xee, 0x00, 0x00, 0x6e, 0x72, 0xc1, 0x25, 0x77,
+  0xc0, 0x4d, 0x2e, 0x38, 0x9a, 0xdc, 0xb9, 0xc9, 0x05, 0x19, 0x28, 0x00, 0x37, 0xb9, 0x20, 0x0b,
+  0x00, 0xe0, 0x26, 0x17, 0x64, 0x21, 0x00, 0xdc, 0xe4, 0x82, 0x4c, 0xae, 0x90, 0x9b, 0x5c, 0xa0,
+  0x85, 0x00, 0x70, 0x93, 0x0b, 0xb4, 0xc8, 0x42, 0x6e, 0x72, 0x81, 0x26, 0x07, 0xc0, 0x4d, 0x8e,
+  0x00, 0x00, 0x00, 0xb8, 0xc9, 0x91, 0x02, 0x00, 0x00, 0x37, 0x39, 0x52, 0x08, 0x00, 0xe0, 0x26,
+  0x47, 0x8a, 0x03, 0x00, 0xdc, 0xe4, 0x48, 0x71, 0x07, 0x80, 0x9b, 0x1c, 0x29, 0x8e, 0xa6, 0x71,
+  0x93, 0x23, 0x05, 0x52, 0x00, 0x6e, 0x72, 0xa4, 0xc8, 0x42, 0xc0, 0x4d, 0x8e, 0x14, 0xf9, 0xea,
+  0xbc, 0xc9, 0x91, 0x32, 0x51, 0x21, 0x37, 0x39, 0x92, 0x06, 0x00, 0xe0, 0x26, 0x47, 0xd2, 0x28,
+  0x04, 0xdc, 0xe4, 0x48, 0x22, 0x00, 0x80, 0x9b, 0x1c, 0x49, 0xa6, 0x32, 0x70, 0x93, 0x23, 0xc9,
+  0x1d, 0x00, 0x6e, 0x72, 0x24, 0xb9, 0xe4, 0xc0, 0x4d, 0x8e, 0x24, 0x47, 0x0b, 0xb8, 0xc9, 0x91,
+  0xf4, 0xdc, 0x01, 0x37, 0x39, 0x92, 0x66, 0x1a, 0xe0, 0x26, 0x47, 0x18, 0x00, 0x00, 0xdc, 0xe4,
+  0x08, 0x2b, 0x04, 0x80, 0x9b, 0x1c, 0x61, 0x19, 0x00, 0x70, 0x93, 0x23, 0x8f, 0xa6, 0x55, 0x6e,
+  0x72, 0x64, 0x26, 0x53, 0xe7, 0x4d, 0x8e, 0xcc, 0x0c, 0x00, 0xb8, 0xc9, 0x91, 0x0c, 0x00, 0x00,
+  0x37, 0xb9, 0x02, 0x00, 0x00, 0xe0, 0x26, 0x57, 0x02, 0x2b, 0x04, 0xdc, 0xe4, 0x0a, 0x01, 0x00,
+  0x80, 0x9b, 0x5c, 0x31, 0x95, 0x01, 0x70, 0x93, 0x2b, 0xac, 0x10, 0x00, 0x6e, 0x72, 0x85, 0xa5,
+  0x01, 0xc0, 0x4d, 0xae, 0xb0, 0x0c, 0x00, 0xb8, 0xc9, 0x15, 0x37, 0x00, 0x00, 0x37, 0xb9, 0xe2,
+  0x08, 0x00, 0xe0, 0x26, 0x57, 0x5c, 0x21, 0x00, 0xdc, 0xe4, 0x8a, 0x3b, 0x00, 0x80, 0x9b, 0x5c,
+  0x71, 0xa7, 0x00, 0x70, 0x93, 0x2b, 0x2e, 0xb9, 0x03, 0x6e, 0x72, 0xc5, 0x4d, 0x0a, 0xc0, 0x4d,
+  0xae, 0x38, 0x0a, 0x00, 0xb8, 0xc9, 0x15, 0x47, 0x0b, 0x01, 0x37, 0xb9, 0xe2, 0x68, 0x0a, 0xec,
+  0x26, 0x57, 0x1c, 0x4d, 0xee, 0xdc, 0xe4, 0x8a, 0xa3, 0x14, 0x80, 0x9b, 0x5c, 0x91, 0x81, 0x01,
+  0x70, 0x93, 0x2b, 0x32, 0xb0, 0x42, 0x6e, 0x72, 0x45, 0x06, 0x77, 0xc0, 0x4d, 0xae, 0xc8, 0x42,
+  0x00, 0xb8, 0xc9, 0x15, 0x69, 0x00, 0x00, 0x37, 0xb9, 0x22, 0xd3, 0x00, 0xe0, 0x26, 0x57, 0x64,
+  0x72, 0x07, 0xdc, 0xe4, 0xca, 0x4c, 0xee, 0x80, 0x9b, 0x5c, 0x99, 0x34, 0x05, 0x76, 0x93, 0x3b,
+  0xc5, 0x01, 0x00, 0x6e, 0x72, 0xa7, 0xb8, 0x03, 0xc0, 0x4d, 0xee, 0x14, 0x47, 0x0b, 0xb9, 0xc9,
+  0x9d, 0x22, 0x0b, 0x01, 0x37, 0xb9, 0x83, 0x0a, 0x01, 0xe0, 0x26, 0x77, 0xaa, 0xa3, 0x69, 0xdc,
+  0xe4, 0xd2, 0x00, 0x00, 0x80, 0x9b, 0x5c, 0x1a, 0xc9, 0x1d, 0x70, 0x93, 0x4b, 0x04, 0x00, 0x00,
+  0x6e, 0x72, 0x89, 0xb0, 0x02, 0xc0, 0x4d, 0x2e, 0xb9, 0x01, 0x00, 0xb8, 0xc9, 0x25, 0x47, 0x00,
+  0x00, 0x37, 0xb9, 0xe4, 0x0e, 0x00, 0xe0, 0x26, 0x97, 0x1c, 0x4d, 0xee, 0xdc, 0xe4, 0x92, 0xa3,
+  0xc9, 0xd1, 0x9b, 0x5c, 0x92, 0xc1, 0x1d, 0x70, 0x93, 0x4b, 0xf2, 0xd5, 0x09, 0x6e, 0x72, 0x69,
+  0x22, 0x5a, 0xc8, 0x4d, 0x2e, 0x4d, 0x0a, 0x00, 0xb8, 0xc9, 0xa5, 0x49, 0x0b, 0x00, 0x37, 0xb9,
+  0x55, 0x00, 0x00, 0xe0, 0x26, 0xb7, 0x8a, 0x03, 0x00, 0xdc, 0xe4, 0x56, 0x91, 0x81, 0x81, 0x9b,
+  0xdc, 0x1b, 0x85, 0x00, 0x70, 0x93, 0x7b, 0xac, 0x00, 0x00, 0x6e, 0x72, 0x8f, 0x15, 0x02, 0xc0,
+  0x4d, 0xee, 0xb1, 0xe4, 0x28, 0xb8, 0xc9, 0x3d, 0x19, 0x68, 0x21, 0x37, 0xb9, 0x27, 0x09, 0x00,
+  0xe0, 0x26, 0xf7, 0x64, 0x21, 0x00, 0xdc, 0xe4, 0x9e, 0x4c, 0x23, 0xb0, 0x9b, 0xdc, 0x93, 0x4f,
+  0x12, 0x70, 0x93, 0x7b, 0xf2, 0x55, 0x06, 0x6e, 0x72, 0x6f, 0xa6, 0x01, 0xc0, 0x4d, 0xee, 0x55,
+  0xf6, 0xea, 0xbc, 0xc9, 0x3d, 0x5b, 0x64, 0x21, 0x37, 0xb9, 0x77, 0x01, 0x00, 0xe0, 0x26, 0x37,
+  0x03, 0x2b, 0x04, 0xdc, 0xe4, 0x66, 0x71, 0xc5, 0x9d, 0x9b, 0xdc, 0x6c, 0x69, 0x00, 0x70, 0x93,
+  0x9b, 0xaf, 0x25, 0x77, 0x6e, 0x72, 0xf3, 0xd5, 0x39, 0xc1, 0x4d, 0x6e, 0x4e, 0x48, 0x01, 0xb8,
+  0xc9, 0xcd, 0x49, 0x0b, 0x01, 0x37, 0xb9, 0x49, 0x59, 0x21, 0xe0, 0x26, 0x47, 0x0b, 0x00, 0x00,
+  0xdc, 0xe4, 0x68, 0x99, 0xa8, 0x80, 0x9b, 0x1c, 0x45, 0x0c, 0x00, 0x70, 0x93, 0xa3, 0xc9, 0x05,
+  0x06, 0x6e, 0x72, 0x34, 0xb9, 0x03, 0xc0, 0x4d, 0x8e, 0xa6, 0x59, 0x08, 0xb8, 0xc9, 0xd1, 0x34,
+  0x93, 0x3b, 0x37, 0xbd, 0x06, 0x00, 0x00, 0xe0, 0xa6, 0x47, 0x93, 0xa9, 0x13, 0xdc, 0xf4, 0x28,
+  0x2d, 0xb2, 0x80, 0x9b, 0xde, 0x75, 0x04, 0x00, 0x70, 0x13, 0x0c, 0xf2, 0xb9, 0x03, 0x6e, 0x82,
+  0x05, 0x00, 0x00, 0xc0, 0x4d, 0xb0, 0x10, 0x00, 0x00, 0xb8, 0x09, 0x16, 0x96, 0x06, 0x00, 0x37,
+  0xc1, 0xe2, 0x08, 0x00, 0xe0, 0x26, 0x58, 0xdc, 0x01, 0x00, 0xdc, 0x04, 0x8b, 0x4b, 0x03, 0x80,
+  0x9b, 0x60, 0x91, 0x85, 0x00, 0x70, 0x13, 0x2c, 0x93, 0x16, 0x00, 0x6e, 0x82, 0xe9, 0xa4, 0xc0,
+  0xc0, 0x4d, 0x30, 0x4d, 0x56, 0x00, 0xb8, 0x09, 0x32, 0x56, 0x08, 0x00, 0x37, 0x41, 0xf6, 0x5a,
+  0x21, 0xe0, 0x26, 0x28, 0x8b, 0x7c, 0x75, 0xde, 0x04, 0xe9, 0xab, 0x73, 0x82, 0x9b, 0x64, 0x70,
+  0x34, 0xb9, 0x73, 0x93, 0x14, 0x81, 0xbd, 0xca, 0x6e, 0x92, 0x82, 0x65, 0x00, 0xc0, 0x4d, 0x72,
+  0x14, 0x02, 0x00, 0xb8, 0x49, 0x8e, 0xe2, 0x0e, 0x00, 0x37, 0xc9, 0x91, 0xdc, 0x01, 0xe0, 0x26,
+  0x39, 0x9e, 0x2c, 0x04, 0xdc, 0x24, 0x09, 0x00, 0x00, 0x80, 0x9b, 0x24, 0x29, 0x00, 0x00, 0x70,
+  0x93, 0x24, 0x85, 0x00, 0x00, 0x6e, 0x92, 0x24, 0x0d, 0x00, 0xc0, 0x4d, 0x92, 0x24, 0x77, 0x00,
+  0xb8, 0x49, 0x92, 0x0b, 0x00, 0x00, 0x37, 0xc9, 0x02, 0x00, 0x00, 0xe0, 0x26, 0x59, 0x08, 0x00,
+  0x00, 0xdc, 0x24, 0x0b, 0x61, 0x85, 0x80, 0x9b, 0x64, 0x71, 0x07, 0x00, 0x70, 0x93, 0x2c, 0x2e,
+  0xb9, 0x42, 0x6e, 0x92, 0xc5, 0xa5, 0x57, 0xe7, 0x4d, 0xb2, 0x38, 0x0a, 0x00, 0xb8, 0x49, 0x16,
+  0x88, 0x92, 0xa3, 0x37, 0xc9, 0x32, 0x0b, 0x00, 0xe0, 0x26, 0x99, 0x46, 0x60, 0x85, 0xdc, 0x24,
+  0x13, 0x01, 0x00, 0x80, 0x9b, 0x64, 0x3a, 0x05, 0x00, 0x70, 0x93, 0x4c, 0xa7, 0x10, 0x00, 0x6e,
+  0x92, 0xc9, 0x15, 0x02, 0xc0, 0x4d, 0x32, 0xb9, 0x03, 0x00, 0xb8, 0x49, 0x26, 0x47, 0x01, 0x00,
+  0x37, 0xc9, 0xf4, 0x5a, 0x21, 0xe0, 0x26, 0x99, 0x64, 0x21, 0x00, 0xdc, 0x24, 0xd3, 0x4c, 0x03,
+  0x80, 0x9b, 0xe4, 0x2a, 0xae, 0x10, 0x70, 0x93, 0x7c, 0x32, 0x30, 0x00, 0x6e, 0x92, 0x4f, 0x12,
+  0x00, 0xc0, 0x4d, 0xf2, 0xc9, 0x42, 0x00, 0xb8, 0x49, 0x3e, 0x99, 0x5e, 0x9d, 0x37, 0xc9, 0x49,
+  0x53, 0x60, 0xe0, 0x26, 0x49, 0x01, 0x00, 0x00, 0xdc, 0x24, 0x69, 0x60, 0x85, 0x80, 0x9b, 0x24,
+  0x0d, 0xf2, 0xd5, 0x79, 0x93, 0xa4, 0x88, 0x65, 0x00, 0x6e, 0x92, 0xb6, 0xc8, 0x57, 0xe7, 0x4d,
+  0xd2, 0xbe, 0x96, 0x06, 0xb8, 0x69, 0x8e, 0x44, 0x00, 0x00, 0x37, 0xcd, 0xe2, 0x08, 0x00, 0xe0,
+  0xa6, 0x89, 0x0a, 0x00, 0x00, 0xdc, 0x34, 0x51, 0x21, 0x00, 0x80, 0x9b, 0x26, 0x2a, 0x8e, 0x16,
+  0x72, 0xd3, 0x44, 0x69, 0x04, 0x06, 0x6e, 0x9a, 0x28, 0x99, 0x3a, 0xc1, 0x4d, 0x33, 0x8d, 0xe4,
+  0x0e, 0xb8, 0x69, 0x32, 0x02, 0x00, 0x00, 0x37, 0xcd, 0x17, 0x64, 0x60, 0xe0, 0xa6, 0xf9, 0x64,
+  0x21, 0x00, 0xdc, 0x34, 0x1f, 0x2d, 0x04, 0x80, 0x9b, 0xe6, 0xbb, 0xc1, 0x1d, 0x70, 0xd3, 0x84,
+  0x00, 0x00, 0x00, 0x6e, 0x9a, 0xb0, 0x00, 0x00, 0xc0, 0x4d, 0x13, 0x16, 0x02, 0x00, 0xb8, 0x69,
+  0xc2, 0x32, 0x69, 0x01, 0x37, 0x4d, 0x88, 0x0a, 0x01, 0xe0, 0xa6, 0x09, 0x93, 0x60, 0x00, 0xdc,
+  0x34, 0x61, 0x1a, 0x00, 0x80, 0x9b, 0x26, 0x4c, 0x23, 0x30, 0x70, 0xd3, 0x84, 0xc9, 0x51, 0x00,
+  0x6e, 0x9a, 0x90, 0xa5, 0x01, 0xc0, 0x4d, 0x13, 0x3e, 0x47, 0x0b, 0xb9, 0x69, 0xc2, 0x47, 0x01,
+  0x00, 0x37, 0x4d, 0x38, 0x29, 0x00, 0xe0, 0xa6, 0x09, 0x69, 0x0a, 0x0c, 0xdc, 0x34, 0x67, 0x90,
+  0xc9, 0x9d, 0x9b, 0xe6, 0xa4, 0x45, 0x16, 0x72, 0xd3, 0x9c, 0x34, 0x8d, 0xc0, 0x6e, 0x9a, 0x93,
+  0x66, 0x00, 0xc0, 0x4d, 0x93, 0x02, 0x00, 0x00, 0xb8, 0x69, 0xd2, 0xc0, 0x0a, 0x00, 0x37, 0x4d,
+  0x1a, 0xa8, 0xa9, 0xf3, 0xa6, 0x49, 0x03, 0x4d, 0x03, 0xdc, 0x34, 0x69, 0x01, 0x00, 0x80, 0x9b,
+  0x26, 0x2d, 0x04, 0x00, 0x70, 0xd3, 0xa4, 0xc5, 0x54, 0x06, 0x6e, 0x9a, 0xb4, 0x38, 0x00, 0xc0,
+  0x4d, 0x93, 0x16, 0x77, 0x00, 0xb8, 0x69, 0xd2, 0xe2, 0x68, 0x21, 0x37, 0x4d, 0x5a, 0xe4, 0xab,
+  0xf3, 0xa6, 0x49, 0x8b, 0xcc, 0x00, 0xdc, 0x34, 0x29, 0x2a, 0x00, 0x80, 0x9b, 0x26, 0x45, 0x85,
+  0x00, 0x70, 0xd3, 0xa4, 0xa8, 0xc8, 0x02, 0x6e, 0x9a, 0x14, 0xa5, 0x01, 0xc0, 0x4d, 0x93, 0xa2,
+  0x54, 0x08, 0xb8, 0x69, 0xd2, 0x34, 0x00, 0x00, 0x37, 0x4d, 0x9a, 0x46, 0x60, 0xe0, 0xa6, 0x49,
+  0xd3, 0x48, 0xee, 0xdc, 0x34, 0x69, 0x22, 0x00, 0x80, 0x9b, 0x26, 0x4d, 0xac, 0x10, 0x70, 0xd3,
+  0xa4, 0xc9, 0x05, 0x06, 0x6e, 0x9a, 0x34, 0xb9, 0x03, 0xc0, 0x4d, 0x93, 0x26, 0x47, 0x01, 0xb8,
+  0x69, 0xd2, 0xe4, 0x68, 0x01, 0x37, 0x4d, 0x9a, 0x5e, 0x9d, 0xf3, 0xa6, 0x49, 0xd3, 0x2c, 0x04,
+  0xdc, 0x34, 0x69, 0x9a, 0xa8, 0x80, 0x9b, 0x26, 0x4d, 0x13, 0x15, 0x72, 0xd3, 0xa4, 0x69, 0x26,
+  0x77, 0x6e, 0x9a, 0x34, 0x4d, 0x0a, 0xc0, 0x4d, 0x93, 0xb2, 0xe4, 0x0e, 0xb8, 0x69, 0x52, 0x9a,
+  0xdc, 0x01, 0x37, 0x4d, 0x5a, 0x65, 0x21, 0xe0, 0xa6, 0x49, 0xab, 0x7c, 0x75, 0xde, 0x34, 0xab,
+  0x0c, 0x8e, 0x96, 0x9b, 0x66, 0x95, 0x81, 0x16, 0x72, 0xd3, 0xac, 0xb2, 0x10, 0x00, 0x6e, 0xa2,
+  0x00, 0x00, 0x00, 0xc0, 0x4d, 0x34, 0x08, 0x56, 0x08, 0xb8, 0x89, 0x06, 0x56, 0x08, 0x00, 0x37,
+  0xd1, 0xc0, 0x92, 0x3b, 0xe0, 0x26, 0x1a, 0x5c, 0x72, 0x14, 0xdc, 0x44, 0x83, 0x2c, 0x04, 0x80,
+  0x9b, 0x68, 0xa0, 0x29, 0x30, 0x70, 0x13, 0x0d, 0x34, 0xb9, 0x03, 0x6e, 0xa2, 0x85, 0x00, 0x00,
+  0xc0, 0x4d, 0xb4, 0xc8, 0x32, 0x01, 0xb8, 0x89, 0x96, 0x49, 0x93, 0xa3, 0x37, 0x51, 0x04, 0x00,
+  0x00, 0xe0, 0x26, 0x8a, 0x02, 0x2b, 0x13, 0xdc, 0x44, 0x51, 0x90, 0x85, 0x80, 0x9b, 0x28, 0x2a,
+  0x00, 0x00, 0x70, 0x13, 0x45, 0x85, 0x00, 0x00, 0x6e, 0xa2, 0xa8, 0xb8, 0x03, 0xc0, 0x4d, 0x14,
+  0x15, 0x47, 0x01, 0xb8, 0x89, 0xa2, 0xe2, 0x68, 0x21, 0x37, 0x51, 0x54, 0x64, 0x70, 0xe7, 0x26,
+  0x8a, 0x8a, 0x2c, 0x04, 0xdc, 0x44, 0x51, 0x91, 0x19, 0x80, 0x9b, 0x28, 0x2a, 0x93, 0x02, 0x70,
+  0x13, 0x45, 0xa6, 0xb2, 0x0c, 0x6e, 0xa2, 0x28, 0x8d, 0xc0, 0xc0, 0x4d, 0x14, 0x25, 0x53, 0x19,
+  0xb8, 0x89, 0xa2, 0xe4, 0x0e, 0x00, 0x37, 0x51, 0x94, 0x1c, 0x2d, 0xe4, 0x26, 0x8a, 0x92, 0xa3,
+  0x69, 0xdc, 0x44, 0x51, 0x7a, 0xd5, 0x9d, 0x9b, 0x28, 0x4a, 0x93, 0x02, 0x70, 0x13, 0x45, 0xb4,
+  0x00, 0x00, 0x6e, 0xa2, 0x88, 0xa6, 0xe0, 0xce, 0x4d, 0x14, 0xd1, 0x34, 0x00, 0xb8, 0x89, 0xa6,
+  0x11, 0x1c, 0x05, 0x37, 0xd1, 0x34, 0x50, 0x21, 0xe0, 0x26, 0x9a, 0x46, 0x1a, 0x00, 0xdc, 0x44,
+  0xd3, 0x48, 0xee, 0x80, 0x9b, 0x68, 0x2a, 0x00, 0x00, 0x70, 0x13, 0x4d, 0x8e, 0x00, 0x00, 0x6e,
+  0xa2, 0xc9, 0xd1, 0x42, 0xc0, 0x4d, 0x34, 0x39, 0x9a, 0x1c, 0xb8, 0x89, 0xca, 0x34, 0x0a, 0x01,
+  0x37, 0x51, 0x5a, 0x00, 0x00, 0xe0, 0x26, 0x4a, 0x8b, 0x03, 0x00, 0xdc, 0x44, 0x29, 0x02, 0x00,
+  0x80, 0x9b, 0x68, 0x0d, 0x34, 0x39, 0x7a, 0x13, 0xad, 0x04, 0x00, 0x00, 0x6e, 0xa2, 0x55, 0x16,
+  0x02, 0xc0, 0x4d, 0xb4, 0xca, 0xe4, 0x0e, 0xb8, 0xc9, 0x86, 0x01, 0x00, 0x00, 0x37, 0xd9, 0xc0,
+  0x0a, 0x01, 0xe0, 0x26, 0x1b, 0x58, 0x7a, 0x75, 0xde, 0x64, 0x0b, 0x00, 0x00, 0x80, 0x9b, 0x6c,
+  0x21, 0x00, 0x00, 0x70, 0x93, 0x2d, 0xac, 0x10, 0x00, 0x6e, 0xb2, 0x85, 0xa5, 0x01, 0xc0, 0x4d,
+  0xb6, 0x38, 0x02, 0x00, 0xb8, 0xc9, 0x16, 0x57, 0x08, 0x00, 0x37, 0xd9, 0xe2, 0x4e, 0x21, 0xe0,
+  0x26, 0x5b, 0x1c, 0x05, 0x00, 0xdc, 0x64, 0x8b, 0xa3, 0x05, 0x80, 0x9b, 0x6c, 0x71, 0xb4, 0x10,
+  0x70, 0x93, 0x2d, 0x90, 0x02, 0x00, 0x6e, 0xb2, 0x45, 0x16, 0x00, 0xc0, 0x4d, 0xb6, 0xc8, 0x42,
+  0x00, 0xb8, 0xc9, 0x16, 0x99, 0x06, 0x00, 0x37, 0xd9, 0x32, 0xd3, 0xab, 0xf3, 0x26, 0x5b, 0x66,
+  0x06, 0x00, 0xdc, 0x64, 0xd3, 0x08, 0xac, 0x90, 0x9b, 0x6c, 0x72, 0x04, 0x00, 0x70, 0x93, 0x4d,
+  0x34, 0x39, 0x5a, 0x6e, 0xd2, 0x81, 0x01, 0x00, 0xc0, 0x4d, 0x3a, 0xb0, 0x34, 0x00, 0xb8, 0x49,
+  0x07, 0x96, 0xdc, 0x01, 0x37, 0xe9, 0xe0, 0x08, 0x00, 0xe0, 0x26, 0x1d, 0xdc, 0x01, 0x00, 0xdc,
+  0xa4, 0x83, 0x4b, 0x03, 0x80, 0x9b, 0x74, 0x90, 0xc5, 0x1d, 0x70, 0x93, 0x2e, 0x00, 0x00, 0x00,
+  0x6e, 0xd2, 0xc5, 0x11, 0x00, 0xc0, 0x4d, 0xba, 0xc8, 0x40, 0x0b, 0xb9, 0x49, 0x17, 0x59, 0x08,
+  0x00, 0x37, 0xe9, 0x22, 0x4d, 0x9d, 0xe0, 0x26, 0x5d, 0x66, 0x21, 0x00, 0xdc, 0xa4, 0xcb, 0xa4,
+  0x85, 0x80, 0x9b, 0xb4, 0x0e, 0xb6, 0x10, 0x70, 0x93, 0xd6, 0x85, 0x00, 0x00, 0x6e, 0xd2, 0xba,
+  0x90, 0x34, 0xc0, 0x4d, 0x5a, 0xa7, 0x20, 0x0b, 0xb9, 0x49, 0xeb, 0xe4, 0x0e, 0x00, 0x37, 0x69,
+  0x9d, 0x6c, 0x72, 0xe0, 0x26, 0xad, 0x19, 0x00, 0x00, 0xdc, 0xa4, 0x35, 0x2b, 0x04, 0x80, 0x9b,
+  0xb4, 0x66, 0xc9, 0x1d, 0x70, 0x93, 0xd6, 0x19, 0x00, 0x00, 0xee, 0x0b, 0xb2, 0xb8, 0x42, 0xc0,
+  0x7d, 0x81, 0xa6, 0x49, 0x01, 0xb8, 0xcf, 0x14, 0x57, 0x08, 0x00, 0xf7, 0x9d, 0x40, 0x0b, 0x01,
+  0xe0, 0xbe, 0x83, 0x0a, 0x00, 0x00, 0xdc, 0x77, 0x92, 0x4b, 0x03, 0x80, 0xfb, 0x50, 0x71, 0xd4,
+  0xd4, 0x79, 0x1f, 0x2a, 0xb2, 0x10, 0x00, 0xee, 0x43, 0x4f, 0xa6, 0x57, 0xe7, 0x7d, 0x2c, 0xb0,
+  0x34, 0x00, 0xb8, 0x8f, 0x05, 0x69, 0xea, 0x04, 0xf7, 0xb1, 0x40, 0x0b, 0x01, 0xe0, 0x3e, 0x46,
+  0x8a, 0x7c, 0x75, 0xde, 0xc7, 0x0c, 0x00, 0x00, 0x80, 0xfb, 0x58, 0x1a, 0xc9, 0xd4, 0x79, 0x1f,
+  0x4b, 0x23, 0xb9, 0x03, 0xee, 0x63, 0x89, 0xb0, 0x42, 0xc0, 0x7d, 0x2c, 0x1d, 0x54, 0x08, 0xb8,
+  0x8f, 0x25, 0x17, 0x28, 0x00, 0xf7, 0xb1, 0xe4, 0x0e, 0x00, 0xe0, 0x3e, 0x96, 0x64, 0x01, 0x00,
+  0xdc, 0xc7, 0x92, 0x9c, 0xc9, 0x9d, 0xfb, 0x18, 0x23, 0x00, 0x00, 0x70, 0x1f, 0x63, 0x05, 0x00,
+  0x00, 0xee, 0x63, 0xac, 0x10, 0x00, 0xc0, 0x7d, 0x8c, 0xbd, 0x56, 0x08, 0xb8, 0x8f, 0x31, 0x5a,
+  0x08, 0x00, 0xf7, 0xb1, 0x96, 0x46, 0x71, 0xe7, 0x3e, 0xf6, 0x64, 0x21, 0x00, 0xdc, 0xc7, 0xe6,
+  0x0c, 0xac, 0x90, 0xfb, 0x58, 0x95, 0xe9, 0xd5, 0x79, 0x1f, 0xab, 0xd2, 0x1d, 0x00, 0xee, 0x6b,
+  0xc5, 0x1d, 0x00, 0xc0, 0x7d, 0x2d, 0x05, 0x77, 0x00, 0xb8, 0xaf, 0xc1, 0x42, 0x00, 0x00, 0xf7,
+  0x35, 0x98, 0x46, 0x21, 0xe0, 0xbe, 0x06, 0xd3, 0x44, 0x85, 0xdc, 0xd7, 0xe0, 0x93, 0x85, 0x80,
+  0xfb, 0x1c, 0x01, 0x00, 0x00, 0x70, 0x9f, 0x23, 0xc9, 0x51, 0x00, 0xee, 0x73, 0x24, 0xcd, 0x42,
+  0xc0, 0x7d, 0x8e, 0xb0, 0xe4, 0x0e, 0xb8, 0xcf, 0x11, 0x99, 0xdc, 0x01, 0xf7, 0xb9, 0x32, 0x50,
+  0x72, 0xe7, 0x3e, 0x57, 0x5c, 0x72, 0x07, 0xdc, 0xe7, 0x8a, 0xa3, 0x85, 0x80, 0xfb, 0x5c, 0x91,
+  0xc9, 0x51, 0x70, 0x9f, 0x4b, 0xc1, 0x05, 0x77, 0xee, 0x73, 0x34, 0x11, 0x00, 0xc0, 0x7d, 0x8e,
+  0x26, 0x47, 0x01, 0xb8, 0xef, 0x85, 0x11, 0x18, 0x00, 0xf7, 0x3d, 0x02, 0x00, 0x00, 0xe0, 0xbe,
+  0xc7, 0x08, 0x2b, 0x04, 0xdc, 0xf7, 0x9a, 0x60, 0x85, 0x80, 0xfb, 0x9e, 0x23, 0x00, 0x00, 0x70,
+  0xdf, 0x73, 0x19, 0x00, 0x00, 0xee, 0x7b, 0x4f, 0x16, 0x02, 0xc0, 0x7d, 0x0f, 0xa6, 0x59, 0x08,
+  0xb8, 0xef, 0x49, 0x02, 0x00, 0x00, 0xf7, 0x3d, 0x59, 0x1c, 0x05, 0xe0, 0xbe, 0x27, 0x8b, 0x2c,
+  0x00, 0xdc, 0xf7, 0x64, 0x1a, 0x00, 0x80, 0xfb, 0x9e, 0x64, 0x45, 0x16, 0x72, 0xdf, 0xa3, 0x69,
+  0x52, 0x00, 0xee, 0x7b, 0x36, 0x4d, 0x5a, 0xc8, 0x7d, 0x32, 0x8c, 0xc0, 0x00, 0xb8, 0x4f, 0x86,
+  0x91, 0x5e, 0x65, 0xf7, 0xc9, 0xc0, 0x0a, 0x01, 0xe0, 0x3e, 0x19, 0x58, 0x06, 0x00, 0xdc, 0x27,
+  0x43, 0x2b, 0x73, 0x82, 0xfb, 0x64, 0x70, 0x04, 0x00, 0x70, 0x9f, 0x0c, 0x8e, 0x26, 0x77, 0xee,
+  0x93, 0x41, 0x06, 0x59, 0xc8, 0x7d, 0x32, 0xc8, 0x42, 0x00, 0xb8, 0x4f, 0x06, 0x59, 0x26, 0x00,
+  0xf7, 0xc9, 0x20, 0x93, 0xa3, 0xe0, 0x3e, 0x19, 0x68, 0x21, 0x00, 0xdc, 0x27, 0x03, 0x4d, 0x03,
+  0x80, 0xfb, 0xa4, 0x08, 0x07, 0x00, 0x70, 0x9f, 0x14, 0x2c, 0x0d, 0x00, 0xee, 0x93, 0x23, 0x50,
+  0x00, 0xc0, 0x7d, 0x72, 0x14, 0x00, 0x00, 0xb8, 0x4f, 0x8e, 0x34, 0x69, 0x1a, 0xf7, 0xc9, 0x41,
+  0x93, 0x3b, 0xe0, 0x3e, 0x39, 0x2a, 0x2b, 0xee, 0xdc, 0x27, 0x09, 0x00, 0x00, 0x80, 0xfb, 0x24,
+  0x29, 0xb2, 0x10, 0x70, 0x9f, 0x24, 0xc9, 0x1d, 0x00, 0xee, 0x93, 0x84, 0x15, 0x02, 0xc0, 0x7d,
+  0x92, 0x4c, 0x5a, 0x08, 0xb8, 0x4f, 0x16, 0x00, 0x00, 0x00, 0xf7, 0xc9, 0x42, 0x00, 0x00, 0xe0,
+  0x3e, 0x59, 0x58, 0x21, 0x00, 0xdc, 0x27, 0x0b, 0x4b, 0x8e, 0x96, 0xfb, 0x64, 0x71, 0x04, 0x00,
+  0x70, 0x9f, 0x2c, 0xee, 0x00, 0x00, 0xee, 0x93, 0xc5, 0x9d, 0x42, 0xc0, 0x7d, 0xb2, 0xb8, 0xe4,
+  0x0e, 0xb8, 0x4f, 0x16, 0x47, 0x01, 0x00, 0xf7, 0xc9, 0xe2, 0x68, 0x21, 0xe0, 0x3e, 0x59, 0x1c,
+  0x4d, 0x03, 0xdc, 0x27, 0x8b, 0xa3, 0xc9, 0x9d, 0xfb, 0x64, 0x91, 0x05, 0x00, 0x70, 0x9f, 0x2c,
+  0xb2, 0x10, 0x00, 0xee, 0x93, 0x45, 0x16, 0x07, 0xc0, 0x7d, 0xb2, 0xc8, 0x54, 0x08, 0xb8, 0x4f,
+  0x16, 0xf9, 0xdc, 0x01, 0xf7, 0xc9, 0x32, 0xd3, 0xab, 0xec, 0x3e, 0x59, 0x26, 0x4d, 0x85, 0xdc,
+  0x27, 0xcb, 0xa4, 0xc9, 0xd1, 0xfb, 0x64, 0x99, 0x19, 0x00, 0x70, 0x9f, 0x3c, 0x88, 0x02, 0x00,
+  0xee, 0x93, 0x29, 0x88, 0xe4, 0xce, 0x7d, 0x32, 0x8d, 0xe0, 0x0e, 0xb8, 0x4f, 0xa6, 0x81, 0x0a,
+  0x01, 0xf7, 0xc9, 0x34, 0xd2, 0x00, 0xe0, 0x3e, 0x99, 0x46, 0x72, 0x07, 0xdc, 0x27, 0xd3, 0x48,
+  0xaf, 0xce, 0xfb, 0x64, 0x1a, 0xaf, 0x4e, 0x70, 0x9f, 0x4c, 0x83, 0x26, 0x77, 0xee, 0x93, 0x89,
+  0x00, 0x00, 0xc0, 0x7d, 0x32, 0x15, 0x77, 0x00, 0xb8, 0x4f, 0xa6, 0x53, 0x00, 0x00, 0xf7, 0xc9,
+  0x74, 0x5c, 0x21, 0xe0, 0x3e, 0x99, 0x58, 0x01, 0x00, 0xdc, 0x27, 0x93, 0x0b, 0xee, 0x80, 0xfb,
+  0x64, 0x72, 0x04, 0x00, 0x70, 0x9f, 0x4c, 0xae, 0x10, 0x00, 0xee, 0x93, 0xc9, 0x1d, 0x00, 0xc0,
+  0x7d, 0x32, 0xb9, 0x53, 0x08, 0xb8, 0x4f, 0x26, 0x97, 0x1c, 0x05, 0xf7, 0xc9, 0xf4, 0xea, 0x04,
+  0xe0, 0x3e, 0x99, 0x64, 0x60, 0x00, 0xdc, 0x27, 0xd3, 0x2c, 0x04, 0x80, 0xfb, 0x64, 0x9a, 0xc5,
+  0x1d, 0x70, 0x9f, 0x4c, 0x13, 0x15, 0x02, 0xee, 0x93, 0x69, 0x32, 0x00, 0xc0, 0x7d, 0x32, 0xcd,
+  0x57, 0x27, 0xb8, 0x4f, 0xa6, 0x49, 0x01, 0x00, 0xf7, 0xc9, 0x34, 0x69, 0x72, 0xe0, 0x3e, 0x99,
+  0x68, 0x21, 0x00, 0xdc, 0x27, 0x93, 0x2d, 0x04, 0x80, 0xfb, 0xe4, 0x2a, 0x00, 0x00, 0x70, 0x9f,
+  0x5c, 0xc5, 0x1d, 0x00, 0xee, 0x93, 0x2b, 0xb9, 0x42, 0xc0, 0x7d, 0x72, 0x65, 0x00, 0x00, 0xb8,
+  0x4f, 0xb6, 0xe0, 0x0e, 0x00, 0xf7, 0xc9, 0x56, 0x08, 0x00, 0xe0, 0x3e, 0xd9, 0x92, 0x03, 0x00,
+  0xdc, 0x27, 0x1d, 0x4d, 0xee, 0x80, 0xfb, 0xe4, 0x63, 0x05, 0x00, 0x70, 0x9f, 0x7c, 0xac, 0x10,
+  0x00, 0xee, 0x93, 0x8f, 0x25, 0x07, 0xc0, 0x7d, 0xf2, 0x39, 0x02, 0x00, 0xb8, 0x4f, 0x3e, 0x77,
+  0x00, 0x00, 0xf7, 0xc9, 0xe7, 0x28, 0x00, 0xe0, 0x3e, 0xf9, 0x24, 0x01, 0x00, 0xdc, 0x27, 0x9f,
+  0x2c, 0x00, 0x80, 0xfb, 0xe4, 0x93, 0x85, 0x00, 0x70, 0x9f, 0x7c, 0xd2, 0xd4, 0x09, 0xee, 0x93,
+  0x4f, 0x26, 0x07, 0xc0, 0x7d, 0xf2, 0xc9, 0xe7, 0x0e, 0xb8, 0x4f, 0x3e, 0xf9, 0x1c, 0x2d, 0xf7,
+  0xc9, 0x27, 0x5f, 0x65, 0xe0, 0x3e, 0xf9, 0x6c, 0x21, 0x00, 0xdc, 0x27, 0xdf, 0x2d, 0x00, 0x80,
+  0xfb, 0x24, 0x4c, 0xee, 0x00, 0x70, 0x9f, 0x9c, 0x50, 0x16, 0x02, 0xee, 0x93, 0x34, 0xb8, 0x03,
+  0xc0, 0x7d, 0x92, 0x16, 0x00, 0x00, 0xb8, 0x4f, 0xd2, 0x42, 0x00, 0x00, 0xf7, 0x49, 0x5a, 0x1c,
+  0x00, 0xe0, 0x3e, 0x49, 0x8b, 0x3b, 0x00, 0xdc, 0x27, 0x69, 0x91, 0x85, 0x80, 0xfb, 0x24, 0x4d,
+  0xee, 0x00, 0x70, 0x9f, 0xa4, 0x8f, 0x15, 0x02, 0xee, 0x93, 0x34, 0x03, 0x00, 0xc0, 0x7d, 0xb2,
+  0xce, 0xe4, 0x28, 0xb8, 0x4f, 0xda, 0x02, 0x00, 0x00, 0xf7, 0x49, 0x5b, 0x08, 0x00, 0xe0, 0x3e,
+  0x99, 0x01, 0x00, 0x00, 0xdc, 0x37, 0xa9, 0x2c, 0xb2, 0x90, 0xfb, 0x68, 0x91, 0xc9, 0x1d, 0x70,
+  0x5f, 0x4d, 0xa3, 0x10, 0x00, 0xee, 0xab, 0x8e, 0x00, 0x00, 0xc0, 0x7d, 0xd5, 0xd1, 0x42, 0x00,
+  0xb8, 0xaf, 0x3a, 0x9a, 0xdc, 0x01, 0xf7, 0xd5, 0x49, 0x0b, 0x00, 0xe0, 0xbe, 0x4a, 0x51, 0x21,
+  0x00, 0xdc, 0x67, 0x8b, 0x1b, 0x81, 0x81, 0xfb, 0x6c, 0x71, 0x04, 0x00, 0x70, 0x9f, 0x2d, 0xee,
+  0x00, 0x00, 0xee, 0xb3, 0xc5, 0x25, 0x77, 0xc0, 0x7d, 0xb6, 0xc8, 0x40, 0x0b, 0xb9, 0xcf, 0x3e,
+  0x59, 0x08, 0x00, 0xf7, 0x5d, 0x00, 0x00, 0x00, 0xe0, 0xbe, 0x5b, 0x08, 0x2b, 0x0e, 0xdc, 0x87,
+  0xab, 0x4c, 0x03, 0x80, 0xfb, 0xf2, 0xa4, 0x69, 0x00, 0x70, 0x65, 0x18, 0x00, 0x00, 0x00, 0xae,
+  0x0c, 0xa3, 0x10, 0x00, 0xc0, 0x95, 0x81, 0x14, 0xf9, 0xea, 0xbc, 0x32, 0x1c, 0x54, 0x08, 0x00,
+  0x57, 0x06, 0x56, 0x00, 0x00, 0xe0, 0xca, 0xd0, 0x0a, 0x00, 0x00, 0x5c, 0x19, 0x1c, 0x01, 0x00,
+  0x80, 0x2b, 0x83, 0xa3, 0xd2, 0x1d, 0x70, 0x65, 0x90, 0xc1, 0x15, 0x02, 0xae, 0x0c, 0x32, 0x50,
+  0x00, 0xc0, 0x95, 0x41, 0x06, 0x9a, 0x06, 0xb8, 0x32, 0xc8, 0x42, 0x00, 0x00, 0x57, 0x06, 0x59,
+  0xdc, 0x01, 0xe0, 0xca, 0x20, 0x93, 0x3b, 0x00, 0x5c, 0x19, 0x64, 0x9a, 0xb4, 0x90, 0x2b, 0x83,
+  0xac, 0xf2, 0xd5, 0x79, 0x65, 0x90, 0x19, 0x00, 0x00, 0xae, 0x0c, 0x13, 0x25, 0x07, 0xc0, 0x95,
+  0x61, 0xd2, 0x42, 0x00, 0xb8, 0x32, 0x4c, 0x9a, 0x06, 0x00, 0x57, 0x86, 0x49, 0x93, 0xa3, 0xe0,
+  0xca, 0x30, 0x69, 0x7a, 0x75, 0x5e, 0x19, 0x26, 0xcd, 0x00, 0x80, 0x2b, 0x03, 0x45, 0xa6, 0x4e,
+  0x70, 0x65, 0xa0, 0xc9, 0x1d, 0x00, 0xae, 0x0c, 0xb6, 0x10, 0x00, 0xc0, 0x95, 0xe3, 0xd9, 0x42,
+  0x00, 0xb8, 0x92, 0xa4, 0x81, 0x0a, 0x01, 0x57, 0x96, 0x40, 0x83, 0x03, 0xe0, 0xca, 0x42, 0x00,
+  0x00, 0x00, 0x5c, 0x59, 0x58, 0x21, 0x00, 0x80, 0x2b, 0x8b, 0x23, 0x00, 0x00, 0x70, 0x65, 0x71,
+  0x34, 0x0d, 0x00, 0xae, 0x2c, 0xb2, 0x10, 0x00, 0xc0, 0x95, 0x45, 0x16, 0x77, 0x00, 0xb8, 0xb2,
+  0x48, 0x56, 0x64, 0x06, 0x57, 0x16, 0x49, 0x59, 0x21, 0xe0, 0xca, 0x32, 0x69, 0x21, 0x00, 0x5c,
+  0x99, 0x4e, 0x71, 0x07, 0x80, 0x2b, 0x13, 0x23, 0x00, 0x00, 0x70, 0x65, 0x62, 0x85, 0x00, 0x00,
+  0xae, 0x4c, 0x2d, 0x39, 0x0a, 0xc0, 0x95, 0xc9, 0x01, 0x00, 0x00, 0xb8, 0x32, 0x39, 0x02, 0x00,
+  0x00, 0x57, 0x26, 0x97, 0xdc, 0x01, 0xe0, 0xca, 0xe4, 0x68, 0x21, 0x00, 0x5c, 0x99, 0xe6, 0xab,
+  0x73, 0x82, 0x2b, 0xd3, 0xa4, 0x85, 0x00, 0x70, 0xe5, 0x0b, 0x82, 0x15, 0x02, 0xae, 0x7c, 0x24,
+  0x39, 0x00, 0xc0, 0x95, 0x8f, 0x64, 0x00, 0x00, 0xb8, 0xf2, 0x31, 0xc2, 0x0a, 0x01, 0x57, 0xbe,
+  0x56, 0xdc, 0x01, 0xe0, 0xca, 0xf7, 0x64, 0x21, 0x00, 0x5c, 0xf9, 0x64, 0x71, 0x00, 0x80, 0x2b,
+  0x9f, 0x2c, 0xf2, 0xd5, 0x79, 0xe5, 0x93, 0xc9, 0x1d, 0x00, 0xae, 0x7c, 0xb4, 0xb8, 0x03, 0xc0,
+  0x95, 0x8f, 0x26, 0x07, 0x00, 0xb8, 0xf2, 0x55, 0x02, 0x00, 0x00, 0x57, 0xbe, 0xca, 0x0a, 0x01,
+  0xe0, 0xca, 0x57, 0x65, 0x60, 0x85, 0x5c, 0xf9, 0xaa, 0xac, 0x13, 0x80, 0x2b, 0x5f, 0x9d, 0x69,
+  0x00, 0x70, 0xe5, 0xab, 0x33, 0xb9, 0x03, 0xae, 0x7c, 0x75, 0x52, 0x00, 0xc0, 0x95, 0xef, 0x02,
+  0x00, 0x00, 0xb8, 0x92, 0xa2, 0x42, 0x00, 0x00, 0x57, 0xd6, 0x89, 0x4c, 0x65, 0xe0, 0xca, 0x3a,
+  0x67, 0x72, 0x07, 0xe4, 0xc0, 0xc2, 0x2a, 0x04, 0x80, 0x1c, 0x64, 0x70, 0x14, 0x00, 0x90, 0x83,
+  0x4c, 0xb3, 0x10, 0x00, 0x72, 0x90, 0x2d, 0x0d, 0x00, 0x40, 0x2e, 0xc1, 0x11, 0x00, 0x00, 0xc8,
+  0x25, 0xc8, 0xd7, 0x92, 0x3b, 0xb9, 0x04, 0x9a, 0x1c, 0x2d, 0x24, 0x97, 0x11, 0x68, 0x72, 0x07,
+  0xe4, 0x32, 0x8a, 0x23, 0x00, 0x80, 0x5c, 0x48, 0x01, 0x00, 0x00, 0x90, 0x8b, 0x49, 0x2c, 0x0d,
+  0x00, 0x72, 0x61, 0x04, 0x00, 0x00, 0x40, 0x2e, 0xcc, 0x98, 0xca, 0x00, 0xc8, 0x85, 0xb5, 0x40,
+  0x01, 0x00, 0xb9, 0x38, 0x02, 0x00, 0x00, 0x20, 0x97, 0x09, 0xd3, 0xab, 0x0c, 0xe4, 0x32, 0xe1,
+  0xb3, 0x85, 0x80, 0x5c, 0x26, 0x05, 0x00, 0x00, 0x90, 0xcb, 0xa4, 0x05, 0x00, 0x00, 0x72, 0x99,
+  0xb4, 0x10, 0x00, 0x40, 0x2e, 0x93, 0x16, 0xf9, 0xea, 0xcc, 0x65, 0x52, 0x64, 0x2a, 0x03, 0xb9,
+  0x4c, 0x8a, 0x92, 0x3b, 0x20, 0xbf, 0xe4, 0x4e, 0x91, 0x85, 0xe4, 0xc7, 0x48, 0x91, 0xaf, 0xce,
+  0xfc, 0x58, 0x91, 0x85, 0x00, 0x90, 0x1f, 0x63, 0xc9, 0x1d, 0x00, 0xf2, 0x6b, 0xe9, 0x14, 0x02,
+  0x40, 0x7e, 0x2d, 0xb9, 0xe0, 0x68, 0xc9, 0xaf, 0x41, 0x96, 0x5e, 0x9d, 0xf9, 0xb9, 0x53, 0x08,
+  0x00, 0x20, 0xbf, 0xd7, 0x82, 0x3b, 0x00, 0xe4, 0xf7, 0xea, 0x64, 0x85, 0x80, 0xfc, 0x64, 0x70,
+  0x07, 0x00, 0x90, 0x9f, 0x2c, 0x2e, 0xb9, 0x03, 0xf2, 0x93, 0x65, 0x52, 0x00, 0x40, 0x7e, 0x32,
+  0x8d, 0xe4, 0x00, 0xc8, 0x4f, 0xa6, 0x41, 0x01, 0x00, 0xf9, 0xc9, 0x34, 0x68, 0x72, 0x27, 0x3f,
+  0x99, 0x08, 0x00, 0x00, 0xe4, 0x27, 0x93, 0x2c, 0x04, 0x80, 0xfc, 0x64, 0xa2, 0x69, 0x00, 0x90,
+  0x9f, 0x7c, 0xb2, 0x00, 0x00, 0xf2, 0x93, 0xb2, 0xb8, 0x03, 0x40, 0x7e, 0x52, 0x16, 0x47, 0x0b,
+  0xc9, 0x4f, 0xca, 0xe4, 0x0e, 0x00, 0xf9, 0xc9, 0x49, 0x93, 0x03, 0x20, 0x3f, 0x49, 0xd3, 0xab,
+  0x0c, 0xe4, 0x57, 0x29, 0x4a, 0x03, 0x80, 0xfc, 0x6c, 0x21, 0x85, 0x00, 0xa0, 0xc3, 0x41, 0x14,
+  0x00, 0x00, 0x74, 0x60, 0x04, 0x52, 0x00, 0x80, 0x0e, 0x72, 0x04, 0x56, 0x08, 0xd0, 0x41, 0x16,
+  0xf9, 0x2a, 0x03, 0x3a, 0xc8, 0xe4, 0x08, 0x00, 0x40, 0x87, 0x49, 0x93, 0xa3, 0x00, 0xe8, 0x50,
+  0x4d, 0x95, 0x89, 0x00, 0x5d, 0xc2, 0x48, 0xee, 0x00, 0xa0, 0x4b, 0x38, 0x28, 0x0d, 0x00, 0x74,
+  0x09, 0x8e, 0x66, 0x00, 0x80, 0x2e, 0x41, 0x16, 0x02, 0x00, 0xd0, 0x25, 0xc8, 0x34, 0x93, 0xa3,
+  0xba, 0x04, 0x09, 0x69, 0x72, 0x47, 0x97, 0x40, 0x83, 0x4c, 0x81, 0xe9, 0x12, 0x68, 0x71, 0x07,
+  0x00, 0x5d, 0x42, 0x95, 0xc1, 0x1d, 0xa0, 0xcb, 0x28, 0x8e, 0x16, 0x00, 0x74, 0x19, 0xe9, 0x14,
+  0x02, 0x80, 0x2e, 0x63, 0x15, 0x47, 0x01, 0xd0, 0xa5, 0x38, 0x9a, 0x06, 0x00, 0xba, 0x18, 0xf6,
+  0x5a, 0x21, 0x40, 0x17, 0x36, 0x02, 0x2b, 0x04, 0xe8, 0xc2, 0x08, 0x00, 0x00, 0x00, 0x5d, 0x58,
+  0x72, 0x34, 0x0d, 0xa0, 0x0b, 0x63, 0xc9, 0x1d, 0x00, 0x74, 0x69, 0x30, 0x8d, 0xc0, 0x80, 0x2e,
+  0x0d, 0x3e, 0x77, 0x00, 0xd0, 0xc5, 0x91, 0x02, 0x00, 0x00, 0xba, 0x38, 0x52, 0x08, 0x00, 0x40,
+  0x17, 0x57, 0x58, 0x21, 0x00, 0xe8, 0xe2, 0x8a, 0x3b, 0x00, 0x00, 0x5d, 0xe4, 0x2a, 0x04, 0x00,
+  0xa0, 0xcb, 0x2c, 0x8e, 0x02, 0x00, 0x74, 0x99, 0x8f, 0x02, 0x00, 0x80, 0x2e, 0x93, 0x16, 0x00,
+  0x00, 0xd0, 0x65, 0xd2, 0x42, 0x00, 0x00, 0xba, 0x4c, 0x8a, 0x92, 0x03, 0x40, 0x97, 0x49, 0xd3,
+  0x08, 0xee, 0xe8, 0x32, 0x69, 0x7a, 0x95, 0x01, 0x5d, 0x26, 0x4d, 0x33, 0x39, 0xaa, 0xcb, 0xa4,
+  0x92, 0x00, 0x00, 0x74, 0xb1, 0xc5, 0x1d, 0x00, 0x80, 0x2e, 0x17, 0x00, 0x00, 0x00, 0xd0, 0xc9,
+  0x11, 0x00, 0x00, 0x00, 0x3a, 0xcd, 0x2a, 0x0b, 0x01, 0x40, 0x27, 0x8a, 0x68, 0x21, 0x00, 0xe8,
+  0xc7, 0x92, 0x4b, 0x03, 0x00, 0xfd, 0xd8, 0x93, 0x04, 0x00, 0xa0, 0x9f, 0x0b, 0x2e, 0x05, 0x06,
+  0xf4, 0x7b, 0x81, 0xa6, 0x57, 0xa7, 0x7e, 0x4f, 0x26, 0x77, 0x00, 0xd0, 0x4f, 0x06, 0x47, 0xd3,
+  0x00, 0xfa, 0x49, 0x11, 0x18, 0x00, 0x40, 0x3f, 0x39, 0x8a, 0x2c, 0x04, 0xe8, 0x27, 0x8b, 0x2c,
+  0x04, 0x00, 0xfd, 0x64, 0x72, 0x04, 0x00, 0xa0, 0x9f, 0x7c, 0xb2, 0x00, 0x00, 0xf4, 0x93, 0xb4,
+  0xb2, 0x42, 0x80, 0x7e, 0xd2, 0x16, 0xf9, 0xea, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00
+};
+
+} // namespace embedded_ml
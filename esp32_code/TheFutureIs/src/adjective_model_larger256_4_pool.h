@@ -0,0 +1,45 @@
+// adjective_model_larger256_4_pool.h
+// Auto-generated pool of pre-sampled words
+// Pure C++ implementation for embedded systems
+
+#ifndef ADJECTIVE_MODEL_LARGER256_4_POOL_H
+#define ADJECTIVE_MODEL_LARGER256_4_POOL_H
+
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+
+namespace embedded_ml {
+
+// Distinct words sampled from the model on the host, sorted
+// Word i is the 45-bit slot at bit i * 45 of packed: 9 letter codes of 5 bits
+// (1 = 'a' .. 26 = 'z', first letter lowest), zero after the last letter
+class adjective_model_larger256_4Pool {
+public:
+    static constexpr size_t kNumWords = 14895;
+    static constexpr size_t kMaxLen = 9;
+
+    // Copy word index (< kNumWords) into out, NUL-terminated (kMaxLen + 1 bytes)
+    static void Word(size_t index, char* out) {
+        const size_t bit = index * kSlotBits;
+        uint64_t slot;
+        memcpy(&slot, packed + bit / 8, sizeof(slot));  // little-endian
+        slot >>= bit % 8;
+        size_t len = 0;
+        for (; len < kMaxLen; ++len, slot >>= kLetterBits) {
+            const unsigned code = static_cast<unsigned>(slot & ((1u << kLetterBits) - 1));
+            if (code == 0) break;
+            out[len] = static_cast<char>('a' + code - 1);
+        }
+        out[len] = '\0';
+    }
+
+private:
+    static constexpr size_t kLetterBits = 5;
+    static constexpr size_t kSlotBits = 45;
+    static const uint8_t packed[83793];
+};
+
+} // namespace embedded_ml
+
+#endif // ADJECTIVE_MODEL_LARGER256_4_POOL_H
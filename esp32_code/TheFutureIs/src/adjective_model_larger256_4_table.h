@@ -0,0 +1,32 @@
+// adjective_model_larger256_4_table.h
+// Auto-generated next-character lookup table
+// Pure C++ implementation for embedded systems
+
+#ifndef ADJECTIVE_MODEL_LARGER256_4_TABLE_H
+#define ADJECTIVE_MODEL_LARGER256_4_TABLE_H
+
+#include <cstddef>
+
+namespace embedded_ml {
+
+// Model logits for every reachable input: one-hot(char_idx) + pos / 10
+// Equivalent to adjective_model_larger256_4Model::InferenceOneHotLogits without linking the weights
+class adjective_model_larger256_4Table {
+public:
+    static constexpr size_t kNumPositions = 9;
+    static constexpr size_t kNumChars = 28;
+    static constexpr size_t kOutputSize = 28;
+
+    // Next-character logits for (char_idx, pos)
+    // Returns a pointer to kOutputSize pre-softmax values
+    static const float* LookupLogits(size_t char_idx, size_t pos) {
+        return logits[pos][char_idx];
+    }
+
+private:
+    static const float logits[kNumPositions][kNumChars][kOutputSize];
+};
+
+} // namespace embedded_ml
+
+#endif // ADJECTIVE_MODEL_LARGER256_4_TABLE_H
@@ -1,26 +1,157 @@
 #include <Arduino.h>
 #include <TFT_eSPI.h>
+#include <esp_idf_version.h>
+#include <esp_pm.h>
+#if EMBEDDED_ML_WEIGHT_BLOB
+#include <esp_partition.h>
+#endif
+#include <esp_timer.h>
+#if USE_WORD_POOL
+#include "adjective_model_larger256_4_pool.h"
+#elif USE_LOOKUP_TABLE
+#include "adjective_model_larger256_4_table.h"
+#elif USE_INT8_MODEL
+#include "adjective_model_larger256_4_int8.h"
+#else
 #include "adjective_model_larger256_4.h"
+#endif
+#if WORD_FILTER
+#include "adjective_model_larger256_4_lexicon.h"
+#endif
+#include "adjective_model_larger256_4_placement.h"
+#include "profiler.h"
+#include "sampler.h"
+#include "softmax.h"
+#include "vocab.h"
+#include "word_constraint.h"
+#include "word_ring.h"
+#if EMBEDDED_ML_WEIGHT_BLOB
+#include "weight_blob.h"
+#endif
+#include <algorithm>
+#include <atomic>
 #include <cmath>
 
 using namespace embedded_ml;
 
-// --- Vocabulary (must match train.py) ---
-static constexpr int VOCAB_SIZE = 28;
-static constexpr int INPUT_DIM = 29;
-static constexpr int START_IDX = 0;
-static constexpr int END_IDX = 27;
-static constexpr int MAX_WORD_LEN = 9;
-static constexpr int SEQ_LEN = MAX_WORD_LEN + 1;
+#if EMBEDDED_ML_WEIGHT_BLOB && (USE_INT8_MODEL || USE_LOOKUP_TABLE)
+#error "EMBEDDED_ML_WEIGHT_BLOB only applies to the float engine"
+#endif
+
+#if USE_WORD_POOL && (USE_INT8_MODEL || USE_LOOKUP_TABLE || EMBEDDED_ML_WEIGHT_BLOB)
+#error "USE_WORD_POOL replaces the inference engines"
+#endif
+
+#if EMBEDDED_ML_BACKEND_PARITY && (USE_WORD_POOL || USE_LOOKUP_TABLE || USE_INT8_MODEL || !EMBEDDED_ML_PROFILE)
+#error "EMBEDDED_ML_BACKEND_PARITY checks the float engine and reports with EMBEDDED_ML_PROFILE"
+#endif
+
+// Check generated words against the training adjectives (`make lexicon` in
+// ../adjective_model_larger256_4): 0 shows every word, WORD_FILTER_NOVEL only
+// words that are not verbatim training adjectives, WORD_FILTER_KNOWN only ones that are
+#define WORD_FILTER_NOVEL 1
+#define WORD_FILTER_KNOWN 2
+#ifndef WORD_FILTER
+#define WORD_FILTER 0
+#endif
+
+// Constrained decoding: characters that would break WORD_FILTER,
+// MIN_WORD_CHARS or BANNED_SUBSTRINGS are masked out before each draw, so
+// words are never generated only to be thrown away. Implied by WORD_FILTER;
+// set it to 1 to use the length and substring rules alone
+#ifndef USE_WORD_CONSTRAINTS
+#define USE_WORD_CONSTRAINTS (WORD_FILTER != 0)
+#endif
+
+#if USE_WORD_POOL && USE_WORD_CONSTRAINTS
+#error "WORD_FILTER and USE_WORD_CONSTRAINTS apply to live generation, not to the word pool"
+#endif
+
+#if USE_WORD_POOL && PREFIX_BRANCH_PERCENT
+#error "PREFIX_BRANCH_PERCENT applies to live generation, not to the word pool"
+#endif
+
+#if WORD_FILTER
+using Lexicon = adjective_model_larger256_4Lexicon;
+#else
+using Lexicon = NoLexicon;
+#endif
+
+#if USE_WORD_POOL
+using WordPool = adjective_model_larger256_4Pool;
+#elif USE_INT8_MODEL
+using NextCharModel = adjective_model_larger256_4Int8Model;
+#elif !USE_LOOKUP_TABLE
+using NextCharModel = adjective_model_larger256_4Model;
+#endif
 
 // --- Tunable ---
 static constexpr float TEMPERATURE = 0.5f;
+static constexpr float INV_TEMPERATURE = 1.0f / TEMPERATURE;
 static constexpr int DELAY_PRESET_MS = 2400;
 static constexpr int DELAY_GENERATED_MS = 1200;
 static constexpr int KEYSTROKE_MIN_MS = 60;
 static constexpr int KEYSTROKE_MAX_MS = 180;
 static constexpr int KEYSTROKE_PRESET_MS = 90;
 static constexpr int CURSOR_BLINK_MS = 600;
+#if USE_WORD_CONSTRAINTS
+static constexpr size_t MIN_WORD_CHARS = 1;
+// Substrings no generated word may contain; nullptr ends the list
+static const char* const BANNED_SUBSTRINGS[] = { nullptr };
+static constexpr int WORD_CONSTRAINT_MAX_ATTEMPTS = 16;  // dead ends before a partial word is shown
+#endif
+
+// Percent of generated words that branch from the previous one: they keep a
+// random prefix of it and only the rest is sampled (never the same word), so
+// the display retypes just the tail. 0 samples every word from scratch
+#ifndef PREFIX_BRANCH_PERCENT
+#define PREFIX_BRANCH_PERCENT 0
+#endif
+
+// Fixed generation seed for reproducible word sequences; 0 seeds from the hardware RNG
+#ifndef SAMPLER_SEED
+#define SAMPLER_SEED 0
+#endif
+
+// Generated words kept ready ahead of the display (power of two); the
+// generator fills the ring while the presets play
+#ifndef WORD_QUEUE_DEPTH
+#define WORD_QUEUE_DEPTH 8
+#endif
+// Push word-area updates with SPI DMA so the transfer overlaps the next
+// keystroke wait instead of blocking loop(); 0 uses blocking sprite pushes
+#ifndef USE_TFT_DMA
+#define USE_TFT_DMA 1
+#endif
+
+// Let the CPU enter automatic light sleep while loop() waits between
+// keystrokes and cursor edges. Needs a core built with CONFIG_PM_ENABLE and
+// CONFIG_FREERTOS_USE_TICKLESS_IDLE, which the stock Arduino core and the envs
+// in platformio.ini are not, so it is off by default: the event-driven waits
+// below still block loop() between events, but the CPU stays at full clock.
+// A core with CONFIG_PM_ENABLE but no tickless idle rejects light sleep; the
+// clock then still scales down to 40 MHz while every task is blocked.
+// Profile builds report which of the two esp_pm_configure() accepted.
+#ifndef ENABLE_LIGHT_SLEEP
+#define ENABLE_LIGHT_SLEEP 0
+#endif
+
+// With EMBEDDED_ML_PROFILE=1, check the EMBEDDED_ML_FC_BACKEND kernels against
+// the portable ones on this chip at boot (see check_backend_parity)
+#ifndef EMBEDDED_ML_BACKEND_PARITY
+#define EMBEDDED_ML_BACKEND_PARITY 0
+#endif
+
+// With EMBEDDED_ML_PROFILE=1, probe statistics are printed over Serial this often
+static constexpr unsigned long PROFILE_REPORT_MS = 10000;
+
+#if EMBEDDED_ML_WEIGHT_BLOB
+// Data partition holding the float weight blob (partitions_blob.csv)
+static constexpr const char* MODEL_PARTITION_LABEL = "model";
+#endif
+
+static constexpr uint32_t GENERATOR_STACK_BYTES = 4096;
+static constexpr UBaseType_t GENERATOR_PRIORITY = 1;
 
 // --- Layout (portrait 135x240) ---
 static constexpr int HEADER_Y = 30;
@@ -28,68 +159,330 @@ static constexpr int HEADER_LINE2_Y = 55;
 static constexpr int WORD_START_Y = 110;
 static constexpr int WORD_LINE_H = 32;
 static constexpr int SCREEN_PAD = 4;
+static constexpr int MAX_DISPLAY_LEN = 12;  // longest displayed word; presets run past MAX_WORD_LEN
+static constexpr int WORD_AREA_Y = WORD_START_Y - 20;  // top of the sprite-backed word area
+static constexpr int DIRTY_PAD = 4;                    // slack around text boxes for glyph overhang
 
 TFT_eSPI tft = TFT_eSPI();
-
-static char idx_to_char(int idx) {
-    if (idx >= 1 && idx <= 26) return 'a' + (idx - 1);
-    return 0;
+TFT_eSprite word_sprite = TFT_eSprite(&tft);
+// False if the sprite buffer could not be allocated (the heap is smaller with
+// weights placed in DRAM); the word area is then drawn straight to the panel
+static bool word_sprite_ok = false;
+static int word_area_w = 0, word_area_h = 0;
+
+// Generation PRNG; keystroke timing keeps using random() so it does not perturb the word stream
+static Pcg32 rng;
+
+// --- Boot timeline ---
+// millis() at each boot milestone, 0 until reached; reported with the
+// profile. The first word is ready when the generator hands it over, and
+// shown when loop() starts typing it after the presets.
+static uint32_t boot_first_pixel_ms = 0;
+static std::atomic<uint32_t> boot_first_word_ready_ms{0};
+static uint32_t boot_first_word_shown_ms = 0;
+
+// Set once the word fonts are measured; loop() draws no word before that
+static std::atomic<bool> fonts_ready{false};
+static void measure_fonts();
+
+#if USE_WORD_POOL
+// --- Word pool ---
+// Words were sampled at TEMPERATURE and deduplicated on the host (`make pool`
+// in ../adjective_model_larger256_4), so drawing one is a few shifts: no
+// model, no generator task. Every pool word is equally likely.
+static_assert(WordPool::kMaxLen == MAX_WORD_LEN, "word pool was built for another MAX_WORD_LEN");
+
+static void next_generated_word(char* out) {
+    EMBEDDED_ML_PROFILE_SCOPE("generate_word");
+    WordPool::Word(rng.NextBelow(WordPool::kNumWords), out);
 }
-
-static int sample(const float* probs, int n) {
-    float r = random(0, 10000) / 10000.0f;
-    float cumulative = 0.0f;
-    for (int i = 0; i < n; i++) {
-        cumulative += probs[i];
-        if (r <= cumulative) return i;
+#else
+#if USE_WORD_CONSTRAINTS
+// Only the generator task touches the constraint state
+static WordConstraint<MAX_WORD_LEN, Lexicon> word_constraint(
+    MIN_WORD_CHARS, BANNED_SUBSTRINGS,
+    WORD_FILTER == WORD_FILTER_NOVEL ? LexiconFilter::NOVEL :
+    WORD_FILTER == WORD_FILTER_KNOWN ? LexiconFilter::KNOWN : LexiconFilter::NONE);
+#endif
+
+// Every vocabulary index, for masked draws without constraints
+static constexpr uint32_t ALL_CHARS_MASK = (1u << VOCAB_SIZE) - 1;
+
+#if !USE_LOOKUP_TABLE
+// --- Path logit cache ---
+// The logits at a position depend only on the character before it, so the
+// ones computed along the last sampled path are kept per position. Every word
+// starts from the same (start, 0) state, and a word sharing a prefix with the
+// previous one (always, when it branched from it) skips inference there too.
+// Words are the same as without the cache. Only the generator task uses it.
+struct PathLogits {
+    int key;  // char_idx + 1 of the stored logits, 0 while empty
+    float logits[VOCAB_SIZE];
+};
+static PathLogits path_logits[MAX_WORD_LEN];
+
+static const float* model_logits(int char_idx, int pos) {
+    PathLogits& entry = path_logits[pos];
+    if (entry.key != char_idx + 1) {
+        NextCharModel::InferenceOneHotLogits(char_idx, static_cast<float>(pos) / SEQ_LEN, entry.logits);
+        entry.key = char_idx + 1;
     }
-    return n - 1;
+    return entry.logits;
 }
+#endif
 
-static void generate_word(char* out, int max_len) {
-    float input[INPUT_DIM];
-    float output[VOCAB_SIZE];
-
-    int char_idx = START_IDX;
-    int len = 0;
+#if USE_LOOKUP_TABLE && !USE_WORD_CONSTRAINTS
+// One alias table per (pos, char) state at TEMPERATURE, built in setup()
+static AliasTable<VOCAB_SIZE> next_char_tables[MAX_WORD_LEN][VOCAB_SIZE];
 
+static void build_next_char_tables() {
     for (int pos = 0; pos < MAX_WORD_LEN; pos++) {
-        for (int i = 0; i < INPUT_DIM; i++) input[i] = 0.0f;
-        input[char_idx] = 1.0f;
-        input[INPUT_DIM - 1] = static_cast<float>(pos) / SEQ_LEN;
+        for (int c = 0; c < VOCAB_SIZE; c++) {
+            next_char_tables[pos][c].BuildSoftmax(adjective_model_larger256_4Table::LookupLogits(c, pos), INV_TEMPERATURE);
+        }
+    }
+}
 
-        adjective_model_larger256_4Model::Inference(input, output);
+static int next_char(int char_idx, int pos, uint32_t excluded) {
+    size_t next;
+    if (excluded) {
+        float weights[VOCAB_SIZE];
+        const float* logits = adjective_model_larger256_4Table::LookupLogits(char_idx, pos);
+        EMBEDDED_ML_PROFILED("sample", next = SampleMaskedSoftmaxWithTemperature(logits, weights, VOCAB_SIZE, ALL_CHARS_MASK & ~excluded, INV_TEMPERATURE, rng.NextFloat()));
+    } else {
+        EMBEDDED_ML_PROFILED("sample", next = next_char_tables[pos][char_idx].Sample(rng));
+    }
+    return static_cast<int>(next);
+}
+#else
+// Sample the next character from softmax(logits / TEMPERATURE) in one pass,
+// among the characters word_constraint allows with USE_WORD_CONSTRAINTS
+// (the table engine then samples from its logits instead of alias tables)
+// and never one of the excluded (bit per vocabulary index)
+// Returns VOCAB_SIZE if nothing is allowed
+static int next_char(int char_idx, int pos, uint32_t excluded) {
+    float weights[VOCAB_SIZE];
+#if USE_LOOKUP_TABLE
+    const float* logits = adjective_model_larger256_4Table::LookupLogits(char_idx, pos);
+#else
+    const float* logits = model_logits(char_idx, pos);
+#endif
+    size_t next;
+#if USE_WORD_CONSTRAINTS
+    const uint32_t allowed = word_constraint.AllowedMask() & ~excluded;
+    EMBEDDED_ML_PROFILED("sample", next = SampleMaskedSoftmaxWithTemperature(logits, weights, VOCAB_SIZE, allowed, INV_TEMPERATURE, rng.NextFloat()));
+#else
+    if (excluded) {
+        EMBEDDED_ML_PROFILED("sample", next = SampleMaskedSoftmaxWithTemperature(logits, weights, VOCAB_SIZE, ALL_CHARS_MASK & ~excluded, INV_TEMPERATURE, rng.NextFloat()));
+    } else {
+        EMBEDDED_ML_PROFILED("sample", next = SampleSoftmaxWithTemperature(logits, weights, VOCAB_SIZE, INV_TEMPERATURE, rng.NextFloat()));
+    }
+#endif
+    return static_cast<int>(next);
+}
+#endif
+
+// Last generated word, the branch source for PREFIX_BRANCH_PERCENT, and the
+// model position each of its letters was drawn at (a skipped start token
+// uses up a position without adding a letter)
+static char previous_word[MAX_WORD_LEN + 1] = "";
+static int8_t previous_letter_pos[MAX_WORD_LEN];
+
+// Letters of previous_word the next word keeps, 0 for a fresh word
+static int branch_point() {
+#if PREFIX_BRANCH_PERCENT
+    const int len = static_cast<int>(strlen(previous_word));
+    // A kept prefix needs a position left to draw the differing character at
+    int max_keep = 0;
+    while (max_keep < len && previous_letter_pos[max_keep] + 1 < MAX_WORD_LEN) max_keep++;
+    if (max_keep < 1 || rng.NextBelow(100) >= PREFIX_BRANCH_PERCENT) return 0;
+    return 1 + static_cast<int>(rng.NextBelow(max_keep));
+#else
+    return 0;
+#endif
+}
 
-        if (TEMPERATURE != 1.0f) {
-            float max_logp = -1e30f;
-            for (int i = 0; i < VOCAB_SIZE; i++) {
-                float lp = logf(output[i] + 1e-10f) / TEMPERATURE;
-                output[i] = lp;
-                if (lp > max_logp) max_logp = lp;
-            }
-            float sum = 0.0f;
-            for (int i = 0; i < VOCAB_SIZE; i++) {
-                output[i] = expf(output[i] - max_logp);
-                sum += output[i];
-            }
-            for (int i = 0; i < VOCAB_SIZE; i++) {
-                output[i] /= sum;
-            }
+// Starts from the first keep letters of previous_word, resuming at the
+// position after the last kept one; the character drawn next is a letter or
+// the end, and differs from what previous_word has there, so the word is new
+// letter_pos: receives the position each letter of out was drawn at
+// Returns false at a dead end, leaving the partial word in out
+static bool generate_word(char* out, int8_t* letter_pos, int max_len, int keep) {
+    EMBEDDED_ML_PROFILE_SCOPE("generate_word");
+    int char_idx = START_IDX;
+    int len = 0;
+    int pos = 0;
+#if USE_WORD_CONSTRAINTS
+    word_constraint.Reset();
+#endif
+
+    uint32_t excluded = 0;
+    if (keep > 0) {
+        for (; len < keep; len++) {
+            out[len] = previous_word[len];
+            letter_pos[len] = previous_letter_pos[len];
+            char_idx = CharToIdx(out[len]);
+#if USE_WORD_CONSTRAINTS
+            word_constraint.Append(char_idx);
+#endif
         }
+        pos = previous_letter_pos[keep - 1] + 1;
+        // A skipped start token here would let a later draw rebuild previous_word
+        excluded = (1u << START_IDX) |
+                   (1u << (previous_word[keep] ? CharToIdx(previous_word[keep]) : END_IDX));
+    }
 
-        char_idx = sample(output, VOCAB_SIZE);
+    for (; pos < MAX_WORD_LEN; pos++) {
+        char_idx = next_char(char_idx, pos, excluded);
+        excluded = 0;
 
+        if (char_idx == VOCAB_SIZE) {
+            out[len] = '\0';
+            return false;
+        }
         if (char_idx == END_IDX) break;
         if (char_idx == START_IDX) continue;
 
-        char c = idx_to_char(char_idx);
+        char c = IdxToChar(char_idx);
         if (c && len < max_len - 1) {
+            letter_pos[len] = static_cast<int8_t>(pos);
             out[len++] = c;
+#if USE_WORD_CONSTRAINTS
+            word_constraint.Append(char_idx);
+#endif
         }
     }
     out[len] = '\0';
+    return true;
+}
+
+#if EMBEDDED_ML_WEIGHT_BLOB
+// --- Weight blob ---
+// The weights live in their own data partition and are read through the
+// flash cache in place, like the compiled-in arrays would be, so swapping
+// the model only needs the partition reflashed. The mapping is never released.
+static bool map_model_weights() {
+    const esp_partition_t* partition = esp_partition_find_first(ESP_PARTITION_TYPE_DATA, ESP_PARTITION_SUBTYPE_ANY,
+                                                                MODEL_PARTITION_LABEL);
+    if (!partition) return false;
+
+    // Map only the blob itself, not the whole partition
+    WeightBlobHeader header;
+    if (esp_partition_read(partition, 0, &header, sizeof(header)) != ESP_OK) return false;
+    if (header.magic != kWeightBlobMagic || header.total_size > partition->size) return false;
+
+    const void* blob = nullptr;
+#if ESP_IDF_VERSION_MAJOR >= 5
+    esp_partition_mmap_handle_t handle;
+    if (esp_partition_mmap(partition, 0, header.total_size, ESP_PARTITION_MMAP_DATA, &blob, &handle) != ESP_OK) return false;
+#else
+    spi_flash_mmap_handle_t handle;
+    if (esp_partition_mmap(partition, 0, header.total_size, SPI_FLASH_MMAP_DATA, &blob, &handle) != ESP_OK) return false;
+#endif
+    return NextCharModel::LoadWeights(blob, header.total_size);
 }
 
+// Nothing to generate from: say so on screen and stop
+static void halt_without_weights() {
+    tft.init();
+    tft.setRotation(0);
+    tft.fillScreen(TFT_BLACK);
+    tft.setTextColor(TFT_WHITE, TFT_BLACK);
+    tft.setTextSize(1);
+    tft.setTextDatum(ML_DATUM);
+    tft.drawString("no model weights", SCREEN_PAD, HEADER_Y);
+    tft.drawString("flash the model partition", SCREEN_PAD, HEADER_LINE2_Y);
+    for (;;) {
+        delay(1000);
+    }
+}
+#endif
+
+// --- Generator task ---
+// Words are generated on PRO_CPU and handed to loop() on APP_CPU through an
+// SPSC ring, so inference never stalls the typing animation. Only the
+// generator touches rng and the model's default context.
+// Boot work that the first frame does not need also runs here, while loop()
+// types the presets: the font metrics first (the first preset waits for
+// them), then the alias tables, then words until the ring is full.
+static WordRing<WORD_QUEUE_DEPTH, MAX_WORD_LEN> word_ring;
+static TaskHandle_t generator_handle = nullptr;
+
+#if EMBEDDED_ML_BACKEND_PARITY
+// Logits of every reachable input through the selected kernel backend and
+// through the portable kernels, on the device: unlike `make bench`, this runs
+// the real ESP-DSP kernel (MADD.S, its own rounding). Reported once done.
+static float backend_parity_max_dlogit = 0.0f;
+static int backend_parity_argmax_agree = 0;
+static std::atomic<bool> backend_parity_done{false};
+
+static void check_backend_parity() {
+    for (int pos = 0; pos < MAX_WORD_LEN; pos++) {
+        for (int c = 0; c < VOCAB_SIZE; c++) {
+            float ref[VOCAB_SIZE], out[VOCAB_SIZE];
+            const float scalar = static_cast<float>(pos) / SEQ_LEN;
+            NextCharModel::InferenceOneHotLogitsPortable(c, scalar, ref);
+            NextCharModel::InferenceOneHotLogits(c, scalar, out);
+            int ref_max = 0, out_max = 0;
+            for (int i = 0; i < VOCAB_SIZE; i++) {
+                backend_parity_max_dlogit = std::max(backend_parity_max_dlogit, std::fabs(ref[i] - out[i]));
+                if (ref[i] > ref[ref_max]) ref_max = i;
+                if (out[i] > out[out_max]) out_max = i;
+            }
+            if (ref_max == out_max) backend_parity_argmax_agree++;
+        }
+    }
+    backend_parity_done.store(true, std::memory_order_release);
+}
+#endif
+
+static void generator_task(void*) {
+    measure_fonts();
+    fonts_ready.store(true, std::memory_order_release);
+#if EMBEDDED_ML_BACKEND_PARITY
+    check_backend_parity();
+#endif
+#if USE_LOOKUP_TABLE && !USE_WORD_CONSTRAINTS
+    build_next_char_tables();
+#endif
+
+    char word[MAX_WORD_LEN + 1];
+    int8_t letter_pos[MAX_WORD_LEN];
+    for (;;) {
+#if USE_WORD_CONSTRAINTS
+        for (int attempt = 1; !generate_word(word, letter_pos, sizeof(word), branch_point()) && attempt < WORD_CONSTRAINT_MAX_ATTEMPTS; attempt++) {
+        }
+#else
+        // Without constraints only a branch can dead-end (every continuation excluded)
+        while (!generate_word(word, letter_pos, sizeof(word), branch_point())) {
+        }
+#endif
+        memcpy(previous_word, word, sizeof(previous_word));
+        memcpy(previous_letter_pos, letter_pos, sizeof(previous_letter_pos));
+        // Sleep while the ring is full; every pop sends a notification
+        while (!word_ring.Push(word)) {
+            ulTaskNotifyTake(pdTRUE, portMAX_DELAY);
+        }
+        if (boot_first_word_ready_ms.load(std::memory_order_relaxed) == 0) {
+            boot_first_word_ready_ms.store(millis(), std::memory_order_relaxed);
+        }
+    }
+}
+
+static void start_generator() {
+    xTaskCreatePinnedToCore(generator_task, "generator", GENERATOR_STACK_BYTES, nullptr,
+                            GENERATOR_PRIORITY, &generator_handle, PRO_CPU_NUM);
+}
+
+// Take the next generated word, waiting only if the generator has fallen behind
+static void next_generated_word(char* out) {
+    while (!word_ring.Pop(out)) {
+        delay(1);
+    }
+    xTaskNotifyGive(generator_handle);
+}
+#endif
+
 // --- Preset words ---
 static const char* PRESETS[] = { "bleak", "bright", "beautiful", "scary", "ai", "ass", "a mystery", "scary", "exciting", "amazing", "delightful", "expensive", "sunny", "hopeful" };
 static constexpr int NUM_PRESETS = sizeof(PRESETS) / sizeof(PRESETS[0]);
@@ -97,17 +490,17 @@ static constexpr int NUM_PRESETS = sizeof(PRESETS) / sizeof(PRESETS[0]);
 // Phase: 0 = showing presets, 1 = showing generated words
 static int phase = 0;
 static int word_idx = 0;
-static char displayed[MAX_WORD_LEN + 1] = "";
+static char displayed[MAX_DISPLAY_LEN + 1] = "";
 static bool using_serif = false;
 
-static void apply_serif_font() {
-    tft.setFreeFont(&FreeSerif18pt7b);
-    tft.setTextSize(1);
+static void apply_serif_font(TFT_eSPI& gfx) {
+    gfx.setFreeFont(&FreeSerif18pt7b);
+    gfx.setTextSize(1);
 }
 
-static void apply_default_font() {
-    tft.setFreeFont(NULL);
-    tft.setTextSize(3);
+static void apply_default_font(TFT_eSPI& gfx) {
+    gfx.setFreeFont(NULL);
+    gfx.setTextSize(3);
 }
 
 static int keystroke_delay() {
@@ -127,99 +520,326 @@ static bool cursor_phase() {
     return (millis() / CURSOR_BLINK_MS) % 2 == 0;
 }
 
-// Draw word wrapped across lines, with optional blinking cursor.
-// Cursor is always accounted for in line-breaking and centering.
-static void draw_word_area(const char* word, bool with_cursor = false) {
-    int maxW = tft.width() - SCREEN_PAD * 2;
-    int centerX = tft.width() / 2;
+// --- Text layout ---
+// Glyph metrics for both word fonts are measured once at boot, and line
+// breaks and x-offsets are recomputed only when the text, cursor slot or
+// font changes. Cursor blinks reuse the cached layout.
+// textWidth() of a string is the sum of xAdvance over all glyphs but the
+// last, plus the last glyph's inked extent, so both are kept per glyph.
+struct FontMetrics {
+    uint8_t advance[128];
+    uint8_t tail[128];
+    int16_t height;
+};
+
+static FontMetrics font_metrics[2];  // [0] default font, [1] serif
+
+static void measure_font(FontMetrics& m, bool serif) {
+    if (serif) apply_serif_font(word_sprite); else apply_default_font(word_sprite);
+    memset(&m, 0, sizeof(m));
+    int ref = word_sprite.textWidth("a");
+    for (int c = ' '; c <= '~'; c++) {
+        char single[2] = { static_cast<char>(c), '\0' };
+        char pair[3] = { static_cast<char>(c), 'a', '\0' };
+        m.tail[c] = word_sprite.textWidth(single);
+        m.advance[c] = word_sprite.textWidth(pair) - ref;
+    }
+    m.height = word_sprite.fontHeight();
+}
 
-    // Clear word area
-    tft.fillRect(0, WORD_START_Y - 20, tft.width(), tft.height() - (WORD_START_Y - 20), TFT_BLACK);
-    tft.setTextColor(TFT_WHITE, TFT_BLACK);
+static void measure_fonts() {
+    measure_font(font_metrics[0], false);
+    measure_font(font_metrics[1], true);
+}
 
-    if (using_serif) apply_serif_font(); else apply_default_font();
+// Same result as textWidth() on the first n characters of s
+static int text_width(const FontMetrics& m, const char* s, int n) {
+    if (n <= 0) return 0;
+    int w = 0;
+    for (int i = 0; i < n - 1; i++) w += m.advance[s[i] & 0x7f];
+    return w + m.tail[s[n - 1] & 0x7f];
+}
 
-    // Build the full string including cursor for measurement
-    int len = strlen(word);
-    char full[MAX_WORD_LEN + 2];
-    memcpy(full, word, len);
-    if (with_cursor) {
-        full[len] = '_';
-        full[len + 1] = '\0';
-    } else {
-        full[len] = '\0';
+struct LayoutLine {
+    uint8_t start, len;  // span of TextLayout::full
+    int16_t x, w;        // left edge and width in sprite coordinates
+};
+
+struct TextLayout {
+    bool valid, serif, with_cursor;
+    char word[MAX_DISPLAY_LEN + 1];
+    char full[MAX_DISPLAY_LEN + 2];  // word plus the '_' cursor slot
+    int count;
+    LayoutLine lines[MAX_DISPLAY_LEN + 1];
+    int16_t cursor_x;
+};
+
+static TextLayout layout;
+
+static const TextLayout& layout_word(const char* word, bool with_cursor) {
+    if (layout.valid && layout.serif == using_serif && layout.with_cursor == with_cursor &&
+        strcmp(layout.word, word) == 0) {
+        return layout;
     }
-    int fullLen = strlen(full);
 
-    if (fullLen == 0) return;
+    const FontMetrics& m = font_metrics[using_serif ? 1 : 0];
+    int maxW = word_area_w - SCREEN_PAD * 2;
+    int centerX = word_area_w / 2;
 
-    // Break into lines based on full string (word + cursor)
-    int lineStart = 0;
-    int lineNum = 0;
-    char lineBuf[MAX_WORD_LEN + 2];
+    layout.valid = true;
+    layout.serif = using_serif;
+    layout.with_cursor = with_cursor;
+    strncpy(layout.word, word, MAX_DISPLAY_LEN);
+    layout.word[MAX_DISPLAY_LEN] = '\0';
 
-    while (lineStart < fullLen) {
+    // Build the full string including cursor for measurement
+    int len = strlen(layout.word);
+    memcpy(layout.full, layout.word, len);
+    if (with_cursor) layout.full[len++] = '_';
+    layout.full[len] = '\0';
+
+    // Break into lines based on full string (word + cursor): each line takes
+    // characters until the next one would overflow, and at least one
+    layout.count = 0;
+    int lineStart = 0;
+    while (lineStart < len) {
         int lineEnd = lineStart + 1;
-        while (lineEnd <= fullLen) {
-            memcpy(lineBuf, full + lineStart, lineEnd - lineStart);
-            lineBuf[lineEnd - lineStart] = '\0';
-            if (tft.textWidth(lineBuf) > maxW) {
-                lineEnd--;
-                break;
-            }
+        while (lineEnd < len && text_width(m, layout.full + lineStart, lineEnd + 1 - lineStart) <= maxW) {
             lineEnd++;
         }
-        if (lineEnd > fullLen) lineEnd = fullLen;
-        if (lineEnd == lineStart) lineEnd = lineStart + 1;
 
-        int lineLen = lineEnd - lineStart;
-        memcpy(lineBuf, full + lineStart, lineLen);
-        lineBuf[lineLen] = '\0';
+        LayoutLine& line = layout.lines[layout.count++];
+        line.start = lineStart;
+        line.len = lineEnd - lineStart;
+        line.w = text_width(m, layout.full + lineStart, line.len);
+        line.x = centerX - line.w / 2;
+        lineStart = lineEnd;
+    }
 
-        int lineY = WORD_START_Y + lineNum * WORD_LINE_H;
+    // The cursor line is centered including the cursor, which sits right after the word part
+    if (with_cursor) {
+        const LayoutLine& last = layout.lines[layout.count - 1];
+        layout.cursor_x = last.x + text_width(m, layout.full + last.start, last.len - 1);
+    }
+    return layout;
+}
 
-        // Check if this line contains the cursor (last char is '_' and it's the last line segment)
-        bool cursorOnThisLine = with_cursor && (lineEnd == fullLen);
+// --- Word area rendering ---
+// The word area is drawn off-screen into word_sprite. Each frame lists the
+// box of every string it shows; only boxes that differ from the previous
+// frame are cleared, redrawn and pushed over SPI, so a cursor blink or an
+// appended character touches a few hundred pixels instead of the whole area.
+// Lines are centered, so a line that changes moves as a whole; lines before
+// it (the common prefix of a wrapped word) are left alone.
+struct DrawnText {
+    char text[MAX_DISPLAY_LEN + 2];
+    int16_t x, y, w, h;           // sprite coordinates, padded
+    int16_t draw_x, draw_y;       // drawString position (ML_DATUM)
+};
+
+struct WordFrame {
+    bool serif;
+    int count;
+    DrawnText items[MAX_DISPLAY_LEN + 2];  // one per line plus the cursor
+};
+
+static WordFrame frames[2];
+static int frame_cur = 0;
+
+static void record_text(WordFrame& frame, const char* text, int left, int mid_y, int width) {
+    DrawnText& item = frame.items[frame.count++];
+    int h = font_metrics[frame.serif ? 1 : 0].height;
+    strncpy(item.text, text, sizeof(item.text));
+    item.draw_x = left;
+    item.draw_y = mid_y;
+    item.x = left - DIRTY_PAD;
+    item.y = mid_y - h / 2 - DIRTY_PAD;
+    item.w = width + 2 * DIRTY_PAD;
+    item.h = h + 2 * DIRTY_PAD;
+}
 
-        if (cursorOnThisLine) {
-            // Draw the line centered including cursor space
-            tft.setTextDatum(MC_DATUM);
-            // Draw word chars only (not the _), but positioned for full width
-            int fullLineW = tft.textWidth(lineBuf);
-            int startX = centerX - fullLineW / 2;
+static bool same_text(const DrawnText& a, const DrawnText& b) {
+    return a.x == b.x && a.y == b.y && a.w == b.w && strcmp(a.text, b.text) == 0;
+}
+
+// Bounding box of everything that changed between prev and cur
+static bool dirty_rect(const WordFrame& prev, const WordFrame& cur, int& x0, int& y0, int& x1, int& y1) {
+    x0 = y0 = INT16_MAX;
+    x1 = y1 = INT16_MIN;
+    bool all = prev.serif != cur.serif;
+    int n = prev.count > cur.count ? prev.count : cur.count;
+    for (int i = 0; i < n; i++) {
+        bool in_prev = i < prev.count, in_cur = i < cur.count;
+        if (!all && in_prev && in_cur && same_text(prev.items[i], cur.items[i])) continue;
+        const DrawnText* changed[2] = { in_prev ? &prev.items[i] : nullptr, in_cur ? &cur.items[i] : nullptr };
+        for (const DrawnText* item : changed) {
+            if (!item) continue;
+            if (item->x < x0) x0 = item->x;
+            if (item->y < y0) y0 = item->y;
+            if (item->x + item->w > x1) x1 = item->x + item->w;
+            if (item->y + item->h > y1) y1 = item->y + item->h;
+        }
+    }
+    if (x0 < 0) x0 = 0;
+    if (y0 < 0) y0 = 0;
+    if (x1 > word_area_w) x1 = word_area_w;
+    if (y1 > word_area_h) y1 = word_area_h;
+    return x0 < x1 && y0 < y1;
+}
 
-            // Separate word part and cursor
-            char wordPart[MAX_WORD_LEN + 2];
-            memcpy(wordPart, lineBuf, lineLen - 1);
-            wordPart[lineLen - 1] = '\0';
+// Send the sprite box [x0, x1) x [y0, y1) to the panel.
+// With DMA the box is widened to whole rows, which are contiguous in the
+// sprite buffer, and the transfer runs in the background; draw_word_area()
+// waits for it before touching the sprite again.
+static void push_word_area(int x0, int y0, int x1, int y1) {
+    if (!word_sprite_ok) return;  // already drawn on the panel
+#if USE_TFT_DMA
+    (void)x0;
+    (void)x1;
+    uint16_t* rows = static_cast<uint16_t*>(word_sprite.getPointer()) + y0 * word_sprite.width();
+    tft.pushImageDMA(0, WORD_AREA_Y + y0, word_sprite.width(), y1 - y0, rows);
+#else
+    word_sprite.pushSprite(x0, WORD_AREA_Y + y0, x0, y0, x1 - x0, y1 - y0);
+#endif
+}
 
-            tft.setTextDatum(ML_DATUM);
-            tft.drawString(wordPart, startX, lineY);
+// Block until the previous word-area push has left the sprite buffer
+static void wait_word_area() {
+#if USE_TFT_DMA
+    tft.dmaWait();
+#endif
+}
 
-            if (cursor_phase()) {
-                int wordPartW = tft.textWidth(wordPart);
-                tft.drawString("_", startX + wordPartW, lineY - (using_serif ? 3 : 0));
-            }
-        } else {
-            tft.setTextDatum(MC_DATUM);
-            tft.drawString(lineBuf, centerX, lineY);
+static bool overlaps(const DrawnText& item, int x0, int y0, int x1, int y1) {
+    return item.x < x1 && item.x + item.w > x0 && item.y < y1 && item.y + item.h > y0;
+}
+
+// Draw word wrapped across lines, with optional blinking cursor.
+// Cursor is always accounted for in line-breaking and centering.
+static void draw_word_area(const char* word, bool with_cursor = false) {
+    EMBEDDED_ML_PROFILE_SCOPE("draw_word_area");
+    const TextLayout& text = layout_word(word, with_cursor);
+
+    WordFrame& frame = frames[frame_cur];
+    frame.serif = using_serif;
+    frame.count = 0;
+
+    char lineBuf[MAX_DISPLAY_LEN + 2];
+    for (int i = 0; i < text.count; i++) {
+        const LayoutLine& line = text.lines[i];
+        int lineY = WORD_START_Y - WORD_AREA_Y + i * WORD_LINE_H;
+
+        // The last line of a cursor layout ends in the '_' slot: show the
+        // word part, and the cursor itself only in the visible phase
+        bool cursorOnThisLine = with_cursor && i == text.count - 1;
+        int drawLen = cursorOnThisLine ? line.len - 1 : line.len;
+
+        memcpy(lineBuf, text.full + line.start, drawLen);
+        lineBuf[drawLen] = '\0';
+        record_text(frame, lineBuf, line.x, lineY, cursorOnThisLine ? text.cursor_x - line.x : line.w);
+
+        if (cursorOnThisLine && cursor_phase()) {
+            int cursorY = lineY - (using_serif ? 3 : 0);
+            record_text(frame, "_", text.cursor_x, cursorY, text_width(font_metrics[using_serif ? 1 : 0], "_", 1));
         }
+    }
 
-        lineStart = lineEnd;
-        lineNum++;
+    int x0, y0, x1, y1;
+    if (dirty_rect(frames[frame_cur ^ 1], frame, x0, y0, x1, y1)) {
+        // Clear the changed box once the last push has completed, then redraw
+        // every string reaching into it: unchanged ones only rewrite their
+        // own pixels outside the box. Without a sprite the same drawing goes
+        // to the panel, shifted down to the word area (it flickers, but runs).
+        wait_word_area();
+        TFT_eSPI& canvas = word_sprite_ok ? static_cast<TFT_eSPI&>(word_sprite) : tft;
+        const int dy = word_sprite_ok ? 0 : WORD_AREA_Y;
+        canvas.fillRect(x0, y0 + dy, x1 - x0, y1 - y0, TFT_BLACK);
+        canvas.setTextColor(TFT_WHITE, TFT_BLACK);
+        canvas.setTextDatum(ML_DATUM);
+        if (using_serif) apply_serif_font(canvas); else apply_default_font(canvas);
+
+        for (int i = 0; i < frame.count; i++) {
+            const DrawnText& item = frame.items[i];
+            if (overlaps(item, x0, y0, x1, y1)) canvas.drawString(item.text, item.draw_x, item.draw_y + dy);
+        }
+        push_word_area(x0, y0, x1, y1);
+    }
+    frame_cur ^= 1;
+}
+
+// --- Wait scheduling ---
+// loop() sleeps on a one-shot esp_timer that fires at the next event, either
+// a cursor-phase edge or the end of the wait, instead of polling every 10 ms.
+// Between events the loop task is blocked, so the idle task can light-sleep.
+static esp_timer_handle_t wake_timer = nullptr;
+static TaskHandle_t loop_task = nullptr;
+
+static void on_wake_timer(void*) {
+    xTaskNotifyGive(loop_task);
+}
+
+static void init_wait_timer() {
+    loop_task = xTaskGetCurrentTaskHandle();
+    esp_timer_create_args_t args = {};
+    args.callback = on_wake_timer;
+    args.dispatch_method = ESP_TIMER_TASK;
+    args.name = "wake";
+    esp_timer_create(&args, &wake_timer);
+}
+
+// Result of the last esp_pm_configure(), ESP_ERR_INVALID_STATE while not
+// requested, and whether that call asked for light sleep or only for scaling
+static esp_err_t light_sleep_status = ESP_ERR_INVALID_STATE;
+static bool light_sleep_requested = false;
+
+static void enable_light_sleep() {
+#if ENABLE_LIGHT_SLEEP
+#if ESP_IDF_VERSION_MAJOR >= 5
+    esp_pm_config_t pm = {};
+#else
+    esp_pm_config_esp32_t pm = {};
+#endif
+    pm.max_freq_mhz = ESP.getCpuFreqMHz();
+    pm.min_freq_mhz = 40;
+    pm.light_sleep_enable = true;
+    light_sleep_requested = true;
+    light_sleep_status = esp_pm_configure(&pm);
+    if (light_sleep_status == ESP_ERR_NOT_SUPPORTED) {
+        // No tickless idle (or no CONFIG_PM_ENABLE, and this fails the same
+        // way, leaving the CPU at full speed): fall back to frequency scaling
+        pm.light_sleep_enable = false;
+        light_sleep_requested = false;
+        light_sleep_status = esp_pm_configure(&pm);
     }
+#endif
+}
+
+// Block the loop task until esp_timer_get_time() reaches wake_us
+static void sleep_until(int64_t wake_us) {
+    int64_t wait_us = wake_us - esp_timer_get_time();
+    if (wait_us <= 0) return;
+    esp_timer_start_once(wake_timer, wait_us);
+    // The timeout is only a backstop in case the timer could not be armed
+    ulTaskNotifyTake(pdTRUE, pdMS_TO_TICKS(wait_us / 1000) + 2);
+    esp_timer_stop(wake_timer);
 }
 
 static void blink_delay(int ms) {
-    unsigned long start = millis();
+    const int64_t end_us = esp_timer_get_time() + static_cast<int64_t>(ms) * 1000;
     bool last = cursor_phase();
-    while (millis() - start < (unsigned long)ms) {
+    for (;;) {
+        int64_t now_us = esp_timer_get_time();
+        if (now_us >= end_us) break;
+
+        // Next cursor edge on the millis() clock that cursor_phase() reads
+        int64_t edge_us = (now_us / 1000 / CURSOR_BLINK_MS + 1) * CURSOR_BLINK_MS * 1000;
+        sleep_until(edge_us < end_us ? edge_us : end_us);
+
         bool now = cursor_phase();
         if (now != last) {
             draw_word_area(displayed, true);
             last = now;
         }
-        delay(10);
     }
 }
 
@@ -259,16 +879,100 @@ static void type_word(const char* word, int hold_ms, bool random_strokes, bool u
     blink_delay(hold_ms);
 }
 
+#if EMBEDDED_ML_PROFILE
+static unsigned long last_profile_report = 0;
+
+static void print_profile_line(const char* line) {
+    Serial.println(line);
+}
+
+// Weight bytes the engine reads from internal RAM rather than through the
+// flash cache (adjective_model_larger256_4_placement.h), so layer timings of
+// builds with different placements can be told apart
+#if EMBEDDED_ML_FLASH_ONLY || USE_WORD_POOL || USE_LOOKUP_TABLE || EMBEDDED_ML_WEIGHT_BLOB
+static constexpr unsigned INTERNAL_RAM_WEIGHT_BYTES = 0;
+#elif USE_INT8_MODEL
+static constexpr unsigned INTERNAL_RAM_WEIGHT_BYTES = EMBEDDED_ML_INT8_INTERNAL_RAM_BYTES;
+#else
+static constexpr unsigned INTERNAL_RAM_WEIGHT_BYTES = EMBEDDED_ML_INTERNAL_RAM_BYTES;
+#endif
+
+// Dump and reset all probes every PROFILE_REPORT_MS
+static void report_profile() {
+    if (millis() - last_profile_report < PROFILE_REPORT_MS) return;
+    last_profile_report = millis();
+    Serial.printf("prof placement internal_ram_weight_bytes=%u\n", INTERNAL_RAM_WEIGHT_BYTES);
+    Serial.printf("prof power mode=%s status=%s\n",
+                  !ENABLE_LIGHT_SLEEP ? "off" : light_sleep_status != ESP_OK ? "full_speed" :
+                  light_sleep_requested ? "light_sleep" : "scaling",
+                  ENABLE_LIGHT_SLEEP ? esp_err_to_name(light_sleep_status) : "-");
+    Serial.printf("prof memory word_sprite=%s free_heap=%u\n",
+                  word_sprite_ok ? "ok" : "failed", static_cast<unsigned>(ESP.getFreeHeap()));
+#if EMBEDDED_ML_BACKEND_PARITY
+    if (backend_parity_done.load(std::memory_order_acquire)) {
+        Serial.printf("prof backend_parity inputs=%d max_dlogit=%.3g argmax_agree=%d/%d\n",
+                      MAX_WORD_LEN * VOCAB_SIZE, backend_parity_max_dlogit,
+                      backend_parity_argmax_agree, MAX_WORD_LEN * VOCAB_SIZE);
+    }
+#endif
+    Serial.printf("prof boot first_pixel_ms=%u first_word_ready_ms=%u first_word_shown_ms=%u\n",
+                  static_cast<unsigned>(boot_first_pixel_ms),
+                  static_cast<unsigned>(boot_first_word_ready_ms.load(std::memory_order_relaxed)),
+                  static_cast<unsigned>(boot_first_word_shown_ms));
+    ProfileStat::Report(print_profile_line);
+}
+#endif
+
+// Staged boot: the header frame goes out as soon as the panel is up, then
+// only what loop() needs for the first preset; the rest is left to the
+// generator task (see above)
 void setup() {
-    randomSeed(esp_random());
     tft.init();
     tft.setRotation(0);  // Portrait, 0deg
     tft.fillScreen(TFT_BLACK);
     tft.setTextColor(TFT_WHITE, TFT_BLACK);
     draw_header();
+    boot_first_pixel_ms = millis();
+
+#if EMBEDDED_ML_PROFILE
+    Serial.begin(115200);
+#endif
+    randomSeed(esp_random());
+    init_wait_timer();
+    enable_light_sleep();
+#if SAMPLER_SEED
+    rng.Seed(SAMPLER_SEED);
+#else
+    rng.Seed((static_cast<uint64_t>(esp_random()) << 32) | esp_random());
+#endif
+#if EMBEDDED_ML_WEIGHT_BLOB
+    if (!map_model_weights()) halt_without_weights();
+#endif
+    // 16-bit sprite covering the word area, about 40 KB of heap
+    word_area_w = tft.width();
+    word_area_h = tft.height() - WORD_AREA_Y;
+    word_sprite_ok = word_sprite.createSprite(word_area_w, word_area_h) != nullptr;
+#if USE_WORD_POOL
+    // No generator task to hand the measuring to
+    measure_fonts();
+    fonts_ready.store(true, std::memory_order_release);
+#else
+    start_generator();
+#endif
+#if USE_TFT_DMA
+    // DMA transfers need the bus held for the rest of the run
+    tft.initDMA();
+    tft.startWrite();
+#endif
 }
 
 void loop() {
+#if EMBEDDED_ML_PROFILE
+    report_profile();
+#endif
+    while (!fonts_ready.load(std::memory_order_acquire)) {
+        delay(1);
+    }
     if (phase == 0) {
         type_word(PRESETS[word_idx], DELAY_PRESET_MS, false, true);
         word_idx++;
@@ -278,7 +982,8 @@ void loop() {
         }
     } else {
         char word[MAX_WORD_LEN + 1];
-        generate_word(word, sizeof(word));
+        next_generated_word(word);
+        if (boot_first_word_shown_ms == 0) boot_first_word_shown_ms = millis();
         type_word(word, DELAY_GENERATED_MS, true, false);
         word_idx++;
         if (word_idx >= NUM_PRESETS) {
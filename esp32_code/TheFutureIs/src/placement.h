@@ -0,0 +1,27 @@
+// components/placement.h
+// Memory placement attribute for weight arrays
+// Pure C++ implementation for embedded systems
+//
+// On the ESP32, const arrays stay in flash and are read through the 32 KB
+// cache that code shares; a matrix larger than that is fetched from SPI flash
+// again on every inference. EMBEDDED_ML_INTERNAL_RAM puts an array in
+// internal DRAM instead, copied there by the bootloader, at the cost of that
+// much less heap. DRAM rather than IRAM: IRAM only allows 32-bit loads, which
+// the int8 kernels do not do. On the host the attribute is empty.
+//
+// Which layers get it is decided per layer against a byte budget by the
+// generated *_placement.h (`make placement`).
+
+#ifndef PLACEMENT_H
+#define PLACEMENT_H
+
+// EMBEDDED_ML_FLASH_ONLY=1 keeps every layer in flash, the baseline for
+// profiling a placement
+#if defined(ARDUINO) && !EMBEDDED_ML_FLASH_ONLY
+#include <esp_attr.h>
+#define EMBEDDED_ML_INTERNAL_RAM DRAM_ATTR
+#else
+#define EMBEDDED_ML_INTERNAL_RAM
+#endif
+
+#endif // PLACEMENT_H
@@ -0,0 +1,37 @@
+// components/vocab.h
+// Character vocabulary of the adjective models
+// Pure C++ implementation for embedded systems
+//
+// The one C++ copy of VOCAB / MAX_WORD_LEN in model-training/train.py, used
+// by the firmware, the host tools and the Python library (train.py checks
+// the library's sizes against its own when it loads it).
+
+#ifndef VOCAB_H
+#define VOCAB_H
+
+namespace embedded_ml {
+
+// Index 0: start token '^'
+// Index 1-26: 'a'-'z'
+// Index 27: end token '$'
+static constexpr int VOCAB_SIZE = 28;
+static constexpr int INPUT_DIM = VOCAB_SIZE + 1;  // one-hot character + position
+static constexpr int START_IDX = 0;
+static constexpr int END_IDX = 27;
+static constexpr int MAX_WORD_LEN = 9;            // letters, not counting start/end
+static constexpr int SEQ_LEN = MAX_WORD_LEN + 1;  // position input is pos / SEQ_LEN
+
+// Letter of a vocabulary index, 0 for the start and end tokens
+inline char IdxToChar(int idx) {
+    if (idx >= 1 && idx <= 26) return 'a' + (idx - 1);
+    return 0;
+}
+
+// Vocabulary index of a letter 'a'-'z'
+inline int CharToIdx(char c) {
+    return c - 'a' + 1;
+}
+
+} // namespace embedded_ml
+
+#endif // VOCAB_H
@@ -0,0 +1,151 @@
+// components/weight_blob.h
+// Versioned binary weight blob: header, tensor table, aligned tensor data
+// Pure C++ implementation for embedded systems
+//
+// Layout (little-endian, offsets from the start of the blob):
+//   WeightBlobHeader
+//   WeightBlobTensor[tensor_count]
+//   tensor data, each tensor starting on an `alignment` boundary
+// The blob is read in place (esp_partition_mmap on the device, mmap on the
+// host); nothing is copied.
+
+#ifndef WEIGHT_BLOB_H
+#define WEIGHT_BLOB_H
+
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+
+#if !defined(ARDUINO)
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+namespace embedded_ml {
+
+static constexpr uint32_t kWeightBlobMagic = 0x574c4d45;  // "EMLW"
+static constexpr uint16_t kWeightBlobVersion = 1;
+static constexpr size_t kWeightBlobMaxRank = 4;
+static constexpr size_t kWeightBlobNameSize = 96;
+
+enum class WeightDType : uint8_t {
+    FLOAT32 = 0,
+    INT8 = 1
+};
+
+// How a matrix is stored; rank-1 tensors are always ROW_MAJOR
+enum class WeightLayout : uint8_t {
+    ROW_MAJOR = 0,
+    COLUMN_MAJOR = 1,
+    TILED = 2        // FullyConnectedTiled layout, tile height in WeightBlobTensor::tile_rows
+};
+
+struct WeightBlobHeader {
+    uint32_t magic;          // kWeightBlobMagic
+    uint16_t version;        // kWeightBlobVersion
+    uint16_t header_size;    // sizeof(WeightBlobHeader)
+    uint32_t tensor_count;
+    uint32_t alignment;      // of every tensor's data offset, a power of two
+    uint32_t total_size;     // bytes, including the tensor data
+    uint32_t reserved[3];
+};
+
+struct WeightBlobTensor {
+    char name[kWeightBlobNameSize];  // generated C++ name, NUL-terminated
+    WeightDType dtype;
+    WeightLayout layout;
+    uint8_t rank;
+    uint8_t tile_rows;
+    uint32_t shape[kWeightBlobMaxRank];
+    uint32_t offset;         // of the data, from the start of the blob
+    uint32_t size;           // bytes of data
+    uint32_t reserved;
+};
+
+static_assert(sizeof(WeightBlobHeader) == 32, "WeightBlobHeader layout changed");
+static_assert(sizeof(WeightBlobTensor) == 128, "WeightBlobTensor layout changed");
+
+inline size_t WeightDTypeSize(WeightDType dtype) {
+    return dtype == WeightDType::INT8 ? 1 : 4;
+}
+
+// Check the header, the tensor table and every tensor's bounds and alignment
+// Returns the header, or nullptr if data is not a valid blob of at most size bytes
+inline const WeightBlobHeader* ValidateWeightBlob(const void* data, size_t size) {
+    if (!data || size < sizeof(WeightBlobHeader)) return nullptr;
+    if (reinterpret_cast<uintptr_t>(data) % alignof(WeightBlobHeader) != 0) return nullptr;
+
+    const WeightBlobHeader* header = static_cast<const WeightBlobHeader*>(data);
+    if (header->magic != kWeightBlobMagic || header->version != kWeightBlobVersion) return nullptr;
+    if (header->header_size != sizeof(WeightBlobHeader)) return nullptr;
+    if (header->total_size > size) return nullptr;
+    if (header->alignment < 4 || (header->alignment & (header->alignment - 1)) != 0) return nullptr;
+    if (header->tensor_count > (header->total_size - sizeof(WeightBlobHeader)) / sizeof(WeightBlobTensor)) return nullptr;
+
+    const WeightBlobTensor* tensors = reinterpret_cast<const WeightBlobTensor*>(header + 1);
+    for (uint32_t t = 0; t < header->tensor_count; ++t) {
+        const WeightBlobTensor& tensor = tensors[t];
+        if (memchr(tensor.name, '\0', kWeightBlobNameSize) == nullptr) return nullptr;
+        if (tensor.rank == 0 || tensor.rank > kWeightBlobMaxRank) return nullptr;
+
+        uint64_t count = 1;
+        for (uint8_t d = 0; d < tensor.rank; ++d) count *= tensor.shape[d];
+        if (count * WeightDTypeSize(tensor.dtype) != tensor.size) return nullptr;
+        if (tensor.offset % header->alignment != 0) return nullptr;
+        if (static_cast<uint64_t>(tensor.offset) + tensor.size > header->total_size) return nullptr;
+    }
+    return header;
+}
+
+// What a model expects of one tensor; FindWeightTensor matches all fields exactly
+struct WeightTensorSpec {
+    const char* name;
+    WeightDType dtype;
+    WeightLayout layout;
+    uint8_t tile_rows;       // TILED only, otherwise 0
+    uint8_t rank;
+    uint32_t shape[kWeightBlobMaxRank];
+};
+
+// Data of the tensor matching spec, or nullptr if it is missing or differs
+// header: a blob accepted by ValidateWeightBlob
+inline const void* FindWeightTensor(const WeightBlobHeader* header, const WeightTensorSpec& spec) {
+    const WeightBlobTensor* tensors = reinterpret_cast<const WeightBlobTensor*>(header + 1);
+    for (uint32_t t = 0; t < header->tensor_count; ++t) {
+        const WeightBlobTensor& tensor = tensors[t];
+        if (strcmp(tensor.name, spec.name) != 0) continue;
+        if (tensor.dtype != spec.dtype || tensor.layout != spec.layout) return nullptr;
+        if (tensor.tile_rows != spec.tile_rows || tensor.rank != spec.rank) return nullptr;
+        for (uint8_t d = 0; d < spec.rank; ++d) {
+            if (tensor.shape[d] != spec.shape[d]) return nullptr;
+        }
+        return reinterpret_cast<const uint8_t*>(header) + tensor.offset;
+    }
+    return nullptr;
+}
+
+#if !defined(ARDUINO)
+// Map a blob file read-only for the rest of the process
+// Returns the mapping and sets *size, or nullptr if the file cannot be opened or mapped
+inline const void* MapWeightBlobFile(const char* path, size_t* size) {
+    int fd = open(path, O_RDONLY);
+    if (fd < 0) return nullptr;
+
+    struct stat st;
+    void* data = MAP_FAILED;
+    if (fstat(fd, &st) == 0 && st.st_size > 0) {
+        data = mmap(nullptr, static_cast<size_t>(st.st_size), PROT_READ, MAP_PRIVATE, fd, 0);
+    }
+    close(fd);  // the mapping stays valid
+    if (data == MAP_FAILED) return nullptr;
+
+    *size = static_cast<size_t>(st.st_size);
+    return data;
+}
+#endif
+
+} // namespace embedded_ml
+
+#endif // WEIGHT_BLOB_H
@@ -0,0 +1,64 @@
+// word_ring.h
+// Lock-free single-producer single-consumer ring of generated words
+// One task pushes, one task pops; no locks, no allocation
+
+#ifndef WORD_RING_H
+#define WORD_RING_H
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+
+namespace embedded_ml {
+
+// Fixed-capacity SPSC queue of NUL-terminated words up to kMaxLen characters
+// head_ is written only by the producer and tail_ only by the consumer; both
+// count up forever and are reduced modulo kCapacity, so all kCapacity slots
+// are usable and full/empty never alias
+template<size_t kCapacity, size_t kMaxLen>
+class WordRing {
+    static_assert(kCapacity > 0 && (kCapacity & (kCapacity - 1)) == 0,
+                  "WordRing capacity must be a power of two");
+
+public:
+    // Producer side: copy word into the next free slot, false if the ring is full
+    bool Push(const char* word) {
+        const uint32_t head = head_.load(std::memory_order_relaxed);
+        if (head - tail_.load(std::memory_order_acquire) == kCapacity) return false;
+
+        char* slot = slots_[head & kMask];
+        strncpy(slot, word, kMaxLen);
+        slot[kMaxLen] = '\0';
+        head_.store(head + 1, std::memory_order_release);
+        return true;
+    }
+
+    // Consumer side: copy the oldest word into out (kMaxLen + 1 bytes), false if empty
+    bool Pop(char* out) {
+        const uint32_t tail = tail_.load(std::memory_order_relaxed);
+        if (head_.load(std::memory_order_acquire) == tail) return false;
+
+        memcpy(out, slots_[tail & kMask], kMaxLen + 1);
+        tail_.store(tail + 1, std::memory_order_release);
+        return true;
+    }
+
+    // Approximate from either side, exact from a quiescent ring
+    size_t Size() const {
+        return head_.load(std::memory_order_acquire) - tail_.load(std::memory_order_acquire);
+    }
+
+    bool Full() const { return Size() == kCapacity; }
+
+private:
+    static constexpr uint32_t kMask = kCapacity - 1;
+
+    char slots_[kCapacity][kMaxLen + 1];
+    std::atomic<uint32_t> head_{0};
+    std::atomic<uint32_t> tail_{0};
+};
+
+} // namespace embedded_ml
+
+#endif // WORD_RING_H
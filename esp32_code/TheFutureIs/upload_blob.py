@@ -0,0 +1,41 @@
+# upload_blob.py
+# PlatformIO extra script for EMBEDDED_ML_WEIGHT_BLOB builds
+# `pio run -e ttgo-t1-blob -t uploadblob` writes the weight blob from
+# `make blob` in ../adjective_model_larger256_4 to the model partition
+
+import csv
+import os
+
+Import("env")
+
+BLOB_PATH = os.path.join(env.subst("$PROJECT_DIR"), "model", "adjective_model_larger256_4_weights.bin")
+PARTITION_LABEL = "model"
+
+
+def model_partition_offset():
+    table = os.path.join(env.subst("$PROJECT_DIR"), env.GetProjectOption("board_build.partitions"))
+    with open(table) as f:
+        for row in csv.reader(line for line in f if not line.lstrip().startswith("#")):
+            fields = [field.strip() for field in row]
+            if fields and fields[0] == PARTITION_LABEL:
+                return fields[3]
+    raise ValueError("no %s partition in %s" % (PARTITION_LABEL, table))
+
+
+def upload_blob(*args, **kwargs):
+    if not os.path.isfile(BLOB_PATH):
+        print("error: %s not found, run `make blob` first" % BLOB_PATH)
+        env.Exit(1)
+    env.AutodetectUploadPort()
+    env.Execute(env.VerboseAction(
+        '"$PYTHONEXE" "$UPLOADER" --chip esp32 --port "$UPLOAD_PORT" --baud $UPLOAD_SPEED '
+        'write_flash %s "%s"' % (model_partition_offset(), BLOB_PATH),
+        "Writing weight blob to the %s partition" % PARTITION_LABEL))
+
+
+env.AddCustomTarget(
+    name="uploadblob",
+    dependencies=None,
+    actions=[upload_blob],
+    title="Upload weight blob",
+    description="Write the float weight blob to the model partition")
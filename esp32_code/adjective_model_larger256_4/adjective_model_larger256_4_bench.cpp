@@ -0,0 +1,543 @@
+// adjective_model_larger256_4_bench.cpp
+// Host benchmarks for the inference kernels and end-to-end word generation
+// Every measurement is repeated and reported as median and MAD (median absolute deviation)
+// Also sweeps the low-rank factorization of layers 1-3, reporting speed and divergence per rank,
+// checks the ESP-DSP kernel backend against the portable kernels per layer,
+// and fails if the batched model API disagrees with the single-item one
+//
+// Usage: adjective_model_larger256_4_bench [--trials N]
+// BLOB=1 builds also take [--weights FILE] (default: the blob written by `make blob`)
+
+#include "adjective_model_larger256_4.h"
+#include "adjective_model_larger256_4_int8.h"
+#include "adjective_model_larger256_4_table.h"
+// Full float weights for the low-rank sweep, independent of the weights the model was built with
+#include "adjective_model_larger256_4_weights.cpp"
+#include "components/fully_connected.h"
+#include "components/low_rank.h"
+#include "components/sampler.h"
+#include "components/softmax.h"
+#include "components/vocab.h"
+#if EMBEDDED_ML_WEIGHT_BLOB
+#include "components/weight_blob.h"
+#endif
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <functional>
+#include <vector>
+
+using namespace embedded_ml;
+
+static constexpr float TEMPERATURE = 0.5f;
+static constexpr float INV_TEMPERATURE = 1.0f / TEMPERATURE;
+
+// Each trial runs for at least this long; the first trial is a discarded warm-up
+static constexpr double TRIAL_SECONDS = 0.02;
+static int num_trials = 15;
+
+// Fixed seeds so every run sees the same weights and the same word stream
+static constexpr uint64_t KERNEL_SEED = 1;
+static constexpr uint64_t GENERATION_SEED = 2;
+
+// Keeps results observable so the optimizer cannot drop the timed work
+static volatile float sink;
+
+struct Summary {
+    double median;
+    double mad;
+};
+
+static Summary summarize(std::vector<double> samples) {
+    std::sort(samples.begin(), samples.end());
+    double median = samples[samples.size() / 2];
+    for (double& s : samples) s = s > median ? s - median : median - s;
+    std::sort(samples.begin(), samples.end());
+    return { median, samples[samples.size() / 2] };
+}
+
+// Seconds per call of fn, one sample per trial
+static Summary time_per_call(const std::function<void()>& fn) {
+    using Clock = std::chrono::steady_clock;
+
+    // Calibrate the repeat count so one trial takes about TRIAL_SECONDS
+    size_t reps = 1;
+    for (;;) {
+        auto start = Clock::now();
+        for (size_t r = 0; r < reps; r++) fn();
+        double elapsed = std::chrono::duration<double>(Clock::now() - start).count();
+        if (elapsed >= TRIAL_SECONDS) break;
+        reps *= 2;
+    }
+
+    std::vector<double> samples;
+    for (int t = 0; t <= num_trials; t++) {
+        auto start = Clock::now();
+        for (size_t r = 0; r < reps; r++) fn();
+        double elapsed = std::chrono::duration<double>(Clock::now() - start).count();
+        if (t > 0) samples.push_back(elapsed / reps);
+    }
+    return summarize(samples);
+}
+
+static void report_kernel(const char* name, const std::function<void()>& fn) {
+    Summary s = time_per_call(fn);
+    printf("  %-50s %10.1f ns  (MAD %6.1f)\n", name, s.median * 1e9, s.mad * 1e9);
+}
+
+static std::vector<float> random_floats(Pcg32& rng, size_t count, float scale) {
+    std::vector<float> values(count);
+    for (float& v : values) v = (rng.NextFloat() * 2.0f - 1.0f) * scale;
+    return values;
+}
+
+// --- Kernels ---
+// Synthetic weights at the model's layer shapes, so each kernel runs in isolation
+static void bench_kernels() {
+    Pcg32 rng(KERNEL_SEED);
+
+    std::vector<float> input = random_floats(rng, 256, 1.0f);
+    std::vector<float> output(256);
+    std::vector<float> w_in = random_floats(rng, 29 * 256, 0.1f);
+    std::vector<float> w_hidden = random_floats(rng, 256 * 256, 0.1f);
+    std::vector<float> w_out = random_floats(rng, 256 * 28, 0.1f);
+    std::vector<float> bias = random_floats(rng, 256, 0.1f);
+
+    std::vector<float> w_hidden_tiled(w_hidden.size());
+    TileWeights<float, 4>(w_hidden.data(), w_hidden_tiled.data(), 256, 256);
+
+    // Int8 copy of the hidden weights with per-row scales
+    std::vector<int8_t> w_hidden_i8(w_hidden.size());
+    std::vector<float> w_hidden_scales(256);
+    for (size_t row = 0; row < 256; row++) {
+        w_hidden_scales[row] = QuantizeInt8(&w_hidden[row * 256], &w_hidden_i8[row * 256], 256);
+    }
+    std::vector<int8_t> input_i8(256);
+
+    std::vector<float> one_hot(29, 0.0f);
+    one_hot[5] = 1.0f;
+    one_hot[28] = 0.3f;
+
+    printf("kernels (per call):\n");
+
+    report_kernel("FullyConnected 29x256", [&] {
+        FullyConnected(one_hot.data(), w_in.data(), bias.data(), output.data(), 29, 256, ActivationType::RELU);
+        sink = output[0];
+    });
+    report_kernel("FullyConnectedColumnMajor 29x256", [&] {
+        FullyConnectedColumnMajor(one_hot.data(), w_in.data(), bias.data(), output.data(), 29, 256, ActivationType::RELU);
+        sink = output[0];
+    });
+    report_kernel("FullyConnectedOneHotPlusScalar 29x256", [&] {
+        FullyConnectedOneHotPlusScalar(5, 0.3f, w_in.data(), bias.data(), output.data(), 29, 256, ActivationType::RELU);
+        sink = output[0];
+    });
+    report_kernel("FullyConnected 256x256", [&] {
+        FullyConnected(input.data(), w_hidden.data(), bias.data(), output.data(), 256, 256, ActivationType::RELU);
+        sink = output[0];
+    });
+    report_kernel("FullyConnectedBlocked 256x256", [&] {
+        FullyConnectedBlocked<float, 4>(input.data(), w_hidden.data(), bias.data(), output.data(), 256, 256, ActivationType::RELU);
+        sink = output[0];
+    });
+    report_kernel("FullyConnectedTiled 256x256", [&] {
+        FullyConnectedTiled<float, 4>(input.data(), w_hidden_tiled.data(), bias.data(), output.data(), 256, 256, ActivationType::RELU);
+        sink = output[0];
+    });
+    report_kernel("FullyConnected<256, 256, RELU>", [&] {
+        FullyConnected<float, 256, 256, ActivationType::RELU>(input.data(), w_hidden.data(), bias.data(), output.data());
+        sink = output[0];
+    });
+    report_kernel("FullyConnectedEspDsp<256, 256, RELU> (host loop)", [&] {
+        FullyConnectedEspDsp<256, 256, ActivationType::RELU>(input.data(), w_hidden.data(), bias.data(), output.data());
+        sink = output[0];
+    });
+    report_kernel("FullyConnectedTiled<256, 256, RELU>", [&] {
+        FullyConnectedTiled<float, 256, 256, ActivationType::RELU>(input.data(), w_hidden_tiled.data(), bias.data(), output.data());
+        sink = output[0];
+    });
+    report_kernel("QuantizeInt8 + FullyConnectedInt8 256x256", [&] {
+        float scale = QuantizeInt8(input.data(), input_i8.data(), 256);
+        FullyConnectedInt8(input_i8.data(), scale, w_hidden_i8.data(), w_hidden_scales.data(), bias.data(), output.data(), 256, 256, ActivationType::RELU);
+        sink = output[0];
+    });
+    report_kernel("QuantizeInt8 + FullyConnectedInt8<256, 256, RELU>", [&] {
+        float scale = QuantizeInt8(input.data(), input_i8.data(), 256);
+        FullyConnectedInt8<float, 256, 256, ActivationType::RELU>(input_i8.data(), scale, w_hidden_i8.data(), w_hidden_scales.data(), bias.data(), output.data());
+        sink = output[0];
+    });
+    report_kernel("FullyConnected 256x28", [&] {
+        FullyConnected(input.data(), w_out.data(), bias.data(), output.data(), 256, 28, ActivationType::NONE);
+        sink = output[0];
+    });
+    report_kernel("FullyConnectedBlocked 256x28", [&] {
+        FullyConnectedBlocked<float, 4>(input.data(), w_out.data(), bias.data(), output.data(), 256, 28, ActivationType::NONE);
+        sink = output[0];
+    });
+    report_kernel("FullyConnected<256, 28, NONE>", [&] {
+        FullyConnected<float, 256, 28, ActivationType::NONE>(input.data(), w_out.data(), bias.data(), output.data());
+        sink = output[0];
+    });
+    report_kernel("FullyConnectedEspDsp<256, 28, NONE> (host loop)", [&] {
+        FullyConnectedEspDsp<256, 28, ActivationType::NONE>(input.data(), w_out.data(), bias.data(), output.data());
+        sink = output[0];
+    });
+
+    std::vector<float> logits = random_floats(rng, VOCAB_SIZE, 4.0f);
+    std::vector<float> probs(VOCAB_SIZE);
+    AliasTable<VOCAB_SIZE> alias;
+    alias.BuildSoftmax(logits.data(), INV_TEMPERATURE);
+    Pcg32 sample_rng(KERNEL_SEED);
+
+    report_kernel("Softmax 28", [&] {
+        Softmax(logits.data(), probs.data(), VOCAB_SIZE);
+        sink = probs[0];
+    });
+    report_kernel("Softmax<28>", [&] {
+        Softmax<float, VOCAB_SIZE>(logits.data(), probs.data());
+        sink = probs[0];
+    });
+    report_kernel("SoftmaxWithTemperature 28", [&] {
+        SoftmaxWithTemperature(logits.data(), probs.data(), VOCAB_SIZE, INV_TEMPERATURE);
+        sink = probs[0];
+    });
+    report_kernel("SampleSoftmaxWithTemperature 28", [&] {
+        sink = static_cast<float>(SampleSoftmaxWithTemperature(logits.data(), probs.data(), VOCAB_SIZE, INV_TEMPERATURE, sample_rng.NextFloat()));
+    });
+    report_kernel("AliasTable<28>::Sample", [&] {
+        sink = static_cast<float>(alias.Sample(sample_rng));
+    });
+}
+
+// --- End to end ---
+enum class Engine { FLOAT, FLOAT_BATCH, INT8, TABLE };
+
+static constexpr int WORDS_PER_RUN = 64;
+
+#if EMBEDDED_ML_TILED_WEIGHTS
+static constexpr const char* FLOAT_ENGINE_NAME = "float (tiled)";
+#elif EMBEDDED_ML_FC_BACKEND == EMBEDDED_ML_FC_BACKEND_ESP_DSP && !EMBEDDED_ML_PRUNED_WEIGHTS && !EMBEDDED_ML_LOWRANK_WEIGHTS
+static constexpr const char* FLOAT_ENGINE_NAME = "float (ESP-DSP)";
+#elif EMBEDDED_ML_PRUNED_WEIGHTS
+static constexpr const char* FLOAT_ENGINE_NAME = "float (pruned)";
+#elif EMBEDDED_ML_LOWRANK_WEIGHTS
+static constexpr const char* FLOAT_ENGINE_NAME = "float (low-rank)";
+#else
+static constexpr const char* FLOAT_ENGINE_NAME = "float (blocked)";
+#endif
+
+static AliasTable<VOCAB_SIZE> next_char_tables[MAX_WORD_LEN][VOCAB_SIZE];
+
+static int sample(Pcg32& rng, const float* logits) {
+    float weights[VOCAB_SIZE];
+    return static_cast<int>(SampleSoftmaxWithTemperature(logits, weights, VOCAB_SIZE, INV_TEMPERATURE, rng.NextFloat()));
+}
+
+// Generate WORDS_PER_RUN words from a fixed seed; returns the number of letters emitted
+static size_t generate_words(Engine engine) {
+    Pcg32 rng(GENERATION_SEED);
+    size_t letters = 0;
+
+    if (engine == Engine::FLOAT_BATCH) {
+        size_t chars[WORDS_PER_RUN];
+        float positions[WORDS_PER_RUN];
+        static float logits[WORDS_PER_RUN * VOCAB_SIZE];
+        for (int w = 0; w < WORDS_PER_RUN; w++) chars[w] = START_IDX;
+        int active = WORDS_PER_RUN;
+        for (int pos = 0; pos < MAX_WORD_LEN && active > 0; pos++) {
+            for (int k = 0; k < active; k++) positions[k] = static_cast<float>(pos) / SEQ_LEN;
+            adjective_model_larger256_4Model::InferenceBatchOneHotLogits(chars, positions, logits, active);
+            int kept = 0;
+            for (int k = 0; k < active; k++) {
+                int c = sample(rng, &logits[k * VOCAB_SIZE]);
+                if (c == END_IDX) continue;
+                if (c != START_IDX) letters++;
+                chars[kept++] = c;
+            }
+            active = kept;
+        }
+        return letters;
+    }
+
+    for (int w = 0; w < WORDS_PER_RUN; w++) {
+        int char_idx = START_IDX;
+        for (int pos = 0; pos < MAX_WORD_LEN; pos++) {
+            float logits[VOCAB_SIZE];
+            float scalar = static_cast<float>(pos) / SEQ_LEN;
+            switch (engine) {
+            case Engine::FLOAT:
+                adjective_model_larger256_4Model::InferenceOneHotLogits(char_idx, scalar, logits);
+                char_idx = sample(rng, logits);
+                break;
+            case Engine::INT8:
+                adjective_model_larger256_4Int8Model::InferenceOneHotLogits(char_idx, scalar, logits);
+                char_idx = sample(rng, logits);
+                break;
+            default:
+                char_idx = static_cast<int>(next_char_tables[pos][char_idx].Sample(rng));
+                break;
+            }
+            if (char_idx == END_IDX) break;
+            if (char_idx != START_IDX) letters++;
+        }
+    }
+    return letters;
+}
+
+static void report_engine(const char* name, Engine engine) {
+    size_t letters = generate_words(engine);
+    Summary s = time_per_call([&] { sink = static_cast<float>(generate_words(engine)); });
+    double words_per_sec = WORDS_PER_RUN / s.median;
+    double chars_per_sec = letters / s.median;
+    printf("  %-16s %12.0f words/s %14.0f chars/s  (MAD %4.1f%%)\n",
+           name, words_per_sec, chars_per_sec, 100.0 * s.mad / s.median);
+}
+
+static void bench_generation() {
+    for (int pos = 0; pos < MAX_WORD_LEN; pos++) {
+        for (int c = 0; c < VOCAB_SIZE; c++) {
+            next_char_tables[pos][c].BuildSoftmax(adjective_model_larger256_4Table::LookupLogits(c, pos), INV_TEMPERATURE);
+        }
+    }
+
+    printf("end to end (%d words per run, seed %llu):\n", WORDS_PER_RUN, static_cast<unsigned long long>(GENERATION_SEED));
+    report_engine(FLOAT_ENGINE_NAME, Engine::FLOAT);
+    report_engine("float batch", Engine::FLOAT_BATCH);
+    report_engine("int8", Engine::INT8);
+    report_engine("table", Engine::TABLE);
+}
+
+// --- Low-rank sweep ---
+// Layers 1-3 of the full weights factorized at several ranks (components/low_rank.h),
+// each compared with the unfactorized network over every reachable input.
+// Both run through the same runtime-shaped kernels.
+static const size_t kSweepRanks[] = { 16, 32, 48, 64, 96, 128, 192, 256 };
+
+struct HiddenLayer {
+    const float* weights;
+    const float* bias;
+    size_t input_size;
+    size_t output_size;
+    ActivationType activation;
+};
+
+static const HiddenLayer kHiddenLayers[] = {
+    { weight_7_arith_constant7, weight_2_arith_constant2, 256, 256, ActivationType::RELU },
+    { weight_6_arith_constant6, weight_1_arith_constant1, 256, 256, ActivationType::RELU },
+    { weight_5_arith_constant5, weight_0_arith_constant, 256, 256, ActivationType::RELU },
+    { weight_4_arith_constant4, weight_3_arith_constant3, 256, 28, ActivationType::NONE },
+};
+static constexpr size_t kNumFactoredLayers = 3;
+
+struct FactoredLayer {
+    std::vector<float> down;
+    std::vector<float> up;
+};
+
+// Next-character probabilities; factored empty runs the full network
+static void sweep_inference(const std::vector<FactoredLayer>& factored, size_t rank, size_t index, float scalar, float* probs) {
+    float arena[2][256];
+    float rank_buffer[256];
+    static const float zero_bias[256] = {};
+    FullyConnectedOneHotPlusScalar(index, scalar, weight_8_sequential_1_dense_1_MatMul,
+                                   weight_9_sequential_1_dense_1_Relu_sequential_1_dense_1_BiasAdd,
+                                   arena[0], 29, 256, ActivationType::RELU);
+    int slot = 0;
+    for (size_t l = 0; l < sizeof(kHiddenLayers) / sizeof(kHiddenLayers[0]); l++) {
+        const HiddenLayer& layer = kHiddenLayers[l];
+        if (l < factored.size()) {
+            FullyConnectedBlocked<float, 4>(arena[slot], factored[l].down.data(), zero_bias, rank_buffer,
+                                            layer.input_size, rank, ActivationType::NONE);
+            FullyConnectedBlocked<float, 4>(rank_buffer, factored[l].up.data(), layer.bias, arena[1 - slot],
+                                            rank, layer.output_size, layer.activation);
+        } else {
+            FullyConnectedBlocked<float, 4>(arena[slot], layer.weights, layer.bias, arena[1 - slot],
+                                            layer.input_size, layer.output_size, layer.activation);
+        }
+        slot = 1 - slot;
+    }
+    SoftmaxWithTemperature(arena[slot], probs, VOCAB_SIZE, INV_TEMPERATURE);
+}
+
+static void bench_low_rank() {
+    std::vector<DenseSvd> svds;
+    for (size_t l = 0; l < kNumFactoredLayers; l++) {
+        svds.push_back(ComputeSvd(kHiddenLayers[l].weights, kHiddenLayers[l].output_size, kHiddenLayers[l].input_size));
+    }
+
+    static float full[MAX_WORD_LEN][VOCAB_SIZE][VOCAB_SIZE];
+    for (int pos = 0; pos < MAX_WORD_LEN; pos++) {
+        for (int c = 0; c < VOCAB_SIZE; c++) sweep_inference({}, 0, c, static_cast<float>(pos) / SEQ_LEN, full[pos][c]);
+    }
+    Summary full_time = time_per_call([&] {
+        float probs[VOCAB_SIZE];
+        sweep_inference({}, 0, 5, 0.3f, probs);
+        sink = probs[0];
+    });
+
+    printf("low-rank layers 1-3 vs full, sampling distributions at T=%.2f over %d reachable inputs:\n",
+           TEMPERATURE, MAX_WORD_LEN * VOCAB_SIZE);
+    printf("  %-6s %10s %12s %8s %10s %13s %8s\n", "rank", "MACs", "ns/char", "speedup", "mean KL", "max |dp|", "argmax");
+    printf("  %-6s %10d %12.0f %8s %10s %13s %8s\n", "full", 3 * 256 * 256, full_time.median * 1e9, "1.00x", "-", "-", "-");
+    for (size_t rank : kSweepRanks) {
+        std::vector<FactoredLayer> factored(kNumFactoredLayers);
+        for (size_t l = 0; l < kNumFactoredLayers; l++) LowRankFactors(svds[l], rank, factored[l].down, factored[l].up);
+
+        double sum_kl = 0.0, max_abs_diff = 0.0;
+        int argmax_agree = 0;
+        for (int pos = 0; pos < MAX_WORD_LEN; pos++) {
+            for (int c = 0; c < VOCAB_SIZE; c++) {
+                float probs[VOCAB_SIZE];
+                const float* ref = full[pos][c];
+                sweep_inference(factored, rank, c, static_cast<float>(pos) / SEQ_LEN, probs);
+                int ref_max = 0, out_max = 0;
+                for (int i = 0; i < VOCAB_SIZE; i++) {
+                    max_abs_diff = std::max(max_abs_diff, static_cast<double>(std::fabs(ref[i] - probs[i])));
+                    if (ref[i] > 0.0f) sum_kl += ref[i] * std::log((ref[i] + 1e-10) / (probs[i] + 1e-10));
+                    if (ref[i] > ref[ref_max]) ref_max = i;
+                    if (probs[i] > probs[out_max]) out_max = i;
+                }
+                if (ref_max == out_max) argmax_agree++;
+            }
+        }
+
+        Summary s = time_per_call([&] {
+            float probs[VOCAB_SIZE];
+            sweep_inference(factored, rank, 5, 0.3f, probs);
+            sink = probs[0];
+        });
+        printf("  %-6zu %10zu %12.0f %7.2fx %10.5f %13.5f %4d/%d\n",
+               rank, kNumFactoredLayers * rank * 512, s.median * 1e9, full_time.median / s.median,
+               sum_kl / (MAX_WORD_LEN * VOCAB_SIZE), max_abs_diff, argmax_agree, MAX_WORD_LEN * VOCAB_SIZE);
+    }
+}
+
+// --- Kernel backend parity ---
+// Layers 1-4 of the full weights through the portable kernel and through
+// FullyConnectedEspDsp (on the host a loop summing in ESP-DSP's order), layer
+// by layer on the same inputs, over every reachable input. The device kernel
+// may still round differently from the host loop; this bounds the gap that
+// comes from the order of the sums.
+template<size_t In, size_t Out, ActivationType Act>
+static void backend_layer(bool esp_dsp, const float* input, const float* weights, const float* bias, float* output) {
+    if (esp_dsp) {
+        FullyConnectedEspDsp<In, Out, Act>(input, weights, bias, output);
+    } else {
+        FullyConnected<float, In, Out, Act>(input, weights, bias, output);
+    }
+}
+
+// Logits of one input with layers 1-4 on the given backend
+static void backend_logits(bool esp_dsp, size_t index, float scalar, float* logits) {
+    float arena[2][256];
+    FullyConnectedOneHotPlusScalar<float, 29, 256, ActivationType::RELU>(
+        index, scalar, weight_8_sequential_1_dense_1_MatMul, weight_9_sequential_1_dense_1_Relu_sequential_1_dense_1_BiasAdd, arena[0]);
+    backend_layer<256, 256, ActivationType::RELU>(esp_dsp, arena[0], weight_7_arith_constant7, weight_2_arith_constant2, arena[1]);
+    backend_layer<256, 256, ActivationType::RELU>(esp_dsp, arena[1], weight_6_arith_constant6, weight_1_arith_constant1, arena[0]);
+    backend_layer<256, 256, ActivationType::RELU>(esp_dsp, arena[0], weight_5_arith_constant5, weight_0_arith_constant, arena[1]);
+    backend_layer<256, 28, ActivationType::NONE>(esp_dsp, arena[1], weight_4_arith_constant4, weight_3_arith_constant3, logits);
+}
+
+static void bench_backend_parity() {
+    double max_logit_diff = 0.0, max_prob_diff = 0.0;
+    int argmax_agree = 0;
+    for (int pos = 0; pos < MAX_WORD_LEN; pos++) {
+        for (int c = 0; c < VOCAB_SIZE; c++) {
+            float ref[VOCAB_SIZE], out[VOCAB_SIZE], ref_probs[VOCAB_SIZE], out_probs[VOCAB_SIZE];
+            const float scalar = static_cast<float>(pos) / SEQ_LEN;
+            backend_logits(false, c, scalar, ref);
+            backend_logits(true, c, scalar, out);
+            SoftmaxWithTemperature(ref, ref_probs, VOCAB_SIZE, INV_TEMPERATURE);
+            SoftmaxWithTemperature(out, out_probs, VOCAB_SIZE, INV_TEMPERATURE);
+            int ref_max = 0, out_max = 0;
+            for (int i = 0; i < VOCAB_SIZE; i++) {
+                max_logit_diff = std::max(max_logit_diff, static_cast<double>(std::fabs(ref[i] - out[i])));
+                max_prob_diff = std::max(max_prob_diff, static_cast<double>(std::fabs(ref_probs[i] - out_probs[i])));
+                if (ref[i] > ref[ref_max]) ref_max = i;
+                if (out[i] > out[out_max]) out_max = i;
+            }
+            if (ref_max == out_max) argmax_agree++;
+        }
+    }
+    printf("ESP-DSP backend vs portable kernel, layers 1-4 over %d reachable inputs:\n", MAX_WORD_LEN * VOCAB_SIZE);
+    printf("  max |dlogit|         = %.3g\n", max_logit_diff);
+    printf("  max |dp| at T=%.2f  = %.3g\n", TEMPERATURE, max_prob_diff);
+    printf("  argmax agreement     = %d/%d\n", argmax_agree, MAX_WORD_LEN * VOCAB_SIZE);
+}
+
+// --- Batch vs single-item parity ---
+// The batched API promises bit-identical rows to the single-item one on every
+// weight set and kernel backend; checked over every reachable input in one
+// batch. Returns false (and the bench exits non-zero) on any mismatch.
+static bool check_batch_parity() {
+    static constexpr int kNumInputs = MAX_WORD_LEN * VOCAB_SIZE;
+    static size_t indices[kNumInputs];
+    static float scalars[kNumInputs];
+    static float batch_logits[kNumInputs][VOCAB_SIZE], batch_probs[kNumInputs][VOCAB_SIZE];
+    for (int pos = 0; pos < MAX_WORD_LEN; pos++) {
+        for (int c = 0; c < VOCAB_SIZE; c++) {
+            indices[pos * VOCAB_SIZE + c] = c;
+            scalars[pos * VOCAB_SIZE + c] = static_cast<float>(pos) / SEQ_LEN;
+        }
+    }
+    adjective_model_larger256_4Model::InferenceBatchOneHotLogits(indices, scalars, batch_logits[0], kNumInputs);
+    adjective_model_larger256_4Model::InferenceBatchOneHot(indices, scalars, batch_probs[0], kNumInputs);
+
+    int logit_mismatches = 0, prob_mismatches = 0;
+    for (int k = 0; k < kNumInputs; k++) {
+        float logits[VOCAB_SIZE], probs[VOCAB_SIZE];
+        adjective_model_larger256_4Model::InferenceOneHotLogits(indices[k], scalars[k], logits);
+        adjective_model_larger256_4Model::InferenceOneHot(indices[k], scalars[k], probs);
+        if (memcmp(logits, batch_logits[k], sizeof(logits)) != 0) logit_mismatches++;
+        if (memcmp(probs, batch_probs[k], sizeof(probs)) != 0) prob_mismatches++;
+    }
+    const bool pass = logit_mismatches == 0 && prob_mismatches == 0;
+    printf("batched vs single-item model over %d reachable inputs: %s\n", kNumInputs, pass ? "PASS" : "FAIL");
+    printf("  mismatching logit rows = %d/%d\n", logit_mismatches, kNumInputs);
+    printf("  mismatching prob rows  = %d/%d\n", prob_mismatches, kNumInputs);
+    return pass;
+}
+
+int main(int argc, char** argv) {
+#if EMBEDDED_ML_WEIGHT_BLOB
+#if EMBEDDED_ML_TILED_WEIGHTS
+    const char* weights_path = "adjective_model_larger256_4_tiled_weights.bin";
+#else
+    const char* weights_path = "adjective_model_larger256_4_weights.bin";
+#endif
+#endif
+    for (int i = 1; i < argc; i++) {
+        if (strcmp(argv[i], "--trials") == 0 && i + 1 < argc && atoi(argv[i + 1]) > 0) {
+            num_trials = atoi(argv[++i]);
+#if EMBEDDED_ML_WEIGHT_BLOB
+        } else if (strcmp(argv[i], "--weights") == 0 && i + 1 < argc) {
+            weights_path = argv[++i];
+#endif
+        } else {
+#if EMBEDDED_ML_WEIGHT_BLOB
+            fprintf(stderr, "usage: %s [--trials N] [--weights FILE]\n", argv[0]);
+#else
+            fprintf(stderr, "usage: %s [--trials N]\n", argv[0]);
+#endif
+            return 1;
+        }
+    }
+#if EMBEDDED_ML_WEIGHT_BLOB
+    size_t blob_size = 0;
+    const void* blob = MapWeightBlobFile(weights_path, &blob_size);
+    if (!blob || !adjective_model_larger256_4Model::LoadWeights(blob, blob_size)) {
+        fprintf(stderr, "error: cannot load weight blob %s\n", weights_path);
+        return 1;
+    }
+#endif
+
+    printf("%d trials after warm-up, median (MAD)\n", num_trials);
+    bench_kernels();
+    bench_generation();
+    bench_low_rank();
+    bench_backend_parity();
+    return check_batch_parity() ? 0 : 1;
+}
@@ -0,0 +1,1311 @@
+// adjective_model_larger256_4_export.cpp
+// Offline exporter for derived model artifacts
+// Evaluates the float model on the host and emits C++ sources for the firmware
+//
+// Usage: adjective_model_larger256_4_export <mode> [out_dir] [rank | words_file | budget [rank]]
+//   table   next-character lookup table covering every reachable input
+//   int8    int8 weights with per-output-channel scales, checked against the float model
+//   tiled   float weights with layers 1-4 row-interleaved for FullyConnectedTiled
+//   blob    float weights as a binary blob for EMBEDDED_ML_WEIGHT_BLOB builds
+//   blob-tiled  the same with layers 1-4 tiled, for EMBEDDED_ML_TILED_WEIGHTS blob builds
+//   pruned  float weights without the hidden units that are zero for every reachable input
+//   lowrank float weights with layers 1-3 factorized to rank (default 64) by truncated SVD
+//   pool    words_file (one word per line, e.g. from the inference tool's --count mode)
+//           packed at 5 bits per letter for the firmware's word pool mode
+//   lexicon words_file (e.g. the training adjectives) as a minimized trie for
+//           the firmware's word filter
+//   placement  per-layer memory placement of every weight variant for an internal
+//           RAM budget in bytes (low-rank sizes at rank, default 64)
+
+#include "adjective_model_larger256_4.h"
+#include "adjective_model_larger256_4_weights.cpp"
+#include "components/fully_connected.h"
+#include "components/low_rank.h"
+#include "components/softmax.h"
+#include "components/vocab.h"
+#include "components/weight_blob.h"
+#include <algorithm>
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <fstream>
+#include <map>
+#include <string>
+#include <vector>
+
+using namespace embedded_ml;
+
+static constexpr const char* MODEL_NAME = "adjective_model_larger256_4";
+
+// Write a float array as an initializer body, 8 values per line (same layout as the weights file)
+static void write_floats(FILE* f, const float* values, size_t count, const char* indent) {
+    for (size_t i = 0; i < count; ++i) {
+        if (i % 8 == 0) fprintf(f, "%s", indent);
+        fprintf(f, "%.9e", values[i]);
+        if (i + 1 < count) fprintf(f, (i % 8 == 7) ? ",\n" : ",  ");
+    }
+    fprintf(f, "\n");
+}
+
+// Write an int8 array as an initializer body, 16 values per line
+static void write_int8s(FILE* f, const int8_t* values, size_t count, const char* indent) {
+    for (size_t i = 0; i < count; ++i) {
+        if (i % 16 == 0) fprintf(f, "%s", indent);
+        fprintf(f, "%4d", values[i]);
+        if (i + 1 < count) fprintf(f, (i % 16 == 15) ? ",\n" : ", ");
+    }
+    fprintf(f, "\n");
+}
+
+static FILE* open_output(const std::string& out_dir, const std::string& file_name) {
+    std::string path = out_dir + "/" + file_name;
+    FILE* f = fopen(path.c_str(), "w");
+    if (!f) {
+        fprintf(stderr, "error: cannot open %s for writing\n", path.c_str());
+        return nullptr;
+    }
+    printf("  wrote %s\n", path.c_str());
+    return f;
+}
+
+// --- Lookup table ---
+// The model input is always one-hot(char) + pos / SEQ_LEN with pos < MAX_WORD_LEN,
+// so the network only ever sees VOCAB_SIZE * MAX_WORD_LEN distinct inputs.
+// Evaluate it once for each of them and emit the resulting logits, so callers
+// can apply any temperature with SoftmaxWithTemperature.
+static int export_table(const std::string& out_dir) {
+    static float table[MAX_WORD_LEN][VOCAB_SIZE][VOCAB_SIZE];
+
+    for (int pos = 0; pos < MAX_WORD_LEN; pos++) {
+        for (int c = 0; c < VOCAB_SIZE; c++) {
+            adjective_model_larger256_4Model::InferenceOneHotLogits(c, static_cast<float>(pos) / SEQ_LEN, table[pos][c]);
+        }
+    }
+
+    FILE* h = open_output(out_dir, std::string(MODEL_NAME) + "_table.h");
+    if (!h) return 1;
+    fprintf(h,
+        "// %s_table.h\n"
+        "// Auto-generated next-character lookup table\n"
+        "// Pure C++ implementation for embedded systems\n"
+        "\n"
+        "#ifndef ADJECTIVE_MODEL_LARGER256_4_TABLE_H\n"
+        "#define ADJECTIVE_MODEL_LARGER256_4_TABLE_H\n"
+        "\n"
+        "#include <cstddef>\n"
+        "\n"
+        "namespace embedded_ml {\n"
+        "\n"
+        "// Model logits for every reachable input: one-hot(char_idx) + pos / %d\n"
+        "// Equivalent to %sModel::InferenceOneHotLogits without linking the weights\n"
+        "class %sTable {\n"
+        "public:\n"
+        "    static constexpr size_t kNumPositions = %d;\n"
+        "    static constexpr size_t kNumChars = %d;\n"
+        "    static constexpr size_t kOutputSize = %d;\n"
+        "\n"
+        "    // Next-character logits for (char_idx, pos)\n"
+        "    // Returns a pointer to kOutputSize pre-softmax values\n"
+        "    static const float* LookupLogits(size_t char_idx, size_t pos) {\n"
+        "        return logits[pos][char_idx];\n"
+        "    }\n"
+        "\n"
+        "private:\n"
+        "    static const float logits[kNumPositions][kNumChars][kOutputSize];\n"
+        "};\n"
+        "\n"
+        "} // namespace embedded_ml\n"
+        "\n"
+        "#endif // ADJECTIVE_MODEL_LARGER256_4_TABLE_H\n",
+        MODEL_NAME, SEQ_LEN, MODEL_NAME, MODEL_NAME, MAX_WORD_LEN, VOCAB_SIZE, VOCAB_SIZE);
+    fclose(h);
+
+    FILE* f = open_output(out_dir, std::string(MODEL_NAME) + "_table.cpp");
+    if (!f) return 1;
+    fprintf(f,
+        "// %s_table.cpp\n"
+        "// Auto-generated next-character lookup table\n"
+        "// Shape: [%d positions, %d chars, %d outputs]\n"
+        "\n"
+        "#include \"%s_table.h\"\n"
+        "\n"
+        "namespace embedded_ml {\n"
+        "\n"
+        "const float %sTable::logits[%d][%d][%d] = {\n",
+        MODEL_NAME, MAX_WORD_LEN, VOCAB_SIZE, VOCAB_SIZE, MODEL_NAME, MODEL_NAME,
+        MAX_WORD_LEN, VOCAB_SIZE, VOCAB_SIZE);
+    for (int pos = 0; pos < MAX_WORD_LEN; pos++) {
+        fprintf(f, "  // pos %d\n  {\n", pos);
+        for (int c = 0; c < VOCAB_SIZE; c++) {
+            fprintf(f, "    {\n");
+            write_floats(f, table[pos][c], VOCAB_SIZE, "      ");
+            fprintf(f, "    }%s\n", c + 1 < VOCAB_SIZE ? "," : "");
+        }
+        fprintf(f, "  }%s\n", pos + 1 < MAX_WORD_LEN ? "," : "");
+    }
+    fprintf(f,
+        "};\n"
+        "\n"
+        "} // namespace embedded_ml\n");
+    fclose(f);
+    return 0;
+}
+
+// --- INT8 weights ---
+// Dense layers of the float model, in execution order
+struct DenseLayer {
+    const char* weight_name;
+    const float* weights;  // [output_size x input_size], row-major
+    const char* bias_name;
+    const float* bias;
+    size_t input_size;
+    size_t output_size;
+    ActivationType activation;
+};
+
+// Layer 0 stays float: only two of its columns are read per character (see InferenceOneHot)
+static const DenseLayer kHiddenLayers[] = {
+    { "weight_7_arith_constant7", weight_7_arith_constant7, "weight_2_arith_constant2", weight_2_arith_constant2, 256, 256, ActivationType::RELU },
+    { "weight_6_arith_constant6", weight_6_arith_constant6, "weight_1_arith_constant1", weight_1_arith_constant1, 256, 256, ActivationType::RELU },
+    { "weight_5_arith_constant5", weight_5_arith_constant5, "weight_0_arith_constant", weight_0_arith_constant, 256, 256, ActivationType::RELU },
+    { "weight_4_arith_constant4", weight_4_arith_constant4, "weight_3_arith_constant3", weight_3_arith_constant3, 256, 28, ActivationType::NONE },
+};
+static constexpr size_t kNumHiddenLayers = sizeof(kHiddenLayers) / sizeof(kHiddenLayers[0]);
+
+// Placement macro for the arrays of layer l (defined by the generated *_placement.h)
+static std::string layer_placement(size_t l, bool int8) {
+    return std::string(int8 ? "EMBEDDED_ML_INT8_LAYER" : "EMBEDDED_ML_LAYER") + std::to_string(l) + "_PLACEMENT";
+}
+
+// Layer a float weight tensor belongs to, by generated name
+static size_t tensor_layer(const char* name) {
+    for (size_t l = 0; l < kNumHiddenLayers; l++) {
+        if (strcmp(kHiddenLayers[l].weight_name, name) == 0 || strcmp(kHiddenLayers[l].bias_name, name) == 0) return l + 1;
+    }
+    return 0;
+}
+
+struct QuantizedLayer {
+    std::vector<int8_t> weights;
+    std::vector<float> scales;
+};
+
+// Per-output-channel symmetric quantization: one scale per weight row
+static QuantizedLayer quantize_layer(const DenseLayer& layer) {
+    QuantizedLayer q;
+    q.weights.resize(layer.input_size * layer.output_size);
+    q.scales.resize(layer.output_size);
+    for (size_t i = 0; i < layer.output_size; i++) {
+        q.scales[i] = QuantizeInt8(layer.weights + i * layer.input_size,
+                                   q.weights.data() + i * layer.input_size, layer.input_size);
+    }
+    return q;
+}
+
+// Same call sequence as adjective_model_larger256_4Int8Model::InferenceOneHot
+static void int8_inference(const std::vector<QuantizedLayer>& quantized, size_t index, float scalar, float* output) {
+    float arena[2][256];
+    int8_t input_q[256];
+    FullyConnectedOneHotPlusScalar(index, scalar, weight_8_sequential_1_dense_1_MatMul,
+                                   weight_9_sequential_1_dense_1_Relu_sequential_1_dense_1_BiasAdd,
+                                   arena[0], 29, 256, ActivationType::RELU);
+    int slot = 0;
+    for (size_t l = 0; l < kNumHiddenLayers; l++) {
+        const DenseLayer& layer = kHiddenLayers[l];
+        float input_scale = QuantizeInt8(arena[slot], input_q, layer.input_size);
+        FullyConnectedInt8(input_q, input_scale, quantized[l].weights.data(), quantized[l].scales.data(),
+                           layer.bias, arena[1 - slot], layer.input_size, layer.output_size, layer.activation);
+        slot = 1 - slot;
+    }
+    Softmax(arena[slot], output, VOCAB_SIZE);
+}
+
+// Largest mean KL(float || int8) over reachable inputs accepted by the exporter
+static constexpr double INT8_MAX_MEAN_KL = 1e-2;
+
+static int export_int8(const std::string& out_dir) {
+    std::vector<QuantizedLayer> quantized;
+    for (size_t l = 0; l < kNumHiddenLayers; l++) quantized.push_back(quantize_layer(kHiddenLayers[l]));
+
+    // Accuracy check against the float path on every reachable input
+    double max_abs_diff = 0.0, sum_kl = 0.0;
+    int argmax_agree = 0;
+    for (int pos = 0; pos < MAX_WORD_LEN; pos++) {
+        for (int c = 0; c < VOCAB_SIZE; c++) {
+            float ref[VOCAB_SIZE], out[VOCAB_SIZE];
+            float scalar = static_cast<float>(pos) / SEQ_LEN;
+            adjective_model_larger256_4Model::InferenceOneHot(c, scalar, ref);
+            int8_inference(quantized, c, scalar, out);
+
+            int ref_max = 0, out_max = 0;
+            for (int i = 0; i < VOCAB_SIZE; i++) {
+                max_abs_diff = std::max(max_abs_diff, static_cast<double>(std::fabs(ref[i] - out[i])));
+                if (ref[i] > 0.0f) sum_kl += ref[i] * std::log((ref[i] + 1e-10) / (out[i] + 1e-10));
+                if (ref[i] > ref[ref_max]) ref_max = i;
+                if (out[i] > out[out_max]) out_max = i;
+            }
+            if (ref_max == out_max) argmax_agree++;
+        }
+    }
+    const int num_inputs = MAX_WORD_LEN * VOCAB_SIZE;
+    const double mean_kl = sum_kl / num_inputs;
+    printf("int8 vs float over %d reachable inputs:\n", num_inputs);
+    printf("  max |p_int8 - p_float| = %.6f\n", max_abs_diff);
+    printf("  mean KL(float || int8) = %.6f\n", mean_kl);
+    printf("  argmax agreement       = %d/%d\n", argmax_agree, num_inputs);
+    if (mean_kl > INT8_MAX_MEAN_KL) {
+        fprintf(stderr, "error: mean KL %.6f exceeds %.6f, not writing int8 weights\n", mean_kl, INT8_MAX_MEAN_KL);
+        return 1;
+    }
+
+    FILE* f = open_output(out_dir, std::string(MODEL_NAME) + "_int8_weights.cpp");
+    if (!f) return 1;
+    fprintf(f,
+        "// %s_int8_weights.cpp\n"
+        "// Auto-generated int8 weight data for embedded inference\n"
+        "// Hidden and output layers: int8 weights with per-output-channel scales\n"
+        "// Layer 0 and all biases stay float\n"
+        "\n"
+        "#include \"%s_placement.h\"\n"
+        "#include <cstddef>\n"
+        "#include <cstdint>\n"
+        "\n"
+        "namespace embedded_ml {\n"
+        "\n",
+        MODEL_NAME, MODEL_NAME);
+
+    fprintf(f,
+        "\n// Layer 0 weights: sequential_1/dense_1/MatMul\n"
+        "// Shape: [29, 256] (column-major)\n"
+        "static const float weight_8_sequential_1_dense_1_MatMul[7424] EMBEDDED_ML_INT8_LAYER0_PLACEMENT = {\n");
+    write_floats(f, weight_8_sequential_1_dense_1_MatMul, 7424, "  ");
+    fprintf(f, "};\n\n");
+    fprintf(f,
+        "\n// Layer 0 bias\n"
+        "// Shape: [256]\n"
+        "static const float weight_9_sequential_1_dense_1_Relu_sequential_1_dense_1_BiasAdd[256] EMBEDDED_ML_INT8_LAYER0_PLACEMENT = {\n");
+    write_floats(f, weight_9_sequential_1_dense_1_Relu_sequential_1_dense_1_BiasAdd, 256, "  ");
+    fprintf(f, "};\n\n");
+
+    for (size_t l = 0; l < kNumHiddenLayers; l++) {
+        const DenseLayer& layer = kHiddenLayers[l];
+        const size_t n = layer.input_size * layer.output_size;
+        const std::string placement = layer_placement(l + 1, true);
+        fprintf(f,
+            "\n// Layer %zu weights (int8)\n"
+            "// Shape: [%zu, %zu]\n"
+            "static const int8_t %s[%zu] %s = {\n",
+            l + 1, layer.output_size, layer.input_size, layer.weight_name, n, placement.c_str());
+        write_int8s(f, quantized[l].weights.data(), n, "  ");
+        fprintf(f, "};\n\n");
+        fprintf(f,
+            "\n// Layer %zu per-output-channel scales\n"
+            "// Shape: [%zu]\n"
+            "static const float %s_scale[%zu] %s = {\n",
+            l + 1, layer.output_size, layer.weight_name, layer.output_size, placement.c_str());
+        write_floats(f, quantized[l].scales.data(), layer.output_size, "  ");
+        fprintf(f, "};\n\n");
+        fprintf(f,
+            "\n// Layer %zu bias\n"
+            "// Shape: [%zu]\n"
+            "static const float %s[%zu] %s = {\n",
+            l + 1, layer.output_size, layer.bias_name, layer.output_size, placement.c_str());
+        write_floats(f, layer.bias, layer.output_size, "  ");
+        fprintf(f, "};\n\n");
+    }
+
+    fprintf(f, "\n} // namespace embedded_ml\n");
+    fclose(f);
+    return 0;
+}
+
+// --- Tiled float weights ---
+// Row block the tiled layout is exported for (kRowBlock in the model)
+static constexpr size_t TILED_ROW_BLOCK = 4;
+
+// Every tensor of the float weights file, in file order
+struct WeightTensor {
+    const char* tflite_name;
+    const char* name;
+    const float* values;
+    const char* shape;
+    size_t count;
+    size_t tile_input_size;  // 0: copied as-is, otherwise tiled as [count / n x n]
+    uint8_t rank;
+    uint32_t dims[2];
+    WeightLayout layout;     // as stored in the weights file
+};
+
+static const WeightTensor kWeightTensors[] = {
+    { "arith.constant", "weight_0_arith_constant", weight_0_arith_constant, "[256]", 256, 0, 1, { 256 }, WeightLayout::ROW_MAJOR },
+    { "arith.constant1", "weight_1_arith_constant1", weight_1_arith_constant1, "[256]", 256, 0, 1, { 256 }, WeightLayout::ROW_MAJOR },
+    { "arith.constant2", "weight_2_arith_constant2", weight_2_arith_constant2, "[256]", 256, 0, 1, { 256 }, WeightLayout::ROW_MAJOR },
+    { "arith.constant3", "weight_3_arith_constant3", weight_3_arith_constant3, "[28]", 28, 0, 1, { 28 }, WeightLayout::ROW_MAJOR },
+    { "arith.constant4", "weight_4_arith_constant4", weight_4_arith_constant4, "[28, 256]", 7168, 256, 2, { 28, 256 }, WeightLayout::ROW_MAJOR },
+    { "arith.constant5", "weight_5_arith_constant5", weight_5_arith_constant5, "[256, 256]", 65536, 256, 2, { 256, 256 }, WeightLayout::ROW_MAJOR },
+    { "arith.constant6", "weight_6_arith_constant6", weight_6_arith_constant6, "[256, 256]", 65536, 256, 2, { 256, 256 }, WeightLayout::ROW_MAJOR },
+    { "arith.constant7", "weight_7_arith_constant7", weight_7_arith_constant7, "[256, 256]", 65536, 256, 2, { 256, 256 }, WeightLayout::ROW_MAJOR },
+    { "sequential_1/dense_1/MatMul", "weight_8_sequential_1_dense_1_MatMul", weight_8_sequential_1_dense_1_MatMul, "[29, 256] (column-major)", 7424, 0, 2, { 29, 256 }, WeightLayout::COLUMN_MAJOR },
+    { "sequential_1/dense_1/Relu;sequential_1/dense_1/BiasAdd", "weight_9_sequential_1_dense_1_Relu_sequential_1_dense_1_BiasAdd", weight_9_sequential_1_dense_1_Relu_sequential_1_dense_1_BiasAdd, "[256]", 256, 0, 1, { 256 }, WeightLayout::ROW_MAJOR },
+};
+
+static int export_tiled(const std::string& out_dir) {
+    FILE* f = open_output(out_dir, std::string(MODEL_NAME) + "_tiled_weights.cpp");
+    if (!f) return 1;
+    fprintf(f,
+        "// %s_tiled_weights.cpp\n"
+        "// Auto-generated weight data for embedded inference\n"
+        "// Same tensors as %s_weights.cpp, with the layer 1-4 matrices\n"
+        "// row-interleaved in %zu-row tiles for FullyConnectedTiled\n"
+        "\n"
+        "#include \"%s_placement.h\"\n"
+        "#include <cstddef>\n"
+        "\n"
+        "namespace embedded_ml {\n"
+        "\n"
+        "static constexpr size_t kTiledRowBlock = %zu;\n"
+        "\n",
+        MODEL_NAME, MODEL_NAME, TILED_ROW_BLOCK, MODEL_NAME, TILED_ROW_BLOCK);
+
+    size_t index = 1;
+    for (const WeightTensor& tensor : kWeightTensors) {
+        std::vector<float> values(tensor.values, tensor.values + tensor.count);
+        if (tensor.tile_input_size) {
+            TileWeights<float, TILED_ROW_BLOCK>(tensor.values, values.data(), tensor.tile_input_size,
+                                                tensor.count / tensor.tile_input_size);
+        }
+        fprintf(f,
+            "\n// Weight tensor %zu: %s\n"
+            "// Shape: %s%s\n"
+            "// Elements: %zu\n"
+            "static const float %s[%zu] %s = {\n",
+            index++, tensor.tflite_name, tensor.shape, tensor.tile_input_size ? " (tiled)" : "",
+            tensor.count, tensor.name, tensor.count, layer_placement(tensor_layer(tensor.name), false).c_str());
+        write_floats(f, values.data(), tensor.count, "  ");
+        fprintf(f, "};\n\n");
+    }
+
+    fprintf(f, "\n} // namespace embedded_ml\n");
+    fclose(f);
+    return 0;
+}
+
+// --- Binary weight blob ---
+// Blob data alignment: enough for any SIMD load of the float kernels
+static constexpr uint32_t BLOB_ALIGNMENT = 16;
+
+static uint32_t align_up(uint32_t value) {
+    return (value + BLOB_ALIGNMENT - 1) & ~(BLOB_ALIGNMENT - 1);
+}
+
+// Every float tensor with an aligned offset, in file order; see components/weight_blob.h
+// tiled: store layers 1-4 row-interleaved as in export_tiled
+static int export_blob(const std::string& out_dir, bool tiled) {
+    static constexpr size_t kNumTensors = sizeof(kWeightTensors) / sizeof(kWeightTensors[0]);
+
+    WeightBlobHeader header = {};
+    header.magic = kWeightBlobMagic;
+    header.version = kWeightBlobVersion;
+    header.header_size = sizeof(WeightBlobHeader);
+    header.tensor_count = kNumTensors;
+    header.alignment = BLOB_ALIGNMENT;
+
+    WeightBlobTensor entries[kNumTensors] = {};
+    uint32_t offset = align_up(sizeof(WeightBlobHeader) + sizeof(entries));
+    for (size_t t = 0; t < kNumTensors; ++t) {
+        const WeightTensor& tensor = kWeightTensors[t];
+        WeightBlobTensor& entry = entries[t];
+        if (strlen(tensor.name) >= kWeightBlobNameSize) {
+            fprintf(stderr, "error: tensor name %s too long for the blob\n", tensor.name);
+            return 1;
+        }
+        strcpy(entry.name, tensor.name);
+        entry.dtype = WeightDType::FLOAT32;
+        entry.layout = tiled && tensor.tile_input_size ? WeightLayout::TILED : tensor.layout;
+        entry.tile_rows = entry.layout == WeightLayout::TILED ? TILED_ROW_BLOCK : 0;
+        entry.rank = tensor.rank;
+        for (uint8_t d = 0; d < tensor.rank; ++d) entry.shape[d] = tensor.dims[d];
+        entry.offset = offset;
+        entry.size = tensor.count * sizeof(float);
+        offset = align_up(offset + entry.size);
+    }
+    header.total_size = offset;
+
+    std::vector<uint8_t> blob(header.total_size, 0);
+    memcpy(blob.data(), &header, sizeof(header));
+    memcpy(blob.data() + sizeof(header), entries, sizeof(entries));
+    for (size_t t = 0; t < kNumTensors; ++t) {
+        const WeightTensor& tensor = kWeightTensors[t];
+        float* values = reinterpret_cast<float*>(blob.data() + entries[t].offset);
+        if (entries[t].layout == WeightLayout::TILED) {
+            TileWeights<float, TILED_ROW_BLOCK>(tensor.values, values, tensor.tile_input_size,
+                                                tensor.count / tensor.tile_input_size);
+        } else {
+            memcpy(values, tensor.values, entries[t].size);
+        }
+    }
+    if (!ValidateWeightBlob(blob.data(), blob.size())) {
+        fprintf(stderr, "error: generated blob failed validation\n");
+        return 1;
+    }
+
+    std::string path = out_dir + "/" + MODEL_NAME + (tiled ? "_tiled_weights.bin" : "_weights.bin");
+    FILE* f = fopen(path.c_str(), "wb");
+    if (!f) {
+        fprintf(stderr, "error: cannot open %s for writing\n", path.c_str());
+        return 1;
+    }
+    const bool ok = fwrite(blob.data(), 1, blob.size(), f) == blob.size();
+    if (fclose(f) != 0 || !ok) {
+        fprintf(stderr, "error: short write to %s\n", path.c_str());
+        return 1;
+    }
+    printf("  wrote %s (%zu tensors, %u bytes)\n", path.c_str(), kNumTensors, header.total_size);
+    return 0;
+}
+
+// --- Pruned float weights ---
+// Only VOCAB_SIZE * MAX_WORD_LEN inputs ever reach the network (see export_table).
+// A hidden ReLU unit that outputs exactly zero for all of them contributes
+// nothing downstream, so its weight row, its bias and the matching input column
+// of the next layer can be dropped. Every layer keeps one accumulator per output
+// summed in input order, so skipping those zero terms leaves each sum, and the
+// logits, bit-identical for reachable inputs. Other inputs are not covered.
+
+// Float layers 1-4 as stored: kHiddenLayers with their unpruned shapes
+struct PrunedLayer {
+    std::vector<float> weights;  // [rows x cols], row-major
+    std::vector<float> bias;
+    size_t rows;
+    size_t cols;
+};
+
+// Layer 0 and layers 1-4 on one input, recording which hidden units fire
+// live[l][i]: unit i of buffer_11 + l was nonzero for some input so far
+static void record_live_units(size_t index, float scalar, std::vector<std::vector<bool>>& live) {
+    float arena[2][256];
+    FullyConnectedOneHotPlusScalar(index, scalar, weight_8_sequential_1_dense_1_MatMul,
+                                   weight_9_sequential_1_dense_1_Relu_sequential_1_dense_1_BiasAdd,
+                                   arena[0], 29, 256, ActivationType::RELU);
+    int slot = 0;
+    for (size_t l = 0; l < kNumHiddenLayers; l++) {
+        for (size_t i = 0; i < kHiddenLayers[l].input_size; i++) {
+            if (arena[slot][i] != 0.0f) live[l][i] = true;
+        }
+        const DenseLayer& layer = kHiddenLayers[l];
+        FullyConnected(arena[slot], layer.weights, layer.bias, arena[1 - slot],
+                       layer.input_size, layer.output_size, layer.activation);
+        slot = 1 - slot;
+    }
+}
+
+// Pruned network on one input, same call sequence as InferenceOneHotLogits
+static void pruned_logits(const std::vector<float>& weights_0, const std::vector<float>& bias_0,
+                          const std::vector<PrunedLayer>& layers, size_t index, float scalar, float* logits) {
+    float arena[2][256];
+    FullyConnectedOneHotPlusScalar(index, scalar, weights_0.data(), bias_0.data(), arena[0], 29, bias_0.size(),
+                                   ActivationType::RELU);
+    int slot = 0;
+    for (size_t l = 0; l < layers.size(); l++) {
+        float* out = l + 1 < layers.size() ? arena[1 - slot] : logits;
+        FullyConnected(arena[slot], layers[l].weights.data(), layers[l].bias.data(), out,
+                       layers[l].cols, layers[l].rows, kHiddenLayers[l].activation);
+        slot = 1 - slot;
+    }
+}
+
+// kept[l]: units of buffer_11 + l (input of kHiddenLayers[l]) that are nonzero
+// for some reachable input; false if a buffer has none
+static bool find_live_units(std::vector<std::vector<size_t>>& kept) {
+    std::vector<std::vector<bool>> live(kNumHiddenLayers);
+    for (size_t l = 0; l < kNumHiddenLayers; l++) live[l].assign(kHiddenLayers[l].input_size, false);
+    for (int pos = 0; pos < MAX_WORD_LEN; pos++) {
+        for (int c = 0; c < VOCAB_SIZE; c++) record_live_units(c, static_cast<float>(pos) / SEQ_LEN, live);
+    }
+
+    kept.assign(kNumHiddenLayers, {});
+    for (size_t l = 0; l < kNumHiddenLayers; l++) {
+        for (size_t i = 0; i < live[l].size(); i++) {
+            if (live[l][i]) kept[l].push_back(i);
+        }
+        if (kept[l].empty()) {
+            fprintf(stderr, "error: buffer_%zu has no live units\n", 11 + l);
+            return false;
+        }
+    }
+    return true;
+}
+
+static int export_pruned(const std::string& out_dir) {
+    std::vector<std::vector<size_t>> kept;
+    if (!find_live_units(kept)) return 1;
+
+    // Layer 0: keep the live output columns of the column-major [29 x 256] matrix
+    std::vector<float> weights_0, bias_0;
+    for (size_t j = 0; j < 29; j++) {
+        for (size_t i : kept[0]) weights_0.push_back(weight_8_sequential_1_dense_1_MatMul[j * 256 + i]);
+    }
+    for (size_t i : kept[0]) bias_0.push_back(weight_9_sequential_1_dense_1_Relu_sequential_1_dense_1_BiasAdd[i]);
+
+    // Layers 1-4: live rows (all logits for layer 4) against the previous layer's live columns
+    std::vector<PrunedLayer> layers(kNumHiddenLayers);
+    for (size_t l = 0; l < kNumHiddenLayers; l++) {
+        const DenseLayer& layer = kHiddenLayers[l];
+        std::vector<size_t> rows;
+        if (l + 1 < kNumHiddenLayers) {
+            rows = kept[l + 1];
+        } else {
+            for (size_t i = 0; i < layer.output_size; i++) rows.push_back(i);
+        }
+        PrunedLayer& pruned = layers[l];
+        pruned.rows = rows.size();
+        pruned.cols = kept[l].size();
+        for (size_t i : rows) {
+            for (size_t j : kept[l]) pruned.weights.push_back(layer.weights[i * layer.input_size + j]);
+            pruned.bias.push_back(layer.bias[i]);
+        }
+    }
+
+    // The pruned network must reproduce the float model's logits exactly
+    size_t macs_before = 0, macs_after = 0;
+    for (size_t l = 0; l < kNumHiddenLayers; l++) {
+        macs_before += kHiddenLayers[l].input_size * kHiddenLayers[l].output_size;
+        macs_after += layers[l].rows * layers[l].cols;
+    }
+    for (int pos = 0; pos < MAX_WORD_LEN; pos++) {
+        for (int c = 0; c < VOCAB_SIZE; c++) {
+            float ref[VOCAB_SIZE], out[VOCAB_SIZE];
+            float scalar = static_cast<float>(pos) / SEQ_LEN;
+            adjective_model_larger256_4Model::InferenceOneHotLogits(c, scalar, ref);
+            pruned_logits(weights_0, bias_0, layers, c, scalar, out);
+            if (memcmp(ref, out, sizeof(ref)) != 0) {
+                fprintf(stderr, "error: pruned logits differ at pos %d char %d, not writing pruned weights\n", pos, c);
+                return 1;
+            }
+        }
+    }
+    printf("pruned hidden units over %d reachable inputs:\n", MAX_WORD_LEN * VOCAB_SIZE);
+    for (size_t l = 0; l < kNumHiddenLayers; l++) {
+        printf("  buffer_%zu: %zu/%zu live\n", 11 + l, kept[l].size(), kHiddenLayers[l].input_size);
+    }
+    printf("  layer 1-4 MACs per inference: %zu -> %zu\n", macs_before, macs_after);
+
+    // Pruned replacement for every tensor, by generated name
+    struct PrunedTensor {
+        const char* name;
+        const std::vector<float>* values;
+        std::string shape;
+    };
+    std::vector<PrunedTensor> replacements = {
+        { "weight_8_sequential_1_dense_1_MatMul", &weights_0, "[29, " + std::to_string(kept[0].size()) + "] (column-major)" },
+        { "weight_9_sequential_1_dense_1_Relu_sequential_1_dense_1_BiasAdd", &bias_0, "[" + std::to_string(kept[0].size()) + "]" },
+    };
+    for (size_t l = 0; l < kNumHiddenLayers; l++) {
+        const std::string rows = std::to_string(layers[l].rows);
+        replacements.push_back({ kHiddenLayers[l].weight_name, &layers[l].weights, "[" + rows + ", " + std::to_string(layers[l].cols) + "]" });
+        replacements.push_back({ kHiddenLayers[l].bias_name, &layers[l].bias, "[" + rows + "]" });
+    }
+
+    FILE* f = open_output(out_dir, std::string(MODEL_NAME) + "_pruned_weights.cpp");
+    if (!f) return 1;
+    fprintf(f,
+        "// %s_pruned_weights.cpp\n"
+        "// Auto-generated weight data for embedded inference\n"
+        "// Same tensors as %s_weights.cpp without the hidden units that are\n"
+        "// zero for every reachable input (one-hot char + pos / %d, pos < %d);\n"
+        "// logits for those inputs are bit-identical, other inputs are not covered\n"
+        "\n"
+        "#include \"%s_placement.h\"\n"
+        "#include <cstddef>\n"
+        "\n"
+        "namespace embedded_ml {\n"
+        "\n"
+        "// Live hidden units per intermediate buffer (256 before pruning)\n",
+        MODEL_NAME, MODEL_NAME, SEQ_LEN, MAX_WORD_LEN, MODEL_NAME);
+    for (size_t l = 0; l < kNumHiddenLayers; l++) {
+        fprintf(f, "static constexpr size_t kBuffer%zuSize = %zu;\n", 11 + l, kept[l].size());
+    }
+    fprintf(f, "\n");
+
+    size_t index = 1;
+    for (const WeightTensor& tensor : kWeightTensors) {
+        const PrunedTensor* pruned = nullptr;
+        for (const PrunedTensor& candidate : replacements) {
+            if (strcmp(candidate.name, tensor.name) == 0) pruned = &candidate;
+        }
+        if (!pruned) {
+            fprintf(stderr, "error: no pruned values for %s\n", tensor.name);
+            fclose(f);
+            return 1;
+        }
+        fprintf(f,
+            "\n// Weight tensor %zu: %s\n"
+            "// Shape: %s\n"
+            "// Elements: %zu\n"
+            "static const float %s[%zu] %s = {\n",
+            index++, tensor.tflite_name, pruned->shape.c_str(), pruned->values->size(),
+            tensor.name, pruned->values->size(), layer_placement(tensor_layer(tensor.name), false).c_str());
+        write_floats(f, pruned->values->data(), pruned->values->size(), "  ");
+        fprintf(f, "};\n\n");
+    }
+
+    fprintf(f, "\n} // namespace embedded_ml\n");
+    fclose(f);
+    return 0;
+}
+
+// --- Low-rank float weights ---
+// Layers 1-3 (the 256x256 matrices, nearly all of the MACs) are replaced by
+// their rank-r truncated SVD, W ~= up * down (see components/low_rank.h);
+// layer 0 and layer 4 stay exact. Output changes, so the divergence from the
+// full model over all reachable inputs is reported.
+static constexpr size_t LOW_RANK_DEFAULT = 64;
+static constexpr size_t kNumFactoredLayers = 3;
+
+struct FactoredLayer {
+    std::vector<float> down;  // [rank x input_size]
+    std::vector<float> up;    // [output_size x rank]
+};
+
+// Same call sequence as InferenceOneHot with EMBEDDED_ML_LOWRANK_WEIGHTS
+static void low_rank_inference(const std::vector<FactoredLayer>& factored, size_t rank, size_t index, float scalar, float* output) {
+    float arena[2][256];
+    float rank_buffer[256];
+    const std::vector<float> zero_bias(rank, 0.0f);
+    FullyConnectedOneHotPlusScalar(index, scalar, weight_8_sequential_1_dense_1_MatMul,
+                                   weight_9_sequential_1_dense_1_Relu_sequential_1_dense_1_BiasAdd,
+                                   arena[0], 29, 256, ActivationType::RELU);
+    int slot = 0;
+    for (size_t l = 0; l < kNumHiddenLayers; l++) {
+        const DenseLayer& layer = kHiddenLayers[l];
+        if (l < kNumFactoredLayers) {
+            FullyConnected(arena[slot], factored[l].down.data(), zero_bias.data(), rank_buffer,
+                           layer.input_size, rank, ActivationType::NONE);
+            FullyConnected(rank_buffer, factored[l].up.data(), layer.bias, arena[1 - slot],
+                           rank, layer.output_size, layer.activation);
+        } else {
+            FullyConnected(arena[slot], layer.weights, layer.bias, arena[1 - slot],
+                           layer.input_size, layer.output_size, layer.activation);
+        }
+        slot = 1 - slot;
+    }
+    Softmax(arena[slot], output, VOCAB_SIZE);
+}
+
+static int export_low_rank(const std::string& out_dir, size_t rank) {
+    if (rank == 0 || rank > 256) {
+        fprintf(stderr, "error: rank must be in [1, 256]\n");
+        return 1;
+    }
+
+    std::vector<FactoredLayer> factored(kNumFactoredLayers);
+    size_t macs_before = 0, macs_after = 0;
+    printf("rank %zu truncated SVD of layers 1-%zu:\n", rank, kNumFactoredLayers);
+    for (size_t l = 0; l < kNumFactoredLayers; l++) {
+        const DenseLayer& layer = kHiddenLayers[l];
+        DenseSvd svd = ComputeSvd(layer.weights, layer.output_size, layer.input_size);
+        LowRankFactors(svd, rank, factored[l].down, factored[l].up);
+        macs_before += layer.input_size * layer.output_size;
+        macs_after += rank * (layer.input_size + layer.output_size);
+        printf("  layer %zu: %.1f%% of the squared Frobenius norm kept\n", l + 1, 100.0 * RetainedEnergy(svd, rank));
+    }
+    printf("  layer 1-3 MACs per inference: %zu -> %zu\n", macs_before, macs_after);
+
+    double max_abs_diff = 0.0, sum_kl = 0.0;
+    int argmax_agree = 0;
+    for (int pos = 0; pos < MAX_WORD_LEN; pos++) {
+        for (int c = 0; c < VOCAB_SIZE; c++) {
+            float ref[VOCAB_SIZE], out[VOCAB_SIZE];
+            float scalar = static_cast<float>(pos) / SEQ_LEN;
+            adjective_model_larger256_4Model::InferenceOneHot(c, scalar, ref);
+            low_rank_inference(factored, rank, c, scalar, out);
+
+            int ref_max = 0, out_max = 0;
+            for (int i = 0; i < VOCAB_SIZE; i++) {
+                max_abs_diff = std::max(max_abs_diff, static_cast<double>(std::fabs(ref[i] - out[i])));
+                if (ref[i] > 0.0f) sum_kl += ref[i] * std::log((ref[i] + 1e-10) / (out[i] + 1e-10));
+                if (ref[i] > ref[ref_max]) ref_max = i;
+                if (out[i] > out[out_max]) out_max = i;
+            }
+            if (ref_max == out_max) argmax_agree++;
+        }
+    }
+    const int num_inputs = MAX_WORD_LEN * VOCAB_SIZE;
+    printf("low-rank vs float over %d reachable inputs:\n", num_inputs);
+    printf("  max |p_lowrank - p_float| = %.6f\n", max_abs_diff);
+    printf("  mean KL(float || lowrank) = %.6f\n", sum_kl / num_inputs);
+    printf("  argmax agreement          = %d/%d\n", argmax_agree, num_inputs);
+
+    FILE* f = open_output(out_dir, std::string(MODEL_NAME) + "_lowrank_weights.cpp");
+    if (!f) return 1;
+    fprintf(f,
+        "// %s_lowrank_weights.cpp\n"
+        "// Auto-generated weight data for embedded inference\n"
+        "// Same tensors as %s_weights.cpp with the layer 1-3 matrices\n"
+        "// replaced by rank-%zu factors from a truncated SVD: W ~= up * down\n"
+        "\n"
+        "#include \"%s_placement.h\"\n"
+        "#include <cstddef>\n"
+        "\n"
+        "namespace embedded_ml {\n"
+        "\n"
+        "static constexpr size_t kLowRank = %zu;\n"
+        "static_assert(kLowRank == EMBEDDED_ML_PLACEMENT_LOW_RANK, \"placement was generated for another rank (make placement RANK=...)\");\n"
+        "\n"
+        "// Bias of the down projections\n"
+        "static const float lowrank_zero_bias[kLowRank] = {};\n"
+        "\n",
+        MODEL_NAME, MODEL_NAME, rank, MODEL_NAME, rank);
+
+    size_t index = 1;
+    for (const WeightTensor& tensor : kWeightTensors) {
+        const std::string placement = layer_placement(tensor_layer(tensor.name), false);
+        const FactoredLayer* factors = nullptr;
+        for (size_t l = 0; l < kNumFactoredLayers; l++) {
+            if (strcmp(kHiddenLayers[l].weight_name, tensor.name) == 0) factors = &factored[l];
+        }
+        if (!factors) {
+            fprintf(f,
+                "\n// Weight tensor %zu: %s\n"
+                "// Shape: %s\n"
+                "// Elements: %zu\n"
+                "static const float %s[%zu] %s = {\n",
+                index++, tensor.tflite_name, tensor.shape, tensor.count, tensor.name, tensor.count, placement.c_str());
+            write_floats(f, tensor.values, tensor.count, "  ");
+            fprintf(f, "};\n\n");
+            continue;
+        }
+        const size_t rows = tensor.dims[0], cols = tensor.dims[1];
+        fprintf(f,
+            "\n// Weight tensor %zu: %s, down projection\n"
+            "// Shape: [%zu, %zu]\n"
+            "// Elements: %zu\n"
+            "static const float %s_down[%zu] %s = {\n",
+            index, tensor.tflite_name, rank, cols, rank * cols, tensor.name, rank * cols, placement.c_str());
+        write_floats(f, factors->down.data(), rank * cols, "  ");
+        fprintf(f, "};\n\n");
+        fprintf(f,
+            "\n// Weight tensor %zu: %s, up projection\n"
+            "// Shape: [%zu, %zu]\n"
+            "// Elements: %zu\n"
+            "static const float %s_up[%zu] %s = {\n",
+            index++, tensor.tflite_name, rows, rank, rows * rank, tensor.name, rows * rank, placement.c_str());
+        write_floats(f, factors->up.data(), rows * rank, "  ");
+        fprintf(f, "};\n\n");
+    }
+
+    fprintf(f, "\n} // namespace embedded_ml\n");
+    fclose(f);
+    return 0;
+}
+
+// Write a byte array as an initializer body, 16 values per line
+static void write_bytes(FILE* f, const std::vector<uint8_t>& bytes) {
+    for (size_t i = 0; i < bytes.size(); i++) {
+        if (i % 16 == 0) fprintf(f, "  ");
+        fprintf(f, "0x%02x", bytes[i]);
+        if (i + 1 < bytes.size()) fprintf(f, (i % 16 == 15) ? ",\n" : ", ");
+    }
+}
+
+// Words of a one-per-line file that the model can produce, with the same
+// filter as train.py, sorted and deduplicated; false if nothing is left
+static bool read_word_list(const std::string& path, std::vector<std::string>& words) {
+    std::ifstream in(path);
+    if (!in) {
+        fprintf(stderr, "error: cannot read %s\n", path.c_str());
+        return false;
+    }
+
+    std::string line;
+    while (std::getline(in, line)) {
+        std::string word;
+        bool letters = true;
+        for (char c : line) {
+            if (c == ' ' || c == '\t' || c == '\r') continue;
+            if (c >= 'A' && c <= 'Z') c = c - 'A' + 'a';
+            if (c < 'a' || c > 'z') letters = false;
+            word += c;
+        }
+        if (letters && !word.empty() && word.size() <= static_cast<size_t>(MAX_WORD_LEN)) words.push_back(word);
+    }
+    std::sort(words.begin(), words.end());
+    words.erase(std::unique(words.begin(), words.end()), words.end());
+    if (words.empty()) {
+        fprintf(stderr, "error: no usable words in %s\n", path.c_str());
+        return false;
+    }
+    return true;
+}
+
+// --- Packed word pool ---
+// Each word takes a fixed POOL_SLOT_BITS-bit slot holding up to MAX_WORD_LEN
+// letter codes (1-26, 5 bits each, first letter lowest, zero-padded), so word
+// i starts at bit i * POOL_SLOT_BITS and is decoded without an index table.
+static constexpr int POOL_LETTER_BITS = 5;
+static constexpr int POOL_SLOT_BITS = POOL_LETTER_BITS * MAX_WORD_LEN;
+
+static int export_pool(const std::string& out_dir, const std::string& words_path) {
+    // Sorted, so the table does not depend on sampling order
+    std::vector<std::string> words;
+    if (!read_word_list(words_path, words)) return 1;
+
+    // Eight bytes of padding so the decoder can always read a whole uint64_t
+    const size_t num_bytes = (words.size() * POOL_SLOT_BITS + 7) / 8 + 8;
+    std::vector<uint8_t> packed(num_bytes, 0);
+    for (size_t w = 0; w < words.size(); w++) {
+        for (size_t i = 0; i < words[w].size(); i++) {
+            const size_t bit = w * POOL_SLOT_BITS + i * POOL_LETTER_BITS;
+            const unsigned code = static_cast<unsigned>(words[w][i] - 'a' + 1);
+            for (int b = 0; b < POOL_LETTER_BITS; b++) {
+                if (code & (1u << b)) packed[(bit + b) / 8] |= static_cast<uint8_t>(1u << ((bit + b) % 8));
+            }
+        }
+    }
+    printf("word pool: %zu distinct words from %s, %zu bytes packed\n", words.size(), words_path.c_str(), num_bytes);
+
+    FILE* h = open_output(out_dir, std::string(MODEL_NAME) + "_pool.h");
+    if (!h) return 1;
+    fprintf(h,
+        "// %s_pool.h\n"
+        "// Auto-generated pool of pre-sampled words\n"
+        "// Pure C++ implementation for embedded systems\n"
+        "\n"
+        "#ifndef ADJECTIVE_MODEL_LARGER256_4_POOL_H\n"
+        "#define ADJECTIVE_MODEL_LARGER256_4_POOL_H\n"
+        "\n"
+        "#include <cstddef>\n"
+        "#include <cstdint>\n"
+        "#include <cstring>\n"
+        "\n"
+        "namespace embedded_ml {\n"
+        "\n"
+        "// Distinct words sampled from the model on the host, sorted\n"
+        "// Word i is the %d-bit slot at bit i * %d of packed: %d letter codes of %d bits\n"
+        "// (1 = 'a' .. 26 = 'z', first letter lowest), zero after the last letter\n"
+        "class %sPool {\n"
+        "public:\n"
+        "    static constexpr size_t kNumWords = %zu;\n"
+        "    static constexpr size_t kMaxLen = %d;\n"
+        "\n"
+        "    // Copy word index (< kNumWords) into out, NUL-terminated (kMaxLen + 1 bytes)\n"
+        "    static void Word(size_t index, char* out) {\n"
+        "        const size_t bit = index * kSlotBits;\n"
+        "        uint64_t slot;\n"
+        "        memcpy(&slot, packed + bit / 8, sizeof(slot));  // little-endian\n"
+        "        slot >>= bit %% 8;\n"
+        "        size_t len = 0;\n"
+        "        for (; len < kMaxLen; ++len, slot >>= kLetterBits) {\n"
+        "            const unsigned code = static_cast<unsigned>(slot & ((1u << kLetterBits) - 1));\n"
+        "            if (code == 0) break;\n"
+        "            out[len] = static_cast<char>('a' + code - 1);\n"
+        "        }\n"
+        "        out[len] = '\\0';\n"
+        "    }\n"
+        "\n"
+        "private:\n"
+        "    static constexpr size_t kLetterBits = %d;\n"
+        "    static constexpr size_t kSlotBits = %d;\n"
+        "    static const uint8_t packed[%zu];\n"
+        "};\n"
+        "\n"
+        "} // namespace embedded_ml\n"
+        "\n"
+        "#endif // ADJECTIVE_MODEL_LARGER256_4_POOL_H\n",
+        MODEL_NAME, POOL_SLOT_BITS, POOL_SLOT_BITS, MAX_WORD_LEN, POOL_LETTER_BITS, MODEL_NAME,
+        words.size(), MAX_WORD_LEN, POOL_LETTER_BITS, POOL_SLOT_BITS, num_bytes);
+    fclose(h);
+
+    FILE* f = open_output(out_dir, std::string(MODEL_NAME) + "_pool.cpp");
+    if (!f) return 1;
+    fprintf(f,
+        "// %s_pool.cpp\n"
+        "// Auto-generated pool of pre-sampled words\n"
+        "// %zu words, %d bits each, plus 8 bytes of read padding\n"
+        "\n"
+        "#include \"%s_pool.h\"\n"
+        "\n"
+        "namespace embedded_ml {\n"
+        "\n"
+        "const uint8_t %sPool::packed[%zu] = {\n",
+        MODEL_NAME, words.size(), POOL_SLOT_BITS, MODEL_NAME, MODEL_NAME, num_bytes);
+    write_bytes(f, packed);
+    fprintf(f,
+        "\n};\n"
+        "\n"
+        "} // namespace embedded_ml\n");
+    fclose(f);
+    return 0;
+}
+
+// --- Lexicon ---
+// The word list as a minimized trie (a DAWG: equal suffix subtrees merged),
+// stored as one array of LEXICON_EDGE_BITS-bit edges. A node is the run of
+// its outgoing edges, sorted by letter; each edge holds
+//   bits 0-4  letter code (1 = 'a' .. 26 = 'z')
+//   bit 5     terminal: the prefix ending in this edge is a word
+//   bit 6     last edge of its node
+//   bits 7-   first edge of the target node + 1, or 0 if it has no edges
+static constexpr int LEXICON_TARGET_SHIFT = 7;
+
+struct LexiconTrieNode {
+    bool terminal = false;
+    std::map<char, size_t> children;
+};
+
+struct LexiconEdge {
+    unsigned letter;
+    bool terminal;
+    size_t target;  // merged node
+};
+
+static bool operator<(const LexiconEdge& a, const LexiconEdge& b) {
+    if (a.letter != b.letter) return a.letter < b.letter;
+    if (a.terminal != b.terminal) return a.terminal < b.terminal;
+    return a.target < b.target;
+}
+
+// Merged node id of trie node n, numbering nodes by their (letter, terminal, target) edge lists
+static size_t merge_lexicon_node(const std::vector<LexiconTrieNode>& trie, size_t n,
+                                 std::map<std::vector<LexiconEdge>, size_t>& ids,
+                                 std::vector<std::vector<LexiconEdge>>& merged) {
+    std::vector<LexiconEdge> edges;
+    for (const auto& child : trie[n].children) {
+        const size_t target = merge_lexicon_node(trie, child.second, ids, merged);
+        edges.push_back({static_cast<unsigned>(child.first - 'a' + 1), trie[child.second].terminal, target});
+    }
+    const auto found = ids.find(edges);
+    if (found != ids.end()) return found->second;
+    ids[edges] = merged.size();
+    merged.push_back(edges);
+    return merged.size() - 1;
+}
+
+static int export_lexicon(const std::string& out_dir, const std::string& words_path) {
+    std::vector<std::string> words;
+    if (!read_word_list(words_path, words)) return 1;
+
+    std::vector<LexiconTrieNode> trie(1);
+    for (const std::string& word : words) {
+        size_t n = 0;
+        for (char c : word) {
+            auto child = trie[n].children.find(c);
+            if (child == trie[n].children.end()) {
+                trie.push_back(LexiconTrieNode());
+                child = trie[n].children.emplace(c, trie.size() - 1).first;
+            }
+            n = child->second;
+        }
+        trie[n].terminal = true;
+    }
+
+    std::map<std::vector<LexiconEdge>, size_t> ids;
+    std::vector<std::vector<LexiconEdge>> merged;
+    const size_t root = merge_lexicon_node(trie, 0, ids, merged);
+
+    // Lay nodes out breadth-first from the root, so the root's edges start at 0
+    std::vector<size_t> order(1, root);
+    std::vector<size_t> first_edge(merged.size(), 0);
+    std::vector<bool> placed(merged.size(), false);
+    placed[root] = true;
+    size_t num_edges = 0;
+    for (size_t i = 0; i < order.size(); i++) {
+        first_edge[order[i]] = num_edges;
+        num_edges += merged[order[i]].size();
+        for (const LexiconEdge& edge : merged[order[i]]) {
+            if (!placed[edge.target] && !merged[edge.target].empty()) {
+                placed[edge.target] = true;
+                order.push_back(edge.target);
+            }
+        }
+    }
+
+    int target_bits = 1;
+    while ((static_cast<size_t>(1) << target_bits) <= num_edges) target_bits++;
+    const int edge_bits = LEXICON_TARGET_SHIFT + target_bits;
+    if (edge_bits > 25) {
+        fprintf(stderr, "error: %zu edges do not fit the lexicon's 32-bit edge reads\n", num_edges);
+        return 1;
+    }
+
+    // Four bytes of padding so the decoder can always read a whole uint32_t
+    const size_t num_bytes = (num_edges * edge_bits + 7) / 8 + 4;
+    std::vector<uint8_t> packed(num_bytes, 0);
+    size_t e = 0;
+    for (size_t node : order) {
+        for (size_t k = 0; k < merged[node].size(); k++, e++) {
+            const LexiconEdge& edge = merged[node][k];
+            const size_t target = merged[edge.target].empty() ? 0 : first_edge[edge.target] + 1;
+            const uint32_t value = edge.letter | (edge.terminal ? 1u << 5 : 0u) |
+                                   (k + 1 == merged[node].size() ? 1u << 6 : 0u) |
+                                   static_cast<uint32_t>(target << LEXICON_TARGET_SHIFT);
+            const size_t bit = e * edge_bits;
+            for (int b = 0; b < edge_bits; b++) {
+                if (value & (1u << b)) packed[(bit + b) / 8] |= static_cast<uint8_t>(1u << ((bit + b) % 8));
+            }
+        }
+    }
+    printf("lexicon: %zu words from %s, %zu trie nodes merged to %zu (%zu edges), %zu bytes packed\n",
+           words.size(), words_path.c_str(), trie.size(), order.size(), num_edges, num_bytes);
+
+    FILE* h = open_output(out_dir, std::string(MODEL_NAME) + "_lexicon.h");
+    if (!h) return 1;
+    fprintf(h,
+        "// %s_lexicon.h\n"
+        "// Auto-generated word list as a minimized trie\n"
+        "// Pure C++ implementation for embedded systems\n"
+        "\n"
+        "#ifndef ADJECTIVE_MODEL_LARGER256_4_LEXICON_H\n"
+        "#define ADJECTIVE_MODEL_LARGER256_4_LEXICON_H\n"
+        "\n"
+        "#include <cstddef>\n"
+        "#include <cstdint>\n"
+        "#include <cstring>\n"
+        "\n"
+        "namespace embedded_ml {\n"
+        "\n"
+        "// %zu words, walked one letter at a time so a caller can stop as soon as\n"
+        "// no word starts with its prefix. A walk state is the prefix's node\n"
+        "// (first edge + 1, 0 without edges) shifted left by one, plus 1 if the\n"
+        "// prefix is itself a word; kMissing once the prefix left the list.\n"
+        "// Edges are %d-bit slots of packed: letter code (1 = 'a' .. 26 = 'z') in\n"
+        "// bits 0-4, terminal bit 5, last edge of its node bit 6, target node above.\n"
+        "class %sLexicon {\n"
+        "public:\n"
+        "    static constexpr size_t kNumWords = %zu;\n"
+        "    static constexpr uint32_t kRoot = 2;     // the empty prefix\n"
+        "    static constexpr uint32_t kMissing = 0;  // no word starts with the prefix\n"
+        "\n"
+        "    // State after appending letter c ('a'-'z') to the prefix walked to state\n"
+        "    static uint32_t Step(uint32_t state, char c) {\n"
+        "        if (state < kRoot) return kMissing;\n"
+        "        const uint32_t code = static_cast<uint32_t>(c - 'a' + 1);\n"
+        "        for (size_t e = (state >> 1) - 1;; ++e) {\n"
+        "            const uint32_t edge = Edge(e);\n"
+        "            const uint32_t letter = edge & 0x1f;\n"
+        "            if (letter == code) return ((edge >> kTargetShift) << 1) | ((edge >> 5) & 1);\n"
+        "            if (letter > code || (edge & 0x40)) return kMissing;  // letters are sorted\n"
+        "        }\n"
+        "    }\n"
+        "\n"
+        "    // Whether the prefix walked to state is a word of the list\n"
+        "    static bool IsWord(uint32_t state) {\n"
+        "        return (state & 1) != 0;\n"
+        "    }\n"
+        "\n"
+        "    // Whether the NUL-terminated lowercase word is in the list\n"
+        "    static bool Contains(const char* word) {\n"
+        "        uint32_t state = kRoot;\n"
+        "        for (; *word && state != kMissing; ++word) state = Step(state, *word);\n"
+        "        return IsWord(state);\n"
+        "    }\n"
+        "\n"
+        "private:\n"
+        "    static constexpr size_t kEdgeBits = %d;\n"
+        "    static constexpr size_t kTargetShift = %d;\n"
+        "    static const uint8_t packed[%zu];\n"
+        "\n"
+        "    static uint32_t Edge(size_t index) {\n"
+        "        const size_t bit = index * kEdgeBits;\n"
+        "        uint32_t slot;\n"
+        "        memcpy(&slot, packed + bit / 8, sizeof(slot));  // little-endian\n"
+        "        return (slot >> (bit %% 8)) & ((1u << kEdgeBits) - 1);\n"
+        "    }\n"
+        "};\n"
+        "\n"
+        "} // namespace embedded_ml\n"
+        "\n"
+        "#endif // ADJECTIVE_MODEL_LARGER256_4_LEXICON_H\n",
+        MODEL_NAME, words.size(), edge_bits, MODEL_NAME, words.size(), edge_bits, LEXICON_TARGET_SHIFT, num_bytes);
+    fclose(h);
+
+    FILE* f = open_output(out_dir, std::string(MODEL_NAME) + "_lexicon.cpp");
+    if (!f) return 1;
+    fprintf(f,
+        "// %s_lexicon.cpp\n"
+        "// Auto-generated word list as a minimized trie\n"
+        "// %zu words, %zu nodes, %zu edges of %d bits, plus 4 bytes of read padding\n"
+        "\n"
+        "#include \"%s_lexicon.h\"\n"
+        "\n"
+        "namespace embedded_ml {\n"
+        "\n"
+        "const uint8_t %sLexicon::packed[%zu] = {\n",
+        MODEL_NAME, words.size(), order.size(), num_edges, edge_bits, MODEL_NAME, MODEL_NAME, num_bytes);
+    write_bytes(f, packed);
+    fprintf(f,
+        "\n};\n"
+        "\n"
+        "} // namespace embedded_ml\n");
+    fclose(f);
+    return 0;
+}
+
+// --- Memory placement ---
+// Matrices larger than the ESP32's 32 KB flash cache are streamed from SPI
+// flash on every inference; one in internal RAM is not, but costs as much
+// heap. Per weight variant, the subset of layers 1-4 that fills the most of
+// the budget is placed in internal RAM. Every byte of those layers is read per
+// inference, so bytes placed is bytes no longer fetched from flash. Layer 0 is
+// read two columns at a time (one character and the position) and always
+// stays in flash.
+struct PlacementVariant {
+    const char* description;
+    const char* condition;            // preprocessor test, nullptr for the #else branch
+    bool int8;
+    std::vector<size_t> layer_bytes;  // per layer, weights, scales and bias
+};
+
+// Bytes of a float layer with the given weight count and output size
+static size_t float_layer_bytes(size_t weights, size_t outputs) {
+    return (weights + outputs) * sizeof(float);
+}
+
+// Layers of 1..n-1 to place, as a bit mask, for the largest total within budget
+static uint32_t choose_placement(const std::vector<size_t>& layer_bytes, size_t budget) {
+    uint32_t best = 0;
+    size_t best_bytes = 0;
+    for (uint32_t mask = 0; mask < (1u << layer_bytes.size()); mask += 2) {  // bit 0 (layer 0) never set
+        size_t bytes = 0;
+        for (size_t l = 0; l < layer_bytes.size(); l++) {
+            if (mask & (1u << l)) bytes += layer_bytes[l];
+        }
+        if (bytes <= budget && bytes > best_bytes) {
+            best = mask;
+            best_bytes = bytes;
+        }
+    }
+    return best;
+}
+
+static int export_placement(const std::string& out_dir, size_t budget, size_t rank) {
+    if (rank == 0 || rank > 256) {
+        fprintf(stderr, "error: rank must be in [1, 256]\n");
+        return 1;
+    }
+    std::vector<std::vector<size_t>> kept;
+    if (!find_live_units(kept)) return 1;
+
+    const size_t layer0_bytes = float_layer_bytes(7424, 256);
+    std::vector<PlacementVariant> variants(4);
+    variants[0] = { "Low-rank float weights", "EMBEDDED_ML_LOWRANK_WEIGHTS", false, { layer0_bytes } };
+    variants[1] = { "Pruned float weights", "EMBEDDED_ML_PRUNED_WEIGHTS", false, { float_layer_bytes(29 * kept[0].size(), kept[0].size()) } };
+    variants[2] = { "Row-major or tiled float weights", nullptr, false, { layer0_bytes } };
+    variants[3] = { "Int8 weights", nullptr, true, { layer0_bytes } };
+    for (size_t l = 0; l < kNumHiddenLayers; l++) {
+        const DenseLayer& layer = kHiddenLayers[l];
+        const size_t dense = layer.input_size * layer.output_size;
+        const size_t rows = l + 1 < kNumHiddenLayers ? kept[l + 1].size() : layer.output_size;
+        variants[0].layer_bytes.push_back(l < kNumFactoredLayers
+            ? float_layer_bytes(rank * (layer.input_size + layer.output_size), layer.output_size)
+            : float_layer_bytes(dense, layer.output_size));
+        variants[1].layer_bytes.push_back(float_layer_bytes(rows * kept[l].size(), rows));
+        variants[2].layer_bytes.push_back(float_layer_bytes(dense, layer.output_size));
+        variants[3].layer_bytes.push_back(dense + 2 * layer.output_size * sizeof(float));
+    }
+
+    FILE* f = open_output(out_dir, std::string(MODEL_NAME) + "_placement.h");
+    if (!f) return 1;
+    fprintf(f,
+        "// %s_placement.h\n"
+        "// Auto-generated memory placement of the weight arrays\n"
+        "// Per weight variant, the layers that fill most of a %zu-byte internal\n"
+        "// RAM budget are marked EMBEDDED_ML_INTERNAL_RAM, the rest stay in flash;\n"
+        "// layer 0 reads two columns per character and always stays in flash\n"
+        "\n"
+        "#ifndef ADJECTIVE_MODEL_LARGER256_4_PLACEMENT_H\n"
+        "#define ADJECTIVE_MODEL_LARGER256_4_PLACEMENT_H\n"
+        "\n"
+        "#include \"components/placement.h\"\n"
+        "\n"
+        "// Rank of the low-rank sizes below (checked by the low-rank weights)\n"
+        "#define EMBEDDED_ML_PLACEMENT_LOW_RANK %zu\n",
+        MODEL_NAME, budget, rank);
+
+    printf("placement for a %zu-byte internal RAM budget:\n", budget);
+    for (size_t v = 0; v < variants.size(); v++) {
+        const PlacementVariant& variant = variants[v];
+        const uint32_t mask = choose_placement(variant.layer_bytes, budget);
+        if (variant.condition) {
+            fprintf(f, "\n#%s %s\n", v == 0 ? "if" : "elif", variant.condition);
+        } else if (!variant.int8) {
+            fprintf(f, "\n#else\n");
+        } else {
+            fprintf(f, "\n#endif\n\n");
+        }
+        fprintf(f, "// %s\n", variant.description);
+        size_t placed = 0;
+        for (size_t l = 0; l < variant.layer_bytes.size(); l++) {
+            const bool internal = mask & (1u << l);
+            if (internal) placed += variant.layer_bytes[l];
+            fprintf(f, "#define %s%s  // %zu bytes\n", layer_placement(l, variant.int8).c_str(),
+                    internal ? " EMBEDDED_ML_INTERNAL_RAM" : "", variant.layer_bytes[l]);
+        }
+        fprintf(f, "#define EMBEDDED_ML_%sINTERNAL_RAM_BYTES %zu\n", variant.int8 ? "INT8_" : "", placed);
+        printf("  %-33s %6zu bytes in internal RAM\n", variant.description, placed);
+    }
+    fprintf(f,
+        "\n"
+        "#endif // ADJECTIVE_MODEL_LARGER256_4_PLACEMENT_H\n");
+    fclose(f);
+    return 0;
+}
+
+static void usage(const char* argv0) {
+    fprintf(stderr,
+        "usage: %s <mode> [out_dir] [rank | words_file | budget [rank]]\n"
+        "  table   next-character lookup table covering every reachable input\n"
+        "  int8    int8 weights with per-output-channel scales, checked against the float model\n"
+        "  tiled   float weights with layers 1-4 row-interleaved for FullyConnectedTiled\n"
+        "  blob    float weights as a binary blob for EMBEDDED_ML_WEIGHT_BLOB builds\n"
+        "  blob-tiled  the same with layers 1-4 tiled, for EMBEDDED_ML_TILED_WEIGHTS blob builds\n"
+        "  pruned  float weights without the hidden units that are zero for every reachable input\n"
+        "  lowrank float weights with layers 1-3 factorized to rank (default 64) by truncated SVD\n"
+        "  pool    words_file packed at 5 bits per letter for the firmware's word pool mode\n"
+        "  lexicon words_file as a minimized trie for the firmware's word filter\n"
+        "  placement  per-layer memory placement of the weight variants for an internal RAM budget\n",
+        argv0);
+}
+
+int main(int argc, char** argv) {
+    if (argc < 2) {
+        usage(argv[0]);
+        return 1;
+    }
+    std::string mode = argv[1];
+    std::string out_dir = argc > 2 ? argv[2] : ".";
+
+    if (mode == "table") return export_table(out_dir);
+    if (mode == "int8") return export_int8(out_dir);
+    if (mode == "tiled") return export_tiled(out_dir);
+    if (mode == "blob") return export_blob(out_dir, false);
+    if (mode == "blob-tiled") return export_blob(out_dir, true);
+    if (mode == "pruned") return export_pruned(out_dir);
+    if (mode == "pool") {
+        if (argc < 4) {
+            usage(argv[0]);
+            return 1;
+        }
+        return export_pool(out_dir, argv[3]);
+    }
+    if (mode == "lexicon") {
+        if (argc < 4) {
+            usage(argv[0]);
+            return 1;
+        }
+        return export_lexicon(out_dir, argv[3]);
+    }
+    if (mode == "lowrank") return export_low_rank(out_dir, argc > 3 ? strtoul(argv[3], nullptr, 10) : LOW_RANK_DEFAULT);
+    if (mode == "placement") {
+        if (argc < 4) {
+            usage(argv[0]);
+            return 1;
+        }
+        return export_placement(out_dir, strtoul(argv[3], nullptr, 10),
+                                argc > 4 ? strtoul(argv[4], nullptr, 10) : LOW_RANK_DEFAULT);
+    }
+
+    usage(argv[0]);
+    return 1;
+}
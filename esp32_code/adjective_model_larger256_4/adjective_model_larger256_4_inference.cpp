@@ -1,85 +1,129 @@
 // adjective_model_larger256_4_inference.cpp
 // Character-by-character word generation matching train.py logic
+//
+// Usage: adjective_model_larger256_4_inference [--engine float|int8|table] [--batch]
+//            [--seed N] [--temperature T]
+//        adjective_model_larger256_4_inference --count N [--threads N] [--out FILE]
+//            [--training FILE] [--engine ...] [--seed N] [--temperature T]
+// The first form prints 30 words; the second (word pool mode) samples N words
+// across worker threads and streams each distinct word once, one per line
 
 #include "adjective_model_larger256_4.h"
-#include <iostream>
+#include "adjective_model_larger256_4_int8.h"
+#include "adjective_model_larger256_4_table.h"
+#include "components/profiler.h"
+#include "components/sampler.h"
+#include "components/softmax.h"
+#include "components/vocab.h"
+#if EMBEDDED_ML_WEIGHT_BLOB
+#include "components/weight_blob.h"
+#endif
+#include <atomic>
+#include <chrono>
 #include <cmath>
+#include <cstdint>
+#include <cstdio>
 #include <cstdlib>
+#include <cstring>
 #include <ctime>
+#include <fstream>
+#include <iostream>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <unordered_set>
+#include <vector>
 
 using namespace embedded_ml;
 
-// --- Vocabulary (must match train.py) ---
-// Index 0: start token '^'
-// Index 1-26: 'a'-'z'
-// Index 27: end token '$'
-static constexpr int VOCAB_SIZE = 28;
-static constexpr int INPUT_DIM = 29;  // VOCAB_SIZE + 1 position
-static constexpr int START_IDX = 0;
-static constexpr int END_IDX = 27;
-static constexpr int MAX_WORD_LEN = 9;
-static constexpr int SEQ_LEN = MAX_WORD_LEN + 1;
-
 // --- Tunable parameter ---
-static constexpr float TEMPERATURE = 0.5f;
+static constexpr float TEMPERATURE = 0.5f;  // default for --temperature
+static float inv_temperature = 1.0f / TEMPERATURE;
 
-static char idx_to_char(int idx) {
-    if (idx >= 1 && idx <= 26) return 'a' + (idx - 1);
-    return 0;
+// Per-thread generation state: a PRNG stream and inference scratch for each engine
+struct Generator {
+    Pcg32 rng;
+    adjective_model_larger256_4Model::Context float_ctx;
+    adjective_model_larger256_4Int8Model::Context int8_ctx;
+};
+
+// Generator of the single-threaded modes, seeded from the clock or --seed
+static Generator main_generator;
+
+// Table engine: one alias table per (pos, char) state at the sampling temperature,
+// built at startup and shared read-only by all threads
+static AliasTable<VOCAB_SIZE> next_char_tables[MAX_WORD_LEN][VOCAB_SIZE];
+
+// Generate all words in lockstep through the batched API (--batch)
+static bool use_batch = false;
+
+// Next-character engine (--engine)
+enum class Engine {
+    FLOAT,  // float network
+    INT8,   // int8-weight network
+    TABLE   // precomputed logits, no network
+};
+static Engine engine = Engine::FLOAT;
+
+// Sample the next character from softmax(logits / temperature) in one pass
+static int sample(Generator& gen, const float* logits) {
+    float weights[VOCAB_SIZE];
+    size_t char_idx;
+    EMBEDDED_ML_PROFILED("sample", char_idx = SampleSoftmaxWithTemperature(logits, weights, VOCAB_SIZE, inv_temperature, gen.rng.NextFloat()));
+    return static_cast<int>(char_idx);
+}
+
+static void build_next_char_tables() {
+    for (int pos = 0; pos < MAX_WORD_LEN; pos++) {
+        for (int c = 0; c < VOCAB_SIZE; c++) {
+            next_char_tables[pos][c].BuildSoftmax(adjective_model_larger256_4Table::LookupLogits(c, pos), inv_temperature);
+        }
+    }
 }
 
-// Sample from a probability distribution
-static int sample(const float* probs, int n) {
-    float r = static_cast<float>(rand()) / static_cast<float>(RAND_MAX);
-    float cumulative = 0.0f;
-    for (int i = 0; i < n; i++) {
-        cumulative += probs[i];
-        if (r <= cumulative) return i;
+// Next-character logits for (char_idx, pos) from the selected engine
+static void next_char_logits(Generator& gen, int char_idx, int pos, float* logits) {
+    switch (engine) {
+    case Engine::FLOAT:
+        adjective_model_larger256_4Model::InferenceOneHotLogits(gen.float_ctx, char_idx, static_cast<float>(pos) / SEQ_LEN, logits);
+        break;
+    case Engine::INT8:
+        adjective_model_larger256_4Int8Model::InferenceOneHotLogits(gen.int8_ctx, char_idx, static_cast<float>(pos) / SEQ_LEN, logits);
+        break;
+    case Engine::TABLE:
+        // Same logits the float model would produce for this (char, pos)
+        memcpy(logits, adjective_model_larger256_4Table::LookupLogits(char_idx, pos), VOCAB_SIZE * sizeof(float));
+        break;
     }
-    return n - 1;
 }
 
-// Generate a single word
-static void generate_word(char* out, int max_len) {
-    float input[INPUT_DIM];
-    float output[VOCAB_SIZE];
+// Next character after (char_idx, pos): O(1) alias draw for the table engine,
+// otherwise inference plus a softmax sample
+static int next_char(Generator& gen, int char_idx, int pos) {
+    if (engine == Engine::TABLE) {
+        size_t next;
+        EMBEDDED_ML_PROFILED("sample", next = next_char_tables[pos][char_idx].Sample(gen.rng));
+        return static_cast<int>(next);
+    }
+    float logits[VOCAB_SIZE];
+    next_char_logits(gen, char_idx, pos, logits);
+    return sample(gen, logits);
+}
 
+// Generate a single word
+static void generate_word(Generator& gen, char* out, int max_len) {
+    EMBEDDED_ML_PROFILE_SCOPE("generate_word");
     int char_idx = START_IDX;
     int len = 0;
 
     for (int pos = 0; pos < MAX_WORD_LEN; pos++) {
-        // Build input: one-hot char + position
-        for (int i = 0; i < INPUT_DIM; i++) input[i] = 0.0f;
-        input[char_idx] = 1.0f;
-        input[INPUT_DIM - 1] = static_cast<float>(pos) / SEQ_LEN;
-
-        // Run model
-        adjective_model_larger256_4Model::Inference(input, output);
-
-        // Apply temperature
-        if (TEMPERATURE != 1.0f) {
-            float max_logp = -1e30f;
-            for (int i = 0; i < VOCAB_SIZE; i++) {
-                float lp = logf(output[i] + 1e-10f) / TEMPERATURE;
-                output[i] = lp;
-                if (lp > max_logp) max_logp = lp;
-            }
-            float sum = 0.0f;
-            for (int i = 0; i < VOCAB_SIZE; i++) {
-                output[i] = expf(output[i] - max_logp);  // subtract max for stability
-                sum += output[i];
-            }
-            for (int i = 0; i < VOCAB_SIZE; i++) {
-                output[i] /= sum;
-            }
-        }
-
-        char_idx = sample(output, VOCAB_SIZE);
+        // Temperature is applied while sampling
+        char_idx = next_char(gen, char_idx, pos);
 
         if (char_idx == END_IDX) break;
         if (char_idx == START_IDX) continue;
 
-        char c = idx_to_char(char_idx);
+        char c = IdxToChar(char_idx);
         if (c && len < max_len - 1) {
             out[len++] = c;
         }
@@ -87,15 +131,308 @@ static void generate_word(char* out, int max_len) {
     out[len] = '\0';
 }
 
-int main() {
-    srand(static_cast<unsigned>(time(nullptr)));
+// Generate n words in lockstep, one batched inference per character position
+// Words that have emitted END_IDX drop out of the batch
+// Uses the model's default batch context, so single-threaded only
+static void generate_words_batch(Generator& gen, char (*out)[MAX_WORD_LEN + 1], int n) {
+    std::vector<size_t> chars(n);
+    std::vector<float> positions(n);
+    std::vector<float> logits(static_cast<size_t>(n) * VOCAB_SIZE);
+    std::vector<int> active(n), lens(n, 0);  // active[k]: word index of batch slot k
+
+    for (int w = 0; w < n; w++) {
+        active[w] = w;
+        chars[w] = START_IDX;
+    }
+    int num_active = n;
+
+    for (int pos = 0; pos < MAX_WORD_LEN && num_active > 0; pos++) {
+        if (engine == Engine::FLOAT) {
+            for (int k = 0; k < num_active; k++) positions[k] = static_cast<float>(pos) / SEQ_LEN;
+            adjective_model_larger256_4Model::InferenceBatchOneHotLogits(chars.data(), positions.data(), logits.data(), num_active);
+        }
+
+        // Sample every active word, compacting finished ones out of the batch
+        int kept = 0;
+        for (int k = 0; k < num_active; k++) {
+            int char_idx = engine == Engine::FLOAT ? sample(gen, &logits[k * VOCAB_SIZE])
+                                                   : next_char(gen, static_cast<int>(chars[k]), pos);
+            int w = active[k];
+
+            if (char_idx == END_IDX) continue;
+
+            char c = IdxToChar(char_idx);
+            if (c && lens[w] < MAX_WORD_LEN) {
+                out[w][lens[w]++] = c;
+            }
+            active[kept] = w;
+            chars[kept] = char_idx;
+            kept++;
+        }
+        num_active = kept;
+    }
+
+    for (int w = 0; w < n; w++) out[w][lens[w]] = '\0';
+}
+
+#if EMBEDDED_ML_WEIGHT_BLOB
+// Float weights blob (--weights), written by `make blob`
+#if EMBEDDED_ML_TILED_WEIGHTS
+static const char* weights_path = "adjective_model_larger256_4_tiled_weights.bin";
+#else
+static const char* weights_path = "adjective_model_larger256_4_weights.bin";
+#endif
+
+static bool load_weights() {
+    size_t size = 0;
+    const void* blob = MapWeightBlobFile(weights_path, &size);
+    if (!blob) {
+        std::cerr << "error: cannot map " << weights_path << std::endl;
+        return false;
+    }
+    if (!adjective_model_larger256_4Model::LoadWeights(blob, size)) {
+        std::cerr << "error: " << weights_path << " is not a weight blob for this model" << std::endl;
+        return false;
+    }
+    return true;
+}
+#endif
+
+// --- Word pool (--count) ---
+// Samples are split into fixed chunks of POOL_CHUNK_WORDS; chunk k always draws
+// from PRNG stream k of the seed, so the set of words produced depends only on
+// --seed, --count, --engine and --temperature, not on the thread count (only
+// the output order does). Workers claim chunks from a shared counter.
+static constexpr uint64_t POOL_CHUNK_WORDS = 4096;
+
+// A word of up to MAX_WORD_LEN letters packed 5 bits per letter, first letter
+// lowest; distinct words give distinct keys and the empty word gives 0
+static uint64_t word_key(const char* word) {
+    uint64_t key = 0;
+    for (int i = 0; i < MAX_WORD_LEN && word[i]; i++) {
+        key |= static_cast<uint64_t>(word[i] - 'a' + 1) << (5 * i);
+    }
+    return key;
+}
+
+// Concurrent set of word keys: independently locked shards picked by a key hash
+class PoolWordSet {
+public:
+    // True if key was not in the set yet
+    bool Insert(uint64_t key) {
+        Shard& shard = shards_[(key * 0x9e3779b97f4a7c15ULL) >> (64 - kShardBits)];
+        std::lock_guard<std::mutex> lock(shard.mutex);
+        return shard.keys.insert(key).second;
+    }
+
+private:
+    static constexpr int kShardBits = 6;
+
+    struct Shard {
+        std::mutex mutex;
+        std::unordered_set<uint64_t> keys;
+    };
+    Shard shards_[1 << kShardBits];
+};
+
+struct WordPool {
+    uint64_t seed;
+    uint64_t count;                              // words to sample
+    const std::unordered_set<uint64_t>* training;  // --training words, or null
+    FILE* out;
+
+    std::atomic<uint64_t> next_chunk{0};
+    PoolWordSet seen;
+    std::mutex out_mutex;
+
+    std::atomic<uint64_t> unique{0};
+    std::atomic<uint64_t> empty{0};              // samples that ended before any letter
+    std::atomic<uint64_t> training_samples{0};   // samples that are a training adjective
+    std::atomic<uint64_t> training_unique{0};    // distinct training adjectives produced
+};
+
+static void pool_worker(WordPool& pool) {
+    Generator gen;
+    std::string fresh;  // new words of the current chunk, written in one go
+    for (;;) {
+        const uint64_t chunk = pool.next_chunk.fetch_add(1, std::memory_order_relaxed);
+        const uint64_t begin = chunk * POOL_CHUNK_WORDS;
+        if (begin >= pool.count) break;
+        const uint64_t end = std::min(pool.count, begin + POOL_CHUNK_WORDS);
+
+        gen.rng.Seed(pool.seed, chunk);
+        uint64_t unique = 0, empty = 0, training_samples = 0, training_unique = 0;
+        for (uint64_t i = begin; i < end; i++) {
+            char word[MAX_WORD_LEN + 1];
+            generate_word(gen, word, sizeof(word));
+            const uint64_t key = word_key(word);
+            if (key == 0) {
+                empty++;
+                continue;
+            }
+            const bool in_training = pool.training && pool.training->count(key);
+            if (in_training) training_samples++;
+            if (!pool.seen.Insert(key)) continue;
+
+            unique++;
+            if (in_training) training_unique++;
+            fresh += word;
+            fresh += '\n';
+        }
+
+        if (!fresh.empty()) {
+            std::lock_guard<std::mutex> lock(pool.out_mutex);
+            fwrite(fresh.data(), 1, fresh.size(), pool.out);
+        }
+        fresh.clear();
+        pool.unique += unique;
+        pool.empty += empty;
+        pool.training_samples += training_samples;
+        pool.training_unique += training_unique;
+    }
+}
+
+// Load adjectives the way train.py does: trimmed, lowercased, letters only, <= MAX_WORD_LEN
+static bool load_training_words(const char* path, std::unordered_set<uint64_t>& words) {
+    std::ifstream in(path);
+    if (!in) return false;
+    std::string line;
+    while (std::getline(in, line)) {
+        const size_t first = line.find_first_not_of(" \t\r");
+        const size_t last = line.find_last_not_of(" \t\r");
+        if (first == std::string::npos) continue;
+        std::string word = line.substr(first, last - first + 1);
+        bool letters = word.size() <= static_cast<size_t>(MAX_WORD_LEN);
+        for (char& c : word) {
+            if (c >= 'A' && c <= 'Z') c = c - 'A' + 'a';
+            if (c < 'a' || c > 'z') letters = false;
+        }
+        if (letters) words.insert(word_key(word.c_str()));
+    }
+    return true;
+}
+
+static int run_word_pool(uint64_t seed, uint64_t count, unsigned threads, const char* out_path, const char* training_path) {
+    std::unordered_set<uint64_t> training;
+    if (training_path && !load_training_words(training_path, training)) {
+        std::cerr << "error: cannot read " << training_path << std::endl;
+        return 1;
+    }
+    FILE* out = out_path ? fopen(out_path, "w") : stdout;
+    if (!out) {
+        std::cerr << "error: cannot open " << out_path << " for writing" << std::endl;
+        return 1;
+    }
+
+    WordPool pool;
+    pool.seed = seed;
+    pool.count = count;
+    pool.training = training_path ? &training : nullptr;
+    pool.out = out;
+
+    const auto start = std::chrono::steady_clock::now();
+    std::vector<std::thread> workers;
+    for (unsigned t = 0; t < threads; t++) workers.emplace_back(pool_worker, std::ref(pool));
+    for (std::thread& worker : workers) worker.join();
+    const double seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+
+    if (out_path && fclose(out) != 0) {
+        std::cerr << "error: cannot write " << out_path << std::endl;
+        return 1;
+    }
+    fflush(stdout);
+
+    // Summary on stderr so the word stream stays clean
+    fprintf(stderr, "pool: %llu samples on %u threads in %.2f s (%.0f words/s)\n",
+            static_cast<unsigned long long>(count), threads, seconds, count / seconds);
+    fprintf(stderr, "  distinct words: %llu, empty samples: %llu\n",
+            static_cast<unsigned long long>(pool.unique.load()), static_cast<unsigned long long>(pool.empty.load()));
+    if (pool.training) {
+        fprintf(stderr, "  training adjectives: %.2f%% of samples, %llu of %zu reproduced\n",
+                100.0 * pool.training_samples.load() / count,
+                static_cast<unsigned long long>(pool.training_unique.load()), training.size());
+    }
+    return 0;
+}
+
+int main(int argc, char** argv) {
+    uint64_t seed = static_cast<uint64_t>(time(nullptr));
+    uint64_t pool_count = 0;
+    unsigned threads = std::max(1u, std::thread::hardware_concurrency());
+    const char* out_path = nullptr;
+    const char* training_path = nullptr;
+    for (int i = 1; i < argc; i++) {
+        const char* value = i + 1 < argc ? argv[i + 1] : "";
+        if (strcmp(argv[i], "--batch") == 0) {
+            use_batch = true;
+            continue;
+        }
+        if (strcmp(argv[i], "--engine") == 0 && strcmp(value, "float") == 0) {
+            engine = Engine::FLOAT;
+        } else if (strcmp(argv[i], "--engine") == 0 && strcmp(value, "int8") == 0) {
+            engine = Engine::INT8;
+        } else if (strcmp(argv[i], "--engine") == 0 && strcmp(value, "table") == 0) {
+            engine = Engine::TABLE;
+        } else if (strcmp(argv[i], "--seed") == 0 && *value) {
+            seed = strtoull(value, nullptr, 10);
+        } else if (strcmp(argv[i], "--temperature") == 0 && atof(value) > 0.0) {
+            inv_temperature = static_cast<float>(1.0 / atof(value));
+        } else if (strcmp(argv[i], "--count") == 0 && strtoull(value, nullptr, 10) > 0) {
+            pool_count = strtoull(value, nullptr, 10);
+        } else if (strcmp(argv[i], "--threads") == 0 && atoi(value) > 0) {
+            threads = static_cast<unsigned>(atoi(value));
+        } else if (strcmp(argv[i], "--out") == 0 && *value) {
+            out_path = value;
+        } else if (strcmp(argv[i], "--training") == 0 && *value) {
+            training_path = value;
+#if EMBEDDED_ML_WEIGHT_BLOB
+        } else if (strcmp(argv[i], "--weights") == 0 && *value) {
+            weights_path = value;
+#endif
+        } else {
+            std::cerr << "usage: " << argv[0] << " [--engine float|int8|table] [--batch] [--seed N] [--temperature T]"
+#if EMBEDDED_ML_WEIGHT_BLOB
+                      << " [--weights FILE]"
+#endif
+                      << "\n       " << argv[0] << " --count N [--threads N] [--out FILE] [--training FILE]"
+                      << " [--engine float|int8|table] [--seed N] [--temperature T]" << std::endl;
+            return 1;
+        }
+        i++;
+    }
+
+#if EMBEDDED_ML_WEIGHT_BLOB
+    if (engine == Engine::FLOAT && !load_weights()) return 1;
+#endif
+    if (engine == Engine::TABLE) build_next_char_tables();
+
+    if (pool_count > 0) {
+        int status = run_word_pool(seed, pool_count, threads, out_path, training_path);
+#if EMBEDDED_ML_PROFILE
+        // Probes are shared by the workers; each one locks on Record(), so the
+        // counts cover every thread's samples exactly
+        ProfileStat::Report([](const char* line) { std::cerr << line << std::endl; });
+#endif
+        return status;
+    }
+
+    main_generator.rng.Seed(seed);
+    static constexpr int NUM_WORDS = 30;
+    char words[NUM_WORDS][MAX_WORD_LEN + 1];
+    if (use_batch) {
+        generate_words_batch(main_generator, words, NUM_WORDS);
+    } else {
+        for (int i = 0; i < NUM_WORDS; i++) generate_word(main_generator, words[i], sizeof(words[i]));
+    }
 
     std::cout << "the future is..." << std::endl;
-    for (int i = 0; i < 30; i++) {
-        char word[MAX_WORD_LEN + 1];
-        generate_word(word, sizeof(word));
-        std::cout << "  " << word << std::endl;
+    for (int i = 0; i < NUM_WORDS; i++) {
+        std::cout << "  " << words[i] << std::endl;
     }
 
+#if EMBEDDED_ML_PROFILE
+    ProfileStat::Report([](const char* line) { std::cerr << line << std::endl; });
+#endif
+
     return 0;
 }
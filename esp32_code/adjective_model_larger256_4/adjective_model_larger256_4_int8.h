@@ -0,0 +1,81 @@
+// adjective_model_larger256_4_int8.h
+// Auto-generated int8 inference model header
+// Pure C++ implementation for embedded systems
+
+#ifndef ADJECTIVE_MODEL_LARGER256_4_INT8_MODEL_H
+#define ADJECTIVE_MODEL_LARGER256_4_INT8_MODEL_H
+
+#include <cstddef>
+#include <cstdint>
+
+namespace embedded_ml {
+
+// Same interface as adjective_model_larger256_4Model, with int8 weights
+// (per-output-channel scales) and int32 accumulation for layers 1-4
+class adjective_model_larger256_4Int8Model {
+public:
+    static constexpr size_t kInputSize = 29;
+    static constexpr size_t kOutputSize = 28;
+
+    // Widest intermediate layer output
+    static constexpr size_t kArenaSlotSize = 256;
+
+    // Activation scratch for one inference at a time
+    // Give each thread or task its own Context to run inference concurrently
+    struct Context {
+        // Float layer outputs, alternating between two slots (see adjective_model_larger256_4Model)
+        float arena[2][kArenaSlotSize];
+
+        // Int8 copy of the current layer input
+        int8_t quantized[kArenaSlotSize];
+    };
+
+
+private:
+    // Context behind the static wrappers below
+    static Context default_context;
+
+    // Layers 1-4, shared by all input paths (reads buffer_11 from arena slot 0)
+    // buffer_15: logits output, may be arena slot 0 but not slot 1
+    static void InferenceHidden(Context& ctx, float* buffer_15);
+
+
+public:
+    // Run inference on input data
+    // ctx: activation scratch, must not be shared with a concurrent call
+    // input: array of size kInputSize
+    // output: array of size kOutputSize (will be filled with results)
+    static void Inference(Context& ctx, const float* input, float* output);
+
+    // Run inference on a one-hot input plus trailing scalar, without building the dense input
+    // Equivalent to Inference() on input = [one_hot(index) (kInputSize - 1 entries), scalar]
+    // index: hot entry, must be < kInputSize - 1
+    // output: array of size kOutputSize (will be filled with results)
+    static void InferenceOneHot(Context& ctx, size_t index, float scalar, float* output);
+
+    // Inference() / InferenceOneHot() stopping before the final softmax
+    // logits: array of size kOutputSize (pre-softmax layer 4 output, buffer_15)
+    static void InferenceLogits(Context& ctx, const float* input, float* logits);
+    static void InferenceOneHotLogits(Context& ctx, size_t index, float scalar, float* logits);
+
+    // Static wrappers over a shared default context (not reentrant)
+    static void Inference(const float* input, float* output) {
+        Inference(default_context, input, output);
+    }
+
+    static void InferenceOneHot(size_t index, float scalar, float* output) {
+        InferenceOneHot(default_context, index, scalar, output);
+    }
+
+    static void InferenceLogits(const float* input, float* logits) {
+        InferenceLogits(default_context, input, logits);
+    }
+
+    static void InferenceOneHotLogits(size_t index, float scalar, float* logits) {
+        InferenceOneHotLogits(default_context, index, scalar, logits);
+    }
+};
+
+} // namespace embedded_ml
+
+#endif // ADJECTIVE_MODEL_LARGER256_4_INT8_MODEL_H
@@ -0,0 +1,52 @@
+// adjective_model_larger256_4_placement.h
+// Auto-generated memory placement of the weight arrays
+// Per weight variant, the layers that fill most of a 98304-byte internal
+// RAM budget are marked EMBEDDED_ML_INTERNAL_RAM, the rest stay in flash;
+// layer 0 reads two columns per character and always stays in flash
+
+#ifndef ADJECTIVE_MODEL_LARGER256_4_PLACEMENT_H
+#define ADJECTIVE_MODEL_LARGER256_4_PLACEMENT_H
+
+#include "components/placement.h"
+
+// Rank of the low-rank sizes below (checked by the low-rank weights)
+#define EMBEDDED_ML_PLACEMENT_LOW_RANK 64
+
+#if EMBEDDED_ML_LOWRANK_WEIGHTS
+// Low-rank float weights
+#define EMBEDDED_ML_LAYER0_PLACEMENT  // 30720 bytes
+#define EMBEDDED_ML_LAYER1_PLACEMENT  // 132096 bytes
+#define EMBEDDED_ML_LAYER2_PLACEMENT  // 132096 bytes
+#define EMBEDDED_ML_LAYER3_PLACEMENT  // 132096 bytes
+#define EMBEDDED_ML_LAYER4_PLACEMENT EMBEDDED_ML_INTERNAL_RAM  // 28784 bytes
+#define EMBEDDED_ML_INTERNAL_RAM_BYTES 28784
+
+#elif EMBEDDED_ML_PRUNED_WEIGHTS
+// Pruned float weights
+#define EMBEDDED_ML_LAYER0_PLACEMENT  // 29880 bytes
+#define EMBEDDED_ML_LAYER1_PLACEMENT  // 211000 bytes
+#define EMBEDDED_ML_LAYER2_PLACEMENT  // 181472 bytes
+#define EMBEDDED_ML_LAYER3_PLACEMENT  // 166840 bytes
+#define EMBEDDED_ML_LAYER4_PLACEMENT EMBEDDED_ML_INTERNAL_RAM  // 21840 bytes
+#define EMBEDDED_ML_INTERNAL_RAM_BYTES 21840
+
+#else
+// Row-major or tiled float weights
+#define EMBEDDED_ML_LAYER0_PLACEMENT  // 30720 bytes
+#define EMBEDDED_ML_LAYER1_PLACEMENT  // 263168 bytes
+#define EMBEDDED_ML_LAYER2_PLACEMENT  // 263168 bytes
+#define EMBEDDED_ML_LAYER3_PLACEMENT  // 263168 bytes
+#define EMBEDDED_ML_LAYER4_PLACEMENT EMBEDDED_ML_INTERNAL_RAM  // 28784 bytes
+#define EMBEDDED_ML_INTERNAL_RAM_BYTES 28784
+
+#endif
+
+// Int8 weights
+#define EMBEDDED_ML_INT8_LAYER0_PLACEMENT  // 30720 bytes
+#define EMBEDDED_ML_INT8_LAYER1_PLACEMENT EMBEDDED_ML_INTERNAL_RAM  // 67584 bytes
+#define EMBEDDED_ML_INT8_LAYER2_PLACEMENT  // 67584 bytes
+#define EMBEDDED_ML_INT8_LAYER3_PLACEMENT  // 67584 bytes
+#define EMBEDDED_ML_INT8_LAYER4_PLACEMENT EMBEDDED_ML_INTERNAL_RAM  // 7392 bytes
+#define EMBEDDED_ML_INT8_INTERNAL_RAM_BYTES 74976
+
+#endif // ADJECTIVE_MODEL_LARGER256_4_PLACEMENT_H
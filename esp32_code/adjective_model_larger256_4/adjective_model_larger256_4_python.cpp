@@ -0,0 +1,101 @@
+// adjective_model_larger256_4_python.cpp
+// C interface to the float model for Python (ctypes), built by `make python`
+// into libadjective_model_larger256_4.so; model-training/embedded_engine.py wraps it
+//
+// Generation is the inference tool's --batch mode: one Pcg32 seeded with the
+// given seed, all words stepped in lockstep through the batched API, so
+// generate(30, t, s) returns the words `--batch --seed s --temperature t` prints.
+// Calls are independent and may run concurrently.
+//
+// The library samples like firmware built with the same weights and kernel
+// backend: `make python DSP=1` for the ttgo-t1-dsp envs. On the host the
+// ESP-DSP backend only reproduces the device's order of the sums, so the device
+// kernel can still round differently in the last bits.
+
+#include "adjective_model_larger256_4.h"
+#include "components/sampler.h"
+#include "components/softmax.h"
+#include "components/vocab.h"
+#include <cstdint>
+#include <cstring>
+#include <memory>
+#include <vector>
+
+#if EMBEDDED_ML_WEIGHT_BLOB
+#error "the Python library links the compiled-in weights; build it without BLOB=1"
+#endif
+
+using namespace embedded_ml;
+
+static_assert(adjective_model_larger256_4Model::kInputSize == INPUT_DIM, "model does not match the vocabulary");
+static_assert(adjective_model_larger256_4Model::kOutputSize == VOCAB_SIZE, "model does not match the vocabulary");
+
+extern "C" {
+
+uint32_t adjective_model_larger256_4_input_size() {
+    return adjective_model_larger256_4Model::kInputSize;
+}
+
+uint32_t adjective_model_larger256_4_output_size() {
+    return adjective_model_larger256_4Model::kOutputSize;
+}
+
+uint32_t adjective_model_larger256_4_max_word_len() {
+    return MAX_WORD_LEN;
+}
+
+// Softmax outputs for batch rows of kInputSize inputs, like the TFLite model
+// inputs: [batch x kInputSize], outputs: [batch x kOutputSize]
+void adjective_model_larger256_4_predict(const float* inputs, uint32_t batch, float* outputs) {
+    std::unique_ptr<adjective_model_larger256_4Model::BatchContext> ctx(new adjective_model_larger256_4Model::BatchContext());
+    adjective_model_larger256_4Model::InferenceBatch(*ctx, inputs, outputs, batch);
+}
+
+// Sample n words at temperature (> 0)
+// out: n rows of MAX_WORD_LEN + 1 bytes, each a NUL-terminated word
+// Returns 0, or -1 if the temperature is not positive
+int adjective_model_larger256_4_generate(uint32_t n, float temperature, uint64_t seed, char* out) {
+    if (!(temperature > 0.0f)) return -1;
+    const float inv_temperature = 1.0f / temperature;
+    const size_t row = MAX_WORD_LEN + 1;
+
+    std::unique_ptr<adjective_model_larger256_4Model::BatchContext> ctx(new adjective_model_larger256_4Model::BatchContext());
+    Pcg32 rng;
+    rng.Seed(seed);
+
+    std::vector<size_t> chars(n, START_IDX);
+    std::vector<float> positions(n);
+    std::vector<float> logits(static_cast<size_t>(n) * VOCAB_SIZE);
+    std::vector<uint32_t> active(n), lens(n, 0);  // active[k]: word index of batch slot k
+    for (uint32_t w = 0; w < n; w++) active[w] = w;
+    uint32_t num_active = n;
+
+    for (int pos = 0; pos < MAX_WORD_LEN && num_active > 0; pos++) {
+        for (uint32_t k = 0; k < num_active; k++) positions[k] = static_cast<float>(pos) / SEQ_LEN;
+        adjective_model_larger256_4Model::InferenceBatchOneHotLogits(*ctx, chars.data(), positions.data(), logits.data(), num_active);
+
+        // Sample every active word, compacting finished ones out of the batch
+        uint32_t kept = 0;
+        for (uint32_t k = 0; k < num_active; k++) {
+            float weights[VOCAB_SIZE];
+            const int char_idx = static_cast<int>(SampleSoftmaxWithTemperature(&logits[static_cast<size_t>(k) * VOCAB_SIZE], weights, VOCAB_SIZE, inv_temperature, rng.NextFloat()));
+            const uint32_t w = active[k];
+
+            if (char_idx == END_IDX) continue;
+
+            const char c = IdxToChar(char_idx);
+            if (c && lens[w] < static_cast<uint32_t>(MAX_WORD_LEN)) {
+                out[w * row + lens[w]++] = c;
+            }
+            active[kept] = w;
+            chars[kept] = char_idx;
+            kept++;
+        }
+        num_active = kept;
+    }
+
+    for (uint32_t w = 0; w < n; w++) out[w * row + lens[w]] = '\0';
+    return 0;
+}
+
+} // extern "C"
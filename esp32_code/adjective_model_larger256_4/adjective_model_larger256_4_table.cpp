@@ -0,0 +1,1551 @@
+// adjective_model_larger256_4_table.cpp
+// Auto-generated next-character lookup table
+// Shape: [9 positions, 28 chars, 28 outputs]
+
+#include "adjective_model_larger256_4_table.h"
+
+namespace embedded_ml {
+
+const float adjective_model_larger256_4Table::logits[9][28][28] = {
+  // pos 0
+  {
+    {
+      -1.429526806e+01,  1.185169220e+00,  7.711687684e-01,  1.062779903e+00,  7.542156577e-01,  -7.210985422e-01,  8.820616007e-01,  -1.222021580e-01,
+      -1.274832726e+00,  -6.665793657e-01,  -2.473965645e+00,  -3.366541624e+00,  2.297159582e-01,  -3.729555607e-01,  -1.855641127e+00,  -2.678541660e+00,
+      -1.296912432e-01,  -2.435887098e+00,  6.668434143e-01,  3.678391278e-01,  -1.452273130e+00,  -2.720130205e+00,  -1.576235414e+00,  6.002486944e-01,
+      -3.452314377e+00,  -1.198972106e+00,  -9.396163225e-01,  -8.291865349e+00
+    },
+    {
+      -2.156398582e+01,  -4.647497177e+00,  6.416674256e-01,  9.048115462e-02,  6.283368468e-01,  -4.877288640e-01,  -7.616674900e-01,  -7.443887740e-02,
+      -7.709441662e+00,  -9.801549315e-01,  -1.144764996e+01,  -1.931195140e+00,  -8.005380630e-01,  8.176033497e-01,  9.013612866e-01,  -3.017053127e+00,
+      -6.430051327e-01,  -1.633216739e+00,  1.298786700e-01,  -9.059042931e-01,  -3.802352250e-01,  4.777849019e-01,  -1.108485103e+00,  -7.223697305e-01,
+      -9.852525711e+00,  -4.018107414e+00,  -4.001849174e+00,  -1.769327545e+01
+    },
+    {
+      -3.070001221e+01,  2.439660549e+00,  -8.935403824e+00,  -1.064222717e+01,  -9.588505745e+00,  2.691416502e+00,  -1.311875057e+01,  -1.137792778e+01,
+      -4.405995846e+00,  1.160032868e+00,  -3.319237518e+01,  -2.668889999e+01,  1.480148792e+00,  -8.883856773e+00,  -6.522729874e+00,  2.196707010e+00,
+      -1.018739319e+01,  -2.059314346e+01,  1.434511542e+00,  -8.341420174e+00,  -9.765963554e+00,  1.823537707e+00,  -1.382193565e+01,  -6.774522305e+00,
+      -1.873120880e+01,  -9.932260215e-02,  -2.166084862e+01,  -7.454615116e+00
+    },
+    {
+      -2.362511063e+01,  2.126877785e+00,  -8.946647644e+00,  -9.263923645e+00,  -8.776395798e+00,  1.149390459e+00,  -1.149493885e+01,  -9.861040115e+00,
+      2.378414154e+00,  7.962181568e-01,  -2.909868813e+01,  -1.647192383e+01,  2.141697884e+00,  -1.250879478e+01,  -5.509183407e+00,  1.889608622e+00,
+      -1.167417717e+01,  -1.697477722e+01,  -1.724788785e+00,  -8.799887657e+00,  -7.856634140e+00,  1.328295112e+00,  -1.486490822e+01,  -9.496108055e+00,
+      -1.808099556e+01,  1.465306431e-02,  -1.239027309e+01,  -6.388060093e+00
+    },
+    {
+      -3.521623611e+01,  2.515356541e+00,  -1.446683693e+01,  -8.625189781e+00,  -1.052636337e+01,  4.321946621e+00,  -2.036662292e+01,  -1.263084888e+01,
+      -4.256283283e+00,  7.296859026e-01,  -3.713996887e+01,  -2.721229935e+01,  -6.479116440e+00,  -7.727675915e+00,  -1.211923027e+01,  1.106243968e+00,
+      -1.277688789e+01,  -1.463950539e+01,  -5.961148143e-01,  -1.148618507e+01,  -6.696537018e+00,  3.176471889e-01,  -1.064113426e+01,  -2.222919464e+00,
+      -2.847250938e+01,  -6.719176769e-01,  -1.455879784e+01,  -1.106573009e+01
+    },
+    {
+      -3.318132019e+01,  -4.144756317e+00,  6.700250506e-01,  -4.952129126e-01,  -2.308306456e+00,  -3.209594727e+00,  -4.054799676e-01,  -4.396578789e+00,
+      -9.765738487e+00,  -2.973650694e+00,  -1.537986088e+01,  -8.961721420e+00,  -4.737862572e-02,  2.055608511e+00,  1.520016313e+00,  -3.039738655e+00,
+      -1.604902148e+00,  -1.075701523e+01,  1.229290739e-01,  -4.701942921e+00,  -8.969166279e-01,  5.871770978e-01,  -3.724491000e-01,  -3.592085361e+00,
+      9.909082651e-01,  -5.685128212e+00,  -2.099288177e+01,  -1.862193108e+01
+    },
+    {
+      -3.154794693e+01,  -1.559692919e-01,  -5.487556934e+00,  -9.811581612e+00,  -5.923940182e+00,  1.488401651e+00,  -9.518746376e+00,  -9.401861191e+00,
+      -4.434531212e+00,  1.871242285e+00,  -3.662639999e+01,  -2.434242249e+01,  2.608217716e+00,  -9.022285461e+00,  -4.452632427e+00,  3.021683693e+00,
+      -9.030778885e+00,  -2.322965813e+01,  1.200098872e+00,  -8.876191139e+00,  -1.041382790e+01,  -1.887609959e+00,  -1.254391193e+01,  -9.369135857e+00,
+      -1.511485767e+01,  -2.300966024e+00,  -1.909824562e+01,  -6.560430050e+00
+    },
+    {
+      -3.822232819e+01,  -2.849296570e+00,  -7.278672218e+00,  -1.181883144e+01,  -8.899839401e+00,  2.777874768e-01,  -1.132783127e+01,  -1.176232529e+01,
+      -1.124345779e+00,  -1.495712996e+00,  -4.298250961e+01,  -2.373112297e+01,  5.270603895e-01,  -7.522421837e+00,  -1.240982294e+00,  1.891804934e+00,
+      -1.205418491e+01,  -2.536620903e+01,  2.100410938e+00,  -8.907374382e+00,  -1.020659637e+01,  -1.423241347e-01,  -1.040118504e+01,  -8.814051628e+00,
+      -1.161349392e+01,  -4.136024952e+00,  -2.430425262e+01,  -1.272946835e+01
+    },
+    {
+      -5.381784439e+01,  3.145719528e+00,  -1.303295135e+01,  -9.895487785e+00,  -1.371047688e+01,  -1.898051381e+00,  -1.522272205e+01,  -1.376839352e+01,
+      -6.444141865e+00,  -2.077839136e+00,  -5.616578293e+01,  -2.893852043e+01,  -3.849884510e+00,  -1.032613087e+01,  -9.296691895e+00,  3.304400206e+00,
+      -8.512929916e+00,  -1.926794052e+01,  -6.455481529e+00,  -7.485191345e+00,  -1.024719429e+01,  -7.237882614e-01,  -1.395668411e+01,  -1.459271526e+01,
+      -2.674100113e+01,  1.871335030e+00,  -4.384818649e+01,  -1.551827621e+01
+    },
+    {
+      -5.989359283e+01,  -5.617298126e+00,  -3.630205870e+00,  -4.177904129e+00,  3.059291363e+00,  -2.783470869e+00,  -4.013546467e+00,  -3.833287954e+00,
+      -1.441055489e+01,  -6.662467480e+00,  -5.958361435e+01,  -1.505769634e+01,  -2.357392550e+00,  4.430832863e+00,  5.794026852e+00,  -1.418625236e+00,
+      -2.588622332e+00,  -1.794391251e+01,  -3.809489012e+00,  -1.223243141e+01,  -2.868044853e+00,  -2.593383551e+00,  -4.212728500e+00,  -1.380497932e+01,
+      -2.099970055e+01,  -8.860786438e+00,  -5.182303429e+00,  -4.403253174e+01
+    },
+    {
+      -4.692478943e+01,  2.508109331e+00,  -1.979001808e+01,  -1.225417328e+01,  -9.371008873e+00,  -2.667345762e+00,  -1.971493340e+01,  -1.279256630e+01,
+      -4.368287086e+00,  -2.108084917e+00,  -4.788219452e+01,  -3.244518280e+01,  -2.841449261e+00,  -7.594718933e+00,  -1.039890003e+01,  3.093457699e+00,
+      -2.006011772e+01,  -1.739516258e+01,  -6.764957428e+00,  -1.083731556e+01,  -1.171205139e+01,  3.132082224e+00,  -1.263010979e+01,  -1.488262558e+01,
+      -2.578815460e+01,  -1.450210571e+00,  -5.015383530e+01,  -1.182975674e+01
+    },
+    {
+      -7.848015594e+01,  -3.611783266e+00,  -2.260017204e+01,  -1.502869701e+01,  -1.986017036e+01,  1.712255359e+00,  -2.377191544e+01,  -1.843704033e+01,
+      -6.579079151e+00,  7.748260975e+00,  -9.142609406e+01,  -5.048537445e+01,  -5.260720253e+00,  -3.441106033e+01,  -1.438041782e+01,  4.224239349e+00,
+      -2.306641769e+01,  -3.538148880e+01,  -8.189206123e+00,  -2.293947029e+01,  -1.887335968e+01,  8.791910410e-01,  -3.233308792e+01,  -2.625253868e+01,
+      -4.997042847e+01,  -4.649254322e+00,  -3.208738327e+01,  -1.195723438e+01
+    },
+    {
+      -4.392160797e+01,  1.452823639e+00,  -7.914824009e+00,  -8.918959618e+00,  -7.413110733e+00,  -1.434346437e+00,  -1.055462837e+01,  -8.517018318e+00,
+      -5.026498795e+00,  3.731104374e+00,  -5.444768906e+01,  -2.752769470e+01,  -2.560389042e+00,  -8.338747025e+00,  -6.804362297e+00,  3.943393230e+00,
+      -6.517155170e+00,  -1.814569664e+01,  -8.719495773e+00,  -1.336923218e+01,  -1.250808811e+01,  3.985327959e+00,  -1.585736561e+01,  -1.375837708e+01,
+      -2.519975090e+01,  1.780364156e+00,  -2.266166306e+01,  -6.557600021e+00
+    },
+    {
+      -5.196733475e+01,  2.127835274e+00,  -8.604831696e+00,  -1.249835777e+01,  -1.304191685e+01,  2.319368362e+00,  -1.715276146e+01,  -1.481961918e+01,
+      -4.794892311e+00,  -1.600443125e+00,  -6.547189331e+01,  -3.225714874e+01,  -3.413688421e+00,  -8.678854942e+00,  -5.387897015e+00,  3.699894667e+00,
+      -6.965359211e+00,  -2.195174789e+01,  -4.452744484e+00,  -1.229289913e+01,  -1.215043831e+01,  1.811885953e+00,  -1.520683002e+01,  -1.355315781e+01,
+      -2.551384544e+01,  2.115871906e+00,  -3.034295464e+01,  -1.701354218e+01
+    },
+    {
+      -4.905340958e+01,  2.333290815e+00,  -1.823223305e+01,  -1.273924637e+01,  -6.392248154e+00,  -1.966121197e+00,  -1.864983940e+01,  -1.146540833e+01,
+      -3.521933556e+00,  -1.147116184e+00,  -5.676459885e+01,  -3.047439003e+01,  -3.650784969e+00,  -6.705104351e+00,  -7.554467678e+00,  3.380003691e+00,
+      -2.143533325e+01,  -1.799349403e+01,  -8.471652985e+00,  -1.506330681e+01,  -1.188425732e+01,  3.427083969e+00,  -1.266407013e+01,  -1.667035484e+01,
+      -3.106392288e+01,  -1.274616480e+00,  -3.872045135e+01,  -1.097303391e+01
+    },
+    {
+      -4.732855225e+01,  -6.561907291e+00,  2.293879509e+00,  -3.121358633e+00,  -2.165753365e+00,  -3.830136776e+00,  -4.339185238e+00,  -3.505954027e+00,
+      -1.143832970e+01,  -6.883711815e+00,  -3.853667068e+01,  -2.179598236e+01,  -1.434306979e+00,  2.291622400e+00,  2.103625536e+00,  -2.159408092e+00,
+      3.210164309e+00,  -1.427381039e+01,  1.659964561e+00,  -5.193046570e+00,  -4.070366859e+00,  -7.976031303e-01,  -3.489422560e+00,  -5.667371750e+00,
+      -6.619549274e+00,  -5.540869236e+00,  -1.371719933e+01,  -4.287643433e+01
+    },
+    {
+      -3.007984161e+01,  1.363213181e+00,  -8.062103271e+00,  -1.066339302e+01,  -1.074282455e+01,  1.518482208e+00,  -1.264672470e+01,  -1.381842995e+01,
+      -4.767939568e+00,  -2.519890308e+00,  -3.102733231e+01,  -2.364569283e+01,  8.857553005e-01,  -6.619905949e+00,  -5.263158321e+00,  1.459078312e+00,
+      -7.117700100e+00,  -1.781882477e+01,  2.278146267e+00,  -2.509182692e+00,  -8.705534935e+00,  1.466187358e+00,  -1.263495541e+01,  -4.790884018e+00,
+      -1.412019253e+01,  -1.806972176e-01,  -2.652363586e+01,  -1.071562481e+01
+    },
+    {
+      -1.083514252e+02,  -7.668986917e-01,  -2.692401505e+01,  -3.716492081e+01,  -1.147602177e+01,  -3.299239731e+01,  -1.455529690e+01,  -5.526848602e+01,
+      -7.419594574e+01,  -1.226471782e+00,  -1.154552994e+02,  -4.234628296e+01,  -7.515886307e+00,  1.480466485e+00,  2.415547848e+00,  -1.955695391e+00,
+      -6.468957424e+00,  -6.383978653e+01,  -2.303505182e+00,  -3.442749023e+01,  -1.445060349e+01,  1.332585144e+01,  -1.970664215e+01,  -4.796193123e+00,
+      -1.235593643e+02,  -2.060090780e+00,  -1.558430176e+02,  3.552369356e+00
+    },
+    {
+      -4.247457886e+01,  3.436851978e+00,  -1.314617062e+01,  -6.515784264e+00,  -6.421081543e+00,  4.565174103e+00,  -1.869190598e+01,  -7.912696362e+00,
+      -7.285270095e-02,  3.131071329e+00,  -5.339761353e+01,  -2.138628387e+01,  -6.483801842e+00,  -6.163320541e+00,  -7.967241764e+00,  3.140580654e+00,
+      -1.504121590e+01,  -1.214195061e+01,  -4.625677586e+00,  -1.476530933e+01,  -5.449090958e+00,  3.022270679e+00,  -1.375176048e+01,  -1.027568054e+01,
+      -3.706999207e+01,  -4.961337090e+00,  -1.040796852e+01,  -9.031271935e+00
+    },
+    {
+      -3.387139511e+01,  3.027940512e+00,  -9.110418320e+00,  1.745457292e+00,  -5.598776817e+00,  -4.445804656e-02,  -6.310028076e+00,  -5.269057274e+00,
+      2.262015790e-01,  -3.166028857e-01,  -2.793320847e+01,  -6.396321774e+00,  -3.507684231e+00,  -2.220934629e-01,  -6.620315552e+00,  1.069894075e+00,
+      8.318796158e-01,  -6.467320919e-01,  -3.353148937e+00,  -3.493063688e+00,  5.124837756e-01,  1.081446052e+00,  -8.911680222e+00,  -6.693231583e+00,
+      -2.093331146e+01,  -4.031545639e+00,  -1.809226608e+01,  -1.436328983e+01
+    },
+    {
+      -3.803410721e+01,  1.865571141e+00,  -1.820369720e+01,  -1.170205975e+01,  -1.233411217e+01,  2.558527231e+00,  -1.911608505e+01,  -1.568654442e+01,
+      1.525165677e+00,  -1.706532836e+00,  -4.682786942e+01,  -2.774367523e+01,  -3.955736637e+00,  -8.627675056e+00,  -9.374668121e+00,  2.081587791e+00,
+      -2.069913673e+01,  -1.864328575e+01,  1.478078604e+00,  -1.158397961e+01,  -7.182876110e+00,  1.873909473e+00,  -1.538762474e+01,  -7.206578255e+00,
+      -2.388708305e+01,  -2.028675556e+00,  -2.451797676e+01,  -1.078345490e+01
+    },
+    {
+      -3.509635925e+01,  -1.970511317e+00,  -4.071232319e+00,  -9.972385406e+00,  -3.141684055e+00,  -1.381585002e+00,  -8.972013474e+00,  -7.592232704e+00,
+      -7.477604389e+00,  -2.971970081e+00,  -3.373984146e+01,  -1.775136566e+01,  1.952268243e+00,  -3.034120321e+00,  2.598254681e+00,  1.684532166e-01,
+      -1.167136574e+01,  -2.238493347e+01,  -6.760265827e-01,  -9.128132820e+00,  -7.698454380e+00,  -2.319504499e+00,  -7.770848274e+00,  -1.292300510e+01,
+      -1.146827316e+01,  -6.207177639e+00,  -1.171822739e+01,  -1.783753204e+01
+    },
+    {
+      -6.524794769e+01,  5.092289448e+00,  -1.464703369e+01,  -1.119581318e+01,  -1.500249863e+01,  6.587663651e+00,  -2.188560295e+01,  -1.483572674e+01,
+      -7.823415399e-01,  4.873438358e+00,  -8.492402649e+01,  -3.188949585e+01,  -4.284159660e+00,  -1.288712502e+01,  -9.146898270e+00,  5.751507759e+00,
+      -1.787991333e+01,  -2.654258919e+01,  -6.266063690e+00,  -2.270439339e+01,  -1.107023239e+01,  2.281230211e+00,  -2.681522560e+01,  -1.833854866e+01,
+      -4.345561600e+01,  -2.557466030e+00,  -1.271072865e+01,  -1.461525440e+01
+    },
+    {
+      -4.005401993e+01,  -2.155627966e+00,  -1.237797451e+01,  -1.031354046e+01,  -8.867064476e+00,  2.257767677e+00,  -1.100916767e+01,  -9.484307289e+00,
+      6.667113304e-02,  2.748143673e+00,  -4.995379639e+01,  -2.403519630e+01,  -2.505223989e+00,  -1.213412094e+01,  -5.517243862e+00,  3.342669725e+00,
+      -1.323513794e+01,  -2.317242622e+01,  -2.374749631e-02,  -1.198050690e+01,  -9.709356308e+00,  -1.743468404e+00,  -1.380097580e+01,  -1.411975670e+01,
+      -1.949988556e+01,  -2.957992554e+00,  -1.800167274e+01,  -8.288806915e+00
+    },
+    {
+      -4.062590027e+01,  2.687383652e+00,  -1.410023022e+01,  -8.304322243e+00,  -1.040916920e+01,  2.754783332e-01,  -1.436182404e+01,  -9.577980042e+00,
+      -1.268071890e+00,  1.581923604e+00,  -4.924127579e+01,  -2.058905792e+01,  -1.427243948e+00,  -7.531186104e+00,  -9.295950890e+00,  3.306672096e+00,
+      -1.162175941e+01,  -1.059034157e+01,  -7.941422939e+00,  -1.189174747e+01,  -1.054072857e+01,  3.176198483e+00,  -1.737749672e+01,  -1.284200573e+01,
+      -2.349827194e+01,  -4.186179638e-01,  -1.947494316e+01,  -1.303604984e+01
+    },
+    {
+      -4.924287033e+01,  2.313719034e+00,  -9.542659760e+00,  -9.826873779e+00,  -1.046565151e+01,  3.218524933e+00,  -1.769843864e+01,  -1.204723549e+01,
+      -3.239230156e+00,  2.429984331e+00,  -6.074814224e+01,  -2.910140038e+01,  -5.129908085e+00,  -1.012442589e+01,  -7.217529297e+00,  3.722521305e+00,
+      -1.218595791e+01,  -1.874674225e+01,  -5.211572170e+00,  -1.596624279e+01,  -9.885573387e+00,  2.072888613e+00,  -1.769206810e+01,  -1.209180260e+01,
+      -3.024186707e+01,  -1.040823340e+00,  -1.345538235e+01,  -1.288719845e+01
+    },
+    {
+      -6.187664413e+01,  5.305252075e+00,  -1.656254196e+01,  -1.395190239e+01,  -1.535238457e+01,  6.379706383e+00,  -2.441948700e+01,  -1.607863045e+01,
+      -1.405187011e+00,  4.902531624e+00,  -7.968330383e+01,  -3.909963608e+01,  -2.944570780e+00,  -1.559638309e+01,  -1.029161930e+01,  5.740708351e+00,
+      -2.002636337e+01,  -3.078762245e+01,  -4.402698040e+00,  -2.275993156e+01,  -1.315997124e+01,  2.088383675e+00,  -2.784380531e+01,  -1.700694275e+01,
+      -4.417200089e+01,  -2.132121325e+00,  -1.501903725e+01,  -1.250863266e+01
+    },
+    {
+      -1.893280792e+01,  -7.349991202e-01,  -1.465847254e+00,  -1.744500399e+00,  -1.553562164e+00,  -9.214107394e-01,  -2.960565329e+00,  -2.526222706e+00,
+      -2.842944860e+00,  -1.493705153e+00,  -1.666544724e+01,  -7.532102585e+00,  -1.067024827e+00,  3.073850870e-01,  -2.253674269e-01,  9.473238885e-02,
+      -1.041805267e+00,  -4.564451694e+00,  -1.245058537e+00,  -3.492104053e+00,  -2.471442461e+00,  5.423042178e-01,  -2.447976112e+00,  -3.674942732e+00,
+      -4.104261398e+00,  -7.509917021e-01,  -1.138599110e+01,  -1.085969067e+01
+    }
+  },
+  // pos 1
+  {
+    {
+      -1.094762802e+01,  8.677697182e-01,  4.797158837e-01,  7.520492673e-01,  5.498809218e-01,  -3.801237047e-01,  5.594743490e-01,  -5.547247529e-01,
+      -9.349359274e-01,  -3.080131114e-01,  -2.464861155e+00,  -2.452836275e+00,  2.946034968e-01,  -3.306741714e-01,  -1.586044431e+00,  -1.828542471e+00,
+      -1.088155657e-01,  -2.554508448e+00,  4.851551056e-01,  2.828255594e-01,  -9.624893069e-01,  -1.843434453e+00,  -1.934048176e+00,  1.268044412e-01,
+      -2.787425280e+00,  -1.023637891e+00,  -1.075208902e+00,  -5.316493034e+00
+    },
+    {
+      -2.170217896e+01,  -5.081919670e+00,  6.716533303e-01,  3.904216588e-01,  6.673333645e-01,  -1.154760480e+00,  -1.885409355e-01,  2.086168528e-02,
+      -8.562849998e+00,  -1.161466718e+00,  -8.259668350e+00,  -1.868234158e+00,  -4.539620876e-01,  5.206606984e-01,  6.448370814e-01,  -3.700186968e+00,
+      -7.542284727e-01,  -1.108594537e+00,  6.829149723e-01,  4.377506077e-01,  5.136292428e-03,  4.918354750e-01,  -7.255619764e-01,  -1.734427661e-01,
+      -9.919999123e+00,  -4.491602898e+00,  -5.218678951e+00,  -2.002302551e+01
+    },
+    {
+      -2.056421661e+01,  1.729334235e+00,  -6.926531315e+00,  -7.188073635e+00,  -6.728440762e+00,  1.896157861e+00,  -9.217823029e+00,  -7.606366634e+00,
+      -3.290863276e+00,  5.841527581e-01,  -2.118527794e+01,  -1.776876831e+01,  1.114695191e+00,  -6.084508896e+00,  -5.169823170e+00,  1.374906659e+00,
+      -6.892378330e+00,  -1.313840199e+01,  1.403977990e+00,  -4.159973621e+00,  -6.546426773e+00,  1.208134413e+00,  -9.764205933e+00,  -4.690353394e+00,
+      -1.344092941e+01,  -2.046164721e-01,  -1.390152359e+01,  -5.817385197e+00
+    },
+    {
+      -1.738746452e+01,  1.621954560e+00,  -6.059090614e+00,  -5.447016716e+00,  -6.695707798e+00,  7.213966846e-01,  -7.435320854e+00,  -7.546594620e+00,
+      1.886888146e+00,  4.521576166e-01,  -1.937439919e+01,  -9.673885345e+00,  1.516091347e+00,  -8.538423538e+00,  -4.540500164e+00,  1.189165354e+00,
+      -7.773867607e+00,  -9.930530548e+00,  -1.068219781e+00,  -4.831151485e+00,  -4.724170208e+00,  8.297795057e-01,  -1.148515415e+01,  -6.328430176e+00,
+      -1.389091206e+01,  -2.194161862e-01,  -9.321049690e+00,  -5.534457684e+00
+    },
+    {
+      -2.600585747e+01,  1.821423292e+00,  -1.202711868e+01,  -5.692679882e+00,  -6.648208618e+00,  3.470752716e+00,  -1.596828461e+01,  -8.466674805e+00,
+      -4.761759758e+00,  1.163814664e-01,  -2.415667725e+01,  -1.887098503e+01,  -5.923356056e+00,  -4.096190453e+00,  -1.012546825e+01,  3.284961879e-01,
+      -8.764254570e+00,  -9.224624634e+00,  -6.229844689e-01,  -7.827544212e+00,  -4.425221920e+00,  -3.197703660e-01,  -4.992938042e+00,  -6.579636931e-01,
+      -2.207308578e+01,  -4.999877810e-01,  -1.115673828e+01,  -9.756020546e+00
+    },
+    {
+      -2.219305229e+01,  -3.191777945e+00,  1.552090943e-01,  2.987002730e-01,  -2.024672747e+00,  -2.175853968e+00,  2.311387062e-01,  -2.429675817e+00,
+      -7.488632679e+00,  -2.129858732e+00,  -6.911961079e+00,  -5.983569145e+00,  3.604755402e-01,  1.137878299e+00,  8.238418698e-01,  -3.307695866e+00,
+      -1.336585522e+00,  -7.188373566e+00,  2.341926992e-01,  -1.561409235e+00,  1.878729016e-01,  9.775082767e-02,  1.921265721e-01,  -2.489042282e+00,
+      9.982430935e-01,  -5.286889076e+00,  -1.344735527e+01,  -1.327425194e+01
+    },
+    {
+      -2.647094154e+01,  -6.333205104e-01,  -4.647523880e+00,  -6.220401287e+00,  -5.490632057e+00,  1.426845551e+00,  -4.664875031e+00,  -7.473798275e+00,
+      -4.203226566e+00,  1.873984575e+00,  -2.856604004e+01,  -1.740464592e+01,  2.672299623e+00,  -7.540183544e+00,  -3.761430979e+00,  2.502977133e+00,
+      -7.791204453e+00,  -1.773675537e+01,  2.058528900e+00,  -5.479679585e+00,  -6.871159077e+00,  -3.416175365e+00,  -9.706297874e+00,  -7.109672070e+00,
+      -1.313455296e+01,  -3.587691784e+00,  -1.332949734e+01,  -5.901978493e+00
+    },
+    {
+      -2.531991005e+01,  -2.043844938e+00,  -4.813475132e+00,  -6.632514000e+00,  -5.364684582e+00,  3.388429880e-01,  -6.335785389e+00,  -5.984216213e+00,
+      -7.216391563e-01,  -2.128618509e-01,  -2.720197487e+01,  -1.347339630e+01,  8.764415979e-01,  -4.808624268e+00,  -8.551405668e-01,  1.386091113e+00,
+      -7.203076363e+00,  -1.680010223e+01,  1.959160089e+00,  -4.977858067e+00,  -5.637743473e+00,  -8.443434238e-01,  -7.511431694e+00,  -5.632239342e+00,
+      -6.755373001e+00,  -4.013670921e+00,  -1.332544231e+01,  -8.295762062e+00
+    },
+    {
+      -4.148967743e+01,  2.691967487e+00,  -1.071953106e+01,  -6.402908325e+00,  -1.119021320e+01,  -1.351156354e+00,  -1.044083786e+01,  -1.022287083e+01,
+      -4.475599289e+00,  -1.366540909e+00,  -4.191490936e+01,  -2.027490425e+01,  -3.528026104e+00,  -9.295095444e+00,  -8.081617355e+00,  2.494447947e+00,
+      -6.112154007e+00,  -1.434662724e+01,  -4.263813019e+00,  -4.570703030e+00,  -5.969515324e+00,  -1.091544867e+00,  -1.028210545e+01,  -9.876429558e+00,
+      -2.065789795e+01,  1.149631858e+00,  -3.262959671e+01,  -1.161250591e+01
+    },
+    {
+      -4.645916748e+01,  -4.873497486e+00,  -2.433169603e+00,  -2.935880184e+00,  2.032755852e+00,  -2.385986328e+00,  -2.779743910e+00,  -2.656745195e+00,
+      -1.208738613e+01,  -5.771006107e+00,  -4.470640182e+01,  -1.170912743e+01,  -1.563844442e+00,  3.196239948e+00,  4.352036476e+00,  -1.388399959e+00,
+      -1.595242143e+00,  -1.398510456e+01,  -2.290431738e+00,  -8.208139420e+00,  -1.908111930e+00,  -2.530954838e+00,  -2.934253454e+00,  -9.961418152e+00,
+      -1.560157299e+01,  -8.318740845e+00,  -3.640633106e+00,  -3.565474701e+01
+    },
+    {
+      -3.604787445e+01,  2.198371172e+00,  -1.777832794e+01,  -8.062080383e+00,  -6.514759064e+00,  -1.906892300e+00,  -1.540233326e+01,  -8.734076500e+00,
+      -2.841289520e+00,  -1.675804853e+00,  -3.519958115e+01,  -2.363619041e+01,  -3.086690664e+00,  -5.116342545e+00,  -9.663123131e+00,  2.317847490e+00,
+      -1.557771778e+01,  -1.162042332e+01,  -5.251999855e+00,  -6.838391304e+00,  -7.069579601e+00,  2.386065483e+00,  -8.644798279e+00,  -1.118228531e+01,
+      -2.126523590e+01,  -1.956165552e+00,  -3.845328140e+01,  -9.812759399e+00
+    },
+    {
+      -6.393500137e+01,  -4.945914745e+00,  -2.079652214e+01,  -1.039628696e+01,  -1.712968445e+01,  1.181357861e+00,  -1.962760544e+01,  -1.501470661e+01,
+      -5.405529022e+00,  7.122835159e+00,  -7.299153137e+01,  -3.969231415e+01,  -4.833993435e+00,  -3.176169777e+01,  -1.204859257e+01,  2.114115953e+00,
+      -1.787182426e+01,  -2.628391266e+01,  -5.544888973e+00,  -1.639706612e+01,  -1.396295834e+01,  -1.654317021e+00,  -2.693906975e+01,  -2.223998833e+01,
+      -4.129418182e+01,  -6.232163429e+00,  -2.335913849e+01,  -8.044092178e+00
+    },
+    {
+      -3.492538452e+01,  1.378539562e+00,  -6.783984661e+00,  -6.354188442e+00,  -6.134734154e+00,  -7.071876526e-01,  -7.943410873e+00,  -6.681744576e+00,
+      -3.682981968e+00,  3.103868723e+00,  -4.357276154e+01,  -2.145489120e+01,  -1.789382935e+00,  -7.109782696e+00,  -6.033932686e+00,  3.229319811e+00,
+      -4.434956074e+00,  -1.339771748e+01,  -6.760860920e+00,  -1.002705193e+01,  -9.387362480e+00,  3.208524227e+00,  -1.359657001e+01,  -1.097766972e+01,
+      -1.991685104e+01,  1.290166378e+00,  -1.733075523e+01,  -5.194169521e+00
+    },
+    {
+      -3.750489426e+01,  1.450136900e+00,  -5.040744781e+00,  -7.636439323e+00,  -8.865335464e+00,  1.533785105e+00,  -1.125485229e+01,  -9.234305382e+00,
+      -3.549413681e+00,  -1.681093216e+00,  -4.672414017e+01,  -2.152764511e+01,  -3.223639011e+00,  -5.343595028e+00,  -3.583349943e+00,  2.606029749e+00,
+      -3.112069845e+00,  -1.397039032e+01,  -3.549170732e+00,  -7.446081161e+00,  -7.510497570e+00,  9.958411455e-01,  -9.346540451e+00,  -9.718694687e+00,
+      -1.694035149e+01,  1.452178359e+00,  -2.234505844e+01,  -1.428613281e+01
+    },
+    {
+      -3.542395401e+01,  1.832889199e+00,  -1.374339581e+01,  -7.799826145e+00,  -3.776640892e+00,  -2.071949720e+00,  -1.227312756e+01,  -7.007861137e+00,
+      -2.322276592e+00,  -7.907398343e-01,  -3.980982208e+01,  -2.019301987e+01,  -2.966964722e+00,  -4.153287888e+00,  -5.309735775e+00,  2.444591284e+00,
+      -1.590302181e+01,  -1.208345127e+01,  -6.615590096e+00,  -9.727550507e+00,  -7.164143085e+00,  2.528022289e+00,  -7.686544895e+00,  -1.206304359e+01,
+      -2.446344948e+01,  -2.162501574e+00,  -2.872135544e+01,  -7.735084534e+00
+    },
+    {
+      -3.506158829e+01,  -4.876879215e+00,  1.641520977e+00,  -2.431456089e+00,  -1.828616619e+00,  -2.874931335e+00,  -3.284190893e+00,  -2.662396431e+00,
+      -8.031873703e+00,  -5.299648762e+00,  -2.813589478e+01,  -1.646242714e+01,  -8.455760479e-01,  1.636700749e+00,  1.541382074e+00,  -1.541661620e+00,
+      2.441800594e+00,  -1.105664730e+01,  1.513503313e+00,  -3.541286707e+00,  -3.010601521e+00,  -6.035827398e-01,  -2.542108536e+00,  -4.096525192e+00,
+      -4.507359505e+00,  -4.262233734e+00,  -1.040781975e+01,  -3.124863625e+01
+    },
+    {
+      -2.449721718e+01,  9.559567571e-01,  -6.185291290e+00,  -6.723232269e+00,  -7.702085018e+00,  1.094946384e+00,  -8.644613266e+00,  -8.743000984e+00,
+      -3.587599993e+00,  -2.052778959e+00,  -2.045253181e+01,  -1.547285748e+01,  2.130064070e-01,  -4.136922359e+00,  -4.839991570e+00,  7.287194729e-01,
+      -3.996464491e+00,  -1.143091774e+01,  1.780699372e+00,  -2.797315121e-01,  -5.252999306e+00,  9.654401541e-01,  -9.532904625e+00,  -3.711203098e+00,
+      -1.005283165e+01,  -3.549412489e-01,  -1.843357468e+01,  -1.338186741e+01
+    },
+    {
+      -1.283902283e+02,  -7.929817438e-01,  -3.309244156e+01,  -4.648941422e+01,  -1.584488106e+01,  -3.636613083e+01,  -1.756991005e+01,  -6.102531815e+01,
+      -8.629389191e+01,  -1.011929035e+00,  -1.346481628e+02,  -5.272170258e+01,  -9.819389343e+00,  8.777601719e-01,  2.549491405e+00,  -2.327638566e-01,
+      -1.023790169e+01,  -8.153684998e+01,  -3.955871344e+00,  -4.374146271e+01,  -1.837722015e+01,  1.628970909e+01,  -2.872117996e+01,  -7.483542442e+00,
+      -1.445322266e+02,  -2.567114115e+00,  -1.891408844e+02,  2.636333704e+00
+    },
+    {
+      -3.231083298e+01,  2.811824799e+00,  -1.028088951e+01,  -3.433269262e+00,  -3.730988264e+00,  3.635624886e+00,  -1.310654449e+01,  -4.514019489e+00,
+      -2.861630917e-01,  2.503129959e+00,  -3.986928940e+01,  -1.348805523e+01,  -5.134922028e+00,  -3.597851753e+00,  -6.414043903e+00,  2.440291882e+00,
+      -1.042312050e+01,  -8.281908989e+00,  -3.154115915e+00,  -9.887475967e+00,  -2.674232483e+00,  2.347628355e+00,  -9.516615868e+00,  -7.099712372e+00,
+      -2.838477898e+01,  -4.635336399e+00,  -9.152014732e+00,  -6.598499298e+00
+    },
+    {
+      -2.975577736e+01,  2.659615993e+00,  -7.867369175e+00,  1.551656723e+00,  -4.836908340e+00,  -2.281801850e-01,  -5.192138195e+00,  -4.739179134e+00,
+      2.969097495e-01,  -4.768696129e-01,  -2.239819336e+01,  -5.424474239e+00,  -2.813528538e+00,  -1.542017758e-01,  -5.936739445e+00,  5.663318634e-01,
+      8.483541608e-01,  -6.035416722e-01,  -2.855378866e+00,  -2.137963295e+00,  5.805126429e-01,  7.338848710e-01,  -7.553953171e+00,  -5.988560677e+00,
+      -1.806098175e+01,  -3.363822222e+00,  -1.596749496e+01,  -1.423634148e+01
+    },
+    {
+      -2.860076141e+01,  1.470570207e+00,  -1.538029385e+01,  -7.486611366e+00,  -8.590230942e+00,  2.145473480e+00,  -1.340106964e+01,  -1.078161144e+01,
+      1.350960135e+00,  -1.533837438e+00,  -3.529352951e+01,  -1.787596893e+01,  -4.481141090e+00,  -5.622926235e+00,  -7.392874241e+00,  1.611781359e+00,
+      -1.584854317e+01,  -1.268092728e+01,  1.249834538e+00,  -6.975493908e+00,  -3.399255037e+00,  1.206188917e+00,  -1.044624805e+01,  -6.246200562e+00,
+      -2.042507362e+01,  -3.609127283e+00,  -2.005474854e+01,  -8.157992363e+00
+    },
+    {
+      -2.570261383e+01,  -2.479089499e+00,  -2.529295683e+00,  -5.117956638e+00,  -2.315591574e+00,  -1.780423522e+00,  -4.586433411e+00,  -3.843362331e+00,
+      -9.033816338e+00,  -2.479066372e+00,  -1.887422943e+01,  -1.010571098e+01,  2.044845581e+00,  -1.264925361e+00,  2.122981787e+00,  -2.006051064e+00,
+      -6.975692272e+00,  -1.400045204e+01,  6.012010574e-01,  -3.502575874e+00,  -2.922145605e+00,  -2.804132700e+00,  -3.641865730e+00,  -8.507333755e+00,
+      -5.170914173e+00,  -6.233977795e+00,  -6.643623829e+00,  -1.596602249e+01
+    },
+    {
+      -5.193722153e+01,  3.687232494e+00,  -1.122301865e+01,  -5.306855202e+00,  -1.100493813e+01,  5.259731770e+00,  -1.406782150e+01,  -9.259995461e+00,
+      -6.860880256e-01,  4.193120003e+00,  -6.532686615e+01,  -1.719412231e+01,  -4.081496716e+00,  -7.903228760e+00,  -8.353590965e+00,  4.713460922e+00,
+      -1.091243553e+01,  -1.613986778e+01,  -5.501717091e+00,  -1.756657410e+01,  -5.515509605e+00,  2.394450426e+00,  -2.082013321e+01,  -1.353865528e+01,
+      -3.409386444e+01,  -3.851039886e+00,  -8.001052856e+00,  -1.150028515e+01
+    },
+    {
+      -2.527663422e+01,  -2.092378378e+00,  -1.118775368e+01,  -4.933121681e+00,  -7.247389793e+00,  2.144854546e+00,  -5.918898582e+00,  -5.514638424e+00,
+      1.353577852e+00,  2.634386063e+00,  -3.048257256e+01,  -1.282837296e+01,  -2.489203691e+00,  -8.728346825e+00,  -4.580785275e+00,  2.092750311e+00,
+      -1.032514381e+01,  -1.390409946e+01,  1.401680231e+00,  -6.011010647e+00,  -4.359016418e+00,  -3.008070707e+00,  -9.761341095e+00,  -1.193554497e+01,
+      -1.400023937e+01,  -3.446606636e+00,  -6.363460541e+00,  -4.293560505e+00
+    },
+    {
+      -2.817140770e+01,  2.601095438e+00,  -1.478422737e+01,  -2.052085161e+00,  -5.067121983e+00,  -1.434110165e+00,  -7.244165897e+00,  -9.298878670e+00,
+      -6.942454815e+00,  4.628868103e-01,  -3.192535210e+01,  -8.634428978e+00,  -1.672665000e+00,  -2.375344515e+00,  -7.826266289e+00,  3.571172357e-01,
+      -5.586571217e+00,  1.078917742e+00,  -5.042910576e+00,  -3.699949265e+00,  -4.098045826e+00,  2.590741873e+00,  -1.002777100e+01,  -6.292796135e+00,
+      -2.402975655e+01,  -1.635620594e+00,  -2.071999550e+01,  -1.246738148e+01
+    },
+    {
+      -3.411109924e+01,  1.004325271e+00,  -6.172790527e+00,  -4.623965740e+00,  -7.187415600e+00,  2.088884115e+00,  -1.122737408e+01,  -6.882894993e+00,
+      -4.162152767e+00,  8.116681576e-01,  -3.907269287e+01,  -1.748683739e+01,  -4.956423283e+00,  -5.929691792e+00,  -5.084700108e+00,  2.392626524e+00,
+      -8.144478798e+00,  -1.091678810e+01,  -2.809990168e+00,  -9.401102066e+00,  -4.375351429e+00,  9.376154542e-01,  -1.070878506e+01,  -6.829695225e+00,
+      -2.026822662e+01,  -3.780525923e+00,  -7.288959980e+00,  -1.054667854e+01
+    },
+    {
+      -4.636158371e+01,  4.157684803e+00,  -1.341468430e+01,  -9.060516357e+00,  -1.074470043e+01,  4.855712891e+00,  -1.696282959e+01,  -1.086965370e+01,
+      -8.620778322e-01,  3.697585106e+00,  -5.682263565e+01,  -2.593183708e+01,  -2.071581602e+00,  -1.109609509e+01,  -8.164732933e+00,  4.326065063e+00,
+      -1.505128574e+01,  -2.165521431e+01,  -3.011259079e+00,  -1.623021507e+01,  -8.790990829e+00,  1.682307005e+00,  -2.153606224e+01,  -1.209657574e+01,
+      -3.408883667e+01,  -2.967322588e+00,  -8.879124641e+00,  -9.902542114e+00
+    },
+    {
+      -8.816497803e+00,  -6.747121215e-01,  -2.283700109e-01,  -1.768293530e-01,  -4.431709349e-01,  -4.639782906e-01,  -6.989223957e-01,  -4.981715679e-01,
+      -1.279622912e+00,  -7.646107674e-01,  -5.992492676e+00,  -2.700540781e+00,  -2.709369659e-01,  3.341790736e-01,  1.655263007e-01,  -4.091892838e-01,
+      -2.486742847e-02,  -2.098429680e+00,  3.982321322e-01,  -5.532577634e-01,  -2.966968715e-01,  1.406981051e-01,  -5.077376962e-01,  -8.135338426e-01,
+      -1.494230151e+00,  -1.027829885e+00,  -4.205041885e+00,  -6.259062767e+00
+    }
+  },
+  // pos 2
+  {
+    {
+      -6.062142372e+00,  4.792931080e-01,  -4.017755985e-01,  -4.787804186e-02,  9.663183242e-03,  2.460825443e-01,  -6.489967555e-02,  -1.603414059e+00,
+      -4.821611941e-01,  3.962990642e-01,  -3.906980753e+00,  -1.752740502e+00,  5.091646910e-01,  -1.043174982e+00,  -7.950861454e-01,  -1.281608641e-01,
+      -2.276083976e-01,  -4.201015949e+00,  2.321195900e-01,  -3.035799265e-01,  -3.726471961e-01,  -9.591175914e-01,  -2.759809256e+00,  -1.596087813e+00,
+      -3.360468149e+00,  -6.025603414e-01,  -1.936894178e+00,  -1.602702402e-02
+    },
+    {
+      -1.871390152e+01,  -6.140191078e+00,  -8.064593077e-01,  -5.981763005e-01,  -7.106480002e-02,  -4.749714851e+00,  -1.599722028e+00,  -3.631939292e-01,
+      -8.800142288e+00,  -1.253121644e-01,  -1.441937566e+00,  -1.472222090e+00,  1.247574687e+00,  -2.687534988e-01,  8.446214199e-01,  -4.140731335e+00,
+      6.685350537e-01,  -4.332574368e+00,  1.505553961e+00,  3.851220757e-02,  8.674547672e-01,  5.432596803e-01,  4.983343184e-01,  -7.623225451e-01,
+      -4.972438812e+00,  -4.936256886e+00,  -2.837556899e-01,  -1.130759430e+01
+    },
+    {
+      -1.996526718e+01,  -1.393090129e+00,  -5.009993076e+00,  -6.418488503e+00,  -1.017117310e+01,  -1.071390390e+00,  -1.042549515e+01,  -8.188390732e+00,
+      7.855296135e-01,  -1.026097536e+00,  -1.585237694e+01,  -2.148666382e+01,  -7.492228746e-01,  -6.905769825e+00,  -5.331066608e+00,  8.734829426e-01,
+      -8.099838257e+00,  -9.807678223e+00,  6.970681548e-01,  2.558085680e+00,  -7.614613056e+00,  1.433464527e+00,  -9.739748001e+00,  -2.632645369e+00,
+      -9.757855415e+00,  1.456823230e+00,  -1.183684540e+01,  -1.119957924e+01
+    },
+    {
+      -2.148638725e+01,  9.988528490e-01,  -7.361422539e+00,  1.408957124e+00,  -5.532477856e+00,  2.008195400e+00,  -5.499469757e+00,  -6.628809452e+00,
+      1.997897327e-01,  -1.814698577e+00,  -1.924520874e+01,  -4.236982346e+00,  -2.335361481e+00,  -5.005986214e+00,  -6.527746201e+00,  8.891167641e-01,
+      -6.976030827e+00,  2.590872943e-01,  1.578416377e-01,  1.672006696e-01,  8.011856079e-01,  -1.659361720e+00,  -9.746988297e+00,  -9.339189529e+00,
+      -2.296662331e+01,  -8.133985519e+00,  -1.636955643e+01,  -1.361110687e+01
+    },
+    {
+      -2.477445984e+01,  1.448682427e+00,  -7.392588139e+00,  -5.384744167e+00,  -1.885704398e+00,  2.181872129e-01,  -1.193145943e+01,  -5.823359489e+00,
+      -9.505800247e+00,  -1.487836480e+00,  -2.002227783e+01,  -1.514788628e+01,  -6.055845261e+00,  9.703378677e-01,  -6.424872875e+00,  1.006797105e-01,
+      -6.250546455e+00,  -1.311818409e+01,  -3.759708405e-01,  -5.568282127e+00,  -4.024248123e+00,  2.180105075e-02,  -3.476589918e-04,  -3.205661058e+00,
+      -2.433647346e+01,  -1.918331236e-01,  -1.982284737e+01,  -5.780274868e+00
+    },
+    {
+      -1.852990341e+01,  1.054165244e+00,  -1.693801165e+00,  3.612197638e-01,  -9.420124888e-01,  -6.156287193e-01,  3.272953928e-01,  -9.113489389e-01,
+      -6.026338577e+00,  -1.330602646e+00,  -1.871025085e+00,  -8.406389236e+00,  5.951800346e-01,  -3.617624640e-01,  4.716662169e-01,  -4.898406506e+00,
+      -3.947719932e-01,  -7.703980923e+00,  5.137960911e-01,  1.023673534e+00,  -8.376640677e-01,  -4.927831173e+00,  -3.681303859e-01,  -1.294652939e+00,
+      -4.163571358e+00,  -6.135655403e+00,  -7.259089470e+00,  -6.236909389e+00
+    },
+    {
+      -3.181312943e+01,  -8.809663057e-01,  -3.563986063e+00,  -1.614475489e+00,  -3.980476379e+00,  4.603112638e-01,  5.328717232e+00,  -5.394895077e+00,
+      -6.543174267e+00,  7.561805844e-01,  -2.179224014e+01,  -6.381346226e+00,  3.439226866e+00,  -3.481103659e+00,  -2.905722380e+00,  6.157132983e-01,
+      -5.503908634e+00,  -1.209914780e+01,  2.609743476e-01,  -3.948942423e+00,  -5.101411939e-01,  -3.227078319e-01,  -5.901423454e+00,  -3.102972507e+00,
+      -1.836484909e+01,  -4.983437061e+00,  -1.168533993e+01,  -1.187769508e+01
+    },
+    {
+      -2.093998528e+01,  1.420760989e+00,  -5.718731880e+00,  -5.138160706e+00,  -3.985085011e+00,  1.618565917e+00,  -4.624258518e+00,  -2.593662977e+00,
+      -1.156609416e+00,  1.342539072e+00,  -2.241266251e+01,  -1.045073700e+01,  1.597030044e+00,  -6.581642151e+00,  -3.089492321e+00,  1.525897503e+00,
+      -6.103893280e+00,  -1.562906742e+01,  1.444441676e+00,  -5.233794689e+00,  -3.272778988e+00,  -5.251439214e-01,  -7.555974960e+00,  -4.712846756e+00,
+      -1.035348225e+01,  -3.763392687e+00,  -5.971021652e+00,  -4.593533039e+00
+    },
+    {
+      -2.889635849e+01,  3.003053904e+00,  -8.908083916e+00,  -2.598668814e+00,  -4.171755791e+00,  2.047432184e+00,  -3.644356012e+00,  -3.658309937e+00,
+      -2.922131062e+00,  2.536822557e+00,  -2.585818291e+01,  -8.578723907e+00,  -2.700173855e+00,  -6.930112362e+00,  -6.919950962e+00,  1.653909206e+00,
+      -4.104694366e+00,  -1.268742943e+01,  1.097394943e+00,  -5.027089119e+00,  6.860833168e-01,  4.410877526e-01,  -7.837462902e+00,  -4.606445312e+00,
+      -2.248447037e+01,  -3.529952526e+00,  -9.355267525e+00,  -3.725982428e+00
+    },
+    {
+      -1.609009552e+01,  -1.256024837e+00,  -7.046134472e-01,  -3.045141995e-01,  -1.044486523e+00,  -1.262531161e+00,  -3.466860950e-01,  6.232123971e-01,
+      -6.706965446e+00,  -5.337126732e+00,  -1.336570740e+01,  -6.606395721e+00,  5.591005683e-01,  -5.963677168e-01,  1.335825562e+00,  -6.842430830e-01,
+      -2.755185962e-02,  -6.587889194e+00,  5.251867771e-01,  7.419518232e-01,  6.582734585e-01,  -5.634562969e+00,  3.000680506e-01,  -3.829718113e+00,
+      -6.827369690e+00,  -9.288887978e+00,  2.101018429e-01,  -1.583795738e+01
+    },
+    {
+      -2.667737770e+01,  1.943717360e+00,  -1.924349022e+01,  -6.793026447e+00,  -1.796579361e+00,  3.218608856e+00,  -1.750605202e+01,  -5.913257122e+00,
+      -3.090892553e+00,  -2.428250760e-01,  -2.375326157e+01,  -1.813817596e+01,  -5.494603634e+00,  -3.110846281e+00,  -1.110934067e+01,  1.089870334e+00,
+      -1.072368050e+01,  -9.569664955e+00,  -3.042265415e+00,  -7.365319252e+00,  -2.390200138e+00,  1.137585878e+00,  -5.608604908e+00,  -6.768348694e+00,
+      -2.721451950e+01,  -1.180032253e+00,  -1.616571999e+01,  -7.522121429e+00
+    },
+    {
+      -5.041507721e+01,  -4.425964832e+00,  -1.921655273e+01,  -6.733558178e+00,  -1.410771561e+01,  1.775563955e+00,  -1.586731243e+01,  -1.183909702e+01,
+      -4.337420940e+00,  5.367256641e+00,  -5.867739487e+01,  -2.868497658e+01,  -5.134408951e+00,  -2.661079407e+01,  -1.028544617e+01,  5.835826993e-01,
+      -1.209415245e+01,  -1.591152096e+01,  -4.086586475e+00,  -1.014675999e+01,  -9.495107651e+00,  -2.817066193e+00,  -2.230194473e+01,  -1.840078163e+01,
+      -3.522014618e+01,  -4.987751484e+00,  -1.581629467e+01,  -5.684939861e+00
+    },
+    {
+      -2.690670586e+01,  2.889317513e+00,  -5.703358173e+00,  -1.626031101e-01,  -3.116646767e+00,  2.553529978e+00,  -3.827090263e+00,  -4.797448635e+00,
+      -4.129301071e+00,  2.399000168e+00,  -3.056372452e+01,  -7.745848179e+00,  -1.740809232e-01,  -3.064566135e+00,  -5.063486576e+00,  2.617052794e+00,
+      -2.233942598e-01,  -7.344816685e+00,  -4.432276249e+00,  -4.331419945e+00,  -2.796693802e+00,  2.041899443e+00,  -1.253228951e+01,  -6.893318653e+00,
+      -2.181193924e+01,  -2.751178026e+00,  -1.026205063e+01,  -4.640427113e+00
+    },
+    {
+      -3.270755386e+01,  9.508991241e-01,  1.799528956e+00,  -3.138592958e+00,  -4.518657684e+00,  -3.719213605e-01,  -7.040781021e+00,  -4.935122490e+00,
+      -4.817380905e+00,  2.189779282e+00,  -4.157947922e+01,  -1.053971100e+01,  -3.104525328e+00,  -1.216919780e+00,  8.257716894e-01,  2.561784983e+00,
+      3.194736481e+00,  -1.730802917e+01,  -3.716163635e+00,  -4.443526268e+00,  -3.582288980e+00,  -7.606148124e-01,  -5.094980240e+00,  -8.377865791e+00,
+      -1.219633198e+01,  -3.006285191e+00,  -1.508372974e+01,  -5.250899315e+00
+    },
+    {
+      -2.027943993e+01,  9.928192496e-01,  -6.500810623e+00,  9.296073914e-01,  4.223837554e-01,  -2.655081987e+00,  1.945950091e-01,  6.653279066e-01,
+      -5.129155517e-01,  1.973863691e-01,  -1.607909203e+01,  -4.122855663e+00,  -6.844242215e-01,  -2.828260183e+00,  -7.354213595e-01,  3.308713734e-01,
+      -6.234716415e+00,  -5.244354725e+00,  -3.694390297e+00,  1.739193201e-01,  1.578821778e+00,  -4.208331108e+00,  9.421029687e-01,  -6.951201439e+00,
+      -1.893696785e+01,  -4.014123917e+00,  -1.149570084e+01,  -5.860756397e+00
+    },
+    {
+      -1.394309044e+01,  -9.192633033e-01,  -2.009061098e+00,  -1.992201328e+00,  -1.401540518e+00,  -1.054791093e+00,  -1.335929155e+00,  -1.375500202e+00,
+      -1.035575509e+00,  -2.051300049e+00,  -1.345935631e+01,  -6.471735001e+00,  2.585571110e-01,  -8.931358904e-02,  1.513143629e-01,  7.871137559e-02,
+      -9.303203225e-01,  -7.668617249e+00,  1.214046597e+00,  -1.101796269e+00,  -1.093831420e+00,  2.276065201e-02,  -5.344265103e-01,  -9.927777648e-01,
+      -1.494320393e+00,  -1.405712247e+00,  -7.512725353e+00,  -8.975637436e+00
+    },
+    {
+      -2.046152687e+01,  -5.078347921e-01,  -4.715293884e+00,  -2.308192492e+00,  -3.304868221e+00,  1.862861872e+00,  -4.743409634e+00,  -3.725744724e+00,
+      -1.442260623e+00,  1.313979983e+00,  -1.460855389e+01,  -4.829866409e+00,  -1.307031959e-01,  -1.680126548e+00,  -4.347060204e+00,  1.306884766e+00,
+      2.383215427e+00,  -1.035387993e+01,  -3.483826816e-01,  -9.713959694e-01,  1.637994409e+00,  1.415389895e+00,  -8.731198311e+00,  -4.095824242e+00,
+      -1.178958416e+01,  -1.154281020e+00,  -1.060820198e+01,  -6.337728024e+00
+    },
+    {
+      -1.376787720e+02,  -9.059497714e-01,  -3.692680359e+01,  -5.068459320e+01,  -1.763797379e+01,  -3.757808685e+01,  -1.866196632e+01,  -6.247470856e+01,
+      -9.160642242e+01,  -1.220478296e+00,  -1.448691864e+02,  -5.758973312e+01,  -1.091134453e+01,  6.341761351e-01,  2.135142088e+00,  9.763830900e-01,
+      -1.291663647e+01,  -8.927467346e+01,  -5.162539959e+00,  -4.748575974e+01,  -2.003700829e+01,  1.753855896e+01,  -3.308543015e+01,  -9.655241013e+00,
+      -1.524931488e+02,  -2.288553476e+00,  -2.040533905e+02,  1.943765163e+00
+    },
+    {
+      -2.643695259e+01,  2.514415026e+00,  -4.618865490e+00,  9.994565248e-01,  2.079235911e-01,  2.034127951e+00,  -4.965198040e+00,  2.066873014e-01,
+      -4.436497211e+00,  2.223297596e+00,  -2.845498848e+01,  -2.900596619e+00,  -2.946961164e+00,  2.024972439e-01,  -4.021541119e+00,  2.365272999e+00,
+      -4.772276878e+00,  -6.543985844e+00,  -1.189547420e+00,  -2.871220350e+00,  1.558714360e-01,  1.080787539e+00,  -3.823067188e+00,  -4.373729229e+00,
+      -2.478787422e+01,  -3.741541386e+00,  -9.264455795e+00,  -5.775807381e+00
+    },
+    {
+      -3.023094177e+01,  -2.126344681e+00,  -7.165882587e+00,  7.269107103e-01,  -6.178699493e+00,  -1.580532074e+00,  -5.221963882e+00,  -5.271935463e+00,
+      8.131120205e-01,  -8.366541862e-01,  -1.541023254e+01,  -6.599417686e+00,  -1.667700171e+00,  -1.244422197e+00,  -5.911332607e+00,  -1.734343529e+00,
+      1.590734124e+00,  -4.300769329e+00,  -3.649847507e+00,  1.447508574e+00,  1.434562683e+00,  6.955880523e-01,  -6.913216591e+00,  -6.071533203e+00,
+      -1.377990437e+01,  7.519838810e-01,  -1.950695992e+01,  -1.312758636e+01
+    },
+    {
+      -2.359456635e+01,  1.166902423e+00,  -1.140903664e+01,  -2.474475145e+00,  -6.022957325e+00,  7.018646002e-01,  -5.804929733e+00,  -6.673416615e+00,
+      1.158461690e+00,  -1.459179640e+00,  -2.840204430e+01,  -9.115820885e+00,  -4.112868309e+00,  -4.260035992e+00,  -5.525650978e+00,  1.869349122e+00,
+      -1.077166271e+01,  -8.161705971e+00,  1.057240725e+00,  -2.991802931e+00,  5.171843767e-01,  -1.746515512e+00,  -6.665940285e+00,  -7.556595802e+00,
+      -1.863840485e+01,  -6.142024517e+00,  -1.549010277e+01,  -7.518372536e+00
+    },
+    {
+      -1.782321548e+01,  -1.323783517e+00,  -1.398483217e-01,  -7.870630920e-02,  -1.228560925e+00,  -5.328560352e+00,  -4.847930908e+00,  -3.667283058e-01,
+      -8.713490486e+00,  4.057402164e-02,  -8.304268837e+00,  -8.687264442e+00,  1.279653758e-01,  -6.104300171e-02,  -1.198773086e-01,  -8.457364082e+00,
+      -6.083371043e-01,  -9.592916489e+00,  1.149168491e+00,  7.884492278e-01,  8.264699578e-01,  -7.758638382e+00,  -5.573781013e+00,  -6.192675114e+00,
+      -7.891475558e-01,  -8.748629570e+00,  -9.206000328e+00,  -1.025929928e+01
+    },
+    {
+      -4.332390976e+01,  1.372713566e+00,  -5.234566689e+00,  -9.926932454e-01,  -6.598867416e+00,  1.980932474e+00,  -7.762735844e+00,  -4.747570038e+00,
+      -2.761178970e+00,  4.026874542e+00,  -4.205926132e+01,  -7.899421692e+00,  -3.253916264e+00,  -2.743719578e+00,  -7.794572353e+00,  3.165403605e+00,
+      -2.098997831e+00,  -1.119119644e+01,  -3.732512236e+00,  -1.020492935e+01,  -1.768697023e+00,  2.911604404e+00,  -1.396613789e+01,  -8.068335533e+00,
+      -2.631433296e+01,  -6.799107552e+00,  -4.084980488e+00,  -6.959285736e+00
+    },
+    {
+      -3.249601746e+01,  2.755982876e+00,  -7.289490700e+00,  -3.255457878e+00,  -3.785134315e+00,  3.013392687e+00,  -4.545532703e+00,  -8.590199471e+00,
+      -6.189118862e+00,  -5.708651543e-01,  -4.054737854e+01,  -1.196909904e+01,  -1.216182947e+00,  -1.238497829e+01,  -6.411644220e-01,  -1.016783953e+00,
+      -8.446492195e+00,  -1.847891617e+01,  -1.525723457e+00,  -2.811832428e+00,  -3.230555534e+00,  -7.408607483e+00,  -8.239394188e+00,  -1.371877956e+01,
+      -2.393229294e+01,  -7.786519051e+00,  -6.833932877e+00,  -9.509878755e-01
+    },
+    {
+      -3.161234093e+01,  3.036177397e+00,  -1.680345726e+01,  -1.155648947e+00,  -3.745954514e+00,  -1.796729088e+00,  -6.677814007e+00,  -1.121930695e+01,
+      -1.217219257e+01,  2.545570135e-01,  -3.564122009e+01,  -7.178247929e+00,  -2.896676779e+00,  -1.337740421e+00,  -8.025092125e+00,  -8.867046833e-01,
+      -3.418358088e+00,  3.159053087e+00,  -3.988636494e+00,  -2.736990452e+00,  -2.757920742e+00,  2.883003473e+00,  -9.047045708e+00,  -4.842758179e+00,
+      -3.232806396e+01,  -1.603484988e+00,  -3.095739746e+01,  -1.589042282e+01
+    },
+    {
+      -3.348917389e+01,  -2.024843931e+00,  2.011451423e-01,  1.391396642e+00,  -3.471809387e+00,  -3.843695641e+00,  -3.621366024e+00,  -4.892699122e-01,
+      -1.295922089e+01,  -5.375939369e+00,  -2.153993034e+01,  -1.278705025e+01,  -2.055142879e+00,  -4.668108940e+00,  -4.113740623e-01,  -2.739190578e+00,
+      -4.172214508e+00,  -7.474247932e+00,  1.487147450e+00,  4.018299878e-01,  1.116099834e+00,  -6.387616634e+00,  -4.444877148e+00,  -8.248087883e+00,
+      -1.008867550e+01,  -1.236212921e+01,  5.020313859e-01,  -2.396224976e+01
+    },
+    {
+      -4.330153656e+01,  1.251678228e+00,  -1.104545879e+01,  -4.451764584e+00,  -8.015497208e+00,  8.774963021e-01,  -1.460285568e+01,  -6.689040184e+00,
+      -1.464830160e+00,  7.368948460e-01,  -2.650223541e+01,  -1.761648941e+01,  -1.293004394e+00,  -9.530458450e+00,  -1.178073597e+01,  1.071104407e-02,
+      -7.400804996e+00,  -9.222409248e+00,  -3.104758501e+00,  -6.053816795e+00,  -6.508111000e+00,  3.405087233e+00,  -1.764855957e+01,  -7.264735699e+00,
+      -2.519079590e+01,  -4.641048431e+00,  -5.101631582e-02,  -1.745946693e+01
+    },
+    {
+      -7.837864399e+00,  1.975256205e-01,  -5.434731841e-01,  -2.002550513e-01,  1.724270731e-01,  -2.285473943e-01,  -9.620017409e-01,  -1.729940176e+00,
+      -1.873469591e+00,  3.532024622e-01,  -4.743720531e+00,  -8.256787062e-01,  1.033838093e-01,  -1.512115449e-01,  -7.846333385e-01,  8.027850091e-02,
+      -2.967801690e-01,  -3.259059429e+00,  -7.581979036e-03,  2.397622466e-01,  2.584738135e-01,  -3.297401071e-01,  -2.127036333e+00,  -7.560217381e-01,
+      -4.690552711e+00,  -7.734892368e-01,  -2.836428165e+00,  -2.726530790e+00
+    }
+  },
+  // pos 3
+  {
+    {
+      -5.034922600e+00,  1.077780500e-01,  -7.463981509e-01,  -7.412855625e-01,  -1.530470550e-01,  3.436537683e-01,  -4.096137583e-01,  -1.111954689e+00,
+      -1.038324952e+00,  4.601614475e-01,  -4.892382145e+00,  -2.480470181e+00,  -1.068537980e-01,  -1.934247613e+00,  -1.412940174e-01,  -3.425687253e-01,
+      -8.748062253e-01,  -5.140676975e+00,  3.688466549e-01,  -3.486741185e-01,  -5.538216233e-01,  -7.875180244e-01,  -1.672891259e+00,  -1.497582793e+00,
+      -4.478535652e+00,  -2.451941967e-01,  -2.436228514e+00,  1.047166213e-01
+    },
+    {
+      -1.393715000e+01,  -4.027800083e+00,  -1.546838522e+00,  5.683829077e-04,  -4.819149077e-01,  -3.053409815e+00,  -1.619727254e+00,  7.599149644e-02,
+      -7.404638767e+00,  -7.198092937e-01,  -7.023758411e+00,  -9.463520050e-01,  2.478589863e-01,  2.222536504e-01,  6.786777973e-01,  -1.941823483e+00,
+      -1.120394170e-01,  -8.438364029e+00,  1.035037756e+00,  8.371623755e-01,  8.181370497e-01,  -1.177690387e+00,  -1.555908918e-01,  -1.838272929e+00,
+      -9.629731178e-01,  -1.539602160e+00,  -1.009944916e+00,  -5.899512291e+00
+    },
+    {
+      -2.517930984e+01,  2.115081847e-01,  4.101704359e-01,  -7.402446270e+00,  -1.080376530e+01,  -2.571471453e+00,  -1.067251968e+01,  -9.414006233e+00,
+      -3.363498688e+00,  1.266289115e+00,  -1.852573586e+01,  -2.202541351e+01,  1.045411110e+00,  -1.024594879e+01,  -4.602366924e+00,  1.071245432e+00,
+      -8.825363159e+00,  -1.563040257e+01,  9.081280828e-01,  -3.134867430e+00,  -9.546838760e+00,  -1.409855008e+00,  -1.079973984e+01,  3.576880693e-01,
+      -1.650866699e+01,  -3.060703516e+00,  -1.264877510e+01,  -6.895561218e+00
+    },
+    {
+      -1.662945557e+01,  1.311548591e+00,  -7.460920334e+00,  -8.930007219e-01,  -4.970769405e+00,  1.954288363e+00,  -3.379420519e+00,  -5.045224667e+00,
+      2.410343289e-01,  1.077771544e+00,  -2.052684975e+01,  1.265712827e-01,  1.099946424e-01,  -5.647734642e+00,  -4.937748909e+00,  1.176206827e+00,
+      -6.639389515e+00,  -4.716424465e+00,  -6.231524348e-01,  -4.201602936e+00,  -3.523753583e-01,  5.960013866e-01,  -8.332486153e+00,  -8.201937675e+00,
+      -1.949731445e+01,  -4.142760754e+00,  -1.104493713e+01,  -4.025658607e+00
+    },
+    {
+      -2.193437958e+01,  8.098635077e-02,  -5.035512447e+00,  -3.812965631e+00,  3.690730333e-01,  1.621612310e+00,  -8.727237701e+00,  -5.014397621e+00,
+      -8.032315254e+00,  1.481306911e+00,  -2.193255806e+01,  -1.239618206e+01,  -3.536301374e+00,  -3.961821795e+00,  -5.178094387e+00,  2.691861689e-01,
+      -4.152976036e+00,  -1.623803520e+01,  -1.602646112e+00,  -4.309804440e+00,  -4.235811234e+00,  7.434700727e-01,  -4.426696301e+00,  -4.007984161e+00,
+      -3.036987305e+01,  -1.472126007e+00,  -2.065545464e+01,  8.750162125e-01
+    },
+    {
+      -1.614159775e+01,  6.279513836e-01,  -8.145803809e-01,  -4.267257638e-03,  1.423380971e-01,  3.505593836e-01,  -4.815951288e-01,  -3.232077122e+00,
+      -7.650264740e+00,  -8.499436378e-01,  -9.020109177e+00,  -9.192372322e+00,  8.395538926e-01,  -5.915582776e-01,  1.254334092e+00,  -4.885382175e+00,
+      2.657662332e-01,  -1.575301933e+01,  1.111222386e+00,  5.414292812e-01,  -5.175696611e-01,  -6.846666813e+00,  -2.139043093e+00,  -6.323675632e+00,
+      -1.587399364e+00,  -4.685007095e+00,  -2.784400940e+00,  2.046057731e-01
+    },
+    {
+      -2.820642281e+01,  6.395834088e-01,  -1.085040951e+01,  -4.358154774e+00,  -6.881037235e+00,  3.217783689e+00,  -5.467262268e-01,  -8.971735001e+00,
+      -3.491534233e+00,  1.952645302e+00,  -2.509130859e+01,  -5.617736816e+00,  1.859385014e+00,  -7.845074177e+00,  -4.974022388e+00,  1.198965669e+00,
+      -6.435262203e+00,  -9.569704056e+00,  -2.992288113e+00,  -5.022829056e+00,  1.990764737e+00,  2.362457514e+00,  -7.834694862e+00,  -9.507304192e+00,
+      -3.869451141e+01,  -6.592275143e+00,  -1.809449577e+01,  -5.319716930e+00
+    },
+    {
+      -1.677234077e+01,  1.305340052e+00,  -7.031692505e+00,  -3.860472679e+00,  -2.956794024e+00,  1.799675941e+00,  -4.577275276e+00,  9.952043295e-01,
+      1.871647358e+00,  1.633153558e+00,  -2.125887489e+01,  -6.343063831e+00,  -1.860641241e+00,  -8.045644760e+00,  -2.053814411e+00,  1.172375441e+00,
+      -5.279187679e+00,  -1.155515385e+01,  6.723290682e-02,  -5.858772755e+00,  -1.581341386e+00,  1.558999777e+00,  -4.982925892e+00,  -6.681801319e+00,
+      -1.419914818e+01,  -3.718500376e+00,  3.431876302e-01,  3.412292302e-01
+    },
+    {
+      -2.953233719e+01,  1.337746501e+00,  -7.138956547e+00,  -3.165795803e+00,  4.185689390e-01,  3.454709291e+00,  -2.409052134e+00,  -4.757277966e+00,
+      -3.987653017e+00,  2.820277214e+00,  -3.417583847e+01,  -6.978985310e+00,  -8.408256769e-01,  -5.525319576e+00,  -4.543942928e+00,  2.812324762e+00,
+      -4.355710030e+00,  -1.898164368e+01,  -2.166230083e-01,  -5.052385807e+00,  1.126414895e+00,  -2.809399605e+00,  -8.375266075e+00,  -1.176319695e+01,
+      -3.372554398e+01,  -1.068815470e+00,  -1.244648361e+01,  -5.562120676e-01
+    },
+    {
+      -1.592812824e+01,  -4.119999111e-01,  -3.164702892e+00,  -7.008727789e-01,  -3.568969071e-01,  2.847655863e-02,  -3.197740793e+00,  2.001295239e-01,
+      -7.442975521e+00,  -4.241973877e+00,  -1.403624725e+01,  -7.746479034e+00,  4.882757366e-01,  6.038733721e-01,  1.542339444e+00,  -2.838864326e+00,
+      -3.866711617e+00,  -6.797759056e+00,  3.684195280e-01,  1.030274749e+00,  7.388994098e-01,  -4.047234535e+00,  -5.644540787e-01,  -7.759018898e+00,
+      -7.359031200e+00,  -7.348219395e+00,  -1.098889351e+00,  -1.474288177e+01
+    },
+    {
+      -4.676003647e+01,  9.462822676e-01,  -2.387239456e+01,  -1.076563358e+01,  -6.067984104e+00,  6.717968464e+00,  -2.979668617e+01,  -1.408748150e+01,
+      -1.032855320e+01,  5.711686611e-01,  -3.965843964e+01,  -3.818601608e+01,  -7.665031910e+00,  -1.497309780e+01,  -1.816773796e+01,  -2.000596046e+00,
+      -1.193020153e+01,  -2.401174545e+01,  -2.734810591e+00,  -9.735241890e+00,  -7.986984730e+00,  -1.825583696e+00,  -1.216820240e+01,  -7.735912800e+00,
+      -4.423877716e+01,  -1.213074565e+00,  -2.629883385e+01,  -9.890343666e+00
+    },
+    {
+      -3.321468735e+01,  -2.762419701e+00,  -1.777716446e+01,  -6.880597115e+00,  -9.064885139e+00,  4.418069363e+00,  -1.249797821e+01,  -9.478119850e+00,
+      -4.997014046e+00,  1.966647863e+00,  -4.259564972e+01,  -1.886093140e+01,  -5.752725124e+00,  -2.296287155e+01,  -7.340922356e+00,  -2.631592989e+00,
+      -7.178774834e+00,  -1.499164391e+01,  -3.731972873e-01,  -1.496885419e+00,  -6.485849857e+00,  -5.879706860e+00,  -1.746320724e+01,  -1.608342361e+01,
+      -3.046499634e+01,  -7.270311713e-01,  -1.083804798e+01,  -3.610735387e-02
+    },
+    {
+      -2.350470352e+01,  8.341643214e-01,  -7.046316624e+00,  3.753103018e-01,  1.090864897e+00,  2.275864482e-01,  1.269087195e-01,  -5.307228088e+00,
+      -5.108541489e+00,  1.265984654e+00,  -1.950265694e+01,  -1.229500055e+00,  1.040477633e+00,  1.319653839e-01,  -4.397384644e+00,  7.624687552e-01,
+      -3.467812538e+00,  -6.069251060e+00,  -4.620074749e+00,  -2.625257708e-02,  1.554910745e-02,  3.964619935e-01,  -7.655809879e+00,  -6.173304081e+00,
+      -2.620213890e+01,  -4.035997987e-01,  -8.142428398e+00,  -5.728501797e+00
+    },
+    {
+      -2.887204742e+01,  1.996826053e+00,  1.738969684e+00,  -3.156524897e+00,  -4.238435268e+00,  1.866119027e+00,  -5.552871227e+00,  -6.890892506e+00,
+      -4.470371723e+00,  2.548808336e+00,  -3.402573013e+01,  -7.597105503e+00,  -1.998858094e+00,  6.688569784e-01,  -2.192388058e+00,  1.434408903e+00,
+      2.430787325e+00,  -1.552420139e+01,  -3.626927853e+00,  -2.618303776e+00,  -3.948688269e+00,  6.114857793e-01,  -7.467816353e+00,  -5.972285748e+00,
+      -1.788883018e+01,  -1.934719324e+00,  -1.227644539e+01,  -2.454590559e+00
+    },
+    {
+      -2.010909271e+01,  1.450327992e+00,  -1.151023102e+01,  -2.435278416e+00,  2.109242201e+00,  1.898482442e+00,  -6.550792217e+00,  1.133098722e+00,
+      -4.415896416e+00,  1.465613008e+00,  -2.965461540e+01,  8.414937556e-02,  -3.268859148e+00,  -1.172368145e+01,  -7.697386146e-01,  1.208525538e+00,
+      -8.754657745e+00,  -6.392904282e+00,  -6.782780170e+00,  6.525287628e-01,  1.078830004e+00,  -6.143868923e+00,  -6.101563931e+00,  -2.196797752e+01,
+      -2.643131256e+01,  -6.514484286e-01,  -4.455546379e+00,  -5.473268628e-01
+    },
+    {
+      -1.372161102e+01,  -2.467824072e-01,  -2.920388699e+00,  -1.343046665e+00,  4.051619023e-02,  -3.308840036e+00,  -1.387797832e+00,  -4.842611790e+00,
+      -5.271267891e+00,  -7.345018387e-01,  -1.233904171e+01,  -6.846326590e-01,  1.596869156e-02,  4.035979807e-01,  1.842977256e-01,  -3.197244704e-01,
+      -1.417435169e+00,  -4.161370754e+00,  8.162118196e-01,  -1.248081684e+00,  3.846071661e-01,  3.861528039e-01,  -2.973660529e-01,  -2.398973331e-02,
+      -6.317115784e+00,  -1.321569562e+00,  -6.654237270e+00,  -6.248375416e+00
+    },
+    {
+      -1.736251450e+01,  7.902490497e-01,  -5.342822075e+00,  -3.602112532e+00,  -3.359068632e+00,  1.845195413e+00,  -3.707625151e+00,  -4.271569729e+00,
+      -1.058584154e-01,  1.373216629e+00,  -1.840280724e+01,  -9.219910622e+00,  4.767383039e-01,  -5.307971001e+00,  -3.602149010e+00,  7.968792319e-01,
+      -1.241899207e-01,  -1.357728672e+01,  1.341376662e+00,  6.471329927e-02,  9.159004688e-01,  -3.589240074e+00,  -6.486722946e+00,  -8.360429764e+00,
+      -1.039944172e+01,  -4.600962624e-02,  -6.428217888e+00,  -3.113677025e+00
+    },
+    {
+      -1.429516907e+02,  -1.815058827e+00,  -3.997700882e+01,  -5.488171768e+01,  -1.807042503e+01,  -3.838837051e+01,  -1.767574501e+01,  -6.248905182e+01,
+      -9.720160675e+01,  -1.934657812e+00,  -1.503260193e+02,  -6.119598389e+01,  -1.180308914e+01,  1.129434705e+00,  2.162928820e+00,  2.158766508e+00,
+      -1.500856876e+01,  -9.327910614e+01,  -6.050248146e+00,  -4.941378021e+01,  -2.147200012e+01,  1.871880531e+01,  -3.557404709e+01,  -9.949076653e+00,
+      -1.578907776e+02,  -1.473701596e+00,  -2.212666931e+02,  1.135748744e+00
+    },
+    {
+      -1.622862625e+01,  5.906941891e-01,  -3.681339920e-01,  7.247267663e-02,  4.276544452e-01,  1.084615588e+00,  -3.891022444e+00,  -2.550362647e-01,
+      -4.086961746e+00,  1.125228047e+00,  -1.401051807e+01,  -3.584059477e-01,  -7.241818309e-01,  1.158305034e-01,  -6.878459454e-01,  5.851847529e-01,
+      -1.902700663e+00,  -5.474837303e+00,  -4.860665202e-01,  -3.071048856e-01,  7.582890987e-01,  -1.278119445e+00,  -3.137152195e-01,  -2.049430132e+00,
+      -1.363176346e+01,  -1.022044420e+00,  -5.873568535e+00,  -4.914013863e+00
+    },
+    {
+      -2.093610191e+01,  -1.966794729e+00,  -5.604982376e+00,  -7.011298835e-02,  -5.829107761e+00,  2.692987770e-02,  -4.698479652e+00,  -6.253343582e+00,
+      1.003700852e+00,  -1.875920221e-02,  -1.582728291e+01,  -3.677013397e+00,  -9.288532138e-01,  -7.615196109e-01,  -4.007616997e+00,  6.648986340e-01,
+      1.439825535e+00,  -5.732037067e+00,  -3.798673868e+00,  8.059739470e-01,  2.322688103e+00,  7.486125231e-01,  -7.157766342e+00,  -7.669307709e+00,
+      -1.319901657e+01,  -6.671224236e-01,  -1.750477600e+01,  -4.803129196e+00
+    },
+    {
+      -1.513311481e+01,  1.302985072e+00,  -9.062541008e+00,  3.478514403e-02,  -5.848654747e+00,  9.751210809e-01,  -5.888791680e-01,  -4.719037533e+00,
+      1.907007456e+00,  1.464730263e+00,  -1.601138687e+01,  -6.770212173e+00,  -2.369704485e+00,  -4.617640495e+00,  -5.402331352e+00,  1.514858603e-01,
+      -7.220696926e+00,  -5.929587364e+00,  6.390006542e-01,  -7.243198752e-01,  8.202993274e-01,  9.324165583e-01,  -7.138616085e+00,  -4.303062439e+00,
+      -1.980706596e+01,  -3.989613533e+00,  -8.780448914e+00,  -6.891680956e-01
+    },
+    {
+      -1.963799095e+01,  1.851450205e-01,  -2.958054543e+00,  -7.646911740e-01,  1.737476140e-01,  1.105865166e-01,  2.411452308e-02,  -6.702731848e-01,
+      -7.903805256e+00,  4.297586977e-01,  -1.319565392e+01,  -8.548377037e+00,  4.669026136e-01,  -4.744677842e-01,  1.966155767e+00,  -2.631552458e+00,
+      -5.111268997e+00,  -1.586977482e+01,  3.467202783e-01,  1.261308074e+00,  4.300720990e-01,  -5.021404266e+00,  -2.026213408e+00,  -8.536947250e+00,
+      -4.532721043e+00,  -5.038597107e+00,  -5.406936169e+00,  -5.753776550e+00
+    },
+    {
+      -4.289107895e+01,  2.808691263e+00,  -6.232085705e+00,  -3.210412025e+00,  -3.281050682e+00,  4.623030663e+00,  -7.038726330e+00,  -7.789859772e+00,
+      -4.952498913e+00,  3.497451782e+00,  -5.419733047e+01,  -8.618923187e+00,  -3.054329872e+00,  -3.665045023e+00,  -5.351331711e+00,  2.725813150e+00,
+      -4.899874687e+00,  -2.163360977e+01,  -4.067431450e+00,  -6.400248528e+00,  -2.727820635e+00,  -2.294221401e+00,  -1.374021530e+01,  -1.935768700e+01,
+      -3.524975586e+01,  7.682085633e-01,  -9.256123543e+00,  -3.543684244e+00
+    },
+    {
+      -2.670247269e+01,  1.810197949e+00,  -4.032478333e+00,  -4.201946735e+00,  -3.131913424e+00,  2.576309681e+00,  -2.886208773e+00,  -1.102578259e+01,
+      -2.797275305e+00,  1.981230855e+00,  -3.577495575e+01,  -1.113296032e+01,  1.681763649e+00,  -1.349865723e+01,  2.172924042e+00,  -1.738887072e+00,
+      -1.054684639e+01,  -2.123867798e+01,  -2.410633802e+00,  -5.982292175e+00,  -3.696508884e+00,  -4.557177067e+00,  -6.339502335e+00,  -1.382162952e+01,
+      -2.821773148e+01,  -2.745513678e+00,  -9.913225174e+00,  2.086074114e+00
+    },
+    {
+      -2.282605743e+01,  -3.422752023e-01,  -1.708520126e+01,  -5.238291264e+00,  -3.685518026e+00,  2.359879732e+00,  -4.028948307e+00,  -5.161632538e+00,
+      -5.257421494e+00,  2.505267143e+00,  -2.612686729e+01,  -6.066246033e+00,  -1.907983422e+00,  -4.818149090e+00,  -5.836955070e+00,  4.621174037e-01,
+      -3.957468271e+00,  -4.401294231e+00,  -4.611195087e+00,  -5.543198109e+00,  -2.357588768e+00,  2.914849997e+00,  -7.012023926e+00,  -7.309941769e+00,
+      -3.655689240e+01,  2.385803461e+00,  -2.651521683e+01,  -2.626092672e+00
+    },
+    {
+      -3.218421936e+01,  9.476094246e-01,  -2.753100872e+00,  1.000068665e+00,  -6.082376480e+00,  -2.634415627e+00,  3.362865746e-01,  -6.796620846e+00,
+      -1.380590153e+01,  -3.764940023e+00,  -1.934662628e+01,  -1.599698353e+01,  5.167536736e-01,  -9.892178535e+00,  -3.230740786e+00,  -3.830513239e+00,
+      -8.949929237e+00,  -1.012598419e+01,  -1.162114143e+00,  1.562314034e+00,  -2.689223528e+00,  -9.497430801e+00,  -9.144668579e+00,  -8.991477013e+00,
+      -2.173292160e+01,  -9.469084740e+00,  -4.150991440e+00,  -7.929490089e+00
+    },
+    {
+      -4.328193665e+01,  3.746606350e+00,  -1.113051701e+01,  -2.378731966e+00,  -3.280989885e+00,  3.759764910e+00,  -9.116106033e+00,  -4.593029976e+00,
+      -3.098340273e+00,  1.130540669e-01,  -2.529969215e+01,  -7.872524738e+00,  -4.810893536e-01,  -9.608154297e+00,  -1.146618366e+01,  -2.164906979e+00,
+      -4.477968693e+00,  -8.379767418e+00,  -3.485835075e+00,  -7.346553802e+00,  -3.416122198e+00,  -1.448410392e+00,  -1.311346722e+01,  -6.481103897e+00,
+      -2.375028992e+01,  -2.202081919e+00,  3.941551924e+00,  -1.194083118e+01
+    },
+    {
+      -7.912866116e+00,  2.926256657e-01,  -5.679565668e-01,  -2.848178744e-01,  2.560900897e-02,  -1.252975613e-01,  -1.009353995e+00,  -1.813056827e+00,
+      -1.585757256e+00,  5.399963856e-01,  -5.747381687e+00,  -1.040638685e+00,  3.144820929e-01,  -3.772671521e-01,  -6.766937375e-01,  1.919799447e-01,
+      -1.918499321e-01,  -4.252565384e+00,  7.783079892e-02,  -1.466549188e-01,  2.676805556e-01,  -8.776046038e-01,  -2.708887577e+00,  -1.852494478e+00,
+      -5.055715084e+00,  -5.431279540e-01,  -3.000592709e+00,  -1.420148611e+00
+    }
+  },
+  // pos 4
+  {
+    {
+      -7.003786087e+00,  -1.502046138e-01,  -2.745007992e+00,  -1.418443084e+00,  -5.846503377e-01,  8.516212702e-01,  -2.366650105e+00,  -9.442287683e-01,
+      -1.770005822e+00,  7.739608288e-01,  -1.101567841e+01,  -3.034518719e+00,  -6.944215298e-01,  -4.899282932e+00,  -7.695284486e-01,  -1.012776256e+00,
+      -2.425455332e+00,  -8.633276939e+00,  -1.558651775e-01,  -2.097229004e+00,  -1.049318194e+00,  -2.054735422e+00,  -2.593410730e+00,  -2.702806711e+00,
+      -9.694120407e+00,  -1.428117007e-01,  -4.379387856e+00,  8.635557294e-01
+    },
+    {
+      -1.292511463e+01,  -5.219689369e+00,  2.384044826e-01,  5.112419128e-01,  -4.369550571e-02,  -1.478090763e+00,  -5.686968327e+00,  -6.926127672e-01,
+      -8.945599556e+00,  -9.082242250e-01,  -1.539077377e+01,  -5.689942241e-01,  8.972049356e-01,  1.076334268e-01,  1.266080499e+00,  -5.147113800e+00,
+      -1.362033486e+00,  -1.528635788e+01,  9.242249727e-01,  -7.451697588e-01,  6.597405076e-01,  -5.261744499e+00,  -2.592164040e+00,  -5.057137966e+00,
+      -5.479851246e+00,  -7.321226001e-01,  -1.326263666e+00,  -6.808650017e+00
+    },
+    {
+      -2.611420250e+01,  2.343952179e+00,  -1.611111641e+00,  -1.092583752e+01,  -9.943246841e+00,  -1.465309381e+00,  -1.165781593e+01,  -9.815529823e+00,
+      -2.783124924e+00,  1.265003204e+00,  -2.118088722e+01,  -2.054137611e+01,  2.142749071e+00,  -1.198348808e+01,  -5.715494633e+00,  1.190436006e+00,
+      -1.082680225e+01,  -2.159400368e+01,  1.309883952e+00,  -7.051908493e+00,  -1.086344528e+01,  1.182528377e+00,  -1.251044369e+01,  -1.346091270e+00,
+      -2.308602905e+01,  -4.498340130e+00,  -1.658825684e+01,  -2.245631218e+00
+    },
+    {
+      -1.457443333e+01,  1.259368658e+00,  -1.114145565e+01,  -3.897557974e+00,  -5.387126446e+00,  1.561143756e+00,  -4.509937763e+00,  -4.420216084e+00,
+      1.415992141e+00,  1.686483026e+00,  -2.070935059e+01,  -1.332862377e-01,  -1.824581265e+00,  -1.042360115e+01,  -5.674178600e+00,  6.983332634e-01,
+      -5.062365055e+00,  -7.421238899e+00,  -3.322614431e+00,  -4.660581589e+00,  7.902986407e-01,  1.080446243e+00,  -9.040765762e+00,  -1.103636932e+01,
+      -2.093996811e+01,  6.729074717e-01,  -9.765622139e+00,  1.651763618e-01
+    },
+    {
+      -1.522418308e+01,  -9.992254972e-01,  -8.854033947e-01,  -1.000251651e+00,  -4.618492603e+00,  1.026795149e+00,  -4.792932987e+00,  -5.059186935e+00,
+      -4.964811325e+00,  8.200930953e-01,  -1.835997963e+01,  -1.008195400e+01,  2.607806027e-01,  -6.318131447e+00,  -4.313911438e+00,  -8.368805647e-01,
+      -8.904622197e-01,  -1.055940533e+01,  -1.780840456e-01,  -8.821466938e-03,  -4.438746452e+00,  -4.699063301e+00,  -5.120666504e+00,  -6.475443840e-01,
+      -1.541667271e+01,  -1.492545158e-01,  -1.106403446e+01,  1.415436387e+00
+    },
+    {
+      -1.580641079e+01,  -1.359319538e-01,  -7.427068949e-01,  -3.970320821e-01,  1.286683679e+00,  -1.981930017e+00,  -7.549916953e-02,  -2.930951834e+00,
+      -8.649180412e+00,  -1.350369811e+00,  -1.391976833e+01,  -1.046337605e+01,  9.161716700e-01,  -2.012331247e+00,  1.878817797e+00,  -3.312902212e+00,
+      -4.997280538e-01,  -1.594342804e+01,  1.530373216e+00,  9.424465895e-01,  -1.296309352e+00,  -7.784903049e+00,  -1.937201262e+00,  -5.781442642e+00,
+      -7.800085068e+00,  -2.655431986e+00,  -2.474089384e+00,  1.396661758e+00
+    },
+    {
+      -2.905237389e+01,  -1.215299368e+00,  -7.839366913e+00,  -6.245880127e+00,  -6.862019062e+00,  -7.478638291e-01,  2.858901501e+00,  -1.039186573e+01,
+      -7.712802887e+00,  1.323764563e+00,  -2.944068909e+01,  -8.373130798e+00,  1.880631208e+00,  -5.022013187e+00,  -2.881084919e+00,  1.808646321e+00,
+      -4.647076130e+00,  -1.646932602e+01,  -3.981005192e+00,  -7.692229748e+00,  -1.181660533e+00,  3.110664129e+00,  -7.971294880e+00,  -3.336456060e+00,
+      -3.960279465e+01,  -4.308358669e+00,  -2.855611420e+01,  1.868220687e+00
+    },
+    {
+      -2.031038284e+01,  6.351616383e-01,  -5.739599228e+00,  -4.435540676e+00,  -4.109094620e+00,  2.532337427e+00,  -4.855329514e+00,  -2.912292004e+00,
+      2.044835329e+00,  1.758969545e+00,  -2.948005104e+01,  -7.203946590e+00,  -2.215005398e+00,  -8.532827377e+00,  1.092957020e+00,  6.601197720e-01,
+      -6.860614777e+00,  -1.224418926e+01,  -1.950958610e+00,  -5.955051422e+00,  -2.180321455e+00,  1.732319593e+00,  -5.322926521e+00,  -7.654347420e+00,
+      -2.175272369e+01,  -3.882539272e+00,  -3.081311941e+00,  9.436131716e-01
+    },
+    {
+      -1.891370201e+01,  1.111814022e+00,  -7.044096470e+00,  -2.617526770e+00,  5.451694727e-01,  2.066529274e+00,  3.080465198e-01,  -3.131307125e+00,
+      -3.112100124e+00,  1.814446568e+00,  -2.311938477e+01,  -4.141656876e+00,  2.104913443e-01,  -4.576581478e+00,  -3.417060375e+00,  7.382612824e-01,
+      -4.572852612e+00,  -1.389580250e+01,  1.291676909e-01,  -3.668877602e+00,  1.487187266e+00,  -3.565754414e+00,  -4.669896126e+00,  -9.594647408e+00,
+      -2.491180420e+01,  2.198689878e-01,  -8.085423470e+00,  8.315746784e-01
+    },
+    {
+      -1.282529354e+01,  1.572829485e-01,  -1.463606000e+00,  9.874029756e-01,  5.620002151e-01,  -8.863870502e-01,  -3.385852814e+00,  -3.048965707e-02,
+      -7.622747898e+00,  -4.521262169e+00,  -1.468187332e+01,  -5.708787441e+00,  3.923590481e-01,  -1.612519622e+00,  1.198781371e+00,  8.196441084e-02,
+      -7.969650745e+00,  -1.422612309e+00,  1.418587565e-01,  8.451918364e-01,  1.494068652e-01,  -5.983010769e+00,  -4.185532779e-02,  -7.587213993e+00,
+      -1.249553871e+01,  -6.959607124e+00,  -3.774276495e+00,  -1.056877518e+01
+    },
+    {
+      -4.727120972e+01,  1.301884055e-01,  -2.130982780e+01,  -1.075236702e+01,  -4.730394840e+00,  6.074523926e+00,  -2.757329750e+01,  -1.388938236e+01,
+      -1.225434494e+01,  1.183212280e+00,  -4.314808273e+01,  -3.803484344e+01,  -6.880611420e+00,  -1.632244492e+01,  -1.691908455e+01,  -2.234029531e+00,
+      -1.020729923e+01,  -2.804840851e+01,  -2.677521229e+00,  -8.986256599e+00,  -9.404706001e+00,  -2.389106512e+00,  -1.170173454e+01,  -8.525670052e+00,
+      -4.769923019e+01,  -5.513173342e-01,  -2.913892746e+01,  -6.322665215e+00
+    },
+    {
+      -1.940274429e+01,  -2.998452187e+00,  -1.285368347e+01,  -5.748938084e+00,  -6.092268467e+00,  2.536608219e+00,  -6.564638615e+00,  -7.133869648e+00,
+      -5.042266846e+00,  1.279564619e+00,  -2.510256195e+01,  -1.627877808e+01,  -3.371532440e+00,  -1.638982773e+01,  -5.687457085e+00,  -2.552892447e+00,
+      -5.161100864e+00,  -1.393023968e+01,  6.768064499e-01,  9.992728233e-01,  -4.720759869e+00,  -4.236854553e+00,  -1.030362129e+01,  -1.264761257e+01,
+      -2.311129570e+01,  4.794732332e-01,  -1.823315811e+01,  1.599787593e+00
+    },
+    {
+      -2.160605431e+01,  1.657713503e-01,  -1.020728111e+01,  -2.549730301e+00,  1.986726403e+00,  2.531717300e+00,  -3.984563351e+00,  -2.953954697e+00,
+      -2.381970286e-01,  1.908226252e+00,  -2.092247391e+01,  -5.293818474e+00,  1.917796016e+00,  -6.438975334e+00,  -5.089525700e+00,  2.214917660e+00,
+      -6.042758942e+00,  -1.122480297e+01,  -5.269571304e+00,  -3.065423965e+00,  1.111599565e+00,  -2.270161808e-01,  -5.520773411e+00,  -1.158096981e+01,
+      -2.952662849e+01,  3.275401890e-03,  -6.822557449e+00,  6.788630784e-02
+    },
+    {
+      -1.927194786e+01,  1.623120308e+00,  5.191896558e-01,  -3.480281115e+00,  -3.892077208e+00,  1.556633830e+00,  -3.498304129e+00,  -6.753224850e+00,
+      -4.383516788e+00,  1.748869777e+00,  -2.431509972e+01,  -6.247422695e+00,  -3.087304831e-01,  -3.500489473e+00,  -2.670219660e+00,  1.065324783e+00,
+      7.127792835e-01,  -1.399684811e+01,  -3.268301249e+00,  -1.834522784e-01,  -3.325378895e+00,  -2.660915852e-01,  -5.780728817e+00,  -4.965802193e+00,
+      -1.737137032e+01,  3.207137287e-01,  -9.768248558e+00,  9.018835425e-01
+    },
+    {
+      -1.900090599e+01,  1.080463752e-01,  -1.471860695e+01,  3.703498840e-01,  1.986277342e+00,  3.027238250e-01,  -4.803802013e+00,  1.147155643e+00,
+      -7.113177299e+00,  1.426457047e+00,  -2.215608788e+01,  5.773302540e-02,  -7.640019059e-01,  -1.278084087e+01,  -3.886101961e+00,  1.559894830e-01,
+      -1.453062916e+01,  -6.416953802e-01,  -8.570760727e+00,  -2.067308664e+00,  2.174556017e+00,  -3.454193830e+00,  -7.538524151e+00,  -1.939836884e+01,
+      -2.405491066e+01,  -1.218942925e-03,  -7.628856897e-01,  -6.042712331e-01
+    },
+    {
+      -2.022299194e+01,  -9.712975025e-01,  -1.115694761e+00,  -3.767396212e-01,  -2.815222740e-01,  -5.910295010e+00,  -3.049451113e+00,  -6.927399158e+00,
+      -1.134573269e+01,  -9.754890800e-01,  -1.027365208e+01,  -2.879123688e+00,  6.248887181e-01,  5.105245113e-01,  6.413295865e-01,  -3.362420559e+00,
+      -1.096221089e+00,  -9.569768310e-01,  1.260114074e+00,  -3.267264962e-01,  1.412010845e-02,  -3.783021569e-01,  -3.471527100e-01,  6.449512392e-02,
+      -9.857679367e+00,  -2.911140203e+00,  -9.031624794e+00,  -1.140916634e+01
+    },
+    {
+      -1.837761879e+01,  5.738363266e-01,  -7.448848248e+00,  -3.521661520e+00,  -6.271377087e+00,  1.773007512e+00,  -2.935949326e+00,  -7.234066486e+00,
+      1.254348397e+00,  1.990423441e+00,  -2.884548187e+01,  -9.463151932e+00,  4.103100002e-01,  -6.954564571e+00,  -4.410160542e+00,  1.766961098e+00,
+      -2.855749369e+00,  -1.194327164e+01,  -3.813788891e-01,  3.085317016e-01,  1.475173831e+00,  -5.091394901e+00,  -7.731745243e+00,  -1.033613968e+01,
+      -1.823525047e+01,  1.061591148e+00,  -7.268914223e+00,  2.734596729e-01
+    },
+    {
+      -1.478681030e+02,  -2.900688410e+00,  -4.318756485e+01,  -5.935781097e+01,  -1.885116196e+01,  -3.884524918e+01,  -1.523958206e+01,  -6.233535385e+01,
+      -1.034406891e+02,  -2.696994305e+00,  -1.554212341e+02,  -6.489585876e+01,  -1.241046238e+01,  1.621404290e+00,  1.842842698e+00,  3.586079359e+00,
+      -1.778565979e+01,  -9.702230835e+01,  -7.150750160e+00,  -5.182506180e+01,  -2.297147560e+01,  2.000145912e+01,  -3.860469437e+01,  -9.989667892e+00,
+      -1.643453979e+02,  -6.768176556e-01,  -2.405719910e+02,  4.285944402e-01
+    },
+    {
+      -1.429876328e+01,  1.074343562e+00,  -1.340260208e-01,  -7.338516116e-01,  -5.723692775e-01,  1.583840370e+00,  -2.859176636e+00,  -3.386123419e+00,
+      -1.126345515e+00,  1.478597045e+00,  -1.808490562e+01,  -2.860883474e+00,  8.079647087e-03,  -7.001532912e-01,  3.495605290e-01,  9.302454591e-01,
+      -3.398518860e-01,  -1.084329605e+01,  -8.021381497e-01,  -2.578500271e+00,  -3.385777771e-01,  -9.378415942e-01,  -5.681812286e+00,  -6.520575523e+00,
+      -1.241175270e+01,  -7.688571215e-01,  -6.191647053e+00,  -1.414266378e-01
+    },
+    {
+      -1.808040237e+01,  1.177432656e+00,  -6.556953907e+00,  -1.966691017e+00,  -4.753704548e+00,  1.243866205e+00,  -3.063210249e+00,  -6.891181946e+00,
+      1.588607311e+00,  4.159614444e-01,  -2.279856682e+01,  3.465503156e-01,  -1.803514123e+00,  -2.420495301e-01,  -3.635689974e+00,  1.367885947e+00,
+      5.000942349e-01,  -7.518823624e+00,  -4.758374214e+00,  1.486166000e+00,  2.068540812e+00,  -1.593622804e+00,  -8.314231873e+00,  -8.786418915e+00,
+      -1.889091110e+01,  -4.684898853e-01,  -1.681045341e+01,  -2.913739383e-01
+    },
+    {
+      -1.350872421e+01,  4.898219109e-01,  -7.500475883e+00,  -1.156060457e+00,  -6.630777359e+00,  1.620076537e+00,  -4.488040805e-01,  -5.834489822e+00,
+      1.121653318e+00,  1.558258057e+00,  -1.304616165e+01,  -6.430173397e+00,  -5.675242469e-02,  -6.626810074e+00,  -5.571071148e+00,  1.467859447e-01,
+      -4.898271084e+00,  -7.261028767e+00,  -2.472198457e-01,  -1.163199663e+00,  1.504952610e-01,  2.385580242e-01,  -7.340612411e+00,  -1.316375852e+00,
+      -1.501484013e+01,  2.260598093e-01,  -6.429970264e+00,  3.185971081e-01
+    },
+    {
+      -1.774242401e+01,  -2.659404576e-01,  -2.068064928e+00,  -1.346030951e+00,  1.006545186e+00,  -9.063830972e-01,  -3.340540886e+00,  4.434448481e-01,
+      -7.507208824e+00,  1.020364165e+00,  -1.152943516e+01,  -1.289685726e+01,  1.152594924e+00,  -3.790594578e+00,  1.157006025e+00,  -2.345706373e-01,
+      -1.529620737e-01,  -1.584392262e+01,  2.092659950e+00,  1.581708193e+00,  -3.167356849e-01,  -6.031195164e+00,  -2.999190688e-01,  -3.902696848e+00,
+      -1.131180525e-01,  -5.039515018e+00,  -3.179379702e+00,  -6.696697235e+00
+    },
+    {
+      -4.129906845e+01,  2.125770330e+00,  -6.924598694e+00,  -3.022264004e+00,  -2.774149656e+00,  4.135460854e+00,  -7.137790680e+00,  -7.144845963e+00,
+      -6.397785664e+00,  3.087185383e+00,  -5.861473846e+01,  -6.829605579e+00,  -3.387031078e+00,  -4.982810974e+00,  -3.296010733e+00,  2.764832973e+00,
+      -8.938892365e+00,  -1.999213600e+01,  -4.548477173e+00,  -4.514686584e+00,  -3.127688408e+00,  -3.837925196e+00,  -1.085090542e+01,  -2.102239227e+01,
+      -3.923264313e+01,  1.742053866e+00,  -9.829641342e+00,  -4.025676727e+00
+    },
+    {
+      -2.613357925e+01,  2.086001873e+00,  -3.604989052e+00,  -4.562383652e+00,  -4.074058533e+00,  2.489415884e+00,  -3.651224375e+00,  -1.135421562e+01,
+      -2.930588484e+00,  1.906043172e+00,  -3.596747208e+01,  -9.023816109e+00,  1.277212381e+00,  -1.337448120e+01,  2.426559925e+00,  -1.333861947e+00,
+      -1.183863258e+01,  -2.100126266e+01,  -3.217385769e+00,  -7.063444614e+00,  -3.275780678e+00,  -3.658670664e+00,  -5.683756828e+00,  -1.392742062e+01,
+      -3.030049133e+01,  -2.454294443e+00,  -1.017559147e+01,  1.692621231e+00
+    },
+    {
+      -4.837828827e+01,  2.207936198e-01,  -2.357143021e+01,  -1.015874481e+01,  -6.313498497e+00,  4.587461472e+00,  -1.214091682e+01,  -6.255559921e+00,
+      -1.429105091e+01,  5.149265766e+00,  -6.829521942e+01,  -1.346084213e+01,  -4.971929073e+00,  -1.885786247e+01,  -9.175734520e+00,  4.350214958e+00,
+      -2.850324821e+01,  -2.786906052e+01,  -1.349109077e+01,  -1.557493019e+01,  -4.949400902e+00,  2.798077464e-01,  -1.457245731e+01,  -3.319795990e+01,
+      -6.117831802e+01,  3.344655931e-01,  -2.906682968e+01,  -2.707389593e+00
+    },
+    {
+      -2.670961952e+01,  9.956421852e-01,  -7.776267529e+00,  -3.441509724e+00,  -5.412673473e+00,  -1.138570309e+00,  -2.680267334e+00,  -6.883852005e+00,
+      -7.616419315e+00,  1.005963445e+00,  -2.558601761e+01,  -1.891342163e+01,  -1.627092719e+00,  -1.659182167e+01,  -1.852232933e+00,  -3.055167913e+00,
+      -6.236440659e+00,  -2.033399773e+01,  8.674913645e-01,  -4.762230873e+00,  -3.260943413e+00,  -5.833512783e+00,  -1.094043827e+01,  -1.026896572e+01,
+      -3.337772369e+01,  -6.144613743e+00,  -9.740157127e+00,  2.959375858e+00
+    },
+    {
+      -3.413876724e+01,  1.609888792e+00,  -6.373383999e+00,  -4.670928955e+00,  -3.687314510e+00,  2.165017605e+00,  -7.026754379e+00,  -5.530038357e+00,
+      -9.113453865e+00,  2.514277220e+00,  -2.687661934e+01,  -8.526360512e+00,  2.508021116e+00,  -1.196539593e+01,  -7.422291756e+00,  -1.107582688e+00,
+      -7.222264767e+00,  -1.406709957e+01,  -3.427814245e+00,  -7.824222565e+00,  -3.960947990e+00,  -3.177893877e+00,  -7.780508518e+00,  -9.521522522e+00,
+      -2.907464218e+01,  1.862068653e+00,  -5.438949108e+00,  -2.718630075e+00
+    },
+    {
+      -6.428608894e+00,  5.134596229e-01,  -8.149875402e-01,  -5.994861722e-01,  1.259642243e-01,  6.331658363e-01,  -3.023705184e-01,  -1.264958620e+00,
+      -9.899850488e-01,  4.804435074e-01,  -8.258478165e+00,  -9.273101687e-01,  -2.143345773e-01,  -1.270493269e+00,  8.202686906e-02,  3.718802929e-01,
+      -1.467900872e+00,  -5.569534302e+00,  -8.019946516e-02,  -3.922812939e-01,  -1.672713608e-01,  -9.666275382e-01,  -2.359473944e+00,  -3.673741341e+00,
+      -5.741613865e+00,  -2.139252275e-01,  -2.082531691e+00,  -1.086578369e-01
+    }
+  },
+  // pos 5
+  {
+    {
+      -1.171226597e+01,  -1.154401422e+00,  -1.114398289e+01,  -3.743492842e+00,  -1.195166945e+00,  1.412369132e+00,  -7.107936382e+00,  -1.399908781e+00,
+      -5.662997723e+00,  -5.863255858e-01,  -2.360244751e+01,  -4.081132889e+00,  -7.491469383e-01,  -9.253116608e+00,  -2.403646946e+00,  -3.401415586e+00,
+      -5.940533161e+00,  -1.773155403e+01,  -1.694512367e+00,  -3.413011312e+00,  -1.908818126e+00,  -7.339920998e+00,  -7.283311367e+00,  -6.479203701e+00,
+      -1.725977898e+01,  1.139618531e-01,  -1.283101463e+01,  1.869378924e+00
+    },
+    {
+      -1.907661629e+01,  -6.221034050e+00,  -1.639206707e-01,  2.400666028e-01,  3.947196603e-01,  -2.991940975e+00,  -6.904619217e+00,  -7.995434403e-01,
+      -1.071327591e+01,  -4.334237278e-01,  -1.491002464e+01,  -9.643988609e-01,  1.204422474e+00,  -2.005152702e-01,  1.548465967e+00,  -6.817133904e+00,
+      -4.377894878e+00,  -8.576464653e+00,  8.116942644e-01,  2.100666761e-01,  1.374802709e+00,  -5.348232269e+00,  -8.560968637e-01,  -3.190234661e+00,
+      -8.662710190e+00,  -3.673577070e+00,  -3.892857552e+00,  -1.388063622e+01
+    },
+    {
+      -2.941754341e+01,  1.460321426e+00,  -1.971965909e+00,  -1.220837784e+01,  -1.013651657e+01,  -2.234749556e+00,  -1.189044094e+01,  -9.834714890e+00,
+      -5.226796627e+00,  1.498099327e+00,  -2.475071335e+01,  -1.937275696e+01,  3.352281332e+00,  -1.282488918e+01,  -4.172767639e+00,  -3.005460203e-01,
+      -1.065828705e+01,  -2.597490692e+01,  2.391429424e+00,  -9.485978127e+00,  -1.002454567e+01,  1.654475927e+00,  -1.191318321e+01,  -2.820992947e+00,
+      -3.003295898e+01,  -6.131888866e+00,  -2.001966858e+01,  1.396953106e+00
+    },
+    {
+      -1.582954693e+01,  1.966595173e+00,  -1.437175941e+01,  -4.821986675e+00,  -5.706678391e+00,  1.556335807e+00,  -5.523229122e+00,  -4.540935040e+00,
+      1.761390805e+00,  2.428527832e+00,  -2.285781288e+01,  -9.202433825e-01,  -3.778076410e+00,  -1.586830521e+01,  -6.207918167e+00,  3.833177090e-01,
+      -6.611599922e+00,  -9.259607315e+00,  -4.759019852e+00,  -5.318093300e+00,  1.656396508e+00,  2.341109514e-01,  -1.134515572e+01,  -1.727743721e+01,
+      -2.750160217e+01,  1.738668084e-01,  -1.009899044e+01,  1.682909369e+00
+    },
+    {
+      -2.019119072e+01,  -1.371610880e+00,  -3.412932873e+00,  -3.053917885e+00,  -8.124155998e+00,  1.495504260e+00,  -5.714536667e+00,  -7.843956470e+00,
+      -5.148495197e+00,  1.365996599e+00,  -2.605115128e+01,  -1.355112457e+01,  1.734200001e+00,  -1.175822735e+01,  -5.289358139e+00,  -2.547362089e+00,
+      -3.134940863e+00,  -1.527562714e+01,  -1.739124656e-01,  -4.060706139e+00,  -5.161327362e+00,  -7.083352089e+00,  -6.367272854e+00,  -3.327847719e-01,
+      -2.408478165e+01,  3.690966368e-01,  -1.329385185e+01,  2.894554615e+00
+    },
+    {
+      -1.627673531e+01,  -5.373958349e-01,  -1.671649098e+00,  -2.404368639e+00,  1.898238301e+00,  -3.550926924e+00,  3.301613033e-01,  -1.530855417e+00,
+      -8.840759277e+00,  -2.974652052e+00,  -1.752877426e+01,  -9.637370110e+00,  -6.328874826e-01,  -5.609020233e+00,  1.954395413e+00,  -1.023893595e+00,
+      -8.189804554e-01,  -2.159218025e+01,  1.472793341e+00,  9.043350220e-01,  -1.021555781e+00,  -7.390445709e+00,  -4.601801872e+00,  -8.693755150e+00,
+      -1.633995628e+01,  -1.691134930e+00,  -8.159917831e+00,  1.583658457e+00
+    },
+    {
+      -3.774315262e+01,  -1.600179911e+00,  -9.735760689e+00,  -8.796930313e+00,  -6.746694565e+00,  -4.508562565e+00,  1.574510694e+00,  -1.362746143e+01,
+      -1.432515430e+01,  1.323759556e+00,  -3.853218460e+01,  -1.128261662e+01,  1.051520824e+00,  -4.825722218e+00,  -2.988706827e+00,  9.055297375e-01,
+      -7.301262379e+00,  -2.334422112e+01,  -4.886825562e+00,  -1.146236610e+01,  -2.790300846e+00,  4.103325367e+00,  -8.762662888e+00,  -5.126623154e+00,
+      -4.848095703e+01,  -5.118957520e+00,  -3.837775803e+01,  3.436376095e+00
+    },
+    {
+      -2.800755692e+01,  -7.436311245e-02,  -6.574911594e+00,  -5.987613201e+00,  -5.492567062e+00,  3.741813660e+00,  -6.293245316e+00,  -5.927810192e+00,
+      2.596666098e+00,  2.511785030e+00,  -4.008016968e+01,  -9.502331734e+00,  -2.223744154e+00,  -9.386192322e+00,  2.133025408e+00,  7.180424929e-01,
+      -7.785650730e+00,  -1.465099239e+01,  -3.193116903e+00,  -7.322586060e+00,  -3.392373800e+00,  2.559076786e+00,  -7.266139030e+00,  -8.015305519e+00,
+      -2.954755211e+01,  -4.775386333e+00,  -7.018956184e+00,  3.027229905e-01
+    },
+    {
+      -1.956218338e+01,  5.707087517e-01,  -1.087921715e+01,  -3.032697439e+00,  -2.653781414e+00,  2.259181499e+00,  1.401765108e+00,  -5.316901684e+00,
+      -5.137407780e+00,  2.004573107e+00,  -2.105867767e+01,  -5.048538685e+00,  1.375523329e+00,  -9.571454048e+00,  -4.186445236e+00,  -1.485170275e-01,
+      -1.111863232e+01,  -1.345036888e+01,  -3.440728188e+00,  -3.767631292e+00,  1.362419963e+00,  -3.521770716e+00,  -6.966343403e+00,  -1.304931736e+01,
+      -2.568362617e+01,  8.178356290e-01,  -7.693387508e+00,  1.398517489e+00
+    },
+    {
+      -1.921207428e+01,  -9.476826787e-01,  -2.649687529e-01,  1.234940290e+00,  8.822354078e-01,  -2.426408052e+00,  3.669086099e-01,  -3.096010089e-01,
+      -1.102436447e+01,  -4.763398170e+00,  -1.922887230e+01,  -4.763224125e+00,  1.452123225e-01,  -1.528719187e+00,  1.836566329e+00,  4.399046600e-01,
+      -9.680025101e+00,  -5.468655109e+00,  -7.593086362e-01,  1.258035779e+00,  1.683677286e-01,  -6.039352417e+00,  5.446789786e-02,  -9.456459999e+00,
+      -1.537123680e+01,  -9.080592155e+00,  -5.110603809e+00,  -1.332725239e+01
+    },
+    {
+      -4.012496948e+01,  -1.758418798e+00,  -1.168580341e+01,  -6.510505676e+00,  -3.002501249e+00,  4.106655598e+00,  -1.764419937e+01,  -1.061786842e+01,
+      -1.041414547e+01,  2.065030575e+00,  -3.893991089e+01,  -2.995076752e+01,  -3.588899851e+00,  -1.690071869e+01,  -1.215499115e+01,  -3.190214634e+00,
+      -5.446431160e+00,  -2.530636215e+01,  -1.496811032e+00,  -3.690368414e+00,  -8.490032196e+00,  -4.024165630e+00,  -1.142727089e+01,  -7.073990822e+00,
+      -3.925718689e+01,  -2.057812661e-01,  -2.941570282e+01,  -6.474263221e-02
+    },
+    {
+      -2.113374519e+01,  -2.224079370e+00,  -9.786219597e+00,  -6.938436031e+00,  -6.549945831e+00,  2.566976309e+00,  -4.257105827e+00,  -9.000632286e+00,
+      -5.364515781e+00,  1.918416262e+00,  -2.688007355e+01,  -1.767314911e+01,  -1.743051887e+00,  -1.676671028e+01,  -5.690780163e+00,  -1.856716275e+00,
+      -4.035197258e+00,  -1.895182419e+01,  -4.727549851e-01,  -3.071265459e+00,  -4.934257984e+00,  -2.786042929e+00,  -8.727005959e+00,  -9.903007507e+00,
+      -2.997818947e+01,  2.139767885e+00,  -2.142636681e+01,  2.823195934e+00
+    },
+    {
+      -1.621308327e+01,  9.830970764e-01,  -1.044936943e+01,  -4.936704636e+00,  -5.684273317e-02,  2.363838673e+00,  -5.103206158e+00,  2.134186029e-01,
+      -2.750612259e+00,  2.425835371e+00,  -1.851944542e+01,  -7.059587955e+00,  -4.847835004e-01,  -9.953555107e+00,  -3.918548107e+00,  6.509215236e-01,
+      -6.307650566e+00,  -1.123643398e+01,  -3.312655210e+00,  -6.320003510e+00,  -4.009452760e-01,  -8.972911164e-03,  -6.578978896e-01,  -7.632739067e+00,
+      -2.496150780e+01,  1.420638561e+00,  -8.128468513e+00,  1.368946075e+00
+    },
+    {
+      -2.492164993e+01,  2.265603542e+00,  -2.072488070e+00,  -5.451938629e+00,  -2.789330482e+00,  2.476867676e+00,  -4.679448605e+00,  -5.833233833e+00,
+      -6.443885803e+00,  2.823099852e+00,  -4.167160416e+01,  -4.691044331e+00,  -2.452577114e+00,  -7.793429852e+00,  1.209148049e+00,  2.406346321e+00,
+      -5.353602886e+00,  -2.083701324e+01,  -4.599675655e+00,  -2.717598915e+00,  -2.870492458e+00,  -1.618583322e+00,  -5.440382481e+00,  -1.333916950e+01,
+      -3.067487335e+01,  -3.718536198e-01,  -9.593128204e+00,  -7.944140434e-01
+    },
+    {
+      -1.551721954e+01,  -6.381569058e-02,  -1.256379890e+01,  -3.457696736e-02,  1.079980612e+00,  5.461781621e-01,  -2.435042858e+00,  1.114321351e+00,
+      -7.272062302e+00,  1.024738550e+00,  -1.575064754e+01,  -3.012548447e+00,  -7.844121456e-01,  -1.123649502e+01,  -4.383164883e+00,  -7.449422479e-01,
+      -1.416487885e+01,  -4.764848709e+00,  -7.044881821e+00,  -7.423084378e-01,  1.137999773e+00,  -1.945822120e+00,  -8.068370819e+00,  -1.539807034e+01,
+      -1.818443871e+01,  -1.105579495e+00,  -5.138740063e+00,  1.252308339e-01
+    },
+    {
+      -2.151233101e+01,  -2.131458759e+00,  -3.058424711e+00,  -2.378981352e+00,  -5.334259868e-01,  -8.099390030e+00,  -4.967202663e+00,  -1.043057251e+01,
+      -1.646891212e+01,  -8.355509043e-01,  -1.458314800e+01,  -4.921223164e+00,  -5.149466991e-01,  1.060505033e+00,  1.137006164e+00,  -3.701385975e+00,
+      -1.877376437e+00,  -4.344460487e+00,  1.308636665e+00,  -4.480766878e-02,  7.073861957e-01,  1.218431830e+00,  -5.347678810e-02,  2.514842749e-01,
+      -1.565090179e+01,  -8.828467131e-01,  -1.924805069e+01,  -6.101060390e+00
+    },
+    {
+      -2.374827957e+01,  2.152109295e-01,  -1.029372787e+01,  -3.861883879e+00,  -9.011894226e+00,  4.504206777e-01,  -3.243038893e+00,  -8.098294258e+00,
+      1.372129917e+00,  1.726670146e+00,  -2.577883720e+01,  -1.188449192e+01,  6.704857349e-01,  -1.002192402e+01,  -5.618043423e+00,  -1.228421450e+00,
+      -5.711342335e+00,  -1.173909855e+01,  1.302681327e+00,  -3.984729290e+00,  1.880532861e+00,  -2.058769464e+00,  -6.782156467e+00,  -6.834701061e+00,
+      -2.026460648e+01,  6.815798879e-01,  -1.258615398e+01,  -1.908848882e+00
+    },
+    {
+      -1.533621216e+02,  -3.902837038e+00,  -4.700150299e+01,  -6.338317490e+01,  -2.037986755e+01,  -3.871168900e+01,  -1.237584114e+01,  -6.200049973e+01,
+      -1.090659485e+02,  -3.253701687e+00,  -1.605317535e+02,  -6.859577942e+01,  -1.283494949e+01,  1.545217752e+00,  9.986125827e-01,  5.121099472e+00,
+      -2.202777290e+01,  -1.005200043e+02,  -8.547355652e+00,  -5.477907562e+01,  -2.430871582e+01,  2.123489952e+01,  -4.234692383e+01,  -1.091423416e+01,
+      -1.714214630e+02,  -2.970182002e-01,  -2.583369446e+02,  -1.847055852e-01
+    },
+    {
+      -1.727468300e+01,  1.039333105e+00,  -1.294731736e+00,  -6.197353005e-01,  4.424301684e-01,  1.630505443e+00,  2.754175663e-01,  -1.392522216e+00,
+      -3.995616913e+00,  1.244359851e+00,  -2.494358253e+01,  -1.340767145e+00,  -2.288568258e+00,  -1.299243927e+00,  -3.521941602e-02,  6.735686660e-01,
+      -5.353134155e+00,  -8.730118752e+00,  -1.419262528e+00,  -4.037411213e-01,  -1.004751563e+00,  -7.234643698e-01,  -4.228069782e+00,  -7.546277046e+00,
+      -2.045260429e+01,  -7.806013525e-02,  -7.043612957e+00,  -1.107480645e+00
+    },
+    {
+      -1.525581551e+01,  -2.200273722e-01,  -4.673673630e+00,  -4.308591485e-01,  -5.204870224e+00,  1.472260952e+00,  -2.098924667e-01,  -7.078101635e+00,
+      4.305747151e-01,  1.744364738e+00,  -1.999062538e+01,  -3.811824083e+00,  2.605635226e-01,  -5.035708904e+00,  -3.722416401e+00,  4.274056554e-01,
+      -4.295914471e-01,  -3.981767654e+00,  -2.887421608e+00,  1.204261184e-02,  1.725739121e+00,  -4.069120884e-01,  -8.552170753e+00,  -4.352730751e+00,
+      -1.600853539e+01,  7.317728996e-01,  -9.028886795e+00,  -2.496663570e+00
+    },
+    {
+      -1.761193085e+01,  3.262357712e-01,  -5.395652771e+00,  -1.018160462e+00,  -5.694849968e+00,  1.798197150e+00,  -6.615116596e-01,  -6.853357792e+00,
+      -9.119786024e-01,  1.932144284e+00,  -1.606473160e+01,  -1.003845501e+01,  1.102432609e+00,  -8.466192245e+00,  -5.478028774e+00,  -1.587772071e-01,
+      -4.460076809e+00,  -1.193185997e+01,  2.638123184e-02,  -3.887532711e+00,  -2.101068497e+00,  -1.109208703e+00,  -9.216288567e+00,  -5.000150204e+00,
+      -1.679862595e+01,  5.438825488e-01,  -6.501290321e+00,  1.029525995e+00
+    },
+    {
+      -2.101540375e+01,  -1.098571420e+00,  -1.346915960e-03,  -2.103765011e-01,  -4.525706768e+00,  -5.266082287e-02,  -7.871488571e+00,  -4.740553379e+00,
+      -6.821297169e+00,  7.281515598e-01,  -1.714273262e+01,  -1.684737396e+01,  1.625658512e+00,  -7.878714561e+00,  1.322822452e+00,  -1.676874757e+00,
+      -1.197077870e+00,  -1.544843388e+01,  2.243475199e+00,  2.963909209e-01,  -1.215138674e+00,  -8.028328896e+00,  -4.766756535e+00,  -8.065870285e+00,
+      -5.679758549e+00,  -6.364809990e+00,  -7.667804718e+00,  -9.214262009e+00
+    },
+    {
+      -4.419813156e+01,  2.616107941e+00,  -1.180871010e+01,  -4.378880978e+00,  -3.785742760e+00,  4.302726746e+00,  -9.206176758e+00,  -6.304675102e+00,
+      -8.113165855e+00,  3.753218174e+00,  -6.410997772e+01,  -4.900300980e+00,  -5.041185856e+00,  -1.198728371e+01,  -2.893330812e+00,  2.849755287e+00,
+      -1.677383995e+01,  -1.833212852e+01,  -7.677204132e+00,  -7.746411324e+00,  -2.822268963e+00,  -2.788713455e+00,  -1.274592972e+01,  -2.770733833e+01,
+      -4.352381134e+01,  -4.719671011e-01,  -8.016011238e+00,  -4.716402054e+00
+    },
+    {
+      -2.758682823e+01,  2.111753702e+00,  -4.085173607e+00,  -4.430742264e+00,  -3.496346712e+00,  2.180203199e+00,  -5.340054035e+00,  -1.004814053e+01,
+      -4.455173016e+00,  1.442523479e+00,  -4.168050385e+01,  -5.305346966e+00,  -9.630176425e-01,  -1.209917641e+01,  1.475842953e+00,  -1.657483816e+00,
+      -1.162843132e+01,  -2.085244751e+01,  -4.540267467e+00,  -7.859177589e+00,  -2.918164730e+00,  -4.079196453e+00,  -6.081168175e+00,  -1.481701756e+01,
+      -4.160291290e+01,  3.694630861e-01,  -1.044585800e+01,  1.878353119e+00
+    },
+    {
+      -5.574137497e+01,  -2.035644293e+00,  -5.073798752e+01,  -1.673055649e+01,  -7.649730206e+00,  6.431151390e+00,  -2.393727303e+01,  -7.293779850e+00,
+      -2.810118675e+01,  1.196998477e+00,  -9.743899536e+01,  -1.551528549e+01,  -6.370763302e+00,  -3.365150070e+01,  -1.430642509e+01,  2.717792988e-02,
+      -5.182449722e+01,  -5.141524506e+01,  -2.214776039e+01,  -1.691605568e+01,  -6.961191177e+00,  -1.147171593e+01,  -3.055367279e+01,  -6.161575317e+01,
+      -8.284564209e+01,  -1.210414410e+00,  -4.633105850e+01,  1.914891362e+00
+    },
+    {
+      -2.495807838e+01,  4.857276380e-01,  -1.474086380e+01,  -6.757960320e+00,  -1.808970213e+00,  2.159251213e+00,  -8.461743355e+00,  -4.922774792e+00,
+      -6.146253586e+00,  -1.282876492e+00,  -4.502696991e+01,  -8.736458778e+00,  -3.400541067e+00,  -2.172837448e+01,  1.760335684e+00,  -3.458206654e+00,
+      -9.231765747e+00,  -3.366907501e+01,  -1.359977841e+00,  -8.466053963e+00,  -1.179867387e+00,  -1.057089424e+01,  -1.123560905e+01,  -1.737245369e+01,
+      -4.625935364e+01,  -9.257111549e+00,  -2.162756348e+01,  4.549629211e+00
+    },
+    {
+      -3.464596176e+01,  3.566364348e-01,  -1.157191467e+01,  -8.770931244e+00,  -4.519357681e+00,  3.807163000e+00,  -1.260642338e+01,  -6.881083012e+00,
+      -1.432667351e+01,  3.683327675e+00,  -4.771442795e+01,  -1.240758610e+01,  -4.338288903e-01,  -1.743711472e+01,  -8.308883667e+00,  -1.417719007e+00,
+      -1.117249012e+01,  -2.785459518e+01,  -2.499982119e+00,  -1.067214870e+01,  -5.905772686e+00,  -7.028459072e+00,  -7.366070271e+00,  -1.530528259e+01,
+      -4.725894928e+01,  3.327885866e+00,  -1.939447975e+01,  1.095625162e-01
+    },
+    {
+      -8.743639946e+00,  3.797693551e-01,  -3.569692135e+00,  -3.259220839e+00,  2.062856555e-01,  1.124131203e+00,  -2.073892355e+00,  -1.679388642e+00,
+      -2.925788164e+00,  5.630890131e-01,  -1.402285576e+01,  -2.171982288e+00,  -1.546340287e-01,  -4.496282101e+00,  -6.125681102e-02,  -7.277803421e-01,
+      -2.493612528e+00,  -1.186881638e+01,  -3.412976563e-01,  -3.461192608e+00,  -1.144397855e+00,  -2.379133224e+00,  -3.048214197e+00,  -3.917821407e+00,
+      -1.274512005e+01,  5.693532825e-01,  -6.066789150e+00,  9.289340377e-01
+    }
+  },
+  // pos 6
+  {
+    {
+      -2.113361931e+01,  -2.146195650e+00,  -2.341674805e+01,  -7.900478840e+00,  -2.391567230e+00,  2.135587215e+00,  -1.226316071e+01,  -3.449836969e+00,
+      -1.176177311e+01,  -2.774240494e+00,  -4.439419556e+01,  -6.283853531e+00,  -1.055408359e+00,  -1.510667515e+01,  -4.434421062e+00,  -6.236808777e+00,
+      -1.073862648e+01,  -3.341417694e+01,  -3.395447016e+00,  -5.611847401e+00,  -2.682234764e+00,  -1.482569027e+01,  -1.530002213e+01,  -1.457714176e+01,
+      -3.230136108e+01,  1.176145300e-01,  -2.822086334e+01,  3.944113731e+00
+    },
+    {
+      -2.753475761e+01,  -9.363410950e+00,  4.715099931e-01,  -4.099728912e-02,  -5.178123951e+00,  -4.758411407e+00,  -1.097095299e+01,  -5.075059414e+00,
+      -1.280232143e+01,  -2.087907553e+00,  -2.185569000e+01,  -6.538056374e+00,  2.449830532e+00,  -3.171640396e+00,  2.406485558e+00,  -1.132110405e+01,
+      -6.187350750e+00,  -1.456464577e+01,  2.001096249e+00,  -1.217537403e+00,  2.322844267e+00,  -7.972407818e+00,  -1.841155887e+00,  -2.300449371e+00,
+      -2.039042282e+01,  -6.600296497e+00,  -7.865273476e+00,  -1.690432167e+01
+    },
+    {
+      -2.640247917e+01,  1.032042623e+00,  1.266251445e+00,  -6.001015663e+00,  -5.524489403e+00,  -1.790976763e+00,  -6.079430103e+00,  -6.273713589e+00,
+      -1.262877274e+01,  2.382278204e+00,  -2.347236252e+01,  -6.878145218e+00,  2.603540182e+00,  -8.104372025e+00,  -2.981299162e+00,  -2.749769449e+00,
+      -3.774181843e+00,  -1.715276718e+01,  -5.980511308e-01,  -1.044003487e+01,  -3.431768417e+00,  -2.250703335e+00,  -5.746404648e+00,  -4.058084488e+00,
+      -3.412559128e+01,  -2.606104374e+00,  -1.307574272e+01,  -1.088907480e+00
+    },
+    {
+      -1.906812859e+01,  2.473145485e+00,  -1.679854774e+01,  -5.625776291e+00,  -4.159098625e+00,  1.575958967e+00,  -9.597864151e+00,  -4.759015560e+00,
+      3.084322214e-01,  5.840487480e-01,  -3.388695145e+01,  -8.686735481e-02,  -4.421819687e+00,  -2.056213188e+01,  -4.236561298e+00,  -2.548638344e+00,
+      -7.912921906e+00,  -2.031280708e+01,  -5.308099270e+00,  -4.904044628e+00,  1.546675920e+00,  -5.572055340e+00,  -1.310533047e+01,  -2.267016411e+01,
+      -3.519294357e+01,  -2.421289444e+00,  -1.452727032e+01,  2.805388927e+00
+    },
+    {
+      -2.452502060e+01,  9.172315896e-02,  -6.128594875e+00,  -6.414392471e+00,  -7.771495342e+00,  2.063340664e+00,  -6.346487045e+00,  -7.819387913e+00,
+      -5.753083706e+00,  2.390349150e+00,  -3.349969101e+01,  -1.352917957e+01,  1.110529542e+00,  -1.315713120e+01,  -4.775974751e+00,  -2.839202404e+00,
+      -6.404246330e+00,  -2.494891167e+01,  3.079623580e-01,  -1.167698574e+01,  -5.132587433e+00,  -5.628933907e+00,  -7.498715878e+00,  -3.892954111e+00,
+      -3.532574844e+01,  -2.673200369e+00,  -1.675724411e+01,  4.120828629e+00
+    },
+    {
+      -1.950704956e+01,  3.486745358e-01,  -3.658566952e+00,  -1.140935302e+00,  2.885925293e+00,  -2.869405746e+00,  -3.084869981e-01,  -2.823539734e+00,
+      -7.569340229e+00,  -3.467942953e+00,  -1.989260864e+01,  -7.536620617e+00,  -3.338050842e-01,  -9.335993767e+00,  9.983386993e-01,  -3.301619291e-01,
+      -2.642837524e+00,  -1.773065376e+01,  1.312400341e+00,  1.308632135e+00,  -6.950528622e-01,  -9.985199928e+00,  -6.987931252e+00,  -1.338080978e+01,
+      -2.485373878e+01,  -4.464498520e+00,  -6.771583557e+00,  1.911260962e+00
+    },
+    {
+      -4.756722260e+01,  -1.351317763e+00,  -1.176232147e+01,  -1.191600132e+01,  -8.145181656e+00,  -7.074533463e+00,  -2.949413538e+00,  -1.496608639e+01,
+      -1.879203415e+01,  2.633147240e+00,  -4.842406464e+01,  -1.636186409e+01,  -1.881863356e+00,  -7.294765472e+00,  -3.170724630e+00,  -1.265953183e-01,
+      -1.087789726e+01,  -3.039775467e+01,  -5.968065262e+00,  -1.646761513e+01,  -5.000777245e+00,  5.195825100e+00,  -1.139021397e+01,  -8.463966370e+00,
+      -5.654010010e+01,  -5.279006004e+00,  -4.515560913e+01,  3.346447229e+00
+    },
+    {
+      -2.466022301e+01,  -3.463684559e+00,  -1.538100147e+01,  -9.660977364e+00,  -4.704269409e+00,  2.320811510e+00,  -4.222721577e+00,  -5.986581802e+00,
+      -6.090594769e+00,  -3.584952116e+00,  -3.583384323e+01,  -1.218356133e+01,  1.174565196e+00,  -6.920231342e+00,  2.685840428e-01,  4.713726342e-01,
+      -6.163000584e+00,  -3.097876358e+01,  -2.679821491e+00,  -6.041806221e+00,  -3.480886698e+00,  -8.663281441e+00,  -1.317082500e+01,  -7.586247921e+00,
+      -3.385102844e+01,  -5.135514736e+00,  -2.171840477e+01,  3.256225109e+00
+    },
+    {
+      -2.734998512e+01,  1.301192522e+00,  -2.016332626e+01,  -3.705738544e+00,  -5.090077400e+00,  2.784703255e+00,  -2.639699459e+00,  -3.283105135e+00,
+      -9.434000969e+00,  2.006885767e+00,  -3.441606140e+01,  -6.035762310e+00,  -2.103950739e+00,  -1.986662865e+01,  -5.609147549e+00,  1.146929860e+00,
+      -2.846712875e+01,  -1.378563976e+01,  -1.041141891e+01,  -4.026010513e+00,  2.412566423e+00,  -2.830157042e+00,  -1.159947300e+01,  -3.476390839e+01,
+      -3.911702347e+01,  -2.411959648e+00,  -9.682528496e+00,  5.256204009e-01
+    },
+    {
+      -2.038728905e+01,  1.040977120e+00,  -4.572230279e-01,  1.968724370e+00,  -8.201774955e-01,  3.514395654e-01,  -1.738144904e-01,  -4.177401066e+00,
+      -1.173200989e+01,  -4.691092491e+00,  -2.552437401e+01,  -2.021962404e-01,  -6.764817238e-01,  -3.073957443e+00,  2.173033953e+00,  1.412513971e+00,
+      -1.325523186e+01,  -5.815938473e+00,  -3.274112940e+00,  -4.005498886e-01,  -4.846405983e-01,  -5.092561245e+00,  7.135394216e-02,  -1.232407665e+01,
+      -2.622933769e+01,  -1.045667267e+01,  -9.774897575e+00,  -5.829250813e+00
+    },
+    {
+      -3.560316849e+01,  -2.369925737e+00,  -7.389031887e+00,  -5.748867989e+00,  -7.075659752e+00,  3.347501755e+00,  -1.151311493e+01,  -1.142471218e+01,
+      -9.478582382e+00,  2.657205343e+00,  -3.575625992e+01,  -2.837515259e+01,  -1.267210722e+00,  -1.781784630e+01,  -1.064421749e+01,  -3.202790022e+00,
+      -3.402860641e+00,  -2.576303864e+01,  -7.239422202e-01,  -2.660359144e+00,  -9.598355293e+00,  -5.153297424e+00,  -1.188669014e+01,  -4.432055950e+00,
+      -3.664794540e+01,  7.848983407e-01,  -2.818670845e+01,  3.482733965e+00
+    },
+    {
+      -3.012043762e+01,  -1.051331520e+00,  -1.315412235e+01,  -8.872984886e+00,  -7.925997734e+00,  3.698068380e+00,  -6.942697525e+00,  -8.338126183e+00,
+      -9.290909767e+00,  3.950381041e+00,  -4.842555237e+01,  -1.395790386e+01,  -3.994941235e+00,  -2.019302177e+01,  -5.717627525e+00,  -1.792532741e-03,
+      -1.407808495e+01,  -2.534092712e+01,  -5.212954521e+00,  -9.296615601e+00,  -4.743875980e+00,  -1.764327645e+00,  -1.171435642e+01,  -1.975634003e+01,
+      -4.845736694e+01,  8.111830354e-01,  -2.398644829e+01,  1.543681264e+00
+    },
+    {
+      -2.074615860e+01,  1.063947916e+00,  -1.188311481e+01,  -9.525643349e+00,  -3.187809944e+00,  3.109965086e+00,  -5.444119453e+00,  -3.519556522e+00,
+      -7.522556782e+00,  2.062735558e+00,  -3.037266350e+01,  -1.069975853e+01,  -2.292464495e+00,  -1.144007587e+01,  -4.572781563e+00,  6.304172277e-01,
+      -7.042090416e+00,  -2.901733017e+01,  -2.650818229e-01,  -1.038789749e+01,  -2.974888325e+00,  -2.836874008e+00,  -5.075964928e+00,  -7.551545143e+00,
+      -3.080381584e+01,  1.682387590e+00,  -1.796371078e+01,  2.283700228e+00
+    },
+    {
+      -2.603053284e+01,  1.746090174e+00,  -1.347177696e+01,  -8.459140778e+00,  -2.144595385e+00,  3.461772680e+00,  -1.136867332e+01,  -6.203036785e+00,
+      -8.044794083e+00,  2.668943882e+00,  -5.132458496e+01,  -3.774126768e+00,  -2.292442322e+00,  -1.706170082e+01,  -1.404490590e+00,  -1.386003017e+00,
+      -1.466613579e+01,  -2.597389412e+01,  -6.465699673e+00,  -5.836186886e+00,  -3.658071041e+00,  -5.209802628e+00,  -7.415007591e+00,  -2.036258316e+01,
+      -4.283830261e+01,  1.678713560e+00,  -1.711172676e+01,  1.660924673e+00
+    },
+    {
+      -1.767448616e+01,  8.320386410e-01,  -1.848833275e+01,  -2.201718569e+00,  -4.879640341e-01,  8.086999655e-01,  -4.025286198e+00,  2.147543430e+00,
+      -7.295048237e+00,  7.083511949e-01,  -1.928363800e+01,  -5.453410149e+00,  -3.180312634e+00,  -1.844582558e+01,  -5.261168003e+00,  -9.726665020e-01,
+      -2.083164597e+01,  -1.547429943e+01,  -7.527745247e+00,  -2.786986113e+00,  1.799322605e+00,  -3.618134499e+00,  -1.188752937e+01,  -2.482971573e+01,
+      -2.368895721e+01,  -2.918561697e+00,  -1.032226086e+01,  1.563809514e+00
+    },
+    {
+      -2.222573471e+01,  9.659776837e-02,  -6.417538643e+00,  -7.827435970e+00,  3.708904386e-01,  -8.227819443e+00,  -4.390151024e+00,  -1.308110523e+01,
+      -1.870336914e+01,  -1.875484347e+00,  -2.382984734e+01,  -8.664490700e+00,  -2.422071695e+00,  1.126028538e+00,  2.017750263e+00,  -1.221798182e+00,
+      3.843191862e-01,  -1.496638680e+01,  1.378774643e+00,  -3.411135674e+00,  -1.766090155e+00,  2.674158812e+00,  -2.941695213e+00,  -9.733418226e-01,
+      -2.359566498e+01,  2.746412456e-01,  -3.438938522e+01,  3.370172381e-01
+    },
+    {
+      -3.812672424e+01,  -1.442203641e+00,  -1.813932610e+01,  -5.430654049e+00,  -1.178161812e+01,  -2.105005264e+00,  -4.414167404e+00,  -7.344898701e+00,
+      -2.536053181e+00,  2.483235359e+00,  -3.079075050e+01,  -1.838145638e+01,  -1.030429006e+00,  -1.891955185e+01,  -6.827515125e+00,  -2.406735420e+00,
+      -1.964547539e+01,  -1.763467979e+01,  -2.673193216e+00,  -7.820113659e+00,  2.903639793e+00,  2.565248251e+00,  -1.125851917e+01,  -1.537998009e+01,
+      -3.592670441e+01,  -3.767797232e+00,  -2.428225708e+01,  -2.920685291e+00
+    },
+    {
+      -1.599362335e+02,  -4.809571743e+00,  -5.088061523e+01,  -6.791045380e+01,  -2.243116379e+01,  -3.850201035e+01,  -9.513343811e+00,  -6.157437134e+01,
+      -1.149222488e+02,  -3.981111288e+00,  -1.681806030e+02,  -7.296965790e+01,  -1.322444820e+01,  1.355672002e+00,  4.216994047e-01,  6.741012573e+00,
+      -2.616906929e+01,  -1.069908447e+02,  -9.904758453e+00,  -5.837659836e+01,  -2.581019783e+01,  2.259575081e+01,  -4.717428970e+01,  -1.268710899e+01,
+      -1.799390259e+02,  -7.513121963e-01,  -2.759257507e+02,  -5.295387506e-01
+    },
+    {
+      -1.899238014e+01,  1.199882865e+00,  -4.308461189e+00,  -4.516870975e+00,  1.361516565e-01,  1.891846895e+00,  -7.605413198e-01,  -2.757383347e+00,
+      -5.579379082e+00,  1.523886442e+00,  -2.886975479e+01,  -8.803285956e-01,  -1.330225706e+00,  -6.366862297e+00,  2.350467741e-01,  1.548064590e+00,
+      -7.323787212e+00,  -1.282173538e+01,  -3.351346254e+00,  -4.574509621e+00,  -1.084729671e+00,  -8.200582862e-01,  -5.478704929e+00,  -1.126637745e+01,
+      -2.916370201e+01,  2.481477261e-01,  -8.957994461e+00,  2.282218784e-01
+    },
+    {
+      -1.481546402e+01,  9.910854697e-02,  -8.452489853e+00,  2.325119376e-01,  -5.494454384e+00,  1.756703258e+00,  -2.698188782e+00,  -7.008007050e+00,
+      1.600976467e+00,  2.131347418e+00,  -2.140723228e+01,  -5.596086025e+00,  -1.941657782e+00,  -1.417422485e+01,  -3.962934017e+00,  1.441787630e-01,
+      -2.689080000e+00,  9.216721058e-01,  -2.990770817e+00,  9.532804489e-01,  2.233845472e+00,  -2.563122511e+00,  -1.332045364e+01,  -1.369211292e+01,
+      -2.422376442e+01,  -3.922825575e+00,  -7.274672031e+00,  -1.766670823e+00
+    },
+    {
+      -1.398847389e+01,  -1.669180036e+00,  -1.146816254e+01,  -3.455713034e+00,  -5.823725224e+00,  2.090195656e+00,  -8.425535262e-02,  -4.416271687e+00,
+      -3.992256522e-01,  2.341503143e+00,  -1.963869095e+01,  -1.199448776e+01,  -2.245022535e+00,  -1.177741337e+01,  -4.287562370e+00,  -3.986803889e-01,
+      -7.772089005e+00,  -1.672876358e+01,  2.477131784e-01,  -5.958357334e+00,  4.101230502e-01,  -4.566788673e-01,  -6.039401054e+00,  -6.916278839e+00,
+      -2.526546669e+01,  2.132313848e-01,  -1.388633633e+01,  2.154118538e+00
+    },
+    {
+      -1.485664749e+01,  -6.576514840e-01,  -3.549545288e+00,  -1.964859128e+00,  -1.104896641e+01,  1.539638042e-01,  -1.498303127e+01,  -1.185072422e+01,
+      -7.251043320e+00,  -2.904003620e+00,  -1.620924950e+01,  -1.475249577e+01,  1.205623388e+00,  -1.398759079e+01,  3.345242143e-01,  4.004198015e-01,
+      -5.358353257e-01,  -1.474015331e+01,  6.355982423e-01,  1.716775298e+00,  -5.021793246e-01,  -1.535431957e+01,  -7.662117958e+00,  -9.951401711e+00,
+      -1.446655560e+01,  -7.364993095e+00,  -1.510869026e+01,  -5.988479614e+00
+    },
+    {
+      -4.738908386e+01,  6.979695559e-01,  -2.184527969e+01,  -6.678396225e+00,  -4.780217648e+00,  5.074292660e+00,  -1.637121773e+01,  -6.703458309e+00,
+      -1.156541348e+01,  4.248007298e+00,  -7.664646912e+01,  -6.109930515e+00,  -5.365255833e+00,  -2.612665367e+01,  -6.874850273e+00,  1.548976004e-01,
+      -2.928809547e+01,  -2.584704971e+01,  -1.206605911e+01,  -1.030777645e+01,  -5.012865067e+00,  -4.585349083e+00,  -2.002692986e+01,  -3.915596771e+01,
+      -5.470068741e+01,  -2.223581553e+00,  -1.574230385e+01,  -2.339381218e+00
+    },
+    {
+      -3.674158859e+01,  8.836063147e-01,  -7.154645920e+00,  -6.532897472e+00,  -3.082566261e+00,  3.855153799e+00,  -9.443236351e+00,  -1.154531479e+01,
+      -6.663796425e+00,  2.805488110e+00,  -6.628638458e+01,  -6.491105556e+00,  -2.945493698e+00,  -1.621781540e+01,  2.380290926e-01,  -2.515975952e+00,
+      -1.579637146e+01,  -2.940407372e+01,  -6.746817589e+00,  -1.057379627e+01,  -2.677323103e+00,  -7.289506912e+00,  -6.629463673e+00,  -2.118970299e+01,
+      -6.394151688e+01,  3.489300966e+00,  -1.878493309e+01,  2.999784231e+00
+    },
+    {
+      -6.357188034e+01,  -3.742458820e+00,  -6.941065979e+01,  -2.344539833e+01,  -8.605379105e+00,  7.529882908e+00,  -3.207305145e+01,  -7.610493660e+00,
+      -3.823509216e+01,  -2.503288269e+00,  -1.182319794e+02,  -1.974277687e+01,  -6.795412064e+00,  -4.495580292e+01,  -1.803299141e+01,  -3.634350538e+00,
+      -5.864634705e+01,  -7.356323242e+01,  -2.460359955e+01,  -1.898667908e+01,  -8.955578804e+00,  -2.170710373e+01,  -4.359038925e+01,  -7.411573029e+01,
+      -9.795032501e+01,  -1.603863478e+00,  -6.632096100e+01,  7.010589600e+00
+    },
+    {
+      -3.223102570e+01,  2.587936640e+00,  -2.569459343e+01,  -7.778047562e+00,  -2.880417347e+00,  2.161609411e+00,  -1.414689445e+01,  -4.997232437e+00,
+      -6.104924679e+00,  -2.735266685e+00,  -5.902194214e+01,  -2.504774570e+00,  -5.862637997e+00,  -2.821461678e+01,  -1.432382345e+00,  -6.793515205e+00,
+      -1.266682339e+01,  -4.215467834e+01,  -4.786057472e+00,  -1.037140751e+01,  2.125735998e+00,  -1.581023407e+01,  -1.548080730e+01,  -2.798693657e+01,
+      -6.265915298e+01,  -7.980009079e+00,  -2.857041359e+01,  5.368939877e+00
+    },
+    {
+      -3.705125046e+01,  -9.819781780e-01,  -2.464496040e+01,  -1.463954926e+01,  -5.254665852e+00,  4.994153976e+00,  -2.076283455e+01,  -8.395432472e+00,
+      -2.051534271e+01,  1.406861067e+00,  -6.807106781e+01,  -1.835227013e+01,  -1.266303420e+00,  -2.386761665e+01,  -8.842690468e+00,  -4.866358757e+00,
+      -1.423262310e+01,  -4.740113449e+01,  -3.219367981e+00,  -1.389564800e+01,  -8.908141136e+00,  -1.528637600e+01,  -1.443338013e+01,  -1.992334557e+01,
+      -5.778879929e+01,  3.574600935e+00,  -3.743140030e+01,  4.147339821e+00
+    },
+    {
+      -1.771565056e+01,  -1.221929908e+00,  -1.714641762e+01,  -9.679835320e+00,  -1.181594849e+00,  1.683304787e+00,  -8.070948601e+00,  -4.360239983e+00,
+      -1.018049812e+01,  -2.057874441e+00,  -3.576164246e+01,  -6.319540501e+00,  1.254907250e-02,  -1.004452896e+01,  -1.969667554e+00,  -4.116100311e+00,
+      -5.700606823e+00,  -2.978775978e+01,  -1.709247112e+00,  -6.787093163e+00,  -3.024963140e+00,  -1.051608562e+01,  -1.208482933e+01,  -9.705760956e+00,
+      -2.833250809e+01,  1.575932622e+00,  -2.697996902e+01,  3.403922319e+00
+    }
+  },
+  // pos 7
+  {
+    {
+      -3.326105499e+01,  -3.420966387e+00,  -3.687441635e+01,  -1.256017303e+01,  -4.010833263e+00,  2.616456270e+00,  -1.731156731e+01,  -6.232414722e+00,
+      -1.982912827e+01,  -5.001753807e+00,  -6.877517700e+01,  -1.000964355e+01,  -1.723447800e+00,  -2.184761810e+01,  -6.892928600e+00,  -9.123721123e+00,
+      -1.589714527e+01,  -5.091584778e+01,  -5.235039711e+00,  -8.122902870e+00,  -3.799472570e+00,  -2.283227348e+01,  -2.439669609e+01,  -2.404194832e+01,
+      -5.197743988e+01,  -9.375410527e-02,  -4.672882843e+01,  6.250916004e+00
+    },
+    {
+      -2.590549850e+01,  -9.240162849e+00,  -3.628835440e+00,  -3.103923202e-01,  -5.776301861e+00,  -3.707077265e+00,  -1.002820778e+01,  -4.674467564e+00,
+      -1.094631767e+01,  -4.190442562e+00,  -2.641619682e+01,  -9.126605988e+00,  3.137209892e+00,  -5.224824905e+00,  2.288949251e+00,  -1.132173729e+01,
+      -6.340618610e+00,  -1.619098282e+01,  9.945572615e-01,  2.520966232e-01,  8.006494641e-01,  -1.430436134e+01,  -9.587187320e-02,  2.749097906e-02,
+      -1.936761856e+01,  -4.797485352e+00,  -6.690460205e+00,  -1.102818871e+01
+    },
+    {
+      -2.988755608e+01,  -1.439702153e+00,  -7.756995678e+00,  -9.076173782e+00,  -4.796322823e+00,  -1.469312549e+00,  -9.664618492e+00,  -6.712897301e+00,
+      -2.291155243e+01,  -1.359809160e+00,  -4.195186615e+01,  -6.108192921e+00,  3.730277300e+00,  -8.757966995e+00,  -1.947310805e+00,  -6.188182354e+00,
+      -4.811545372e+00,  -2.838004112e+01,  -1.584555268e+00,  -1.030328274e+01,  -5.248600006e+00,  -1.312385178e+01,  -1.037645626e+01,  -7.043411732e+00,
+      -3.817026520e+01,  2.132669210e+00,  -2.453580856e+01,  -7.915277481e-01
+    },
+    {
+      -2.417744637e+01,  2.936441660e+00,  -2.200541687e+01,  -6.295905113e+00,  -3.877398252e+00,  1.854939103e+00,  -1.380086517e+01,  -5.907994747e+00,
+      -1.458950162e+00,  -1.284077406e+00,  -4.634562683e+01,  1.806204319e-01,  -4.977283001e+00,  -2.545242500e+01,  -3.201535702e+00,  -5.449346066e+00,
+      -1.025410843e+01,  -3.028851318e+01,  -6.473786831e+00,  -4.592900753e+00,  1.640460014e+00,  -1.199147034e+01,  -1.512529373e+01,  -2.766972351e+01,
+      -4.699573135e+01,  -5.025613308e+00,  -2.147487068e+01,  4.079817772e+00
+    },
+    {
+      -3.003844261e+01,  -1.224284172e+00,  -1.273948479e+01,  -1.080357361e+01,  -7.676050186e+00,  2.199490547e+00,  -7.102600098e+00,  -9.082304001e+00,
+      -1.122472286e+01,  7.662084103e-01,  -4.744704056e+01,  -1.532430649e+01,  1.397891283e+00,  -1.395336533e+01,  -5.238042355e+00,  -4.002651215e+00,
+      -7.944323540e+00,  -3.387151337e+01,  -9.374496341e-01,  -1.505354214e+01,  -6.314524651e+00,  -1.017495251e+01,  -1.165486717e+01,  -6.369286537e+00,
+      -4.572336960e+01,  -1.759355545e+00,  -2.726938248e+01,  5.184897423e+00
+    },
+    {
+      -2.011983681e+01,  -2.183305502e+00,  -6.363233566e+00,  -5.835989714e-01,  3.995194674e+00,  -3.246409893e-01,  -5.322902679e+00,  -4.753903866e+00,
+      -7.974210262e+00,  -4.089944839e+00,  -3.722261047e+01,  -7.314336300e+00,  -1.238096952e-01,  -8.513835907e+00,  2.296394587e+00,  -4.126030922e+00,
+      -3.748037219e-01,  -2.783816338e+01,  7.854696512e-01,  2.436516285e+00,  -3.038684368e+00,  -1.891831779e+01,  -7.183050156e+00,  -1.345525932e+01,
+      -2.491943932e+01,  -6.194701195e+00,  -1.041001320e+01,  2.995022297e+00
+    },
+    {
+      -5.029896164e+01,  -1.692736387e+00,  -1.978516960e+01,  -1.705747986e+01,  -1.027977276e+01,  -4.478692532e+00,  -4.341856003e+00,  -8.850593567e+00,
+      -2.127291107e+01,  2.468227386e+00,  -5.490390015e+01,  -1.980988884e+01,  -5.254233360e+00,  -8.513602257e+00,  -3.875320673e+00,  7.093540430e-01,
+      -1.754052925e+01,  -3.158676529e+01,  -1.062219620e+01,  -2.028845406e+01,  -6.742218018e+00,  6.524615765e+00,  -1.608442497e+01,  -1.361170387e+01,
+      -5.852499771e+01,  -1.298868775e+00,  -6.154724884e+01,  9.664845467e-01
+    },
+    {
+      -4.484403229e+01,  -6.654335499e+00,  -4.233334351e+01,  -1.924540710e+01,  -4.022790909e+00,  1.516599804e-01,  -1.292983627e+01,  -7.122553825e+00,
+      -2.704264641e+01,  -9.542816162e+00,  -7.950875854e+01,  -1.629882622e+01,  -4.346440434e-01,  -1.881645203e+01,  -4.219830513e+00,  -4.529593945e+00,
+      -1.644091034e+01,  -6.338750076e+01,  -6.441958904e+00,  -8.983370781e+00,  -4.245050430e+00,  -2.452552414e+01,  -2.893564224e+01,  -2.739885521e+01,
+      -6.306739426e+01,  -3.970624208e+00,  -6.565702820e+01,  7.060397625e+00
+    },
+    {
+      -3.697729492e+01,  -1.790826559e+00,  -4.180216217e+01,  -9.521968842e+00,  -5.386287689e+00,  4.179081440e+00,  -1.707921600e+01,  -3.485415459e+00,
+      -2.002474976e+01,  -2.549238682e+00,  -6.409003448e+01,  -1.089190006e+01,  -3.921059370e+00,  -3.407819748e+01,  -8.910302162e+00,  -3.342946053e+00,
+      -4.234493637e+01,  -4.081596375e+01,  -1.468007755e+01,  -6.413327217e+00,  -1.508416414e+00,  -1.583258724e+01,  -2.500414848e+01,  -5.140933228e+01,
+      -5.611663437e+01,  -4.178154945e+00,  -3.169124794e+01,  3.289309740e+00
+    },
+    {
+      -2.143305969e+01,  1.471817017e+00,  -3.049130678e+00,  2.132278204e+00,  7.637461424e-01,  9.177610874e-01,  -3.006524563e+00,  -4.084960461e+00,
+      -1.063107586e+01,  -3.646009684e+00,  -2.914202118e+01,  1.000415087e+00,  -7.522699237e-01,  -4.153984547e+00,  2.724913359e+00,  -2.425240517e+00,
+      -1.562699795e+01,  -5.772860527e+00,  -4.072901726e+00,  -2.344215393e+00,  7.585156709e-02,  -6.762993336e+00,  1.104331851e+00,  -1.345636082e+01,
+      -3.749886703e+01,  -7.886308193e+00,  -1.131120682e+01,  -5.172508240e+00
+    },
+    {
+      -2.951816559e+01,  -2.189038754e+00,  -7.453980446e+00,  -6.094923019e+00,  -9.243208885e+00,  3.083730221e+00,  -7.784970284e+00,  -1.085937881e+01,
+      -8.182530403e+00,  3.017405987e+00,  -4.134387970e+01,  -2.301303673e+01,  2.283114493e-01,  -1.786599731e+01,  -7.407547474e+00,  -3.867776632e+00,
+      -4.709824562e+00,  -2.926613808e+01,  -2.572567761e-01,  -6.608813763e+00,  -8.906199455e+00,  -8.120265007e+00,  -1.165659332e+01,  -6.024968147e+00,
+      -3.870907593e+01,  9.181674123e-01,  -2.354969025e+01,  4.513689518e+00
+    },
+    {
+      -4.352359390e+01,  -1.304176807e+00,  -3.480376816e+01,  -1.474484825e+01,  -9.352043152e+00,  5.833260059e+00,  -1.948395538e+01,  -1.021761608e+01,
+      -2.031513977e+01,  8.956062198e-01,  -7.643710327e+01,  -1.497546577e+01,  -4.868378639e+00,  -3.448431778e+01,  -9.480278015e+00,  -2.782808304e+00,
+      -3.567364502e+01,  -5.099629974e+01,  -1.263722229e+01,  -1.342292213e+01,  -7.051630974e+00,  -1.180613041e+01,  -2.396912003e+01,  -4.350162125e+01,
+      -6.787808228e+01,  -1.191511512e+00,  -4.255720139e+01,  4.093517780e+00
+    },
+    {
+      -2.372156715e+01,  8.544982076e-01,  -1.724415016e+01,  -1.319259739e+01,  -4.154006004e+00,  3.098083496e+00,  -7.304867744e+00,  -4.879083633e+00,
+      -9.971211433e+00,  1.254842281e+00,  -3.891903305e+01,  -1.017316246e+01,  -2.496782303e+00,  -1.524810028e+01,  -3.997221470e+00,  -1.762467980e+00,
+      -8.883999825e+00,  -3.706187820e+01,  -1.393476486e+00,  -1.418317795e+01,  -3.104976177e+00,  -5.112818718e+00,  -9.673613548e+00,  -9.993605614e+00,
+      -3.925244141e+01,  2.137791872e+00,  -2.644984818e+01,  3.960679770e+00
+    },
+    {
+      -3.762402344e+01,  8.358564973e-01,  -3.102586174e+01,  -1.262343407e+01,  -2.451392174e+00,  5.433732510e+00,  -2.078596115e+01,  -7.825460911e+00,
+      -1.623720932e+01,  1.698623061e+00,  -7.298115540e+01,  -5.463133812e+00,  -3.217791080e+00,  -2.898325920e+01,  -6.237698078e+00,  -4.611814022e+00,
+      -3.051987267e+01,  -4.160362244e+01,  -9.974910736e+00,  -1.031382275e+01,  -5.393363953e+00,  -1.166292095e+01,  -1.624027061e+01,  -3.711167908e+01,
+      -6.004791260e+01,  1.596478224e+00,  -3.285240173e+01,  2.906225443e+00
+    },
+    {
+      -2.002767372e+01,  4.365683198e-01,  -2.299180603e+01,  -7.101859450e-01,  -5.537831187e-01,  1.011687875e+00,  -6.056458473e+00,  2.957652569e+00,
+      -8.070978165e+00,  4.153896570e-01,  -2.680978966e+01,  -5.489773273e+00,  -4.788218021e+00,  -2.144142342e+01,  -5.248130322e+00,  -2.365785122e+00,
+      -2.595429230e+01,  -1.957798767e+01,  -8.651841164e+00,  -3.366232395e+00,  2.348829269e+00,  -6.449996948e+00,  -1.438924408e+01,  -3.080844498e+01,
+      -2.765919113e+01,  -3.490034342e+00,  -1.095372295e+01,  1.883064032e+00
+    },
+    {
+      -2.987749672e+01,  -1.230428576e+00,  -9.414741516e+00,  -1.436439133e+01,  -1.853325605e+00,  -7.586348057e+00,  -6.614950895e-01,  -1.333940125e+01,
+      -2.443906593e+01,  -2.735680103e+00,  -3.101218605e+01,  -1.410346794e+01,  -2.073216200e+00,  2.430306196e+00,  1.563296556e+00,  2.224630356e+00,
+      -9.976335764e-01,  -2.313420868e+01,  1.645506144e+00,  -8.262334824e+00,  -5.020729542e+00,  4.593495369e+00,  -8.938745499e+00,  1.766539216e+00,
+      -3.072919655e+01,  -1.826902270e+00,  -5.661845398e+01,  -4.174273312e-01
+    },
+    {
+      -4.472642517e+01,  -1.724130511e+00,  -2.443922615e+01,  -6.767118931e+00,  -1.436601162e+01,  -1.161992192e+00,  -8.750308037e+00,  -7.273783684e+00,
+      -8.401316643e+00,  4.085522175e+00,  -4.299765396e+01,  -2.334986305e+01,  -2.461045980e+00,  -2.830098534e+01,  -9.384576797e+00,  -2.924511433e+00,
+      -3.274448776e+01,  -2.760389900e+01,  -8.799501419e+00,  -1.302658749e+01,  1.191828012e+00,  1.452737093e+00,  -1.548773003e+01,  -2.696325302e+01,
+      -5.109764481e+01,  -6.470578194e+00,  -2.902878571e+01,  -1.129501104e+00
+    },
+    {
+      -1.666775208e+02,  -5.686301708e+00,  -5.500343323e+01,  -7.231126404e+01,  -2.536170959e+01,  -3.802041626e+01,  -6.191177845e+00,  -6.134778214e+01,
+      -1.204202957e+02,  -4.719273567e+00,  -1.761741180e+02,  -7.703802490e+01,  -1.337957096e+01,  1.281941414e+00,  -3.679711521e-01,  8.678627014e+00,
+      -3.040630913e+01,  -1.134872742e+02,  -1.167771339e+01,  -6.193165588e+01,  -2.734858131e+01,  2.402642632e+01,  -5.219898987e+01,  -1.462319088e+01,
+      -1.895793610e+02,  -1.488344312e+00,  -2.925201721e+02,  -6.946765184e-01
+    },
+    {
+      -2.226670265e+01,  1.221058249e+00,  -1.122006607e+01,  -8.024010658e+00,  1.539918780e+00,  2.743346453e+00,  -3.790158033e+00,  -5.438438416e+00,
+      -9.696618080e+00,  4.476030469e-01,  -3.477821732e+01,  -2.726352692e+00,  6.456813812e-01,  -1.075127792e+01,  3.673505187e-01,  -1.122280359e+00,
+      -1.203558159e+01,  -2.388865852e+01,  -3.667410374e+00,  -6.902372837e+00,  -2.657002449e+00,  -4.746264458e+00,  -9.144997597e+00,  -1.688165283e+01,
+      -3.332461548e+01,  1.575733662e+00,  -1.960512352e+01,  1.050915837e+00
+    },
+    {
+      -1.749987411e+01,  -1.892568827e+00,  -1.876574516e+01,  -2.323923349e+00,  -4.244644642e+00,  2.079197645e+00,  -8.395994186e+00,  -6.584611416e+00,
+      1.915918708e+00,  -1.559199333e+00,  -3.464668274e+01,  -6.176549435e+00,  -2.169716597e+00,  -2.237681198e+01,  -3.421352386e+00,  -3.623951197e+00,
+      -5.629134655e+00,  -9.078300476e+00,  -2.733896255e+00,  3.432866335e+00,  8.898081779e-01,  -1.537883854e+01,  -1.760629463e+01,  -1.939861298e+01,
+      -3.555785370e+01,  -7.098235130e+00,  -1.779167747e+01,  3.353615999e+00
+    },
+    {
+      -2.343569756e+01,  -2.503656864e+00,  -2.046815491e+01,  -4.946114540e+00,  -8.184493065e+00,  3.372493505e+00,  -6.098992825e+00,  -4.986873627e+00,
+      -6.868435860e+00,  3.267529488e+00,  -3.616333008e+01,  -1.731004715e+01,  -3.949560165e+00,  -2.354416656e+01,  -9.013106346e+00,  -2.296401978e+00,
+      -1.999449730e+01,  -2.673344040e+01,  -3.988542080e+00,  -8.889023781e+00,  -2.233781099e+00,  -3.437820911e+00,  -1.304442310e+01,  -1.758356857e+01,
+      -3.863851929e+01,  -2.043425322e+00,  -1.939812851e+01,  3.608546019e+00
+    },
+    {
+      -1.870789146e+01,  -3.535197496e+00,  -6.232330799e+00,  -2.388131618e-01,  -1.457987499e+01,  -1.357884884e+00,  -2.148402786e+01,  -1.473259544e+01,
+      -1.012312794e+01,  -6.179382324e+00,  -2.805134583e+01,  -1.458741379e+01,  2.625027895e+00,  -1.938016510e+01,  7.172451019e-01,  -2.925841570e+00,
+      -3.265534878e+00,  -1.660216522e+01,  -1.247788906e+00,  2.495889187e+00,  -8.930885233e-03,  -2.469933128e+01,  -1.170351410e+01,  -1.140827656e+01,
+      -2.224114037e+01,  -9.606460571e+00,  -1.989830399e+01,  -7.295377254e+00
+    },
+    {
+      -4.602929306e+01,  -1.574634671e+00,  -3.877476501e+01,  -1.041730309e+01,  -5.379644394e+00,  5.952723503e+00,  -2.333648109e+01,  -8.057964325e+00,
+      -1.804672050e+01,  1.680432439e+00,  -8.118981934e+01,  -8.849459648e+00,  -4.430690289e+00,  -3.729580688e+01,  -1.134929085e+01,  -3.436578035e+00,
+      -4.113146210e+01,  -3.661595154e+01,  -1.531029892e+01,  -1.060403824e+01,  -6.363502026e+00,  -1.169172478e+01,  -2.743926430e+01,  -4.906599808e+01,
+      -6.407108307e+01,  -2.299548864e+00,  -3.270599747e+01,  1.434927344e+00
+    },
+    {
+      -3.775572968e+01,  -2.545845509e-01,  -9.241348267e+00,  -4.037877560e+00,  -1.077094316e+00,  3.278814793e+00,  -1.223210716e+01,  -1.304067707e+01,
+      -8.000263214e+00,  -3.515056372e-01,  -8.132044220e+01,  -6.425935268e+00,  -2.784976721e+00,  -1.503979206e+01,  3.428561211e+00,  -6.219554424e+00,
+      -1.878401566e+01,  -3.622175217e+01,  -7.891951561e+00,  -7.944354534e+00,  -3.247582197e+00,  -1.638996124e+01,  -6.317094326e+00,  -2.420993423e+01,
+      -6.983439636e+01,  2.908788204e+00,  -2.196425056e+01,  3.229064226e+00
+    },
+    {
+      -7.285685730e+01,  -5.703310966e+00,  -8.467802429e+01,  -3.105633354e+01,  -9.300848007e+00,  7.028615475e+00,  -3.844496918e+01,  -8.675362587e+00,
+      -4.838038635e+01,  -7.087900162e+00,  -1.394185944e+02,  -2.489245796e+01,  -7.182166576e+00,  -5.446256256e+01,  -1.916819954e+01,  -7.653875828e+00,
+      -5.790214157e+01,  -9.584463501e+01,  -2.483345413e+01,  -2.107400894e+01,  -1.072270870e+01,  -3.303638840e+01,  -5.590868378e+01,  -7.988721466e+01,
+      -1.120927734e+02,  -1.677899003e+00,  -9.203060150e+01,  1.084919739e+01
+    },
+    {
+      -3.758212662e+01,  8.307324052e-01,  -4.002793503e+01,  -1.101496029e+01,  -2.922252893e+00,  3.159212112e+00,  -1.970029640e+01,  -5.166591644e+00,
+      -1.157573795e+01,  -5.552394390e+00,  -7.487648773e+01,  -1.340313554e+00,  -6.834017754e+00,  -3.216070175e+01,  -3.498412132e+00,  -1.006346893e+01,
+      -1.637281799e+01,  -5.386434555e+01,  -5.988721848e+00,  -1.114423370e+01,  2.304734230e+00,  -2.336550903e+01,  -2.226664162e+01,  -3.349190521e+01,
+      -7.172064209e+01,  -6.325692654e+00,  -4.222071075e+01,  6.599487782e+00
+    },
+    {
+      -4.392409897e+01,  -3.169600487e+00,  -4.083451080e+01,  -2.113882256e+01,  -5.039163113e+00,  5.315112114e+00,  -2.589911461e+01,  -9.284210205e+00,
+      -2.744145203e+01,  -3.116725922e+00,  -8.969699860e+01,  -2.053466034e+01,  -1.600544095e+00,  -2.985075951e+01,  -9.079874992e+00,  -8.909736633e+00,
+      -1.665799904e+01,  -7.018875885e+01,  -5.458261967e+00,  -1.546548271e+01,  -9.830402374e+00,  -2.608273888e+01,  -2.708375168e+01,  -2.853981781e+01,
+      -7.042343140e+01,  3.390378475e+00,  -5.941730118e+01,  7.691345215e+00
+    },
+    {
+      -3.231019592e+01,  -2.793857098e+00,  -3.278749466e+01,  -1.641024208e+01,  -3.465702057e+00,  1.889272213e+00,  -1.343171692e+01,  -8.163592339e+00,
+      -2.061643791e+01,  -4.995408535e+00,  -6.529196167e+01,  -1.144589233e+01,  -7.610857487e-01,  -1.635893440e+01,  -4.672925472e+00,  -7.231172562e+00,
+      -1.045475388e+01,  -5.150918579e+01,  -3.289741039e+00,  -1.006281853e+01,  -4.938612938e+00,  -2.020505905e+01,  -2.268108940e+01,  -1.896397209e+01,
+      -5.157624817e+01,  1.987298846e+00,  -5.329875946e+01,  6.166934490e+00
+    }
+  },
+  // pos 8
+  {
+    {
+      -4.656650543e+01,  -4.674151421e+00,  -5.124760818e+01,  -1.802929497e+01,  -5.807448864e+00,  2.986993790e+00,  -2.245672035e+01,  -9.247605324e+00,
+      -2.892597580e+01,  -7.388203144e+00,  -9.487181091e+01,  -1.416008949e+01,  -2.635816097e+00,  -2.965176964e+01,  -9.355618477e+00,  -1.196453667e+01,
+      -2.175179100e+01,  -6.934799957e+01,  -7.323853016e+00,  -1.089495945e+01,  -4.996871471e+00,  -3.089728546e+01,  -3.394419098e+01,  -3.438651657e+01,
+      -7.388717651e+01,  -4.379810095e-01,  -6.837242889e+01,  8.645609856e+00
+    },
+    {
+      -3.234041977e+01,  -9.895357132e+00,  -1.382224464e+01,  -6.612527847e+00,  -4.018205643e+00,  -3.437963963e+00,  -1.175602245e+01,  -5.318399906e+00,
+      -1.658823395e+01,  -7.529488564e+00,  -4.456588364e+01,  -1.108612347e+01,  4.157435894e+00,  -9.571914673e+00,  2.370754004e+00,  -1.262858963e+01,
+      -7.735948563e+00,  -3.429381561e+01,  8.439566493e-01,  -2.034411669e+00,  -1.207468390e+00,  -2.190733910e+01,  -8.654578209e+00,  -5.453920364e+00,
+      -3.093691063e+01,  -4.005082130e+00,  -2.316809845e+01,  -6.170209885e+00
+    },
+    {
+      -3.896446991e+01,  -3.223127127e+00,  -1.858016586e+01,  -1.526140213e+01,  -5.747515678e+00,  -1.130106926e+00,  -1.379767609e+01,  -9.215918541e+00,
+      -3.212822342e+01,  -4.316668034e+00,  -6.329780197e+01,  -9.737023354e+00,  4.659423828e+00,  -1.309679985e+01,  -2.346481323e+00,  -8.779024124e+00,
+      -8.387988091e+00,  -4.561738586e+01,  -2.935791969e+00,  -1.309188747e+01,  -7.526766300e+00,  -2.088414383e+01,  -1.898825455e+01,  -1.271785641e+01,
+      -5.128710938e+01,  2.739372730e+00,  -4.490219879e+01,  1.427932739e+00
+    },
+    {
+      -2.852047729e+01,  8.622493148e-01,  -3.290633392e+01,  -8.077645302e+00,  -2.873526573e+00,  2.151780605e+00,  -1.766572380e+01,  -6.125259876e+00,
+      -6.532450676e+00,  -4.840075016e+00,  -5.866094589e+01,  1.978891253e+00,  -4.519470215e+00,  -2.661054230e+01,  -3.671642542e+00,  -8.305416107e+00,
+      -1.270677185e+01,  -3.935568619e+01,  -6.550365448e+00,  -3.964424372e+00,  2.063623190e+00,  -2.037722778e+01,  -1.987354088e+01,  -3.044055176e+01,
+      -5.283483124e+01,  -6.231689930e+00,  -3.346910095e+01,  5.208631039e+00
+    },
+    {
+      -3.823226929e+01,  -3.158117056e+00,  -3.020141411e+01,  -1.769233704e+01,  -8.721013069e+00,  2.779167414e+00,  -1.290391636e+01,  -1.138934994e+01,
+      -2.027061653e+01,  -2.697489738e+00,  -7.192615509e+01,  -1.842499542e+01,  5.991847515e-01,  -1.921460342e+01,  -6.199461460e+00,  -7.454095364e+00,
+      -1.183016968e+01,  -5.429472733e+01,  -3.921389580e+00,  -1.695820427e+01,  -7.288694859e+00,  -1.909702301e+01,  -2.116542816e+01,  -1.413799477e+01,
+      -6.014245224e+01,  2.300658226e+00,  -4.949110794e+01,  6.753152370e+00
+    },
+    {
+      -2.802368164e+01,  -4.199662209e+00,  -2.174449921e+01,  -7.206547260e+00,  5.997769356e+00,  -8.862573653e-02,  -9.668052673e+00,  -5.693535805e+00,
+      -1.624221230e+01,  -7.450598240e+00,  -6.107595062e+01,  -8.458231926e+00,  -4.889819622e-01,  -1.339078999e+01,  1.713564754e+00,  -7.476375103e+00,
+      -3.013154030e+00,  -5.154846191e+01,  1.578539014e+00,  -1.107463360e+00,  -3.752021074e+00,  -2.819006920e+01,  -1.649350929e+01,  -2.096148109e+01,
+      -3.933007812e+01,  -5.683731079e+00,  -3.198826027e+01,  5.390300751e+00
+    },
+    {
+      -5.167523575e+01,  -3.448940277e+00,  -3.210854721e+01,  -2.553984642e+01,  -1.201283455e+01,  -1.349157572e+00,  -7.898855209e-02,  -1.052379704e+01,
+      -3.498380280e+01,  -2.172875881e+00,  -6.465432739e+01,  -2.313961601e+01,  -4.978806019e+00,  -7.305233002e+00,  -3.976861954e+00,  4.637340307e-01,
+      -2.104798889e+01,  -3.919294739e+01,  -1.273383522e+01,  -2.268826485e+01,  -8.793216705e+00,  3.971035242e+00,  -2.533793449e+01,  -1.585417843e+01,
+      -7.692610931e+01,  -7.443509102e-01,  -8.834288788e+01,  3.075361013e+00
+    },
+    {
+      -6.137344360e+01,  -8.269464493e+00,  -5.975960922e+01,  -2.626518631e+01,  -6.506029606e+00,  8.234679699e-02,  -1.898219490e+01,  -1.100140572e+01,
+      -3.922064972e+01,  -1.256490231e+01,  -1.108210831e+02,  -2.202969170e+01,  -1.506543159e+00,  -2.829684067e+01,  -7.661850452e+00,  -7.709109783e+00,
+      -2.388620567e+01,  -8.488598633e+01,  -9.124118805e+00,  -1.213726902e+01,  -6.199954987e+00,  -3.415745544e+01,  -4.026058960e+01,  -3.966079330e+01,
+      -8.895636749e+01,  -3.776714563e+00,  -9.428766632e+01,  9.957427025e+00
+    },
+    {
+      -4.894900513e+01,  -4.640222549e+00,  -6.236212158e+01,  -1.765987968e+01,  -6.501549721e+00,  4.275175095e+00,  -2.781716728e+01,  -4.888255119e+00,
+      -3.172066879e+01,  -7.908986568e+00,  -9.527023315e+01,  -1.659957314e+01,  -4.385976315e+00,  -4.386426544e+01,  -1.164976406e+01,  -8.863808632e+00,
+      -4.027886200e+01,  -6.886684418e+01,  -1.536596489e+01,  -8.746064186e+00,  -4.463014603e+00,  -3.114872742e+01,  -4.007130051e+01,  -5.774460983e+01,
+      -7.622819519e+01,  -4.524497032e+00,  -6.072365189e+01,  8.276343346e+00
+    },
+    {
+      -3.140947533e+01,  -6.764722466e-01,  -1.429040051e+01,  6.329978466e+00,  -5.492051244e-01,  1.411098480e+00,  -1.107164001e+01,  -3.410542965e+00,
+      -1.292064381e+01,  -2.463204861e+00,  -5.080067444e+01,  -1.757046938e+00,  -1.024029851e+00,  -1.567080402e+01,  -2.215163469e+00,  -1.146620655e+01,
+      -2.447015381e+01,  -2.608657265e+01,  -7.064421177e+00,  -2.731273174e+00,  -6.522480845e-01,  -1.656912804e+01,  -5.908276558e+00,  -1.934079742e+01,
+      -4.694189072e+01,  -3.084149599e+00,  -1.251230049e+01,  -3.166797161e+00
+    },
+    {
+      -3.022072411e+01,  -2.449115276e+00,  -1.636973953e+01,  -1.062910080e+01,  -8.682110786e+00,  3.669932127e+00,  -1.057145977e+01,  -1.025224686e+01,
+      -1.179299450e+01,  1.125149727e+00,  -5.275313568e+01,  -2.138008308e+01,  1.378703117e-01,  -1.773166656e+01,  -7.129843235e+00,  -4.849479675e+00,
+      -7.490005970e+00,  -3.828364182e+01,  -9.285877943e-01,  -1.169316196e+01,  -8.771986961e+00,  -1.287398911e+01,  -1.336861992e+01,  -8.151988983e+00,
+      -4.569144440e+01,  1.317343950e+00,  -2.980271530e+01,  5.473756790e+00
+    },
+    {
+      -5.959274292e+01,  -2.212233067e+00,  -5.889472198e+01,  -1.962714767e+01,  -8.801138878e+00,  7.966811657e+00,  -3.110713577e+01,  -1.089395905e+01,
+      -3.221875381e+01,  -2.961195707e+00,  -1.077218552e+02,  -1.624715805e+01,  -5.604214668e+00,  -4.723403549e+01,  -1.293935776e+01,  -5.449330330e+00,
+      -5.803357697e+01,  -7.568661499e+01,  -2.023399162e+01,  -1.613815308e+01,  -8.485740662e+00,  -2.287919807e+01,  -3.666036606e+01,  -6.828881073e+01,
+      -9.127775574e+01,  -3.566652298e+00,  -6.212917328e+01,  5.429743290e+00
+    },
+    {
+      -3.181241608e+01,  -7.915364504e-01,  -3.062623215e+01,  -1.707516670e+01,  -5.160157681e+00,  3.588335514e+00,  -1.334760857e+01,  -7.331129551e+00,
+      -1.544408894e+01,  -1.420855403e+00,  -6.016351700e+01,  -1.143969822e+01,  -2.087617874e+00,  -1.975336456e+01,  -5.037002563e+00,  -6.006889343e+00,
+      -1.273683739e+01,  -5.226399994e+01,  -3.606771231e+00,  -1.640143013e+01,  -3.930505514e+00,  -1.334446907e+01,  -1.781222916e+01,  -1.550651455e+01,
+      -5.145315170e+01,  2.705362558e+00,  -4.352016449e+01,  5.833197117e+00
+    },
+    {
+      -5.164627838e+01,  -9.181704521e-01,  -5.165769958e+01,  -1.771694946e+01,  -3.476150990e+00,  7.390622139e+00,  -3.008922577e+01,  -8.872976303e+00,
+      -2.700302315e+01,  -9.453587532e-01,  -9.991390991e+01,  -8.955317497e+00,  -4.204911232e+00,  -4.193284988e+01,  -1.094376945e+01,  -7.482532978e+00,
+      -4.788849258e+01,  -6.652792358e+01,  -1.487487793e+01,  -1.388384056e+01,  -7.084831715e+00,  -2.120584488e+01,  -2.954597855e+01,  -5.776354599e+01,
+      -8.019858551e+01,  3.227408230e-01,  -5.256334686e+01,  4.782861233e+00
+    },
+    {
+      -2.605983353e+01,  -1.515337586e+00,  -3.392636490e+01,  -2.828435659e+00,  -1.173311472e+00,  1.662152171e+00,  -9.266999245e+00,  3.771166563e+00,
+      -1.189708900e+01,  -1.520663619e+00,  -4.118006134e+01,  -5.967737198e+00,  -5.187928200e+00,  -2.553938675e+01,  -6.454351425e+00,  -4.496139526e+00,
+      -3.232054138e+01,  -3.240967178e+01,  -1.060746193e+01,  -4.301290512e+00,  3.185106277e+00,  -1.147318649e+01,  -1.922947311e+01,  -3.669191742e+01,
+      -3.272381592e+01,  -3.742409468e+00,  -1.943034363e+01,  2.733843088e+00
+    },
+    {
+      -3.492920685e+01,  -3.454512119e+00,  -1.477777672e+01,  -1.971820641e+01,  -4.191005707e+00,  -2.204509735e+00,  6.966751575e+00,  -9.902988434e+00,
+      -2.674409294e+01,  -4.776201725e+00,  -4.098781586e+01,  -1.810924530e+01,  -6.162705421e-01,  1.092955709e+00,  1.113539934e+00,  1.923115611e+00,
+      -2.383543730e+00,  -3.545960999e+01,  -3.824741393e-02,  -1.215993786e+01,  -7.941834450e+00,  -3.775655031e-01,  -1.618451881e+01,  4.903191328e-01,
+      -4.661927032e+01,  -2.420550108e+00,  -7.577945709e+01,  1.678538561e+00
+    },
+    {
+      -4.698618317e+01,  -3.642592907e+00,  -3.531025696e+01,  -1.178534317e+01,  -1.515207100e+01,  9.026462436e-01,  -1.255106735e+01,  -8.140950203e+00,
+      -1.874172020e+01,  9.610733390e-01,  -6.373165512e+01,  -2.538003922e+01,  -2.534911156e+00,  -3.245095062e+01,  -1.177720928e+01,  -5.440932274e+00,
+      -3.708477783e+01,  -4.180008316e+01,  -1.316500092e+01,  -1.585163784e+01,  -2.034780025e+00,  -6.420008659e+00,  -2.129335594e+01,  -3.285939789e+01,
+      -6.251691055e+01,  -3.885619402e+00,  -4.211351776e+01,  1.224892616e+00
+    },
+    {
+      -1.730816193e+02,  -7.432504177e+00,  -6.108557892e+01,  -7.860166168e+01,  -2.959809113e+01,  -3.429322815e+01,  6.465435028e-03,  -5.799314880e+01,
+      -1.263206024e+02,  -5.948568821e+00,  -1.855376740e+02,  -8.102851105e+01,  -1.311456966e+01,  4.472247958e-01,  -1.555959821e+00,  1.158001804e+01,
+      -3.757426071e+01,  -1.204714355e+02,  -1.620134926e+01,  -6.740374756e+01,  -2.959686852e+01,  2.589037132e+01,  -6.054439545e+01,  -1.871845055e+01,
+      -2.028862610e+02,  -3.068479538e+00,  -3.120033569e+02,  -6.744590998e-01
+    },
+    {
+      -2.817051315e+01,  -9.156418443e-01,  -2.576477814e+01,  -1.582288074e+01,  8.524103165e-01,  2.382072449e+00,  -1.093400955e+01,  -7.619616985e+00,
+      -1.835003090e+01,  -3.165802717e+00,  -5.404435349e+01,  -8.561822891e+00,  3.655456603e-01,  -1.537336922e+01,  -1.731528521e+00,  -6.833688259e+00,
+      -8.391442299e+00,  -4.322406769e+01,  -2.736213684e+00,  -1.137746429e+01,  -4.629710674e+00,  -1.480205250e+01,  -1.966538620e+01,  -1.853531075e+01,
+      -4.652389145e+01,  3.925808907e+00,  -4.567755508e+01,  5.334833622e+00
+    },
+    {
+      -2.519873810e+01,  -3.954965830e+00,  -2.768921661e+01,  -4.270681858e+00,  -4.760818958e+00,  2.629060030e+00,  -1.471916580e+01,  -8.041773796e+00,
+      -4.240821004e-01,  -3.915041447e+00,  -5.513212585e+01,  -8.485774994e+00,  -1.578256011e+00,  -2.630838776e+01,  -4.043782711e+00,  -7.465917587e+00,
+      -7.500766754e+00,  -2.123951149e+01,  -2.873008490e+00,  4.521203041e+00,  -1.001129508e+00,  -2.588844490e+01,  -2.113039017e+01,  -2.087659454e+01,
+      -4.403610229e+01,  -8.242444038e+00,  -2.865045166e+01,  5.116965771e+00
+    },
+    {
+      -3.097238922e+01,  -4.251015186e+00,  -3.871966553e+01,  -9.292438507e+00,  -9.033854485e+00,  4.336875439e+00,  -1.542794609e+01,  -4.643120766e+00,
+      -1.676618767e+01,  -7.144284844e-01,  -5.878240204e+01,  -1.918871689e+01,  -3.791196823e+00,  -3.031087875e+01,  -1.179433727e+01,  -5.921082020e+00,
+      -2.987062263e+01,  -4.059321976e+01,  -8.810608864e+00,  -9.081319809e+00,  -4.341218948e+00,  -1.487691116e+01,  -2.436491776e+01,  -2.907304764e+01,
+      -4.775468826e+01,  -1.968636394e+00,  -3.533433914e+01,  5.122485161e+00
+    },
+    {
+      -2.484304619e+01,  -5.120602131e+00,  -1.914664459e+01,  -2.728301525e+00,  -1.321170521e+01,  1.400161147e+00,  -2.684597206e+01,  -1.475498486e+01,
+      -1.168303680e+01,  -6.914761066e+00,  -4.967666626e+01,  -1.453791428e+01,  2.685201883e+00,  -2.604937363e+01,  -2.437988043e+00,  -6.854290009e+00,
+      -9.188012123e+00,  -2.690555954e+01,  -3.841356516e+00,  3.832968235e+00,  -2.731839895e+00,  -3.207516861e+01,  -1.893159294e+01,  -1.692647743e+01,
+      -3.373300171e+01,  -8.988678932e+00,  -3.173811340e+01,  -3.951045752e+00
+    },
+    {
+      -5.171475220e+01,  -3.274209023e+00,  -5.751665497e+01,  -1.550689507e+01,  -5.751260757e+00,  7.167755604e+00,  -3.048658180e+01,  -8.865732193e+00,
+      -2.791528130e+01,  -2.338226795e+00,  -9.804969788e+01,  -1.284572601e+01,  -4.148385048e+00,  -4.597658539e+01,  -1.402327633e+01,  -7.028050423e+00,
+      -5.307233810e+01,  -6.174186325e+01,  -1.872112656e+01,  -1.102041435e+01,  -7.612777710e+00,  -2.325764465e+01,  -3.717687607e+01,  -6.356803894e+01,
+      -7.816387177e+01,  -2.970046997e+00,  -5.085528564e+01,  5.135495663e+00
+    },
+    {
+      -4.155924988e+01,  -1.372001529e+00,  -1.282075500e+01,  -3.343596697e+00,  8.008707166e-01,  2.317876339e+00,  -1.413463688e+01,  -1.423648834e+01,
+      -1.229044724e+01,  -4.769193172e+00,  -9.732729340e+01,  -5.808166027e+00,  -2.548191786e+00,  -1.321930313e+01,  6.270724297e+00,  -9.727173805e+00,
+      -2.015485764e+01,  -4.645504379e+01,  -8.340581894e+00,  -5.721054554e+00,  -3.909433365e+00,  -2.619573784e+01,  -7.692092419e+00,  -2.676964951e+01,
+      -7.723590851e+01,  1.729465008e+00,  -3.038751602e+01,  3.906780720e+00
+    },
+    {
+      -8.480551910e+01,  -7.552741528e+00,  -9.770082855e+01,  -3.763182831e+01,  -1.071157646e+01,  6.545108795e+00,  -4.276950073e+01,  -1.239735889e+01,
+      -5.881978607e+01,  -1.113371372e+01,  -1.643160553e+02,  -3.058872795e+01,  -6.864342690e+00,  -6.145141220e+01,  -2.001766777e+01,  -1.146294498e+01,
+      -6.010816956e+01,  -1.178402786e+02,  -2.555843353e+01,  -2.363812256e+01,  -1.307004738e+01,  -4.364324951e+01,  -6.653984833e+01,  -8.511339569e+01,
+      -1.297606506e+02,  -1.518124461e+00,  -1.206103210e+02,  1.401315117e+01
+    },
+    {
+      -4.843016052e+01,  -9.124571681e-01,  -5.526297760e+01,  -1.660901451e+01,  -4.724848270e+00,  3.822594404e+00,  -2.595095253e+01,  -7.875538826e+00,
+      -2.120230865e+01,  -8.362722397e+00,  -9.917475891e+01,  -5.092257500e+00,  -7.261691570e+00,  -3.823543549e+01,  -6.427947044e+00,  -1.320134068e+01,
+      -2.032967758e+01,  -7.333334351e+01,  -7.083006382e+00,  -1.322730255e+01,  1.062028170e+00,  -3.256364441e+01,  -3.202335739e+01,  -4.370062637e+01,
+      -9.007109070e+01,  -6.039920330e+00,  -6.275691223e+01,  9.133000374e+00
+    },
+    {
+      -5.552833939e+01,  -4.918845654e+00,  -5.640745926e+01,  -2.700321579e+01,  -6.501082420e+00,  5.459940910e+00,  -3.065367508e+01,  -1.200394058e+01,
+      -3.573768997e+01,  -6.613774300e+00,  -1.153675766e+02,  -2.406550598e+01,  -2.113574028e+00,  -3.606161118e+01,  -1.139703941e+01,  -1.210070419e+01,
+      -2.185706520e+01,  -9.091242981e+01,  -7.723457813e+00,  -1.769896317e+01,  -1.138517857e+01,  -3.584857178e+01,  -3.873043060e+01,  -3.806123352e+01,
+      -8.993566895e+01,  3.403544664e+00,  -8.358979034e+01,  1.084071732e+01
+    },
+    {
+      -4.726049423e+01,  -4.403752804e+00,  -4.811350632e+01,  -2.279781723e+01,  -5.724042892e+00,  1.986270547e+00,  -1.871363640e+01,  -1.186769009e+01,
+      -3.073481941e+01,  -7.988363743e+00,  -9.505014038e+01,  -1.680633163e+01,  -1.482451558e+00,  -2.271796799e+01,  -7.276426792e+00,  -1.028170395e+01,
+      -1.523890972e+01,  -7.268282318e+01,  -4.856708527e+00,  -1.322148991e+01,  -6.766417027e+00,  -2.966102791e+01,  -3.288871384e+01,  -2.837011719e+01,
+      -7.578399658e+01,  2.234524012e+00,  -7.873255157e+01,  8.897248268e+00
+    }
+  }
+};
+
+} // namespace embedded_ml
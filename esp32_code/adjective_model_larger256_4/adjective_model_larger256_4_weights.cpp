@@ -2,6 +2,7 @@
 // Auto-generated weight data for embedded inference
 // This file contains all model weights as C++ arrays
 
+#include "adjective_model_larger256_4_placement.h"
 #include <cstddef>
 
 namespace embedded_ml {
@@ -10,7 +11,7 @@ namespace embedded_ml {
 // Weight tensor 1: arith.constant
 // Shape: [256]
 // Elements: 256
-static const float weight_0_arith_constant[256] = {
+static const float weight_0_arith_constant[256] EMBEDDED_ML_LAYER3_PLACEMENT = {
   0.142903462,  0.039991271,  -0.053056072,  -0.099402256,  0.032392830,  -0.085975952,  0.098655887,  -0.059649576,
   -0.124152333,  0.098472208,  -0.063753761,  -0.053010195,  0.102331057,  0.064532980,  0.063592039,  0.156451508,
   0.020211184,  -0.086596519,  0.082347974,  -0.082925543,  0.021864014,  -0.067082763,  0.045091100,  -0.078735299,
@@ -50,7 +51,7 @@ static const float weight_0_arith_constant[256] = {
 // Weight tensor 2: arith.constant1
 // Shape: [256]
 // Elements: 256
-static const float weight_1_arith_constant1[256] = {
+static const float weight_1_arith_constant1[256] EMBEDDED_ML_LAYER2_PLACEMENT = {
   -0.138711140,  -0.020269953,  0.155314818,  -0.433020264,  -0.262625158,  -0.015250601,  -0.107001603,  0.057408005,
   0.036747929,  0.002764903,  0.000456855,  -0.026211977,  0.025122689,  -0.166055888,  0.061174296,  0.041526929,
   -0.275970429,  -0.096712381,  -0.113893241,  0.059784450,  0.023753405,  -0.147733018,  -0.018793251,  0.039825138,
@@ -90,7 +91,7 @@ static const float weight_1_arith_constant1[256] = {
 // Weight tensor 3: arith.constant2
 // Shape: [256]
 // Elements: 256
-static const float weight_2_arith_constant2[256] = {
+static const float weight_2_arith_constant2[256] EMBEDDED_ML_LAYER1_PLACEMENT = {
   -0.082082853,  -0.046926495,  -0.056783393,  -0.009869669,  0.035067037,  -0.046383683,  -0.010524048,  -0.047903609,
   -0.031822372,  -0.088625453,  -0.086197212,  -0.066491008,  -0.017406486,  0.100274764,  -0.164624587,  -0.035490014,
   -0.056677874,  0.037381362,  -0.088062309,  -0.031788796,  -0.049297009,  -0.022742961,  -0.017102093,  -0.063007995,
@@ -130,7 +131,7 @@ static const float weight_2_arith_constant2[256] = {
 // Weight tensor 4: arith.constant3
 // Shape: [28]
 // Elements: 28
-static const float weight_3_arith_constant3[28] = {
+static const float weight_3_arith_constant3[28] EMBEDDED_ML_LAYER4_PLACEMENT = {
   -0.546462536,  0.056068588,  -0.059292167,  0.016103888,  0.090661518,  0.089089818,  -0.037181225,  0.023226507,
   0.031735580,  0.102867804,  -0.264069259,  -0.182888523,  -0.023066286,  -0.063496552,  0.127258331,  -0.077280775,
   -0.067575522,  -0.380602151,  0.159539744,  0.109312162,  0.050002702,  -0.002138422,  -0.147785187,  -0.064503655,
@@ -141,7 +142,7 @@ static const float weight_3_arith_constant3[28] = {
 // Weight tensor 5: arith.constant4
 // Shape: [28, 256]
 // Elements: 7168
-static const float weight_4_arith_constant4[7168] = {
+static const float weight_4_arith_constant4[7168] EMBEDDED_ML_LAYER4_PLACEMENT = {
   -0.833773017,  -0.622380853,  0.053958271,  -0.047365505,  -0.569995761,  -0.048705272,  -0.406477928,  0.051557321,
   -1.141529560,  -0.504934251,  0.095101483,  -0.041400947,  -0.235192329,  -0.715920568,  -0.109918028,  -0.295788884,
   -0.477243334,  0.107493833,  -0.234939784,  0.037398223,  -0.858880699,  -0.347966105,  -0.510078371,  -0.045490634,
@@ -1045,7 +1046,7 @@ static const float weight_4_arith_constant4[7168] = {
 // Weight tensor 6: arith.constant5
 // Shape: [256, 256]
 // Elements: 65536
-static const float weight_5_arith_constant5[65536] = {
+static const float weight_5_arith_constant5[65536] EMBEDDED_ML_LAYER3_PLACEMENT = {
   0.009077379,  0.058665771,  -0.231984764,  -0.023772370,  -0.057116129,  -0.364875942,  0.064743273,  -0.015563869,
   -0.070169985,  0.022920603,  -0.246854737,  0.073476791,  0.169907421,  -0.018394528,  0.023384014,  -0.071569689,
   -0.774977684,  0.099228442,  0.069362141,  0.165808097,  0.115802497,  -0.065802380,  0.156688064,  -0.080390669,
@@ -9245,7 +9246,7 @@ static const float weight_5_arith_constant5[65536] = {
 // Weight tensor 7: arith.constant6
 // Shape: [256, 256]
 // Elements: 65536
-static const float weight_6_arith_constant6[65536] = {
+static const float weight_6_arith_constant6[65536] EMBEDDED_ML_LAYER2_PLACEMENT = {
   -0.024976680,  0.089966021,  0.104835801,  -0.533826351,  0.221229747,  -0.029426856,  0.086544104,  0.074513197,
   -0.228689745,  0.063064925,  0.182972282,  0.120051160,  0.090389609,  0.110963807,  0.063362673,  -0.047793500,
   0.044334259,  -0.164404675,  -0.348129272,  -0.134027541,  -0.025391849,  0.005683533,  -0.114002585,  0.112665989,
@@ -17445,7 +17446,7 @@ static const float weight_6_arith_constant6[65536] = {
 // Weight tensor 8: arith.constant7
 // Shape: [256, 256]
 // Elements: 65536
-static const float weight_7_arith_constant7[65536] = {
+static const float weight_7_arith_constant7[65536] EMBEDDED_ML_LAYER1_PLACEMENT = {
   0.051045395,  -0.055706516,  -0.302482158,  -0.064208105,  -0.043505136,  -0.082915045,  -0.064144999,  -0.228293985,
   -0.357654601,  -0.181928307,  -0.315376222,  -0.103370942,  0.076709241,  0.295804828,  -0.141869366,  0.022476362,
   0.073082261,  -0.058377326,  0.107097454,  -0.156933069,  -0.247503981,  0.173388496,  0.032647975,  0.125496313,
@@ -25643,937 +25644,937 @@ static const float weight_7_arith_constant7[65536] = {
 
 
 // Weight tensor 9: sequential_1/dense_1/MatMul
-// Shape: [256, 29]
+// Shape: [29, 256] (column-major)
 // Elements: 7424
-static const float weight_8_sequential_1_dense_1_MatMul[7424] = {
-  0.134328067,  0.078088365,  0.094225854,  0.046662979,  0.114754967,  0.080884576,  -0.054146491,  -0.099644497,
-  0.023212397,  -0.004664081,  -0.003974790,  -0.028409386,  -0.029791512,  -0.028670421,  0.041145995,  -0.008564924,
-  -0.140076533,  -0.013691759,  -0.137578070,  0.104549564,  -0.097113296,  -0.030588608,  -0.116051763,  -0.113414645,
-  -0.106078416,  0.080893919,  -0.123385221,  0.016089186,  -0.174204379,  -0.008208964,  0.106143922,  0.181532711,
-  -0.004692108,  0.156287625,  -0.143184885,  0.192935780,  -0.010066510,  0.056086473,  -0.076944754,  -0.032210100,
-  -0.093516275,  -0.050956599,  -0.053007051,  -0.103532135,  0.070294216,  0.188160449,  0.000284512,  -0.094407707,
-  0.014226707,  -0.057338804,  0.117976464,  -0.024276337,  0.112336904,  -0.097429067,  0.169165775,  -0.124734573,
-  -0.096342452,  -0.176399976,  0.071905740,  -0.058311075,  -0.122324400,  -0.110506572,  0.059555613,  0.086955421,
-  -0.065177113,  0.178028196,  0.024552766,  -0.145525336,  -0.067673512,  0.049970508,  -0.092437752,  -0.151542187,
-  0.041109983,  0.075108327,  -0.123025849,  -0.109163143,  -0.013319520,  0.082808629,  -0.040251181,  0.012505670,
-  0.035313182,  -0.150666535,  -0.136666730,  0.134684578,  0.089690655,  0.127012953,  0.292236656,  -0.036486939,
-  0.103668913,  0.046762943,  -0.114737123,  -0.069070853,  -0.096746989,  -0.117252178,  0.072254896,  0.059532713,
-  0.063296393,  -0.104576170,  0.026549056,  -0.084003672,  -0.028607583,  0.047518127,  -0.157103509,  0.054925893,
-  -0.182004422,  0.133546323,  -0.061272770,  -0.181699246,  -0.238755673,  -0.152457058,  -0.070800446,  0.003501318,
-  0.060463689,  -0.104191549,  0.111503318,  0.397791594,  -0.013367656,  -0.105902240,  -0.082777336,  0.074325643,
-  -0.153497264,  0.093561642,  -0.078573361,  0.031050969,  -0.080483295,  -0.208036765,  -0.048049368,  0.103708938,
-  0.074522339,  0.098863788,  -0.155874625,  0.056168426,  -0.163565978,  -0.152667150,  0.019885320,  0.070600510,
-  -0.067036182,  0.083165132,  0.074311085,  0.082620092,  0.035303153,  -0.017655203,  0.083640411,  0.077554226,
-  0.389129341,  -0.080982909,  -0.009205166,  -0.121112153,  0.139323920,  0.042836677,  -0.056172300,  0.158665225,
-  0.127412498,  -0.064562619,  -0.139699087,  -0.071401991,  -0.098393306,  0.096766114,  -0.141454041,  -0.112016261,
-  -0.058230698,  0.107601881,  0.732834101,  -0.067336574,  0.028516266,  -0.108179145,  -0.155969396,  -0.142462447,
-  0.163475662,  0.069247469,  0.116791375,  0.094903208,  0.096866161,  0.285942048,  -0.113544434,  -0.041060708,
-  -0.028564535,  -0.016309222,  -0.110083640,  -0.005328005,  0.162255168,  -0.086441889,  -0.073826231,  -0.039806493,
-  -0.087147877,  -0.034661137,  -0.041637585,  -0.059606299,  -0.027454022,  0.001668751,  -0.094683386,  -0.091204122,
-  -0.063787639,  -0.030201059,  0.000563704,  0.202373952,  -0.082195200,  0.099783234,  -0.010216498,  -0.027736023,
-  -0.118959516,  -0.116141155,  -0.050623417,  -0.141331241,  -0.109597325,  -0.124238104,  -0.136059523,  -0.100854576,
-  -0.011982022,  -0.115046099,  0.134508133,  -0.118909948,  0.161040574,  -0.026101518,  -0.108663522,  -0.050438341,
-  0.113011479,  0.088844940,  -0.144157976,  -0.103785500,  -0.113460332,  -0.106435284,  0.235159099,  0.081157766,
-  -0.100077122,  -0.006393734,  -0.109247647,  0.009870774,  -0.099371724,  -0.110610902,  0.006286696,  -0.357278228,
-  0.014800176,  -0.102918670,  -0.078927442,  -0.090749137,  -0.080442511,  0.173234612,  0.144565731,  0.135161728,
-  -0.105943784,  -0.085073307,  -0.000543466,  0.085659228,  -0.084326774,  -0.040565595,  -0.086883232,  0.142342210,
-  0.058817599,  -0.079012297,  0.040573746,  0.182080820,  0.114330195,  0.143155262,  0.063905291,  -0.089135677,
-  -0.067301638,  0.024674080,  -0.098864518,  0.068627045,  -0.306252539,  0.041597437,  0.016666472,  0.007460997,
-  -0.010387656,  0.076667145,  -0.084604979,  0.013439294,  0.062189467,  0.142524928,  -0.091217548,  0.167907789,
-  0.096692935,  -0.074722335,  -0.017543050,  0.105400071,  -0.078750394,  -0.074178040,  0.556399286,  -0.010194514,
-  -0.037088487,  0.069719300,  -0.041492455,  -0.099686876,  0.125860766,  -0.012414028,  -0.081713043,  -0.115116946,
-  -0.013883308,  -0.208787709,  -0.096159630,  -0.081859417,  -0.101790741,  -0.004558195,  -0.081192583,  0.095292620,
-  -0.111760691,  0.082941420,  -0.013628530,  0.088669896,  -0.012665301,  -0.097565055,  -0.086974978,  0.066030338,
-  0.164103687,  0.054108072,  -0.020458112,  -0.078015894,  -0.111752704,  -0.105836540,  0.113053270,  0.112530507,
-  -0.143967539,  -0.034012206,  0.015736371,  -0.079184763,  0.095525414,  -0.041277021,  -0.274080276,  0.000543492,
-  0.072969802,  -0.133124202,  -0.079464331,  0.081517160,  -0.085460573,  -0.131039739,  0.018178143,  -0.003353040,
-  -0.032928005,  0.040631067,  -0.015549630,  0.008719145,  0.196779892,  -0.086483404,  -0.111526564,  -0.002032133,
-  0.031211149,  0.054821372,  -0.119825177,  -0.002766842,  0.034688625,  0.078378662,  -0.009885021,  -0.122425258,
-  -0.011977757,  -0.011434611,  -0.046085469,  0.002876999,  -0.029117787,  -0.112260014,  0.157724947,  0.074378900,
-  -0.103105009,  -0.026357930,  0.296244293,  -0.007756528,  -0.141777247,  -0.018466575,  0.143595412,  -0.083054088,
-  -0.110793114,  -0.135391027,  -0.141107902,  -0.013930747,  -0.085995495,  0.649036646,  -0.033857085,  -0.027277268,
-  -0.023543848,  0.020616407,  -0.042302765,  0.199342892,  0.158090889,  -0.056249216,  -0.024669988,  0.009878531,
-  -0.092032701,  -0.005239964,  -0.122206494,  -0.083593369,  0.090066291,  0.111754648,  -0.051526301,  0.155182421,
-  -0.010117978,  -0.045384295,  0.037946615,  0.151220784,  -0.087928839,  0.028732304,  -0.136392862,  -0.083216608,
-  0.111608520,  -0.030836657,  0.912281036,  -0.061899744,  0.028100127,  -0.067460954,  -0.122785293,  -0.117074952,
-  -0.037197586,  -0.095168836,  0.137553036,  -0.065427437,  0.059494182,  0.298039913,  -0.024069466,  -0.204075798,
-  -0.105780505,  0.031298082,  0.012136496,  -0.078615531,  0.027491042,  0.128558934,  0.015887663,  0.016665533,
-  -0.052030623,  0.252771854,  -0.016999487,  0.022805583,  -0.191218093,  -0.122670136,  -0.020728042,  0.285039008,
-  -0.077216186,  0.023928063,  0.026294131,  -0.143796906,  0.082491815,  -0.205660447,  0.099414743,  -0.001734912,
-  0.131709352,  -0.067162469,  0.306178451,  0.020328363,  0.005035777,  -0.045143973,  -0.022961810,  -0.118646823,
-  -0.103809506,  0.119058855,  -0.080932066,  0.073796727,  -0.026667174,  -0.024513790,  -0.105538100,  -0.077632114,
-  -0.060747355,  0.109249115,  0.065337107,  -0.035365991,  0.889960051,  -0.090541519,  -0.035989068,  -0.028910100,
-  -0.033757485,  -0.140906394,  -0.056249406,  0.214910075,  0.061288532,  -0.076932751,  -0.076379530,  0.024104545,
-  -0.161790937,  0.046530243,  -0.047023825,  -0.097628392,  0.138071448,  -0.001107384,  -0.128850669,  -0.108196087,
-  0.226054817,  0.006557184,  0.211807370,  0.049937777,  0.104540631,  0.104739681,  -0.128951028,  0.033146095,
-  0.011634716,  0.706988811,  0.093072280,  0.186236337,  0.035815626,  0.077554248,  -0.011232065,  -0.131810933,
-  0.282613695,  0.272933006,  0.148284003,  -0.069241740,  -0.471322060,  0.048066851,  -0.075237185,  -0.131344765,
-  0.066367343,  -0.092599675,  -0.030974953,  -0.044758942,  0.182011843,  -0.042445932,  -0.069604553,  -0.136867821,
-  -0.022054125,  -0.053411830,  0.081647530,  -0.005405159,  -0.140265733,  0.023192110,  -0.103441313,  -0.036710028,
-  0.079942636,  -0.016559388,  -0.155962035,  -0.139126539,  -0.162200466,  0.091132358,  -0.032285262,  0.089481570,
-  0.138330981,  0.269480616,  0.072334260,  -0.087832414,  0.051753704,  -0.048438556,  -0.016265724,  -0.119390443,
-  -0.073146455,  -0.128982291,  -0.023990858,  0.081994362,  -0.058736272,  -0.039497655,  -0.065234572,  -0.084324658,
-  -0.061199326,  -0.109829515,  0.086294062,  -0.063222922,  -0.077893928,  0.092810720,  0.083124496,  0.077482879,
-  -0.095814310,  -0.074345134,  -0.049004760,  0.091726936,  -0.005657771,  -0.096298099,  0.085048676,  -0.036220945,
-  -0.070038080,  0.028910602,  -0.014198976,  -0.057734959,  -0.073614761,  0.109063625,  -0.066204816,  -0.124067508,
-  -0.102602646,  -0.115573026,  0.202495232,  -0.135443404,  0.112717159,  -0.103295445,  0.062739126,  -0.126712725,
-  0.485343874,  0.009614776,  0.037402648,  0.026166145,  -0.008533576,  0.201294318,  -0.086591989,  0.166735262,
-  0.072277486,  0.017418470,  -0.043163642,  -0.051155951,  -0.024228731,  0.175152183,  0.056859028,  -0.118900642,
-  0.017405853,  0.051817201,  -0.072034560,  -0.060206521,  -0.049458601,  -0.243744433,  -0.067833431,  -0.234702066,
-  -0.167436466,  -0.274675995,  -0.159702927,  0.023683518,  -0.197392568,  0.382743686,  0.016024109,  0.015165894,
-  -0.161260396,  0.037498523,  -0.171111047,  0.014564684,  -0.072717190,  -0.129099071,  -0.135002151,  -0.085950904,
-  0.377588719,  -0.136554301,  -0.015149911,  0.027042668,  0.017615892,  0.027623996,  -0.003730904,  0.025004584,
-  0.048432417,  0.120203659,  0.046130691,  0.165751711,  0.071435846,  -0.046310388,  0.116103835,  -0.066728041,
-  0.123134509,  0.048325237,  -0.144897893,  -0.075061731,  0.042988028,  0.025354238,  0.043114889,  0.166570112,
-  -0.099766299,  0.085071787,  -0.010923458,  0.043321747,  -0.095776394,  -0.036685802,  -0.114306875,  -0.093997963,
-  -0.044142533,  0.137657732,  -0.112641297,  -0.085515991,  -0.023108546,  0.083665550,  -0.114579916,  0.093533859,
-  0.065023646,  0.045174427,  -0.029893089,  -0.091666013,  0.150588676,  -0.114021614,  -0.095760085,  -0.078598738,
-  0.110645644,  0.076375522,  -0.100486949,  0.150949389,  -0.032683853,  0.101551168,  0.100771070,  -0.040949456,
-  0.000019814,  0.144546077,  -0.256594867,  0.021321326,  -0.101069361,  0.128995255,  -0.080414578,  0.090407453,
-  -0.137630880,  -0.094677471,  0.014330106,  -0.110926747,  0.089696661,  0.179346681,  -0.106471851,  0.039351419,
-  -0.124121435,  -0.083255425,  -0.026877686,  -0.098108336,  0.026509827,  -0.108784586,  -0.120928362,  0.039941799,
-  -0.010063006,  0.078480847,  0.142722756,  0.192027345,  -0.024110250,  -0.108568206,  0.032618046,  -0.136928514,
-  0.097244717,  -0.009927526,  0.025452016,  -0.044869073,  -0.014852248,  0.058089286,  0.046785869,  0.056444846,
-  -0.144253075,  -0.114890814,  0.016014712,  -0.047819592,  0.015276116,  -0.108102068,  -0.002636751,  0.051569141,
-  0.079987459,  -0.096258834,  0.051436033,  0.019348091,  0.063298881,  -0.048135210,  -0.049736958,  0.054620065,
-  -0.022110764,  -0.082568467,  -0.046833515,  0.128802612,  0.132782668,  -0.037080564,  0.033512175,  0.028394569,
-  0.034275953,  0.042998455,  0.051160805,  -0.180030435,  0.176438794,  0.064378373,  0.051168174,  -0.103014134,
-  -0.143543646,  -0.178334877,  -0.288089126,  0.055268306,  0.045098327,  -0.122973174,  0.314003617,  0.028734492,
-  -0.148916736,  -0.151071385,  0.062487114,  0.001699324,  0.067009427,  -0.167663291,  -0.219580501,  -0.141256809,
-  0.087300390,  0.452687144,  -0.132906049,  0.101345316,  0.044462413,  -0.090645313,  0.008882948,  -0.057080660,
-  0.194208533,  0.254891664,  -0.062672086,  -0.147355244,  -0.037630975,  -0.119711928,  -0.062486224,  0.017194320,
-  -0.108555846,  0.111774176,  -0.117804237,  0.806207538,  0.065112263,  0.002630679,  -0.089317270,  0.007741706,
-  0.124078147,  -0.158974007,  0.084226802,  -0.029255798,  -0.033152115,  0.121898636,  0.341410905,  -0.094433136,
-  0.031489640,  -0.063649960,  0.055944625,  0.034420121,  0.055377923,  0.006573233,  0.099772267,  0.011244311,
-  0.154383272,  0.150774330,  -0.116614327,  0.062243808,  0.123536907,  -0.113829382,  -0.032955125,  -0.015944749,
-  -0.057377063,  0.028739713,  -0.017075591,  -0.121807657,  -0.018501749,  0.135378093,  -0.029331021,  -0.130400628,
-  -0.002376908,  0.169581100,  0.137206182,  -0.322547108,  -0.141627803,  0.008020034,  0.045076806,  -0.117195696,
-  -0.090711817,  0.056477148,  -0.064234167,  -0.017974950,  0.002030042,  0.217638999,  -0.107968085,  0.224179998,
-  -0.081515893,  0.068158701,  0.103589632,  -0.056641780,  -0.068800397,  -0.050262164,  0.158250287,  -0.055120166,
-  -0.092542648,  -0.006987073,  -0.021040145,  -0.106886417,  0.042984791,  0.256724596,  0.061246872,  0.056706443,
-  -0.301906317,  -0.079320565,  -0.050178923,  0.124987163,  -0.075354360,  0.026238395,  0.174952433,  0.123787299,
-  -0.096697107,  -0.003384603,  -0.098810419,  -0.028052421,  -0.067809746,  0.175802201,  -0.010185378,  0.052731145,
-  -0.001954203,  0.118758589,  -0.048411392,  -0.110520385,  0.181764260,  -0.044950739,  -0.142296091,  -0.057669926,
-  -0.046698291,  -0.105071753,  -0.040241987,  -0.047319032,  -0.118918136,  -0.255446553,  -0.079589799,  0.172788367,
-  -0.027167931,  -0.053345516,  -0.053965315,  0.021441679,  -0.090172924,  -0.109865457,  -0.114579052,  0.004751086,
-  -0.026173806,  -0.136064738,  -0.073978201,  0.007343660,  0.030087572,  0.116145328,  -0.102110490,  -0.024682114,
-  0.158007473,  -0.144767195,  0.055434894,  -0.096010491,  -0.122890323,  -0.048257761,  -0.084368810,  -0.007469692,
-  -0.039098434,  -0.113384373,  -0.180020690,  -0.121944547,  0.160184503,  -0.085212782,  -0.134191126,  0.092953064,
-  0.003604086,  -0.073340356,  0.128010541,  -0.095367819,  0.173924580,  -0.072160296,  0.198206007,  -0.077805057,
-  -0.033173222,  -0.027879249,  -0.121864185,  -0.096797593,  -0.069212690,  -0.075281851,  -0.080014966,  -0.116023712,
-  -0.083535910,  -0.078329995,  -0.009270064,  -0.049264565,  -0.110926442,  0.048260104,  -0.121048369,  -0.331287056,
-  -0.024720294,  -0.128050521,  -0.084095493,  -0.106425598,  -0.019115249,  -0.048924495,  -0.087784596,  0.022212846,
-  -0.018158749,  -0.051627900,  -0.021891981,  0.112691447,  -0.073877342,  -0.062147602,  0.016173007,  -0.075620279,
-  -0.005183340,  -0.038995855,  -0.038721710,  -0.029859560,  -0.143621698,  -0.029404471,  0.283419341,  -0.018058725,
-  0.454077542,  0.006172892,  0.430826575,  0.075968176,  0.015189215,  0.012882647,  -0.092753530,  0.038962111,
-  0.070986673,  -0.036649324,  0.058484603,  0.091736577,  -0.030101160,  -0.054359794,  0.130327195,  -0.026109507,
-  -0.084941924,  -0.117374063,  0.193961263,  -0.100431219,  -0.051010534,  0.051593177,  -0.100662887,  0.138803452,
-  0.063171774,  -0.095017418,  0.042273521,  -0.038482912,  -0.022869147,  0.023332570,  0.302415550,  0.199740916,
-  -0.121797696,  -0.497079849,  0.006908583,  0.041538451,  0.015003446,  0.086160026,  -0.022210924,  -0.055674344,
-  0.018939340,  -0.085713558,  -0.101773858,  0.086242847,  0.006983560,  -0.003513522,  -0.034725517,  0.004652485,
-  -0.128812298,  0.134675145,  0.039376508,  -0.100186780,  -0.056960046,  -0.083345503,  0.015059928,  0.148394346,
-  -0.043581389,  -0.048951119,  -0.141370609,  0.175277963,  -0.019988012,  -0.143502906,  -0.183895379,  -0.053161792,
-  -0.118569359,  0.081662446,  -0.140830934,  0.221286312,  0.058762487,  -0.008947296,  -0.073073991,  -0.118819535,
-  0.066664524,  0.131332040,  0.051947221,  -0.036960207,  -0.210672140,  -0.173440322,  0.123651974,  -0.181354478,
-  1.112589598,  0.039124340,  -0.114597268,  -0.161061421,  0.078124292,  -0.163501784,  -0.200073376,  -0.007517538,
-  -0.070636548,  0.093841366,  0.127597407,  0.369733572,  -0.126794606,  -0.163526401,  -0.133441329,  0.042603638,
-  0.038019303,  0.066318110,  0.049325306,  0.058106046,  -0.187627643,  -0.142885208,  0.201485828,  -0.098701827,
-  0.033135008,  -0.086888425,  0.033879999,  0.038079478,  0.053773750,  0.394034177,  0.042789113,  -0.165093437,
-  -0.026842957,  -0.191815451,  0.050753824,  0.097350404,  0.005283151,  0.042548317,  -0.095334679,  -0.021278679,
-  0.428822786,  -0.092605397,  -0.072953850,  0.000718193,  -0.102348700,  -0.065292731,  0.162920758,  0.073543012,
-  0.167890355,  -0.110280171,  0.150253087,  -0.046780955,  -0.125767320,  0.009071858,  -0.050584376,  -0.033568170,
-  -0.083063841,  0.008063064,  -0.025772292,  -0.081314936,  -0.126262188,  -0.035296544,  0.196546674,  0.026392145,
-  -0.078117266,  0.023739817,  -0.123423792,  -0.069932379,  0.019245237,  -0.248865470,  -0.093356691,  -0.068842091,
-  -0.112008661,  0.111256592,  -0.080712184,  0.060381722,  0.140320852,  -0.059335973,  -0.072770700,  0.230793491,
-  0.015971644,  -0.072880760,  -0.110725865,  -0.074132070,  -0.137084693,  0.181986272,  0.005793970,  -0.055003431,
-  -0.074925810,  -0.132321626,  -0.076649047,  0.125911921,  -0.100172043,  0.096641853,  0.035396360,  -0.083104983,
-  0.010033056,  0.078767315,  -0.250206381,  0.093617700,  0.025635613,  0.289189130,  -0.015014132,  -0.074531309,
-  -0.015902936,  -0.032827653,  -0.070058420,  0.044811621,  -0.077914618,  0.070730403,  -0.066932179,  0.114226751,
-  0.026702279,  -0.008929183,  0.129597783,  -0.112502657,  0.604378581,  -0.114940450,  0.003824175,  -0.071884677,
-  0.003868844,  -0.049335793,  -0.008229248,  -0.058091454,  -0.140458241,  -0.028188437,  0.134573892,  -0.195636287,
-  -0.131764367,  -0.031573471,  0.138942197,  -0.053848855,  -0.030540373,  -0.031037634,  0.051064745,  0.147507980,
-  -0.018212728,  -0.093524173,  -0.050544903,  -0.129276201,  -0.040350538,  0.050829377,  -0.033446983,  -0.033811342,
-  0.049845416,  -0.085064068,  -0.113461532,  -0.118773088,  -0.056674737,  -0.092472419,  -0.088021509,  0.113323480,
-  0.075716138,  -0.114750773,  0.145685494,  0.128855303,  0.268436551,  -0.088003293,  -0.038586169,  0.078756936,
-  -0.007696688,  0.105468467,  0.028551485,  0.031996280,  0.094085664,  -0.057746038,  -0.140285581,  -0.136786595,
-  0.241762072,  -0.044375449,  0.004545213,  0.049608152,  0.043155223,  0.048547503,  0.490079701,  -0.044687271,
-  0.049064156,  0.098298110,  -0.038219310,  -0.140206710,  0.087068170,  0.108322836,  0.008901340,  0.108943984,
-  0.121353701,  -0.301835239,  -0.033886209,  -0.133493796,  -0.012528678,  0.046975262,  0.046729114,  -0.070044734,
-  -0.004722818,  0.006020510,  0.022098349,  -0.082885787,  -0.111158423,  0.093825698,  -0.086385846,  0.087630183,
-  -0.134146705,  -0.041347019,  -0.132206544,  0.269251615,  -0.082940444,  0.043870375,  0.033784986,  -0.036226045,
-  0.141701683,  -0.078127421,  0.345263243,  -0.116070271,  0.210313022,  0.070132926,  -0.029734122,  0.016093748,
-  -0.108007140,  -0.057204206,  -0.142985284,  -0.027995622,  0.067873269,  -0.002743123,  0.183405250,  0.004238880,
-  -0.122907385,  0.165111080,  0.145408913,  -0.029207196,  -0.070798129,  0.020434063,  -0.074596964,  -0.100801751,
-  -0.039295860,  -0.096368015,  0.085453779,  0.092292391,  -0.077042773,  0.105899505,  -0.095614009,  0.084777974,
-  0.000554269,  -0.004883425,  0.048611864,  0.221641049,  -0.079586893,  -0.097205661,  0.165903971,  -0.007338846,
-  0.095833123,  -0.090725303,  -0.141989753,  0.278614104,  -0.081654854,  0.021329090,  -0.081969745,  -0.089464501,
-  0.047707200,  0.226133257,  0.000678299,  -0.127602220,  -0.114650972,  0.327761769,  0.101804227,  -0.005328059,
-  0.096630558,  0.058380764,  -0.008091767,  -0.100498006,  0.095403209,  -0.099048905,  0.148225546,  -0.123012647,
-  -0.578309715,  -0.098552555,  -0.112723775,  0.007627929,  -0.139097959,  0.187617823,  0.063221388,  -0.091537982,
-  0.055092204,  0.114828914,  -0.102029264,  0.271914333,  -0.114232570,  -0.126414150,  -0.101166189,  0.099999800,
-  0.115621001,  -0.065114811,  0.061518759,  0.057376292,  -0.104545064,  0.113684654,  -0.069538459,  0.027172467,
-  -0.122060537,  -0.106442444,  0.067510836,  -0.082018465,  -0.022789441,  -0.212688863,  -0.098659784,  0.027214123,
-  -0.061794542,  -0.065476246,  -0.112382412,  -0.073941872,  0.207879096,  0.033035293,  -0.059182487,  -0.004432942,
-  0.234352902,  0.292227745,  0.279146761,  -0.002274754,  0.003003419,  -0.115406670,  0.013013855,  -0.059106492,
-  0.040180892,  -0.115767300,  -0.111123800,  0.086323649,  -0.126136750,  -0.053612851,  -0.112993672,  -0.064666688,
-  -0.057985436,  -0.125748992,  -0.381743103,  0.155606791,  -0.038066916,  0.131708264,  -0.068672858,  0.110831887,
-  -0.094221584,  0.102080852,  -0.009597665,  0.071929678,  -0.068556264,  0.056855466,  -0.176713020,  0.080762379,
-  0.087013043,  -0.111884169,  0.026453111,  0.073322579,  1.145325422,  -0.006461966,  -0.118993916,  0.058771510,
-  -0.011823099,  0.023186287,  -0.028042631,  0.181481093,  0.142978877,  0.082658961,  -0.009184137,  0.288006902,
-  -0.099666327,  0.042102970,  0.171312943,  0.063534647,  0.004725570,  0.033877116,  0.023310371,  -0.002437040,
-  0.000082580,  -0.059454039,  -0.046997882,  -0.040233556,  0.089127347,  -0.110356733,  -0.024385579,  -0.106505357,
-  -0.143444344,  0.021752860,  -0.009662144,  -0.024641052,  -0.027135523,  -0.136631802,  -0.129849210,  0.112564132,
-  -0.052830733,  -0.045027189,  -0.055867307,  -0.017324865,  0.252033353,  -0.175368965,  0.040952630,  -0.152899802,
-  -0.005513783,  -0.141342998,  0.152773932,  -0.154541850,  0.085265361,  0.166179687,  0.138011649,  -0.048218023,
-  -0.151481092,  -0.141520560,  -0.067846045,  0.033037327,  -0.142299712,  0.164209992,  -0.120396301,  0.010127239,
-  0.157180116,  -0.125313640,  0.013100263,  -0.101641111,  0.145650372,  0.014697845,  -0.024605736,  0.020914085,
-  0.083708599,  -0.338733763,  -0.107538983,  -0.087609336,  -0.063741870,  0.029328279,  -0.069196388,  0.187013805,
-  -0.013913871,  -0.075203218,  0.031867679,  -0.126529276,  0.599316120,  0.203240767,  -0.086773261,  -0.102006465,
-  -0.097101644,  0.043570653,  0.081001058,  -0.040661160,  0.029126346,  -0.114046730,  0.194332555,  0.048541378,
-  -0.115596965,  -0.059762198,  -0.144326299,  0.072978519,  -0.068455532,  0.005209178,  -0.291495383,  -0.002553518,
-  -0.049859591,  -0.100369021,  -0.047264267,  0.029349297,  0.002113833,  0.099621542,  -0.081143208,  -0.105008893,
-  -0.084768847,  -0.139507622,  0.175281554,  0.015088914,  -0.119611114,  -0.130127296,  -0.004789464,  -0.093300164,
-  0.594756484,  -0.007609996,  -0.140773147,  0.056733947,  -0.051662184,  -0.079639964,  -0.045331981,  -0.108026817,
-  -0.088996716,  0.285438448,  -0.116725609,  0.138073668,  -0.016736537,  0.116784863,  -0.040305048,  0.002464392,
-  0.160428882,  -0.087345295,  -0.049840890,  0.068937995,  -0.142298132,  -0.031175587,  -0.044435985,  -0.105616353,
-  -0.116323531,  -0.044741634,  -0.028569359,  -0.046457455,  -0.080719829,  0.034705061,  -0.006503462,  -0.032419182,
-  -0.028605890,  0.030292353,  0.259795427,  -0.038092893,  -0.116733119,  -0.043622799,  0.161639303,  0.093905732,
-  -0.024915120,  -0.001541960,  -0.105875634,  0.092161007,  0.092051931,  -0.049157053,  -0.119866967,  -0.024117511,
-  -0.026800200,  0.003245072,  0.070232533,  -0.026249923,  -0.144489616,  -0.057489671,  0.154298201,  0.040573340,
-  0.127865896,  -0.025291547,  0.105338201,  -0.081526510,  -0.000415257,  0.020286229,  -0.029019676,  0.166071132,
-  0.123921141,  -0.075375982,  -0.033115536,  -0.042591013,  -0.051949330,  -0.219520941,  -0.020482292,  0.102296896,
-  0.074247621,  0.017487336,  -0.032864839,  -0.086101837,  -0.045288816,  -0.041796140,  -0.104349062,  0.083220392,
-  0.126750335,  -0.128300771,  0.025175489,  -0.083796665,  -0.059875645,  0.123191714,  -0.030490402,  -0.140021533,
-  -0.112077430,  0.039206039,  0.045560196,  0.049070589,  -0.106609702,  -0.132301569,  0.090581983,  -0.059954792,
-  -0.109497219,  0.046335474,  -0.218758911,  -0.087885372,  0.131405413,  -0.064016365,  0.043342076,  -0.045166750,
-  0.121249691,  0.086160049,  0.099248692,  -0.112525523,  -0.073545679,  0.023225658,  0.146151155,  -0.010361133,
-  -0.068449721,  -0.116262682,  -0.042516671,  0.067216635,  -0.072551325,  -0.046532471,  -0.070518143,  0.152476370,
-  0.176039666,  0.214776754,  -0.126663640,  -0.143538743,  -0.123607591,  0.128396049,  -0.004830793,  -0.228348747,
-  0.000389626,  0.063705146,  -0.085691422,  0.053219240,  0.050818793,  0.065621547,  -0.100943200,  -0.099820718,
-  -0.028723035,  -0.036079772,  -0.041666023,  -0.041831277,  -0.054904051,  -0.137492657,  0.062385611,  0.011643015,
-  0.152221888,  -0.082484476,  -0.095649540,  0.108455524,  -0.005171997,  0.090584204,  0.036850125,  -0.018892733,
-  0.002579348,  0.054736424,  -0.074700505,  -0.074070595,  -0.026608096,  0.025188208,  -0.093534812,  0.085183121,
-  0.030706555,  -0.116608992,  -0.125515029,  -0.104930989,  0.077881061,  -0.125350326,  -0.126691908,  -0.114329740,
-  -0.070050023,  -0.107423618,  -0.044862397,  0.002562070,  0.013974883,  0.108513616,  -0.079181492,  -0.132254213,
-  0.062980570,  0.066742741,  -0.064068131,  -0.000246285,  -0.064848199,  -0.031543612,  0.072997190,  0.056363340,
-  -0.079523280,  0.132533848,  -0.091506153,  -0.108974993,  0.075444087,  -0.113030724,  -0.057068527,  -0.010295983,
-  -0.068161182,  -0.049099293,  0.072482817,  -0.137032449,  0.200643942,  0.200762406,  0.188730225,  0.187633961,
-  0.191736057,  0.035294361,  0.006846713,  -0.038897339,  -0.103146970,  -0.054220490,  -0.048455775,  -0.013334460,
-  0.123355508,  0.161605731,  0.176061392,  -0.010754184,  0.231115818,  0.124713257,  -0.278332084,  -0.073481686,
-  -0.044714294,  0.085144922,  -0.033663090,  0.034157328,  0.151953489,  -0.071215391,  0.120259918,  -0.104396798,
-  -0.008719443,  -0.141931325,  -0.069043934,  0.176511124,  -0.116784491,  0.169291571,  -0.076768503,  -0.134483993,
-  -0.044288501,  0.176890314,  -0.133089393,  -0.048486702,  -0.048340075,  -0.049873389,  -0.025492527,  0.028059378,
-  -0.048072651,  -0.081430689,  -0.077314697,  -0.230429381,  0.006406853,  -0.027466506,  -0.058882780,  0.090699449,
-  -0.100445777,  0.086663589,  -0.126159295,  -0.024716780,  0.085690692,  -0.114525646,  0.019014506,  0.320810705,
-  0.033371095,  -0.113690451,  -0.114753857,  -0.005674665,  -0.023113625,  -0.061308742,  -0.001819432,  -0.015549014,
-  -0.037791461,  -0.056409381,  0.176764473,  0.012603544,  0.090792120,  -0.028663985,  -0.085714631,  0.089071095,
-  -0.330155104,  0.085417591,  0.019201443,  0.205713630,  -0.039510984,  -0.033844035,  0.082318753,  0.011114043,
-  -0.070197016,  -0.061281666,  0.094653398,  0.134258255,  0.033523779,  0.097161293,  0.041877680,  -0.126576230,
-  0.096971817,  0.011524001,  0.983622372,  0.057193056,  -0.108589187,  -0.011020502,  -0.001560459,  0.022591246,
-  -0.171778679,  0.267737389,  0.045151424,  0.099103794,  0.032285437,  0.326312661,  -0.042930931,  -0.001250692,
-  0.158302188,  0.014288965,  0.038182583,  0.023673546,  -0.107658401,  0.000302110,  -0.110537782,  0.027796753,
-  -0.099959642,  -0.090794571,  -0.105163179,  -0.117708132,  0.036036838,  -0.142501771,  0.020510407,  0.002219375,
-  -0.022085914,  -0.096225247,  0.048620667,  0.184430465,  -0.083433025,  0.016776469,  0.258366615,  -0.012691006,
-  0.334396631,  -0.016215757,  -0.184930310,  -0.093199052,  0.141486287,  -0.066274561,  0.014647837,  0.087865517,
-  -0.011344302,  0.204627484,  -0.090509936,  -0.135070875,  -0.125546202,  0.083653457,  -0.128731012,  0.036913734,
-  -0.048838548,  -0.132524803,  -0.050631978,  -0.040099286,  0.325076818,  -0.018600702,  -0.058381483,  0.038147349,
-  0.160568491,  -0.088799804,  -0.089797035,  -0.124941304,  -0.059053298,  -0.119486541,  0.062857315,  -0.212309390,
-  -0.135769039,  0.096120305,  -0.083937332,  -0.140929684,  0.174099147,  -0.095893048,  0.023206050,  0.147599801,
-  -0.121483624,  -0.104235455,  -0.031035999,  -0.105726495,  -0.118794814,  0.033083443,  0.109627254,  -0.096204802,
-  0.084754057,  -0.088961288,  -0.089704633,  -0.129052624,  0.223760292,  0.045326512,  0.272134900,  0.102208734,
-  0.060412508,  0.104644969,  -0.089646548,  -0.094253704,  -0.371878326,  -0.018916219,  -0.125867575,  -0.122687958,
-  -0.066162176,  -0.014825408,  -0.079741895,  0.036891062,  -0.008260927,  -0.128421605,  -0.059589315,  -0.029916480,
-  -0.065168925,  0.087459654,  0.002209932,  -0.080090642,  -0.122925170,  0.079241283,  -0.090289772,  0.004367176,
-  -0.086409912,  0.114717349,  -0.015793368,  0.161922991,  -0.130041927,  0.106065765,  0.060467020,  -0.029025456,
-  0.137570873,  0.267688364,  -0.048148002,  -0.095467620,  -0.029489554,  -0.130588055,  -0.038619742,  0.006426905,
-  0.159667075,  0.119462572,  0.174455449,  0.122593313,  0.154147878,  0.192491069,  -0.099546567,  -0.006443809,
-  0.199285954,  -0.044581804,  -0.055199243,  0.422194690,  -0.100034297,  0.075304382,  0.164280459,  -0.089135088,
-  0.002420698,  -0.099655837,  -0.032042965,  -0.040276483,  0.009022024,  -0.001299918,  -0.232149556,  0.058459319,
-  0.042250723,  -0.136284307,  0.072400630,  0.062521689,  -0.028354205,  -0.044961184,  -0.010504039,  -0.011757313,
-  -0.013441776,  -0.003285929,  -0.002940980,  -0.038020119,  -0.012354868,  0.116515025,  -0.135197759,  -0.060507804,
-  -0.100779742,  -0.001347759,  0.129669115,  0.033654008,  0.078315854,  -0.011264805,  -0.009999993,  -0.017941803,
-  0.019377014,  0.140746728,  0.128496841,  -0.151662380,  -0.013989069,  0.041703589,  0.118973851,  -0.137312666,
-  -0.063259885,  -0.098757282,  0.092103019,  0.110001229,  -0.140867889,  0.082347892,  0.012616800,  -0.075242251,
-  0.151177973,  -0.053322311,  -0.132767498,  0.191667154,  -0.062564656,  -0.136558935,  -0.119568050,  -0.116075397,
-  -0.116717413,  0.130841494,  -0.117502369,  -0.053815193,  0.087909766,  -0.060303159,  0.075459369,  -0.136439070,
-  -0.227741539,  0.007199683,  -0.019146640,  -0.122141451,  0.083948366,  -0.003485157,  0.088882104,  -0.139724657,
-  -0.009273886,  -0.104778640,  0.086240001,  0.128645614,  -0.130635098,  0.035187989,  0.062340748,  0.077866167,
-  -0.142763406,  -0.071622662,  -0.125564635,  0.069472887,  -0.001817511,  0.019293971,  -0.119790345,  0.086979300,
-  0.023582878,  -0.125363171,  -0.038411751,  -0.121856749,  0.088708937,  0.009608313,  -0.031859413,  -0.117754892,
-  -0.090076178,  -0.037784886,  0.042777475,  0.068475448,  -0.134023219,  -0.083175428,  0.064848602,  -0.169041559,
-  0.055165455,  -0.196960598,  0.094761305,  0.011230937,  0.045773175,  -0.095482104,  -0.197001219,  -0.171604082,
-  0.052184109,  0.051315438,  0.027435983,  0.058871787,  -0.094245754,  -0.221911162,  0.014569903,  -0.090152025,
-  0.236029282,  0.018008292,  0.377440155,  0.144573420,  -0.004607956,  0.024797963,  0.071287632,  -0.140447050,
-  0.113467924,  -0.084779784,  -0.113347173,  -0.080188297,  0.066184886,  -0.056954816,  0.029731575,  -0.111810133,
-  0.075944543,  -0.185547650,  -0.131239429,  -0.161676258,  -0.157468170,  -0.146228805,  0.063513048,  -0.080896996,
-  0.090879731,  0.056301016,  0.142627954,  0.021923417,  0.152535126,  -0.004130762,  0.028596848,  0.359569192,
-  -0.018642828,  -0.103013627,  0.069229826,  0.104831643,  0.000545575,  -0.082725734,  0.162419930,  0.010504926,
-  -0.062328760,  -0.102676123,  -0.085255057,  -0.032294504,  0.016758181,  -0.085676380,  0.066492088,  0.112770788,
-  -0.036963675,  0.461746454,  -0.012757781,  -0.029234096,  -0.012523828,  -0.126914755,  -0.032938454,  0.039554432,
-  -0.096522644,  -0.032579698,  -0.035022046,  0.030758724,  0.227674961,  -0.130733967,  -0.078443862,  -0.102182060,
-  0.034654412,  -0.013375438,  -0.078685500,  -0.090100147,  0.100454308,  -0.026370673,  0.144644231,  0.001771432,
-  0.032353040,  0.159322008,  0.023195455,  0.161864772,  -0.121289998,  0.080541432,  -0.074692771,  0.129144475,
-  0.152828604,  0.030322008,  0.101126947,  0.187338382,  0.159208551,  -0.083885849,  -0.087069012,  0.056172464,
-  -0.001110211,  -0.270605654,  -0.070609666,  -0.139765635,  -0.113860659,  0.043224115,  -0.125128418,  -0.011385812,
-  -0.036460854,  0.189190924,  0.136206016,  -0.079877511,  0.126830772,  -0.009783578,  -0.094991781,  -0.004704266,
-  -0.003496427,  -0.056998871,  0.057943314,  0.135398433,  -0.086666092,  0.070619710,  0.066614129,  -0.076017812,
-  0.248349845,  0.060097072,  0.338624239,  0.090219654,  -0.141020313,  0.000914752,  0.261938691,  -0.003103713,
-  0.040953726,  0.115321420,  -0.023453943,  0.157333344,  -0.018105799,  0.030045133,  0.000678169,  0.030517986,
-  -0.029477693,  -0.144968867,  0.028393349,  0.095151164,  -0.028592139,  -0.018927786,  0.021302620,  0.036248781,
-  -0.074477516,  0.078828767,  0.147146299,  0.098251455,  -0.144330308,  0.063054778,  -0.018018454,  0.160164326,
-  0.031735819,  -0.139320433,  -0.045270830,  -0.246928960,  -0.010504965,  0.032223832,  -0.050349079,  -0.080596566,
-  0.068225421,  0.075788654,  0.098163791,  -0.001772895,  -0.121847577,  0.068708047,  -0.097587541,  0.047413785,
-  0.072358467,  0.113655902,  -0.167262912,  0.068226904,  0.061712589,  0.027000921,  0.109493501,  -0.107811749,
-  -0.093258277,  -0.139711931,  0.051069718,  0.240960687,  0.142657474,  0.070865758,  0.028916156,  -0.102572590,
-  0.349497110,  0.128401414,  0.012606874,  -0.113255098,  -0.043355126,  -0.010716279,  0.011121316,  -0.077624135,
-  -0.023876539,  -0.020739373,  0.075110063,  0.147943363,  0.251950443,  -0.121842183,  0.023691466,  -0.117416129,
-  -0.061478931,  -0.111358404,  -0.023272058,  -0.071376830,  0.007016817,  0.043206960,  -0.102719471,  -0.017245246,
-  -0.059003510,  -0.025833003,  0.185983419,  -0.102473162,  0.091970399,  0.066118814,  0.005742505,  0.067759216,
-  0.066611484,  0.072684422,  0.007882438,  0.132217437,  -0.133089185,  0.046615321,  -0.102718920,  0.008097139,
-  -0.003010160,  -0.144415006,  0.062586598,  0.124050654,  -0.079214148,  0.144146264,  -0.029100314,  -0.103725687,
-  -0.114018224,  -0.126544639,  0.046051580,  -0.112134859,  0.168939099,  -0.042401515,  -0.046188869,  -0.109739989,
-  0.132816792,  -0.024750717,  -0.517961383,  0.082373276,  -0.112784624,  -0.005594573,  0.055484500,  -0.119326569,
-  -0.130704641,  0.214304820,  0.177283421,  0.069786593,  -0.126763821,  -0.046616614,  -0.009387753,  0.047834121,
-  -0.004770817,  -0.029017625,  0.060370173,  0.038655203,  1.352424860,  0.065703094,  -0.075223930,  0.061125457,
-  -0.203588113,  0.083347842,  -0.274881274,  0.145326033,  -0.159479722,  -0.027372524,  -0.003948316,  0.437947065,
-  -0.000047691,  0.078675523,  -0.077173315,  -0.004590103,  -0.069402352,  -0.073584698,  -0.040939704,  0.032264952,
-  0.079968661,  -0.112170696,  -0.111117780,  0.116000161,  0.096471354,  -0.143595725,  0.120269954,  0.045725215,
-  0.119604453,  -0.049676232,  0.076640651,  0.080966242,  0.027833838,  0.047683399,  -0.094674051,  0.011935361,
-  0.039581310,  -0.052604564,  -0.013677594,  0.053989783,  -0.134563029,  -0.015006751,  -0.002340178,  0.093135528,
-  0.030243522,  -0.024278069,  -0.013740981,  -0.106955841,  0.204575926,  0.133218214,  -0.055313818,  -0.104239434,
-  -0.008750434,  -0.126842558,  -0.065809563,  -0.041258521,  0.026310705,  0.108471431,  0.485711932,  -0.126359105,
-  -0.014960033,  -0.011147345,  -0.069801748,  -0.097366989,  0.062119666,  -0.018002827,  -0.016835198,  -0.123958707,
-  -0.095532343,  0.234255701,  -0.111098617,  -0.066141754,  -0.015273594,  -0.089669079,  -0.090278812,  0.225098938,
-  -0.140805557,  -0.078264564,  -0.006826858,  -0.104427382,  0.040064022,  0.133138850,  0.131134674,  -0.085906520,
-  0.234037817,  0.076263011,  0.017383832,  -0.056863572,  -0.015199049,  -0.063086875,  -0.092412636,  -0.074354053,
-  -0.124220163,  0.000936825,  0.083107606,  0.056995820,  -0.073305897,  0.014715925,  -0.335361272,  -0.091199346,
-  -0.026545573,  -0.053754624,  -0.037484445,  0.037158385,  0.047980137,  -0.090060703,  0.005617667,  -0.126667604,
-  -0.211912766,  0.165583774,  -0.145270735,  0.052521825,  0.048041653,  -0.134305626,  -0.109356031,  -0.170644358,
-  -0.155607209,  0.082477815,  0.045508377,  -0.138866276,  -0.052136716,  0.164729998,  0.066428907,  0.082600974,
-  -0.075320177,  0.052849922,  0.013927713,  0.320184946,  0.062138878,  0.054193027,  0.026995063,  0.045950785,
-  -0.002153276,  0.135689855,  -0.054587852,  -0.106130846,  -0.178261936,  -0.187063694,  -0.050980460,  -0.267114818,
-  0.076044612,  -0.305937737,  0.045649078,  -0.176421523,  0.095191255,  -0.155216709,  0.045758758,  0.047424704,
-  -0.211196035,  0.108985119,  -0.216305807,  -0.284226328,  -0.001726856,  0.052599989,  -0.033087403,  -0.096182108,
-  0.464143574,  -0.133643135,  0.069789886,  0.090695582,  -0.001066855,  0.146359503,  -0.099923417,  -0.076417416,
-  -0.022727640,  -0.091059074,  -0.060698170,  0.229397744,  -0.130244985,  0.158757091,  -0.088697344,  0.146281868,
-  -0.138388067,  0.149771601,  -0.052097362,  0.083187081,  0.057743590,  0.130642325,  -0.081771709,  -0.060421199,
-  -0.093803816,  0.063345797,  -0.064697832,  -0.054492615,  -0.025556952,  -0.222096622,  -0.023695514,  -0.029414469,
-  0.026146233,  -0.112246245,  0.011621853,  -0.080532953,  0.087380446,  0.001254105,  0.076889142,  -0.111417323,
-  0.140065506,  0.182510048,  0.091981493,  0.059153225,  0.097374283,  -0.038746275,  0.079362050,  -0.114203304,
-  -0.054501344,  -0.003774594,  0.093314357,  -0.065010004,  -0.119215228,  0.068807878,  0.104723282,  -0.029535158,
-  -0.036510464,  0.011522204,  -0.128887638,  0.161076903,  -0.043247048,  -0.073318295,  0.035113450,  -0.099928617,
-  -0.012623445,  -0.000768604,  -0.016044036,  0.001066006,  -0.008010098,  -0.106964923,  -0.203292593,  -0.014005830,
-  -0.345151007,  -0.015994975,  -0.012872584,  -0.211653471,  0.367130339,  -0.014380691,  0.081291161,  0.100799061,
-  -0.004823548,  -0.257865816,  -0.193215549,  -0.016114771,  -0.004597946,  -0.098650910,  -0.080833644,  0.464128286,
-  -0.146878451,  0.134155542,  -0.103409842,  -0.135710612,  -0.096835352,  0.138169289,  -0.022291780,  0.088790692,
-  -0.112632573,  0.225366965,  -0.087587200,  -0.107807927,  -0.095649444,  -0.052005053,  -0.058436293,  0.113458902,
-  -0.000902072,  -0.069217674,  -0.119706631,  -0.108314119,  -0.108902417,  -0.136638328,  -0.130345345,  -0.032220624,
-  0.024298580,  -0.103234507,  -0.097800076,  0.040354937,  -0.289644718,  0.049617209,  0.040209949,  -0.031992763,
-  -0.169642672,  0.136865109,  0.104875714,  -0.015221473,  -0.127497151,  0.054458205,  -0.087592319,  0.071957514,
-  0.007757740,  0.045256615,  0.038151279,  -0.249201551,  0.043874878,  -0.223321393,  0.110882685,  0.048298899,
-  0.048909251,  -0.005621170,  -0.145022973,  -0.121548802,  0.048078939,  0.092439674,  0.085816421,  0.056100182,
-  -0.056600340,  0.431908906,  0.002566336,  -0.086390480,  -0.076454736,  0.056033995,  -0.044593245,  -0.026016869,
-  -0.013274858,  0.010498176,  -0.065043204,  -0.110328808,  -0.026654594,  0.253574818,  -0.021063562,  -0.134995461,
-  -0.016143514,  -0.020675225,  0.176300764,  0.012500352,  0.045959260,  -0.075665869,  -0.133021802,  -0.003780477,
-  -0.074672244,  -0.108598858,  0.072255313,  0.238443613,  0.002626783,  -0.078873545,  -0.119136840,  -0.008089926,
-  -0.073480055,  -0.028315669,  0.093949027,  -0.003426193,  -0.127316281,  -0.123001441,  -0.061621502,  0.087276116,
-  0.025236243,  -0.029669754,  0.205579638,  -0.082287945,  0.132488757,  0.102953471,  -0.000715693,  -0.031011498,
-  -0.023328708,  -0.131397024,  0.073374681,  0.076336242,  -0.045479879,  -0.026087457,  0.092908211,  -0.008611830,
-  -0.033461343,  0.005626607,  -0.095613465,  -0.209740058,  0.050580397,  0.001714928,  -0.005168875,  0.005343085,
-  0.022710739,  -0.170015216,  0.016739637,  0.012926919,  0.066450387,  -0.224189490,  -0.137293845,  0.183141068,
-  -0.008691647,  0.014915670,  0.121892639,  0.015703743,  0.023837775,  -0.068142109,  -0.248624027,  -0.179526374,
-  -0.026586926,  -0.168157458,  0.022347065,  -0.328555703,  0.095684052,  0.020112559,  0.026315743,  0.078032240,
-  0.455705047,  0.025821356,  0.080781214,  -0.015026502,  0.097155966,  -0.084035121,  0.206474617,  -0.044180375,
-  0.172166184,  -0.110307567,  -0.033348061,  -0.049237549,  -0.077927068,  -0.019612463,  -0.016604051,  -0.022695469,
-  -0.089409277,  -0.022543600,  -0.017694740,  -0.111225918,  0.060215112,  -0.014531920,  -0.073408477,  -0.034968741,
-  -0.041541122,  -0.039316121,  -0.061248414,  -0.046830572,  -0.011011809,  -0.027422968,  -0.116672575,  -0.099645741,
-  -0.035639014,  0.057579901,  0.004246606,  -0.131147698,  -0.068453349,  0.038078282,  0.089242585,  -0.114998534,
-  0.320568234,  0.090628363,  0.029465683,  0.062784053,  0.074289463,  -0.040450573,  0.103350192,  -0.034731817,
-  -0.026161151,  -0.126441091,  0.088949017,  -0.056365184,  0.016205972,  -0.050824970,  0.089133710,  -0.096207850,
-  -0.089737639,  0.002022922,  -0.155435234,  -0.091620415,  -0.058194473,  0.129140243,  -0.039197180,  -0.066032439,
-  -0.044869684,  0.066782035,  0.056745511,  -0.048680492,  -0.046934653,  0.156197935,  -0.025430279,  -0.035415895,
-  0.030247085,  -0.035631835,  0.048530757,  0.002379266,  0.740790486,  -0.018756839,  -0.015691491,  -0.043189526,
-  -0.134322196,  0.138115808,  -0.056871586,  0.179855630,  -0.061647587,  -0.081275016,  0.126215473,  0.008156907,
-  -0.093925163,  0.036987424,  0.057983045,  -0.013181359,  0.224712774,  0.029980758,  -0.080617987,  -0.051596850,
-  0.129718095,  0.030211484,  0.324638546,  0.237251252,  0.097922951,  0.004490809,  -0.046860673,  -0.044980764,
-  0.126118869,  -0.133044764,  -0.057271320,  0.021877037,  0.236533642,  -0.033382252,  -0.060187779,  0.002170869,
-  -0.052877814,  0.125003070,  0.150383562,  0.026929826,  -0.325204521,  -0.072913617,  0.096962057,  0.123773359,
-  0.071368046,  -0.044390865,  0.130779713,  0.141942948,  -0.052802540,  -0.112894528,  0.011003667,  -0.058620609,
-  -0.047777101,  0.214583531,  -0.057760023,  0.017779415,  0.017489484,  0.061747208,  -0.037759595,  0.040717274,
-  -0.064570554,  -0.078727730,  0.080912068,  0.071731672,  -0.118078798,  -0.045402072,  0.093624778,  0.170490235,
-  0.049743056,  -0.303967595,  -0.055327896,  0.034702413,  -0.070896029,  -0.058762431,  0.177399054,  -0.122753650,
-  -0.037867703,  -0.113330618,  -0.141893804,  0.032517061,  0.164745405,  -0.122514471,  -0.033428192,  0.108470418,
-  -0.043428831,  -0.061651304,  -0.093131632,  -0.029951505,  0.111744881,  0.083453998,  -0.135826394,  -0.129837692,
-  0.295740873,  0.066192701,  -0.017114297,  0.077381164,  -0.047874607,  0.040811226,  -0.254229248,  -0.091109075,
-  0.016652223,  -0.124924451,  -0.092386536,  0.064334638,  -0.032030955,  -0.033577386,  -0.105111048,  0.209851801,
-  -0.143255010,  0.291288078,  -0.076272123,  0.081829794,  -0.088619843,  0.148538917,  -0.032054920,  0.032219429,
-  -0.056174535,  0.109812170,  0.162297577,  -0.133150876,  0.049557362,  0.204772949,  0.002884760,  -0.047207333,
-  0.131678671,  -0.027217871,  0.094086587,  -0.233047530,  -0.166915208,  0.117387541,  -0.111412615,  0.163798913,
-  -0.127561659,  -0.019166173,  -0.124493696,  -0.042521965,  -0.103988118,  0.139830068,  -0.028983233,  -0.117146112,
-  0.159926921,  0.088211283,  -0.069938540,  -0.132688254,  -0.120745935,  -0.076525442,  -0.134792715,  -0.093604378,
-  0.042577378,  0.109825231,  -0.046200622,  -0.141062483,  0.034131095,  -0.034031454,  -0.110262908,  -0.094591334,
-  -0.320092857,  0.000050094,  -0.044001795,  -0.061985031,  -0.068553120,  0.091149233,  -0.110710301,  -0.065276347,
-  0.084226720,  -0.037480656,  -0.031705879,  0.216935471,  0.334674150,  -0.051813155,  0.144921511,  -0.035557091,
-  -0.033906735,  -0.039422508,  -0.104986131,  -0.055219658,  -0.065722726,  -0.069745108,  -0.024180673,  0.371078134,
-  -0.052086510,  0.248446018,  -0.018633435,  0.303802997,  -0.084538318,  0.032482095,  -0.151831701,  0.042623680,
-  -0.100044444,  -0.041170385,  -0.125113711,  0.150922626,  0.058563851,  -0.103300542,  0.121567793,  0.126939937,
-  -0.020940097,  -0.111493051,  -0.069082588,  0.122267447,  0.066938803,  0.156254306,  0.095418602,  -0.094987281,
-  -0.124520540,  0.156263798,  -0.126522526,  0.247804686,  0.055216044,  -0.040880851,  -0.002173468,  -0.117138796,
-  -0.097537063,  0.126607314,  -0.304498017,  -0.071501970,  -0.083004504,  -0.126229763,  -0.072673097,  0.083514005,
-  -0.043204769,  0.098135658,  -0.058963865,  0.177946687,  -0.062026180,  -0.132230192,  0.060407002,  -0.082375348,
-  0.192972392,  -0.090347730,  0.081816003,  0.111006193,  1.195019722,  -0.073794350,  -0.091269538,  -0.090908326,
-  -0.001616387,  0.054927476,  -0.091649547,  0.346243382,  -0.014395113,  -0.132137865,  0.093129963,  0.280481189,
-  -0.033796027,  0.024033669,  0.013291001,  -0.064725906,  -0.128959090,  -0.035267517,  0.121653624,  0.029417831,
-  -0.126607627,  -0.107684821,  -0.010738082,  0.047829706,  -0.072825402,  -0.125054389,  -0.037553955,  0.155572668,
-  -0.024621865,  1.020926237,  -0.030505048,  -0.015538942,  -0.077346280,  -0.117324568,  -0.124250188,  -0.120023735,
-  -0.048146926,  -0.035046790,  0.017440028,  -0.027074456,  0.279301703,  -0.101470858,  0.067561984,  -0.060033061,
-  -0.122129783,  0.095599204,  -0.130389228,  -0.094372533,  -0.067585997,  0.087420434,  0.002913586,  0.001203178,
-  -0.157206565,  0.067501582,  -0.202309951,  0.066336103,  -0.118847631,  -0.160508394,  -0.142060071,  0.034295615,
-  0.071088947,  -0.063907541,  -0.188205153,  -0.183361202,  0.127000302,  -0.135043025,  0.025687575,  -0.079162396,
-  -0.060510814,  0.344548017,  -0.107024103,  -0.063201554,  -0.115533352,  0.166456535,  -0.055604227,  -0.049117688,
-  0.005474507,  -0.025516346,  0.123672627,  -0.009681773,  -0.067353457,  -0.131666362,  -0.071077749,  -0.095531449,
-  0.166904896,  -0.080441594,  0.153779998,  -0.054163963,  -0.043588541,  0.112858243,  0.071212307,  -0.089348115,
-  0.185868576,  -0.046659440,  0.006133993,  0.201657191,  -0.011292804,  -0.047917843,  -0.054337755,  -0.095716171,
-  -0.126528829,  -0.111246884,  0.069323003,  -0.047360785,  -0.114990160,  -0.106267229,  0.104953803,  -0.107982717,
-  -0.108215563,  -0.063916951,  -0.114961758,  0.063220240,  0.058161173,  0.011064027,  0.080036961,  -0.128016829,
-  0.322150260,  -0.046745032,  -0.045606021,  0.041460328,  -0.118669935,  -0.059502244,  0.372886807,  0.090211473,
-  0.110825405,  0.108673975,  -0.089076005,  -0.299094468,  0.047052827,  -0.155600190,  -0.141543880,  0.240170017,
-  -0.089121871,  -0.089205533,  0.041273203,  -0.076341920,  -0.108189419,  0.018975781,  -0.039254170,  0.005790771,
-  0.058794271,  0.048564713,  0.038364585,  -0.127882019,  0.024305688,  -0.087951288,  -0.037494037,  0.074448235,
-  -0.044754628,  -0.175692707,  0.007926820,  -0.160591096,  0.330161214,  -0.017834628,  -0.141902789,  -0.130534425,
-  0.258474231,  -0.014914067,  -0.103101999,  -0.062122725,  -0.095402688,  0.011284352,  -0.081721827,  0.028595088,
-  0.096756928,  -0.041410591,  -0.144394621,  0.373168319,  0.387735635,  -0.080957241,  0.006257998,  0.081636429,
-  -0.009736600,  -0.005615547,  0.490162104,  -0.009007681,  0.090244167,  0.015543323,  0.054617833,  0.242264166,
-  -0.067719541,  0.248435482,  -0.050878100,  0.013706486,  0.135937437,  0.022670124,  0.034302421,  0.099222183,
-  -0.067819156,  0.010104088,  0.056687929,  -0.047317065,  0.092753604,  -0.085225582,  0.052996825,  0.101492792,
-  -0.060636736,  0.160013884,  -0.131197587,  0.092882387,  -0.007950340,  -0.097061619,  -0.050248057,  0.298649281,
-  0.016452292,  -0.003236782,  0.076560639,  0.088379599,  -0.078225508,  0.055822048,  -0.035120569,  0.130372792,
-  0.170433417,  -0.056544714,  -0.050349239,  -0.120482914,  -0.087265208,  -0.126383185,  0.015754336,  -0.088861443,
-  -0.023811612,  -0.120172568,  -0.127663285,  -0.076453172,  0.152141854,  0.018684296,  -0.122135952,  -0.112758853,
-  -0.035676174,  0.185595140,  -0.087938190,  -0.123634256,  -0.056282781,  -0.105866224,  -0.079400018,  0.158839643,
-  -0.068239085,  -0.002476105,  -0.034403726,  0.054895166,  -0.098034866,  -0.073213302,  0.031636670,  -0.270184785,
-  0.011404917,  0.031621203,  -0.130724460,  -0.094150819,  0.046419017,  0.045924287,  -0.067387387,  0.057983018,
-  -0.073774055,  -0.098795354,  0.112004347,  0.057714049,  0.047867246,  -0.064357087,  0.002683690,  0.093489282,
-  0.115912795,  0.584417224,  -0.095136650,  0.129691377,  0.125508994,  -0.041886810,  0.065200180,  0.093857110,
-  0.150162861,  0.052930180,  -0.099025689,  -0.085487947,  0.329544872,  -0.035725608,  -0.100289077,  -0.089551456,
-  0.072673775,  -0.111345783,  -0.121287823,  -0.007243970,  0.118235067,  0.133144051,  -0.036951568,  -0.108038999,
-  -0.037374482,  -0.095101617,  -0.012957134,  0.117369629,  -0.064540543,  0.111670189,  -0.119370937,  0.022499261,
-  0.063361041,  0.108710989,  -0.129244506,  -0.102648310,  0.086486325,  0.010980950,  0.091340743,  -0.058078364,
-  0.003494933,  0.001591287,  -0.103638209,  -0.093597829,  -0.020785695,  -0.088941708,  0.088524982,  0.001493562,
-  0.009683380,  0.161185533,  -0.022029003,  0.211871311,  0.437317193,  0.247860298,  -0.087574996,  -0.020333489,
-  0.136646569,  0.203074098,  -0.018440729,  -0.115041777,  -0.074901320,  -0.020772371,  0.010423508,  -0.074866071,
-  0.035730731,  -0.137305439,  0.072545268,  0.031307891,  0.165016904,  0.119926944,  -0.371366978,  0.122964576,
-  -0.117162839,  -0.095426522,  -0.029235773,  0.016953209,  -0.008893594,  0.163573995,  0.041594990,  0.017637977,
-  0.046671659,  -0.007597973,  -0.113874421,  -0.008945866,  -0.096183158,  0.075562529,  -0.061032955,  0.092094585,
-  -0.060529571,  0.011410807,  -0.017931091,  -0.022210654,  -0.067024164,  -0.063463643,  0.058394779,  -0.084997304,
-  -0.012552661,  0.164534539,  -0.120979145,  0.246558219,  -0.115329593,  -0.073762119,  -0.102953561,  -0.092173636,
-  0.028562300,  -0.098720640,  0.002781993,  0.164257482,  -0.090271734,  -0.027168268,  -0.066974446,  0.241100952,
-  0.153778091,  -0.102150649,  -0.070592441,  0.199992269,  -0.008001707,  -0.057104286,  -0.081549339,  -0.092806183,
-  0.003813630,  0.085949048,  -0.093823865,  0.206195712,  0.082596101,  -0.023314750,  -0.085780114,  0.084714398,
-  -0.364064038,  0.046290196,  -0.144724905,  -0.215573892,  0.043452203,  -0.153004542,  -0.088986628,  0.039434575,
-  -0.147023246,  0.130577520,  -0.178277612,  0.122697130,  0.214793295,  -0.078600124,  0.035869237,  -0.189426601,
-  0.039803844,  -0.094993301,  -0.161640316,  -0.070351154,  -0.155810177,  -0.102401167,  -0.034336280,  -0.111799166,
-  0.042146124,  0.346446306,  0.129175350,  0.128733501,  -0.014740974,  0.375390083,  -0.140843332,  0.037719473,
-  -0.042490073,  0.121401981,  -0.002748481,  -0.122062579,  0.005041118,  -0.024262257,  0.089604750,  0.111782208,
-  -0.139157876,  -0.094271310,  0.105057590,  -0.105475731,  0.107085377,  0.077116713,  -0.099628791,  -0.010461310,
-  -0.113872662,  -0.080681674,  -0.032680906,  -0.046381347,  0.108479887,  -0.023698002,  0.124652497,  0.181164131,
-  0.093283176,  -0.075813793,  -0.267287076,  -0.137405336,  -0.124226235,  -0.100430585,  -0.039163150,  -0.076258972,
-  0.070683561,  -0.001007573,  0.054481924,  -0.123395972,  -0.135842383,  -0.066173129,  -0.161878243,  0.122624196,
-  0.112668224,  0.115064271,  -0.079368263,  -0.007187551,  -0.092002727,  0.050756704,  -0.041147292,  -0.065207981,
-  0.025963714,  0.191251710,  0.015189691,  0.101000622,  0.000761341,  -0.077997811,  0.007682428,  0.260674834,
-  -0.090186611,  0.046156995,  -0.062877245,  0.014006067,  0.083340354,  -0.059895314,  0.038619347,  0.226783559,
-  -0.064205386,  -0.141504660,  -0.123543277,  0.321382493,  -0.133368328,  -0.044431943,  -0.136845335,  -0.060688660,
-  -0.140358433,  -0.042259272,  -0.129286066,  -0.001393805,  -0.137266934,  0.080330908,  0.211009562,  0.296149850,
-  -0.007244655,  0.183619872,  0.090337567,  -0.130155846,  -0.443743229,  -0.104825757,  0.101669848,  -0.103088789,
-  -0.060956754,  -0.127914429,  0.102408789,  -0.090162337,  -0.070304379,  0.105729789,  0.024387445,  -0.049522325,
-  -0.092642412,  0.058317874,  -0.058993891,  0.076343350,  -0.043653317,  -0.035244543,  -0.130142972,  0.087240852,
-  -0.137811258,  -0.106506616,  -0.106486067,  -0.009119502,  -0.119936809,  -0.117562145,  0.100678258,  -0.103685796,
-  0.086164489,  -0.160805762,  0.094549291,  -0.034171291,  -0.014207089,  -0.127346069,  0.067987315,  -0.073212266,
-  -0.066722371,  0.022215534,  0.166832343,  -0.012520972,  -0.000643511,  -0.065842032,  0.121942267,  -0.064382508,
-  -0.055658109,  -0.099354193,  -0.072297059,  -0.141487539,  -0.139870077,  0.119140856,  0.113150619,  -0.073257446,
-  -0.073001936,  0.115940578,  -0.061136156,  -0.064824335,  0.178494588,  -0.135800660,  -0.203048617,  -0.105978824,
-  -0.076412410,  -0.023066074,  0.082048438,  -0.084868550,  -0.002263638,  -0.012803309,  -0.081489623,  0.199648395,
-  0.002946406,  -0.088302933,  0.154754385,  0.002287185,  -0.091394745,  0.250337988,  0.073629737,  -0.143189535,
-  -0.066291884,  0.201953664,  -0.018608630,  0.081850275,  -0.088190205,  -0.143070623,  0.007072038,  0.111922935,
-  0.009525117,  -0.109530114,  -0.094654679,  -0.373016685,  0.035681099,  -0.091148540,  -0.139790416,  -0.021458386,
-  0.037300464,  -0.132758096,  0.211096004,  0.069289081,  0.049238112,  -0.004983752,  -0.020886835,  -0.029526513,
-  -0.001849411,  -0.135825112,  -0.069021739,  -0.105599478,  0.134567499,  0.484357387,  0.006845223,  -0.016045224,
-  -0.007154476,  -0.041057017,  -0.064173400,  0.122740291,  0.026160372,  -0.125974357,  -0.020110423,  0.090790689,
-  0.243000910,  -0.156170189,  -0.011099101,  0.202822149,  -0.007745472,  -0.114855804,  0.271527380,  0.167661995,
-  0.177804172,  0.053252846,  0.143553421,  0.178552061,  -0.114853486,  -0.010260586,  0.158040628,  0.145755425,
-  -0.137985647,  0.079328924,  -0.100359514,  -0.014279319,  -0.047565557,  -0.117339574,  0.044324100,  -0.061591957,
-  -0.120645151,  -0.062579565,  0.141321227,  0.132066891,  0.021630466,  -0.463460207,  0.025112700,  0.068365917,
-  0.138197377,  -0.092143849,  -0.093037605,  -0.045011859,  -0.104659364,  0.023077773,  -0.114196137,  -0.044245057,
-  0.232402116,  -0.015924310,  -0.035036195,  -0.041479908,  -0.128993466,  0.094549559,  0.028400933,  0.728380203,
-  -0.095625952,  -0.083979808,  -0.066320494,  0.145872444,  -0.048324753,  -0.121144608,  -0.119895369,  -0.065989144,
-  -0.060516462,  0.127471104,  0.063675351,  -0.118316859,  -0.008166832,  -0.105417408,  -0.115632594,  -0.044474404,
-  0.058463942,  0.016224483,  0.159318566,  0.303599566,  -0.102712169,  -0.073949955,  -0.078021027,  -0.104029208,
-  0.016685570,  -0.036881752,  -0.075613625,  0.153912023,  -0.074142985,  -0.086717263,  -0.109079294,  -0.071715213,
-  -0.122130275,  0.109256566,  0.244685546,  -0.051549532,  -0.074025586,  -0.098466560,  0.004441202,  -0.382407665,
-  -0.110614270,  -0.051976122,  -0.137486219,  -0.141562223,  -0.079763532,  0.008411146,  0.071615778,  0.185616970,
-  0.232755423,  0.223987728,  0.050150674,  -0.087000266,  -0.095234662,  0.088107049,  -0.027487986,  -0.079240166,
-  0.036398184,  -0.025235431,  0.017252216,  -0.100696728,  0.050792541,  -0.084124513,  -0.036011782,  -0.046843410,
-  -0.071092904,  0.149851292,  -0.067179695,  -0.060665652,  -0.336626470,  0.005119232,  -0.099565178,  -0.025853259,
-  -0.117834881,  -0.010614911,  -0.073330536,  -0.085388832,  0.061866440,  0.141372234,  -0.027102411,  0.306143314,
-  0.177340135,  0.051741615,  0.009036688,  0.119893610,  -0.027143227,  0.095656835,  -0.059068270,  0.075036280,
-  0.027745023,  -0.111207858,  0.113409519,  0.199307233,  0.063266449,  0.147620469,  -0.018124474,  0.080620341,
-  -0.083624393,  -0.216257721,  -0.021819927,  0.047477417,  -0.005154671,  -0.157280803,  -0.176793799,  -0.065230228,
-  0.172776371,  -0.127294675,  0.063423723,  -0.163872421,  -0.133460373,  -0.010014525,  -0.047400065,  -0.009008612,
-  0.058554664,  0.065790676,  -0.170117319,  0.868947268,  -0.149915159,  -0.024912506,  0.074308850,  0.047760949,
-  -0.105540745,  0.033518527,  0.167754591,  0.039994054,  0.006096933,  -0.037609048,  0.378750861,  0.060689043,
-  -0.004296232,  -0.086531140,  0.183782190,  -0.119029120,  -0.030523183,  -0.139089063,  -0.022210738,  -0.133092031,
-  -0.116569072,  0.084159501,  -0.126628622,  0.005154893,  -0.031920951,  0.158022508,  -0.089663327,  -0.064319476,
-  -0.028079353,  -0.019094216,  0.019429047,  -0.055671923,  0.166985065,  -0.036430620,  -0.046138108,  -0.030195959,
-  -0.018547943,  0.064213015,  0.013740078,  -0.202676475,  -0.050346650,  -0.110182233,  0.108369805,  0.114810131,
-  -0.068024985,  -0.053632401,  0.009022141,  -0.005078512,  0.082497813,  -0.014871867,  -0.120866269,  -0.003438977,
-  0.034506332,  0.109713152,  0.061793022,  0.115209855,  0.099410437,  -0.115335062,  -0.135618389,  0.043476369,
-  0.116024196,  -0.001349967,  0.212322265,  -0.106908143,  -0.122931495,  -0.022507539,  0.000860258,  -0.018692404,
-  -0.293252140,  -0.126438051,  0.007573198,  -0.071204290,  0.026172329,  0.011260098,  0.057677206,  -0.128298864,
-  0.018770007,  0.013472647,  0.002323823,  -0.012328709,  -0.028025882,  0.017083397,  -0.016534967,  0.074791655,
-  -0.033790931,  0.043748263,  -0.142950252,  0.070966601,  0.045700155,  -0.085117832,  -0.100435510,  -0.133678108,
-  0.052057229,  0.071138985,  0.039692666,  0.121400066,  -0.015437543,  0.067513570,  -0.018639684,  -0.084726676,
-  0.054953396,  0.102891482,  -0.062248543,  -0.019305650,  0.052816499,  -0.060612001,  0.189048976,  -0.021554848,
-  0.144694641,  -0.072898813,  -0.111427493,  0.000104426,  0.056322023,  -0.015919657,  0.233936727,  -0.074192472,
-  -0.095860571,  -0.022674667,  0.053637993,  0.072103880,  0.038018271,  -0.012606134,  0.055936180,  -0.104337364,
-  -0.036456466,  -0.031631619,  -0.174658269,  -0.067776859,  0.113903925,  -0.140891969,  -0.111930728,  0.157155782,
-  -0.047522165,  -0.064806946,  -0.122025803,  0.113339163,  -0.109941602,  0.288562685,  0.112678014,  -0.050741542,
-  -0.013949466,  0.133903772,  0.082333408,  0.244326711,  0.699294031,  -0.067993492,  -0.104972295,  0.018991396,
-  -0.104085937,  -0.055079821,  -0.063975938,  0.061396021,  -0.062543474,  -0.071385786,  0.003149450,  -0.209738895,
-  -0.032298163,  -0.189350620,  -0.072121717,  0.024511319,  0.118368089,  0.071954064,  -0.072261065,  0.105229437,
-  0.023650086,  -0.118889257,  0.140573412,  0.028629748,  0.077817850,  -0.184376791,  -0.025004445,  -0.118020669,
-  0.037377983,  -0.153718457,  -0.084299438,  0.060701087,  -0.144023702,  -0.093297578,  -0.173652828,  0.042674512,
-  0.037164569,  0.102347463,  0.128719553,  -0.024257101,  0.309647262,  -0.104479268,  -0.142604664,  0.101432353,
-  -0.091931313,  0.062160201,  -0.045782119,  0.103305869,  -0.109455526,  0.114248283,  -0.005124779,  0.146409765,
-  0.172410563,  0.046811324,  0.024229579,  -0.061415359,  -0.112691253,  -0.048982874,  -0.044020094,  0.042550717,
-  -0.030891847,  0.001294270,  0.057096168,  0.032421701,  -0.135137215,  -0.085834846,  -0.131514773,  0.045392830,
-  0.084449857,  -0.171999127,  -0.012626680,  -0.017953297,  -0.122940697,  -0.015922680,  -0.072322130,  -0.059143990,
-  0.140091464,  -0.057790548,  -0.012818485,  0.146182284,  0.013135803,  0.171157777,  0.178698197,  0.168747127,
-  0.033221744,  0.058070995,  -0.004676076,  -0.053136375,  0.150412440,  0.056121688,  0.164766327,  0.059871800,
-  -0.063189857,  0.001472868,  -0.054105811,  0.075941756,  -0.015744394,  -0.010448277,  -0.249376103,  -0.051234834,
-  -0.183464512,  -0.033753656,  0.059419483,  -0.157396093,  0.036401570,  -0.089947738,  0.026937852,  0.005918221,
-  0.141392499,  -0.038574114,  0.090204842,  -0.049311534,  0.125552595,  0.057554629,  -0.151021913,  -0.169935659,
-  -0.167219177,  0.028703600,  -0.052227542,  -0.173780039,  0.062657580,  0.050504010,  0.129398793,  0.018821768,
-  0.164871722,  -0.043366779,  -0.085918799,  0.382059187,  -0.021998461,  0.186183512,  -0.077925928,  -0.057446063,
-  -0.101977751,  0.178074986,  -0.056585640,  0.028905064,  -0.066918828,  -0.049109068,  -0.027961224,  -0.030359717,
-  -0.066705354,  0.028909860,  -0.057627417,  -0.053013802,  -0.021163067,  -0.027358619,  0.197860196,  -0.047852997,
-  -0.038260855,  -0.030784076,  -0.020022139,  -0.022482151,  0.019458799,  -0.086242765,  -0.048296329,  0.127863035,
-  -0.215036690,  -0.084243543,  -0.071003720,  -0.064678751,  -0.119889691,  -0.138491228,  0.089254133,  -0.036121380,
-  0.046276107,  0.113641426,  0.112309068,  -0.000038141,  -0.106155843,  -0.009108988,  0.171833545,  0.143582523,
-  0.125401452,  -0.021041686,  0.201352730,  -0.065141313,  -0.089368761,  -0.024730554,  -0.100638568,  0.210845962,
-  -0.134807408,  0.097756684,  0.017320300,  -0.040851247,  0.017456457,  -0.226677284,  -0.028082460,  0.115890048,
-  -0.084870756,  -0.025124626,  -0.077906974,  0.018887246,  -0.096070647,  0.175890163,  0.126058370,  0.079623565,
-  0.128858432,  0.122401781,  0.077791475,  -0.035889514,  -0.067577623,  -0.087344259,  -0.121516690,  0.178828433,
-  -0.142497793,  0.008850390,  0.020081375,  -0.042040564,  0.015296358,  -0.009361589,  -0.041928276,  -0.114293762,
-  -0.130316600,  0.110361323,  -0.266610056,  0.027113874,  -0.071098268,  -0.136475950,  -0.130403802,  0.078547657,
-  -0.007871336,  0.239210233,  0.072421677,  0.069536597,  0.002497641,  0.219137192,  0.093571834,  -0.115778640,
-  0.013088939,  -0.106142841,  0.060703177,  -0.053622212,  1.055288672,  -0.090238281,  -0.112103067,  0.064737663,
-  -0.152415127,  0.034718603,  -0.159195065,  0.121596761,  0.040491577,  -0.019515295,  -0.058045067,  0.266632348,
-  -0.068630330,  -0.067739412,  -0.032037660,  -0.064805098,  -0.038996439,  -0.107560262,  0.179838210,  -0.057997219,
-  -0.074480496,  0.004781953,  0.154762477,  0.258717984,  0.012573898,  0.006131116,  0.160019949,  -0.020274725,
-  0.283143669,  0.361861318,  -0.036972076,  0.140790999,  -0.095778957,  0.003725393,  -0.041559614,  -0.041506857,
-  0.214691922,  -0.029301800,  0.034559086,  0.108474866,  -0.211535305,  0.074658461,  0.096392103,  0.193680957,
-  0.000252651,  0.131172955,  -0.194817796,  -0.192874238,  0.083204672,  0.055090345,  0.036657680,  0.045668568,
-  -0.049915060,  0.037102923,  0.075787507,  0.034688804,  -0.153984413,  0.046992552,  -0.070051871,  -0.064853296,
-  -0.081931368,  -0.038243145,  0.049938761,  0.055248931,  -0.264187515,  -0.005104921,  -0.057998635,  0.058391772,
-  -0.043835580,  0.401139677,  -0.038646437,  0.101014145,  -0.133662760,  -0.085162967,  0.000783686,  0.026744453,
-  -0.007725279,  -0.021128556,  0.104756869,  0.120799087,  -0.021613738,  -0.002849726,  0.019436333,  0.000979799,
-  0.100885093,  -0.102614425,  0.109531194,  -0.071033932,  -0.056987658,  -0.098657779,  0.080641434,  -0.144877985,
-  0.033687469,  0.111796826,  0.087258361,  0.009005893,  0.029773166,  -0.078346997,  0.316028267,  -0.042858120,
-  0.069818094,  -0.128588513,  0.001057431,  -0.114061885,  0.088382661,  0.025538249,  -0.101731896,  -0.033382773,
-  -0.115058415,  -0.114370458,  0.214953944,  -0.051884465,  0.136182711,  0.016154129,  -0.006682411,  -0.004660413,
-  -0.075898960,  0.149658427,  0.017048525,  0.111024417,  -0.035701878,  -0.025872715,  0.193229347,  0.015286801,
-  -0.004345030,  -0.013923600,  -0.108931124,  -0.208689824,  -0.045396913,  0.099239923,  -0.039879031,  -0.139191568,
-  -0.028424151,  -0.144862533,  -0.066917375,  -0.099229619,  -0.136105627,  -0.090056315,  -0.101243094,  -0.064863287,
-  0.182305440,  0.137449235,  0.154477894,  -0.054568082,  0.063039571,  -0.027245689,  0.104713202,  -0.048331171,
-  0.022474987,  -0.034878001,  -0.138695151,  -0.102200434,  -0.117732555,  -0.065236725,  -0.129972950,  -0.035272606,
-  -0.232776672,  -0.072947480,  -0.058428846,  -0.138388038,  -0.056855809,  -0.085160896,  0.015246026,  -0.112269700,
-  -0.079081833,  0.078487895,  -0.015689153,  -0.049020872,  0.127917543,  -0.113357976,  0.250837564,  -0.054502837,
-  0.161358267,  -0.054879114,  0.391694695,  0.149803042,  -0.058307074,  0.063379757,  -0.064758457,  0.289837033,
-  0.172009528,  0.064744711,  -0.054430310,  0.108284034,  0.067867577,  -0.197345287,  -0.074345201,  0.026852708,
-  -0.040797774,  0.027582556,  0.020820050,  -0.132020250,  -0.024108795,  0.082454048,  0.034303304,  -0.167234957,
-  0.108626448,  -0.003595286,  -0.093168624,  0.023271861,  0.024264470,  0.034276471,  0.150098726,  0.919377208,
-  -0.180618212,  0.025028853,  -0.108279146,  0.030797353,  0.042351916,  -0.110554218,  -0.041269589,  -0.051241849,
-  -0.042273924,  0.060552746,  0.374312371,  -0.105622165,  0.101969451,  0.038388997,  -0.239650890,  -0.069237128,
-  -0.160546094,  -0.173799336,  -0.156620756,  0.045184400,  0.043801986,  0.048862673,  0.001324265,  0.032681454,
-  0.041995980,  0.041257288,  -0.230006978,  0.076556355,  -0.251253963,  -0.153293580,  -0.205987334,  0.003512867,
-  -0.214941785,  -0.164113283,  0.098568678,  -0.006022653,  -0.233888328,  0.117305912,  0.081615075,  0.519033790,
-  -0.028956130,  -0.086392768,  0.050741762,  -0.095473684,  -0.091998480,  -0.027843181,  -0.029555978,  -0.054342508,
-  0.108203880,  -0.075238690,  -0.115080833,  0.039477676,  0.040389944,  0.061477993,  -0.092464924,  0.061441515,
-  0.057474591,  -0.136057302,  0.045319021,  0.032066584,  -0.052395884,  0.056005713,  0.139078259,  0.091758572,
-  0.169455841,  -0.046872146,  0.039821997,  -0.015885115,  0.289840758,  -0.120785460,  -0.038259059,  0.066446558,
-  -0.023962924,  -0.044988200,  -0.037053235,  0.005396869,  -0.063273266,  0.002177186,  -0.126817375,  0.155565947,
-  -0.125424087,  0.022733908,  -0.144703791,  -0.041986391,  -0.093229115,  0.140519023,  0.673560798,  0.001238690,
-  0.010281594,  -0.141067147,  0.044937231,  0.043729100,  -0.072945513,  0.178143606,  0.083690606,  -0.093906492,
-  -0.086815253,  -0.174520522,  -0.031828456,  -0.151023105,  0.190865621,  0.028356478,  -0.069186643,  -0.202599227,
-  -0.064200133,  0.042323984,  0.126125976,  -0.074365616,  0.102252230,  0.144389376,  0.084910654,  0.049692284,
-  -0.211951599,  -0.106086910,  -0.008947891,  -0.192272648,  0.100779057,  -0.075821288,  -0.061681189,  -0.079051152,
-  0.228895143,  0.121282198,  0.162129283,  0.062724136,  0.084786452,  0.052769363,  0.398173332,  -0.074837543,
-  -0.056017026,  -0.028318981,  0.146752343,  -0.055025950,  -0.113327570,  0.188283443,  -0.092813611,  -0.118969165,
-  -0.022735765,  0.006735576,  -0.091925353,  -0.084388770,  0.042636514,  0.158706322,  -0.028360866,  -0.125288025,
-  -0.123471051,  -0.063415483,  0.147779256,  0.133953393,  0.015203174,  0.132672101,  -0.067104504,  -0.043875434,
-  0.015886420,  -0.100594357,  -0.013373941,  -0.216854945,  0.001353786,  0.091546237,  -0.109502271,  0.093212374,
-  0.097299844,  -0.044471927,  0.123842739,  0.096120492,  -0.091884434,  -0.008768454,  -0.045137540,  -0.068347603,
-  0.099704452,  -0.027392402,  -0.107665427,  0.127227798,  -0.098229244,  -0.104517043,  0.075814649,  -0.034045652,
-  -0.053716913,  0.001061818,  -0.043192737,  -0.030704305,  0.018133627,  0.018389255,  -0.084169999,  0.052390873,
-  -0.221934453,  0.007082161,  -0.096687868,  -0.128922269,  -0.024569858,  0.078012779,  0.123299994,  -0.070315190,
-  -0.063382305,  0.109642759,  0.051811036,  -0.136757538,  -0.083167233,  -0.084199443,  -0.114692837,  0.174948439,
-  -0.135272995,  0.088845789,  -0.075388044,  0.109743275,  0.137762249,  -0.076730311,  0.152839869,  -0.076788448,
-  -0.089515984,  0.036782991,  -0.093093336,  0.035454422,  -0.076174840,  -0.231289938,  -0.044773407,  0.047394067,
-  0.165504232,  -0.003684625,  -0.056936324,  -0.263357013,  -0.157928362,  -0.107108258,  0.052699622,  0.039925892,
-  -0.072948247,  -0.005459489,  -0.196155176,  -0.136325032,  0.033176929,  -0.191131577,  0.124806911,  0.066314220,
-  -0.089942783,  0.040976774,  -0.139751315,  0.166237190,  0.094794810,  -0.191017002,  -0.006843657,  -0.014361694,
-  0.057333183,  -0.108673647,  0.470680952,  -0.016069673,  0.037207786,  -0.004571686,  0.073681600,  0.048850186,
-  0.096908376,  -0.127958730,  0.113867886,  -0.122888170,  -0.049176212,  -0.102309465,  -0.122655109,  0.033417270,
-  0.050527044,  0.060574286,  -0.194624037,  -0.218357325,  -0.204863936,  -0.188013360,  -0.141825348,  -0.059025329,
-  0.044008680,  0.045568474,  0.067106448,  0.005579873,  0.073752277,  -0.076546490,  0.050532281,  0.419510514,
-  -0.059286270,  0.112886690,  -0.109034181,  0.138795406,  -0.057941698,  -0.140280887,  -0.133963779,  -0.054443888,
-  -0.074868910,  0.180952385,  -0.080970772,  -0.137147382,  0.130501166,  -0.096428871,  -0.117571831,  -0.120200239,
-  -0.028562270,  -0.031736564,  0.032022838,  -0.132462427,  -0.124975890,  -0.121022217,  0.041078791,  -0.023645092,
-  -0.115462601,  -0.048948593,  0.035891656,  0.104444921,  -0.203904435,  -0.131517529,  0.120013885,  -0.031815428,
-  -0.013709611,  -0.100121781,  -0.044082619,  0.188075468,  0.002463159,  0.161674455,  0.173255995,  -0.104421176,
-  0.126802981,  -0.143235534,  -0.107341558,  -0.089571536,  -0.106416672,  0.129576340,  -0.075518198,  0.178865448,
-  -0.103283577,  0.054746702,  0.163703755,  0.089003108,  0.221083269,  0.019476805,  0.006142703,  0.061599620,
-  -0.123508789,  -0.336103857,  -0.020236716,  -0.048691019,  0.090077348,  0.209916711,  -0.087785840,  0.142460302,
-  -0.080254965,  -0.082766891,  -0.043869130,  0.185366899,  -0.088559315,  -0.095637910,  0.026905766,  0.175817087,
-  0.156354412,  0.036338519,  -0.072298244,  -0.090181708,  0.120410688,  -0.104218230,  -0.075926915,  0.018373994,
-  0.024051279,  -0.140965030,  -0.051930994,  -0.008165173,  -0.107820094,  -0.050395250,  -0.259055704,  -0.054066271,
-  -0.051231861,  -0.019294960,  -0.130400285,  -0.004937171,  -0.024300354,  -0.071881212,  0.044636477,  -0.108105630,
-  -0.031114168,  0.253135949,  0.143489853,  -0.073286086,  -0.113861382,  -0.134445846,  -0.077786617,  0.176559150,
-  0.152007043,  0.011352903,  0.040168289,  0.119362056,  0.101610042,  0.215176925,  -0.029305212,  0.016393306,
-  -0.019623458,  0.168468684,  0.070431098,  -0.235951677,  -0.117353335,  -0.066456676,  0.103396133,  -0.138159439,
-  -0.114831567,  0.149944782,  -0.090370238,  0.107452631,  0.021121113,  -0.098919816,  -0.011519101,  -0.103502907,
-  -0.001601450,  0.107865855,  -0.061304606,  0.139156386,  0.084767312,  -0.078766860,  -0.107586734,  -0.043109465,
-  0.090394482,  0.137127310,  -0.105808347,  -0.103648275,  0.023401052,  -0.074982777,  -0.108946145,  0.057273626,
-  -0.284858555,  -0.121093199,  -0.015305900,  0.031347658,  0.019279795,  -0.014127983,  -0.141172588,  -0.000807830,
-  0.011095222,  0.074428603,  -0.009005543,  -0.088130325,  0.245913997,  -0.036129858,  0.044049233,  0.008944539,
-  0.059363678,  0.106827848,  -0.095466286,  -0.034011051,  0.028926922,  0.044707309,  0.062172476,  0.065276869,
-  0.143007666,  0.075915761,  0.075281143,  0.131038427,  0.121599093,  0.229458973,  -0.060550943,  0.049575627,
-  -0.089473791,  -0.117464527,  -0.052468091,  0.003410752,  0.058248356,  0.123838045,  0.112734646,  0.083014518,
-  -0.004511758,  0.118833058,  -0.004350425,  -0.054137252,  -0.021871779,  -0.096231580,  0.056282114,  -0.039290771,
-  0.055218067,  -0.047301084,  0.040566217,  -0.120217226,  -0.057522185,  0.151994765,  -0.043208390,  0.036441404,
-  -0.112193048,  -0.117638528,  -0.143270493,  -0.138566434,  -0.066829540,  -0.043648843,  0.148082465,  0.000354620,
-  -0.138893619,  0.135984942,  0.149723902,  -0.026157606,  -0.054832168,  0.040595509,  -0.119616129,  -0.138830692,
-  -0.037969451,  -0.058585659,  -0.013475502,  -0.136545211,  0.536695361,  0.005546534,  -0.078750320,  0.044418525,
-  -0.045738257,  0.221562639,  -0.048716746,  0.153480172,  -0.029204601,  0.132958606,  -0.048758432,  -0.088901810,
-  -0.083035126,  0.125331521,  0.089403987,  -0.120524310,  -0.048982609,  0.138058901,  -0.022157593,  -0.097825713,
-  0.105440468,  0.119260900,  -0.096158102,  -0.071879156,  0.042297915,  0.096216023,  0.139133856,  -0.047887992,
-  -0.082109690,  -0.045355238,  0.123557411,  0.139941528,  -0.067809016,  0.175237402,  0.014258312,  -0.064416058,
-  -0.104855679,  -0.056335069,  0.065643936,  0.052664682,  -0.223982066,  -0.107788026,  -0.088441521,  -0.021334164,
-  -0.089919597,  0.103507414,  0.021250520,  -0.009084919,  -0.013040285,  -0.015755087,  0.106440328,  -0.004957375,
-  -0.023891971,  0.062602252,  -0.006989663,  -0.008551180,  0.053166825,  -0.012652312,  -0.128871456,  -0.059778266,
-  -0.010235609,  -0.038596623,  0.006523822,  0.014404067,  -0.114067420,  0.068120971,  0.213128328,  -0.006494954,
-  -0.003150806,  -0.173332036,  -0.004871100,  0.102794290,  0.047874119,  -0.056568816,  -0.124274209,  -0.125494570,
-  0.100254469,  -0.034999087,  -0.140841886,  -0.052765030,  0.022737915,  -0.128121197,  -0.073781624,  -0.134643525,
-  -0.032828361,  0.060259007,  0.152589396,  0.883098543,  -0.083729930,  -0.162709281,  0.007113363,  0.016978381,
-  -0.147475526,  -0.000545111,  -0.050911598,  -0.033183780,  -0.067083180,  -0.085653752,  0.251817316,  -0.107837729,
-  -0.079666533,  -0.100034259,  0.028225694,  -0.104284197,  0.185490727,  -0.003698885,  0.124284349,  0.007554987,
-  0.154915437,  -0.073685870,  -0.130825192,  -0.129993215,  -0.027803451,  -0.108371720,  -0.089084171,  -0.089494899,
-  -0.066552818,  -0.125669315,  -0.102345549,  -0.030711001,  0.151173815,  0.082743064,  -0.028861195,  -0.103115976,
-  -0.138521358,  0.053630944,  -0.105886564,  -0.294786245,  -0.143173024,  0.111978106,  0.087354690,  0.160939142,
-  -0.083681501,  -0.105253294,  0.108198561,  0.089670815,  -0.028556453,  -0.058341771,  -0.129545644,  -0.093486466,
-  0.065335855,  -0.127329350,  0.236368284,  0.131394878,  -0.037555799,  -0.087670028,  -0.097705960,  0.160962194,
-  -0.104587615,  0.204923719,  -0.059576675,  -0.034839120,  0.031308062,  -0.010017550,  0.030603750,  0.026554719,
-  -0.291507423,  0.108286016,  0.118526436,  0.062230844,  0.004225699,  -0.044191606,  0.126762837,  -0.106123008,
-  -0.065915160,  -0.013595726,  -0.195619971,  -0.032111987,  -0.087079637,  -0.109329924,  -0.198039487,  -0.153557420,
-  0.052962337,  0.130381495,  0.632096291,  -0.104250975,  0.066206917,  -0.129872888,  -0.179480627,  -0.188259646,
-  -0.059526775,  -0.098465197,  0.174979642,  0.094944522,  0.139738277,  0.306111485,  -0.131291106,  -0.103336476,
-  -0.044435192,  0.073757015,  0.121792465,  0.024643030,  0.016470131,  0.127894238,  0.171829507,  0.173989236,
-  0.217700660,  0.136341169,  0.207046479,  -0.021237550,  0.219298124,  -0.021415144,  -0.120012917,  -0.091132805,
-  -0.008722492,  -0.054393623,  0.205088541,  0.051442340,  0.248445332,  -0.026724916,  0.054456849,  0.053289086,
-  0.221285090,  -0.117288895,  -0.363848329,  -0.062695213,  0.107031539,  0.109690353,  -0.133531749,  -0.083635949,
-  -0.039658256,  0.015116847,  -0.115560956,  -0.060376801,  -0.062360831,  0.082894802,  -0.048603281,  0.037651602,
-  -0.003861342,  0.059086133,  -0.142707303,  0.023574967,  0.026999651,  -0.140933827,  -0.094137296,  0.065907776,
-  -0.006178923,  -0.139598176,  -0.065303385,  -0.118022934,  -0.046091281,  0.077681176,  0.055264026,  -0.210621580,
-  -0.009159193,  0.042890042,  0.051474601,  0.038911197,  0.036223084,  -0.159840822,  -0.006481586,  -0.025326736,
-  -0.018745372,  -0.160269782,  0.050470341,  0.040583361,  0.051332921,  0.030332096,  -0.144684508,  0.059113156,
-  0.069556125,  0.841031075,  -0.056808878,  -0.037545275,  0.053121101,  -0.027522845,  0.049183212,  0.063183181,
-  0.086892724,  0.008182261,  0.122099504,  -0.044873767,  0.252009183,  0.013998660,  -0.057214856,  0.027213549,
-  -0.020056695,  0.003426482,  0.029223958,  -0.075272650,  -0.123751983,  0.038384739,  -0.061009407,  0.343093038,
-  -0.023495838,  -0.093167782,  -0.005458245,  -0.032250151,  0.011570727,  -0.009880945,  -0.092704922,  0.035226360,
-  -0.011527536,  0.041368652,  -0.014859080,  -0.043617643,  -0.002672699,  -0.117057532,  0.035148766,  0.039327696,
-  -0.026293337,  0.044925455,  -0.117025711,  0.007509661,  -0.133201793,  0.071008936,  -0.067504562,  -0.091281682,
-  0.038152911,  0.105444305,  -0.007771793,  -0.011927701,  -0.025637001,  -0.056900337,  -0.017900316,  -0.004441225,
-  -0.063924521,  -0.016363606,  0.004740373,  0.035323571,  0.022197697,  0.032290157,  -0.015716912,  -0.045958206,
-  0.194440037,  -0.100391433,  -0.062045552,  -0.040526297,  0.004165431,  -0.014024928,  -0.070273824,  -0.031343974,
-  -0.134047374,  0.086570971,  -0.102537170,  0.087321021,  -0.093534201,  0.095116384,  0.089713752,  0.096381962,
-  -0.072952360,  0.087549627,  -0.149852738,  0.090703398,  0.072937787,  -0.157508731,  -0.074888237,  0.085272998,
-  -0.138431013,  -0.028160764,  -0.021969397,  0.068377666,  0.080941014,  0.092677183,  -0.186069995,  0.072119951,
-  0.048363015,  0.015393070,  0.022901773,  0.355192602,  -0.011777445,  -0.049507514,  0.105876736,  0.073576733,
-  -0.084090576,  -0.069661528,  0.105126418,  -0.104719453,  0.093189083,  -0.039285704,  -0.124256976,  -0.043194883,
-  -0.040856916,  -0.116203733,  -0.111961372,  -0.062174305,  0.115340143,  -0.082733303,  -0.064509466,  -0.060620718,
-  0.047049150,  -0.118039295,  0.066301741,  -0.050730497,  -0.029914437,  -0.042675335,  0.267355412,  -0.136095703,
-  -0.283327401,  -0.113950737,  -0.030195853,  -0.136061385,  0.178288609,  0.001453422,  -0.091129906,  -0.084222265,
-  0.104803741,  -0.069510102,  -0.104349166,  -0.068934619,  0.023000000,  -0.059458658,  0.200539276,  0.029697800,
-  -0.116645977,  0.000056323,  -0.031549204,  -0.070881955,  0.172174886,  0.168995380,  -0.136640444,  0.045668248,
-  0.104355447,  0.194209054,  -0.015752658,  0.144259185,  -0.067966625,  -0.269478589,  -0.117858201,  0.152532160,
-  -0.098530017,  -0.130104333,  0.094233036,  -0.121988788,  -0.025571255,  -0.114301324,  0.137092710,  -0.098901600,
-  0.056813702,  -0.115774289,  0.171034321,  -0.109429970,  0.079643741,  0.031539168,  0.004341364,  -0.092858128,
-  0.138538286,  0.171687067,  -0.100207813,  0.177654341,  0.062760130,  -0.084690601,  0.035469864,  0.038424708,
-  0.045318410,  0.005987808,  -0.307580739,  -0.080964752,  0.084037744,  -0.104189515,  0.181259379,  -0.010107644,
-  -0.052624904,  -0.037206516,  0.075336717,  -0.048005275,  -0.077390835,  0.161900923,  -0.018262381,  -0.014250546,
-  0.098676592,  0.034973804,  0.162768766,  0.104923442,  -0.015903458,  0.035647336,  0.131164715,  -0.138408929,
-  -0.051438004,  -0.027600611,  -0.005663803,  0.194078714,  -0.103736930,  -0.102972627,  0.026341736,  -0.226641938,
-  -0.022208534,  -0.163179293,  -0.135652676,  -0.142877653,  0.095161125,  0.114715077,  -0.157780230,  0.030147446,
-  0.041872378,  0.027082555,  0.225579679,  -0.166425794,  0.032332480,  0.031949922,  0.024731718,  -0.141543880,
-  -0.223434567,  -0.207595810,  0.081564575,  -0.135723308,  -0.103145629,  -0.173446849,  0.033301391,  0.194066510,
-  -0.023435999,  0.142254055,  0.029210184,  0.119685307,  0.409622699,  -0.075571187,  -0.144562244,  -0.126339734,
-  0.061188113,  -0.092153579,  -0.059237197,  0.105777130,  -0.066494107,  -0.062792927,  0.036117278,  -0.019926390,
-  -0.111423209,  0.068923153,  -0.134975404,  -0.110014476,  0.074891374,  0.012361758,  -0.112985857,  -0.012210319,
-  -0.007176671,  0.100159556,  -0.142002851,  -0.135348156,  -0.141491026,  0.048879512,  0.031462695,  -0.093407750,
-  0.031278625,  0.265396029,  -0.045618251,  0.030163756,  -0.000311011,  0.007256785,  0.067082688,  0.007322068,
-  0.008780122,  0.024574989,  0.002929055,  0.042609930,  0.206106201,  0.213863730,  0.021849750,  0.074440427,
-  0.047517315,  -0.130685434,  0.104332842,  0.033803757,  -0.026107952,  0.029062806,  0.042556621,  -0.028027780,
-  0.175802678,  -0.104688659,  -0.044150174,  0.037414614,  0.004103875,  0.126703426,  -0.203368679,  -0.058297455,
-  0.062093150,  -0.142031312,  -0.120295614,  0.014655772,  -0.002227762,  -0.048923373,  0.095471859,  0.124650188,
-  -0.001221295,  -0.029723480,  -0.117231503,  0.004465207,  -0.066828884,  -0.053084780,  -0.132437378,  -0.092900962,
-  0.089462310,  0.024228284,  -0.124213628,  -0.002288090,  0.012235536,  -0.065240979,  0.094364330,  -0.013693120,
-  -0.131626859,  -0.057080671,  -0.049606867,  0.030365532,  -0.054205507,  -0.127810583,  0.012138976,  -0.068343453,
-  -0.036887467,  0.001163960,  -0.074529342,  0.011443967,  -0.002972256,  0.128696904,  0.035062429,  -0.096519470,
-  -0.083448209,  -0.064191416,  -0.028173834,  -0.035620537,  -0.059893079,  -0.078798786,  0.006955640,  0.018234929,
-  -0.058253214,  -0.138484612,  0.044973861,  0.130708992,  -0.092389330,  0.085257575,  -0.142401144,  -0.043622352,
-  -0.032023791,  -0.085495651,  -0.070261620,  -0.070825547,  0.089072928,  0.141424581,  -0.011849205,  -0.127871290,
-  0.100782648,  0.127073109,  -0.090506718,  0.020294035,  0.152700499,  0.153157368,  -0.117147550,  -0.099796668,
-  0.121533252,  0.162227854,  -0.052957684,  -0.091144204,  0.157350376,  -0.038025830,  -0.030569511,  -0.131237030,
-  -0.089602515,  -0.107169181,  -0.062559955,  -0.078540266,  -0.121298820,  -0.250706971,  0.176247120,  -0.165342361,
-  0.051920190,  -0.131874487,  -0.118569925,  0.054834615,  -0.046270758,  0.154253840,  -0.087983832,  0.053521898,
-  -0.042373307,  -0.029807566,  -0.083805792,  0.099162795,  0.048649430,  -0.073039360,  -0.237385839,  0.355939686,
-  -0.186358064,  -0.145216331,  -0.048342083,  0.058158651,  0.041939843,  0.093282752,  -0.028492017,  -0.138629898,
-  0.056676790,  -0.073480055,  0.444331646,  -0.104496427,  -0.146091312,  -0.117838785,  0.083344907,  -0.171808735,
-  0.051673785,  0.035636798,  -0.112608448,  0.026444936,  -0.182128757,  -0.123298526,  0.202571899,  -0.150613204,
-  0.061233923,  0.036571842,  -0.113994509,  -0.208165884,  0.322328717,  -0.007808647,  0.047639858,  -0.192939311,
-  0.049008526,  -0.171158940,  0.075596236,  -0.015508896,  0.079602607,  0.068206586,  -0.071769752,  0.403246254,
-  -0.064561650,  -0.015325073,  0.012804728,  -0.058288403,  -0.038993672,  0.016398022,  0.003660456,  -0.143231317,
-  0.080681823,  0.106352612,  0.191507563,  0.155910820,  -0.123326376,  0.086053237,  0.058539610,  -0.099557735,
-  0.181476802,  -0.044404745,  -0.048658937,  0.112410322,  -0.036311854,  -0.119089171,  -0.036704946,  -0.054072522,
-  -0.024252743,  -0.046178736,  -0.083070554,  -0.065686643,  -0.208774313,  -0.011975855,  0.128226697,  -0.066995874,
-  0.035528116,  0.036095969,  0.087450378,  -0.131090075,  0.151763976,  -0.141523540,  0.033332493,  -0.094428331,
-  -0.220370859,  -0.085481837,  -0.240687251,  -0.074839257,  -0.146574989,  0.194149360,  -0.180457354,  -0.162842527,
-  0.126938239,  0.011632187,  0.075476661,  -0.160996944,  0.075907208,  -0.118422002,  0.037137259,  -0.001140682,
-  -0.073659658,  0.368925393,  -0.114767313,  -0.019152770,  -0.103087440,  0.010118243,  -0.050029323,  0.042617973,
-  -0.104524553,  0.026664184,  -0.140338749,  -0.068124369,  -0.054600500,  -0.019479115,  -0.021032386,  -0.122197598,
-  0.039884277,  -0.022864748,  -0.053860061,  0.609831274,  -0.019795546,  0.039100286,  -0.121179476,  0.073921740,
-  -0.020426555,  -0.041125745,  0.241593972,  -0.068003811,  -0.037236929,  0.106293544,  -0.239512697,  -0.008984660,
-  0.236603066,  -0.066386119,  -0.049237099,  -0.092338711,  -0.049599394,  -0.136874124,  -0.092919543,  0.057099387,
-  -0.087149605,  -0.115611076,  0.083855793,  -0.104137242,  -0.049833670,  0.014010713,  0.067945853,  0.068803646,
-  -0.136431873,  0.025862820,  -0.128575861,  -0.135469109,  0.196596190,  -0.003221060,  -0.057561204,  -0.059792720,
-  0.032060787,  -0.069796138,  0.118281677,  -0.212619841,  -0.089974903,  -0.009102420,  0.200996026,  -0.053520892,
-  0.150546089,  0.095643401,  0.121811755,  -0.136560321,  0.136821806,  -0.107045062,  0.157483622,  0.158629000,
-  0.154204682,  0.074424542,  0.115989111,  -0.016947215,  -0.090707116,  -0.045046199,  0.086920023,  -0.076233581,
-  -0.057531595,  0.005571243,  -0.072413951,  0.183548525,  -0.034605235,  -0.132463917,  0.014484541,  -0.121580794,
-  -0.224741220,  -0.144175053,  -0.176253483,  0.050759364,  -0.034757923,  -0.007243006,  -0.062834986,  -0.083962217,
-  0.024791904,  0.046253607,  0.050265912,  -0.138635620,  0.076032259,  -0.028436204,  -0.173571691,  0.045428634,
-  -0.169775799,  -0.148297310,  -0.145374596,  -0.110607371,  -0.141258538,  -0.047048755,  -0.106076270,  -0.056200113,
-  0.071838625,  0.017518384,  0.084392689,  0.163091123,  -0.004006609,  0.294568717,  -0.078733094,  -0.063722916,
-  -0.141969934,  0.016826546,  -0.087907784,  0.015819993,  -0.031902246,  -0.101626113,  0.137619734,  0.029030439,
-  0.259888828,  -0.037183948,  0.049968053,  -0.056229256,  -0.049744479,  -0.036073774,  -0.045431919,  -0.070719533,
-  -0.087999806,  0.110524401,  -0.052193683,  -0.035750300,  0.176242203,  0.046521422,  -0.141760260,  -0.048367493,
-  -0.028245214,  0.062351108,  -0.253151774,  -0.132202461,  -0.130915925,  0.011014450,  -0.125837445,  0.045468539,
-  0.014578218,  -0.009454254,  -0.080735222,  0.215378687,  0.003387721,  -0.082159124,  0.183339804,  0.095558673,
-  -0.080814756,  -0.017650880,  -0.122552872,  -0.017561786,  -0.067127146,  0.210136354,  -0.137507290,  0.019022830,
-  0.127659574,  0.188465133,  0.019064920,  0.160693288,  0.051206112,  -0.112945452,  -0.129204586,  -0.374533713,
-  0.011934298,  0.085847393,  -0.125633135,  0.201338306,  0.005338656,  0.180225059,  -0.114462338,  -0.070590571,
-  0.150948972,  -0.071822502,  -0.070635751,  0.058312822,  -0.067823723,  -0.011264999,  -0.013415501,  -0.071302369,
-  -0.074214749,  -0.060122289,  0.030151328,  -0.127014726,  0.185795158,  -0.080442600,  -0.025065705,  -0.124240786,
-  -0.037536945,  -0.074676558,  -0.071458057,  0.078244597,  -0.292449445,  0.049147505,  -0.193645656,  -0.186734214,
-  -0.233250499,  0.006342452,  0.004736777,  0.041002747,  0.063481443,  -0.074972823,  0.014146354,  -0.138472855,
-  0.078692056,  -0.107008874,  0.010885836,  0.060507435,  0.012980086,  0.008788206,  0.636690080,  -0.273989618,
-  0.009824447,  0.085164718,  0.010680152,  -0.186177969,  0.047614418,  -0.030520797,  0.043317605,  -0.075256042,
-  -0.100071415,  0.487950951,  -0.066256195,  -0.044734284,  0.092464209,  0.139661700,  0.006522495,  0.073369473,
-  0.015548795,  -0.144267142,  0.018671118,  -0.061461166,  0.298834652,  0.096440628,  -0.030170785,  -0.103692368,
-  -0.105577990,  -0.032461438,  -0.041715391,  -0.084850006,  0.073091589,  0.249200642,  -0.026713256,  -0.024878647,
-  0.244719252,  -0.117635310,  0.229620457,  0.081665970,  0.242559120,  0.011259735,  -0.337610483,  -0.060282961,
-  -0.054036558,  -0.085608497,  -0.122273698,  0.170027316,  0.084095955,  -0.076895423,  -0.065182373,  0.156557813,
-  -0.112923801,  0.158675224,  0.176625893,  0.037978664,  -0.054608040,  0.040545706,  -0.083232000,  -0.088306054,
-  -0.037901148,  -0.127409548,  0.012311446,  0.108505733,  -0.128197849,  0.060185350,  0.147998869,  -0.015819728,
-  0.166571140,  0.157107681,  -0.130503193,  -0.242515743,  -0.001064881,  -0.028763793,  -0.001242343,  -0.131267369,
-  -0.099792585,  0.029865326,  -0.038643353,  0.120163597,  -0.055530436,  -0.070278607,  0.161258027,  -0.005628916,
-  0.161230311,  0.184376061,  -0.081624933,  -0.011775734,  -0.068223551,  -0.025941454,  -0.097417995,  -0.029501632,
-  -0.055585995,  0.015772587,  0.026637636,  -0.035682581,  -0.141348392,  -0.009546765,  -0.087303057,  -0.142719507,
-  -0.157161742,  -0.070621766,  -0.035593431,  -0.040172145,  -0.025769226,  -0.033769712,  -0.036288165,  0.236004487,
-  -0.144973025,  -0.032830901,  -0.058257677,  0.001060772,  0.042120703,  0.143559635,  -0.082231939,  -0.034085367,
-  0.044852417,  -0.085168749,  0.677058041,  -0.060861312,  -0.122060157,  -0.000317591,  -0.076626770,  -0.087999284,
-  0.157206729,  -0.028159268,  0.190442413,  -0.039208233,  -0.029393740,  -0.146232694,  0.068745680,  -0.120378464,
-  0.184478611,  -0.103778332,  -0.000791925,  0.059905231,  0.192524016,  -0.138599545,  -0.070197135,  -0.079348266,
-  -0.088776767,  0.160501242,  -0.125257581,  0.032063521,  0.237341195,  0.076094672,  0.040807553,  -0.063999206,
-  0.205360919,  -0.087315373,  -0.068683282,  -0.089560971,  0.166041881,  0.002618328,  -0.126194060,  -0.040854659,
-  0.075774036,  -0.095758200,  -0.355529010,  0.073844247,  -0.090092391,  -0.058759026,  0.148399025,  0.085727058,
-  -0.034369454,  0.123421684,  0.102145396,  -0.026808824,  -0.014753632,  0.104756467,  -0.054209642,  0.106647335,
-  -0.078536227,  -0.039591767,  -0.107772805,  0.053376470,  0.062598825,  -0.032769110,  0.027930588,  0.019003820,
-  -0.052878942,  0.155732855,  -0.086374402,  -0.117155433,  0.203493014,  0.121567681,  0.082153484,  0.212488055,
-  -0.049332194,  -0.088054880,  -0.078991368,  -0.128747299,  0.010404153,  0.024443090,  -0.027928330,  0.017766917,
-  0.019486768,  0.086980499,  0.298568845,  0.086419411,  0.018513180,  -0.087891147,  -0.112572148,  -0.076165557,
-  0.013923551,  -0.090814739,  -0.102449544,  0.003560685,  -0.046785701,  -0.057908084,  0.004462725,  0.103508301,
-  0.114540651,  0.174960926,  -0.046496853,  -0.084771201,  0.191468716,  -0.027311251,  -0.062790602,  0.020173412,
-  -0.080754615,  -0.087141708,  -0.072912782,  0.253051370,  0.184159949,  -0.141733870,  0.062859476,  -0.057073656,
-  0.011469105,  0.031205628,  -0.130347475,  0.109016724,  -0.119892798,  -0.137855679,  0.827892184,  -0.068041734,
-  -0.080837369,  -0.141260430,  -0.119441323,  -0.120466121,  0.213684440,  0.287093937,  -0.002738450,  -0.087286763,
-  -0.084021874,  0.242776453,  -0.091061011,  -0.138368174,  -0.080620721,  0.015249043,  -0.090935990,  0.078000553,
-  0.096198715,  -0.046065234,  -0.033663943,  -0.124618061,  0.024296913,  0.277777225,  0.078064710,  -0.034516707,
-  -0.084841251,  0.095488198,  -0.014387265,  0.145110175,  -0.072965130,  -0.038729496,  -0.123094425,  -0.016297117,
-  0.042198122,  0.240062937,  -0.136036277,  0.277467459,  -0.081565812,  0.061200470,  -0.279617786,  -0.042730771,
-  -0.070409983,  -0.116987623,  0.025088415,  0.024381047,  -0.054496080,  0.059323568,  0.095134906,  0.049461614,
-  -0.044163108,  -0.094974279,  0.000073825,  0.020861367,  -0.031769533,  -0.000943474,  -0.136020213,  0.045469288,
-  -0.082015961,  -0.072964221,  -0.026250476,  0.002179922,  -0.000634124,  0.085524939,  -0.098760948,  -0.059658203,
-  0.023601981,  -0.118854865,  -0.107342497,  0.079130404,  0.024230029,  -0.036304839,  -0.099239647,  -0.124304712,
-  0.121001624,  0.044638958,  -0.000256624,  -0.040408012,  -0.068236209,  -0.026296414,  -0.073120698,  0.002171438,
-  0.104262538,  -0.017470436,  0.016276773,  -0.096263200,  -0.036506623,  -0.067082070,  -0.073900953,  0.190845162,
-  -0.095696591,  -0.036822736,  -0.016907752,  -0.085774511,  -0.054836974,  0.134651706,  -0.023546450,  0.058915094,
-  -0.093438618,  -0.132298276,  0.103074133,  0.173184246,  -0.032173086,  -0.137465388,  -0.037138376,  0.149480745,
-  0.166610152,  -0.063391842,  0.113099247,  -0.073956400,  0.135830730,  -0.100013196,  0.017086774,  0.025923463,
-  0.130642131,  0.029491544,  0.203723684,  0.001742850,  0.114197075,  0.056153741,  0.037970521,  0.060334004,
-  0.138086274,  0.080745898,  0.141698763,  -0.071004823,  -0.086600535,  -0.326955795,  -0.116463460,  0.049312059,
-  0.006408825,  -0.134348392,  0.098772295,  -0.054914895,  -0.027329532,  0.093142420,  -0.103304088,  -0.126846924,
-  -0.056967061,  -0.174188763,  0.065460049,  0.006511768,  0.057991136,  -0.104078330,  -0.144750923,  0.095716372,
-  -0.129034981,  0.064627148,  0.071896985,  0.081772931,  -0.065399736,  0.064709157,  0.030929804,  -0.069883972,
-  0.089476325,  -0.080666900,  0.348230273,  0.057713609,  0.051974449,  -0.018082209,  -0.055530176,  0.017126087,
-  -0.131492466,  -0.043042988,  0.093910113,  -0.041201018,  0.164294586,  -0.105213374,  -0.061889503,  -0.081849791,
-  -0.112815551,  -0.078362830,  -0.085401528,  -0.008621405,  -0.094957367,  0.100712731,  0.154148161,  0.150976807,
-  -0.088500403,  -0.065653674,  0.203511357,  0.028278302,  -0.081535168,  -0.082351513,  -0.031611763,  -0.238613889,
-  -0.089370102,  -0.108406827,  -0.116175227,  0.020123675,  0.216349557,  -0.133544788,  -0.104818977,  -0.081441864,
-  -0.119174957,  0.206191108,  0.382394254,  -0.071082905,  0.028742304,  -0.061022833,  0.078222290,  0.000215227,
-  -0.070446938,  -0.048113577,  0.011468788,  -0.114420861,  0.032499574,  0.207587436,  0.212034985,  -0.056439064,
-  -0.054948851,  0.025679294,  -0.103553519,  -0.124831885,  -0.389135897,  -0.062021196,  -0.012337478,  -0.072825685,
-  -0.035146061,  -0.020338701,  -0.141605213,  -0.110914364,  -0.034321930,  0.065179087,  -0.044602964,  -0.120498642,
-  0.172904804,  -0.003741622,  0.189917997,  -0.052862421,  -0.113612026,  0.166940108,  -0.062438741,  0.038235813,
-  -0.070359245,  -0.049057487,  0.128458411,  0.174489081,  0.222074971,  -0.037075795,  -0.084927946,  -0.114244431,
-  -0.047580875,  -0.149536967,  -0.012599083,  0.098502390,  -0.036116242,  -0.074454620,  0.085455149,  0.034352016,
-  -0.113383301,  0.105326384,  -0.039322115,  0.085576490,  0.152572334,  -0.017661573,  -0.124321558,  -0.024983145,
-  -0.012510179,  0.056967445,  0.121067829,  0.138422444,  0.009566173,  -0.115012474,  -0.047095701,  -0.093060434,
-  0.124514848,  0.017804746,  0.053792547,  0.001534620,  -0.032369323,  -0.017919943,  -0.171354041,  -0.064417414,
-  0.075107396,  -0.116477087,  -0.059192456,  -0.106224746,  -0.115193188,  -0.042955287,  -0.134423256,  -0.053304695,
-  -0.001648814,  0.080452748,  -0.094130412,  -0.091021329,  -0.125828996,  -0.034069534,  -0.050934475,  0.104271650,
-  -0.135812312,  0.037137840,  0.087262042,  0.055091556,  0.104891673,  0.116525479,  -0.109122366,  0.028299682,
-  -0.109702185,  -0.087663382,  0.103804216,  -0.069231257,  -0.067213975,  -0.118975535,  0.229206264,  -0.101875976,
-  -0.045815811,  0.021634458,  0.065425918,  0.022552313,  0.177243337,  -0.091680467,  -0.038841054,  0.068666846,
-  0.078262091,  -0.040539283,  0.077597640,  -0.079045407,  -0.121821776,  -0.064066499,  0.076790728,  -0.131129086,
-  -0.045590825,  -0.057476833,  0.105980299,  -0.006888914,  0.005100811,  0.019195208,  0.290789396,  -0.130785137,
-  -0.234921545,  -0.027119115,  -0.060000353,  0.067330681,  -0.145182103,  -0.029247070,  -0.132889718,  0.075360410,
-  0.087738708,  -0.056279965,  0.085643098,  0.083160676,  0.137827933,  -0.142784655,  -0.016250536,  -0.143200457,
-  0.080684140,  0.057879671,  1.159841657,  0.015281816,  0.003818610,  -0.077611312,  -0.169452131,  0.072305955,
-  0.108812906,  0.117706195,  -0.001523331,  -0.091802068,  0.003673121,  0.345552295,  -0.008252623,  0.108247228,
-  0.028974509,  0.112752333,  -0.070918754,  -0.047330070,  -0.026694061,  -0.019789487,  -0.036480796,  -0.109869465,
-  -0.024860458,  -0.060945444,  0.108992398,  0.031811815,  -0.021235501,  -0.029058693,  -0.038282976,  -0.100853384,
-  0.111070745,  0.023397516,  -0.064151548,  -0.147125527,  -0.144232005,  0.022042682,  -0.114738010,  0.037485793,
-  -0.108966447,  0.125082299,  0.257795483,  0.043964464,  -0.094444409,  0.061151292,  -0.102398664,  0.132268190,
-  -0.013027071,  0.118474573,  -0.137721494,  -0.133648813,  -0.128811479,  0.095934168,  0.062701449,  -0.101222657,
-  -0.079925902,  0.027650695,  -0.073360451,  0.270511597,  -0.068461463,  -0.139140233,  -0.024945818,  -0.126517519,
-  -0.116893560,  -0.084001198,  -0.097458407,  -0.040048338,  0.091475017,  -0.122180715,  -0.084966615,  0.199171290,
-  -0.133183405,  0.043198552,  -0.061477214,  -0.069898114,  -0.040849727,  0.144170210,  -0.061547745,  -0.044862062,
-  -0.105041549,  -0.036964368,  0.130111307,  0.152618915,  0.202671409,  0.224272758,  0.156307593,  0.121770658,
-  -0.011897854,  -0.109304085,  0.148715869,  -0.105310068,  0.146300867,  0.008532860,  -0.127714857,  0.261680335,
-  0.020796591,  0.020512538,  -0.102745287,  0.134778693,  -0.302387685,  -0.130506709,  0.007639967,  -0.140216023,
-  0.181277841,  -0.126917168,  -0.113332063,  -0.114187069,  0.112699948,  -0.063316420,  0.146606624,  -0.025912983,
-  -0.120277800,  -0.046618704,  0.147360086,  0.083705969,  0.177681670,  0.102803230,  -0.090690129,  0.151155189,
-  0.171910882,  -0.101725899,  0.141723335,  -0.003075138,  -0.125964880,  -0.066750318,  -0.001810721,  0.019909147,
-  -0.018610835,  -0.316946894,  -0.100074217,  -0.010997378,  -0.091207817,  -0.049020581,  -0.103387401,  -0.080597296,
-  -0.107967913,  0.073316693,  0.153105035,  -0.128848910,  -0.111122072,  0.212255552,  0.114453264,  0.158915445,
-  0.111762501,  0.133973986,  0.023794996,  -0.102214679,  -0.061011866,  -0.088506564,  -0.050279260,  0.022598837,
-  0.130499348,  0.109385364,  -0.122081771,  0.084800914,  -0.044001386,  0.048183531,  -0.232909009,  -0.114621826,
-  -0.095686331,  0.094644405,  0.005898710,  0.146208465,  0.137977540,  -0.101822473,  -0.036907546,  0.112711400,
-  -0.061990697,  0.265360862,  0.140660837,  0.151209056,  0.101820625,  0.150944099,  0.130028367,  0.085472643,
-  -0.074922904,  -0.138642922,  -0.105101191,  0.141480729,  -0.095597848,  -0.142991930,  0.113037378,  0.029619722,
-  -0.039419536,  -0.053353954,  -0.007090434,  -0.281513929,  0.017384078,  -0.114374369,  0.041162100,  0.227990910,
-  -0.073880918,  -0.093043037,  0.111863136,  -0.024783975,  -0.120204493,  -0.059645042,  -0.004130957,  0.137809962,
-  0.011683113,  0.114022680,  -0.013660831,  -0.108903319,  -0.123356268,  -0.034277394,  0.026505215,  0.205590025,
-  0.056361943,  -0.017102402,  -0.041253462,  -0.036440209,  0.122941203,  0.036506146,  -0.028886840,  -0.128965721,
-  -0.187585130,  0.062356416,  -0.084318645,  -0.054113023,  -0.015799532,  0.030420104,  -0.129928991,  -0.059507228,
-  -0.023724051,  0.090357743,  -0.030668098,  -0.078072533,  -0.115882710,  -0.121059269,  0.158490911,  -0.119191989,
-  0.079413556,  0.055666886,  -0.130037650,  0.094398670,  0.075780489,  -0.056754239,  0.082572632,  0.086335473,
-  0.105207264,  0.010578567,  -0.047964856,  -0.092086799,  0.077095091,  0.321758538,  -0.024039295,  -0.040429063,
-  0.014330347,  -0.036170721,  0.012612917,  -0.068871938,  0.023368433,  -0.068081059,  0.016858695,  -0.003458346,
-  -0.009508465,  0.298900336,  -0.114712618,  -0.022805763,  0.161765143,  0.015249008,  -0.028396606,  0.422349930,
-  -0.006428068,  -0.092805207,  0.039123803,  0.075372748,  0.016105462,  0.090130031,  -0.092226736,  -0.016279453,
-  -0.042289883,  0.093630776,  -0.221102685,  0.006627485,  -0.054456498,  0.276608258,  0.011826535,  0.196166769,
-  -0.045870911,  -0.080750406,  0.100159302,  -0.071129173,  -0.068753421,  0.273985595,  -0.141235352,  -0.061298646,
-  -0.054083519,  -0.006117665,  -0.051036514,  0.216656461,  -0.066769697,  0.046857461,  0.164659709,  0.176441029,
-  0.150525391,  0.082732350,  0.130282775,  -0.128737092,  0.109675348,  0.068157889,  0.101011321,  -0.246982023,
-  -0.026860438,  0.165217876,  -0.088667631,  0.104589067,  -0.133462176,  0.108568691,  -0.105371639,  -0.079029396,
-  -0.089251071,  0.108504683,  -0.143314898,  -0.107925668,  -0.092993639,  0.104512841,  0.006232341,  -0.081131406,
-  0.087312974,  -0.097391978,  0.016394766,  -0.102855667,  0.056498669,  -0.035277419,  -0.018653017,  -0.129439831,
-  -0.140404418,  -0.112822816,  -0.091106988,  0.104578689,  -0.247602493,  -0.152081087,  -0.138111696,  0.164769962,
-  0.147104874,  0.139549106,  0.135835081,  0.081952922,  -0.065110669,  -0.132960543,  -0.120679460,  0.232348710,
-  -0.124872118,  -0.131464392,  -0.084576271,  0.052433848,  0.107298896,  -0.121682324,  -0.144380271,  -0.001512235,
-  0.143112227,  0.149545878,  0.153214335,  0.059061006,  -0.120676808,  0.001344582,  0.072973564,  0.015868369,
-  -0.107686281,  -0.313639790,  -0.105116069,  -0.095932670,  -0.101812467,  -0.065908030,  -0.006006797,  0.178175434,
-  -0.006795931,  0.128812268,  0.102571189,  0.209209800,  0.008950171,  -0.070748955,  -0.138471916,  -0.069768935,
-  -0.064850658,  0.152557865,  0.124487460,  -0.137206495,  -0.127880633,  -0.078558639,  -0.064599164,  0.198504329,
-  -0.069367424,  -0.005903224,  0.035528190,  -0.139315754,  -0.070888005,  -0.104082204,  -0.306965977,  -0.116330348,
-  -0.040302038,  0.250568867,  0.067583948,  0.043305278,  0.045260821,  0.072264820,  -0.076898709,  0.068986714,
-  -0.126376852,  -0.050112344,  0.127306476,  0.051110294,  0.178502589,  -0.018190583,  -0.017864861,  0.077407844,
-  -0.061222263,  -0.038021252,  -0.014178650,  0.083833814,  0.039083555,  0.165640458,  0.207791850,  0.088620976,
-  0.194479689,  0.265336305,  -0.123111241,  -0.408550233,  -0.038649961,  0.019614566,  -0.075231001,  -0.077510491,
-  -0.013842323,  0.070358321,  0.065463319,  -0.070262529,  0.001231003,  0.080889121,  -0.065149315,  -0.146264970,
-  -0.050129890,  0.065894693,  0.057470612,  -0.083329186,  0.068212450,  -0.075324781,  0.036695745,  0.069302075,
-  -0.100778036,  0.093104504,  -0.119875766,  0.039803855,  0.036468666,  -0.066750392,  -0.059673164,  -0.016306296,
-  0.351067960,  -0.126871750,  -0.039497755,  0.076397926,  -0.040285256,  -0.086555459,  -0.124288730,  0.027517753,
-  0.059467152,  -0.069202818,  0.107116535,  -0.037024938,  0.170012429,  -0.128057405,  0.097114474,  -0.056189094,
-  0.073748112,  -0.123547152,  -0.066501111,  -0.116202593,  -0.104059726,  -0.086807542,  0.119533867,  -0.135319665,
-  0.259892732,  -0.031531129,  -0.007370024,  -0.038526729,  -0.029240139,  -0.018539023,  -0.096306197,  0.034967080,
-  -0.086518198,  -0.074958399,  -0.010870422,  -0.025874799,  0.075075246,  -0.017408242,  -0.029004976,  0.035528313,
-  -0.127901807,  -0.033597082,  -0.055251129,  0.074608572,  0.075858504,  -0.115306556,  -0.036471061,  0.143548399,
-  -0.060691841,  -0.125047684,  -0.030818388,  0.104674779,  -0.103213906,  -0.109203935,  0.050318822,  -0.032567650,
-  -0.092419662,  -0.019043356,  -0.163780376,  0.140179038,  -0.082585000,  0.088568129,  -0.081166744,  0.059326630,
-  -0.053777695,  -0.080238603,  0.026646081,  -0.056820508,  -0.067911312,  0.010791970,  -0.103403553,  -0.064021453,
-  -0.038216010,  -0.092771307,  -0.035070688,  -0.045556501,  -0.072975367,  -0.092339858,  -0.094997182,  0.040324211,
-  0.013762526,  -0.003227878,  0.041830875,  -0.016744664,  -0.030359158,  -0.048001252,  0.083161399,  -0.065350287,
-  0.036354490,  0.113941096,  0.022267247,  0.159281269,  0.029748837,  0.084204078,  -0.067562848,  -0.081454560,
-  -0.088509396,  0.084135085,  0.040871680,  -0.062647335,  0.063551895,  0.144051984,  0.028907463,  0.088937454,
-  0.085830040,  -0.044010691,  -0.050746121,  0.047859091,  -0.067076229,  -0.130202889,  -0.091643490,  -0.097596876,
-  0.064705558,  -0.117302731,  0.019898560,  0.020658493,  -0.255378336,  -0.082081199,  -0.124933481,  -0.090098858,
-  0.053718012,  0.106855452,  -0.072202243,  -0.119476236,  0.159705207,  -0.001434526,  0.020527633,  -0.054022230,
-  -0.049092308,  -0.113371089,  0.050266519,  -0.135281816,  0.053034939,  -0.087236539,  -0.047883656,  0.206511527,
-  -0.007000258,  0.063246474,  0.170476407,  0.079160787,  0.018143281,  -0.087813765,  -0.107333645,  -0.135951072,
-  0.024422213,  -0.323356718,  -0.015861601,  -0.083350606,  -0.064946815,  -0.032964069,  0.038307365,  0.016919324,
-  -0.061420221,  -0.038286585,  0.000966882,  -0.107640520,  0.192574650,  0.183852702,  0.047779474,  -0.036509003,
-  0.010299139,  -0.063171394,  0.137869239,  -0.063653022,  -0.111330494,  0.000204126,  -0.046559397,  -0.121204317,
-  -0.142526746,  -0.114504091,  -0.014886631,  -0.123810790,  0.216192991,  0.022579879,  0.078858539,  -0.134475380,
-  0.017555717,  0.031234525,  0.050785340,  -0.046648014,  -0.134745732,  -0.123630494,  0.081676915,  0.024059217,
-  -0.122835681,  0.052696358,  0.194062218,  0.055575576,  0.086800262,  -0.145811826,  -0.188353300,  0.070142537,
-  0.398503810,  -0.114721008,  -0.020622166,  0.017566044,  -0.038662814,  0.051446274,  -0.208501145,  0.221240774,
-  -0.002377712,  -0.138109550,  0.133282945,  0.292641699,  -0.080330305,  -0.050216608,  -0.096150927,  0.082620725,
-  -0.061709095,  0.073295124,  0.069343649,  0.116096757,  0.098495230,  0.090306394,  -0.042059887,  0.050567728,
-  -0.039532274,  -0.032126229,  0.085931107,  0.088201165,  0.046809595,  -0.112271145,  0.044921584,  -0.182660952,
-  0.087843075,  -0.188867822,  0.088712320,  0.120759107,  0.048527475,  0.085570283,  0.098212086,  -0.120152161,
-  0.394234747,  0.018050473,  0.044837821,  -0.173708633,  0.007227688,  -0.121462390,  -0.140445441,  -0.180984393,
-  0.005362306,  0.054497935,  0.063300297,  0.024009611,  0.098630831,  0.020717461,  0.192796007,  -0.307285666,
-  -0.168739855,  0.025084706,  -0.259477794,  -0.034054752,  0.019040274,  -0.027485203,  -0.184365019,  0.242736846,
-  0.151398003,  -0.021072673,  0.033762909,  0.036548998,  -0.034706108,  0.489148915,  -0.050694119,  -0.031946886,
-  0.332407653,  -0.113466531,  0.015083198,  -0.071574233,  0.001962682,  -0.051169939,  -0.144656777,  -0.070360348,
-  -0.078985319,  0.144803509,  -0.035565186,  0.168227807,  -0.061385266,  -0.028074350,  -0.033253711,  -0.017827334,
-  0.022333058,  -0.076630235,  0.114770815,  -0.030393315,  -0.142590612,  0.284227312,  -0.077752858,  -0.047401652,
-  0.306106806,  0.125979826,  -0.174377918,  -0.085084237,  0.114052251,  0.086202502,  0.137389764,  -0.095521308,
-  -0.025139740,  0.207207590,  0.080923222,  -0.026755981,  -0.118918695,  0.068957292,  -0.088046782,  -0.118657790,
-  -0.111597002,  0.164351970,  0.173506916,  -0.099052563,  -0.093717888,  -0.047489189,  -0.052035805,  0.015709225,
-  0.022073127,  -0.143168151,  -0.027220432,  0.082734190,  0.131749526,  -0.094755411,  -0.002486646,  -0.211683705,
-  -0.014659171,  0.141947910,  -0.040724359,  -0.013190099,  -0.058425836,  -0.121364586,  -0.133385479,  -0.010668856,
-  0.106065087,  -0.055290326,  0.137232140,  -0.093645900,  -0.104778290,  -0.033998013,  0.098519363,  -0.076584294,
-  -0.053124987,  -0.021888874,  -0.077193514,  -0.024919391,  -0.010638281,  -0.106076926,  -0.007636781,  -0.128445745,
-  0.092153050,  -0.040084101,  -0.019144701,  0.044643655,  -0.216175303,  0.031031866,  -0.097712807,  0.058952328,
-  0.052131936,  0.081415504,  0.025469495,  0.032314677,  0.017201250,  0.126881525,  -0.107745528,  0.135958299,
-  0.015913697,  -0.131403074,  -0.066217981,  0.036338028,  -0.081947058,  0.154979095,  -0.109157816,  -0.010309801,
-  0.098400697,  -0.023820486,  -0.018117901,  0.164299428,  -0.053431585,  0.073372304,  0.168020472,  0.024393089,
-  -0.026533209,  0.148380175,  -0.091330998,  0.102889195,  0.069404386,  -0.065437078,  -0.077867009,  0.108077414,
-  -0.089921087,  0.093078837,  -0.139534563,  -0.069606595,  -0.128952205,  -0.116990596,  -0.086656980,  -0.075239234,
-  0.047493819,  0.116929643,  0.080116332,  -0.055150848,  -0.101339370,  -0.029431317,  0.124176189,  0.105478220,
-  0.009006086,  -0.064213552,  -0.139083669,  -0.063626640,  -0.021742636,  -0.076331832,  -0.220805570,  0.011461606,
-  -0.065198667,  -0.141995847,  -0.064058036,  0.065188594,  0.018790584,  -0.023814175,  -0.132817119,  -0.136579484,
-  -0.079505049,  0.126041457,  0.026614357,  0.070650801,  0.042924795,  0.012873237,  0.038066655,  0.037044186,
-  0.380406976,  0.003694283,  -0.006126794,  0.100677818,  -0.070334792,  0.040873982,  -0.007256770,  0.002506111,
-  -0.089651845,  -0.055893354,  0.083966449,  0.040889923,  0.019725967,  -0.126054555,  0.068314992,  -0.140317723,
-  0.111242108,  0.002271455,  -0.110236585,  0.082569592,  -0.111034997,  -0.097656727,  0.072010800,  -0.106915131,
-  0.113131456,  0.086143620,  -0.135014758,  -0.131718740,  -0.028118312,  0.735594988,  -0.011246717,  -0.011139529,
-  -0.033277743,  0.000819017,  0.085229024,  0.078732483,  0.215158954,  0.169082046,  -0.068491131,  0.072934240,
-  -0.071905032,  0.204871938,  -0.188485801,  0.078322366,  -0.152354077,  0.160211682,  -0.012570377,  -0.127050653,
-  -0.107122138,  -0.160122216,  -0.049338654,  -0.062957987,  0.052470822,  0.059422832,  0.058191340,  -0.033085313,
-  -0.099075012,  -0.137846142,  -0.182322189,  0.011704030,  -0.146915361,  0.013486369,  -0.145885974,  0.061079543,
-  -0.253909558,  0.056997951,  -0.093652412,  0.061722957,  0.113636121,  0.393473417,  -0.007747635,  -0.094005197,
-  0.065811731,  -0.159597322,  -0.039848197,  -0.130872250,  0.192455366,  0.054674376,  0.058666997,  -0.170103908,
-  -0.142310202,  0.276966333,  -0.161842152,  0.062688999,  -0.198541179,  -0.050578356,  0.030442689,  -0.168267474,
-  -0.040056881,  0.053154770,  0.054782405,  0.029506344,  0.134022042,  0.188669920,  0.171226963,  -0.049303532,
-  0.233743817,  -0.108988069,  0.394318283,  0.048665378,  -0.029454162,  -0.022353401,  0.028348383,  0.022694465,
-  0.025205739,  -0.039715733,  -0.032053791,  0.026143767,  -0.075029738,  0.024095848,  -0.058654182,  -0.120910041,
-  0.056048550,  -0.006699845,  -0.155002624,  0.029604357,  -0.118913747,  0.062770717,  -0.138507724,  0.026180184,
-  0.006195465,  0.045921661,  0.098200977,  -0.113516450,  0.008989351,  -0.132217959,  -0.023145549,  0.301361203
+static const float weight_8_sequential_1_dense_1_MatMul[7424] EMBEDDED_ML_LAYER0_PLACEMENT = {
+  0.134328067,  -0.008208964,  0.071905740,  -0.036486939,  -0.013367656,  -0.080982909,  -0.113544434,  -0.141331241,
+  0.014800176,  0.041597437,  -0.096159630,  0.000543492,  -0.029117787,  -0.005239964,  -0.024069466,  0.020328363,
+  -0.161790937,  0.048066851,  0.072334260,  -0.036220945,  -0.024228731,  -0.136554301,  -0.114306875,  0.021321326,
+  0.097244717,  -0.037080564,  -0.132906049,  -0.094433136,  -0.141627803,  -0.079320565,  -0.079589799,  -0.121944547,
+  -0.024720294,  0.012882647,  0.006908583,  -0.053161792,  -0.126794606,  -0.092605397,  -0.093356691,  0.093617700,
+  -0.131764367,  -0.088003293,  -0.033886209,  0.016093748,  -0.079586893,  -0.098552555,  -0.098659784,  0.155606791,
+  -0.099666327,  -0.175368965,  -0.107538983,  -0.002553518,  -0.016736537,  -0.001541960,  -0.020482292,  -0.087885372,
+  0.000389626,  0.025188208,  -0.091506153,  -0.073481686,  0.006406853,  0.085417591,  -0.042930931,  -0.093199052,
+  -0.135769039,  -0.018916219,  -0.048148002,  0.058459319,  -0.013989069,  0.007199683,  -0.031859413,  0.144573420,
+  -0.018642828,  -0.130733967,  -0.070609666,  -0.003103713,  -0.010504965,  0.128401414,  0.005742505,  0.082373276,
+  -0.000047691,  -0.015006751,  -0.111098617,  -0.091199346,  0.062138878,  -0.133643135,  -0.023695514,  0.161076903,
+  -0.146878451,  0.049617209,  0.002566336,  -0.008089926,  0.050580397,  0.025821356,  -0.116672575,  -0.091620415,
+  -0.093925163,  -0.072913617,  -0.055327896,  -0.091109075,  -0.166915208,  0.000050094,  -0.151831701,  -0.071501970,
+  -0.033796027,  -0.101470858,  -0.107024103,  -0.095716171,  0.047052827,  -0.014914067,  0.034302421,  -0.120482914,
+  0.011404917,  -0.035725608,  -0.103638209,  0.122964576,  -0.115329593,  0.046290196,  -0.140843332,  -0.137405336,
+  -0.090186611,  -0.104825757,  0.094549291,  -0.105978824,  0.035681099,  -0.156170189,  0.025112700,  -0.118316859,
+  -0.110614270,  0.005119232,  -0.021819927,  0.060689043,  -0.050346650,  -0.126438051,  -0.018639684,  -0.067776859,
+  -0.032298163,  -0.104479268,  -0.012626680,  -0.051234834,  -0.021998461,  -0.084243543,  -0.028082460,  0.027113874,
+  -0.068630330,  0.074658461,  -0.038646437,  -0.042858120,  -0.045396913,  -0.072947480,  -0.074345201,  -0.105622165,
+  -0.028956130,  -0.120785460,  -0.031828456,  -0.074837543,  0.001353786,  0.007082161,  -0.044773407,  -0.016069673,
+  -0.059286270,  -0.131517529,  -0.020236716,  -0.054066271,  -0.117353335,  -0.121093199,  -0.060550943,  -0.138566434,
+  -0.083035126,  -0.107788026,  -0.004871100,  -0.107837729,  -0.143173024,  0.108286016,  -0.131291106,  -0.062695213,
+  -0.009159193,  0.013998660,  -0.117025711,  -0.031343974,  -0.011777445,  -0.113950737,  -0.117858201,  -0.080964752,
+  -0.022208534,  -0.075571187,  -0.045618251,  -0.058297455,  -0.054205507,  -0.085495651,  0.176247120,  -0.104496427,
+  -0.064561650,  -0.011975855,  -0.114767313,  -0.008984660,  -0.089974903,  -0.144175053,  -0.078733094,  -0.132202461,
+  0.011934298,  0.049147505,  -0.066256195,  -0.060282961,  -0.001064881,  -0.070621766,  0.068745680,  0.073844247,
+  -0.049332194,  -0.027311251,  -0.091061011,  -0.042730771,  0.024230029,  -0.132298276,  -0.116463460,  0.057713609,
+  -0.089370102,  -0.062021196,  -0.012599083,  -0.064417414,  -0.067213975,  -0.027119115,  -0.008252623,  0.043964464,
+  -0.133183405,  -0.130506709,  -0.100074217,  -0.114621826,  0.017384078,  0.062356416,  -0.024039295,  0.006627485,
+  -0.026860438,  -0.152081087,  -0.105116069,  -0.116330348,  -0.038649961,  -0.126871750,  -0.096306197,  0.140179038,
+  0.036354490,  -0.082081199,  -0.015861601,  -0.134475380,  -0.080330305,  0.018050473,  -0.050694119,  -0.085084237,
+  -0.014659171,  0.031031866,  -0.091330998,  0.011461606,  0.019725967,  0.204871938,  -0.007747635,  0.048665378,
+  0.078088365,  0.106143922,  -0.058311075,  0.103668913,  -0.105902240,  -0.009205166,  -0.041060708,  -0.109597325,
+  -0.102918670,  0.016666472,  -0.081859417,  0.072969802,  -0.112260014,  -0.122206494,  -0.204075798,  0.005035777,
+  0.046530243,  -0.075237185,  -0.087832414,  -0.070038080,  0.175152183,  -0.015149911,  -0.093997963,  -0.101069361,
+  -0.009927526,  0.033512175,  0.101345316,  0.031489640,  0.008020034,  -0.050178923,  0.172788367,  0.160184503,
+  -0.128050521,  -0.092753530,  0.041538451,  -0.118569359,  -0.163526401,  -0.072953850,  -0.068842091,  0.025635613,
+  -0.031573471,  -0.038586169,  -0.133493796,  -0.108007140,  -0.097205661,  -0.112723775,  0.027214123,  -0.038066916,
+  0.042102970,  0.040952630,  -0.087609336,  -0.049859591,  0.116784863,  -0.105875634,  0.102296896,  0.131405413,
+  0.063705146,  -0.093534812,  -0.108974993,  -0.044714294,  -0.027466506,  0.019201443,  -0.001250692,  0.141486287,
+  0.096120305,  -0.125867575,  -0.095467620,  0.042250723,  0.041703589,  -0.019146640,  -0.117754892,  -0.004607956,
+  -0.103013627,  -0.078443862,  -0.139765635,  0.040953726,  0.032223832,  0.012606874,  0.067759216,  -0.112784624,
+  0.078675523,  -0.002340178,  -0.066141754,  -0.026545573,  0.054193027,  0.069789886,  -0.029414469,  -0.043247048,
+  0.134155542,  0.040209949,  -0.086390480,  -0.073480055,  0.001714928,  0.080781214,  -0.099645741,  -0.058194473,
+  0.036987424,  0.096962057,  0.034702413,  0.016652223,  0.117387541,  -0.044001795,  0.042623680,  -0.083004504,
+  0.024033669,  0.067561984,  -0.063201554,  -0.126528829,  -0.155600190,  -0.103101999,  0.099222183,  -0.087265208,
+  0.031621203,  -0.100289077,  -0.093597829,  -0.117162839,  -0.073762119,  -0.144724905,  0.037719473,  -0.124226235,
+  0.046156995,  0.101669848,  -0.034171291,  -0.076412410,  -0.091148540,  -0.011099101,  0.068365917,  -0.008166832,
+  -0.051976122,  -0.099565178,  0.047477417,  -0.004296232,  -0.110182233,  0.007573198,  -0.084726676,  0.113903925,
+  -0.189350620,  -0.142604664,  -0.017953297,  -0.183464512,  0.186183512,  -0.071003720,  0.115890048,  -0.071098268,
+  -0.067739412,  0.096392103,  0.101014145,  0.069818094,  0.099239923,  -0.058428846,  0.026852708,  0.101969451,
+  -0.086392768,  -0.038259059,  -0.151023105,  -0.056017026,  0.091546237,  -0.096687868,  0.047394067,  0.037207786,
+  0.112886690,  0.120013885,  -0.048691019,  -0.051231861,  -0.066456676,  -0.015305900,  0.049575627,  -0.066829540,
+  0.125331521,  -0.088441521,  0.102794290,  -0.079666533,  0.111978106,  0.118526436,  -0.103336476,  0.107031539,
+  0.042890042,  -0.057214856,  0.007509661,  -0.134047374,  -0.049507514,  -0.030195853,  0.152532160,  0.084037744,
+  -0.163179293,  -0.144562244,  0.030163756,  0.062093150,  -0.127810583,  -0.070261620,  -0.165342361,  -0.146091312,
+  -0.015325073,  0.128226697,  -0.019152770,  0.236603066,  -0.009102420,  -0.176253483,  -0.063722916,  -0.130915925,
+  0.085847393,  -0.193645656,  -0.044734284,  -0.054036558,  -0.028763793,  -0.035593431,  -0.120378464,  -0.090092391,
+  -0.088054880,  -0.062790602,  -0.138368174,  -0.070409983,  -0.036304839,  0.103074133,  0.049312059,  0.051974449,
+  -0.108406827,  -0.012337478,  0.098502390,  0.075107396,  -0.118975535,  -0.060000353,  0.108247228,  -0.094444409,
+  0.043198552,  0.007639967,  -0.010997378,  -0.095686331,  -0.114374369,  -0.084318645,  -0.040429063,  -0.054456498,
+  0.165217876,  -0.138111696,  -0.095932670,  -0.040302038,  0.019614566,  -0.039497755,  0.034967080,  -0.082585000,
+  0.113941096,  -0.124933481,  -0.083350606,  0.017555717,  -0.050216608,  0.044837821,  -0.031946886,  0.114052251,
+  0.141947910,  -0.097712807,  0.102889195,  -0.065198667,  -0.126054555,  -0.188485801,  -0.094005197,  -0.029454162,
+  0.094225854,  0.181532711,  -0.122324400,  0.046762943,  -0.082777336,  -0.121112153,  -0.028564535,  -0.124238104,
+  -0.078927442,  0.007460997,  -0.101790741,  -0.133124202,  0.157724947,  -0.083593369,  -0.105780505,  -0.045143973,
+  -0.047023825,  -0.131344765,  0.051753704,  0.028910602,  0.056859028,  0.027042668,  -0.044142533,  0.128995255,
+  0.025452016,  0.028394569,  0.044462413,  -0.063649960,  0.045076806,  0.124987163,  -0.027167931,  -0.085212782,
+  -0.084095493,  0.038962111,  0.015003446,  0.081662446,  -0.133441329,  0.000718193,  -0.112008661,  0.289189130,
+  0.138942197,  0.078756936,  -0.012528678,  -0.057204206,  0.165903971,  0.007627929,  -0.061794542,  0.131708264,
+  0.171312943,  -0.152899802,  -0.063741870,  -0.100369021,  -0.040305048,  0.092161007,  0.074247621,  -0.064016365,
+  -0.085691422,  0.085183121,  0.075444087,  0.085144922,  -0.058882780,  0.205713630,  0.158302188,  -0.066274561,
+  -0.083937332,  -0.122687958,  -0.029489554,  -0.136284307,  0.118973851,  -0.122141451,  -0.090076178,  0.024797963,
+  0.069229826,  -0.102182060,  -0.113860659,  0.115321420,  -0.050349079,  -0.113255098,  0.066611484,  -0.005594573,
+  -0.077173315,  0.093135528,  -0.015273594,  -0.053754624,  0.026995063,  0.090695582,  0.026146233,  -0.073318295,
+  -0.103409842,  -0.031992763,  -0.076454736,  -0.028315669,  -0.005168875,  -0.015026502,  -0.035639014,  0.129140243,
+  0.057983045,  0.123773359,  -0.070896029,  -0.124924451,  -0.111412615,  -0.061985031,  -0.100044444,  -0.126229763,
+  0.013291001,  -0.060033061,  -0.115533352,  -0.111246884,  -0.141543880,  -0.062122725,  -0.067819156,  -0.126383185,
+  -0.130724460,  -0.089551456,  -0.020785695,  -0.095426522,  -0.102953561,  -0.215573892,  -0.042490073,  -0.100430585,
+  -0.062877245,  -0.103088789,  -0.014207089,  -0.023066074,  -0.139790416,  0.202822149,  0.138197377,  -0.105417408,
+  -0.137486219,  -0.025853259,  -0.005154671,  -0.086531140,  0.108369805,  -0.071204290,  0.054953396,  -0.140891969,
+  -0.072121717,  0.101432353,  -0.122940697,  -0.033753656,  -0.077925928,  -0.064678751,  -0.084870756,  -0.136475950,
+  -0.032037660,  0.193680957,  -0.133662760,  -0.128588513,  -0.039879031,  -0.138388038,  -0.040797774,  0.038388997,
+  0.050741762,  0.066446558,  0.190865621,  -0.028318981,  -0.109502271,  -0.128922269,  0.165504232,  -0.004571686,
+  -0.109034181,  -0.031815428,  0.090077348,  -0.019294960,  0.103396133,  0.031347658,  -0.089473791,  -0.043648843,
+  0.089403987,  -0.021334164,  0.047874119,  -0.100034259,  0.087354690,  0.062230844,  -0.044435192,  0.109690353,
+  0.051474601,  0.027213549,  -0.133201793,  0.086570971,  0.105876736,  -0.136061385,  -0.098530017,  -0.104189515,
+  -0.135652676,  -0.126339734,  -0.000311011,  -0.142031312,  0.012138976,  -0.070825547,  0.051920190,  -0.117838785,
+  0.012804728,  -0.066995874,  -0.103087440,  -0.066386119,  0.200996026,  0.050759364,  -0.141969934,  0.011014450,
+  -0.125633135,  -0.186734214,  0.092464209,  -0.085608497,  -0.001242343,  -0.040172145,  0.184478611,  -0.058759026,
+  -0.078991368,  0.020173412,  -0.080620721,  -0.116987623,  -0.099239647,  0.173184246,  0.006408825,  -0.018082209,
+  -0.116175227,  -0.072825685,  -0.036116242,  -0.116477087,  0.229206264,  0.067330681,  0.028974509,  0.061151292,
+  -0.061477214,  -0.140216023,  -0.091207817,  0.094644405,  0.041162100,  -0.054113023,  0.014330347,  0.276608258,
+  -0.088667631,  0.164769962,  -0.101812467,  0.250568867,  -0.075231001,  0.076397926,  -0.086518198,  0.088568129,
+  0.022267247,  -0.090098858,  -0.064946815,  0.031234525,  -0.096150927,  -0.173708633,  0.332407653,  0.086202502,
+  -0.040724359,  0.058952328,  0.069404386,  -0.141995847,  0.068314992,  0.078322366,  0.065811731,  -0.022353401,
+  0.046662979,  -0.004692108,  -0.110506572,  -0.114737123,  0.074325643,  0.139323920,  -0.016309222,  -0.136059523,
+  -0.090749137,  -0.010387656,  -0.004558195,  -0.079464331,  0.074378900,  0.090066291,  0.031298082,  -0.022961810,
+  -0.097628392,  0.066367343,  -0.048438556,  -0.014198976,  -0.118900642,  0.017615892,  0.137657732,  -0.080414578,
+  -0.044869073,  0.034275953,  -0.090645313,  0.055944625,  -0.117195696,  -0.075354360,  -0.053345516,  -0.134191126,
+  -0.106425598,  0.070986673,  0.086160026,  -0.140830934,  0.042603638,  -0.102348700,  0.111256592,  -0.015014132,
+  -0.053848855,  -0.007696688,  0.046975262,  -0.142985284,  -0.007338846,  -0.139097959,  -0.065476246,  -0.068672858,
+  0.063534647,  -0.005513783,  0.029328279,  -0.047264267,  0.002464392,  0.092051931,  0.017487336,  0.043342076,
+  0.053219240,  0.030706555,  -0.113030724,  -0.033663090,  0.090699449,  -0.039510984,  0.014288965,  0.014647837,
+  -0.140929684,  -0.066162176,  -0.130588055,  0.072400630,  -0.137312666,  0.083948366,  -0.037784886,  0.071287632,
+  0.104831643,  0.034654412,  0.043224115,  -0.023453943,  -0.080596566,  -0.043355126,  0.072684422,  0.055484500,
+  -0.004590103,  0.030243522,  -0.089669079,  -0.037484445,  0.045950785,  -0.001066855,  -0.112246245,  0.035113450,
+  -0.135710612,  -0.169642672,  0.056033995,  0.093949027,  0.005343085,  0.097155966,  0.057579901,  -0.039197180,
+  -0.013181359,  0.071368046,  -0.058762431,  -0.092386536,  0.163798913,  -0.068553120,  -0.041170385,  -0.072673097,
+  -0.064725906,  -0.122129783,  0.166456535,  0.069323003,  0.240170017,  -0.095402688,  0.010104088,  0.015754336,
+  -0.094150819,  0.072673775,  -0.088941708,  -0.029235773,  -0.092173636,  0.043452203,  0.121401981,  -0.039163150,
+  0.014006067,  -0.060956754,  -0.127346069,  0.082048438,  -0.021458386,  -0.007745472,  -0.092143849,  -0.115632594,
+  -0.141562223,  -0.117834881,  -0.157280803,  0.183782190,  0.114810131,  0.026172329,  0.102891482,  -0.111930728,
+  0.024511319,  -0.091931313,  -0.015922680,  0.059419483,  -0.057446063,  -0.119889691,  -0.025124626,  -0.130403802,
+  -0.064805098,  0.000252651,  -0.085162967,  0.001057431,  -0.139191568,  -0.056855809,  0.027582556,  -0.239650890,
+  -0.095473684,  -0.023962924,  0.028356478,  0.146752343,  0.093212374,  -0.024569858,  -0.003684625,  0.073681600,
+  0.138795406,  -0.013709611,  0.209916711,  -0.130400285,  -0.138159439,  0.019279795,  -0.117464527,  0.148082465,
+  -0.120524310,  -0.089919597,  -0.056568816,  0.028225694,  0.160939142,  0.004225699,  0.073757015,  -0.133531749,
+  0.038911197,  -0.020056695,  0.071008936,  -0.102537170,  0.073576733,  0.178288609,  -0.130104333,  0.181259379,
+  -0.142877653,  0.061188113,  0.007256785,  -0.120295614,  -0.068343453,  0.089072928,  -0.131874487,  0.083344907,
+  -0.058288403,  0.035528116,  0.010118243,  -0.049237099,  -0.053520892,  -0.034757923,  0.016826546,  -0.125837445,
+  0.201338306,  -0.233250499,  0.139661700,  -0.122273698,  -0.131267369,  -0.025769226,  -0.103778332,  0.148399025,
+  -0.128747299,  -0.080754615,  0.015249043,  0.025088415,  -0.124304712,  -0.032173086,  -0.134348392,  -0.055530176,
+  0.020123675,  -0.035146061,  -0.074454620,  -0.059192456,  -0.101875976,  -0.145182103,  0.112752333,  -0.102398664,
+  -0.069898114,  0.181277841,  -0.049020581,  0.005898710,  0.227990910,  -0.015799532,  -0.036170721,  0.011826535,
+  0.104589067,  0.147104874,  -0.065908030,  0.067583948,  -0.077510491,  -0.040285256,  -0.074958399,  -0.081166744,
+  0.159281269,  0.053718012,  -0.032964069,  0.050785340,  0.082620725,  0.007227688,  -0.113466531,  0.137389764,
+  -0.013190099,  0.052131936,  -0.065437078,  -0.064058036,  -0.140317723,  -0.152354077,  -0.159597322,  0.028348383,
+  0.114754967,  0.156287625,  0.059555613,  -0.069070853,  -0.153497264,  0.042836677,  -0.110083640,  -0.100854576,
+  -0.080442511,  0.076667145,  -0.081192583,  0.081517160,  -0.103105009,  0.111754648,  0.012136496,  -0.118646823,
+  0.138071448,  -0.092599675,  -0.016265724,  -0.057734959,  0.017405853,  0.027623996,  -0.112641297,  0.090407453,
+  -0.014852248,  0.042998455,  0.008882948,  0.034420121,  -0.090711817,  0.026238395,  -0.053965315,  0.092953064,
+  -0.019115249,  -0.036649324,  -0.022210924,  0.221286312,  0.038019303,  -0.065292731,  -0.080712184,  -0.074531309,
+  -0.030540373,  0.105468467,  0.046729114,  -0.027995622,  0.095833123,  0.187617823,  -0.112382412,  0.110831887,
+  0.004725570,  -0.141342998,  -0.069196388,  0.029349297,  0.160428882,  -0.049157053,  -0.032864839,  -0.045166750,
+  0.050818793,  -0.116608992,  -0.057068527,  0.034157328,  -0.100445777,  -0.033844035,  0.038182583,  0.087865517,
+  0.174099147,  -0.014825408,  -0.038619742,  0.062521689,  -0.063259885,  -0.003485157,  0.042777475,  -0.140447050,
+  0.000545575,  -0.013375438,  -0.125128418,  0.157333344,  0.068225421,  -0.010716279,  0.007882438,  -0.119326569,
+  -0.069402352,  -0.024278069,  -0.090278812,  0.037158385,  -0.002153276,  0.146359503,  0.011621853,  -0.099928617,
+  -0.096835352,  0.136865109,  -0.044593245,  -0.003426193,  0.022710739,  -0.084035121,  0.004246606,  -0.066032439,
+  0.224712774,  -0.044390865,  0.177399054,  0.064334638,  -0.127561659,  0.091149233,  -0.125113711,  0.083514005,
+  -0.128959090,  0.095599204,  -0.055604227,  -0.047360785,  -0.089121871,  0.011284352,  0.056687929,  -0.088861443,
+  0.046419017,  -0.111345783,  0.088524982,  0.016953209,  0.028562300,  -0.153004542,  -0.002748481,  -0.076258972,
+  0.083340354,  -0.127914429,  0.067987315,  -0.084868550,  0.037300464,  -0.114855804,  -0.093037605,  -0.044474404,
+  -0.079763532,  -0.010614911,  -0.176793799,  -0.119029120,  -0.068024985,  0.011260098,  -0.062248543,  0.157155782,
+  0.118368089,  0.062160201,  -0.072322130,  -0.157396093,  -0.101977751,  -0.138491228,  -0.077906974,  0.078547657,
+  -0.038996439,  0.131172955,  0.000783686,  -0.114061885,  -0.028424151,  -0.085160896,  0.020820050,  -0.069237128,
+  -0.091998480,  -0.044988200,  -0.069186643,  -0.055025950,  0.097299844,  0.078012779,  -0.056936324,  0.048850186,
+  -0.057941698,  -0.100121781,  -0.087785840,  -0.004937171,  -0.114831567,  -0.014127983,  -0.052468091,  0.000354620,
+  -0.048982609,  0.103507414,  -0.124274209,  -0.104284197,  -0.083681501,  -0.044191606,  0.121792465,  -0.083635949,
+  0.036223084,  0.003426482,  -0.067504562,  0.087321021,  -0.084090576,  0.001453422,  0.094233036,  -0.010107644,
+  0.095161125,  -0.092153579,  0.067082688,  0.014655772,  -0.036887467,  0.141424581,  -0.118569925,  -0.171808735,
+  -0.038993672,  0.036095969,  -0.050029323,  -0.092338711,  0.150546089,  -0.007243006,  -0.087907784,  0.045468539,
+  0.005338656,  0.006342452,  0.006522495,  0.170027316,  -0.099792585,  -0.033769712,  -0.000791925,  0.085727058,
+  0.010404153,  -0.087141708,  -0.090935990,  0.024381047,  0.121001624,  -0.137465388,  0.098772295,  0.017126087,
+  0.216349557,  -0.020338701,  0.085455149,  -0.106224746,  -0.045815811,  -0.029247070,  -0.070918754,  0.132268190,
+  -0.040849727,  -0.126917168,  -0.103387401,  0.146208465,  -0.073880918,  0.030420104,  0.012612917,  0.196166769,
+  -0.133462176,  0.139549106,  -0.006006797,  0.043305278,  -0.013842323,  -0.086555459,  -0.010870422,  0.059326630,
+  0.029748837,  0.106855452,  0.038307365,  -0.046648014,  -0.061709095,  -0.121462390,  0.015083198,  -0.095521308,
+  -0.058425836,  0.081415504,  -0.077867009,  0.065188594,  0.111242108,  0.160211682,  -0.039848197,  0.022694465,
+  0.080884576,  -0.143184885,  0.086955421,  -0.096746989,  0.093561642,  -0.056172300,  -0.005328005,  -0.011982022,
+  0.173234612,  -0.084604979,  0.095292620,  -0.085460573,  -0.026357930,  -0.051526301,  -0.078615531,  -0.103809506,
+  -0.001107384,  -0.030974953,  -0.119390443,  -0.073614761,  0.051817201,  -0.003730904,  -0.085515991,  -0.137630880,
+  0.058089286,  0.051160805,  -0.057080660,  0.055377923,  0.056477148,  0.174952433,  0.021441679,  0.003604086,
+  -0.048924495,  0.058484603,  -0.055674344,  0.058762487,  0.066318110,  0.162920758,  0.060381722,  -0.015902936,
+  -0.031037634,  0.028551485,  -0.070044734,  0.067873269,  -0.090725303,  0.063221388,  -0.073941872,  -0.094221584,
+  0.033877116,  0.152773932,  0.187013805,  0.002113833,  -0.087345295,  -0.119866967,  -0.086101837,  0.121249691,
+  0.065621547,  -0.125515029,  -0.010295983,  0.151953489,  0.086663589,  0.082318753,  0.023673546,  -0.011344302,
+  -0.095893048,  -0.079741895,  0.006426905,  -0.028354205,  -0.098757282,  0.088882104,  0.068475448,  0.113467924,
+  -0.082725734,  -0.078685500,  -0.011385812,  -0.018105799,  0.075788654,  0.011121316,  0.132217437,  -0.130704641,
+  -0.073584698,  -0.013740981,  0.225098938,  0.047980137,  0.135689855,  -0.099923417,  -0.080532953,  -0.012623445,
+  0.138169289,  0.104875714,  -0.026016869,  -0.127316281,  -0.170015216,  0.206474617,  -0.131147698,  -0.044869684,
+  0.029980758,  0.130779713,  -0.122753650,  -0.032030955,  -0.019166173,  -0.110710301,  0.150922626,  -0.043204769,
+  -0.035267517,  -0.130389228,  -0.049117688,  -0.114990160,  -0.089205533,  -0.081721827,  -0.047317065,  -0.023811612,
+  0.045924287,  -0.121287823,  0.001493562,  -0.008893594,  -0.098720640,  -0.088986628,  -0.122062579,  0.070683561,
+  -0.059895314,  0.102408789,  -0.073212266,  -0.002263638,  -0.132758096,  0.271527380,  -0.045011859,  0.058463942,
+  0.008411146,  -0.073330536,  -0.065230228,  -0.030523183,  -0.053632401,  0.057677206,  -0.019305650,  -0.047522165,
+  0.071954064,  -0.045782119,  -0.059143990,  0.036401570,  0.178074986,  0.089254133,  0.018887246,  -0.007871336,
+  -0.107560262,  -0.194817796,  0.026744453,  0.088382661,  -0.144862533,  0.015246026,  -0.132020250,  -0.160546094,
+  -0.027843181,  -0.037053235,  -0.202599227,  -0.113327570,  -0.044471927,  0.123299994,  -0.263357013,  0.096908376,
+  -0.140280887,  -0.044082619,  0.142460302,  -0.024300354,  0.149944782,  -0.141172588,  0.003410752,  -0.138893619,
+  0.138058901,  0.021250520,  -0.125494570,  0.185490727,  -0.105253294,  0.126762837,  0.024643030,  -0.039658256,
+  -0.159840822,  0.029223958,  -0.091281682,  -0.093534201,  -0.069661528,  -0.091129906,  -0.121988788,  -0.052624904,
+  0.114715077,  -0.059237197,  0.007322068,  -0.002227762,  0.001163960,  -0.011849205,  0.054834615,  0.051673785,
+  0.016398022,  0.087450378,  0.042617973,  -0.049599394,  0.095643401,  -0.062834986,  0.015819993,  0.014578218,
+  0.180225059,  0.004736777,  0.073369473,  0.084095955,  0.029865326,  -0.036288165,  0.059905231,  -0.034369454,
+  0.024443090,  -0.072912782,  0.078000553,  -0.054496080,  0.044638958,  -0.037138376,  -0.054914895,  -0.131492466,
+  -0.133544788,  -0.141605213,  0.034352016,  -0.115193188,  0.021634458,  -0.132889718,  -0.047330070,  -0.013027071,
+  0.144170210,  -0.113332063,  -0.080597296,  0.137977540,  -0.093043037,  -0.129928991,  -0.068871938,  -0.045870911,
+  0.108568691,  0.135835081,  0.178175434,  0.045260821,  0.070358321,  -0.124288730,  -0.025874799,  -0.053777695,
+  0.084204078,  -0.072202243,  0.016919324,  -0.134745732,  0.073295124,  -0.140445441,  -0.071574233,  -0.025139740,
+  -0.121364586,  0.025469495,  0.108077414,  0.018790584,  0.002271455,  -0.012570377,  -0.130872250,  0.025205739,
+  -0.054146491,  0.192935780,  -0.065177113,  -0.117252178,  -0.078573361,  0.158665225,  0.162255168,  -0.115046099,
+  0.144565731,  0.013439294,  -0.111760691,  -0.131039739,  0.296244293,  0.155182421,  0.027491042,  0.119058855,
+  -0.128850669,  -0.044758942,  -0.073146455,  0.109063625,  -0.072034560,  0.025004584,  -0.023108546,  -0.094677471,
+  0.046785869,  -0.180030435,  0.194208533,  0.006573233,  -0.064234167,  0.123787299,  -0.090172924,  -0.073340356,
+  -0.087784596,  0.091736577,  0.018939340,  -0.008947296,  0.049325306,  0.073543012,  0.140320852,  -0.032827653,
+  0.051064745,  0.031996280,  -0.004722818,  -0.002743123,  -0.141989753,  -0.091537982,  0.207879096,  0.102080852,
+  0.023310371,  -0.154541850,  -0.013913871,  0.099621542,  -0.049840890,  -0.024117511,  -0.045288816,  0.086160049,
+  -0.100943200,  -0.104930989,  -0.068161182,  -0.071215391,  -0.126159295,  0.011114043,  -0.107658401,  0.204627484,
+  0.023206050,  0.036891062,  0.159667075,  -0.044961184,  0.092103019,  -0.139724657,  -0.134023219,  -0.084779784,
+  0.162419930,  -0.090100147,  -0.036460854,  0.030045133,  0.098163791,  -0.077624135,  -0.133089185,  0.214304820,
+  -0.040939704,  -0.106955841,  -0.140805557,  -0.090060703,  -0.054587852,  -0.076417416,  0.087380446,  -0.000768604,
+  -0.022291780,  -0.015221473,  -0.013274858,  -0.123001441,  0.016739637,  -0.044180375,  -0.068453349,  0.066782035,
+  -0.080617987,  0.141942948,  -0.037867703,  -0.033577386,  -0.124493696,  -0.065276347,  0.058563851,  0.098135658,
+  0.121653624,  -0.094372533,  0.005474507,  -0.106267229,  0.041273203,  0.028595088,  0.092753604,  -0.120172568,
+  -0.067387387,  -0.007243970,  0.009683380,  0.163573995,  0.002781993,  0.039434575,  0.005041118,  -0.001007573,
+  0.038619347,  -0.090162337,  -0.066722371,  -0.012803309,  0.211096004,  0.167661995,  -0.104659364,  0.016224483,
+  0.071615778,  -0.085388832,  0.172776371,  -0.139089063,  0.009022141,  -0.128298864,  0.052816499,  -0.064806946,
+  -0.072261065,  0.103305869,  0.140091464,  -0.089947738,  -0.056585640,  -0.036121380,  -0.096070647,  0.239210233,
+  0.179838210,  -0.192874238,  -0.007725279,  0.025538249,  -0.066917375,  -0.112269700,  -0.024108795,  -0.173799336,
+  -0.029555978,  0.005396869,  -0.064200133,  0.188283443,  0.123842739,  -0.070315190,  -0.157928362,  -0.127958730,
+  -0.133963779,  0.188075468,  -0.080254965,  -0.071881212,  -0.090370238,  -0.000807830,  0.058248356,  0.135984942,
+  -0.022157593,  -0.009084919,  0.100254469,  -0.003698885,  0.108198561,  -0.106123008,  0.016470131,  0.015116847,
+  -0.006481586,  -0.075272650,  0.038152911,  0.095116384,  0.105126418,  -0.084222265,  -0.025571255,  -0.037206516,
+  -0.157780230,  0.105777130,  0.008780122,  -0.048923373,  -0.074529342,  -0.127871290,  -0.046270758,  0.035636798,
+  0.003660456,  -0.131090075,  -0.104524553,  -0.136874124,  0.121811755,  -0.083962217,  -0.031902246,  -0.009454254,
+  -0.114462338,  0.041002747,  0.015548795,  -0.076895423,  -0.038643353,  0.236004487,  0.192524016,  0.123421684,
+  -0.027928330,  0.253051370,  0.096198715,  0.059323568,  -0.000256624,  0.149480745,  -0.027329532,  -0.043042988,
+  -0.104818977,  -0.110914364,  -0.113383301,  -0.042955287,  0.065425918,  0.075360410,  -0.026694061,  0.118474573,
+  -0.061547745,  -0.114187069,  -0.107967913,  -0.101822473,  0.111863136,  -0.059507228,  0.023368433,  -0.080750406,
+  -0.105371639,  0.081952922,  -0.006795931,  0.072264820,  0.065463319,  0.027517753,  0.075075246,  -0.080238603,
+  -0.067562848,  -0.119476236,  -0.061420221,  -0.123630494,  0.069343649,  -0.180984393,  0.001962682,  0.207207590,
+  -0.133385479,  0.032314677,  -0.089921087,  -0.023814175,  -0.110236585,  -0.127050653,  0.192455366,  -0.039715733,
+  -0.099644497,  -0.010066510,  0.178028196,  0.072254896,  0.031050969,  0.127412498,  -0.086441889,  0.134508133,
+  0.135161728,  0.062189467,  0.082941420,  0.018178143,  -0.007756528,  -0.010117978,  0.128558934,  -0.080932066,
+  -0.108196087,  0.182011843,  -0.128982291,  -0.066204816,  -0.060206521,  0.048432417,  0.083665550,  0.014330106,
+  0.056444846,  0.176438794,  0.254891664,  0.099772267,  -0.017974950,  -0.096697107,  -0.109865457,  0.128010541,
+  0.022212846,  -0.030101160,  -0.085713558,  -0.073073991,  0.058106046,  0.167890355,  -0.059335973,  -0.070058420,
+  0.147507980,  0.094085664,  0.006020510,  0.183405250,  0.278614104,  0.055092204,  0.033035293,  -0.009597665,
+  -0.002437040,  0.085265361,  -0.075203218,  -0.081143208,  0.068937995,  -0.026800200,  -0.041796140,  0.099248692,
+  -0.099820718,  0.077881061,  -0.049099293,  0.120259918,  -0.024716780,  -0.070197016,  0.000302110,  -0.090509936,
+  0.147599801,  -0.008260927,  0.119462572,  -0.010504039,  0.110001229,  -0.009273886,  -0.083175428,  -0.113347173,
+  0.010504926,  0.100454308,  0.189190924,  0.000678169,  -0.001772895,  -0.023876539,  0.046615321,  0.177283421,
+  0.032264952,  0.204575926,  -0.078264564,  0.005617667,  -0.106130846,  -0.022727640,  0.001254105,  -0.016044036,
+  0.088790692,  -0.127497151,  0.010498176,  -0.061621502,  0.012926919,  0.172166184,  0.038078282,  0.056745511,
+  -0.051596850,  -0.052802540,  -0.113330618,  -0.105111048,  -0.042521965,  0.084226720,  -0.103300542,  -0.058963865,
+  0.029417831,  -0.067585997,  -0.025516346,  0.104953803,  -0.076341920,  0.096756928,  -0.085225582,  -0.127663285,
+  0.057983018,  0.118235067,  0.161185533,  0.041594990,  0.164257482,  -0.147023246,  -0.024262257,  0.054481924,
+  0.226783559,  -0.070304379,  0.022215534,  -0.081489623,  0.069289081,  0.177804172,  0.023077773,  0.159318566,
+  0.185616970,  0.061866440,  -0.127294675,  -0.022210738,  -0.005078512,  0.018770007,  -0.060612001,  -0.122025803,
+  0.105229437,  -0.109455526,  -0.057790548,  0.026937852,  0.028905064,  0.046276107,  0.175890163,  0.072421677,
+  -0.057997219,  0.083204672,  -0.021128556,  -0.101731896,  -0.099229619,  -0.079081833,  0.082454048,  -0.156620756,
+  -0.054342508,  -0.063273266,  0.042323984,  -0.092813611,  0.096120492,  -0.063382305,  -0.107108258,  0.113867886,
+  -0.054443888,  0.002463159,  -0.082766891,  0.044636477,  0.107452631,  0.011095222,  0.123838045,  0.149723902,
+  -0.097825713,  -0.013040285,  -0.034999087,  0.124284349,  0.089670815,  -0.065915160,  0.127894238,  -0.115560956,
+  -0.025326736,  -0.123751983,  0.105444305,  0.089713752,  -0.104719453,  0.104803741,  -0.114301324,  0.075336717,
+  0.030147446,  -0.066494107,  0.024574989,  0.095471859,  0.011443967,  0.100782648,  0.154253840,  -0.112608448,
+  -0.143231317,  0.151763976,  0.026664184,  -0.092919543,  -0.136560321,  0.024791904,  -0.101626113,  -0.080735222,
+  -0.070590571,  0.063481443,  -0.144267142,  -0.065182373,  0.120163597,  -0.144973025,  -0.138599545,  0.102145396,
+  0.017766917,  0.184159949,  -0.046065234,  0.095134906,  -0.040408012,  0.166610152,  0.093142420,  0.093910113,
+  -0.081441864,  -0.034321930,  0.105326384,  -0.134423256,  0.022552313,  0.087738708,  -0.019789487,  -0.137721494,
+  -0.044862062,  0.112699948,  0.073316693,  -0.036907546,  -0.024783975,  -0.023724051,  -0.068081059,  0.100159302,
+  -0.079029396,  -0.065110669,  0.128812268,  -0.076898709,  -0.070262529,  0.059467152,  -0.017408242,  0.026646081,
+  -0.081454560,  0.159705207,  -0.038286585,  0.081676915,  0.116096757,  0.005362306,  -0.051169939,  0.080923222,
+  -0.010668856,  0.017201250,  0.093078837,  -0.132817119,  0.082569592,  -0.107122138,  0.054674376,  -0.032053791,
+  0.023212397,  0.056086473,  0.024552766,  0.059532713,  -0.080483295,  -0.064562619,  -0.073826231,  -0.118909948,
+  -0.105943784,  0.142524928,  -0.013628530,  -0.003353040,  -0.141777247,  -0.045384295,  0.015887663,  0.073796727,
+  0.226054817,  -0.042445932,  -0.023990858,  -0.124067508,  -0.049458601,  0.120203659,  -0.114579916,  -0.110926747,
+  -0.144253075,  0.064378373,  -0.062672086,  0.011244311,  0.002030042,  -0.003384603,  -0.114579052,  -0.095367819,
+  -0.018158749,  -0.054359794,  -0.101773858,  -0.118819535,  -0.187627643,  -0.110280171,  -0.072770700,  0.044811621,
+  -0.018212728,  -0.057746038,  0.022098349,  0.004238880,  -0.081654854,  0.114828914,  -0.059182487,  0.071929678,
+  0.000082580,  0.166179687,  0.031867679,  -0.105008893,  -0.142298132,  0.003245072,  -0.104349062,  -0.112525523,
+  -0.028723035,  -0.125350326,  0.072482817,  -0.104396798,  0.085690692,  -0.061281666,  -0.110537782,  -0.135070875,
+  -0.121483624,  -0.128421605,  0.174455449,  -0.011757313,  -0.140867889,  -0.104778640,  0.064848602,  -0.080188297,
+  -0.062328760,  -0.026370673,  0.136206016,  0.030517986,  -0.121847577,  -0.020739373,  -0.102718920,  0.069786593,
+  0.079968661,  0.133218214,  -0.006826858,  -0.126667604,  -0.178261936,  -0.091059074,  0.076889142,  0.001066006,
+  -0.112632573,  0.054458205,  -0.065043204,  0.087276116,  0.066450387,  -0.110307567,  0.089242585,  -0.048680492,
+  0.129718095,  -0.112894528,  -0.141893804,  0.209851801,  -0.103988118,  -0.037480656,  0.121567793,  0.177946687,
+  -0.126607627,  0.087420434,  0.123672627,  -0.107982717,  -0.108189419,  -0.041410591,  0.052996825,  -0.076453172,
+  -0.073774055,  0.133144051,  -0.022029003,  0.017637977,  -0.090271734,  0.130577520,  0.089604750,  -0.123395972,
+  -0.064205386,  0.105729789,  0.166832343,  0.199648395,  0.049238112,  0.053252846,  -0.114196137,  0.303599566,
+  0.232755423,  0.141372234,  0.063423723,  -0.133092031,  0.082497813,  0.013472647,  0.189048976,  0.113339163,
+  0.023650086,  0.114248283,  -0.012818485,  0.005918221,  -0.066918828,  0.113641426,  0.126058370,  0.069536597,
+  -0.074480496,  0.055090345,  0.104756869,  -0.033382773,  -0.136105627,  0.078487895,  0.034303304,  0.045184400,
+  0.108203880,  0.002177186,  0.126125976,  -0.118969165,  -0.091884434,  0.109642759,  0.052699622,  -0.122888170,
+  -0.074868910,  0.161674455,  -0.043869130,  -0.108105630,  0.021121113,  0.074428603,  0.112734646,  -0.026157606,
+  0.105440468,  -0.015755087,  -0.140841886,  0.007554987,  -0.028556453,  -0.013595726,  0.171829507,  -0.060376801,
+  -0.018745372,  0.038384739,  -0.007771793,  0.096381962,  0.093189083,  -0.069510102,  0.137092710,  -0.048005275,
+  0.041872378,  -0.062792927,  0.002929055,  0.124650188,  -0.002972256,  0.127073109,  -0.087983832,  0.026444936,
+  0.080681823,  -0.141523540,  -0.140338749,  0.057099387,  0.136821806,  0.046253607,  0.137619734,  0.215378687,
+  0.150948972,  -0.074972823,  0.018671118,  0.156557813,  -0.055530436,  -0.032830901,  -0.070197135,  -0.026808824,
+  0.019486768,  -0.141733870,  -0.033663943,  0.049461614,  -0.068236209,  -0.063391842,  -0.103304088,  -0.041201018,
+  -0.119174957,  0.065179087,  -0.039322115,  -0.053304695,  0.177243337,  -0.056279965,  -0.036480796,  -0.133648813,
+  -0.105041549,  -0.063316420,  0.153105035,  0.112711400,  -0.120204493,  0.090357743,  0.016858695,  -0.071129173,
+  -0.089251071,  -0.132960543,  0.102571189,  0.068986714,  0.001231003,  -0.069202818,  -0.029004976,  -0.056820508,
+  -0.088509396,  -0.001434526,  0.000966882,  0.024059217,  0.098495230,  0.054497935,  -0.144656777,  -0.026755981,
+  0.106065087,  0.126881525,  -0.139534563,  -0.136579484,  -0.111034997,  -0.160122216,  0.058666997,  0.026143767,
+  -0.004664081,  -0.076944754,  -0.145525336,  0.063296393,  -0.208036765,  -0.139699087,  -0.039806493,  0.161040574,
+  -0.085073307,  -0.091217548,  0.088669896,  -0.032928005,  -0.018466575,  0.037946615,  0.016665533,  -0.026667174,
+  0.006557184,  -0.069604553,  0.081994362,  -0.102602646,  -0.243744433,  0.046130691,  0.093533859,  0.089696661,
+  -0.114890814,  0.051168174,  -0.147355244,  0.154383272,  0.217638999,  -0.098810419,  0.004751086,  0.173924580,
+  -0.051627900,  0.130327195,  0.086242847,  0.066664524,  -0.142885208,  0.150253087,  0.230793491,  -0.077914618,
+  -0.093524173,  -0.140285581,  -0.082885787,  -0.122907385,  0.021329090,  -0.102029264,  -0.004432942,  -0.068556264,
+  -0.059454039,  0.138011649,  -0.126529276,  -0.084768847,  -0.031175587,  0.070232533,  0.083220392,  -0.073545679,
+  -0.036079772,  -0.126691908,  -0.137032449,  -0.008719443,  -0.114525646,  0.094653398,  0.027796753,  -0.125546202,
+  -0.104235455,  -0.059589315,  0.122593313,  -0.013441776,  0.082347892,  0.086240001,  -0.169041559,  0.066184886,
+  -0.102676123,  0.144644231,  -0.079877511,  -0.029477693,  0.068708047,  0.075110063,  0.008097139,  -0.126763821,
+  -0.112170696,  -0.055313818,  -0.104427382,  -0.211912766,  -0.187063694,  -0.060698170,  -0.111417323,  -0.008010098,
+  0.225366965,  -0.087592319,  -0.110328808,  0.025236243,  -0.224189490,  -0.033348061,  -0.114998534,  -0.046934653,
+  0.030211484,  0.011003667,  0.032517061,  -0.143255010,  0.139830068,  -0.031705879,  0.126939937,  -0.062026180,
+  -0.107684821,  0.002913586,  -0.009681773,  -0.108215563,  0.018975781,  -0.144394621,  0.101492792,  0.152141854,
+  -0.098795354,  -0.036951568,  0.211871311,  0.046671659,  -0.027168268,  -0.178277612,  0.111782208,  -0.135842383,
+  -0.141504660,  0.024387445,  -0.012520972,  0.002946406,  -0.004983752,  0.143553421,  -0.044245057,  -0.102712169,
+  0.223987728,  -0.027102411,  -0.163872421,  -0.116569072,  -0.014871867,  0.002323823,  -0.021554848,  -0.109941602,
+  -0.118889257,  -0.005124779,  0.146182284,  0.141392499,  -0.049109068,  0.112309068,  0.079623565,  0.002497641,
+  0.004781953,  0.036657680,  0.120799087,  -0.115058415,  -0.090056315,  -0.015689153,  -0.167234957,  0.043801986,
+  -0.075238690,  -0.126817375,  -0.074365616,  -0.022735765,  -0.008768454,  0.051811036,  0.039925892,  -0.049176212,
+  0.180952385,  0.173255995,  0.185366899,  -0.031114168,  -0.098919816,  -0.009005543,  0.083014518,  -0.054832168,
+  0.119260900,  0.106440328,  -0.052765030,  0.154915437,  -0.058341771,  -0.195619971,  0.173989236,  -0.062360831,
+  -0.160269782,  -0.061009407,  -0.011927701,  -0.072952360,  -0.039285704,  -0.104349166,  -0.098901600,  -0.077390835,
+  0.027082555,  0.036117278,  0.042609930,  -0.001221295,  0.128696904,  -0.090506718,  0.053521898,  -0.182128757,
+  0.106352612,  0.033332493,  -0.068124369,  -0.087149605,  -0.107045062,  0.050265912,  0.029030439,  0.003387721,
+  -0.071822502,  0.014146354,  -0.061461166,  -0.112923801,  -0.070278607,  -0.058257677,  -0.079348266,  -0.014753632,
+  0.086980499,  0.062859476,  -0.124618061,  -0.044163108,  -0.026296414,  0.113099247,  -0.126846924,  0.164294586,
+  0.206191108,  -0.044602964,  0.085576490,  -0.001648814,  -0.091680467,  0.085643098,  -0.109869465,  -0.128811479,
+  -0.036964368,  0.146606624,  -0.128848910,  -0.061990697,  -0.059645042,  -0.030668098,  -0.003458346,  -0.068753421,
+  0.108504683,  -0.120679460,  0.209209800,  -0.126376852,  0.080889121,  0.107116535,  0.035528313,  -0.067911312,
+  0.084135085,  0.020527633,  -0.107640520,  -0.122835681,  0.090306394,  0.063300297,  -0.070360348,  -0.118918695,
+  -0.055290326,  -0.107745528,  -0.069606595,  -0.079505049,  -0.097656727,  -0.049338654,  -0.170103908,  -0.075029738,
+  -0.003974790,  -0.032210100,  -0.067673512,  -0.104576170,  -0.048049368,  -0.071401991,  -0.087147877,  -0.026101518,
+  -0.000543466,  0.167907789,  -0.012665301,  0.040631067,  0.143595412,  0.151220784,  -0.052030623,  -0.024513790,
+  0.211807370,  -0.136867821,  -0.058736272,  -0.115573026,  -0.067833431,  0.165751711,  0.065023646,  0.179346681,
+  0.016014712,  -0.103014134,  -0.037630975,  0.150774330,  -0.107968085,  -0.028052421,  -0.026173806,  -0.072160296,
+  -0.021891981,  -0.026109507,  0.006983560,  0.131332040,  0.201485828,  -0.046780955,  0.015971644,  0.070730403,
+  -0.050544903,  -0.136786595,  -0.111158423,  0.165111080,  -0.081969745,  0.271914333,  0.234352902,  0.056855466,
+  -0.046997882,  -0.048218023,  0.599316120,  -0.139507622,  -0.044435985,  -0.026249923,  0.126750335,  0.023225658,
+  -0.041666023,  -0.114329740,  0.200643942,  -0.141931325,  0.019014506,  0.134258255,  -0.099959642,  0.083653457,
+  -0.031035999,  -0.029916480,  0.154147878,  -0.003285929,  0.012616800,  0.128645614,  0.055165455,  -0.056954816,
+  -0.085255057,  0.001771432,  0.126830772,  -0.144968867,  -0.097587541,  0.147943363,  -0.003010160,  -0.046616614,
+  -0.111117780,  -0.104239434,  0.040064022,  0.165583774,  -0.050980460,  0.229397744,  0.140065506,  -0.106964923,
+  -0.087587200,  0.071957514,  -0.026654594,  -0.029669754,  -0.137293845,  -0.049237549,  0.320568234,  0.156197935,
+  0.324638546,  -0.058620609,  0.164745405,  0.291288078,  -0.028983233,  0.216935471,  -0.020940097,  -0.132230192,
+  -0.010738082,  0.001203178,  -0.067353457,  -0.063916951,  -0.039254170,  0.373168319,  -0.060636736,  0.018684296,
+  0.112004347,  -0.108038999,  0.437317193,  -0.007597973,  -0.066974446,  0.122697130,  -0.139157876,  -0.066173129,
+  -0.123543277,  -0.049522325,  -0.000643511,  -0.088302933,  -0.020886835,  0.178552061,  0.232402116,  -0.073949955,
+  0.050150674,  0.306143314,  -0.133460373,  0.084159501,  -0.120866269,  -0.012328709,  0.144694641,  0.288562685,
+  0.140573412,  0.146409765,  0.013135803,  -0.038574114,  -0.027961224,  -0.000038141,  0.128858432,  0.219137192,
+  0.154762477,  0.045668568,  -0.021613738,  -0.114370458,  -0.101243094,  -0.049020872,  0.108626448,  0.048862673,
+  -0.115080833,  0.155565947,  0.102252230,  0.006735576,  -0.045137540,  -0.136757538,  -0.072948247,  -0.102309465,
+  -0.080970772,  -0.104421176,  -0.088559315,  0.253135949,  -0.011519101,  -0.088130325,  -0.004511758,  0.040595509,
+  -0.096158102,  -0.004957375,  0.022737915,  -0.073685870,  -0.129545644,  -0.032111987,  0.217700660,  0.082894802,
+  0.050470341,  0.343093038,  -0.025637001,  0.087549627,  -0.124256976,  -0.068934619,  0.056813702,  0.161900923,
+  0.225579679,  -0.019926390,  0.206106201,  -0.029723480,  0.035062429,  0.020294035,  -0.042373307,  -0.123298526,
+  0.191507563,  -0.094428331,  -0.054600500,  -0.115611076,  0.157483622,  -0.138635620,  0.259888828,  -0.082159124,
+  -0.070635751,  -0.138472855,  0.298834652,  0.158675224,  0.161258027,  0.001060772,  -0.088776767,  0.104756467,
+  0.298568845,  -0.057073656,  0.024296913,  -0.094974279,  -0.073120698,  -0.073956400,  -0.056967061,  -0.105213374,
+  0.382394254,  -0.120498642,  0.152572334,  0.080452748,  -0.038841054,  0.083160676,  -0.024860458,  0.095934168,
+  0.130111307,  -0.025912983,  -0.111122072,  0.265360862,  -0.004130957,  -0.078072533,  -0.009508465,  0.273985595,
+  -0.143314898,  0.232348710,  0.008950171,  -0.050112344,  -0.065149315,  -0.037024938,  -0.127901807,  0.010791970,
+  0.040871680,  -0.054022230,  0.192574650,  0.052696358,  -0.042059887,  0.024009611,  -0.078985319,  0.068957292,
+  0.137232140,  0.135958299,  -0.128952205,  0.126041457,  0.072010800,  -0.062957987,  -0.142310202,  0.024095848,
+  -0.028409386,  -0.093516275,  0.049970508,  0.026549056,  0.103708938,  -0.098393306,  -0.034661137,  -0.108663522,
+  0.085659228,  0.096692935,  -0.097565055,  -0.015549630,  -0.083054088,  -0.087928839,  0.252771854,  -0.105538100,
+  0.049937777,  -0.022054125,  -0.039497655,  0.202495232,  -0.234702066,  0.071435846,  0.045174427,  -0.106471851,
+  -0.047819592,  -0.143543646,  -0.119711928,  -0.116614327,  0.224179998,  -0.067809746,  -0.136064738,  0.198206007,
+  0.112691447,  -0.084941924,  -0.003513522,  0.051947221,  -0.098701827,  -0.125767320,  -0.072880760,  -0.066932179,
+  -0.129276201,  0.241762072,  0.093825698,  0.145408913,  -0.089464501,  -0.114232570,  0.292227745,  -0.176713020,
+  -0.040233556,  -0.151481092,  0.203240767,  0.175281554,  -0.105616353,  -0.144489616,  -0.128300771,  0.146151155,
+  -0.041831277,  -0.070050023,  0.200762406,  -0.069043934,  0.320810705,  0.033523779,  -0.090794571,  -0.128731012,
+  -0.105726495,  -0.065168925,  0.192491069,  -0.002940980,  -0.075242251,  -0.130635098,  -0.196960598,  0.029731575,
+  -0.032294504,  0.032353040,  -0.009783578,  0.028393349,  0.047413785,  0.251950443,  -0.144415006,  -0.009387753,
+  0.116000161,  -0.008750434,  0.133138850,  -0.145270735,  -0.267114818,  -0.130244985,  0.182510048,  -0.203292593,
+  -0.107807927,  0.007757740,  0.253574818,  0.205579638,  0.183141068,  -0.077927068,  0.090628363,  -0.025430279,
+  0.237251252,  -0.047777101,  -0.122514471,  -0.076272123,  -0.117146112,  0.334674150,  -0.111493051,  0.060407002,
+  0.047829706,  -0.157206565,  -0.131666362,  -0.114961758,  0.005790771,  0.387735635,  0.160013884,  -0.122135952,
+  0.057714049,  -0.037374482,  0.247860298,  -0.113874421,  0.241100952,  0.214793295,  -0.094271310,  -0.161878243,
+  0.321382493,  -0.092642412,  -0.065842032,  0.154754385,  -0.029526513,  -0.114853486,  -0.015924310,  -0.078021027,
+  -0.087000266,  0.177340135,  -0.010014525,  -0.126628622,  -0.003438977,  -0.028025882,  -0.072898813,  0.112678014,
+  0.028629748,  0.172410563,  0.171157777,  0.090204842,  -0.030359717,  -0.106155843,  0.122401781,  0.093571834,
+  0.258717984,  -0.049915060,  -0.002849726,  0.214953944,  -0.064863287,  0.127917543,  -0.003595286,  0.001324265,
+  0.039477676,  -0.125424087,  0.144389376,  -0.091925353,  -0.068347603,  -0.083167233,  -0.005459489,  -0.122655109,
+  -0.137147382,  0.126802981,  -0.095637910,  0.143489853,  -0.103502907,  0.245913997,  0.118833058,  -0.119616129,
+  -0.071879156,  -0.023891971,  -0.128121197,  -0.130825192,  -0.093486466,  -0.087079637,  0.136341169,  -0.048603281,
+  0.040583361,  -0.023495838,  -0.056900337,  -0.149852738,  -0.043194883,  0.023000000,  -0.115774289,  -0.018262381,
+  -0.166425794,  -0.111423209,  0.213863730,  -0.117231503,  -0.096519470,  0.152700499,  -0.029807566,  0.202571899,
+  0.155910820,  -0.220370859,  -0.019479115,  0.083855793,  0.158629000,  0.076032259,  -0.037183948,  0.183339804,
+  0.058312822,  0.078692056,  0.096440628,  0.176625893,  -0.005628916,  0.042120703,  0.160501242,  -0.054209642,
+  0.086419411,  0.011469105,  0.277777225,  0.000073825,  0.002171438,  0.135830730,  -0.174188763,  -0.061889503,
+  -0.071082905,  0.172904804,  -0.017661573,  -0.094130412,  0.068666846,  0.137827933,  -0.060945444,  0.062701449,
+  0.152618915,  -0.120277800,  0.212255552,  0.140660837,  0.137809962,  -0.115882710,  0.298900336,  -0.141235352,
+  -0.107925668,  -0.124872118,  -0.070748955,  0.127306476,  -0.146264970,  0.170012429,  -0.033597082,  -0.103403553,
+  -0.062647335,  -0.049092308,  0.183852702,  0.194062218,  0.050567728,  0.098630831,  0.144803509,  -0.088046782,
+  -0.093645900,  0.015913697,  -0.116990596,  0.026614357,  -0.106915131,  0.052470822,  0.276966333,  -0.058654182,
+  -0.029791512,  -0.050956599,  -0.092437752,  -0.084003672,  0.074522339,  0.096766114,  -0.041637585,  -0.050438341,
+  -0.084326774,  -0.074722335,  -0.086974978,  0.008719145,  -0.110793114,  0.028732304,  -0.016999487,  -0.077632114,
+  0.104540631,  -0.053411830,  -0.065234572,  -0.135443404,  -0.167436466,  -0.046310388,  -0.029893089,  0.039351419,
+  0.015276116,  -0.178334877,  -0.062486224,  0.062243808,  -0.081515893,  0.175802201,  -0.073978201,  -0.077805057,
+  -0.073877342,  -0.117374063,  -0.034725517,  -0.036960207,  0.033135008,  0.009071858,  -0.110725865,  0.114226751,
+  -0.040350538,  -0.044375449,  -0.086385846,  -0.029207196,  0.047707200,  -0.126414150,  0.279146761,  0.080762379,
+  0.089127347,  -0.141520560,  -0.086773261,  0.015088914,  -0.116323531,  -0.057489671,  0.025175489,  -0.010361133,
+  -0.054904051,  -0.107423618,  0.188730225,  0.176511124,  0.033371095,  0.097161293,  -0.105163179,  0.036913734,
+  -0.118794814,  0.087459654,  -0.099546567,  -0.038020119,  0.151177973,  0.035187989,  0.094761305,  -0.111810133,
+  0.016758181,  0.159322008,  -0.094991781,  0.095151164,  0.072358467,  -0.121842183,  0.062586598,  0.047834121,
+  0.096471354,  -0.126842558,  0.131134674,  0.052521825,  0.076044612,  0.158757091,  0.091981493,  -0.014005830,
+  -0.095649444,  0.045256615,  -0.021063562,  -0.082287945,  -0.008691647,  -0.019612463,  0.029465683,  -0.035415895,
+  0.097922951,  0.214583531,  -0.033428192,  0.081829794,  0.159926921,  -0.051813155,  -0.069082588,  -0.082375348,
+  -0.072825402,  0.067501582,  -0.071077749,  0.063220240,  0.058794271,  -0.080957241,  -0.131197587,  -0.112758853,
+  0.047867246,  -0.095101617,  -0.087574996,  -0.008945866,  0.153778091,  -0.078600124,  0.105057590,  0.122624196,
+  -0.133368328,  0.058317874,  0.121942267,  0.002287185,  -0.001849411,  -0.010260586,  -0.035036195,  -0.104029208,
+  -0.095234662,  0.051741615,  -0.047400065,  0.005154893,  0.034506332,  0.017083397,  -0.111427493,  -0.050741542,
+  0.077817850,  0.046811324,  0.178698197,  -0.049311534,  -0.066705354,  -0.009108988,  0.077791475,  -0.115778640,
+  0.012573898,  0.037102923,  0.019436333,  -0.051884465,  0.182305440,  -0.113357976,  -0.093168624,  0.032681454,
+  0.040389944,  0.022733908,  0.084910654,  -0.084388770,  0.099704452,  -0.084199443,  -0.196155176,  0.033417270,
+  0.130501166,  -0.143235534,  0.026905766,  -0.073286086,  -0.001601450,  -0.036129858,  -0.004350425,  -0.138830692,
+  0.042297915,  0.062602252,  -0.073781624,  -0.129993215,  0.065335855,  -0.109329924,  0.207046479,  0.037651602,
+  0.051332921,  -0.093167782,  -0.017900316,  0.090703398,  -0.040856916,  -0.059458658,  0.171034321,  -0.014250546,
+  0.032332480,  0.068923153,  0.021849750,  0.004465207,  -0.083448209,  0.153157368,  -0.083805792,  -0.150613204,
+  -0.123326376,  -0.085481837,  -0.021032386,  -0.104137242,  0.154204682,  -0.028436204,  0.049968053,  0.095558673,
+  -0.067823723,  -0.107008874,  -0.030170785,  0.037978664,  0.161230311,  0.143559635,  -0.125257581,  0.106647335,
+  0.018513180,  0.031205628,  0.078064710,  0.020861367,  0.104262538,  -0.100013196,  0.065460049,  -0.081849791,
+  0.028742304,  -0.003741622,  -0.124321558,  -0.091021329,  0.078262091,  -0.142784655,  0.108992398,  -0.101222657,
+  0.202671409,  -0.046618704,  0.114453264,  0.151209056,  0.011683113,  -0.121059269,  -0.114712618,  -0.061298646,
+  -0.092993639,  -0.131464392,  -0.138471916,  0.051110294,  -0.050129890,  -0.128057405,  -0.055251129,  -0.064021453,
+  0.063551895,  -0.113371089,  0.047779474,  0.055575576,  -0.039532274,  0.020717461,  -0.035565186,  -0.118657790,
+  -0.104778290,  -0.131403074,  -0.086656980,  0.070650801,  0.113131456,  0.059422832,  -0.161842152,  -0.120910041,
+  -0.028670421,  -0.053007051,  -0.151542187,  -0.028607583,  0.098863788,  -0.141454041,  -0.059606299,  0.113011479,
+  -0.040565595,  -0.017543050,  0.066030338,  0.196779892,  -0.135391027,  -0.136392862,  0.022805583,  -0.060747355,
+  0.104739681,  0.081647530,  -0.084324658,  0.112717159,  -0.274675995,  0.116103835,  -0.091666013,  -0.124121435,
+  -0.108102068,  -0.288089126,  0.017194320,  0.123536907,  0.068158701,  -0.010185378,  0.007343660,  -0.033173222,
+  -0.062147602,  0.193961263,  0.004652485,  -0.210672140,  -0.086888425,  -0.050584376,  -0.074132070,  0.026702279,
+  0.050829377,  0.004545213,  0.087630183,  -0.070798129,  0.226133257,  -0.101166189,  -0.002274754,  0.087013043,
+  -0.110356733,  -0.067846045,  -0.102006465,  -0.119611114,  -0.044741634,  0.154298201,  -0.083796665,  -0.068449721,
+  -0.137492657,  -0.044862397,  0.187633961,  -0.116784491,  -0.113690451,  0.041877680,  -0.117708132,  -0.048838548,
+  0.033083443,  0.002209932,  -0.006443809,  -0.012354868,  -0.053322311,  0.062340748,  0.011230937,  0.075944543,
+  -0.085676380,  0.023195455,  -0.004704266,  -0.028592139,  0.113655902,  0.023691466,  0.124050654,  -0.004770817,
+  -0.143595725,  -0.065809563,  -0.085906520,  0.048041653,  -0.305937737,  -0.088697344,  0.059153225,  -0.345151007,
+  -0.052005053,  0.038151279,  -0.134995461,  0.132488757,  0.014915670,  -0.016604051,  0.062784053,  0.030247085,
+  0.004490809,  -0.057760023,  0.108470418,  -0.088619843,  0.088211283,  0.144921511,  0.122267447,  0.192972392,
+  -0.125054389,  -0.202309951,  -0.095531449,  0.058161173,  0.048564713,  0.006257998,  0.092882387,  -0.035676174,
+  -0.064357087,  -0.012957134,  -0.020333489,  -0.096183158,  -0.102150649,  0.035869237,  -0.105475731,  0.112668224,
+  -0.044431943,  -0.058993891,  -0.064382508,  -0.091394745,  -0.135825112,  0.158040628,  -0.041479908,  0.016685570,
+  0.088107049,  0.009036688,  -0.009008612,  -0.031920951,  0.109713152,  -0.016534967,  0.000104426,  -0.013949466,
+  -0.184376791,  0.024229579,  0.168747127,  0.125552595,  0.028909860,  0.171833545,  -0.035889514,  0.013088939,
+  0.006131116,  0.075787507,  0.000979799,  0.136182711,  0.137449235,  0.250837564,  0.023271861,  0.041995980,
+  0.061477993,  -0.144703791,  0.049692284,  0.042636514,  -0.027392402,  -0.114692837,  -0.136325032,  0.050527044,
+  -0.096428871,  -0.107341558,  0.175817087,  -0.113861382,  0.107865855,  0.044049233,  -0.054137252,  -0.037969451,
+  0.096216023,  -0.006989663,  -0.134643525,  -0.027803451,  -0.127329350,  -0.198039487,  -0.021237550,  -0.003861342,
+  0.030332096,  -0.005458245,  -0.004441225,  0.072937787,  -0.116203733,  0.200539276,  -0.109429970,  0.098676592,
+  0.031949922,  -0.134975404,  0.074440427,  -0.066828884,  -0.064191416,  -0.117147550,  0.099162795,  0.061233923,
+  0.086053237,  -0.240687251,  -0.122197598,  -0.049833670,  0.074424542,  -0.173571691,  -0.056229256,  -0.080814756,
+  -0.011264999,  0.010885836,  -0.103692368,  -0.054608040,  0.184376061,  -0.082231939,  0.032063521,  -0.078536227,
+  -0.087891147,  -0.130347475,  -0.034516707,  -0.031769533,  -0.017470436,  0.017086774,  0.006511768,  -0.112815551,
+  -0.061022833,  0.189917997,  -0.024983145,  -0.125828996,  -0.040539283,  -0.016250536,  0.031811815,  -0.079925902,
+  0.224272758,  0.147360086,  0.158915445,  0.101820625,  0.114022680,  0.158490911,  -0.022805763,  -0.054083519,
+  0.104512841,  -0.084576271,  -0.069768935,  0.178502589,  0.065894693,  0.097114474,  0.074608572,  -0.038216010,
+  0.144051984,  0.050266519,  -0.036509003,  0.086800262,  -0.032126229,  0.192796007,  0.168227807,  -0.111597002,
+  -0.033998013,  -0.066217981,  -0.075239234,  0.042924795,  0.086143620,  0.058191340,  0.062688999,  0.056048550,
+  0.041145995,  -0.103532135,  0.041109983,  0.047518127,  -0.155874625,  -0.112016261,  -0.027454022,  0.088844940,
+  -0.086883232,  0.105400071,  0.164103687,  -0.086483404,  -0.141107902,  -0.083216608,  -0.191218093,  0.109249115,
+  -0.128951028,  -0.005405159,  -0.061199326,  -0.103295445,  -0.159702927,  -0.066728041,  0.150588676,  -0.083255425,
+  -0.002636751,  0.055268306,  -0.108555846,  -0.113829382,  0.103589632,  0.052731145,  0.030087572,  -0.027879249,
+  0.016173007,  -0.100431219,  -0.128812298,  -0.173440322,  0.033879999,  -0.033568170,  -0.137084693,  -0.008929183,
+  -0.033446983,  0.049608152,  -0.134146705,  0.020434063,  0.000678299,  0.099999800,  0.003003419,  -0.111884169,
+  -0.024385579,  0.033037327,  -0.097101644,  -0.130127296,  -0.028569359,  0.040573340,  -0.059875645,  -0.116262682,
+  0.062385611,  0.002562070,  0.191736057,  0.169291571,  -0.114753857,  -0.126576230,  0.036036838,  -0.132524803,
+  0.109627254,  -0.080090642,  0.199285954,  0.116515025,  -0.132767498,  0.077866167,  0.045773175,  -0.185547650,
+  0.066492088,  0.161864772,  -0.003496427,  -0.018927786,  -0.167262912,  -0.117416129,  -0.079214148,  -0.029017625,
+  0.120269954,  -0.041258521,  0.234037817,  -0.134305626,  0.045649078,  0.146281868,  0.097374283,  -0.015994975,
+  -0.058436293,  -0.249201551,  -0.016143514,  0.102953471,  0.121892639,  -0.022695469,  0.074289463,  -0.035631835,
+  -0.046860673,  0.017779415,  -0.043428831,  0.148538917,  -0.069938540,  -0.035557091,  0.066938803,  -0.090347730,
+  -0.037553955,  0.066336103,  0.166904896,  0.011064027,  0.038364585,  0.081636429,  -0.007950340,  0.185595140,
+  0.002683690,  0.117369629,  0.136646569,  0.075562529,  -0.070592441,  -0.189426601,  0.107085377,  0.115064271,
+  -0.136845335,  0.076343350,  -0.055658109,  0.250337988,  -0.069021739,  0.145755425,  -0.128993466,  -0.036881752,
+  -0.027487986,  0.119893610,  0.058554664,  0.158022508,  0.061793022,  0.074791655,  0.056322023,  0.133903772,
+  -0.025004445,  -0.061415359,  0.033221744,  0.057554629,  -0.057627417,  0.143582523,  -0.067577623,  -0.106142841,
+  0.160019949,  0.034688804,  0.100885093,  0.016154129,  0.154477894,  -0.054502837,  0.024264470,  0.041257288,
+  -0.092464924,  -0.041986391,  -0.211951599,  0.158706322,  -0.107665427,  0.174948439,  0.033176929,  0.060574286,
+  -0.117571831,  -0.089571536,  0.156354412,  -0.134445846,  -0.061304606,  0.008944539,  -0.021871779,  -0.058585659,
+  0.139133856,  -0.008551180,  -0.032828361,  -0.108371720,  0.236368284,  -0.153557420,  0.219298124,  0.059086133,
+  -0.144684508,  -0.032250151,  -0.063924521,  -0.157508731,  -0.111961372,  0.029697800,  0.079643741,  0.034973804,
+  0.024731718,  -0.110014476,  0.047517315,  -0.053084780,  -0.028173834,  -0.099796668,  0.048649430,  0.036571842,
+  0.058539610,  -0.074839257,  0.039884277,  0.014010713,  0.115989111,  0.045428634,  -0.049744479,  -0.017650880,
+  -0.013415501,  0.060507435,  -0.105577990,  0.040545706,  -0.081624933,  -0.034085367,  0.237341195,  -0.039591767,
+  -0.112572148,  0.109016724,  -0.084841251,  -0.000943474,  0.016276773,  0.025923463,  0.057991136,  -0.078362830,
+  0.078222290,  -0.052862421,  -0.012510179,  -0.034069534,  0.077597640,  -0.143200457,  -0.021235501,  0.027650695,
+  0.156307593,  0.083705969,  0.111762501,  0.150944099,  -0.013660831,  -0.119191989,  0.161765143,  -0.006117665,
+  0.006232341,  0.052433848,  -0.064850658,  -0.018190583,  0.057470612,  -0.056189094,  0.075858504,  -0.092771307,
+  0.028907463,  -0.135281816,  0.010299139,  -0.145811826,  0.085931107,  -0.307285666,  -0.061385266,  0.164351970,
+  0.098519363,  0.036338028,  0.047493819,  0.012873237,  -0.135014758,  -0.033085313,  -0.198541179,  -0.006699845,
+  -0.008564924,  0.070294216,  0.075108327,  -0.157103509,  0.056168426,  -0.058230698,  0.001668751,  -0.144157976,
+  0.142342210,  -0.078750394,  0.054108072,  -0.111526564,  -0.013930747,  0.111608520,  -0.122670136,  0.065337107,
+  0.033146095,  -0.140265733,  -0.109829515,  0.062739126,  0.023683518,  0.123134509,  -0.114021614,  -0.026877686,
+  0.051569141,  0.045098327,  0.111774176,  -0.032955125,  -0.056641780,  -0.001954203,  0.116145328,  -0.121864185,
+  -0.075620279,  -0.051010534,  0.134675145,  0.123651974,  0.038079478,  -0.083063841,  0.181986272,  0.129597783,
+  -0.033811342,  0.043155223,  -0.041347019,  -0.074596964,  -0.127602220,  0.115621001,  -0.115406670,  0.026453111,
+  -0.106505357,  -0.142299712,  0.043570653,  -0.004789464,  -0.046457455,  0.127865896,  0.123191714,  -0.042516671,
+  0.011643015,  0.013974883,  0.035294361,  -0.076768503,  -0.005674665,  0.096971817,  -0.142501771,  -0.050631978,
+  -0.096204802,  -0.122925170,  -0.044581804,  -0.135197759,  0.191667154,  -0.142763406,  -0.095482104,  -0.131239429,
+  0.112770788,  -0.121289998,  -0.056998871,  0.021302620,  0.068226904,  -0.061478931,  0.144146264,  0.060370173,
+  0.045725215,  0.026310705,  0.076263011,  -0.109356031,  -0.176421523,  -0.138388067,  -0.038746275,  -0.012872584,
+  0.113458902,  0.043874878,  -0.020675225,  -0.000715693,  0.015703743,  -0.089409277,  -0.040450573,  0.048530757,
+  -0.044980764,  0.017489484,  -0.061651304,  -0.032054920,  -0.132688254,  -0.033906735,  0.156254306,  0.081816003,
+  0.155572668,  -0.118847631,  -0.080441594,  0.080036961,  -0.127882019,  -0.009736600,  -0.097061619,  -0.087938190,
+  0.093489282,  -0.064540543,  0.203074098,  -0.061032955,  0.199992269,  0.039803844,  0.077116713,  -0.079368263,
+  -0.060688660,  -0.043653317,  -0.099354193,  0.073629737,  -0.105599478,  -0.137985647,  0.094549559,  -0.075613625,
+  -0.079240166,  -0.027143227,  0.065790676,  -0.089663327,  0.115209855,  -0.033790931,  -0.015919657,  0.082333408,
+  -0.118020669,  -0.112691253,  0.058070995,  -0.151021913,  -0.053013802,  0.125401452,  -0.087344259,  0.060703177,
+  -0.020274725,  -0.153984413,  -0.102614425,  -0.006682411,  -0.054568082,  0.161358267,  0.034276471,  -0.230006978,
+  0.061441515,  -0.093229115,  -0.106086910,  -0.028360866,  0.127227798,  -0.135272995,  -0.191131577,  -0.194624037,
+  -0.120200239,  -0.106416672,  0.036338519,  -0.077786617,  0.139156386,  0.059363678,  -0.096231580,  -0.013475502,
+  -0.047887992,  0.053166825,  0.060259007,  -0.089084171,  0.131394878,  0.052962337,  -0.021415144,  -0.142707303,
+  0.059113156,  0.011570727,  -0.016363606,  -0.074888237,  -0.062174305,  -0.116645977,  0.031539168,  0.162768766,
+  -0.141543880,  0.074891374,  -0.130685434,  -0.132437378,  -0.035620537,  0.121533252,  -0.073039360,  -0.113994509,
+  -0.099557735,  -0.146574989,  -0.022864748,  0.067945853,  -0.016947215,  -0.169775799,  -0.036073774,  -0.122552872,
+  -0.071302369,  0.012980086,  -0.032461438,  -0.083232000,  -0.011775734,  0.044852417,  0.076094672,  -0.107772805,
+  -0.076165557,  -0.119892798,  0.095488198,  -0.136020213,  -0.096263200,  0.130642131,  -0.104078330,  -0.085401528,
+  0.000215227,  -0.113612026,  0.056967445,  -0.050934475,  -0.079045407,  0.080684140,  -0.029058693,  -0.073360451,
+  0.121770658,  0.177681670,  0.133973986,  0.130028367,  -0.108903319,  0.079413556,  0.015249008,  -0.051036514,
+  -0.081131406,  0.107298896,  0.152557865,  -0.017864861,  -0.083329186,  0.073748112,  -0.115306556,  -0.035070688,
+  0.088937454,  0.053034939,  -0.063171394,  -0.188353300,  0.088201165,  -0.168739855,  -0.028074350,  0.173506916,
+  -0.076584294,  -0.081947058,  0.116929643,  0.038066655,  -0.131718740,  -0.099075012,  -0.050578356,  -0.155002624,
+  -0.140076533,  0.188160449,  -0.123025849,  0.054925893,  -0.163565978,  0.107601881,  -0.094683386,  -0.103785500,
+  0.058817599,  -0.074178040,  -0.020458112,  -0.002032133,  -0.085995495,  -0.030836657,  -0.020728042,  -0.035365991,
+  0.011634716,  0.023192110,  0.086294062,  -0.126712725,  -0.197392568,  0.048325237,  -0.095760085,  -0.098108336,
+  0.079987459,  -0.122973174,  -0.117804237,  -0.015944749,  -0.068800397,  0.118758589,  -0.102110490,  -0.096797593,
+  -0.005183340,  0.051593177,  0.039376508,  -0.181354478,  0.053773750,  0.008063064,  0.005793970,  -0.112502657,
+  0.049845416,  0.048547503,  -0.132206544,  -0.100801751,  -0.114650972,  -0.065114811,  0.013013855,  0.073322579,
+  -0.143444344,  0.164209992,  0.081001058,  -0.093300164,  -0.080719829,  -0.025291547,  -0.030490402,  0.067216635,
+  0.152221888,  0.108513616,  0.006846713,  -0.134483993,  -0.023113625,  0.011524001,  0.020510407,  -0.040099286,
+  0.084754057,  0.079241283,  -0.055199243,  -0.060507804,  -0.062564656,  -0.071622662,  -0.197001219,  -0.161676258,
+  -0.036963675,  0.080541432,  0.057943314,  0.036248781,  0.061712589,  -0.111358404,  -0.029100314,  0.038655203,
+  0.119604453,  0.108471431,  0.017383832,  -0.170644358,  0.095191255,  0.149771601,  0.079362050,  -0.211653471,
+  -0.000902072,  -0.223321393,  0.176300764,  -0.031011498,  0.023837775,  -0.022543600,  0.103350192,  0.002379266,
+  0.126118869,  0.061747208,  -0.093131632,  0.032219429,  -0.120745935,  -0.039422508,  0.095418602,  0.111006193,
+  -0.024621865,  -0.160508394,  0.153779998,  -0.128016829,  0.024305688,  -0.005615547,  -0.050248057,  -0.123634256,
+  0.115912795,  0.111670189,  -0.018440729,  0.092094585,  -0.008001707,  -0.094993301,  -0.099628791,  -0.007187551,
+  -0.140358433,  -0.035244543,  -0.072297059,  -0.143189535,  0.134567499,  0.079328924,  0.028400933,  0.153912023,
+  0.036398184,  0.095656835,  -0.170117319,  -0.064319476,  0.099410437,  0.043748263,  0.233936727,  0.244326711,
+  0.037377983,  -0.048982874,  -0.004676076,  -0.169935659,  -0.021163067,  -0.021041686,  -0.121516690,  -0.053622212,
+  0.283143669,  0.046992552,  0.109531194,  -0.004660413,  0.063039571,  -0.054879114,  0.150098726,  0.076556355,
+  0.057474591,  0.140519023,  -0.008947891,  -0.125288025,  -0.098229244,  0.088845789,  0.124806911,  -0.218357325,
+  -0.028562270,  0.129576340,  -0.072298244,  0.176559150,  0.084767312,  0.106827848,  0.056282114,  -0.136545211,
+  -0.082109690,  -0.012652312,  0.152589396,  -0.089494899,  -0.037555799,  0.130381495,  -0.120012917,  0.023574967,
+  0.069556125,  -0.009880945,  0.004740373,  0.085272998,  0.115340143,  0.000056323,  0.004341364,  0.104923442,
+  -0.223434567,  0.012361758,  0.104332842,  -0.092900962,  -0.059893079,  0.162227854,  -0.237385839,  -0.208165884,
+  0.181476802,  0.194149360,  -0.053860061,  0.068803646,  -0.090707116,  -0.148297310,  -0.045431919,  -0.017561786,
+  -0.074214749,  0.008788206,  -0.041715391,  -0.088306054,  -0.068223551,  -0.085168749,  0.040807553,  0.053376470,
+  0.013923551,  -0.137855679,  -0.014387265,  0.045469288,  -0.036506623,  0.029491544,  -0.144750923,  -0.008621405,
+  -0.070446938,  0.166940108,  0.121067829,  0.104271650,  -0.121821776,  0.057879671,  -0.038282976,  0.270511597,
+  -0.011897854,  0.102803230,  0.023794996,  0.085472643,  -0.123356268,  0.055666886,  -0.028396606,  0.216656461,
+  0.087312974,  -0.121682324,  0.124487460,  0.077407844,  0.068212450,  -0.123547152,  -0.036471061,  -0.045556501,
+  0.085830040,  -0.087236539,  0.137869239,  0.070142537,  0.046809595,  0.025084706,  -0.033253711,  -0.099052563,
+  -0.053124987,  0.154979095,  0.080116332,  0.037044186,  -0.028118312,  -0.137846142,  0.030442689,  0.029604357,
+  -0.013691759,  0.000284512,  -0.109163143,  -0.182004422,  -0.152667150,  0.732834101,  -0.091204122,  -0.113460332,
+  -0.079012297,  0.556399286,  -0.078015894,  0.031211149,  0.649036646,  0.912281036,  0.285039008,  0.889960051,
+  0.706988811,  -0.103441313,  -0.063222922,  0.485343874,  0.382743686,  -0.144897893,  -0.078598738,  0.026509827,
+  -0.096258834,  0.314003617,  0.806207538,  -0.057377063,  -0.050262164,  -0.048411392,  -0.024682114,  -0.069212690,
+  -0.038995855,  -0.100662887,  -0.100186780,  1.112589598,  0.394034177,  -0.025772292,  -0.055003431,  0.604378581,
+  -0.085064068,  0.490079701,  0.269251615,  -0.039295860,  0.327761769,  0.061518759,  -0.059106492,  1.145325422,
+  0.021752860,  -0.120396301,  -0.040661160,  0.594756484,  0.034705061,  0.105338201,  -0.140021533,  -0.072551325,
+  -0.082484476,  -0.079181492,  -0.038897339,  -0.044288501,  -0.061308742,  0.983622372,  0.002219375,  0.325076818,
+  -0.088961288,  -0.090289772,  0.422194690,  -0.100779742,  -0.136558935,  -0.125564635,  -0.171604082,  -0.157468170,
+  0.461746454,  -0.074692771,  0.135398433,  -0.074477516,  0.027000921,  -0.023272058,  -0.103725687,  1.352424860,
+  -0.049676232,  0.485711932,  -0.056863572,  -0.155607209,  -0.155216709,  -0.052097362,  -0.114203304,  0.367130339,
+  -0.069217674,  0.110882685,  0.012500352,  -0.023328708,  -0.068142109,  -0.017694740,  -0.034731817,  0.740790486,
+  -0.133044764,  -0.037759595,  -0.029951505,  -0.056174535,  -0.076525442,  -0.104986131,  -0.094987281,  1.195019722,
+  1.020926237,  -0.142060071,  -0.054163963,  0.322150260,  -0.087951288,  0.490162104,  0.298649281,  -0.056282781,
+  0.584417224,  -0.119370937,  -0.115041777,  -0.060529571,  -0.057104286,  -0.161640316,  -0.010461310,  -0.092002727,
+  -0.042259272,  -0.130142972,  -0.141487539,  -0.066291884,  0.484357387,  -0.100359514,  0.728380203,  -0.074142985,
+  -0.025235431,  -0.059068270,  0.868947268,  -0.028079353,  -0.115335062,  -0.142950252,  -0.074192472,  0.699294031,
+  -0.153718457,  -0.044020094,  -0.053136375,  -0.167219177,  -0.027358619,  0.201352730,  0.178828433,  1.055288672,
+  0.361861318,  -0.070051871,  -0.071033932,  -0.075898960,  -0.027245689,  0.391694695,  0.919377208,  -0.251253963,
+  -0.136057302,  0.673560798,  -0.192272648,  -0.123471051,  -0.104517043,  -0.075388044,  0.066314220,  -0.204863936,
+  -0.031736564,  -0.075518198,  -0.090181708,  0.152007043,  -0.078766860,  -0.095466286,  -0.039290771,  0.536695361,
+  -0.045355238,  -0.128871456,  0.883098543,  -0.066552818,  -0.087670028,  0.632096291,  -0.091132805,  0.026999651,
+  0.841031075,  -0.092704922,  0.035323571,  -0.138431013,  -0.082733303,  -0.031549204,  -0.092858128,  -0.015903458,
+  -0.207595810,  -0.112985857,  0.033803757,  0.089462310,  -0.078798786,  -0.052957684,  0.355939686,  0.322328717,
+  -0.044404745,  -0.180457354,  0.609831274,  -0.136431873,  -0.045046199,  -0.145374596,  -0.070719533,  -0.067127146,
+  -0.060122289,  0.636690080,  -0.084850006,  -0.037901148,  -0.025941454,  0.677058041,  -0.063999206,  0.062598825,
+  -0.090814739,  0.827892184,  0.145110175,  -0.082015961,  -0.067082070,  0.203723684,  0.095716372,  -0.094957367,
+  -0.048113577,  -0.062438741,  0.138422444,  -0.135812312,  -0.064066499,  1.159841657,  -0.100853384,  -0.068461463,
+  -0.109304085,  -0.090690129,  -0.102214679,  -0.074922904,  -0.034277394,  -0.130037650,  0.422349930,  -0.066769697,
+  -0.097391978,  -0.144380271,  -0.137206495,  -0.061222263,  -0.075324781,  -0.066501111,  0.143548399,  -0.072975367,
+  -0.044010691,  -0.047883656,  -0.063653022,  0.398503810,  -0.112271145,  -0.259477794,  -0.017827334,  -0.093717888,
+  -0.021888874,  -0.109157816,  -0.055150848,  0.380406976,  0.735594988,  -0.182322189,  -0.168267474,  -0.118913747,
+  -0.137578070,  -0.094407707,  -0.013319520,  0.133546323,  0.019885320,  -0.067336574,  -0.063787639,  -0.106435284,
+  0.040573746,  -0.010194514,  -0.111752704,  0.054821372,  -0.033857085,  -0.061899744,  -0.077216186,  -0.090541519,
+  0.093072280,  -0.036710028,  -0.077893928,  0.009614776,  0.016024109,  -0.075061731,  0.110645644,  -0.108784586,
+  0.051436033,  0.028734492,  0.065112263,  0.028739713,  0.158250287,  -0.110520385,  0.158007473,  -0.075281851,
+  -0.038721710,  0.138803452,  -0.056960046,  0.039124340,  0.042789113,  -0.081314936,  -0.074925810,  -0.114940450,
+  -0.113461532,  -0.044687271,  -0.082940444,  -0.096368015,  0.101804227,  0.057376292,  0.040180892,  -0.006461966,
+  -0.009662144,  0.010127239,  0.029126346,  -0.007609996,  -0.006503462,  -0.081526510,  -0.112077430,  -0.046532471,
+  -0.095649540,  -0.132254213,  -0.103146970,  0.176890314,  -0.001819432,  0.057193056,  -0.022085914,  -0.018600702,
+  -0.089704633,  0.004367176,  -0.100034297,  -0.001347759,  -0.119568050,  0.069472887,  0.052184109,  -0.146228805,
+  -0.012757781,  0.129144475,  -0.086666092,  0.078828767,  0.109493501,  -0.071376830,  -0.114018224,  0.065703094,
+  0.076640651,  -0.126359105,  -0.015199049,  0.082477815,  0.045758758,  0.083187081,  -0.054501344,  -0.014380691,
+  -0.119706631,  0.048298899,  0.045959260,  -0.131397024,  -0.248624027,  -0.111225918,  -0.026161151,  -0.018756839,
+  -0.057271320,  0.040717274,  0.111744881,  0.109812170,  -0.134792715,  -0.055219658,  -0.124520540,  -0.073794350,
+  -0.030505048,  0.034295615,  -0.043588541,  -0.046745032,  -0.037494037,  -0.009007681,  0.016452292,  -0.105866224,
+  -0.095136650,  0.022499261,  -0.074901320,  0.011410807,  -0.081549339,  -0.070351154,  -0.113872662,  0.050756704,
+  -0.129286066,  0.087240852,  -0.139870077,  0.201953664,  0.006845223,  -0.014279319,  -0.095625952,  -0.086717263,
+  0.017252216,  0.075036280,  -0.149915159,  -0.019094216,  -0.135618389,  0.070966601,  -0.095860571,  -0.067993492,
+  -0.084299438,  0.042550717,  0.150412440,  0.028703600,  0.197860196,  -0.065141313,  -0.142497793,  -0.090238281,
+  -0.036972076,  -0.064853296,  -0.056987658,  0.149658427,  0.104713202,  0.149803042,  -0.180618212,  -0.153293580,
+  0.045319021,  0.001238690,  0.100779057,  -0.063415483,  0.075814649,  0.109743275,  -0.089942783,  -0.188013360,
+  0.032022838,  0.178865448,  0.120410688,  0.011352903,  -0.107586734,  -0.034011051,  0.055218067,  0.005546534,
+  0.123557411,  -0.059778266,  -0.083729930,  -0.125669315,  -0.097705960,  -0.104250975,  -0.008722492,  -0.140933827,
+  -0.056808878,  0.035226360,  0.022197697,  -0.028160764,  -0.064509466,  -0.070881955,  0.138538286,  0.035647336,
+  0.081564575,  -0.012210319,  -0.026107952,  0.024228284,  0.006955640,  -0.091144204,  -0.186358064,  -0.007808647,
+  -0.048658937,  -0.162842527,  -0.019795546,  0.025862820,  0.086920023,  -0.110607371,  -0.087999806,  0.210136354,
+  0.030151328,  -0.273989618,  0.073091589,  -0.127409548,  -0.097417995,  -0.060861312,  0.205360919,  -0.032769110,
+  -0.102449544,  -0.068041734,  -0.072965130,  -0.072964221,  -0.073900953,  0.001742850,  -0.129034981,  0.100712731,
+  0.011468788,  0.038235813,  0.009566173,  0.037137840,  0.076790728,  0.015281816,  0.111070745,  -0.139140233,
+  0.148715869,  0.151155189,  -0.061011866,  -0.138642922,  0.026505215,  0.094398670,  -0.006428068,  0.046857461,
+  0.016394766,  -0.001512235,  -0.127880633,  -0.038021252,  0.036695745,  -0.116202593,  -0.060691841,  -0.092339858,
+  -0.050746121,  0.206511527,  -0.111330494,  -0.114721008,  0.044921584,  -0.034054752,  0.022333058,  -0.047489189,
+  -0.077193514,  -0.010309801,  -0.101339370,  0.003694283,  -0.011246717,  0.011704030,  -0.040056881,  0.062770717,
+  0.104549564,  0.014226707,  0.082808629,  -0.061272770,  0.070600510,  0.028516266,  -0.030201059,  0.235159099,
+  0.182080820,  -0.037088487,  -0.105836540,  -0.119825177,  -0.027277268,  0.028100127,  0.023928063,  -0.035989068,
+  0.186236337,  0.079942636,  0.092810720,  0.037402648,  0.015165894,  0.042988028,  0.076375522,  -0.120928362,
+  0.019348091,  -0.148916736,  0.002630679,  -0.017075591,  -0.055120166,  0.181764260,  -0.144767195,  -0.080014966,
+  -0.029859560,  0.063171774,  -0.083345503,  -0.114597268,  -0.165093437,  -0.126262188,  -0.132321626,  0.003824175,
+  -0.118773088,  0.049064156,  0.043870375,  0.085453779,  -0.005328059,  -0.104545064,  -0.115767300,  -0.118993916,
+  -0.024641052,  0.157180116,  -0.114046730,  -0.140773147,  -0.032419182,  -0.000415257,  0.039206039,  -0.070518143,
+  0.108455524,  0.062980570,  -0.054220490,  -0.133089393,  -0.015549014,  -0.108589187,  -0.096225247,  -0.058381483,
+  -0.129052624,  -0.086409912,  0.075304382,  0.129669115,  -0.116075397,  -0.001817511,  0.051315438,  0.063513048,
+  -0.029234096,  0.152828604,  0.070619710,  0.147146299,  -0.107811749,  0.007016817,  -0.126544639,  -0.075223930,
+  0.080966242,  -0.014960033,  -0.063086875,  0.045508377,  0.047424704,  0.057743590,  -0.003774594,  0.081291161,
+  -0.108314119,  0.048909251,  -0.075665869,  0.073374681,  -0.179526374,  0.060215112,  -0.126441091,  -0.015691491,
+  0.021877037,  -0.064570554,  0.083453998,  0.162297577,  -0.093604378,  -0.065722726,  0.156263798,  -0.091269538,
+  -0.015538942,  0.071088947,  0.112858243,  -0.045606021,  0.074448235,  0.090244167,  -0.003236782,  -0.079400018,
+  0.129691377,  0.063361041,  -0.020772371,  -0.017931091,  -0.092806183,  -0.155810177,  -0.080681674,  -0.041147292,
+  -0.001393805,  -0.137811258,  0.119140856,  -0.018608630,  -0.016045224,  -0.047565557,  -0.083979808,  -0.109079294,
+  -0.100696728,  0.027745023,  -0.024912506,  0.019429047,  0.043476369,  0.045700155,  -0.022674667,  -0.104972295,
+  0.060701087,  -0.030891847,  0.056121688,  -0.052227542,  -0.047852997,  -0.089368761,  0.008850390,  -0.112103067,
+  0.140790999,  -0.081931368,  -0.098657779,  0.017048525,  -0.048331171,  -0.058307074,  0.025028853,  -0.205987334,
+  0.032066584,  0.010281594,  -0.075821288,  0.147779256,  -0.034045652,  0.137762249,  0.040976774,  -0.141825348,
+  -0.132462427,  -0.103283577,  -0.104218230,  0.040168289,  -0.043109465,  0.028926922,  -0.047301084,  -0.078750320,
+  0.139941528,  -0.010235609,  -0.162709281,  -0.102345549,  0.160962194,  0.066206917,  -0.054393623,  -0.094137296,
+  -0.037545275,  -0.011527536,  0.032290157,  -0.021969397,  -0.060620718,  0.172174886,  0.171687067,  0.131164715,
+  -0.135723308,  -0.007176671,  0.029062806,  -0.124213628,  0.018234929,  0.157350376,  -0.145216331,  0.047639858,
+  0.112410322,  0.126938239,  0.039100286,  -0.128575861,  -0.076233581,  -0.141258538,  0.110524401,  -0.137507290,
+  -0.127014726,  0.009824447,  0.249200642,  0.012311446,  -0.029501632,  -0.122060157,  -0.087315373,  0.027930588,
+  0.003560685,  -0.080837369,  -0.038729496,  -0.026250476,  0.190845162,  0.114197075,  0.064627148,  0.154148161,
+  -0.114420861,  -0.070359245,  -0.115012474,  0.087262042,  -0.131129086,  0.003818610,  0.023397516,  -0.024945818,
+  -0.105310068,  0.171910882,  -0.088506564,  -0.105101191,  0.205590025,  0.075780489,  -0.092805207,  0.164659709,
+  -0.102855667,  0.143112227,  -0.078558639,  -0.014178650,  0.069302075,  -0.104059726,  -0.125047684,  -0.094997182,
+  0.047859091,  -0.007000258,  0.000204126,  -0.020622166,  -0.182660952,  0.019040274,  -0.076630235,  -0.052035805,
+  -0.024919391,  0.098400697,  -0.029431317,  -0.006126794,  -0.011139529,  -0.146915361,  0.053154770,  -0.138507724,
+  -0.097113296,  -0.057338804,  -0.040251181,  -0.181699246,  -0.067036182,  -0.108179145,  0.000563704,  0.081157766,
+  0.114330195,  0.069719300,  0.113053270,  -0.002766842,  -0.023543848,  -0.067460954,  0.026294131,  -0.028910100,
+  0.035815626,  -0.016559388,  0.083124496,  0.026166145,  -0.161260396,  0.025354238,  -0.100486949,  0.039941799,
+  0.063298881,  -0.151071385,  -0.089317270,  -0.121807657,  -0.092542648,  -0.044950739,  0.055434894,  -0.116023712,
+  -0.143621698,  -0.095017418,  0.015059928,  -0.161061421,  -0.026842957,  -0.035296544,  -0.076649047,  -0.071884677,
+  -0.056674737,  0.098298110,  0.033784986,  0.092292391,  0.096630558,  0.113684654,  -0.111123800,  0.058771510,
+  -0.027135523,  -0.125313640,  0.194332555,  0.056733947,  -0.028605890,  0.020286229,  0.045560196,  0.152476370,
+  -0.005171997,  0.066742741,  -0.048455775,  -0.048486702,  -0.037791461,  -0.011020502,  0.048620667,  0.038147349,
+  0.223760292,  0.114717349,  0.164280459,  0.033654008,  -0.116717413,  0.019293971,  0.027435983,  -0.080896996,
+  -0.012523828,  0.030322008,  0.066614129,  0.098251455,  -0.093258277,  0.043206960,  0.046051580,  0.061125457,
+  0.027833838,  -0.011147345,  -0.092412636,  -0.138866276,  -0.211196035,  0.130642325,  0.093314357,  0.100799061,
+  -0.108902417,  -0.005621170,  -0.133021802,  0.076336242,  -0.026586926,  -0.014531920,  0.088949017,  -0.043189526,
+  0.236533642,  -0.078727730,  -0.135826394,  -0.133150876,  0.042577378,  -0.069745108,  -0.126522526,  -0.090908326,
+  -0.077346280,  -0.063907541,  0.071212307,  0.041460328,  -0.044754628,  0.015543323,  0.076560639,  0.158839643,
+  0.125508994,  0.108710989,  0.010423508,  -0.022210654,  0.003813630,  -0.102401167,  -0.032680906,  -0.065207981,
+  -0.137266934,  -0.106506616,  0.113150619,  0.081850275,  -0.007154476,  -0.117339574,  -0.066320494,  -0.071715213,
+  0.050792541,  -0.111207858,  0.074308850,  -0.055671923,  0.116024196,  -0.085117832,  0.053637993,  0.018991396,
+  -0.144023702,  0.001294270,  0.164766327,  -0.173780039,  -0.038260855,  -0.024730554,  0.020081375,  0.064737663,
+  -0.095778957,  -0.038243145,  0.080641434,  0.111024417,  0.022474987,  0.063379757,  -0.108279146,  0.003512867,
+  -0.052395884,  -0.141067147,  -0.061681189,  0.133953393,  -0.053716913,  -0.076730311,  -0.139751315,  -0.059025329,
+  -0.124975890,  0.054746702,  -0.075926915,  0.119362056,  0.090394482,  0.044707309,  0.040566217,  0.044418525,
+  -0.067809016,  -0.038596623,  0.007113363,  -0.030711001,  -0.104587615,  -0.129872888,  0.205088541,  0.065907776,
+  0.053121101,  0.041368652,  -0.015716912,  0.068377666,  0.047049150,  0.168995380,  -0.100207813,  -0.138408929,
+  -0.103145629,  0.100159556,  0.042556621,  -0.002288090,  -0.058253214,  -0.038025830,  -0.048342083,  -0.192939311,
+  -0.036311854,  0.011632187,  -0.121179476,  -0.135469109,  -0.057531595,  -0.047048755,  -0.052193683,  0.019022830,
+  0.185795158,  0.085164718,  -0.026713256,  0.108505733,  -0.055585995,  -0.000317591,  -0.068683282,  0.019003820,
+  -0.046785701,  -0.141260430,  -0.123094425,  0.002179922,  -0.095696591,  0.056153741,  0.071896985,  0.150976807,
+  0.032499574,  -0.049057487,  -0.047095701,  0.055091556,  -0.045590825,  -0.077611312,  -0.064151548,  -0.126517519,
+  0.146300867,  -0.101725899,  -0.050279260,  0.141480729,  0.056361943,  -0.056754239,  0.039123803,  0.176441029,
+  0.056498669,  0.149545878,  -0.064599164,  0.083833814,  -0.100778036,  -0.086807542,  -0.030818388,  0.040324211,
+  -0.067076229,  0.063246474,  -0.046559397,  0.017566044,  0.087843075,  -0.027485203,  0.114770815,  0.015709225,
+  -0.010638281,  -0.023820486,  0.124176189,  0.100677818,  -0.033277743,  0.013486369,  0.054782405,  0.026180184,
+  -0.030588608,  0.117976464,  0.012505670,  -0.238755673,  0.083165132,  -0.155969396,  0.202373952,  -0.100077122,
+  0.143155262,  -0.041492455,  0.112530507,  0.034688625,  0.020616407,  -0.122785293,  -0.143796906,  -0.033757485,
+  0.077554248,  -0.155962035,  0.077482879,  -0.008533576,  0.037498523,  0.043114889,  0.150949389,  -0.010063006,
+  -0.048135210,  0.062487114,  0.007741706,  -0.018501749,  -0.006987073,  -0.142296091,  -0.096010491,  -0.083535910,
+  -0.029404471,  0.042273521,  0.148394346,  0.078124292,  -0.191815451,  0.196546674,  0.125911921,  0.003868844,
+  -0.092472419,  -0.038219310,  -0.036226045,  -0.077042773,  0.058380764,  -0.069538459,  0.086323649,  -0.011823099,
+  -0.136631802,  0.013100263,  0.048541378,  -0.051662184,  0.030292353,  -0.029019676,  0.049070589,  0.176039666,
+  0.090584204,  -0.064068131,  -0.013334460,  -0.048340075,  -0.056409381,  -0.001560459,  0.184430465,  0.160568491,
+  0.045326512,  -0.015793368,  -0.089135088,  0.078315854,  0.130841494,  -0.119790345,  0.058871787,  0.090879731,
+  -0.126914755,  0.101126947,  -0.076017812,  -0.144330308,  -0.139711931,  -0.102719471,  -0.112134859,  -0.203588113,
+  0.047683399,  -0.069801748,  -0.074354053,  -0.052136716,  0.108985119,  -0.081771709,  -0.065010004,  -0.004823548,
+  -0.136638328,  -0.145022973,  -0.003780477,  -0.045479879,  -0.168157458,  -0.073408477,  -0.056365184,  -0.134322196,
+  -0.033382252,  0.080912068,  -0.129837692,  0.049557362,  0.109825231,  -0.024180673,  0.247804686,  -0.001616387,
+  -0.117324568,  -0.188205153,  -0.089348115,  -0.118669935,  -0.175692707,  0.054617833,  0.088379599,  -0.068239085,
+  -0.041886810,  -0.129244506,  -0.074866071,  -0.067024164,  0.085949048,  -0.034336280,  -0.046381347,  0.025963714,
+  0.080330908,  -0.106486067,  -0.073257446,  -0.088190205,  -0.041057017,  0.044324100,  0.145872444,  -0.122130275,
+  -0.084124513,  0.113409519,  0.047760949,  0.166985065,  -0.001349967,  -0.100435510,  0.072103880,  -0.104085937,
+  -0.093297578,  0.057096168,  0.059871800,  0.062657580,  -0.030784076,  -0.100638568,  -0.042040564,  -0.152415127,
+  0.003725393,  0.049938761,  -0.144877985,  -0.035701878,  -0.034878001,  -0.064758457,  0.030797353,  -0.214941785,
+  0.056005713,  0.044937231,  -0.079051152,  0.015203174,  0.001061818,  0.152839869,  0.166237190,  0.044008680,
+  -0.121022217,  0.163703755,  0.018373994,  0.101610042,  0.137127310,  0.062172476,  -0.120217226,  -0.045738257,
+  0.175237402,  0.006523822,  0.016978381,  0.151173815,  0.204923719,  -0.179480627,  0.051442340,  -0.006178923,
+  -0.027522845,  -0.014859080,  -0.045958206,  0.080941014,  -0.118039295,  -0.136640444,  0.177654341,  -0.051438004,
+  -0.173446849,  -0.142002851,  -0.028027780,  0.012235536,  -0.138484612,  -0.030569511,  0.058158651,  0.049008526,
+  -0.119089171,  0.075476661,  0.073921740,  0.196596190,  0.005571243,  -0.106076270,  -0.035750300,  0.127659574,
+  -0.080442600,  0.010680152,  -0.024878647,  -0.128197849,  0.015772587,  -0.076626770,  -0.089560971,  -0.052878942,
+  -0.057908084,  -0.119441323,  -0.016297117,  -0.000634124,  -0.036822736,  0.037970521,  0.081772931,  -0.088500403,
+  0.207587436,  0.128458411,  -0.093060434,  0.104891673,  -0.057476833,  -0.169452131,  -0.147125527,  -0.116893560,
+  0.008532860,  0.141723335,  0.022598837,  -0.095597848,  -0.017102402,  0.082572632,  0.075372748,  0.150525391,
+  -0.035277419,  0.153214335,  0.198504329,  0.039083555,  0.093104504,  0.119533867,  0.104674779,  0.013762526,
+  -0.130202889,  0.170476407,  -0.121204317,  -0.038662814,  -0.188867822,  -0.184365019,  -0.030393315,  0.022073127,
+  -0.106076926,  -0.018117901,  0.105478220,  -0.070334792,  0.000819017,  -0.145885974,  0.029506344,  0.006195465,
+  -0.116051763,  -0.024276337,  0.035313182,  -0.152457058,  0.074311085,  -0.142462447,  -0.082195200,  -0.006393734,
+  0.063905291,  -0.099686876,  -0.143967539,  0.078378662,  -0.042302765,  -0.117074952,  0.082491815,  -0.140906394,
+  -0.011232065,  -0.139126539,  -0.095814310,  0.201294318,  -0.171111047,  0.166570112,  -0.032683853,  0.078480847,
+  -0.049736958,  0.001699324,  0.124078147,  0.135378093,  -0.021040145,  -0.057669926,  -0.122890323,  -0.078329995,
+  0.283419341,  -0.038482912,  -0.043581389,  -0.163501784,  0.050753824,  0.026392145,  -0.100172043,  -0.049335793,
+  -0.088021509,  -0.140206710,  0.141701683,  0.105899505,  -0.008091767,  0.027172467,  -0.126136750,  0.023186287,
+  -0.129849210,  -0.101641111,  -0.115596965,  -0.079639964,  0.259795427,  0.166071132,  -0.106609702,  0.214776754,
+  0.036850125,  -0.000246285,  0.123355508,  -0.049873389,  0.176764473,  0.022591246,  -0.083433025,  -0.088799804,
+  0.272134900,  0.161922991,  0.002420698,  -0.011264805,  -0.117502369,  0.086979300,  -0.094245754,  0.056301016,
+  -0.032938454,  0.187338382,  0.248349845,  0.063054778,  0.051069718,  -0.017245246,  0.168939099,  0.083347842,
+  -0.094674051,  -0.097366989,  -0.124220163,  0.164729998,  -0.216305807,  -0.060421199,  -0.119215228,  -0.257865816,
+  -0.130345345,  -0.121548802,  -0.074672244,  -0.026087457,  0.022347065,  -0.034968741,  0.016205972,  0.138115808,
+  -0.060187779,  0.071731672,  0.295740873,  0.204772949,  -0.046200622,  0.371078134,  0.055216044,  0.054927476,
+  -0.124250188,  -0.183361202,  0.185868576,  -0.059502244,  0.007926820,  0.242264166,  -0.078225508,  -0.002476105,
+  0.065200180,  -0.102648310,  0.035730731,  -0.063463643,  -0.093823865,  -0.111799166,  0.108479887,  0.191251710,
+  0.211009562,  -0.009119502,  -0.073001936,  -0.143070623,  -0.064173400,  -0.061591957,  -0.048324753,  0.109256566,
+  -0.036011782,  0.199307233,  -0.105540745,  -0.036430620,  0.212322265,  -0.133678108,  0.038018271,  -0.055079821,
+  -0.173652828,  0.032421701,  -0.063189857,  0.050504010,  -0.020022139,  0.210845962,  0.015296358,  0.034718603,
+  -0.041559614,  0.055248931,  0.033687469,  -0.025872715,  -0.138695151,  0.289837033,  0.042351916,  -0.164113283,
+  0.139078259,  0.043729100,  0.228895143,  0.132672101,  -0.043192737,  -0.076788448,  0.094794810,  0.045568474,
+  0.041078791,  0.089003108,  0.024051279,  0.215176925,  -0.105808347,  0.065276869,  -0.057522185,  0.221562639,
+  0.014258312,  0.014404067,  -0.147475526,  0.082743064,  -0.059576675,  -0.188259646,  0.248445332,  -0.139598176,
+  0.049183212,  -0.043617643,  0.194440037,  0.092677183,  0.066301741,  0.045668248,  0.062760130,  -0.027600611,
+  0.033301391,  -0.135348156,  0.175802678,  -0.065240979,  0.044973861,  -0.131237030,  0.041939843,  -0.171158940,
+  -0.036704946,  -0.160996944,  -0.020426555,  -0.003221060,  -0.072413951,  -0.056200113,  0.176242203,  0.188465133,
+  -0.025065705,  -0.186177969,  0.244719252,  0.060185350,  0.026637636,  -0.087999284,  0.166041881,  0.155732855,
+  0.004462725,  -0.120466121,  0.042198122,  0.085524939,  -0.016907752,  0.060334004,  -0.065399736,  -0.065653674,
+  0.212034985,  0.174489081,  0.124514848,  0.116525479,  0.105980299,  0.072305955,  -0.144232005,  -0.084001198,
+  -0.127714857,  -0.003075138,  0.130499348,  -0.142991930,  -0.041253462,  0.086335473,  0.016105462,  0.082732350,
+  -0.018653017,  0.059061006,  -0.069367424,  0.165640458,  -0.119875766,  -0.135319665,  -0.103213906,  -0.003227878,
+  -0.091643490,  0.079160787,  -0.142526746,  0.051446274,  0.088712320,  0.242736846,  -0.142590612,  -0.143168151,
+  -0.007636781,  0.164299428,  0.009006086,  0.040873982,  0.085229024,  0.061079543,  0.134022042,  0.045921661,
+  -0.113414645,  0.112336904,  -0.150666535,  -0.070800446,  0.082620092,  0.163475662,  0.099783234,  -0.109247647,
+  -0.089135677,  0.125860766,  -0.034012206,  -0.009885021,  0.199342892,  -0.037197586,  -0.205660447,  -0.056249406,
+  -0.131810933,  -0.162200466,  -0.074345134,  -0.086591989,  0.014564684,  -0.099766299,  0.101551168,  0.142722756,
+  0.054620065,  0.067009427,  -0.158974007,  -0.029331021,  -0.106886417,  -0.046698291,  -0.048257761,  -0.009270064,
+  -0.018058725,  -0.022869147,  -0.048951119,  -0.200073376,  0.097350404,  -0.078117266,  0.096641853,  -0.008229248,
+  0.113323480,  0.087068170,  -0.078127421,  -0.095614009,  -0.100498006,  -0.122060537,  -0.053612851,  -0.028042631,
+  0.112564132,  0.145650372,  -0.059762198,  -0.045331981,  -0.038092893,  0.123921141,  -0.132301569,  -0.126663640,
+  -0.018892733,  -0.064848199,  0.161605731,  -0.025492527,  0.012603544,  -0.171778679,  0.016776469,  -0.089797035,
+  0.102208734,  -0.130041927,  -0.099655837,  -0.009999993,  -0.053815193,  0.023582878,  -0.221911162,  0.142627954,
+  0.039554432,  0.159208551,  0.060097072,  -0.018018454,  0.240960687,  -0.059003510,  -0.042401515,  -0.274881274,
+  0.011935361,  0.062119666,  0.000936825,  0.066428907,  -0.284226328,  -0.093803816,  0.068807878,  -0.193215549,
+  -0.032220624,  0.048078939,  -0.108598858,  0.092908211,  -0.328555703,  -0.041541122,  -0.050824970,  -0.056871586,
+  0.002170869,  -0.118078798,  0.066192701,  0.002884760,  -0.141062483,  -0.052086510,  -0.040880851,  -0.091649547,
+  -0.120023735,  0.127000302,  -0.046659440,  0.372886807,  -0.160591096,  -0.067719541,  0.055822048,  -0.034403726,
+  0.093857110,  0.086486325,  -0.137305439,  0.058394779,  0.206195712,  0.042146124,  -0.023698002,  0.015189691,
+  0.296149850,  -0.119936809,  0.115940578,  0.007072038,  0.122740291,  -0.120645151,  -0.121144608,  0.244685546,
+  -0.046843410,  0.063266449,  0.033518527,  -0.046138108,  -0.106908143,  0.052057229,  -0.012606134,  -0.063975938,
+  0.042674512,  -0.135137215,  0.001472868,  0.129398793,  -0.022482151,  -0.134807408,  -0.009361589,  -0.159195065,
+  -0.041506857,  -0.264187515,  0.111796826,  0.193229347,  -0.102200434,  0.172009528,  -0.110554218,  0.098568678,
+  0.091758572,  -0.072945513,  0.121282198,  -0.067104504,  -0.030704305,  -0.089515984,  -0.191017002,  0.067106448,
+  -0.023645092,  0.221083269,  -0.140965030,  -0.029305212,  -0.103648275,  0.143007666,  0.151994765,  -0.048716746,
+  -0.064416058,  -0.114067420,  -0.000545111,  -0.028861195,  -0.034839120,  -0.059526775,  -0.026724916,  -0.065303385,
+  0.063183181,  -0.002672699,  -0.100391433,  -0.186069995,  -0.050730497,  0.104355447,  -0.084690601,  -0.005663803,
+  0.194066510,  -0.141491026,  -0.104688659,  0.094364330,  0.130708992,  -0.089602515,  0.093282752,  0.075596236,
+  -0.054072522,  0.075907208,  -0.041125745,  -0.057561204,  0.183548525,  0.071838625,  0.046521422,  0.019064920,
+  -0.124240786,  0.047614418,  -0.117635310,  0.147998869,  -0.035682581,  0.157206729,  0.002618328,  -0.086374402,
+  0.103508301,  0.213684440,  0.240062937,  -0.098760948,  -0.085774511,  0.138086274,  0.064709157,  0.203511357,
+  -0.056439064,  0.222074971,  0.017804746,  -0.109122366,  -0.006888914,  0.108812906,  0.022042682,  -0.097458407,
+  0.261680335,  -0.125964880,  0.109385364,  0.113037378,  -0.036440209,  0.105207264,  0.090130031,  0.130282775,
+  -0.129439831,  -0.120676808,  -0.005903224,  0.207791850,  0.039803855,  0.259892732,  -0.109203935,  0.041830875,
+  -0.097596876,  0.018143281,  -0.114504091,  -0.208501145,  0.120759107,  0.151398003,  0.284227312,  -0.027220432,
+  -0.128445745,  -0.053431585,  -0.064213552,  -0.007256770,  0.078732483,  -0.253909558,  0.188669920,  0.098200977,
+  -0.106078416,  -0.097429067,  -0.136666730,  0.003501318,  0.035303153,  0.069247469,  -0.010216498,  0.009870774,
+  -0.067301638,  -0.012414028,  0.015736371,  -0.122425258,  0.158090889,  -0.095168836,  0.099414743,  0.214910075,
+  0.282613695,  0.091132358,  -0.049004760,  0.166735262,  -0.072717190,  0.085071787,  0.100771070,  0.192027345,
+  -0.022110764,  -0.167663291,  0.084226802,  -0.130400628,  0.042984791,  -0.105071753,  -0.084368810,  -0.049264565,
+  0.454077542,  0.023332570,  -0.141370609,  -0.007517538,  0.005283151,  0.023739817,  0.035396360,  -0.058091454,
+  0.075716138,  0.108322836,  0.345263243,  0.084777974,  0.095403209,  -0.106442444,  -0.112993672,  0.181481093,
+  -0.052830733,  0.014697845,  -0.144326299,  -0.108026817,  -0.116733119,  -0.075375982,  0.090581983,  -0.143538743,
+  0.002579348,  -0.031543612,  0.176061392,  0.028059378,  0.090792120,  0.267737389,  0.258366615,  -0.124941304,
+  0.060412508,  0.106065765,  -0.032042965,  -0.017941803,  0.087909766,  -0.125363171,  0.014569903,  0.021923417,
+  -0.096522644,  -0.083885849,  0.338624239,  0.160164326,  0.142657474,  -0.025833003,  -0.046188869,  0.145326033,
+  0.039581310,  -0.018002827,  0.083107606,  0.082600974,  -0.001726856,  0.063345797,  0.104723282,  -0.016114771,
+  0.024298580,  0.092439674,  0.072255313,  -0.008611830,  0.095684052,  -0.039316121,  0.089133710,  0.179855630,
+  -0.052877814,  -0.045402072,  -0.017114297,  -0.047207333,  0.034131095,  0.248446018,  -0.002173468,  0.346243382,
+  -0.048146926,  -0.135043025,  0.006133993,  0.090211473,  0.330161214,  0.248435482,  -0.035120569,  0.054895166,
+  0.150162861,  0.010980950,  0.072545268,  -0.084997304,  0.082596101,  0.346446306,  0.124652497,  0.101000622,
+  -0.007244655,  -0.117562145,  -0.061136156,  0.111922935,  0.026160372,  -0.062579565,  -0.119895369,  -0.051549532,
+  -0.071092904,  0.147620469,  0.167754591,  -0.030195959,  -0.122931495,  0.071138985,  0.055936180,  0.061396021,
+  0.037164569,  -0.085834846,  -0.054105811,  0.018821768,  0.019458799,  0.097756684,  -0.041928276,  0.121596761,
+  0.214691922,  -0.005104921,  0.087258361,  0.015286801,  -0.117732555,  0.064744711,  -0.041269589,  -0.006022653,
+  0.169455841,  0.178143606,  0.162129283,  -0.043875434,  0.018133627,  0.036782991,  -0.006843657,  0.005579873,
+  -0.115462601,  0.019476805,  -0.051930994,  0.016393306,  0.023401052,  0.075915761,  -0.043208390,  0.153480172,
+  -0.104855679,  0.068120971,  -0.050911598,  -0.103115976,  0.031308062,  -0.098465197,  0.054456849,  -0.118022934,
+  0.086892724,  -0.117057532,  -0.062045552,  0.072119951,  -0.029914437,  0.194209054,  0.035469864,  0.194078714,
+  -0.023435999,  0.048879512,  -0.044150174,  -0.013693120,  -0.092389330,  -0.107169181,  -0.028492017,  -0.015508896,
+  -0.024252743,  -0.118422002,  0.241593972,  -0.059792720,  -0.034605235,  0.017518384,  -0.141760260,  0.160693288,
+  -0.037536945,  -0.030520797,  0.229620457,  -0.015819728,  -0.141348392,  -0.028159268,  -0.126194060,  -0.117155433,
+  0.114540651,  0.287093937,  -0.136036277,  -0.059658203,  -0.054836974,  0.080745898,  0.030929804,  0.028278302,
+  -0.054948851,  -0.037075795,  0.053792547,  0.028299682,  0.005100811,  0.117706195,  -0.114738010,  -0.040048338,
+  0.020796591,  -0.066750318,  -0.122081771,  0.029619722,  0.122941203,  0.010578567,  -0.092226736,  -0.128737092,
+  -0.140404418,  0.001344582,  0.035528190,  0.088620976,  0.036468666,  -0.031531129,  0.050318822,  -0.016744664,
+  0.064705558,  -0.087813765,  -0.014886631,  0.221240774,  0.048527475,  -0.021072673,  -0.077752858,  0.082734190,
+  0.092153050,  0.073372304,  -0.139083669,  0.002506111,  0.215158954,  0.056997951,  0.171226963,  -0.113516450,
+  0.080893919,  0.169165775,  0.134684578,  0.060463689,  -0.017655203,  0.116791375,  -0.027736023,  -0.099371724,
+  0.024674080,  -0.081713043,  -0.079184763,  -0.011977757,  -0.056249216,  0.137553036,  -0.001734912,  0.061288532,
+  0.272933006,  -0.032285262,  0.091726936,  0.072277486,  -0.129099071,  -0.010923458,  -0.040949456,  -0.024110250,
+  -0.082568467,  -0.219580501,  -0.029255798,  -0.002376908,  0.256724596,  -0.040241987,  -0.007469692,  -0.110926442,
+  0.006172892,  0.302415550,  0.175277963,  -0.070636548,  0.042548317,  -0.123423792,  -0.083104983,  -0.140458241,
+  -0.114750773,  0.008901340,  -0.116070271,  0.000554269,  -0.099048905,  0.067510836,  -0.064666688,  0.142978877,
+  -0.045027189,  -0.024605736,  0.072978519,  -0.088996716,  -0.043622799,  -0.033115536,  -0.059954792,  -0.123607591,
+  0.054736424,  0.072997190,  -0.010754184,  -0.048072651,  -0.028663985,  0.045151424,  -0.012691006,  -0.059053298,
+  0.104644969,  0.060467020,  -0.040276483,  0.019377014,  -0.060303159,  -0.038411751,  -0.090152025,  0.152535126,
+  -0.032579698,  -0.087069012,  0.090219654,  0.031735819,  0.070865758,  0.185983419,  -0.109739989,  -0.159479722,
+  -0.052604564,  -0.016835198,  0.056995820,  -0.075320177,  0.052599989,  -0.064697832,  -0.029535158,  -0.004597946,
+  -0.103234507,  0.085816421,  0.238443613,  -0.033461343,  0.020112559,  -0.061248414,  -0.096207850,  -0.061647587,
+  0.125003070,  0.093624778,  0.077381164,  0.131678671,  -0.034031454,  -0.018633435,  -0.117138796,  -0.014395113,
+  -0.035046790,  0.025687575,  0.201657191,  0.110825405,  -0.017834628,  -0.050878100,  0.130372792,  -0.098034866,
+  0.052930180,  0.091340743,  0.031307891,  -0.012552661,  -0.023314750,  0.129175350,  0.181164131,  0.000761341,
+  0.183619872,  0.100678258,  -0.064824335,  0.009525117,  -0.125974357,  0.141321227,  -0.065989144,  -0.074025586,
+  0.149851292,  -0.018124474,  0.039994054,  -0.018547943,  -0.022507539,  0.039692666,  -0.104337364,  -0.062543474,
+  0.102347463,  -0.131514773,  0.075941756,  0.164871722,  -0.086242765,  0.017320300,  -0.114293762,  0.040491577,
+  -0.029301800,  -0.057998635,  0.009005893,  -0.004345030,  -0.065236725,  -0.054430310,  -0.051241849,  -0.233888328,
+  -0.046872146,  0.083690606,  0.062724136,  0.015886420,  0.018389255,  -0.093093336,  -0.014361694,  0.073752277,
+  -0.048948593,  0.006142703,  -0.008165173,  -0.019623458,  -0.074982777,  0.075281143,  0.036441404,  -0.029204601,
+  -0.056335069,  0.213128328,  -0.033183780,  -0.138521358,  -0.010017550,  0.174979642,  0.053289086,  -0.046091281,
+  0.008182261,  0.035148766,  -0.040526297,  0.048363015,  -0.042675335,  -0.015752658,  0.038424708,  -0.103736930,
+  0.142254055,  0.031462695,  0.037414614,  -0.131626859,  0.085257575,  -0.062559955,  -0.138629898,  0.079602607,
+  -0.046178736,  0.037137259,  -0.068003811,  0.032060787,  -0.132463917,  0.084392689,  -0.048367493,  0.051206112,
+  -0.074676558,  0.043317605,  0.081665970,  0.166571140,  -0.009546765,  0.190442413,  -0.040854659,  0.203493014,
+  0.174960926,  -0.002738450,  0.277467459,  0.023601981,  0.134651706,  0.141698763,  -0.069883972,  -0.081535168,
+  0.025679294,  -0.084927946,  0.001534620,  -0.109702185,  0.019195208,  -0.001523331,  0.037485793,  0.091475017,
+  0.020512538,  -0.001810721,  0.084800914,  -0.039419536,  0.036506146,  -0.047964856,  -0.016279453,  0.109675348,
+  -0.112822816,  0.072973564,  -0.139315754,  0.194479689,  -0.066750392,  -0.007370024,  -0.032567650,  -0.030359158,
+  -0.117302731,  -0.107333645,  -0.123810790,  -0.002377712,  0.085570283,  0.033762909,  -0.047401652,  0.131749526,
+  -0.040084101,  0.168020472,  -0.063626640,  -0.089651845,  0.169082046,  -0.093652412,  -0.049303532,  0.008989351,
+  -0.123385221,  -0.124734573,  0.089690655,  -0.104191549,  0.083640411,  0.094903208,  -0.118959516,  -0.110610902,
+  -0.098864518,  -0.115116946,  0.095525414,  -0.011434611,  -0.024669988,  -0.065427437,  0.131709352,  -0.076932751,
+  0.148284003,  0.089481570,  -0.005657771,  0.017418470,  -0.135002151,  0.043321747,  0.000019814,  -0.108568206,
+  -0.046833515,  -0.141256809,  -0.033152115,  0.169581100,  0.061246872,  -0.047319032,  -0.039098434,  0.048260104,
+  0.430826575,  0.199740916,  -0.019988012,  0.093841366,  -0.095334679,  -0.069932379,  0.010033056,  -0.028188437,
+  0.145685494,  0.108943984,  0.210313022,  -0.004883425,  0.148225546,  -0.082018465,  -0.057985436,  0.082658961,
+  -0.055867307,  0.020914085,  -0.068455532,  0.285438448,  0.161639303,  -0.042591013,  -0.109497219,  0.128396049,
+  -0.074700505,  0.056363340,  0.231115818,  -0.081430689,  -0.085714631,  0.099103794,  0.334396631,  -0.119486541,
+  -0.089646548,  -0.029025456,  0.009022024,  0.140746728,  0.075459369,  -0.121856749,  0.236029282,  -0.004130762,
+  -0.035022046,  0.056172464,  -0.141020313,  -0.139320433,  0.028916156,  -0.102473162,  0.132816792,  -0.027372524,
+  -0.013677594,  -0.123958707,  -0.073305897,  0.052849922,  -0.033087403,  -0.054492615,  -0.036510464,  -0.098650910,
+  -0.097800076,  0.056100182,  0.002626783,  0.005626607,  0.026315743,  -0.046830572,  -0.089737639,  -0.081275016,
+  0.150383562,  0.170490235,  -0.047874607,  -0.027217871,  -0.110262908,  0.303802997,  -0.097537063,  -0.132137865,
+  0.017440028,  -0.079162396,  -0.011292804,  0.108673975,  -0.141902789,  0.013706486,  0.170433417,  -0.073213302,
+  -0.099025689,  -0.058078364,  0.165016904,  0.164534539,  -0.085780114,  0.128733501,  0.093283176,  -0.077997811,
+  0.090337567,  -0.103685796,  0.178494588,  -0.109530114,  -0.020110423,  0.132066891,  -0.060516462,  -0.098466560,
+  -0.067179695,  0.080620341,  0.006096933,  0.064213015,  0.000860258,  0.121400066,  -0.036456466,  -0.071385786,
+  0.128719553,  0.045392830,  -0.015744394,  -0.043366779,  -0.048296329,  -0.040851247,  -0.130316600,  -0.019515295,
+  0.034559086,  0.058391772,  0.029773166,  -0.013923600,  -0.129972950,  0.108284034,  -0.042273924,  0.117305912,
+  0.039821997,  -0.093906492,  0.084786452,  -0.100594357,  -0.084169999,  0.035454422,  0.057333183,  -0.076546490,
+  0.035891656,  0.061599620,  -0.107820094,  0.168468684,  -0.108946145,  0.131038427,  -0.112193048,  0.132958606,
+  0.065643936,  -0.006494954,  -0.067083180,  0.053630944,  0.030603750,  0.094944522,  0.221285090,  0.077681176,
+  0.122099504,  0.039327696,  0.004165431,  0.015393070,  0.267355412,  0.144259185,  0.045318410,  -0.102972627,
+  0.029210184,  -0.093407750,  0.004103875,  -0.057080671,  -0.142401144,  -0.078540266,  0.056676790,  0.068206586,
+  -0.083070554,  -0.001140682,  -0.037236929,  -0.069796138,  0.014484541,  0.163091123,  -0.028245214,  -0.112945452,
+  -0.071458057,  -0.075256042,  0.242559120,  0.157107681,  -0.087303057,  -0.039208233,  0.075774036,  0.121567681,
+  -0.046496853,  -0.087286763,  -0.081565812,  -0.118854865,  -0.023546450,  -0.071004823,  0.089476325,  -0.082351513,
+  -0.103553519,  -0.114244431,  -0.032369323,  -0.087663382,  0.290789396,  -0.091802068,  -0.108966447,  -0.122180715,
+  -0.102745287,  0.019909147,  -0.044001386,  -0.053353954,  -0.028886840,  -0.092086799,  -0.042289883,  0.068157889,
+  -0.091106988,  0.015868369,  -0.070888005,  0.265336305,  -0.059673164,  -0.038526729,  -0.092419662,  -0.048001252,
+  0.019898560,  -0.135951072,  0.216192991,  -0.138109550,  0.098212086,  0.036548998,  0.306106806,  -0.094755411,
+  -0.019144701,  0.024393089,  -0.021742636,  -0.055893354,  -0.068491131,  0.061722957,  0.233743817,  -0.132217959,
+  0.016089186,  -0.096342452,  0.127012953,  0.111503318,  0.077554226,  0.096866161,  -0.116141155,  0.006286696,
+  0.068627045,  -0.013883308,  -0.041277021,  -0.046085469,  0.009878531,  0.059494182,  -0.067162469,  -0.076379530,
+  -0.069241740,  0.138330981,  -0.096298099,  -0.043163642,  -0.085950904,  -0.095776394,  0.144546077,  0.032618046,
+  0.128802612,  0.087300390,  0.121898636,  0.137206182,  0.056706443,  -0.118918136,  -0.113384373,  -0.121048369,
+  0.075968176,  -0.121797696,  -0.143502906,  0.127597407,  -0.021278679,  0.019245237,  0.078767315,  0.134573892,
+  0.128855303,  0.121353701,  0.070132926,  0.048611864,  -0.123012647,  -0.022789441,  -0.125748992,  -0.009184137,
+  -0.017324865,  0.083708599,  0.005209178,  -0.116725609,  0.093905732,  -0.051949330,  0.046335474,  -0.004830793,
+  -0.074070595,  -0.079523280,  0.124713257,  -0.077314697,  0.089071095,  0.032285437,  -0.016215757,  0.062857315,
+  -0.094253704,  0.137570873,  -0.001299918,  0.128496841,  -0.136439070,  0.088708937,  0.018008292,  0.028596848,
+  0.030758724,  -0.001110211,  0.000914752,  -0.045270830,  -0.102572590,  0.091970399,  -0.024750717,  -0.003948316,
+  0.053989783,  -0.095532343,  0.014715925,  0.013927713,  -0.096182108,  -0.025556952,  0.011522204,  -0.080833644,
+  0.040354937,  -0.056600340,  -0.078873545,  -0.095613465,  0.078032240,  -0.011011809,  0.002022922,  0.126215473,
+  0.026929826,  0.049743056,  0.040811226,  0.094086587,  -0.094591334,  -0.084538318,  0.126607314,  0.093129963,
+  -0.027074456,  -0.060510814,  -0.047917843,  -0.089076005,  -0.130534425,  0.135937437,  -0.056544714,  0.031636670,
+  -0.085487947,  0.003494933,  0.119926944,  -0.120979145,  0.084714398,  -0.014740974,  -0.075813793,  0.007682428,
+  -0.130155846,  0.086164489,  -0.135800660,  -0.094654679,  0.090790689,  0.021630466,  0.127471104,  0.004441202,
+  -0.060665652,  -0.083624393,  -0.037609048,  0.013740078,  -0.018692404,  -0.015437543,  -0.031631619,  0.003149450,
+  -0.024257101,  0.084449857,  -0.010448277,  -0.085918799,  0.127863035,  0.017456457,  0.110361323,  -0.058045067,
+  0.108474866,  -0.043835580,  -0.078346997,  -0.108931124,  -0.035272606,  0.067867577,  0.060552746,  0.081615075,
+  -0.015885115,  -0.086815253,  0.052769363,  -0.013373941,  0.052390873,  -0.076174840,  -0.108673647,  0.050532281,
+  0.104444921,  -0.123508789,  -0.050395250,  0.070431098,  0.057273626,  0.121599093,  -0.117638528,  -0.048758432,
+  0.052664682,  -0.003150806,  -0.085653752,  -0.105886564,  0.026554719,  0.139738277,  -0.117288895,  0.055264026,
+  -0.044873767,  -0.026293337,  -0.014024928,  0.022901773,  -0.136095703,  -0.067966625,  0.005987808,  0.026341736,
+  0.119685307,  0.031278625,  0.126703426,  -0.049606867,  -0.043622352,  -0.121298820,  -0.073480055,  -0.071769752,
+  -0.065686643,  -0.073659658,  0.106293544,  0.118281677,  -0.121580794,  -0.004006609,  0.062351108,  -0.129204586,
+  0.078244597,  -0.100071415,  0.011259735,  -0.130503193,  -0.142719507,  -0.029393740,  -0.095758200,  0.082153484,
+  -0.084771201,  -0.084021874,  0.061200470,  -0.107342497,  0.058915094,  -0.086600535,  -0.080666900,  -0.031611763,
+  -0.124831885,  -0.047580875,  -0.017919943,  0.103804216,  -0.130785137,  0.003673121,  0.125082299,  -0.084966615,
+  0.134778693,  -0.018610835,  0.048183531,  -0.007090434,  -0.128965721,  0.077095091,  0.093630776,  0.101011321,
+  0.104578689,  -0.107686281,  -0.104082204,  -0.123111241,  -0.016306296,  -0.029240139,  -0.019043356,  0.083161399,
+  0.020658493,  0.024422213,  0.022579879,  0.133282945,  -0.120152161,  -0.034706108,  0.125979826,  -0.002486646,
+  0.044643655,  -0.026533209,  -0.076331832,  0.083966449,  0.072934240,  0.113636121,  -0.108988069,  -0.023145549,
+  -0.174204379,  -0.176399976,  0.292236656,  0.397791594,  0.389129341,  0.285942048,  -0.050623417,  -0.357278228,
+  -0.306252539,  -0.208787709,  -0.274080276,  0.002876999,  -0.092032701,  0.298039913,  0.306178451,  0.024104545,
+  -0.471322060,  0.269480616,  0.085048676,  -0.051155951,  0.377588719,  -0.036685802,  -0.256594867,  -0.136928514,
+  0.132782668,  0.452687144,  0.341410905,  -0.322547108,  -0.301906317,  -0.255446553,  -0.180020690,  -0.331287056,
+  0.015189215,  -0.497079849,  -0.183895379,  0.369733572,  0.428822786,  -0.248865470,  -0.250206381,  -0.195636287,
+  0.268436551,  -0.301835239,  -0.029734122,  0.221641049,  -0.578309715,  -0.212688863,  -0.381743103,  0.288006902,
+  0.252033353,  -0.338733763,  -0.291495383,  0.138073668,  -0.024915120,  -0.219520941,  -0.218758911,  -0.228348747,
+  -0.026608096,  0.132533848,  -0.278332084,  -0.230429381,  -0.330155104,  0.326312661,  -0.184930310,  -0.212309390,
+  -0.371878326,  0.267688364,  -0.232149556,  -0.151662380,  -0.227741539,  0.009608313,  0.377440155,  0.359569192,
+  0.227674961,  -0.270605654,  0.261938691,  -0.246928960,  0.349497110,  0.066118814,  -0.517961383,  0.437947065,
+  -0.134563029,  0.234255701,  -0.335361272,  0.320184946,  0.464143574,  -0.222096622,  -0.128887638,  0.464128286,
+  -0.289644718,  0.431908906,  -0.119136840,  -0.209740058,  0.455705047,  -0.027422968,  -0.155435234,  0.008156907,
+  -0.325204521,  -0.303967595,  -0.254229248,  -0.233047530,  -0.320092857,  0.032482095,  -0.304498017,  0.280481189,
+  0.279301703,  0.344548017,  -0.054337755,  -0.299094468,  0.258474231,  0.022670124,  -0.050349239,  -0.270184785,
+  0.329544872,  0.001591287,  -0.371366978,  0.246558219,  -0.364064038,  0.375390083,  -0.267287076,  0.260674834,
+  -0.443743229,  -0.160805762,  -0.203048617,  -0.373016685,  0.243000910,  -0.463460207,  0.063675351,  -0.382407665,
+  -0.336626470,  -0.216257721,  0.378750861,  -0.202676475,  -0.293252140,  0.067513570,  -0.174658269,  -0.209738895,
+  0.309647262,  -0.171999127,  -0.249376103,  0.382059187,  -0.215036690,  -0.226677284,  -0.266610056,  0.266632348,
+  -0.211535305,  0.401139677,  0.316028267,  -0.208689824,  -0.232776672,  -0.197345287,  0.374312371,  0.519033790,
+  0.289840758,  -0.174520522,  0.398173332,  -0.216854945,  -0.221934453,  -0.231289938,  0.470680952,  0.419510514,
+  -0.203904435,  -0.336103857,  -0.259055704,  -0.235951677,  -0.284858555,  0.229458973,  -0.143270493,  -0.088901810,
+  -0.223982066,  -0.173332036,  0.251817316,  -0.294786245,  -0.291507423,  0.306111485,  -0.363848329,  -0.210621580,
+  0.252009183,  0.044925455,  -0.070273824,  0.355192602,  -0.283327401,  -0.269478589,  -0.307580739,  -0.226641938,
+  0.409622699,  0.265396029,  -0.203368679,  0.030365532,  -0.032023791,  -0.250706971,  0.444331646,  0.403246254,
+  -0.208774313,  0.368925393,  -0.239512697,  -0.212619841,  -0.224741220,  0.294568717,  -0.253151774,  -0.374533713,
+  -0.292449445,  0.487950951,  -0.337610483,  -0.242515743,  -0.157161742,  -0.146232694,  -0.355529010,  0.212488055,
+  0.191468716,  0.242776453,  -0.279617786,  0.079130404,  -0.093438618,  -0.326955795,  0.348230273,  -0.238613889,
+  -0.389135897,  -0.149536967,  -0.171354041,  -0.069231257,  -0.234921545,  0.345552295,  0.257795483,  0.199171290,
+  -0.302387685,  -0.316946894,  -0.232909009,  -0.281513929,  -0.187585130,  0.321758538,  -0.221102685,  -0.246982023,
+  -0.247602493,  -0.313639790,  -0.306965977,  -0.408550233,  0.351067960,  -0.018539023,  -0.163780376,  -0.065350287,
+  -0.255378336,  -0.323356718,  0.078858539,  0.292641699,  0.394234747,  0.489148915,  -0.174377918,  -0.211683705,
+  -0.216175303,  0.148380175,  -0.220805570,  0.040889923,  -0.071905032,  0.393473417,  0.394318283,  0.301361203
 
 };
 
@@ -26581,7 +26582,7 @@ static const float weight_8_sequential_1_dense_1_MatMul[7424] = {
 // Weight tensor 10: sequential_1/dense_1/Relu;sequential_1/dense_1/BiasAdd
 // Shape: [256]
 // Elements: 256
-static const float weight_9_sequential_1_dense_1_Relu_sequential_1_dense_1_BiasAdd[256] = {
+static const float weight_9_sequential_1_dense_1_Relu_sequential_1_dense_1_BiasAdd[256] EMBEDDED_ML_LAYER0_PLACEMENT = {
   -0.099871948,  -0.044887092,  -0.107340820,  -0.103963435,  -0.116542101,  -0.124865420,  -0.011632992,  0.126349375,
   0.092997596,  -0.126702562,  0.070491694,  -0.109119691,  0.001689447,  -0.156371593,  -0.059040170,  -0.137804225,
   0.126547828,  -0.120039292,  -0.169549271,  -0.124644160,  -0.067563809,  -0.169171169,  0.097412221,  -0.144227177,
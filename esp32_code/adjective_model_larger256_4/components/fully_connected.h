@@ -8,8 +8,25 @@
 #define FULLY_CONNECTED_H
 
 #include <cstddef>
+#include <cstdint>
 #include <algorithm>
 
+// Dot-product backend of the compile-time shaped row-major float layers
+// (FullyConnectedRowMajor and FullyConnectedBatchEspDsp below):
+//   EMBEDDED_ML_FC_BACKEND_PORTABLE  register-blocked C++ loops, the host and reference path
+//   EMBEDDED_ML_FC_BACKEND_ESP_DSP   dsps_dotprod_f32 from ESP-DSP per output row on the
+//                                    device (hand-written Xtensa loop); on the host a plain
+//                                    loop in the same order, for parity checks
+#define EMBEDDED_ML_FC_BACKEND_PORTABLE 0
+#define EMBEDDED_ML_FC_BACKEND_ESP_DSP 1
+#ifndef EMBEDDED_ML_FC_BACKEND
+#define EMBEDDED_ML_FC_BACKEND EMBEDDED_ML_FC_BACKEND_PORTABLE
+#endif
+
+#if defined(ARDUINO) && EMBEDDED_ML_FC_BACKEND == EMBEDDED_ML_FC_BACKEND_ESP_DSP
+#include <dsps_dotprod.h>
+#endif
+
 namespace embedded_ml {
 
 // Activation function types (matching TFLite)
@@ -64,6 +81,531 @@ void FullyConnected(
     }
 }
 
+// Register-blocked Fully Connected layer: output = activation(input * weights^T + bias)
+// Same arguments and row-major weight layout as FullyConnected, but computes
+// kRows output neurons per pass over the input with independent accumulators,
+// so each input element is loaded once per block instead of once per row.
+// Each row still accumulates in input order, matching FullyConnected bit for bit.
+template<typename T, size_t kRows = 4>
+void FullyConnectedBlocked(
+    const T* __restrict input,
+    const T* __restrict weights,
+    const T* __restrict bias,
+    T* __restrict output,
+    size_t input_size,
+    size_t output_size,
+    ActivationType activation = ActivationType::NONE
+) {
+    size_t i = 0;
+    for (; i + kRows <= output_size; i += kRows) {
+        const T* w_block = weights + i * input_size;
+        T acc[kRows];
+        for (size_t r = 0; r < kRows; ++r) acc[r] = bias[i + r];
+
+        const T* w_rows[kRows];
+        for (size_t r = 0; r < kRows; ++r) w_rows[r] = w_block + r * input_size;
+
+        for (size_t j = 0; j < input_size; ++j) {
+            const T x = input[j];
+#pragma GCC unroll 8
+            for (size_t r = 0; r < kRows; ++r) {
+                acc[r] += x * w_rows[r][j];
+            }
+        }
+
+        for (size_t r = 0; r < kRows; ++r) {
+            T value = acc[r];
+            if (activation == ActivationType::RELU) {
+                value = value > static_cast<T>(0) ? value : static_cast<T>(0);
+            }
+            output[i + r] = value;
+        }
+    }
+
+    // Remaining rows one at a time
+    if (i < output_size) {
+        FullyConnected(input, weights + i * input_size, bias + i, output + i,
+                       input_size, output_size - i, activation);
+    }
+}
+
+// Register-blocked Fully Connected layer over row-interleaved (tiled) weights
+// Same computation as FullyConnectedBlocked, with weights stored so that each
+// block of kRows rows is read as one contiguous stream:
+//   full tiles: weights[(i / kRows) * kRows * input_size + j * kRows + (i % kRows)] = W[i][j]
+//   rows past the last full tile follow in plain row-major order
+// See TileWeights for the conversion from row-major.
+template<typename T, size_t kRows = 4>
+void FullyConnectedTiled(
+    const T* __restrict input,
+    const T* __restrict weights,
+    const T* __restrict bias,
+    T* __restrict output,
+    size_t input_size,
+    size_t output_size,
+    ActivationType activation = ActivationType::NONE
+) {
+    size_t i = 0;
+    for (; i + kRows <= output_size; i += kRows) {
+        const T* w_tile = weights + i * input_size;
+        T acc[kRows];
+        for (size_t r = 0; r < kRows; ++r) acc[r] = bias[i + r];
+
+        for (size_t j = 0; j < input_size; ++j) {
+            const T x = input[j];
+            const T* w_col = w_tile + j * kRows;
+#pragma GCC unroll 8
+            for (size_t r = 0; r < kRows; ++r) {
+                acc[r] += x * w_col[r];
+            }
+        }
+
+        for (size_t r = 0; r < kRows; ++r) {
+            T value = acc[r];
+            if (activation == ActivationType::RELU) {
+                value = value > static_cast<T>(0) ? value : static_cast<T>(0);
+            }
+            output[i + r] = value;
+        }
+    }
+
+    // Remaining rows are stored row-major
+    if (i < output_size) {
+        FullyConnected(input, weights + i * input_size, bias + i, output + i,
+                       input_size, output_size - i, activation);
+    }
+}
+
+// Batched Fully Connected layer: outputs[b] = activation(inputs[b] * weights^T + bias)
+// inputs: batch input vectors of size input_size, stored back to back
+// weights: weight matrix of size [output_size x input_size], row-major
+//          (or in the FullyConnectedTiled layout when kTiled is set)
+// outputs: batch output vectors of size output_size, stored back to back
+// Works through the weights kPanelRows rows at a time and applies each panel to the
+// whole batch while it is still in cache, so the batch costs one pass over the weights.
+// Each output matches FullyConnected on the corresponding input bit for bit.
+template<typename T, size_t kRows = 4, bool kTiled = false, size_t kPanelRows = 16>
+void FullyConnectedBatch(
+    const T* __restrict inputs,
+    const T* __restrict weights,
+    const T* __restrict bias,
+    T* __restrict outputs,
+    size_t input_size,
+    size_t output_size,
+    size_t batch,
+    ActivationType activation = ActivationType::NONE
+) {
+    static_assert(kPanelRows % kRows == 0, "panels must hold whole row blocks");
+
+    for (size_t i = 0; i < output_size; i += kPanelRows) {
+        const size_t rows = std::min(kPanelRows, output_size - i);
+        const T* w_panel = weights + i * input_size;
+        for (size_t b = 0; b < batch; ++b) {
+            const T* input = inputs + b * input_size;
+            T* output = outputs + b * output_size + i;
+            if (kTiled) {
+                FullyConnectedTiled<T, kRows>(input, w_panel, bias + i, output, input_size, rows, activation);
+            } else {
+                FullyConnectedBlocked<T, kRows>(input, w_panel, bias + i, output, input_size, rows, activation);
+            }
+        }
+    }
+}
+
+// Convert a row-major [output_size x input_size] weight matrix to the
+// FullyConnectedTiled layout (used by the exporter)
+template<typename T, size_t kRows = 4>
+void TileWeights(const T* __restrict weights, T* __restrict tiled, size_t input_size, size_t output_size) {
+    size_t i = 0;
+    for (; i + kRows <= output_size; i += kRows) {
+        for (size_t j = 0; j < input_size; ++j) {
+            for (size_t r = 0; r < kRows; ++r) {
+                tiled[i * input_size + j * kRows + r] = weights[(i + r) * input_size + j];
+            }
+        }
+    }
+    for (size_t k = i * input_size; k < output_size * input_size; ++k) {
+        tiled[k] = weights[k];
+    }
+}
+
+// Fully Connected layer over column-major weights: output = activation(input * weights^T + bias)
+// input: input vector of size input_size
+// weights: weight matrix of size [input_size x output_size] (column-major, one column per input)
+// bias: bias vector of size output_size
+// output: output vector of size output_size
+// Zero inputs are skipped, so sparse inputs only read the columns they select.
+// Each output accumulates in input order, matching FullyConnected bit for bit.
+template<typename T>
+void FullyConnectedColumnMajor(
+    const T* __restrict input,
+    const T* __restrict weights,
+    const T* __restrict bias,
+    T* __restrict output,
+    size_t input_size,
+    size_t output_size,
+    ActivationType activation = ActivationType::NONE
+) {
+    for (size_t i = 0; i < output_size; ++i) {
+        output[i] = bias[i];
+    }
+
+    for (size_t j = 0; j < input_size; ++j) {
+        const T x = input[j];
+        if (x == static_cast<T>(0)) continue;
+        const T* w_col = weights + j * output_size;
+        for (size_t i = 0; i < output_size; ++i) {
+            output[i] += x * w_col[i];
+        }
+    }
+
+    if (activation == ActivationType::RELU) {
+        for (size_t i = 0; i < output_size; ++i) {
+            output[i] = output[i] > static_cast<T>(0) ? output[i] : static_cast<T>(0);
+        }
+    }
+}
+
+// Fully Connected layer for an input that is one-hot plus a trailing scalar:
+// input = [one_hot(index) over input_size - 1 entries, scalar]
+// Computes activation(bias + weights[:, index] + scalar * weights[:, input_size - 1]),
+// i.e. FullyConnectedColumnMajor on that dense input without building it.
+// weights: weight matrix of size [input_size x output_size] (column-major)
+// Two contiguous weight columns are read instead of the whole matrix.
+template<typename T>
+void FullyConnectedOneHotPlusScalar(
+    size_t index,
+    T scalar,
+    const T* __restrict weights,
+    const T* __restrict bias,
+    T* __restrict output,
+    size_t input_size,
+    size_t output_size,
+    ActivationType activation = ActivationType::NONE
+) {
+    const T* w_index = weights + index * output_size;
+    const T* w_scalar = weights + (input_size - 1) * output_size;
+
+    for (size_t i = 0; i < output_size; ++i) {
+        T acc = bias[i] + w_index[i];
+        acc += scalar * w_scalar[i];
+
+        if (activation == ActivationType::RELU) {
+            acc = acc > static_cast<T>(0) ? acc : static_cast<T>(0);
+        }
+
+        output[i] = acc;
+    }
+}
+
+// Symmetric int8 quantization: values[i] ~= quantized[i] * scale
+// values: float vector of size size
+// quantized: output vector of size size, in [-127, 127]
+// Returns the scale (0 when every value is zero)
+inline float QuantizeInt8(const float* __restrict values, int8_t* __restrict quantized, size_t size) {
+    float max_abs = 0.0f;
+    for (size_t i = 0; i < size; ++i) {
+        const float a = values[i] < 0.0f ? -values[i] : values[i];
+        if (a > max_abs) max_abs = a;
+    }
+
+    if (max_abs == 0.0f) {
+        for (size_t i = 0; i < size; ++i) quantized[i] = 0;
+        return 0.0f;
+    }
+
+    const float scale = max_abs / 127.0f;
+    const float inv_scale = 127.0f / max_abs;
+    for (size_t i = 0; i < size; ++i) {
+        const float x = values[i] * inv_scale;
+        int32_t q = static_cast<int32_t>(x + (x >= 0.0f ? 0.5f : -0.5f));
+        q = std::min<int32_t>(127, std::max<int32_t>(-127, q));
+        quantized[i] = static_cast<int8_t>(q);
+    }
+    return scale;
+}
+
+// INT8 Fully Connected layer: int8 weights and input, int32 accumulation
+// output[i] = activation(bias[i] + input_scale * weight_scales[i] * sum_j input[j] * weights[i][j])
+// input: quantized input vector of size input_size (see QuantizeInt8)
+// input_scale: per-tensor scale of input
+// weights: int8 weight matrix of size [output_size x input_size] (row-major)
+// weight_scales: per-output-channel weight scales of size output_size
+// bias: float bias vector of size output_size
+// output: output vector of size output_size
+template<typename T>
+void FullyConnectedInt8(
+    const int8_t* __restrict input,
+    float input_scale,
+    const int8_t* __restrict weights,
+    const float* __restrict weight_scales,
+    const T* __restrict bias,
+    T* __restrict output,
+    size_t input_size,
+    size_t output_size,
+    ActivationType activation = ActivationType::NONE
+) {
+    for (size_t i = 0; i < output_size; ++i) {
+        const int8_t* w_row = weights + i * input_size;
+        int32_t acc = 0;
+
+        // Unrolled integer inner product (4 elements at a time)
+        size_t j = 0;
+        for (; j + 3 < input_size; j += 4) {
+            acc += static_cast<int32_t>(input[j])     * w_row[j];
+            acc += static_cast<int32_t>(input[j + 1]) * w_row[j + 1];
+            acc += static_cast<int32_t>(input[j + 2]) * w_row[j + 2];
+            acc += static_cast<int32_t>(input[j + 3]) * w_row[j + 3];
+        }
+
+        // Handle remaining elements
+        for (; j < input_size; ++j) {
+            acc += static_cast<int32_t>(input[j]) * w_row[j];
+        }
+
+        // Dequantize and apply fused activation function
+        T value = bias[i] + static_cast<T>(acc) * static_cast<T>(input_scale * weight_scales[i]);
+        if (activation == ActivationType::RELU) {
+            value = value > static_cast<T>(0) ? value : static_cast<T>(0);
+        }
+
+        output[i] = value;
+    }
+}
+
+// --- Compile-time shaped layers ---
+// The same computations as the kernels above, with the layer shape and the
+// activation as template arguments. Loop bounds are constants, so the compiler
+// can unroll and vectorize freely. The remainder loop disappears when kRows
+// divides Out, and the activation is resolved at compile time.
+// Every output matches the runtime-shaped kernel bit for bit.
+
+// Fused activation selected at compile time
+template<ActivationType Act, typename T>
+inline T Activate(T value) {
+    if (Act == ActivationType::RELU) {
+        return value > static_cast<T>(0) ? value : static_cast<T>(0);
+    }
+    return value;
+}
+
+// FullyConnected / FullyConnectedBlocked with shape [Out x In] (row-major weights)
+// Loop vectorization is off for this kernel: with a constant In, GCC turns each
+// row's sum into an in-order vector reduction, which is slower than the
+// scalar accumulators it has to preserve bit for bit.
+#pragma GCC push_options
+#pragma GCC optimize("no-tree-loop-vectorize")
+template<typename T, size_t In, size_t Out, ActivationType Act, size_t kRows = 4>
+void FullyConnected(
+    const T* __restrict input,
+    const T* __restrict weights,
+    const T* __restrict bias,
+    T* __restrict output
+) {
+    static_assert(In > 0 && Out > 0 && kRows > 0, "layer shape must be non-empty");
+    constexpr size_t kBlocked = Out - Out % kRows;
+
+    for (size_t i = 0; i < kBlocked; i += kRows) {
+        T acc[kRows];
+        for (size_t r = 0; r < kRows; ++r) acc[r] = bias[i + r];
+
+        const T* w_rows[kRows];
+        for (size_t r = 0; r < kRows; ++r) w_rows[r] = weights + (i + r) * In;
+
+        for (size_t j = 0; j < In; ++j) {
+            const T x = input[j];
+#pragma GCC unroll 8
+            for (size_t r = 0; r < kRows; ++r) {
+                acc[r] += x * w_rows[r][j];
+            }
+        }
+
+        for (size_t r = 0; r < kRows; ++r) output[i + r] = Activate<Act>(acc[r]);
+    }
+
+    // Remaining rows one at a time
+    for (size_t i = kBlocked; i < Out; ++i) {
+        const T* w_row = weights + i * In;
+        T acc = bias[i];
+        for (size_t j = 0; j < In; ++j) acc += input[j] * w_row[j];
+        output[i] = Activate<Act>(acc);
+    }
+}
+
+#pragma GCC pop_options
+
+// Dot product of two float vectors of length n, as ESP-DSP computes it: one
+// accumulator from zero, in index order
+inline float DotProductEspDsp(const float* a, const float* b, size_t n) {
+#if defined(ARDUINO) && EMBEDDED_ML_FC_BACKEND == EMBEDDED_ML_FC_BACKEND_ESP_DSP
+    float result = 0.0f;
+    dsps_dotprod_f32(a, b, &result, static_cast<int>(n));
+    return result;
+#else
+    float acc = 0.0f;
+    for (size_t j = 0; j < n; ++j) acc += a[j] * b[j];
+    return acc;
+#endif
+}
+
+// FullyConnected<float, In, Out, Act> with one ESP-DSP dot product per row
+// The bias is added after the sum instead of before it, so outputs can differ
+// from the portable kernel in the last bits
+template<size_t In, size_t Out, ActivationType Act>
+void FullyConnectedEspDsp(
+    const float* __restrict input,
+    const float* __restrict weights,
+    const float* __restrict bias,
+    float* __restrict output
+) {
+    static_assert(In > 0 && Out > 0, "layer shape must be non-empty");
+
+    for (size_t i = 0; i < Out; ++i) {
+        output[i] = Activate<Act>(bias[i] + DotProductEspDsp(input, weights + i * In, In));
+    }
+}
+
+// Row-major float layer [Out x In] through the backend selected by EMBEDDED_ML_FC_BACKEND
+template<size_t In, size_t Out, ActivationType Act, size_t kRows = 4>
+inline void FullyConnectedRowMajor(
+    const float* __restrict input,
+    const float* __restrict weights,
+    const float* __restrict bias,
+    float* __restrict output
+) {
+#if EMBEDDED_ML_FC_BACKEND == EMBEDDED_ML_FC_BACKEND_ESP_DSP
+    FullyConnectedEspDsp<In, Out, Act>(input, weights, bias, output);
+#else
+    FullyConnected<float, In, Out, Act, kRows>(input, weights, bias, output);
+#endif
+}
+
+// Batched FullyConnectedEspDsp with runtime shapes, in FullyConnectedBatch's
+// argument order: each weight row is applied to the whole batch while it is
+// still in cache. Each output matches FullyConnectedEspDsp on the
+// corresponding input bit for bit.
+inline void FullyConnectedBatchEspDsp(
+    const float* __restrict inputs,
+    const float* __restrict weights,
+    const float* __restrict bias,
+    float* __restrict outputs,
+    size_t input_size,
+    size_t output_size,
+    size_t batch,
+    ActivationType activation = ActivationType::NONE
+) {
+    for (size_t i = 0; i < output_size; ++i) {
+        const float* w_row = weights + i * input_size;
+        for (size_t b = 0; b < batch; ++b) {
+            const float value = bias[i] + DotProductEspDsp(inputs + b * input_size, w_row, input_size);
+            outputs[b * output_size + i] = activation == ActivationType::RELU
+                ? Activate<ActivationType::RELU>(value) : value;
+        }
+    }
+}
+
+// FullyConnectedTiled with shape [Out x In] (TileWeights layout)
+// The kRows accumulators form the innermost loop, which vectorizes as a unit
+template<typename T, size_t In, size_t Out, ActivationType Act, size_t kRows = 4>
+void FullyConnectedTiled(
+    const T* __restrict input,
+    const T* __restrict weights,
+    const T* __restrict bias,
+    T* __restrict output
+) {
+    static_assert(In > 0 && Out > 0 && kRows > 0, "layer shape must be non-empty");
+    constexpr size_t kBlocked = Out - Out % kRows;
+
+    for (size_t i = 0; i < kBlocked; i += kRows) {
+        const T* w_col = weights + i * In;
+        T acc[kRows];
+        for (size_t r = 0; r < kRows; ++r) acc[r] = bias[i + r];
+
+        for (size_t j = 0; j < In; ++j, w_col += kRows) {
+            const T x = input[j];
+            for (size_t r = 0; r < kRows; ++r) {
+                acc[r] += x * w_col[r];
+            }
+        }
+
+        for (size_t r = 0; r < kRows; ++r) output[i + r] = Activate<Act>(acc[r]);
+    }
+
+    // Remaining rows are stored row-major
+    for (size_t i = kBlocked; i < Out; ++i) {
+        const T* w_row = weights + i * In;
+        T acc = bias[i];
+        for (size_t j = 0; j < In; ++j) acc += input[j] * w_row[j];
+        output[i] = Activate<Act>(acc);
+    }
+}
+
+// FullyConnectedColumnMajor with shape [In x Out] (column-major weights)
+template<typename T, size_t In, size_t Out, ActivationType Act>
+void FullyConnectedColumnMajor(
+    const T* __restrict input,
+    const T* __restrict weights,
+    const T* __restrict bias,
+    T* __restrict output
+) {
+    static_assert(In > 0 && Out > 0, "layer shape must be non-empty");
+
+    for (size_t i = 0; i < Out; ++i) output[i] = bias[i];
+
+    for (size_t j = 0; j < In; ++j) {
+        const T x = input[j];
+        if (x == static_cast<T>(0)) continue;
+        const T* w_col = weights + j * Out;
+        for (size_t i = 0; i < Out; ++i) output[i] += x * w_col[i];
+    }
+
+    for (size_t i = 0; i < Out; ++i) output[i] = Activate<Act>(output[i]);
+}
+
+// FullyConnectedOneHotPlusScalar with shape [In x Out] (column-major weights)
+template<typename T, size_t In, size_t Out, ActivationType Act>
+void FullyConnectedOneHotPlusScalar(
+    size_t index,
+    T scalar,
+    const T* __restrict weights,
+    const T* __restrict bias,
+    T* __restrict output
+) {
+    static_assert(In > 1 && Out > 0, "input must hold the one-hot part and the scalar");
+    const T* w_index = weights + index * Out;
+    const T* w_scalar = weights + (In - 1) * Out;
+
+    for (size_t i = 0; i < Out; ++i) {
+        T acc = bias[i] + w_index[i];
+        acc += scalar * w_scalar[i];
+        output[i] = Activate<Act>(acc);
+    }
+}
+
+// FullyConnectedInt8 with shape [Out x In] (row-major int8 weights)
+template<typename T, size_t In, size_t Out, ActivationType Act>
+void FullyConnectedInt8(
+    const int8_t* __restrict input,
+    float input_scale,
+    const int8_t* __restrict weights,
+    const float* __restrict weight_scales,
+    const T* __restrict bias,
+    T* __restrict output
+) {
+    static_assert(In > 0 && Out > 0, "layer shape must be non-empty");
+
+    for (size_t i = 0; i < Out; ++i) {
+        const int8_t* w_row = weights + i * In;
+        int32_t acc = 0;
+        for (size_t j = 0; j < In; ++j) {
+            acc += static_cast<int32_t>(input[j]) * w_row[j];
+        }
+
+        T value = bias[i] + static_cast<T>(acc) * static_cast<T>(input_scale * weight_scales[i]);
+        output[i] = Activate<Act>(value);
+    }
+}
+
 } // namespace embedded_ml
 
 #endif // FULLY_CONNECTED_H
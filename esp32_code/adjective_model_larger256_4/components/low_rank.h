@@ -0,0 +1,125 @@
+// components/low_rank.h
+// Truncated SVD factorization of dense layers
+// Host-side helper for the exporter and benchmarks (allocates, uses double precision)
+//
+// A [rows x cols] weight matrix W is approximated by up * down with
+//   down: [rank x cols], orthonormal rows (right singular vectors)
+//   up:   [rows x rank], left singular vectors scaled by the singular values
+// so a layer W x + b becomes two FullyConnected calls: down (no bias, no
+// activation) into a rank-wide buffer, then up with the layer's bias and activation.
+
+#ifndef LOW_RANK_H
+#define LOW_RANK_H
+
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+#include <numeric>
+#include <vector>
+
+namespace embedded_ml {
+
+// W = left * right^T with left's columns orthogonal, sorted by descending norm
+struct DenseSvd {
+    size_t rows = 0;
+    size_t cols = 0;
+    std::vector<double> singular_values;  // min(rows, cols) values, descending
+    std::vector<double> left;              // column k (length rows) = singular_values[k] * u_k
+    std::vector<double> right;             // column k (length cols) = v_k
+};
+
+// One-sided Jacobi SVD of a row-major [rows x cols] matrix, rows >= cols
+// Rotates column pairs of W until all are orthogonal, accumulating the rotations in V
+inline DenseSvd ComputeSvd(const float* weights, size_t rows, size_t cols) {
+    static constexpr int kMaxSweeps = 30;
+    static constexpr double kTolerance = 1e-12;
+
+    // Column-major working copies: g[j] is column j of W (then of W V), v[j] column j of V
+    std::vector<std::vector<double>> g(cols, std::vector<double>(rows));
+    std::vector<std::vector<double>> v(cols, std::vector<double>(cols, 0.0));
+    for (size_t j = 0; j < cols; ++j) {
+        for (size_t i = 0; i < rows; ++i) g[j][i] = weights[i * cols + j];
+        v[j][j] = 1.0;
+    }
+
+    for (int sweep = 0; sweep < kMaxSweeps; ++sweep) {
+        bool rotated = false;
+        for (size_t p = 0; p + 1 < cols; ++p) {
+            for (size_t q = p + 1; q < cols; ++q) {
+                double alpha = 0.0, beta = 0.0, gamma = 0.0;
+                for (size_t i = 0; i < rows; ++i) {
+                    alpha += g[p][i] * g[p][i];
+                    beta += g[q][i] * g[q][i];
+                    gamma += g[p][i] * g[q][i];
+                }
+                if (std::fabs(gamma) <= kTolerance * std::sqrt(alpha * beta)) continue;
+                rotated = true;
+
+                const double zeta = (beta - alpha) / (2.0 * gamma);
+                const double t = (zeta >= 0.0 ? 1.0 : -1.0) / (std::fabs(zeta) + std::sqrt(1.0 + zeta * zeta));
+                const double c = 1.0 / std::sqrt(1.0 + t * t);
+                const double s = c * t;
+                for (size_t i = 0; i < rows; ++i) {
+                    const double gp = g[p][i], gq = g[q][i];
+                    g[p][i] = c * gp - s * gq;
+                    g[q][i] = s * gp + c * gq;
+                }
+                for (size_t i = 0; i < cols; ++i) {
+                    const double vp = v[p][i], vq = v[q][i];
+                    v[p][i] = c * vp - s * vq;
+                    v[q][i] = s * vp + c * vq;
+                }
+            }
+        }
+        if (!rotated) break;
+    }
+
+    std::vector<double> norms(cols);
+    for (size_t j = 0; j < cols; ++j) {
+        double sum = 0.0;
+        for (size_t i = 0; i < rows; ++i) sum += g[j][i] * g[j][i];
+        norms[j] = std::sqrt(sum);
+    }
+    std::vector<size_t> order(cols);
+    std::iota(order.begin(), order.end(), 0);
+    std::stable_sort(order.begin(), order.end(), [&](size_t a, size_t b) { return norms[a] > norms[b]; });
+
+    DenseSvd svd;
+    svd.rows = rows;
+    svd.cols = cols;
+    svd.left.resize(rows * cols);
+    svd.right.resize(cols * cols);
+    for (size_t k = 0; k < cols; ++k) {
+        const size_t j = order[k];
+        svd.singular_values.push_back(norms[j]);
+        for (size_t i = 0; i < rows; ++i) svd.left[k * rows + i] = g[j][i];
+        for (size_t i = 0; i < cols; ++i) svd.right[k * cols + i] = v[j][i];
+    }
+    return svd;
+}
+
+// Rank-r factors of the decomposed matrix, row-major float
+// down: [rank x cols], up: [rows x rank]; rank must be <= svd.cols
+inline void LowRankFactors(const DenseSvd& svd, size_t rank, std::vector<float>& down, std::vector<float>& up) {
+    down.resize(rank * svd.cols);
+    up.resize(svd.rows * rank);
+    for (size_t k = 0; k < rank; ++k) {
+        for (size_t j = 0; j < svd.cols; ++j) down[k * svd.cols + j] = static_cast<float>(svd.right[k * svd.cols + j]);
+        for (size_t i = 0; i < svd.rows; ++i) up[i * rank + k] = static_cast<float>(svd.left[k * svd.rows + i]);
+    }
+}
+
+// Fraction of the squared Frobenius norm kept by the first rank singular values
+inline double RetainedEnergy(const DenseSvd& svd, size_t rank) {
+    double kept = 0.0, total = 0.0;
+    for (size_t k = 0; k < svd.singular_values.size(); ++k) {
+        const double e = svd.singular_values[k] * svd.singular_values[k];
+        total += e;
+        if (k < rank) kept += e;
+    }
+    return total > 0.0 ? kept / total : 1.0;
+}
+
+} // namespace embedded_ml
+
+#endif // LOW_RANK_H
@@ -0,0 +1,150 @@
+// components/profiler.h
+// Opt-in timing probes with min/mean/p99 aggregation
+// Pure C++ implementation for embedded systems
+
+#ifndef PROFILER_H
+#define PROFILER_H
+
+#include <algorithm>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <cstdio>
+
+#if defined(ARDUINO)
+#include <Arduino.h>
+#else
+#include <chrono>
+#include <mutex>
+#endif
+
+namespace embedded_ml {
+
+// Free-running timestamp: CPU cycles on the device, nanoseconds on the host
+// Only differences are used, so wrap-around is harmless
+inline uint32_t ProfileNow() {
+#if defined(ARDUINO)
+    return ESP.getCycleCount();
+#else
+    return static_cast<uint32_t>(std::chrono::duration_cast<std::chrono::nanoseconds>(
+        std::chrono::steady_clock::now().time_since_epoch()).count());
+#endif
+}
+
+#if defined(ARDUINO)
+static constexpr const char* kProfileUnit = "cycles";
+#else
+static constexpr const char* kProfileUnit = "ns";
+#endif
+
+// Samples kept per probe for the p99 estimate (most recent window)
+static constexpr size_t kProfileWindow = 128;
+
+// One named probe. Instances are static and link themselves into a global
+// list on construction, so reports need no registration step. Record() may
+// run on any task or thread, concurrently with Report() (on the device the
+// generator task records while loop() reports from the other core), so each
+// probe's fields are only touched under its lock: a portMUX spinlock on the
+// device, a mutex on the host. Report() copies and resets a probe under the
+// lock and formats the copy outside it.
+class ProfileStat {
+public:
+    explicit ProfileStat(const char* name) : name_(name) {
+        next_ = Head().load(std::memory_order_relaxed);
+        while (!Head().compare_exchange_weak(next_, this, std::memory_order_release, std::memory_order_relaxed)) {
+        }
+    }
+
+    void Record(uint32_t delta) {
+        Lock();
+        if (count_ == 0 || delta < min_) min_ = delta;
+        sum_ += delta;
+        window_[count_ % kProfileWindow] = delta;
+        ++count_;
+        Unlock();
+    }
+
+    // Write one line per probe with samples since the last report, then reset
+    // Format: "prof name=<probe> unit=<unit> n=<count> min=<v> mean=<v> p99=<v>"
+    static void Report(void (*sink)(const char* line)) {
+        char line[128];
+        for (ProfileStat* stat = Head().load(std::memory_order_acquire); stat; stat = stat->next_) {
+            uint32_t sorted[kProfileWindow];
+            stat->Lock();
+            const uint32_t n = stat->count_;
+            const uint32_t min = stat->min_;
+            const uint64_t sum = stat->sum_;
+            const size_t kept = std::min<size_t>(n, kProfileWindow);
+            std::copy(stat->window_, stat->window_ + kept, sorted);
+            stat->count_ = 0;
+            stat->sum_ = 0;
+            stat->Unlock();
+            if (n == 0) continue;
+
+            std::sort(sorted, sorted + kept);
+            const uint32_t p99 = sorted[(kept * 99) / 100];
+
+            snprintf(line, sizeof(line), "prof name=%s unit=%s n=%lu min=%lu mean=%lu p99=%lu",
+                     stat->name_, kProfileUnit, static_cast<unsigned long>(n),
+                     static_cast<unsigned long>(min),
+                     static_cast<unsigned long>(sum / n),
+                     static_cast<unsigned long>(p99));
+            sink(line);
+        }
+    }
+
+private:
+    static std::atomic<ProfileStat*>& Head() {
+        static std::atomic<ProfileStat*> head{nullptr};
+        return head;
+    }
+
+#if defined(ARDUINO)
+    void Lock() { portENTER_CRITICAL(&mux_); }
+    void Unlock() { portEXIT_CRITICAL(&mux_); }
+    portMUX_TYPE mux_ = portMUX_INITIALIZER_UNLOCKED;
+#else
+    void Lock() { mutex_.lock(); }
+    void Unlock() { mutex_.unlock(); }
+    std::mutex mutex_;
+#endif
+
+    const char* name_;
+    ProfileStat* next_ = nullptr;
+    uint32_t count_ = 0;
+    uint32_t min_ = 0;
+    uint64_t sum_ = 0;
+    uint32_t window_[kProfileWindow] = {};
+};
+
+// Records the lifetime of the scope into a probe
+class ProfileScope {
+public:
+    explicit ProfileScope(ProfileStat& stat) : stat_(stat), start_(ProfileNow()) {}
+    ~ProfileScope() { stat_.Record(ProfileNow() - start_); }
+
+private:
+    ProfileStat& stat_;
+    uint32_t start_;
+};
+
+} // namespace embedded_ml
+
+// EMBEDDED_ML_PROFILED("name", statement) times the statement into probe "name"
+// EMBEDDED_ML_PROFILE_SCOPE("name") times the rest of the enclosing scope
+// Both compile to the bare code unless built with EMBEDDED_ML_PROFILE=1
+#if EMBEDDED_ML_PROFILE
+#define EMBEDDED_ML_PROFILE_SCOPE(name) \
+    static ::embedded_ml::ProfileStat embedded_ml_profile_stat_(name); \
+    ::embedded_ml::ProfileScope embedded_ml_profile_scope_(embedded_ml_profile_stat_)
+#define EMBEDDED_ML_PROFILED(name, ...) \
+    do { \
+        EMBEDDED_ML_PROFILE_SCOPE(name); \
+        __VA_ARGS__; \
+    } while (0)
+#else
+#define EMBEDDED_ML_PROFILE_SCOPE(name) do { } while (0)
+#define EMBEDDED_ML_PROFILED(name, ...) do { __VA_ARGS__; } while (0)
+#endif
+
+#endif // PROFILER_H
@@ -0,0 +1,133 @@
+// components/sampler.h
+// Random number generation and sampling components
+// Pure C++ implementation for embedded systems
+
+#ifndef SAMPLER_H
+#define SAMPLER_H
+
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+
+namespace embedded_ml {
+
+// PCG32 (XSH-RR) pseudo-random generator
+// Small, fast and seedable: the same seed and stream give the same sequence on
+// every platform, so generation runs can be reproduced on the host and the device
+class Pcg32 {
+public:
+    explicit Pcg32(uint64_t seed = 0x853c49e6748fea9bULL, uint64_t stream = 0xda3e39cb94b95bdbULL) {
+        Seed(seed, stream);
+    }
+
+    // Restart the sequence; distinct streams give independent sequences for the same seed
+    void Seed(uint64_t seed, uint64_t stream = 0xda3e39cb94b95bdbULL) {
+        state_ = 0;
+        inc_ = (stream << 1) | 1u;
+        NextU32();
+        state_ += seed;
+        NextU32();
+    }
+
+    uint32_t NextU32() {
+        const uint64_t old = state_;
+        state_ = old * 6364136223846793005ULL + inc_;
+        const uint32_t xorshifted = static_cast<uint32_t>(((old >> 18) ^ old) >> 27);
+        const uint32_t rot = static_cast<uint32_t>(old >> 59);
+        return (xorshifted >> rot) | (xorshifted << ((32 - rot) & 31));
+    }
+
+    // Uniform float in [0, 1) using the full 24-bit mantissa
+    float NextFloat() {
+        return static_cast<float>(NextU32() >> 8) * (1.0f / 16777216.0f);
+    }
+
+    // Uniform integer in [0, n) by multiply-shift (bias below n / 2^32)
+    uint32_t NextBelow(uint32_t n) {
+        return static_cast<uint32_t>((static_cast<uint64_t>(NextU32()) * n) >> 32);
+    }
+
+private:
+    uint64_t state_;
+    uint64_t inc_;
+};
+
+// Alias table for O(1) sampling from a fixed discrete distribution (Vose's method)
+// N: number of outcomes (at most 256)
+template<size_t N>
+class AliasTable {
+public:
+    static_assert(N > 0 && N <= 256, "alias indices are stored as uint8_t");
+
+    // Build from non-negative weights; they do not need to sum to 1
+    void Build(const float* weights) {
+        float total = 0.0f;
+        for (size_t i = 0; i < N; ++i) total += weights[i];
+
+        // Scale so the average bucket holds exactly 1
+        float scaled[N];
+        uint8_t small[N], large[N];
+        size_t num_small = 0, num_large = 0;
+        for (size_t i = 0; i < N; ++i) {
+            scaled[i] = total > 0.0f ? weights[i] * static_cast<float>(N) / total : 1.0f;
+            if (scaled[i] < 1.0f) {
+                small[num_small++] = static_cast<uint8_t>(i);
+            } else {
+                large[num_large++] = static_cast<uint8_t>(i);
+            }
+        }
+
+        // Pair each underfull bucket with an overfull one
+        while (num_small > 0 && num_large > 0) {
+            const uint8_t s = small[--num_small];
+            const uint8_t l = large[num_large - 1];
+            prob_[s] = scaled[s];
+            alias_[s] = l;
+            scaled[l] = (scaled[l] + scaled[s]) - 1.0f;
+            if (scaled[l] < 1.0f) {
+                --num_large;
+                small[num_small++] = l;
+            }
+        }
+
+        // Leftovers are full up to rounding
+        while (num_large > 0) {
+            const uint8_t l = large[--num_large];
+            prob_[l] = 1.0f;
+            alias_[l] = l;
+        }
+        while (num_small > 0) {
+            const uint8_t s = small[--num_small];
+            prob_[s] = 1.0f;
+            alias_[s] = s;
+        }
+    }
+
+    // Build for softmax(logits * inv_temp)
+    void BuildSoftmax(const float* logits, float inv_temp) {
+        float max_val = logits[0];
+        for (size_t i = 1; i < N; ++i) {
+            if (logits[i] > max_val) max_val = logits[i];
+        }
+
+        float weights[N];
+        for (size_t i = 0; i < N; ++i) {
+            weights[i] = std::exp((logits[i] - max_val) * inv_temp);
+        }
+        Build(weights);
+    }
+
+    // Draw an outcome: one bucket choice and one biased coin
+    size_t Sample(Pcg32& rng) const {
+        const size_t column = rng.NextBelow(static_cast<uint32_t>(N));
+        return rng.NextFloat() < prob_[column] ? column : alias_[column];
+    }
+
+private:
+    float prob_[N];
+    uint8_t alias_[N];
+};
+
+} // namespace embedded_ml
+
+#endif // SAMPLER_H
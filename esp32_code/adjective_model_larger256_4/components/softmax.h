@@ -8,6 +8,7 @@
 #include <cmath>
 #include <algorithm>
 #include <cstddef>
+#include <cstdint>
 
 namespace embedded_ml {
 
@@ -69,6 +70,150 @@ void Softmax(const T* input, T* output, size_t size) {
     }
 }
 
+// Softmax over a compile-time size N, separate input/output arrays
+// Same computation as Softmax(input, output, N)
+template<typename T, size_t N>
+void Softmax(const T* input, T* output) {
+    static_assert(N > 0, "softmax needs at least one input");
+
+    // Find maximum value for numerical stability
+    T max_val = input[0];
+    for (size_t i = 1; i < N; ++i) {
+        if (input[i] > max_val) {
+            max_val = input[i];
+        }
+    }
+
+    // Compute exponentials and sum
+    T sum = static_cast<T>(0);
+    for (size_t i = 0; i < N; ++i) {
+        output[i] = std::exp(input[i] - max_val);
+        sum += output[i];
+    }
+
+    // Normalize
+    if (sum > static_cast<T>(0)) {
+        for (size_t i = 0; i < N; ++i) {
+            output[i] /= sum;
+        }
+    }
+}
+
+// Temperature-scaled softmax on logits in one pass:
+// output[i] = exp((input[i] - max) * inv_temp) / sum(exp((input[j] - max) * inv_temp))
+// Same as Softmax(input / temperature), without a log/exp round trip through probabilities
+// inv_temp: 1 / temperature
+template<typename T>
+void SoftmaxWithTemperature(const T* input, T* output, size_t size, T inv_temp) {
+    if (size == 0) return;
+
+    // Find maximum value for numerical stability
+    T max_val = input[0];
+    for (size_t i = 1; i < size; ++i) {
+        if (input[i] > max_val) {
+            max_val = input[i];
+        }
+    }
+
+    // Compute scaled exponentials and sum
+    T sum = static_cast<T>(0);
+    for (size_t i = 0; i < size; ++i) {
+        output[i] = std::exp((input[i] - max_val) * inv_temp);
+        sum += output[i];
+    }
+
+    // Normalize
+    if (sum > static_cast<T>(0)) {
+        const T inv_sum = static_cast<T>(1) / sum;
+        for (size_t i = 0; i < size; ++i) {
+            output[i] *= inv_sum;
+        }
+    }
+}
+
+// Draw an index from SoftmaxWithTemperature(input) without normalizing:
+// the unnormalized weights are scanned against u * sum(weights)
+// u: uniform random number in [0, 1)
+// weights: scratch array of size size
+template<typename T>
+size_t SampleSoftmaxWithTemperature(const T* input, T* weights, size_t size, T inv_temp, T u) {
+    if (size == 0) return 0;
+
+    // Find maximum value for numerical stability
+    T max_val = input[0];
+    for (size_t i = 1; i < size; ++i) {
+        if (input[i] > max_val) {
+            max_val = input[i];
+        }
+    }
+
+    // Compute scaled exponentials and sum
+    T sum = static_cast<T>(0);
+    for (size_t i = 0; i < size; ++i) {
+        weights[i] = std::exp((input[i] - max_val) * inv_temp);
+        sum += weights[i];
+    }
+
+    // Cumulative scan against the unnormalized total
+    const T target = u * sum;
+    T cumulative = static_cast<T>(0);
+    for (size_t i = 0; i < size; ++i) {
+        cumulative += weights[i];
+        if (target < cumulative) return i;
+    }
+
+    // Only reached through rounding when u is close to 1: last nonzero weight
+    for (size_t i = size; i-- > 0;) {
+        if (weights[i] > static_cast<T>(0)) return i;
+    }
+    return size - 1;
+}
+
+// SampleSoftmaxWithTemperature over the indices whose bit is set in allowed
+// (size <= 32): the others get zero weight, and the maximum is taken over the
+// allowed inputs only, so the largest of them always has weight 1
+// Returns size if no index below size is allowed
+template<typename T>
+size_t SampleMaskedSoftmaxWithTemperature(const T* input, T* weights, size_t size, uint32_t allowed, T inv_temp, T u) {
+    size_t first = size;
+    for (size_t i = 0; i < size; ++i) {
+        if (allowed & (1u << i)) {
+            first = i;
+            break;
+        }
+    }
+    if (first == size) return size;
+
+    // Find maximum allowed value for numerical stability
+    T max_val = input[first];
+    for (size_t i = first + 1; i < size; ++i) {
+        if ((allowed & (1u << i)) && input[i] > max_val) {
+            max_val = input[i];
+        }
+    }
+
+    // Compute scaled exponentials and sum
+    T sum = static_cast<T>(0);
+    for (size_t i = 0; i < size; ++i) {
+        weights[i] = (allowed & (1u << i)) ? std::exp((input[i] - max_val) * inv_temp) : static_cast<T>(0);
+        sum += weights[i];
+    }
+
+    // Cumulative scan against the unnormalized total
+    const T target = u * sum;
+    T cumulative = static_cast<T>(0);
+    for (size_t i = 0; i < size; ++i) {
+        cumulative += weights[i];
+        if (target < cumulative) return i;
+    }
+
+    // Only reached through rounding when u is close to 1: last nonzero weight
+    for (size_t i = size; i-- > 0;) {
+        if (weights[i] > static_cast<T>(0)) return i;
+    }
+    return first;
+}
+
 } // namespace embedded_ml
 
 #endif // SOFTMAX_H
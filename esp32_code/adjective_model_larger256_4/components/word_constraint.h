@@ -0,0 +1,117 @@
+// components/word_constraint.h
+// Constrained decoding: masks of the characters allowed to come next
+// Pure C++ implementation for embedded systems
+//
+// Vocabulary indices as in vocab.h: 0 start, 1-26 'a'-'z', 27 end. The
+// generator asks AllowedMask() before each draw and samples only among the
+// set bits, so every finished word satisfies all rules and no draw is wasted
+// on a word that would be thrown away. The start token is never allowed.
+
+#ifndef WORD_CONSTRAINT_H
+#define WORD_CONSTRAINT_H
+
+#include "vocab.h"
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+
+namespace embedded_ml {
+
+// What to do with words of the lexicon (a generated *Lexicon class)
+enum class LexiconFilter : uint8_t {
+    NONE = 0,
+    NOVEL = 1,   // never produce a lexicon word
+    KNOWN = 2    // only produce lexicon words
+};
+
+// Stand-in lexicon for constraints without a word list
+struct NoLexicon {
+    static constexpr uint32_t kRoot = 2;
+    static constexpr uint32_t kMissing = 0;
+    static uint32_t Step(uint32_t, char) { return kMissing; }
+    static bool IsWord(uint32_t) { return false; }
+};
+
+// Prefix automaton over the word being generated
+// MaxLen: most letters a word can have; one ends by itself once it has MaxLen
+// Lexicon: kRoot/kMissing/Step/IsWord as in the generated *Lexicon classes
+template<size_t MaxLen, typename Lexicon = NoLexicon>
+class WordConstraint {
+public:
+    static constexpr size_t kStartIdx = START_IDX;
+    static constexpr size_t kEndIdx = END_IDX;
+
+    // banned: substrings no word may contain, nullptr-terminated (or nullptr)
+    WordConstraint(size_t min_len, const char* const* banned, LexiconFilter filter)
+        : min_len_(min_len), banned_(banned), filter_(filter) {
+        Reset();
+    }
+
+    // Start a new word
+    void Reset() {
+        len_ = 0;
+        word_[0] = '\0';
+        lexicon_ = Lexicon::kRoot;
+    }
+
+    // Bit i set if vocabulary index i may come next; 0 at a dead end, where
+    // every continuation breaks a rule (only possible with conflicting rules)
+    uint32_t AllowedMask() const {
+        uint32_t mask = 0;
+        if (len_ < MaxLen) {
+            for (uint32_t code = 1; code <= 26; ++code) {
+                if (LetterAllowed(static_cast<char>('a' + code - 1))) mask |= 1u << code;
+            }
+        }
+        if (Complete(len_, lexicon_)) mask |= 1u << kEndIdx;
+        return mask;
+    }
+
+    // Record an accepted letter index (1-26)
+    void Append(size_t idx) {
+        const char c = IdxToChar(static_cast<int>(idx));
+        lexicon_ = Lexicon::Step(lexicon_, c);
+        word_[len_++] = c;
+        word_[len_] = '\0';
+    }
+
+    const char* Word() const { return word_; }
+    size_t Length() const { return len_; }
+
+private:
+    // Whether a word may end with len letters at lexicon state
+    bool Complete(size_t len, uint32_t lexicon) const {
+        if (len < min_len_) return false;
+        if (filter_ == LexiconFilter::NOVEL && Lexicon::IsWord(lexicon)) return false;
+        if (filter_ == LexiconFilter::KNOWN && !Lexicon::IsWord(lexicon)) return false;
+        return true;
+    }
+
+    bool LetterAllowed(char c) const {
+        // Banned substrings ending in c, checked against the tail of the word
+        if (banned_) {
+            for (const char* const* s = banned_; *s; ++s) {
+                const size_t n = strlen(*s);
+                if (n == 0 || n > len_ + 1 || (*s)[n - 1] != c) continue;
+                if (memcmp(word_ + len_ + 1 - n, *s, n - 1) == 0) return false;
+            }
+        }
+
+        const uint32_t next = filter_ == LexiconFilter::NONE ? lexicon_ : Lexicon::Step(lexicon_, c);
+        if (filter_ == LexiconFilter::KNOWN && next == Lexicon::kMissing) return false;
+        // The last letter ends the word, so it has to leave a complete one
+        if (len_ + 1 == MaxLen) return Complete(len_ + 1, next);
+        return true;
+    }
+
+    size_t min_len_;
+    const char* const* banned_;
+    LexiconFilter filter_;
+    size_t len_;
+    uint32_t lexicon_;
+    char word_[MaxLen + 1];
+};
+
+} // namespace embedded_ml
+
+#endif // WORD_CONSTRAINT_H
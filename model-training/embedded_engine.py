@@ -0,0 +1,66 @@
+"""
+Python binding for the exported C++ model (the code that runs on the ESP32).
+
+Loads libadjective_model_larger256_4.so, built by `make python` in
+esp32_code/adjective_model_larger256_4, through ctypes. Generation runs the
+whole batch inside C++, so it is far faster than stepping a TFLite
+interpreter per character, and it samples like firmware built with the same
+weights and kernel backend (`make python DSP=1` for the ttgo-t1-dsp envs, up
+to the last bits the device's ESP-DSP kernel rounds differently).
+"""
+
+import ctypes
+import os
+
+import numpy as np
+
+DEFAULT_LIBRARY = os.path.join(
+    os.path.dirname(os.path.abspath(__file__)),
+    "..", "esp32_code", "adjective_model_larger256_4", "libadjective_model_larger256_4.so",
+)
+
+
+class EmbeddedEngine:
+    """The exported float model: batched prediction and word generation."""
+
+    def __init__(self, library_path: str = DEFAULT_LIBRARY):
+        if not os.path.exists(library_path):
+            raise FileNotFoundError(
+                f"{library_path} not found; run `make python` in esp32_code/adjective_model_larger256_4")
+        lib = ctypes.CDLL(library_path)
+
+        for name in ("input_size", "output_size", "max_word_len"):
+            getattr(lib, f"adjective_model_larger256_4_{name}").restype = ctypes.c_uint32
+
+        lib.adjective_model_larger256_4_predict.argtypes = [
+            ctypes.POINTER(ctypes.c_float), ctypes.c_uint32, ctypes.POINTER(ctypes.c_float)]
+        lib.adjective_model_larger256_4_predict.restype = None
+
+        lib.adjective_model_larger256_4_generate.argtypes = [
+            ctypes.c_uint32, ctypes.c_float, ctypes.c_uint64, ctypes.c_char_p]
+        lib.adjective_model_larger256_4_generate.restype = ctypes.c_int
+
+        self._lib = lib
+        self.input_size = lib.adjective_model_larger256_4_input_size()
+        self.output_size = lib.adjective_model_larger256_4_output_size()
+        self.max_word_len = lib.adjective_model_larger256_4_max_word_len()
+
+    def predict(self, inputs: np.ndarray) -> np.ndarray:
+        """Softmax outputs for a [batch, input_size] array, like the TFLite model."""
+        inputs = np.ascontiguousarray(inputs, dtype=np.float32)
+        if inputs.ndim != 2 or inputs.shape[1] != self.input_size:
+            raise ValueError(f"expected shape [batch, {self.input_size}], got {inputs.shape}")
+        outputs = np.empty((inputs.shape[0], self.output_size), dtype=np.float32)
+        self._lib.adjective_model_larger256_4_predict(
+            inputs.ctypes.data_as(ctypes.POINTER(ctypes.c_float)), inputs.shape[0],
+            outputs.ctypes.data_as(ctypes.POINTER(ctypes.c_float)))
+        return outputs
+
+    def generate(self, n: int, temperature: float = 1.0, seed: int = 0) -> list[str]:
+        """Sample n words; the same seed gives the same words on every machine."""
+        row = self.max_word_len + 1
+        buffer = ctypes.create_string_buffer(n * row)
+        if self._lib.adjective_model_larger256_4_generate(n, temperature, seed, buffer) != 0:
+            raise ValueError(f"temperature must be positive, got {temperature}")
+        raw = buffer.raw
+        return [raw[i * row:(i + 1) * row].split(b"\0", 1)[0].decode("ascii") for i in range(n)]
@@ -208,6 +208,48 @@ def test_generation(interpreter, n: int = 30):
         print("  " + ", ".join(words))
 
 
+# ---------------------------------------------------------------------------
+# 8. Exported C++ model (embedded_engine.py, `make python` in esp32_code)
+# ---------------------------------------------------------------------------
+
+def test_generation_embedded(engine, n: int = 30, seed: int = 0):
+    """Generate sample words at various temperatures with the C++ model."""
+    print("\n--- Sample generated words (C++ engine) ---")
+    for temp in [0.5, 0.8, 1.0, 1.3]:
+        words = engine.generate(n, temperature=temp, seed=seed)
+        print(f"\nTemperature {temp}:")
+        print("  " + ", ".join(words))
+
+
+# Largest probability difference check_parity accepts between TFLite and C++
+PARITY_TOLERANCE = 1e-4
+
+
+def check_parity(interpreter, engine):
+    """Compare TFLite and C++ outputs on every input generation can produce.
+
+    Only meaningful when the TFLite model is the one the C++ code was exported from;
+    exits if any probability differs by more than PARITY_TOLERANCE.
+    """
+    input_dim = VOCAB_SIZE + 1
+    inputs = np.zeros((MAX_WORD_LEN * VOCAB_SIZE, input_dim), dtype=np.float32)
+    for pos in range(MAX_WORD_LEN):
+        for char_idx in range(VOCAB_SIZE):
+            inputs[pos * VOCAB_SIZE + char_idx, char_idx] = 1.0
+            inputs[pos * VOCAB_SIZE + char_idx, -1] = pos / SEQ_LEN
+
+    expected = np.concatenate([tflite_predict(interpreter, inputs[i:i + 1]) for i in range(len(inputs))])
+    actual = engine.predict(inputs)
+
+    exact = int(np.sum(np.all(expected == actual, axis=1)))
+    same_argmax = int(np.sum(np.argmax(expected, axis=1) == np.argmax(actual, axis=1)))
+    print(f"\nParity on {len(inputs)} inputs: max |dp| {np.max(np.abs(expected - actual)):.3g}, "
+          f"{exact} bit-identical, {same_argmax} same argmax")
+    if np.max(np.abs(expected - actual)) > PARITY_TOLERANCE:
+        raise SystemExit("C++ model does not match the TFLite model; "
+                         "re-export it and rebuild the library with `make python`")
+
+
 # ---------------------------------------------------------------------------
 # Main
 # ---------------------------------------------------------------------------
@@ -218,9 +260,27 @@ if __name__ == "__main__":
     parser.add_argument("--depth", type=int, default=2, help="number of hidden layers (default: 2)")
     parser.add_argument("--epochs", type=int, default=120, help="training epochs (default: 120)")
     parser.add_argument("--batch-size", type=int, default=64, help="batch size (default: 64)")
+    parser.add_argument("--model", help="evaluate this .tflite model instead of training one")
+    parser.add_argument("--engine", choices=["tflite", "cpp"], default="tflite",
+                        help="generate with the TFLite model or the exported C++ model; "
+                             "cpp needs --model, the model the library was exported from, "
+                             "and checks the two agree first (default: tflite)")
+    parser.add_argument("--library", help="C++ model library (default: the `make python` build)")
+    parser.add_argument("--seed", type=int, default=0, help="C++ engine sampling seed (default: 0)")
     args = parser.parse_args()
+    if args.engine == "cpp" and not args.model:
+        # The library holds the weights it was exported from, not a model trained now
+        parser.error("--engine cpp needs --model, the .tflite the C++ model was exported from")
 
-    tflite_path = train(epochs=args.epochs, batch_size=args.batch_size,
-                        width=args.width, depth=args.depth)
+    tflite_path = args.model or train(epochs=args.epochs, batch_size=args.batch_size,
+                                      width=args.width, depth=args.depth)
     interpreter = load_tflite_model(tflite_path)
-    test_generation(interpreter)
+    if args.engine == "cpp":
+        from embedded_engine import EmbeddedEngine
+        engine = EmbeddedEngine(args.library) if args.library else EmbeddedEngine()
+        if (engine.input_size, engine.output_size, engine.max_word_len) != (VOCAB_SIZE + 1, VOCAB_SIZE, MAX_WORD_LEN):
+            raise SystemExit("C++ model vocabulary (components/vocab.h) does not match train.py")
+        check_parity(interpreter, engine)
+        test_generation_embedded(engine, seed=args.seed)
+    else:
+        test_generation(interpreter)